@@ -1,14 +1,38 @@
 #include <types.h>
 #include <api_types.h>
 #include <HTTPClient.h>
+#include <functional>
+#include <http_body_reader.h>
 
 struct ApiDisplayResult
 {
   https_request_err_e error;
   ApiDisplayResponse response;
   String error_detail;
+  bool image_inline;                // the image came with the response and went to the InlineImageHandler
+  https_request_err_e image_result; // what the InlineImageHandler returned
 };
 
+/**
+ * Image that came with the metadata in an envelope (see display_envelope.h), still
+ * to be read from the connection. Only valid during the InlineImageHandler call;
+ * the connection stays fetchApiDisplay()'s, it is closed once the handler returns.
+ */
+struct InlineImage
+{
+  HttpBodyReader &body; // positioned at the first image byte
+  uint8_t type;         // display_envelope_image_e
+  uint32_t length;
+};
+
+/** Shows an inline image; must not end the request or turn WiFi off */
+typedef std::function<https_request_err_e(ApiDisplayResponse &response, InlineImage &image)> InlineImageHandler;
+
 void addHeaders(HTTPClient &https, ApiDisplayInputs &apiDisplayInputs);
 
-ApiDisplayResult fetchApiDisplay(ApiDisplayInputs &apiDisplayInputs);
\ No newline at end of file
+/**
+ * @brief Calls /api/display, offering to take the image in the same response
+ * @param onInlineImage called while the response is read if the server sent the image
+ * along; otherwise the image is left to be fetched from image_url
+ */
+ApiDisplayResult fetchApiDisplay(ApiDisplayInputs &apiDisplayInputs, InlineImageHandler onInlineImage);
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Wall clock that never waits for the network.
+ *
+ * The system clock keeps counting through deep sleep; a WallClock in RTC memory
+ * tracks how much it drifts and corrects it. SNTP is only started when a sync is
+ * due, and then runs in the background while the API request goes ahead; its answer
+ * is taken whenever it arrives. Until the first sync after a power loss the time is
+ * unknown (0).
+ */
+
+/** @brief Counts the wake and starts an SNTP sync if one is due. Call once WiFi is connected */
+void clock_service_begin(void);
+
+/** @return corrected UTC time in seconds, 0 if unknown. Never blocks */
+uint32_t clock_service_now(void);
+
+/** @brief Stops SNTP and logs the sync result. Call before WiFi is turned off */
+void clock_service_end(void);
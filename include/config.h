@@ -30,12 +30,25 @@
 #define PREFERENCES_DEVICE_REGISTERED_KEY "plugin"
 #define PREFERENCES_SF_KEY "sf"
 #define PREFERENCES_FILENAME_KEY "filename"
+#define PREFERENCES_IMAGE_ETAG_KEY "img_etag"
+#define PREFERENCES_IMAGE_LAST_MODIFIED_KEY "img_modified"
+#define PREFERENCES_IMAGE_URL_KEY "img_url"
 #define PREFERENCES_LAST_SLEEP_TIME "last_sleep"
 #define PREFERENCES_CONNECT_API_RETRY_COUNT "retry_count"
 #define PREFERENCES_CONNECT_WIFI_RETRY_COUNT "wifi_retry"
 
 #define WIFI_CONNECTION_RSSI (-100)
 
+// Error diffusion for grayscale and truecolor PNGs shown on 1-bit panels (DITHER_NONE, DITHER_FLOYD_STEINBERG or DITHER_ATKINSON)
+#ifndef PNG_DITHER_MODE
+#define PNG_DITHER_MODE DITHER_FLOYD_STEINBERG
+#endif
+
+// JPEGs on panels without color: 1 = 4-gray through both planes (full refresh), 0 = 1-bit dithered
+#ifndef JPEG_FOUR_GRAY
+#define JPEG_FOUR_GRAY 1
+#endif
+
 #define DISPLAY_BMP_IMAGE_SIZE 48062 // in bytes - 62 bytes - header; 48000 bytes - bitmap (480*800 1bpp) / 8
 #define DEFAULT_IMAGE_SIZE 48000
 #ifdef BOARD_TRMNL_X
@@ -3,6 +3,7 @@
 
 #include <Arduino.h>
 #include "DEV_Config.h"
+#include <png_stream.h>
 
 enum MSG
 {
@@ -63,6 +64,12 @@ uint16_t display_height();
  */
 uint16_t display_width();
 
+/**
+ * @brief Function to list the image formats display_show_image() can render on this panel
+ * @return set of image_format_e (see image_formats.h)
+ */
+uint32_t display_image_formats();
+
 /**
  * @brief Function to draw multi-line text onto the display
  * @param x_start X coordinate to start drawing
@@ -85,10 +92,53 @@ void Paint_DrawMultilineText(UWORD x_start, UWORD y_start, const char *message,
  * @brief Function to show the image on the display
  * @param image_buffer pointer to the uint8_t image buffer
  * @param reverse shows if the color scheme is reverse
+ * @return false if the image was rejected and the panel left as it was
+ */
+
+bool display_show_image(uint8_t *image_buffer, int data_size, bool bWait);
+
+/** Returned by display_stream_png() when the image needs the whole file in RAM (e.g. to count colors first) */
+#define DISPLAY_STREAM_NEEDS_BUFFER -2
+
+/**
+ * @brief Function to decode a PNG while it is being downloaded and write it to the EPD
+ *        Nothing is written to the panel when DISPLAY_STREAM_NEEDS_BUFFER is returned,
+ *        so the caller can buffer the rest of the file and use display_show_image()
+ * @param source PNG stream positioned at the start of the response body
+ * @return refresh mode for display_refresh_image(), -1 on failure or DISPLAY_STREAM_NEEDS_BUFFER
+ */
+int display_stream_png(PngStreamSource &source);
+
+/**
+ * @brief Function to refresh the EPD after display_stream_png() has written the image data
+ * @param iRefreshMode refresh mode returned by display_stream_png()
+ * @param bWait wait for the refresh to complete
  * @return none
  */
+void display_refresh_image(int iRefreshMode, bool bWait);
 
-void display_show_image(uint8_t *image_buffer, int data_size, bool bWait);
+/**
+ * @brief Function to let the refreshes which wait return as soon as they are started
+ *        The panel keeps updating on its own; the next command sent to it, display_sleep()
+ *        or display_refresh_join() waits for it to finish.
+ * @param async true to start refreshes and join them later
+ * @return none
+ */
+void display_set_async_refresh(bool async);
+
+/**
+ * @brief Function to tell if a refresh was started asynchronously and not joined yet
+ * @param none
+ * @return true if display_refresh_join() has something to wait for
+ */
+bool display_refresh_pending(void);
+
+/**
+ * @brief Function to wait for the refresh started asynchronously
+ * @param none
+ * @return time waited in ms, 0 if no refresh was pending
+ */
+int display_refresh_join(void);
 
 /**
  * @brief Function to read an image from the file system
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <resumable_download.h>
+
+#define PARTIAL_DOWNLOAD_BODY_FILE "/partial.bin"
+#define PARTIAL_DOWNLOAD_META_FILE "/partial.meta"
+
+/** PartialDownloadStore over two SPIFFS files: the body bytes and a PartialDownloadMeta */
+class SpiffsPartialStore : public PartialDownloadStore
+{
+public:
+  bool readMeta(PartialDownloadMeta &meta) override;
+  bool writeMeta(const PartialDownloadMeta &meta) override;
+  size_t bodySize() override;
+  bool readBody(uint8_t *buf, size_t len) override;
+  bool writeBody(const uint8_t *data, size_t len) override;
+  void remove() override;
+
+  /** @brief Takes a file that already holds the received bytes (e.g. the copy made while streaming) as the body */
+  bool adopt(const char *path);
+};
@@ -0,0 +1,22 @@
+#pragma once
+
+/**
+ * Share of RTC memory (RTC_DATA_ATTR, kept across deep sleep) each module may use.
+ *
+ * The ESP32-C3 has 8 KB of it. ESP-IDF takes some for itself (the deep sleep wake
+ * stub and RTC_NOINIT data of its own components), so 1 KB of it is left alone.
+ * Each module checks its own RTC data against its share with a static_assert, and the
+ * shares are checked against the whole here; a new RTC user takes a share of its own.
+ */
+#define RTC_MEMORY_SIZE 8192
+#define RTC_MEMORY_RESERVED 1024 // ESP-IDF
+
+#define RTC_BUDGET_DISPLAY 2304 // display.cpp: update count, palette maps (544), tile hashes (1608), kept frame (16)
+#define RTC_BUDGET_TLS 1664     // tls_session_resume.cpp: one TLS session (1604)
+#define RTC_BUDGET_BL 128       // bl.cpp: refresh flag, image validators (112)
+#define RTC_BUDGET_DNS 128      // udp_dns_resolver.cpp: cached addresses (68)
+#define RTC_BUDGET_CLOCK 64     // clock_service.cpp: wall clock (32)
+
+static_assert(RTC_BUDGET_DISPLAY + RTC_BUDGET_TLS + RTC_BUDGET_BL + RTC_BUDGET_DNS + RTC_BUDGET_CLOCK <=
+                  RTC_MEMORY_SIZE - RTC_MEMORY_RESERVED,
+              "RTC memory shares add up to more than there is");
@@ -0,0 +1,15 @@
+#pragma once
+
+/**
+ * TLS session resumption for every WiFiClientSecure connection.
+ *
+ * The Arduino ssl_client gives no access to the mbedtls context between setup and
+ * handshake, so the calls it makes are intercepted at link time
+ * (-Wl,--wrap=mbedtls_ssl_set_hostname -Wl,--wrap=mbedtls_ssl_handshake):
+ * a cached session for the host is offered before the handshake, and the
+ * negotiated one is saved after it. Sessions are kept in RTC memory, so the
+ * first request after deep sleep can resume too.
+ */
+
+/** @brief Logs average handshake times with and without resumption */
+void tls_session_log_stats(void);
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <dns_cache.h>
+
+/**
+ * DnsResolver that sends its own queries to the DNS server handed out by DHCP.
+ *
+ * WiFi.hostByName() goes through the lwIP resolver, which blocks and does not
+ * report TTLs; this one uses non-blocking UDP sockets so a query can be left
+ * running while the request that needed the address goes ahead.
+ */
+class UdpDnsResolver : public DnsResolver
+{
+public:
+  UdpDnsResolver();
+  bool start(const char *host) override;
+  dns_query_state_e poll(const char *host, uint32_t *address, uint32_t *ttl_s) override;
+
+private:
+  struct Query
+  {
+    char host[DNS_CACHE_HOST_MAX_LEN];
+    int sock; // -1 = free slot
+    uint16_t id;
+  };
+
+  Query *find(const char *host);
+  void close(Query &query);
+
+  Query queries[DNS_CACHE_ENTRIES + 1]; // background refreshes plus the lookup being waited for
+};
+
+/** Addresses of the API and image hosts, kept in RTC memory across deep sleep */
+extern DnsCache dnsCache;
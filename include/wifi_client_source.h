@@ -0,0 +1,35 @@
+#pragma once
+
+#include <WiFiClient.h>
+#include <http_body_reader.h>
+
+/**
+ * ByteSource backed by the stream of an HTTPClient / WiFiClient
+ */
+class WiFiClientSource : public ByteSource
+{
+public:
+  WiFiClientSource(WiFiClient &client);
+
+  int available() override;
+
+  int read(uint8_t *buf, size_t size) override;
+
+  bool connected() override;
+
+private:
+  WiFiClient &_client;
+};
+
+/**
+ * @brief Body reader options using millis() and a short delay while waiting for data
+ * @param total_timeout_ms overall download timeout
+ * @param idle_timeout_ms maximum time without any data
+ */
+HttpBodyReaderOptions downloadReaderOptions(uint32_t total_timeout_ms, uint32_t idle_timeout_ms);
+
+/**
+ * @brief Allocates the download buffer, preferring PSRAM when the board has it
+ * @return buffer to be released with free(), or nullptr
+ */
+uint8_t *allocDownloadBuffer(size_t size);
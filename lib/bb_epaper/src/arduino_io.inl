@@ -24,8 +24,31 @@
 #include "bb_epaper.h"
 #include "../../trmnl/include/trmnl_log.h"
 
+#if defined(ARDUINO_ARCH_ESP32) && !defined(BBEP_NO_SPI_QUEUE)
+#define BBEP_SPI_QUEUE // data goes out by DMA while the next rows are prepared
+#endif
+
+#ifdef BBEP_SPI_QUEUE
+#include "driver/spi_master.h"
+#include "esp_attr.h"
+#include "bb_ep_queue.inl"
+#define BBEP_QUEUE_SIZE 2048 // bytes in each of the 2 DMA buffers
+#if CONFIG_IDF_TARGET_ESP32
+#define BBEP_SPI_HOST VSPI_HOST
+#else
+#define BBEP_SPI_HOST SPI2_HOST
+#endif
+static spi_device_handle_t bbepSpi = NULL;
+static spi_transaction_t bbepTrans; // the queued transfer in flight
+static BBEP_SPI_QUEUE bbepQueue;
+static WORD_ALIGNED_ATTR DMA_ATTR uint8_t u8QueueBuf[2][BBEP_QUEUE_SIZE];
+static int iQueueCS = -1; // CS pin of the queued bytes
+static int iActiveCS = -1; // and of the transfer in flight
+#endif
+
 // foreward references
 void bbepWakeUp(BBEPDISP *pBBEP);
+void bbepWaitBusy(BBEPDISP *pBBEP);
 void bbepSendCMDSequence(BBEPDISP *pBBEP, const uint8_t *pSeq);
 //
 // Set the second CS pin for dual-controller displays
@@ -53,6 +76,73 @@ uint8_t uc;
         }
     }
 } /* SPI_Write() */
+
+#ifdef ARDUINO_ARCH_ESP32
+//
+// Send bytes on the hardware SPI bus and return when they're out
+//
+static void bbepSpiWrite(uint8_t *pData, int iLen)
+{
+#ifdef BBEP_SPI_QUEUE
+spi_transaction_t t;
+int iCount;
+
+    while (iLen > 0) {
+        iCount = (iLen > BBEP_QUEUE_SIZE) ? BBEP_QUEUE_SIZE : iLen; // max_transfer_sz of the bus
+        memset(&t, 0, sizeof(t));
+        t.length = iCount * 8; // in bits
+        if (iCount <= 4) { // commands and their parameters: no DMA buffer needed
+            t.flags = SPI_TRANS_USE_TXDATA;
+            memcpy(t.tx_data, pData, iCount);
+        } else {
+            t.tx_buffer = pData;
+        }
+        spi_device_polling_transmit(bbepSpi, &t);
+        pData += iCount;
+        iLen -= iCount;
+    }
+#else
+    SPI.transferBytes(pData, NULL, iLen);
+#endif
+} /* bbepSpiWrite() */
+#endif // ARDUINO_ARCH_ESP32
+
+#ifdef BBEP_SPI_QUEUE
+//
+// Transport of the data queue: one DMA transfer at a time, framed by its CS pin
+//
+static void bbepQueueStartDMA(void *pUser, uint8_t *pData, int iLen)
+{
+    (void)pUser;
+    iActiveCS = iQueueCS;
+    digitalWrite(iActiveCS, LOW);
+    memset(&bbepTrans, 0, sizeof(bbepTrans));
+    bbepTrans.length = iLen * 8; // in bits
+    bbepTrans.tx_buffer = pData;
+    spi_device_queue_trans(bbepSpi, &bbepTrans, portMAX_DELAY);
+} /* bbepQueueStartDMA() */
+
+static void bbepQueueWaitDMA(void *pUser)
+{
+spi_transaction_t *pTrans;
+
+    (void)pUser;
+    spi_device_get_trans_result(bbepSpi, &pTrans, portMAX_DELAY);
+    digitalWrite(iActiveCS, HIGH);
+} /* bbepQueueWaitDMA() */
+#endif // BBEP_SPI_QUEUE
+//
+// Send any queued data to the panel and wait until it's out
+// Anything else sent to the panel (commands, a CS or reset change, a wait
+// for BUSY) has to come after this
+//
+void bbepFlushData(BBEPDISP *pBBEP)
+{
+    (void)pBBEP;
+#ifdef BBEP_SPI_QUEUE
+    bbepQueueFlush(&bbepQueue);
+#endif
+} /* bbepFlushData() */
 //
 // Initialize the GPIO pins and SPI for use by bb_eink
 //
@@ -81,16 +171,41 @@ void bbepInitIO(BBEPDISP *pBBEP, uint8_t u8DC, uint8_t u8RST, uint8_t u8BUSY, ui
         pinMode(pBBEP->iMOSIPin, OUTPUT);
         pinMode(pBBEP->iCLKPin, OUTPUT);
     } else {
-#ifdef ARDUINO_ARCH_ESP32
+#ifdef BBEP_SPI_QUEUE
+        if (bbepSpi == NULL) { // the bus stays set up until the next boot
+            spi_bus_config_t buscfg;
+            spi_device_interface_config_t devcfg;
+            memset(&buscfg, 0, sizeof(buscfg));
+            buscfg.miso_io_num = -1;
+            buscfg.mosi_io_num = pBBEP->iMOSIPin;
+            buscfg.sclk_io_num = pBBEP->iCLKPin;
+            buscfg.quadwp_io_num = -1;
+            buscfg.quadhd_io_num = -1;
+            buscfg.max_transfer_sz = BBEP_QUEUE_SIZE;
+            memset(&devcfg, 0, sizeof(devcfg));
+            devcfg.clock_speed_hz = u32Speed;
+            devcfg.mode = 0;
+            devcfg.spics_io_num = -1; // we control the CS pin
+            devcfg.queue_size = 1; // one buffer in flight while the other fills
+            devcfg.flags = SPI_DEVICE_HALFDUPLEX;
+            if (spi_bus_initialize(BBEP_SPI_HOST, &buscfg, SPI_DMA_CH_AUTO) != ESP_OK ||
+                spi_bus_add_device(BBEP_SPI_HOST, &devcfg, &bbepSpi) != ESP_OK) {
+                Log_error("bbepInitIO: SPI bus setup failed");
+            }
+            bbepQueueInit(&bbepQueue, u8QueueBuf[0], u8QueueBuf[1], BBEP_QUEUE_SIZE, bbepQueueStartDMA, bbepQueueWaitDMA, NULL);
+        }
+#elif defined(ARDUINO_ARCH_ESP32)
         SPI.begin(pBBEP->iCLKPin, -1, pBBEP->iMOSIPin, -1); //pBBEP->iCSPin);
 #else
         SPI.begin(); // other architectures have fixed SPI pins
 #endif
+#ifndef BBEP_SPI_QUEUE
         SPI.beginTransaction(SPISettings(u32Speed, MSBFIRST, SPI_MODE0));
 #ifdef ARDUINO_ARCH_ESP32
 // For NRF52, you have to leave an 'open' transaction
         SPI.endTransaction(); // N.B. - if you call beginTransaction() again without a matching endTransaction(), it will hang on ESP32
 #endif
+#endif // !BBEP_SPI_QUEUE
     }
     pBBEP->is_awake = 1;
 // Before we can start sending pixels, many panels need to know the display resolution
@@ -113,9 +228,10 @@ void bbepWriteIT8951Cmd(BBEPDISP *pBBEP, uint16_t cmd)
     ucTemp[1] = 0;
     ucTemp[2] = (uint8_t)(cmd >> 8);
     ucTemp[3] = (uint8_t)cmd;
+    bbepFlushData(pBBEP);
     digitalWrite(pBBEP->iCSPin, LOW);
 #ifdef ARDUINO_ARCH_ESP32
-    SPI.transferBytes(ucTemp, NULL, 4);
+    bbepSpiWrite(ucTemp, 4);
 #else
     SPI.transfer(ucTemp, 4);
 #endif
@@ -124,12 +240,15 @@ void bbepWriteIT8951Cmd(BBEPDISP *pBBEP, uint16_t cmd)
 
 void bbepWriteIT8951Data(BBEPDISP *pBBEP, uint8_t *pData, int iLen)
 {
+    bbepFlushData(pBBEP);
     digitalWrite(pBBEP->iCSPin, LOW);
-    SPI.transfer(0);
-    SPI.transfer(0); // 0x0000 is the data introducer
 #ifdef ARDUINO_ARCH_ESP32
-    SPI.transferBytes(pData, NULL, iLen);
+    uint8_t ucIntro[2] = {0, 0}; // 0x0000 is the data introducer
+    bbepSpiWrite(ucIntro, 2);
+    bbepSpiWrite(pData, iLen);
 #else
+    SPI.transfer(0);
+    SPI.transfer(0); // 0x0000 is the data introducer
     SPI.transfer(pData, iLen);
 #endif
     digitalWrite(pBBEP->iCSPin, HIGH);
@@ -148,6 +267,10 @@ void bbepWriteIT8951CmdArgs(BBEPDISP *pBBEP, uint16_t cmd, uint16_t *pArgs, int
 //
 void bbepWriteCmd(BBEPDISP *pBBEP, uint8_t cmd)
 {
+    bbepFlushData(pBBEP); // the data before it has to be out first
+    if (pBBEP->busy_pending) { // commands sent while it refreshes would be lost
+        bbepWaitBusy(pBBEP);
+    }
     if (!pBBEP->is_awake) {
         // if it's asleep, it can't receive commands
         bbepWakeUp(pBBEP);
@@ -159,7 +282,11 @@ void bbepWriteCmd(BBEPDISP *pBBEP, uint8_t cmd)
     if (pBBEP->iSpeed == 0) { // bit bang
         SPI_Write(pBBEP, &cmd, 1);
     } else {
+#ifdef ARDUINO_ARCH_ESP32
+        bbepSpiWrite(&cmd, 1);
+#else
         SPI.transfer(cmd);
+#endif
     }
     digitalWrite(pBBEP->iCSPin, HIGH);
     digitalWrite(pBBEP->iDCPin, HIGH); // leave data mode as the default
@@ -170,6 +297,17 @@ void bbepWriteCmd(BBEPDISP *pBBEP, uint8_t cmd)
 void bbepWriteData(BBEPDISP *pBBEP, uint8_t *pData, int iLen)
 {
 //    digitalWrite(pBBEP->iDCPin, HIGH);
+#ifdef BBEP_SPI_QUEUE
+    if (pBBEP->iSpeed != 0 && !(pBBEP->iFlags & BBEP_CS_EVERY_BYTE) && bbepQueue.iSize) {
+        if (pBBEP->iCSPin != iQueueCS) { // e.g. the second controller of a split panel
+            bbepQueueFlush(&bbepQueue);
+            iQueueCS = pBBEP->iCSPin;
+        }
+        bbepQueueWrite(&bbepQueue, pData, iLen);
+        return;
+    }
+    bbepQueueFlush(&bbepQueue); // keep the order of the bytes queued before
+#endif
 #ifdef ARDUINO_ARCH_ESP32
     if (pBBEP->iFlags & BBEP_CS_EVERY_BYTE) {
         for (int i=0; i<iLen; i++) {
@@ -177,7 +315,7 @@ void bbepWriteData(BBEPDISP *pBBEP, uint8_t *pData, int iLen)
             if (pBBEP->iSpeed == 0) { // bit bang
                 SPI_Write(pBBEP, &pData[i], 1);
             } else {
-                SPI.transfer(pData[i]);
+                bbepSpiWrite(&pData[i], 1);
             }
             digitalWrite(pBBEP->iCSPin, HIGH);
         }
@@ -186,7 +324,7 @@ void bbepWriteData(BBEPDISP *pBBEP, uint8_t *pData, int iLen)
         if (pBBEP->iSpeed == 0) { // bit bang
             SPI_Write(pBBEP, pData, iLen);
         } else {
-            SPI.transferBytes(pData, NULL, iLen);
+            bbepSpiWrite(pData, iLen);
         }
         digitalWrite(pBBEP->iCSPin, HIGH);
     }
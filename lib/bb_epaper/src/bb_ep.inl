@@ -20,6 +20,17 @@
 
 #include "bb_epaper.h"
 #include "../../trmnl/include/trmnl_log.h"
+#include "bb_ep_busy.inl"
+#include "bb_ep_prev.inl"
+#if defined(ARDUINO_ARCH_ESP32) && !defined(DO_NOT_LIGHT_SLEEP)
+#include "driver/gpio.h"
+#include "esp_sleep.h"
+#endif
+
+// Longest wait for BUSY unless the panel sets iTimeout
+#define BBEP_BUSY_TIMEOUT 5000 // B/W and gray updates should never take more than 3 seconds
+#define BBEP_BUSY_TIMEOUT_COLOR 40000 // red/yellow and Spectra updates take 15 to 30 seconds
+#define BBEP_BUSY_POLL 10 // ms between reads of BUSY when the wait can't wake on the pin
 
 // forward declarations
 void InvertBytes(uint8_t *pData, uint8_t bLen);
@@ -2783,28 +2794,64 @@ void bbepLightSleep(uint32_t u32Millis)
 #endif
 }
 //
+// BUSY line access for bbepWaitPin()
+//
+static int bbepBusyRead(void *pUser)
+{
+    return digitalRead(((BBEPDISP *)pUser)->iBUSYPin);
+} /* bbepBusyRead() */
+
+static uint32_t bbepBusyMillis(void *pUser)
+{
+    (void)pUser;
+    return (uint32_t)millis();
+} /* bbepBusyMillis() */
+
+static void bbepBusySleep(void *pUser, uint32_t u32Millis, int iWakeLevel)
+{
+#if defined(ARDUINO_ARCH_ESP32) && !defined(DO_NOT_LIGHT_SLEEP)
+    // light sleep can only wake on a level; the idle level is the end of BUSY
+    gpio_num_t pin = (gpio_num_t)((BBEPDISP *)pUser)->iBUSYPin;
+    gpio_wakeup_enable(pin, (iWakeLevel == HIGH) ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+    esp_sleep_enable_timer_wakeup(u32Millis * 1000ULL); // the deadline
+    esp_light_sleep_start();
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+    gpio_wakeup_disable(pin);
+#else
+    (void)pUser; (void)iWakeLevel;
+    delay((u32Millis < BBEP_BUSY_POLL) ? u32Millis : BBEP_BUSY_POLL);
+#endif
+} /* bbepBusySleep() */
+//
 // Wait for the busy status line to show idle
 // The polarity of the busy signal is reversed on the UC81xx compared
 // to the SSD16xx controllers
+// The time it took is kept in iBusyTime; a timeout sets last_error
 //
 void bbepWaitBusy(BBEPDISP *pBBEP)
 {
-    int iTimeout = 0;
+    BBEP_BUSY_IO io = {bbepBusyRead, bbepBusyMillis, bbepBusySleep, pBBEP};
+    uint32_t u32Start, u32Timeout, u32Busy;
 
     if (!pBBEP) return;
+    pBBEP->busy_pending = 0;
+    bbepFlushData(pBBEP); // BUSY only means something once the data is out
     if (pBBEP->iBUSYPin == 0xff) return;
+    u32Start = millis();
     delay(10); // give time for the busy status to be valid
     uint8_t busy_idle =  (pBBEP->chip_type == BBEP_CHIP_UC81xx) ? HIGH : LOW;
     Log_verbose("bbepWaitBusy: waiting for pin %d to be %d", pBBEP->iBUSYPin, busy_idle);
     delay(1); // some panels need a short delay before testing the BUSY line
-    while (iTimeout < 5000) { // B/W updates should never take more than 3 seconds
-        if (digitalRead(pBBEP->iBUSYPin) == busy_idle) break;
-        // delay(1);
-        iTimeout += 200;
-        // delay(200);
-        bbepLightSleep(200); // save battery power by checking every 200ms
-        iTimeout += 200;
+    u32Timeout = pBBEP->iTimeout;
+    if (u32Timeout == 0) {
+        u32Timeout = (pBBEP->iFlags & (BBEP_3COLOR | BBEP_4COLOR | BBEP_FULL_COLOR)) ? BBEP_BUSY_TIMEOUT_COLOR : BBEP_BUSY_TIMEOUT;
     }
+    if (bbepWaitPin(&io, busy_idle, u32Timeout, &u32Busy) != BBEP_SUCCESS) {
+        pBBEP->last_error = BBEP_ERROR_TIMEOUT;
+        Log_error("bbepWaitBusy: still busy after %d ms", (int)u32Busy);
+    }
+    pBBEP->iBusyTime = (int)(millis() - u32Start);
 } /* bbepWaitBusy() */
 //
 // Return if panel is busy
@@ -3943,5 +3990,83 @@ int bbepWritePlane(BBEPDISP *pBBEP, int iPlane, int bInvert)
     } // normal panels
     return BBEP_SUCCESS;
 } /* bbepWritePlane() */
+//
+// Write a rectangle of the local copy of plane 0 to the same place in the
+// eink's framebuffer; the rest of it keeps what was written before.
+// x and the width are widened to whole bytes. Only 1-bit data in the
+// native orientation can be written this way.
+//
+int bbepWriteWindow(BBEPDISP *pBBEP, int x, int y, int cx, int cy)
+{
+    uint8_t ucCMD;
+    int ty, iPitch, iStart, iBytes;
+
+    if (pBBEP == NULL || pBBEP->ucScreen == NULL || cx <= 0 || cy <= 0) {
+        return BBEP_ERROR_BAD_PARAMETER;
+    }
+    if (x < 0 || y < 0 || x + cx > pBBEP->native_width || y + cy > pBBEP->native_height) {
+        return BBEP_ERROR_OUT_OF_BOUNDS;
+    }
+    if (pBBEP->iOrientation != 0 || pBBEP->native_width == 792 ||
+        (pBBEP->iFlags & (BBEP_4BPP_DATA | BBEP_4COLOR | BBEP_FULL_COLOR | BBEP_SPLIT_BUFFER))) {
+        return BBEP_ERROR_NOT_SUPPORTED;
+    }
+    if (pBBEP->chip_type == BBEP_CHIP_UC81xx) {
+        ucCMD = (pBBEP->iFlags & BBEP_RED_SWAPPED) ? UC8151_DTM1 : UC8151_DTM2;
+    } else {
+        ucCMD = SSD1608_WRITE_RAM;
+    }
+    iPitch = (pBBEP->native_width + 7) >> 3;
+    iStart = x >> 3;
+    iBytes = ((x + cx + 7) >> 3) - iStart;
+    bbepSetAddrWindow(pBBEP, iStart * 8, y, iBytes * 8, cy);
+    bbepWriteCmd(pBBEP, ucCMD);
+    for (ty = y; ty < y + cy; ty++) {
+        memcpy(u8Cache, &pBBEP->ucScreen[ty * iPitch + iStart], iBytes); // the data is overwritten after each write
+        bbepWriteData(pBBEP, u8Cache, iBytes);
+    } // for ty
+    return BBEP_SUCCESS;
+} /* bbepWriteWindow() */
+//
+// Pack plane 0 of the local framebuffer with bbepPackFrame()
+// Returns the packed size, 0 if it doesn't fit in iOutSize
+//
+int bbepPackPlane(BBEPDISP *pBBEP, uint8_t *pOut, int iOutSize)
+{
+    if (pBBEP == NULL || pBBEP->ucScreen == NULL) {
+        return 0;
+    }
+    return bbepPackFrame(pBBEP->ucScreen, pBBEP->native_width, pBBEP->native_height, (pBBEP->native_width + 7) >> 3, pOut, iOutSize);
+} /* bbepPackPlane() */
+
+static void bbepWriteRow(void *pUser, uint8_t *pRow, int iLen)
+{
+    bbepWriteData((BBEPDISP *)pUser, pRow, iLen);
+} /* bbepWriteRow() */
+//
+// Write a frame packed by bbepPackFrame() to the eink's 'old' memory
+// plane, the one a partial refresh starts from. Only for B/W panels,
+// whose second plane isn't a color of its own.
+//
+int bbepWriteOldPlane(BBEPDISP *pBBEP, const uint8_t *pData, int iSize)
+{
+    uint8_t ucCMD;
+
+    if (pBBEP == NULL || pData == NULL || iSize <= 0) {
+        return BBEP_ERROR_BAD_PARAMETER;
+    }
+    if (pBBEP->iOrientation != 0 || pBBEP->native_width == 792 ||
+        (pBBEP->iFlags & (BBEP_3COLOR | BBEP_4GRAY | BBEP_4BPP_DATA | BBEP_4COLOR | BBEP_FULL_COLOR | BBEP_SPLIT_BUFFER))) {
+        return BBEP_ERROR_NOT_SUPPORTED;
+    }
+    if (pBBEP->chip_type == BBEP_CHIP_UC81xx) {
+        ucCMD = (pBBEP->iFlags & BBEP_RED_SWAPPED) ? UC8151_DTM2 : UC8151_DTM1;
+    } else {
+        ucCMD = SSD1608_WRITE_ALTRAM;
+    }
+    bbepSetAddrWindow(pBBEP, 0, 0, pBBEP->native_width, pBBEP->native_height);
+    bbepWriteCmd(pBBEP, ucCMD);
+    return bbepUnpackFrame(pData, iSize, pBBEP->native_width, pBBEP->native_height, u8Cache, bbepWriteRow, pBBEP);
+} /* bbepWriteOldPlane() */
 
 #endif // __BB_EP__
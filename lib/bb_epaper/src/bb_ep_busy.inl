@@ -0,0 +1,65 @@
+//
+// bb_epaper
+// Copyright (c) 2024 BitBank Software, Inc.
+// Written by Larry Bank (bitbank@pobox.com)
+// Project started 9/11/2024
+//
+// Use of this software is governed by the Business Source License
+// included in the file ./LICENSE.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// ./APL.txt.
+//
+// bb_ep_busy.inl - waiting for the BUSY line of the panel
+//
+// The wait sleeps until the line reaches its idle level or the deadline
+// passes, whichever comes first. How it sleeps is up to the platform: on
+// the ESP32 a GPIO wakeup on the BUSY pin ends the light sleep as soon as
+// the panel is done. A sleep may also end early; the line is read again
+// and the time left is recomputed from the start.
+//
+#ifndef __BB_EP_BUSY__
+#define __BB_EP_BUSY__
+#include "bb_epaper.h"
+
+// level of the BUSY pin
+typedef int (BBEP_BUSY_READ)(void *pUser);
+// milliseconds since some fixed point; allowed to wrap
+typedef uint32_t (BBEP_BUSY_MILLIS)(void *pUser);
+// sleep up to u32Millis, or until the pin is at iWakeLevel if the platform can wake on it
+typedef void (BBEP_BUSY_SLEEP)(void *pUser, uint32_t u32Millis, int iWakeLevel);
+
+typedef struct bbep_busy_io
+{
+    BBEP_BUSY_READ *pfnRead;
+    BBEP_BUSY_MILLIS *pfnMillis;
+    BBEP_BUSY_SLEEP *pfnSleep;
+    void *pUser;
+} BBEP_BUSY_IO;
+
+//
+// Wait for the pin to read iIdle, at most u32Timeout ms
+// *pu32Busy gets the time it took (or the timeout)
+// returns BBEP_SUCCESS or BBEP_ERROR_TIMEOUT
+//
+static int bbepWaitPin(const BBEP_BUSY_IO *pIO, int iIdle, uint32_t u32Timeout, uint32_t *pu32Busy)
+{
+uint32_t u32Start, u32Elapsed;
+int rc = BBEP_SUCCESS;
+
+    u32Start = (*pIO->pfnMillis)(pIO->pUser);
+    while ((*pIO->pfnRead)(pIO->pUser) != iIdle) {
+        u32Elapsed = (*pIO->pfnMillis)(pIO->pUser) - u32Start; // unsigned, so a wrap doesn't matter
+        if (u32Elapsed >= u32Timeout) {
+            rc = BBEP_ERROR_TIMEOUT;
+            break;
+        }
+        (*pIO->pfnSleep)(pIO->pUser, u32Timeout - u32Elapsed, iIdle);
+    }
+    *pu32Busy = (*pIO->pfnMillis)(pIO->pUser) - u32Start;
+    return rc;
+} /* bbepWaitPin() */
+
+#endif // __BB_EP_BUSY__
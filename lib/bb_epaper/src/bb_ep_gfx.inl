@@ -22,6 +22,7 @@
 #include "bb_epaper.h"
 #include "Group5.h"
 #include "g5dec.inl"
+#include "bb_ep_span.inl"
 #include "../../trmnl/include/trmnl_log.h"
 
 static G5DECIMAGE g5dec;
@@ -643,17 +644,50 @@ void InvertBytes(uint8_t *pData, uint8_t bLen)
     }
 } /* InvertBytes() */
 //
+// Describe the framebuffer for bbepFillSpan() from the current pixel function
+// returns BBEP_SPAN_NONE if it isn't one of the known layouts
+//
+static int bbepGetSpanTarget(BBEPDISP *pBBEP, BBEP_SPAN_TARGET *pTarget)
+{
+int iSize;
+
+    iSize = ((pBBEP->native_width+7)>>3) * pBBEP->native_height;
+    pTarget->iPitch = (pBBEP->width+7)>>3;
+    pTarget->pPlane0 = pBBEP->ucScreen;
+    pTarget->pPlane1 = pBBEP->ucScreen + iSize;
+    if (pBBEP->pfnSetPixelFast == bbepSetPixelFast2Clr) {
+        pTarget->iLayout = BBEP_SPAN_2CLR;
+        if (pBBEP->iPlane == PLANE_1) {
+            pTarget->pPlane0 += iSize;
+        }
+    } else if (pBBEP->pfnSetPixelFast == bbepSetPixelFast3Clr) {
+        pTarget->iLayout = BBEP_SPAN_3CLR;
+    } else if (pBBEP->pfnSetPixelFast == bbepSetPixelFast4Gray) {
+        pTarget->iLayout = BBEP_SPAN_4GRAY;
+    } else if (pBBEP->pfnSetPixelFast == bbepSetPixelFast4Clr) {
+        pTarget->iLayout = BBEP_SPAN_4CLR;
+        pTarget->iPitch = (pBBEP->width+3)>>2;
+    } else if (pBBEP->pfnSetPixelFast == bbepSetPixelFast16Clr) {
+        pTarget->iLayout = BBEP_SPAN_16CLR;
+        pTarget->iPitch = pBBEP->width >> 1;
+    } else { // e.g. bbepSetPixelFast4ClrV2, which ORs the second plane in
+        pTarget->iLayout = BBEP_SPAN_NONE;
+    }
+    return pTarget->iLayout;
+} /* bbepGetSpanTarget() */
+//
 // 2-plane G5 image
 // requires a local framebuffer
 //
 int bbepLoadG5_2Bit(BBEPDISP *pBBEP, const uint8_t *pG5, int x, int y, float fScale)
 {
-    uint16_t rc, tx, ty, cx, cy, dx, dy, size;
-    int row, width, height;
+    uint16_t rc, cx, cy, dx, dy, size;
+    int tx, ty, row, width, height;
     BB_BITMAP *pbbb;
     uint8_t *pOldBuffer;
     BB_SET_PIXEL_FAST *pOldPixel;
     uint32_t u32Frac, u32XAcc, u32YAcc; // integer fraction vars
+    BBEP_SPAN_TARGET span;
 
     pbbb = (BB_BITMAP *)pG5;
     u32Frac = (uint32_t)(65536.0f / fScale); // calculate the fraction to advance the destination x/y
@@ -680,6 +714,10 @@ int bbepLoadG5_2Bit(BBEPDISP *pBBEP, const uint8_t *pG5, int x, int y, float fSc
                 pBBEP->ucScreen += (((pBBEP->native_width+7)/8) * pBBEP->native_height);
             } 
         }
+        // at 1:1 scale, known layouts get the runs of each line without a call per pixel
+        if (u32Frac != 65536 || bbepGetSpanTarget(pBBEP, &span) == BBEP_SPAN_NONE) {
+            span.iLayout = BBEP_SPAN_NONE;
+        }
         g5_decode_line(&g5dec, u8Cache); // decode first line to start
         u32YAcc = 0; //65536; // force first line to get decoded
         row = 1;
@@ -690,13 +728,23 @@ int bbepLoadG5_2Bit(BBEPDISP *pBBEP, const uint8_t *pG5, int x, int y, float fSc
                 row++;
                 u32YAcc -= 65536;
             }
+            if (ty < 0) { // above the display
+                u32YAcc += u32Frac;
+                continue;
+            }
+            if (span.iLayout != BBEP_SPAN_NONE) { // flips of the last decoded line
+                bbepDrawFlips(&span, g5dec.pRef, cx, x, ty, width, 1, 0);
+                u32YAcc += u32Frac;
+                continue;
+            }
             s = u8Cache;
             u32XAcc = 0;
             u8 = *s++; // grab first source byte (8 pixels)
             src_mask = 0x80;
             for (tx=x; tx<x+dx && tx < width; tx++) {
                 u8Color = ((u8 & src_mask) != 0);
-                (*pBBEP->pfnSetPixelFast)(pBBEP, tx, ty, u8Color);
+                if (tx >= 0)
+                    (*pBBEP->pfnSetPixelFast)(pBBEP, tx, ty, u8Color);
                 u32XAcc += u32Frac;
                 while (u32XAcc >= 65536) {
                     u32XAcc -= 65536; // whole source pixel horizontal movement
@@ -729,10 +777,12 @@ int bbepLoadG5_2Bit(BBEPDISP *pBBEP, const uint8_t *pG5, int x, int y, float fSc
 //
 int bbepLoadG5(BBEPDISP *pBBEP, const uint8_t *pG5, int x, int y, int iFG, int iBG, float fScale)
 {
-    uint16_t rc, tx, ty, cx, cy, dx, dy, size;
-    int width, height;
+    uint16_t rc, cx, cy, dx, dy, size;
+    int tx, ty, width, height;
     BB_BITMAP *pbbb;
     uint32_t u32Frac, u32XAcc, u32YAcc; // integer fraction vars
+    BBEP_SPAN_TARGET span;
+    BBEP_BYTE_WINDOW win;
 
     if (pBBEP == NULL || pG5 == NULL || fScale < 0.01) return BBEP_ERROR_BAD_PARAMETER;
     if (iFG != BBEP_TRANSPARENT) {
@@ -760,10 +810,17 @@ int bbepLoadG5(BBEPDISP *pBBEP, const uint8_t *pG5, int x, int y, int iFG, int i
     rc = g5_decode_init(&g5dec, cx, cy, (uint8_t *)&pbbb[1], size);
     if (rc != G5_SUCCESS) return BBEP_ERROR_BAD_DATA; // corrupt data?
     if (!pBBEP->ucScreen) { // no back buffer
-        bbepSetAddrWindow(pBBEP, x, y, cx+(x&7), cy);
-        bbepStartWrite(pBBEP, pBBEP->iPlane); // get ready to write
         dy = cy; // scaling is only supported on internal framebuffers
         u32Frac = 65536; // force to 1.0 scale
+        if (!bbepGetByteWindow(x, y, cx, cy, width, height, &win)) return BBEP_SUCCESS; // nothing to see
+        // the bytes of the window outside the image stay white
+        bbepSetAddrWindow(pBBEP, win.x, win.y, win.iBytes*8, win.iRows);
+        bbepStartWrite(pBBEP, pBBEP->iPlane); // get ready to write
+        span.iLayout = BBEP_SPAN_2CLR; // each line is drawn into u8Cache, then sent
+        span.iPitch = win.iBytes;
+        span.pPlane0 = u8Cache;
+    } else if (u32Frac != 65536 || bbepGetSpanTarget(pBBEP, &span) == BBEP_SPAN_NONE) {
+        span.iLayout = BBEP_SPAN_NONE; // scaled, or not a layout bbepFillSpan() knows
     }
     u32YAcc = 65536; // force first line to get decoded
     for (ty=y; ty<y+dy && ty < height; ty++) {
@@ -772,28 +829,18 @@ int bbepLoadG5(BBEPDISP *pBBEP, const uint8_t *pG5, int x, int y, int iFG, int i
             g5_decode_line(&g5dec, u8Cache);
             u32YAcc -= 65536;
         }
-        if (!pBBEP->ucScreen) {
-            if (x & 7) { // need to shift it over by 1-7 bits
-                uint8_t *d = s = u8Cache, uc1, uc0; // last shifted byte
-                if (iFG == BBEP_WHITE) {
-                    uc0 = 0;
-                } else {
-                    uc0 = 0xff << (7-(x & 7));
-                }
-                uint8_t n = x & 7; // shift amount
-                for (int j=0; j<cx+7; j+= 8) {
-                    uc1 = *s++;
-                    uc0 |= (uc1 >> n);
-                    *d++ = uc0;
-                    uc0 = uc1 << (8-n);
-                }
-                *d++ = uc0; // store final byte
-                *d++ = 0; // and a zero for good measure
-            }
-            if (iFG == BBEP_WHITE) { // inverted
-                InvertBytes(u8Cache, (cx+(x&7)+7)>>3);
-            }
-            bbepWriteData(pBBEP, u8Cache, (cx+(x&7)+7)>>3);
+        if (ty < 0) { // above the display
+            u32YAcc += u32Frac;
+            continue;
+        }
+        if (!pBBEP->ucScreen) { // the flips are kept apart from u8Cache, so it can hold the output
+            memset(u8Cache, 0xff, win.iBytes);
+            bbepDrawFlips(&span, g5dec.pRef, cx, x - win.x, 0, win.iRight - win.x, iFG, iBG);
+            bbepWriteData(pBBEP, u8Cache, win.iBytes);
+        } else if (span.iLayout != BBEP_SPAN_NONE) { // 1:1, fill the runs of the line
+#ifndef NO_RAM
+            bbepDrawFlips(&span, g5dec.pRef, cx, x, ty, width, iFG, iBG);
+#endif // NO_RAM
         } else { // use the setPixel function for more features
 #ifndef NO_RAM
             s = u8Cache;
@@ -801,7 +848,8 @@ int bbepLoadG5(BBEPDISP *pBBEP, const uint8_t *pG5, int x, int y, int iFG, int i
             u8 = *s++; // grab first source byte (8 pixels)
             src_mask = 0x80;
             for (tx=x; tx<x+dx && tx < width; tx++) {
-                if (u8 & src_mask) {
+                if (tx < 0) { // left of the display
+                } else if (u8 & src_mask) {
                     if (iFG != BBEP_TRANSPARENT)
                         (*pBBEP->pfnSetPixelFast)(pBBEP, tx, ty, (uint8_t)iFG);
                 } else {
@@ -0,0 +1,119 @@
+//
+// bb_epaper
+// Copyright (c) 2024 BitBank Software, Inc.
+// Written by Larry Bank (bitbank@pobox.com)
+// Project started 9/11/2024
+//
+// Use of this software is governed by the Business Source License
+// included in the file ./LICENSE.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// ./APL.txt.
+//
+// bb_ep_prev.inl - the previous 1-bit frame, packed to outlive the panel
+//
+// A partial refresh drives each pixel from its value in the 'old' RAM
+// plane to the one in the 'new' plane. Deep sleep (of the panel or of
+// the MCU, which resets it) clears both, so the first partial refresh
+// after a wake starts from nothing. The frame on the panel is packed
+// with G5 (or kept as is when G5 doesn't make it smaller) so it can be
+// saved somewhere that survives, and unpacked into the old plane one
+// row at a time just before the new frame is written.
+//
+#ifndef __BB_EP_PREV__
+#define __BB_EP_PREV__
+#include "bb_epaper.h"
+#include "Group5.h"
+
+// one unpacked row of pixels for the panel; pRow is reused for the next one
+typedef void (BBEP_ROW_OUT)(void *pUser, uint8_t *pRow, int iLen);
+
+//
+// Pack a 1-bpp frame (MSB first, rows of iPitch bytes) into pOut
+// Returns the packed size; a frame which G5 can't squeeze into less than
+// its own size is copied as is, so the size tells the two apart.
+// Returns 0 if it doesn't fit in iOutSize at all.
+//
+static int bbepPackFrame(const uint8_t *pFrame, int iWidth, int iHeight, int iPitch, uint8_t *pOut, int iOutSize)
+{
+G5ENCODER *pEnc;
+uint8_t *pRow;
+int y, rc, iBytes, iSize = 0;
+
+    iBytes = (iWidth + 7) >> 3;
+    if (pFrame == NULL || pOut == NULL || iWidth < 1 || iHeight < 1 || iPitch < iBytes) {
+        return 0;
+    }
+    // 2K of flips, too much for the stack, and a row: the encoder reads a byte past its end
+    pEnc = (G5ENCODER *)malloc(sizeof(G5ENCODER) + iBytes + 1);
+    if (pEnc) {
+        // G5 gets at most one byte less than the raw frame. The encoder only
+        // checks for room after a whole line, so keep one worst line spare.
+        int iFlips = (iWidth < MAX_IMAGE_FLIPS) ? iWidth : MAX_IMAGE_FLIPS;
+        int iLimit = iOutSize - (iFlips * 17 + 7) / 8 - 4;
+        if (iLimit > iBytes * iHeight - 1) iLimit = iBytes * iHeight - 1;
+        pRow = (uint8_t *)&pEnc[1];
+        pRow[iBytes] = 0xff;
+        rc = (iLimit > 64) ? pEnc->init(iWidth, iHeight, pOut, iLimit) : G5_DATA_OVERFLOW;
+        for (y = 0; y < iHeight && rc == G5_SUCCESS; y++) {
+            memcpy(pRow, &pFrame[y * iPitch], iBytes);
+            rc = pEnc->encodeLine(pRow);
+        }
+        if (rc == G5_ENCODE_COMPLETE) {
+            iSize = pEnc->size();
+        }
+        free(pEnc);
+        if (iSize > 0 && iSize < iBytes * iHeight) {
+            return iSize;
+        }
+    }
+    // too busy for G5 (e.g. dithered), or no memory for the encoder
+    if (iBytes * iHeight > iOutSize) {
+        return 0;
+    }
+    for (y = 0; y < iHeight; y++) {
+        memcpy(&pOut[y * iBytes], &pFrame[y * iPitch], iBytes);
+    }
+    return iBytes * iHeight;
+} /* bbepPackFrame() */
+
+//
+// Unpack a frame made by bbepPackFrame() and pass it on one row at a time
+// pRow must hold a row, (iWidth+7)/8 bytes
+// G5 data is read a few bytes ahead: keep 4 readable bytes after it
+//
+static int bbepUnpackFrame(const uint8_t *pData, int iSize, int iWidth, int iHeight, uint8_t *pRow, BBEP_ROW_OUT *pfnRow, void *pUser)
+{
+G5DECODER *pDec;
+int y, rc, iBytes;
+
+    iBytes = (iWidth + 7) >> 3;
+    if (pData == NULL || pRow == NULL || pfnRow == NULL || iWidth < 1 || iHeight < 1 || iSize < 1 || iSize > iBytes * iHeight) {
+        return BBEP_ERROR_BAD_PARAMETER;
+    }
+    if (iSize == iBytes * iHeight) { // stored as is
+        for (y = 0; y < iHeight; y++) {
+            memcpy(pRow, &pData[y * iBytes], iBytes);
+            (*pfnRow)(pUser, pRow, iBytes);
+        }
+        return BBEP_SUCCESS;
+    }
+    pDec = (G5DECODER *)malloc(sizeof(G5DECODER));
+    if (pDec == NULL) {
+        return BBEP_ERROR_NO_MEMORY;
+    }
+    rc = pDec->init(iWidth, iHeight, (uint8_t *)pData, iSize);
+    for (y = 0; y < iHeight && rc == G5_SUCCESS; y++) {
+        rc = pDec->decodeLine(pRow); // G5_DECODE_COMPLETE with the last row
+        if (rc == G5_SUCCESS || rc == G5_DECODE_COMPLETE) {
+            (*pfnRow)(pUser, pRow, iBytes);
+        }
+    }
+    free(pDec);
+    // rows already sent can't be taken back; the caller sends something whole instead
+    return (y == iHeight && rc == G5_DECODE_COMPLETE) ? BBEP_SUCCESS : BBEP_ERROR_BAD_DATA;
+} /* bbepUnpackFrame() */
+
+#endif // __BB_EP_PREV__
@@ -0,0 +1,110 @@
+//
+// bb_epaper
+// Copyright (c) 2024 BitBank Software, Inc.
+// Written by Larry Bank (bitbank@pobox.com)
+// Project started 9/11/2024
+//
+// Use of this software is governed by the Business Source License
+// included in the file ./LICENSE.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// ./APL.txt.
+//
+// bb_ep_queue.inl - ping-pong buffers for data written to the panel
+//
+// bbepWriteData() is called one row at a time, from a buffer the caller
+// reuses for the next row. The queue copies each row into one of two
+// buffers and hands a full buffer to the transport, which may return
+// before the bytes are out (e.g. a DMA transfer). The next rows then
+// fill the other buffer while the first one is sent. Only one transfer
+// is in flight at a time; bbepQueueFlush() sends what is left and waits
+// for it, and must be called before anything else goes to the panel.
+//
+#ifndef __BB_EP_QUEUE__
+#define __BB_EP_QUEUE__
+
+#include <string.h>
+#include <stdint.h>
+
+// start sending iLen bytes; pData stays untouched until the matching wait
+typedef void (BBEP_QUEUE_START)(void *pUser, uint8_t *pData, int iLen);
+// return when the transfer started last is complete
+typedef void (BBEP_QUEUE_WAIT)(void *pUser);
+
+typedef struct bbep_spi_queue
+{
+    uint8_t *pBuf[2];
+    int iSize; // bytes in each buffer, 0 = no queue (the caller writes directly)
+    int iCur; // buffer being filled
+    int iFill; // bytes in it so far
+    int bBusy; // the other buffer is being sent
+    BBEP_QUEUE_START *pfnStart;
+    BBEP_QUEUE_WAIT *pfnWait;
+    void *pUser;
+} BBEP_SPI_QUEUE;
+
+static void bbepQueueInit(BBEP_SPI_QUEUE *pQ, uint8_t *pBuf0, uint8_t *pBuf1, int iSize, BBEP_QUEUE_START *pfnStart, BBEP_QUEUE_WAIT *pfnWait, void *pUser)
+{
+    memset(pQ, 0, sizeof(BBEP_SPI_QUEUE));
+    if (pBuf0 && pBuf1) {
+        pQ->pBuf[0] = pBuf0;
+        pQ->pBuf[1] = pBuf1;
+        pQ->iSize = iSize;
+    }
+    pQ->pfnStart = pfnStart;
+    pQ->pfnWait = pfnWait;
+    pQ->pUser = pUser;
+} /* bbepQueueInit() */
+
+//
+// Start sending the buffer being filled and switch to the other one
+// (after its own transfer is done)
+//
+static void bbepQueueSend(BBEP_SPI_QUEUE *pQ)
+{
+    if (pQ->bBusy) {
+        (*pQ->pfnWait)(pQ->pUser);
+    }
+    (*pQ->pfnStart)(pQ->pUser, pQ->pBuf[pQ->iCur], pQ->iFill);
+    pQ->bBusy = 1;
+    pQ->iCur ^= 1;
+    pQ->iFill = 0;
+} /* bbepQueueSend() */
+
+//
+// Queue bytes for the panel; pData can be reused as soon as this returns
+//
+static void bbepQueueWrite(BBEP_SPI_QUEUE *pQ, const uint8_t *pData, int iLen)
+{
+int iCount;
+
+    while (iLen > 0) {
+        iCount = pQ->iSize - pQ->iFill;
+        if (iCount > iLen) iCount = iLen;
+        memcpy(&pQ->pBuf[pQ->iCur][pQ->iFill], pData, iCount);
+        pQ->iFill += iCount;
+        pData += iCount;
+        iLen -= iCount;
+        if (pQ->iFill == pQ->iSize) {
+            bbepQueueSend(pQ);
+        }
+    }
+} /* bbepQueueWrite() */
+
+//
+// Send whatever is queued and wait until all of it is out
+//
+static void bbepQueueFlush(BBEP_SPI_QUEUE *pQ)
+{
+    if (pQ->iFill) {
+        bbepQueueSend(pQ);
+    }
+    if (pQ->bBusy) {
+        (*pQ->pfnWait)(pQ->pUser);
+        pQ->bBusy = 0;
+    }
+} /* bbepQueueFlush() */
+
+#endif // __BB_EP_QUEUE__
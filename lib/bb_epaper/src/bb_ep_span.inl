@@ -0,0 +1,181 @@
+//
+// bb_epaper
+// Copyright (c) 2024 BitBank Software, Inc.
+// Written by Larry Bank (bitbank@pobox.com)
+// Project started 9/11/2024
+//
+// Use of this software is governed by the Business Source License
+// included in the file ./LICENSE.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// ./APL.txt.
+//
+// bb_ep_span.inl - horizontal spans drawn straight into the framebuffer
+//
+// The G5 decoder knows each line as a list of color changes (flips), so
+// at 1:1 scale a line can be drawn as a few runs of bytes instead of
+// one pfnSetPixelFast() call per pixel. Each layout below writes the
+// same bits as the pixel function it is named after.
+//
+#ifndef __BB_EP_SPAN__
+#define __BB_EP_SPAN__
+#include "bb_epaper.h"
+
+// Framebuffer layouts, one per pfnSetPixelFast
+enum {
+    BBEP_SPAN_NONE = 0, // unknown pixel function: draw one pixel at a time
+    BBEP_SPAN_2CLR,     // 1-bpp, 1 = white (bbepSetPixelFast2Clr)
+    BBEP_SPAN_3CLR,     // 2 1-bpp planes, the second one for red/yellow (bbepSetPixelFast3Clr)
+    BBEP_SPAN_4GRAY,    // 2 1-bpp planes for bit 0 and bit 1 of the color (bbepSetPixelFast4Gray)
+    BBEP_SPAN_4CLR,     // 2-bpp packed (bbepSetPixelFast4Clr)
+    BBEP_SPAN_16CLR,    // 4-bpp packed (bbepSetPixelFast16Clr)
+};
+
+typedef struct bbep_span_target
+{
+    int iLayout;
+    int iPitch; // bytes per line
+    uint8_t *pPlane0; // the only plane of the 1 plane layouts
+    uint8_t *pPlane1;
+} BBEP_SPAN_TARGET;
+
+//
+// Set bits iStart to iEnd-1 of a line (MSB first) to the same bits of ucPattern
+//
+static void bbepFillBits(uint8_t *pLine, int iStart, int iEnd, uint8_t ucPattern)
+{
+uint8_t *d, ucLeft, ucRight;
+int iBytes;
+
+    if (iStart >= iEnd) return;
+    d = &pLine[iStart >> 3];
+    ucLeft = 0xff >> (iStart & 7); // bits of the first byte to change
+    ucRight = 0xff << (8 - (iEnd & 7)); // bits of the last byte to change
+    iBytes = (iEnd >> 3) - (iStart >> 3);
+    if (iBytes == 0) { // starts and ends in the same byte
+        ucLeft &= ucRight;
+        *d = (*d & ~ucLeft) | (ucPattern & ucLeft);
+        return;
+    }
+    *d = (*d & ~ucLeft) | (ucPattern & ucLeft);
+    d++;
+    if (iBytes > 1) {
+        memset(d, ucPattern, iBytes - 1);
+        d += iBytes - 1;
+    }
+    if (iEnd & 7) {
+        *d = (*d & ~ucRight) | (ucPattern & ucRight);
+    }
+} /* bbepFillBits() */
+
+//
+// Draw pixels x to x2-1 of line y in a color already translated for the panel
+// (the value pfnSetPixelFast() would get)
+//
+static void bbepFillSpan(const BBEP_SPAN_TARGET *pTarget, int x, int x2, int y, uint8_t ucColor)
+{
+uint8_t *p0, *p1;
+
+    p0 = &pTarget->pPlane0[y * pTarget->iPitch];
+    switch (pTarget->iLayout) {
+        case BBEP_SPAN_2CLR:
+            bbepFillBits(p0, x, x2, (ucColor == BBEP_WHITE) ? 0xff : 0x00);
+            break;
+        case BBEP_SPAN_3CLR:
+            p1 = &pTarget->pPlane1[y * pTarget->iPitch];
+            if (ucColor >= BBEP_YELLOW) { // red/yellow has priority, plane 0 stays as it is
+                bbepFillBits(p1, x, x2, 0xff);
+            } else {
+                bbepFillBits(p1, x, x2, 0x00);
+                bbepFillBits(p0, x, x2, (ucColor == BBEP_WHITE) ? 0xff : 0x00);
+            }
+            break;
+        case BBEP_SPAN_4GRAY:
+            p1 = &pTarget->pPlane1[y * pTarget->iPitch];
+            bbepFillBits(p0, x, x2, (ucColor & 1) ? 0xff : 0x00);
+            bbepFillBits(p1, x, x2, (ucColor & 2) ? 0xff : 0x00);
+            break;
+        case BBEP_SPAN_4CLR:
+            bbepFillBits(p0, x * 2, x2 * 2, (uint8_t)((ucColor & 3) * 0x55));
+            break;
+        case BBEP_SPAN_16CLR:
+            bbepFillBits(p0, x * 4, x2 * 4, (uint8_t)((ucColor & 0xf) * 0x11));
+            break;
+    }
+} /* bbepFillSpan() */
+
+//
+// Draw source pixels iStart to iEnd-1 of a line placed at x, keeping only
+// those from iLo to iHi-1 (the ones that land on the display)
+//
+static void bbepFillClipped(const BBEP_SPAN_TARGET *pTarget, int iStart, int iEnd, int iLo, int iHi, int x, int y, uint8_t ucColor)
+{
+    if (iStart < iLo) iStart = iLo;
+    if (iEnd > iHi) iEnd = iHi;
+    if (iStart < iEnd) {
+        bbepFillSpan(pTarget, x + iStart, x + iEnd, y, ucColor);
+    }
+} /* bbepFillClipped() */
+
+//
+// Draw one decoded G5 line at 1:1 scale from its flips (the start and end of
+// each run of 0 pixels, in pairs, as G5DrawLine() reads them). Source pixel sx
+// lands on x+sx; 1 pixels get iFG, 0 pixels iBG, and BBEP_TRANSPARENT leaves
+// the framebuffer as it is. x can be negative and x+cx can go past iWidth:
+// only the pixels from 0 to iWidth-1 are drawn.
+//
+static void bbepDrawFlips(const BBEP_SPAN_TARGET *pTarget, const int16_t *pFlips, int cx, int x, int y, int iWidth, int iFG, int iBG)
+{
+int iStart, iEnd, iDone, iLo, iHi;
+
+    iLo = (x < 0) ? -x : 0; // first source pixel on the display
+    iHi = iWidth - x; // and the one after the last
+    if (iHi > cx) iHi = cx;
+    if (iHi <= iLo) return;
+    iDone = 0; // source pixels drawn so far
+    while (1) {
+        iStart = *pFlips++;
+        iEnd = *pFlips++;
+        if (iStart >= iHi || iEnd == iStart) break; // end of the line or of the visible part
+        if (iEnd > cx) iEnd = cx;
+        if (iFG != BBEP_TRANSPARENT && iStart > iDone) {
+            bbepFillClipped(pTarget, iDone, iStart, iLo, iHi, x, y, (uint8_t)iFG);
+        }
+        if (iBG != BBEP_TRANSPARENT) {
+            bbepFillClipped(pTarget, iStart, iEnd, iLo, iHi, x, y, (uint8_t)iBG);
+        }
+        if (iEnd > iDone) iDone = iEnd;
+    }
+    if (iFG != BBEP_TRANSPARENT) {
+        bbepFillClipped(pTarget, iDone, iHi, iLo, iHi, x, y, (uint8_t)iFG);
+    }
+} /* bbepDrawFlips() */
+
+//
+// The part of a iWidth x iHeight display covered by a cx x cy image at x,y,
+// widened to whole bytes for bbepSetAddrWindow(). iRight is one past the last
+// column of the image on the display; the columns of the window from there on
+// (and before x) aren't part of the image.
+// returns 0 if none of the image is on the display
+//
+typedef struct bbep_byte_window
+{
+    int x, y; // top left corner, x a multiple of 8
+    int iBytes, iRows;
+    int iRight;
+} BBEP_BYTE_WINDOW;
+
+static int bbepGetByteWindow(int x, int y, int cx, int cy, int iWidth, int iHeight, BBEP_BYTE_WINDOW *pWin)
+{
+    if (x >= iWidth || y >= iHeight || x+cx <= 0 || y+cy <= 0 || cx <= 0 || cy <= 0) return 0;
+    pWin->x = ((x < 0) ? 0 : x) & ~7;
+    pWin->y = (y < 0) ? 0 : y;
+    pWin->iRight = (x+cx < iWidth) ? x+cx : iWidth;
+    pWin->iBytes = (pWin->iRight + 7 - pWin->x) >> 3;
+    pWin->iRows = ((y+cy < iHeight) ? y+cy : iHeight) - pWin->y;
+    return 1;
+} /* bbepGetByteWindow() */
+
+#endif // __BB_EP_SPAN__
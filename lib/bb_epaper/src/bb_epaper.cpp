@@ -191,6 +191,29 @@ int BBEPAPER::writePlane(int iPlane, bool bInvert)
     return rc;
 } /* writePlane() */
 
+int BBEPAPER::writeWindow(int x, int y, int w, int h)
+{
+    long l = millis();
+    int rc;
+    rc = bbepWriteWindow(&_bbep, x, y, w, h);
+    _bbep.iDataTime = (int)(millis() - l);
+    return rc;
+} /* writeWindow() */
+
+int BBEPAPER::writeOldPlane(const uint8_t *pData, int iSize)
+{
+    long l = millis();
+    int rc;
+    rc = bbepWriteOldPlane(&_bbep, pData, iSize);
+    _bbep.iDataTime = (int)(millis() - l);
+    return rc;
+} /* writeOldPlane() */
+
+int BBEPAPER::packPlane(uint8_t *pOut, int iOutSize)
+{
+    return bbepPackPlane(&_bbep, pOut, iOutSize);
+} /* packPlane() */
+
 int BBEPAPER::refresh(int iMode, bool bWait)
 {
     int rc;
@@ -199,6 +222,8 @@ int BBEPAPER::refresh(int iMode, bool bWait)
     if (rc == BBEP_SUCCESS) {
         if (bWait) {
             bbepWaitBusy(&_bbep);
+        } else {
+            _bbep.busy_pending = 1; // the next command or wait() waits for it
         }
     } else {
         Log_info("BBEPAPER::refresh failed with code %d", rc);
@@ -613,6 +638,10 @@ int BBEPAPER::opTime(void)
 {
     return _bbep.iOpTime;
 }
+int BBEPAPER::busyTime(void)
+{
+    return _bbep.iBusyTime;
+}
 int16_t BBEPAPER::width(void)
 {
    return _bbep.width;
@@ -706,6 +735,11 @@ void BBEPAPER::writeData(uint8_t *pData, int iLen)
    bbepWriteData(&_bbep, pData, iLen);
 } /* writeData() */
 
+void BBEPAPER::flushData(void)
+{
+   bbepFlushData(&_bbep);
+} /* flushData() */
+
 void BBEPAPER::writeCmd(uint8_t u8Cmd)
 {
     bbepWriteCmd(&_bbep, u8Cmd);
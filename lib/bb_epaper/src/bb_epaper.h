@@ -42,6 +42,7 @@ enum {
     BBEP_ERROR_NOT_SUPPORTED,
     BBEP_ERROR_NO_MEMORY,
     BBEP_ERROR_OUT_OF_BOUNDS,
+    BBEP_ERROR_TIMEOUT,
     BBEP_ERROR_COUNT
 };
 
@@ -462,12 +463,14 @@ int iFG, iBG; //current color
 int iFont, iFlags;
 void *pFont;
 int iDataTime, iOpTime; // time in milliseconds for data transmission and operation
+int iBusyTime; // time in milliseconds of the last wait for BUSY
 uint32_t iSpeed;
-uint32_t iTimeout; // for e-paper panels
+uint32_t iTimeout; // longest wait for BUSY in milliseconds, 0 for the default of the panel type
 uint8_t iDCPin, iMOSIPin, iCLKPin, iCSPin, iRSTPin, iBUSYPin;
 uint8_t iCS1Pin, iCS2Pin;
 uint8_t x_offset, y_offset; // memory offsets
 uint8_t is_awake, iPlane;
+uint8_t busy_pending; // a refresh was started without waiting for it
 const uint8_t *pColorLookup; // color translation table
 // Mapping between 24 bit RGB color codes and EPD colors
 // Each index in this array corresponds to the same index in pColorLookup
@@ -521,8 +524,12 @@ class BBEPAPER
     void initIO(int iDC, int iReset, int iBusy, int iCS, int iSPIChannel, uint32_t u32Speed = 8000000);
 #endif
     int writePlane(int iPlane = PLANE_BOTH, bool bInvert = false);
+    int writeWindow(int x, int y, int w, int h);
+    int writeOldPlane(const uint8_t *pData, int iSize);
+    int packPlane(uint8_t *pOut, int iOutSize);
     void startWrite(int iPlane);
     void writeData(uint8_t *pData, int iLen);
+    void flushData(void);
     void writeCmd(uint8_t u8Cmd);
     int refresh(int iMode, bool bWait = true);
     void setBuffer(uint8_t *pBuffer);
@@ -561,6 +568,7 @@ class BBEPAPER
 #endif
     int dataTime();
     int opTime();
+    int busyTime();
     int16_t height(void);
     int16_t width(void);
     void drawCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
@@ -617,6 +625,7 @@ typedef enum
 // Forward references to core C functions
 void bbepWriteCmd(BBEPDISP *pBBEP, uint8_t cmd);
 void bbepWriteData(BBEPDISP *pBBEP, uint8_t *pData, int iLen);
+void bbepFlushData(BBEPDISP *pBBEP);
 void bbepCMD2(BBEPDISP *pBBEP, uint8_t cmd1, uint8_t cmd2);
 #endif // __BB_EPAPER__
 
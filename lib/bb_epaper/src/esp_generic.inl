@@ -35,6 +35,7 @@ static spi_device_handle_t spi;
 #endif // VSPI_HOST
 // foreward references
 void bbepWakeUp(BBEPDISP *pBBEP);
+void bbepWaitBusy(BBEPDISP *pBBEP);
 void bbepSendCMDSequence(BBEPDISP *pBBEP, const uint8_t *pSeq);
 
 void digitalWrite(int iPin, int iState) {
@@ -197,6 +198,9 @@ void bbepSetCS2(BBEPDISP *pBBEP, uint8_t cs)
 //
 void bbepWriteCmd(BBEPDISP *pBBEP, uint8_t cmd)
 {
+    if (pBBEP->busy_pending) { // commands sent while it refreshes would be lost
+        bbepWaitBusy(pBBEP);
+    }
     if (!pBBEP->is_awake) {
         // if it's asleep, it can't receive commands
         bbepWakeUp(pBBEP);
@@ -229,6 +233,13 @@ void bbepWriteData(BBEPDISP *pBBEP, uint8_t *pData, int iLen)
         spi_write(pBBEP, pData, iLen);
     }
 } /* bbepWriteData() */
+//
+// Data is written synchronously here, so there's nothing to wait for
+//
+void bbepFlushData(BBEPDISP *pBBEP)
+{
+    (void)pBBEP;
+} /* bbepFlushData() */
 
 //
 // Initialize the SPI bus and connections for e-paper displays
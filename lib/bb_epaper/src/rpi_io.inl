@@ -44,6 +44,7 @@ static int spi_fd; // SPI handle
 
 // forward references
 void bbepWakeUp(BBEPDISP *pBBEP);
+void bbepWaitBusy(BBEPDISP *pBBEP);
 
 void SPI_transfer(BBEPDISP *pBBEP, uint8_t *pBuf, int iLen)
 {
@@ -160,6 +161,9 @@ void bbepSetCS2(BBEPDISP *pBBEP, uint8_t cs)
 //
 void bbepWriteCmd(BBEPDISP *pBBEP, uint8_t cmd)
 {
+    if (pBBEP->busy_pending) { // commands sent while it refreshes would be lost
+        bbepWaitBusy(pBBEP);
+    }
     if (!pBBEP->is_awake) {
         // if it's asleep, it can't receive commands
         bbepWakeUp(pBBEP);
@@ -180,5 +184,12 @@ void bbepWriteData(BBEPDISP *pBBEP, uint8_t *pData, int iLen)
     SPI_transfer(pBBEP, pData, iLen);
     digitalWrite(pBBEP->iCSPin, HIGH);
 } /* bbepWriteData() */
+//
+// Data is written synchronously here, so there's nothing to wait for
+//
+void bbepFlushData(BBEPDISP *pBBEP)
+{
+    (void)pBBEP;
+} /* bbepFlushData() */
 
 #endif // __BB_EP_IO__
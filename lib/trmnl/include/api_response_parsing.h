@@ -1,4 +1,31 @@
+#pragma once
+
 #include "api_types.h"
+#include <http_body_reader.h>
+#include <json_arena.h>
+
+/**
+ * Room for the /api/display filter and the filtered document: one ArduinoJson
+ * variant pool each (8 bytes per slot on the device, 16 on 64-bit hosts) and the
+ * string values, which are dominated by the signed image URL.
+ */
+#define API_DISPLAY_JSON_ARENA_SIZE (2 * ARDUINOJSON_POOL_CAPACITY * 2 * sizeof(void *) + 3072)
 
 ApiSetupResponse parseResponse_apiSetup(String &payload);
 ApiDisplayResponse parseResponse_apiDisplay(String &payload);
+
+/**
+ * @brief Parses /api/display straight from the connection, without holding the payload
+ * Members ApiDisplayResponse doesn't use are skipped, and the document lives in arena,
+ * so nothing is allocated on the heap apart from the String members of the result.
+ * @param body body of the response; it is read to its end so the connection can be reused
+ * @param arena at least API_DISPLAY_JSON_ARENA_SIZE bytes; reset before parsing
+ */
+ApiDisplayResponse parseResponse_apiDisplay(HttpBodyReader &body, JsonArena &arena);
+
+/**
+ * @brief Parses /api/display JSON from a stream, e.g. the metadata part of an envelope
+ * Stops after the closing brace; the caller decides what happens to the rest.
+ * @param arena at least API_DISPLAY_JSON_ARENA_SIZE bytes; reset before parsing
+ */
+ApiDisplayResponse parseResponse_apiDisplay(HttpBodyStream &stream, JsonArena &arena);
@@ -57,6 +57,7 @@ struct ApiDisplayInputs
   int rssi;
   int displayWidth;
   int displayHeight;
+  uint32_t imageFormats; // image_format_e set, sent as the Image-Formats header
   SPECIAL_FUNCTION specialFunction;
 };
 
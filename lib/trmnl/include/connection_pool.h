@@ -0,0 +1,204 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define CONNECTION_POOL_SIZE 3
+#define URL_HOST_MAX_LEN 253 // longest DNS name
+
+/** Scheme, host and port of a URL: what decides whether a connection can be reused */
+struct UrlOrigin
+{
+  bool secure;
+  char host[URL_HOST_MAX_LEN + 1];
+  uint16_t port;
+};
+
+/**
+ * @brief Extracts the origin of an http(s) URL
+ * @return false if the URL is not http(s), or its host or port is invalid
+ */
+bool url_origin(const char *url, UrlOrigin &origin);
+
+bool same_origin(const UrlOrigin &a, const UrlOrigin &b);
+
+/**
+ * Keeps open connections around for the rest of the wake, one per origin, so that
+ * consecutive requests to the same host (API, image, logs) skip the TCP and TLS setup.
+ *
+ * Connection must provide connected() and stop(), and is created by the factory with new.
+ * A connection that is in use is never shared: a nested request to the same host
+ * (e.g. a log submitted from inside a request callback) gets a connection of its own.
+ * So does a URL whose origin can't be told: it is never pooled.
+ */
+template <typename Connection>
+class ConnectionPool
+{
+public:
+  typedef Connection *(*factory_t)(const UrlOrigin &origin);
+
+  ConnectionPool(factory_t create) : create(create), opened(0), reused(0), clock(0)
+  {
+    memset(slots, 0, sizeof(slots));
+  }
+
+  ~ConnectionPool()
+  {
+    drain();
+  }
+
+  /**
+   * @brief Hands out an idle connection to the URL's origin, or a new one
+   * @return nullptr if the connection could not be created
+   */
+  Connection *borrow(const char *url)
+  {
+    UrlOrigin origin;
+    if (!url_origin(url, origin))
+    {
+      // a one-shot connection, closed on release; the client judges the URL
+      origin.secure = strncmp(url, "https://", 8) == 0;
+      origin.host[0] = 0;
+      origin.port = 0;
+      Connection *connection = create(origin);
+      if (connection != nullptr)
+        opened++;
+      return connection;
+    }
+
+    for (int i = 0; i < CONNECTION_POOL_SIZE; i++)
+    {
+      Slot &slot = slots[i];
+      if (slot.connection == nullptr || slot.busy || !same_origin(slot.origin, origin))
+        continue;
+      if (!slot.connection->connected())
+      {
+        // closed by the server while idle
+        destroy(slot);
+        continue;
+      }
+      slot.busy = true;
+      slot.last_used = ++clock;
+      reused++;
+      return slot.connection;
+    }
+
+    Connection *connection = create(origin);
+    if (connection == nullptr)
+      return nullptr;
+    opened++;
+
+    Slot *slot = freeSlot();
+    if (slot != nullptr)
+    {
+      slot->connection = connection;
+      slot->origin = origin;
+      slot->busy = true;
+      slot->last_used = ++clock;
+    }
+    return connection;
+  }
+
+  /**
+   * @brief Returns a borrowed connection. It stays open for the next request
+   * if the server kept it alive, otherwise it is closed and destroyed.
+   */
+  void release(Connection *connection)
+  {
+    Slot *slot = find(connection);
+    if (slot == nullptr)
+    {
+      // didn't fit in the pool
+      connection->stop();
+      delete connection;
+      return;
+    }
+    slot->busy = false;
+    if (!connection->connected())
+      destroy(*slot);
+  }
+
+  /**
+   * @brief Closes every connection, e.g. before WiFi is turned off.
+   * Safe to call at any time and more than once; connections still in use are
+   * closed now and destroyed when they are released.
+   */
+  void drain()
+  {
+    for (int i = 0; i < CONNECTION_POOL_SIZE; i++)
+    {
+      Slot &slot = slots[i];
+      if (slot.connection == nullptr)
+        continue;
+      if (slot.busy)
+        slot.connection->stop();
+      else
+        destroy(slot);
+    }
+  }
+
+  /** @return connections created so far */
+  int openedCount() const { return opened; }
+
+  /** @return requests served by an already open connection */
+  int reusedCount() const { return reused; }
+
+  /** @return connections currently held, idle or in use */
+  int size() const
+  {
+    int n = 0;
+    for (int i = 0; i < CONNECTION_POOL_SIZE; i++)
+      n += slots[i].connection != nullptr;
+    return n;
+  }
+
+private:
+  struct Slot
+  {
+    Connection *connection;
+    UrlOrigin origin;
+    bool busy;
+    uint32_t last_used;
+  };
+
+  Slot *find(Connection *connection)
+  {
+    for (int i = 0; i < CONNECTION_POOL_SIZE; i++)
+    {
+      if (slots[i].connection == connection)
+        return &slots[i];
+    }
+    return nullptr;
+  }
+
+  /** @return an empty slot, making one by closing the least recently used idle connection */
+  Slot *freeSlot()
+  {
+    Slot *lru = nullptr;
+    for (int i = 0; i < CONNECTION_POOL_SIZE; i++)
+    {
+      if (slots[i].connection == nullptr)
+        return &slots[i];
+      if (!slots[i].busy && (lru == nullptr || slots[i].last_used < lru->last_used))
+        lru = &slots[i];
+    }
+    if (lru != nullptr)
+      destroy(*lru);
+    return lru;
+  }
+
+  void destroy(Slot &slot)
+  {
+    slot.connection->stop();
+    delete slot.connection;
+    slot.connection = nullptr;
+    slot.busy = false;
+  }
+
+  factory_t create;
+  Slot slots[CONNECTION_POOL_SIZE];
+  int opened;
+  int reused;
+  uint32_t clock;
+};
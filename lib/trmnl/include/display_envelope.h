@@ -0,0 +1,69 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <api_response_parsing.h>
+
+/**
+ * /api/display answer that carries the image too, so a refresh takes one request
+ * instead of two. The device offers it in Accept; a server that doesn't know it
+ * answers with plain JSON and the image is fetched from image_url as before.
+ *
+ * Layout (integers little-endian):
+ *   0  4  magic "TRME"
+ *   4  1  version (1)
+ *   5  1  image type (display_envelope_image_e)
+ *   6  2  reserved, 0
+ *   8  4  metadata length
+ *  12  4  image length; 0 if the image is not included
+ *  16     metadata: the JSON /api/display would return
+ *   .     image body (BMP, PNG or JPEG), up to the end of the response
+ */
+#define DISPLAY_ENVELOPE_CONTENT_TYPE "application/vnd.trmnl.display-envelope"
+#define DISPLAY_ENVELOPE_MAGIC "TRME"
+#define DISPLAY_ENVELOPE_VERSION 1
+#define DISPLAY_ENVELOPE_HEADER_SIZE 16
+#define DISPLAY_ENVELOPE_MAX_METADATA 8192
+
+enum display_envelope_image_e
+{
+  ENVELOPE_IMAGE_NONE = 0,
+  ENVELOPE_IMAGE_BMP = 1,
+  ENVELOPE_IMAGE_PNG = 2,
+  ENVELOPE_IMAGE_JPEG = 3,
+};
+
+struct DisplayEnvelopeHeader
+{
+  uint8_t version;
+  uint8_t image_type;
+  uint32_t metadata_length;
+  uint32_t image_length;
+};
+
+enum display_envelope_err_e
+{
+  ENVELOPE_OK,
+  ENVELOPE_BAD_HEADER,   // wrong magic or version, or lengths out of range
+  ENVELOPE_TRUNCATED,    // the response ended (or failed) before the image
+  ENVELOPE_BAD_METADATA, // metadata is not valid /api/display JSON
+};
+
+/** @return true if a response with this Content-Type is an envelope */
+bool is_display_envelope(const char *content_type);
+
+/** @return false if data isn't the header of an envelope this firmware can read */
+bool parse_display_envelope_header(const uint8_t *data, size_t len, DisplayEnvelopeHeader *out);
+
+/**
+ * @brief Reads header and metadata of an envelope, leaving body at the first image byte
+ * @param arena used for the metadata JSON, see parseResponse_apiDisplay()
+ * @param response metadata; error_detail says what went wrong with ENVELOPE_BAD_METADATA
+ */
+display_envelope_err_e read_display_envelope(HttpBodyReader &body, JsonArena &arena, DisplayEnvelopeHeader *header, ApiDisplayResponse *response);
+
+/** @return true if an image follows the metadata */
+inline bool display_envelope_has_image(const DisplayEnvelopeHeader &header)
+{
+  return header.image_type != ENVELOPE_IMAGE_NONE && header.image_length > 0;
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define DNS_CACHE_MAGIC 0x444e5343 // "DNSC"
+#define DNS_CACHE_ENTRIES 4
+#define DNS_CACHE_HOST_MAX_LEN 64
+#define DNS_CACHE_MIN_TTL_S 60
+#define DNS_CACHE_MAX_TTL_S 86400
+#define DNS_CACHE_MAX_STALE_S 86400 // how long past its TTL an address is still tried while it is refreshed
+
+enum dns_query_state_e
+{
+  DNS_QUERY_PENDING,
+  DNS_QUERY_DONE,
+  DNS_QUERY_FAILED
+};
+
+/**
+ * Asynchronous name lookup. Implemented over a UDP socket on the device and by fakes in the tests.
+ */
+class DnsResolver
+{
+public:
+  virtual ~DnsResolver() {}
+
+  /** @brief Sends a query for host, replacing any query still pending for it */
+  virtual bool start(const char *host) = 0;
+
+  /**
+   * @brief Checks on the query for host without waiting
+   * @param address IPv4 address in network byte order, set when done
+   * @param ttl_s time to live reported by the server, set when done
+   */
+  virtual dns_query_state_e poll(const char *host, uint32_t *address, uint32_t *ttl_s) = 0;
+};
+
+struct DnsCacheEntry
+{
+  uint32_t host_hash; // 0 = free slot
+  uint32_t address;
+  uint32_t resolved_at;
+  uint32_t expires_at;
+};
+
+/** Cache contents, meant to live in RTC memory (RTC_DATA_ATTR) so addresses survive deep sleep */
+struct DnsCacheRtc
+{
+  uint32_t magic;
+  DnsCacheEntry entries[DNS_CACHE_ENTRIES];
+};
+
+struct DnsCacheOptions
+{
+  /** wall clock in seconds, used for TTLs */
+  uint32_t (*now_s)();
+  /** monotonic millisecond clock (millis() on the device) */
+  uint32_t (*now_ms)();
+  /** called while waiting for an answer; should delay/yield for a short while */
+  void (*wait)();
+  /** how long to wait for one answer */
+  uint32_t timeout_ms;
+  /** queries sent before giving up on a host that isn't cached */
+  uint8_t attempts;
+};
+
+/**
+ * Host name cache that honors the TTL of the answers.
+ *
+ * A cached address is returned immediately. Once its TTL has passed it is still
+ * returned (for up to DNS_CACHE_MAX_STALE_S), and a new query is sent in the background
+ * and picked up by a later resolve() or poll(). Only a host that was never resolved,
+ * or whose address is far too old, has to wait for the resolver.
+ */
+class DnsCache
+{
+public:
+  DnsCache(DnsCacheRtc &rtc, DnsResolver &resolver, const DnsCacheOptions &options);
+
+  /**
+   * @param address IPv4 address in network byte order
+   * @return false if host could not be resolved
+   */
+  bool resolve(const char *host, uint32_t *address);
+
+  /** @brief Stores the answers to background refreshes that have arrived, without waiting */
+  void poll();
+
+  /** @brief Drops host, e.g. because its cached address refused the connection */
+  void forget(const char *host);
+
+  /** @return number of background refreshes still waiting for an answer */
+  int pendingRefreshes() const;
+
+private:
+  void init();
+  DnsCacheEntry *find(const char *host);
+  void store(const char *host, uint32_t address, uint32_t ttl_s);
+  void startRefresh(const char *host);
+  void dropPending(const char *host);
+
+  DnsCacheRtc &rtc;
+  DnsResolver &resolver;
+  DnsCacheOptions options;
+  char pending[DNS_CACHE_ENTRIES][DNS_CACHE_HOST_MAX_LEN];
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define DNS_PORT 53
+#define DNS_MAX_MESSAGE_SIZE 512 // plain UDP, no EDNS
+
+enum dns_parse_err_e
+{
+  DNS_PARSE_OK,
+  DNS_PARSE_MALFORMED,    // truncated or inconsistent message
+  DNS_PARSE_WRONG_ID,     // answer to some other query
+  DNS_PARSE_NXDOMAIN,     // the name does not exist
+  DNS_PARSE_SERVER_ERROR, // SERVFAIL, REFUSED, ...
+  DNS_PARSE_NO_ADDRESS    // valid answer without an A record
+};
+
+/**
+ * @brief Builds a recursive A query for host
+ * @return message length, 0 if host is not a valid name or buf is too small
+ */
+size_t dns_build_query(uint8_t *buf, size_t size, uint16_t id, const char *host);
+
+/**
+ * @brief Extracts the first IPv4 address from the answer to a query built with dns_build_query()
+ * @param address first A record, in network byte order (as IPAddress(uint32_t) expects)
+ * @param ttl_s lowest TTL along the CNAME chain leading to the address
+ */
+dns_parse_err_e dns_parse_response(const uint8_t *msg, size_t len, uint16_t id, uint32_t *address, uint32_t *ttl_s);
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <stdint.h>
+
+#define FRAME_DIFF_MAGIC 0x46444946 // "FDIF"
+#define FRAME_DIFF_BAND_ROWS 16     // rows hashed together
+#define FRAME_DIFF_TILE_BYTES 8     // bytes of a row in a tile: 64 pixels
+#define FRAME_DIFF_MAX_TILES 400    // 800x480 in either orientation
+#define FRAME_DIFF_MAX_WINDOWS 4
+#define FRAME_DIFF_MAX_RUNS 64      // more separate changes than this: the whole frame is sent
+
+/**
+ * Hashes of the 1-bpp frame on the panel, one per tile of FRAME_DIFF_BAND_ROWS rows by
+ * FRAME_DIFF_TILE_BYTES bytes. Meant to live in RTC memory (RTC_DATA_ATTR) so it survives
+ * deep sleep; a zero-initialized struct is a panel showing something unknown.
+ */
+struct FrameDiffRtc
+{
+  uint32_t magic;
+  uint16_t width;
+  uint16_t height;
+  uint32_t hashes[FRAME_DIFF_MAX_TILES];
+};
+
+struct FrameDiffOptions
+{
+  /** windows written and refreshed at most, up to FRAME_DIFF_MAX_WINDOWS; closest ones merge beyond */
+  int max_windows;
+  /** two windows merge when the box around both adds no more than this many unchanged tiles */
+  int merge_tiles;
+  /** windows covering more than this share of the frame aren't worth it: the whole frame is sent */
+  int max_percent;
+};
+
+/** Part of the frame to send, in pixels; x is a multiple of 8, and so is the width but at the right edge */
+struct DirtyWindow
+{
+  int x, y, width, height;
+};
+
+enum frame_diff_e
+{
+  FRAME_DIFF_UNCHANGED, // the panel already shows this frame
+  FRAME_DIFF_WINDOWS,   // only the windows changed
+  FRAME_DIFF_FULL,      // send the whole frame: nothing known about the panel, or too much changed
+};
+
+struct FrameDiffResult
+{
+  frame_diff_e kind;
+  int count; // windows, for FRAME_DIFF_WINDOWS
+  DirtyWindow windows[FRAME_DIFF_MAX_WINDOWS];
+  int dirty_tiles;  // tiles whose hash changed
+  int window_tiles; // tiles covered by the windows
+};
+
+/**
+ * Finds the parts of a new 1-bpp frame that differ from the one on the panel, so only
+ * those are written to the panel for a partial refresh.
+ *
+ * Nothing but the hashes of the frame on the panel is kept: compare() hashes the new
+ * frame tile by tile, turns the changed tiles into a few windows, and keeps the new
+ * hashes until commit() says the frame made it to the panel. Any other picture sent to
+ * the panel must call forget(), so the next frame is sent whole.
+ *
+ * The hashes outlive deep sleep, the panel's memory doesn't: windows are only written
+ * over a frame committed by this object, in this wake, with no panelReset() since.
+ * The device sleeps between fetches, so in normal use windows only come up for a second
+ * image in one wake; across wakes the hashes still catch an unchanged image.
+ */
+class FrameDiff
+{
+public:
+  FrameDiff(FrameDiffRtc &rtc, const FrameDiffOptions &options);
+
+  /**
+   * @brief Compares a frame with the one on the panel
+   * @param frame 1 bit per pixel, rows of pitch bytes
+   * @return what to send, also in result.kind
+   */
+  frame_diff_e compare(const uint8_t *frame, int width, int height, int pitch, FrameDiffResult &result);
+
+  /** @brief The frame given to the last compare() is on the panel now */
+  void commit();
+
+  /** @brief The panel shows something that wasn't compared (a message, a gray image...) */
+  void forget();
+
+  /** @brief The panel's memory was cleared (its deep sleep); the glass still shows the frame */
+  void panelReset();
+
+  /** @return true if the panel's memory holds the committed frame, so windows can go over it */
+  bool panelRamValid() const { return panel_ram_valid; }
+
+  /** @return number of tiles of a frame, 0 if it has more than FRAME_DIFF_MAX_TILES */
+  static int tileCount(int width, int height);
+
+private:
+  void hash(const uint8_t *frame, int width, int height, int pitch);
+  int findWindows(const bool *dirty, int columns, int bands, FrameDiffResult &result);
+
+  FrameDiffRtc &rtc;
+  FrameDiffOptions options;
+  uint32_t pending[FRAME_DIFF_MAX_TILES];
+  uint16_t pending_width;
+  uint16_t pending_height;
+  bool has_pending;
+  bool panel_ram_valid;
+};
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Minimal byte source the body reader pulls from.
+ * Implemented over WiFiClient on the device and by fakes in the native tests.
+ */
+class ByteSource
+{
+public:
+  virtual ~ByteSource() {}
+
+  /** @return number of bytes that can be read without waiting */
+  virtual int available() = 0;
+
+  /** @return number of bytes copied into buf (0 if none were ready) */
+  virtual int read(uint8_t *buf, size_t size) = 0;
+
+  /** @return false once the peer has closed and no buffered data is left */
+  virtual bool connected() = 0;
+};
+
+enum body_read_err_e
+{
+  BODY_READ_OK,
+  BODY_READ_TOO_BIG,   // body (or declared length) exceeds the destination buffer
+  BODY_READ_TIMEOUT,   // idle or total timeout expired before the body ended
+  BODY_READ_TRUNCATED, // connection closed before the declared length was received
+  BODY_READ_MALFORMED, // invalid chunked framing
+  BODY_READ_EMPTY      // no body at all
+};
+
+struct HttpBodyReaderOptions
+{
+  uint32_t total_timeout_ms;
+  uint32_t idle_timeout_ms;
+  /** monotonic millisecond clock (millis() on the device) */
+  uint32_t (*now_ms)();
+  /** called while waiting for data; should delay/yield for a short while */
+  void (*wait)();
+};
+
+/**
+ * Incremental reader for an HTTP response body whose headers were already consumed.
+ * Handles both Content-Length and chunked transfer encoding and hands the payload
+ * out without any intermediate copies, so the caller can stream it into a single
+ * pre-sized buffer (readAll) or into a decoder (read).
+ */
+class HttpBodyReader
+{
+public:
+  /**
+   * @param source connection positioned at the first byte of the body
+   * @param content_length value of Content-Length, or -1 if unknown
+   * @param chunked true if Transfer-Encoding is chunked (content_length is ignored)
+   */
+  HttpBodyReader(ByteSource &source, int32_t content_length, bool chunked, const HttpBodyReaderOptions &options);
+
+  /**
+   * @brief Reads up to len bytes of payload, waiting for data as needed.
+   * @return number of bytes read; less than len only at the end of the body or on error
+   */
+  size_t read(uint8_t *dst, size_t len);
+
+  /**
+   * @brief Reads the rest of the body into buf.
+   * Fails with BODY_READ_TOO_BIG as soon as the declared length or chunk sizes show
+   * the body cannot fit, before the payload itself is transferred.
+   * @param received number of payload bytes stored in buf
+   */
+  body_read_err_e readAll(uint8_t *buf, size_t capacity, size_t *received);
+
+  /** @return true once the complete body has been consumed */
+  bool finished() const { return state == STATE_DONE; }
+
+  /** @return error that stopped the last read, BODY_READ_OK otherwise */
+  body_read_err_e error() const { return err; }
+
+  /** @return payload bytes delivered so far */
+  size_t bytesRead() const { return total; }
+
+  /** @return Content-Length if known up front, -1 otherwise */
+  int32_t expectedLength() const { return chunked ? -1 : content_length; }
+
+private:
+  enum State
+  {
+    STATE_CHUNK_SIZE,
+    STATE_DATA,
+    STATE_CHUNK_END,
+    STATE_TRAILER,
+    STATE_DONE
+  };
+
+  bool waitForData();
+  bool readByte(uint8_t *out);
+  bool readLine(char *line, size_t size);
+  bool nextChunk();
+  void fail(body_read_err_e e);
+
+  ByteSource &source;
+  int32_t content_length;
+  bool chunked;
+  HttpBodyReaderOptions options;
+  State state;
+  body_read_err_e err;
+  size_t remaining; // payload bytes left in the current chunk / body
+  size_t total;
+  size_t limit; // readAll capacity, checked against chunk headers
+  uint32_t start_time;
+  uint32_t last_data_time;
+};
+
+#define HTTP_BODY_STREAM_BUFFER 64
+
+/**
+ * Stream-like view of a body (read() / readBytes()), so parsers that take an Arduino
+ * Stream, like deserializeJson(), can consume it straight from the connection.
+ * The body is pulled in small blocks rather than one byte per call.
+ */
+class HttpBodyStream
+{
+public:
+  /**
+   * @param limit number of body bytes this stream may consume; the reader is left
+   * right behind them, e.g. at the next part of an envelope (see display_envelope.h)
+   */
+  HttpBodyStream(HttpBodyReader &reader, size_t limit = SIZE_MAX);
+
+  /** @return next byte, -1 at the end of the body or on error */
+  int read();
+
+  size_t readBytes(char *buf, size_t len);
+
+  /**
+   * @brief Discards whatever the parser left unread (e.g. the end of a chunked body),
+   * so the connection can carry the next request
+   * @return true if the body (or the limit) was consumed completely
+   */
+  bool finish();
+
+private:
+  bool fill(uint8_t *dst, size_t size, size_t *n);
+
+  HttpBodyReader &reader;
+  size_t limit; // bytes left to take from the reader
+  bool bounded;
+  uint8_t buf[HTTP_BODY_STREAM_BUFFER];
+  size_t pos;
+  size_t len;
+};
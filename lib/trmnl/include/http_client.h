@@ -4,6 +4,8 @@
 #include <Arduino.h>
 #include <WiFiClientSecure.h>
 #include <HTTPClient.h>
+#include <memory>
+#include <connection_pool.h>
 
 // Error codes for the HTTP utilities - using distinct values to avoid overlap
 enum HttpError
@@ -14,7 +16,35 @@ enum HttpError
 };
 
 /**
- * @brief Higher-order function that sets up WiFiClient and HTTPClient, then runs a callback
+ * A connection kept open between requests: the socket and the HTTPClient that uses it.
+ * HTTPClient stops its client when destroyed, so both have to stay alive for the
+ * socket to be reused; the client is declared first so it outlives the HTTPClient.
+ */
+struct HttpConnection
+{
+  std::unique_ptr<WiFiClient> client;
+  HTTPClient http;
+
+  bool connected() { return client->connected(); }
+
+  void stop()
+  {
+    http.end();
+    client->stop();
+  }
+};
+
+/** Keep-alive connections of the current wake, shared by all withHttp() calls */
+extern ConnectionPool<HttpConnection> httpConnectionPool;
+
+/**
+ * @brief Closes all pooled connections. Must be called before WiFi is turned off;
+ * safe to call more than once and from inside a withHttp() callback.
+ */
+void drainHttpConnections(void);
+
+/**
+ * @brief Higher-order function that borrows a connection from the pool, sets up HTTPClient, then runs a callback
  * @param url The initial URL to connect to
  * @param callback Function to call with the HTTPClient pointer and error code
  * @return The value returned by the callback
@@ -24,43 +54,30 @@ ReturnType withHttp(const String &url, Callback callback)
 {
   Log_info("==== withHttp() %s", url.c_str());
 
-  bool isHttps = (url.indexOf("https://") != -1);
-
-  // Conditionally allocate only the client we need
-  WiFiClient *client = nullptr;
-
-  if (isHttps)
-  {
-    WiFiClientSecure *secureClient = new WiFiClientSecure();
-    secureClient->setInsecure();
-    client = secureClient;
-  }
-  else
-  {
-    client = new WiFiClient();
-  }
+  // Requests to a host that was already contacted during this wake reuse its socket
+  // (and its TLS session); new connections resume a cached session when there is one
+  // (see tls_session_resume.h), and host names are looked up in dnsCache (see udp_dns_resolver.h)
+  HttpConnection *connection = httpConnectionPool.borrow(url.c_str());
 
   // Check if client creation succeeded
-  if (!client)
+  if (!connection)
   {
     return callback(nullptr, HTTPCLIENT_WIFICLIENT_ERROR);
   }
 
   ReturnType result;
-  { // Add a scoping block for HTTPClient https to make sure it is destroyed before WiFiClientSecure *client is
-
-    HTTPClient https;
-    if (https.begin(*client, url))
-    {
-      result = callback(&https, HTTPCLIENT_SUCCESS);
-      https.end();
-    }
-    else
-    {
-      result = callback(nullptr, HTTPCLIENT_HTTPCLIENT_ERROR);
-    }
+  HTTPClient &https = connection->http;
+  https.setReuse(true);
+  if (https.begin(*connection->client, url))
+  {
+    result = callback(&https, HTTPCLIENT_SUCCESS);
+    https.end(); // keeps the socket open if the server allows it
+  }
+  else
+  {
+    result = callback(nullptr, HTTPCLIENT_HTTPCLIENT_ERROR);
   }
-  delete client;
+  httpConnectionPool.release(connection);
 
   return result;
 }
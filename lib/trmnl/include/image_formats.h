@@ -0,0 +1,69 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define IMAGE_FORMATS_HEADER "Image-Formats"
+#define IMAGE_FORMATS_HEADER_MAX_LEN 128
+
+// Markers of bb_epaper's compressed bitmaps (BB_BITMAP_MARKER / BB_BITMAP2_MARKER in Group5.h)
+#define G5_IMAGE_MARKER 0xBBBF
+#define G5_IMAGE2_MARKER 0xBBB2
+#define G5_IMAGE_HEADER_SIZE 8 // marker, width, height, compressed size; 16 bits each, little endian
+
+/** Image formats the display path can render, as bits of a set */
+enum image_format_e
+{
+  IMAGE_FORMAT_G5 = 0x01,          // Group5, 1 plane
+  IMAGE_FORMAT_G5_2PLANE = 0x02,   // Group5, the panel's 2 planes one after the other
+  IMAGE_FORMAT_PNG_INDEXED = 0x04, // palette PNG, 1 to 8 bpp
+  IMAGE_FORMAT_PNG = 0x08,         // grayscale and truecolor PNG, dithered on the device
+  IMAGE_FORMAT_JPEG = 0x10,
+  IMAGE_FORMAT_BMP = 0x20, // uncompressed, 1 bpp, full frame
+};
+
+/** What the panel can show, for image_formats_for_panel() */
+struct PanelImageCaps
+{
+  bool four_gray;  // 2 planes of gray levels (4-gray mode)
+  bool red;        // 2 planes, black/white and red (B/W/R)
+  bool full_color; // 4 bpp color codes, no planes
+};
+
+/** @return set of image_format_e the display path renders on such a panel */
+uint32_t image_formats_for_panel(const PanelImageCaps &panel);
+
+/**
+ * @brief Writes the formats as the value of the Image-Formats request header, e.g.
+ *        "g5;bpp=1, g5;bpp=2, png;bpp=1|2|4|8;indexed, png;bpp=8|16|24|32, jpeg;bpp=8|24, bmp;bpp=1"
+ *        Each entry is a format and the bit depths it is accepted at.
+ * @return length of the value, without the terminating 0
+ */
+size_t image_formats_header(uint32_t formats, char *out, size_t size);
+
+/** @return the image_format_e the data looks like, 0 if none */
+uint32_t image_format_detect(const uint8_t *data, size_t len);
+
+enum g5_image_err_e
+{
+  G5_IMAGE_OK,
+  G5_IMAGE_NOT_G5,       // no G5 marker
+  G5_IMAGE_TRUNCATED,    // the compressed data is longer than what was received
+  G5_IMAGE_BAD_SIZE,     // 0 pixels wide or high
+  G5_IMAGE_UNSUPPORTED,  // 2 planes on a panel without them
+};
+
+/** Where and how to draw a G5 image */
+struct G5ImageInfo
+{
+  int width, height;
+  int planes;
+  int x, y; // top left corner on the panel: images are centered, larger ones start off the panel
+};
+
+/**
+ * @brief Checks the header of a G5 image before it goes to the decoder
+ * @param formats from image_formats_for_panel(), says if 2 planes can be shown
+ */
+g5_image_err_e g5_image_check(const uint8_t *data, size_t len, int panel_width, int panel_height, uint32_t formats,
+                              G5ImageInfo *info);
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <Arduino.h>
+#include <persistence_interface.h>
+
+#define IMAGE_VALIDATORS_MAGIC 0x45544147 // "ETAG"
+#define IMAGE_ETAG_MAX_LEN 72
+#define IMAGE_LAST_MODIFIED_MAX_LEN 32
+
+/**
+ * Validators of the image currently on the panel, kept in RTC memory so that a
+ * wake from deep sleep doesn't need to touch NVS. Must be zero-initialized
+ * (RTC_DATA_ATTR) so a cold boot falls back to NVS.
+ */
+struct ImageValidatorsRtc
+{
+  uint32_t magic;
+  uint32_t url_hash;
+  char etag[IMAGE_ETAG_MAX_LEN];
+  char last_modified[IMAGE_LAST_MODIFIED_MAX_LEN];
+};
+
+/** Values to send as If-None-Match / If-Modified-Since; empty if unknown */
+struct ImageValidators
+{
+  String etag;
+  String last_modified;
+};
+
+/**
+ * Remembers the ETag / Last-Modified of the last image that was shown, so the next
+ * image request can be made conditional and a 304 can skip the download and the refresh.
+ *
+ * The ETag is sent whatever the URL is (the server renames identical renders), while
+ * Last-Modified is only meaningful for the same URL.
+ */
+class ImageValidatorStore
+{
+public:
+  ImageValidatorStore(ImageValidatorsRtc &rtc, const char *etag_key, const char *last_modified_key, const char *url_key, Persistence &persistence);
+
+  /** @brief Validators to send with a request for url */
+  ImageValidators load(const char *url);
+
+  /**
+   * @brief Remembers the validators of an image that was just shown.
+   * NVS is only written when something changed.
+   */
+  void save(const char *url, const String &etag, const String &last_modified);
+
+  /** @brief Forgets the validators, e.g. because something else was drawn on the panel */
+  void clear();
+
+private:
+  bool restore();
+
+  ImageValidatorsRtc &rtc;
+  const char *etag_key;
+  const char *last_modified_key;
+  const char *url_key;
+  Persistence &persistence;
+};
+
+/** @return FNV-1a hash of a URL, 0 is never returned */
+uint32_t image_url_hash(const char *url);
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <png_dither.h>
+
+#define JPEG_PLANES_MAX_STRIP 16 // tallest MCU JPEGDEC hands over (4:2:0 subsampling)
+#define JPEG_PLANES_RED_MARGIN 64 // how much red has to exceed green and blue to be drawn red
+
+enum jpeg_planes_mode_e
+{
+  JPEG_PLANES_FOUR_GRAY, // 8-bit gray in, the two bits of the 4-gray panel value out
+  JPEG_PLANES_BWR        // RGB565 in, black/white and red out
+};
+
+/**
+ * @brief Receives a finished strip, one plane at a time
+ * Rows are pitch bytes apart, 1 bit per pixel, MSB first. For 4-gray plane0/plane1 hold
+ * bit 0/1 of the panel value (0 = white); for B/W/R plane0 is 1 for white and plane1 is 1 for red.
+ * @return false to stop decoding
+ */
+typedef bool (*jpeg_planes_write_t)(void *ctx, int y, int height, const uint8_t *plane0, const uint8_t *plane1,
+                                    int pitch);
+
+/**
+ * Turns the blocks of a single JPEGDEC pass into both planes of a 4-gray or B/W/R panel.
+ *
+ * JPEGDEC draws an MCU row as several blocks, left to right. They are gathered in a strip
+ * buffer as tall as an MCU; once the row is complete it is dithered (rows stay in order, so
+ * the error carries across strips) and split into planes. Each strip is written to both
+ * planes through its own address window, so the image no longer has to be decoded once
+ * per plane.
+ */
+class JpegPlanes
+{
+public:
+  JpegPlanes();
+  ~JpegPlanes();
+
+  /**
+   * @brief Allocates the strip for an image
+   * @return false if there isn't enough memory
+   */
+  bool begin(int width, int height, jpeg_planes_mode_e mode, dither_mode_e dither, jpeg_planes_write_t write,
+             void *ctx);
+
+  void end();
+
+  /**
+   * @brief Adds a block drawn by JPEGDEC
+   * @param w pixels of each row that are part of the image (JPEGDRAW::iWidthUsed)
+   * @param stride pixels from one row of the block to the next (JPEGDRAW::iWidth)
+   * @param pixels 8-bit gray for JPEG_PLANES_FOUR_GRAY, RGB565 for JPEG_PLANES_BWR
+   * @return false if the block doesn't fit the strip or the strip couldn't be written
+   */
+  bool addBlock(int x, int y, int w, int h, int stride, const void *pixels);
+
+  /** @brief Writes a strip that's still waiting for blocks, e.g. when the decoder stopped early */
+  bool flush();
+
+  /** @return number of strips written since begin() */
+  int strips() const { return strip_count; }
+
+private:
+  bool writeStrip();
+
+  int width, height, pitch;
+  jpeg_planes_mode_e mode;
+  jpeg_planes_write_t write;
+  void *ctx;
+  RowDither dither;
+  uint8_t *gray;   // JPEG_PLANES_MAX_STRIP rows of 8-bit gray
+  uint8_t *red;    // the same rows as 1-bit red flags (B/W/R only)
+  uint8_t *planes; // both planes of a strip, then one 2-bpp row
+  int strip_y, strip_h;
+  int filled; // pixels of the strip's rows received so far
+  int strip_count;
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <stdint.h>
+
+#define JPEG_STRIP_MAX_HEIGHT 16 // tallest MCU JPEGDEC hands over (4:2:0 subsampling)
+
+/**
+ * @brief Receives a finished strip: height rows of pitch bytes, 1 bit per pixel, MSB first
+ * @return false to stop decoding
+ */
+typedef bool (*jpeg_strip_write_t)(void *ctx, int y, int height, const uint8_t *data, int pitch);
+
+/**
+ * Gathers the 1-bpp blocks JPEGDEC draws (ONE_BIT_DITHERED) into full-width strips, so
+ * the panel gets one address window and one transfer per MCU row instead of a window,
+ * a write command and a transfer per row of every block.
+ */
+class JpegStrip
+{
+public:
+  JpegStrip();
+  ~JpegStrip();
+
+  /**
+   * @brief Allocates the strip for an image
+   * @return false if there isn't enough memory
+   */
+  bool begin(int width, int height, jpeg_strip_write_t write, void *ctx);
+
+  void end();
+
+  /**
+   * @brief Adds a block drawn by JPEGDEC
+   * @param x multiple of 8, as every MCU is
+   * @param w pixels of each row that are part of the image (JPEGDRAW::iWidthUsed)
+   * @param stride pixels from one row of the block to the next (JPEGDRAW::iWidth)
+   * @return false if the block doesn't fit the strip or the strip couldn't be written
+   */
+  bool addBlock(int x, int y, int w, int h, int stride, const uint8_t *pixels);
+
+  /** @brief Writes a strip that's still waiting for blocks, e.g. when the decoder stopped early */
+  bool flush();
+
+  /** @return number of strips written since begin() */
+  int strips() const { return strip_count; }
+
+private:
+  bool writeStrip();
+
+  int width, height, pitch;
+  jpeg_strip_write_t write;
+  void *ctx;
+  uint8_t *strip;
+  int strip_y, strip_h;
+  int filled; // pixels of the strip's rows received so far
+  int strip_count;
+};
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <ArduinoJson.h>
+
+/**
+ * ArduinoJson allocator over a fixed buffer, so a document never touches the heap.
+ *
+ * Allocations are carved from the buffer one after the other. The last block can
+ * grow and shrink in place, which covers how ArduinoJson builds strings and trims
+ * its pools; everything else is only given back by reset(). When the buffer is
+ * full, allocate() returns nullptr and deserialization fails with NoMemory.
+ */
+class JsonArena : public ArduinoJson::Allocator
+{
+public:
+  JsonArena(uint8_t *buffer, size_t capacity);
+
+  void *allocate(size_t size) override;
+  void deallocate(void *ptr) override;
+  void *reallocate(void *ptr, size_t new_size) override;
+
+  /** @brief Makes the whole buffer available again; documents using it must be gone */
+  void reset();
+
+  /** @return bytes in use, including block headers */
+  size_t used() const { return top; }
+  /** @return highest used() since construction */
+  size_t peak() const { return high_water; }
+  size_t capacity() const { return size; }
+
+private:
+  uint8_t *buffer;
+  size_t size;
+  size_t top;
+  size_t last; // offset of the most recent block, or size if it was freed
+  size_t high_water;
+};
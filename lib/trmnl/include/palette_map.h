@@ -0,0 +1,105 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PALETTE_MAP_MAGIC 0x504d4150 // "PMAP"
+#define PALETTE_MAP_MAX_ENTRIES 256
+#define PALETTE_MAP_MAX_PANEL_COLORS 16 // MAX_COLOR_COUNT of bb_epaper
+#define PALETTE_MAP_CACHE_ENTRIES 2 // a playlist alternating between two palettes still hits
+
+/**
+ * Finds the length of the PLTE chunk in PNG data handed over in pieces, in file order,
+ * e.g. as it comes off the network. PNGdec keeps the palette but not how many entries it has.
+ */
+class PngPaletteScanner
+{
+public:
+  PngPaletteScanner();
+
+  void reset();
+
+  void feed(const uint8_t *data, size_t len);
+
+  /** @return true once the PLTE chunk was seen, or the image data started without one */
+  bool done() const { return state == SCAN_DONE; }
+
+  /** @return number of palette entries, 0 if there is no PLTE chunk (yet) */
+  int entries() const { return palette_entries; }
+
+private:
+  enum scan_state_e
+  {
+    SCAN_SIGNATURE,
+    SCAN_CHUNK_HEADER,
+    SCAN_CHUNK_BODY,
+    SCAN_DONE
+  };
+
+  scan_state_e state;
+  uint32_t remaining; // bytes of the signature or of the chunk being skipped, CRC included
+  uint8_t header[8];  // chunk length and type
+  uint8_t header_len;
+  int palette_entries;
+};
+
+/**
+ * @brief Scans an in-memory PNG for its PLTE chunk
+ * @return number of palette entries, 0 if the image has none
+ */
+int png_palette_entries(const uint8_t *png, size_t size);
+
+/**
+ * @brief Maps every PNG palette entry to the closest panel color
+ * Colors are compared in CIELAB (distance is delta E 1976), so an entry the panel can't
+ * show goes to the color that looks most like it rather than to index 0.
+ * @param palette RGB triplets, as in PNGDRAW::pPalette
+ * @param panel_rgb the panel's colors as 0xRRGGBB, in the order of its color codes
+ * @param map receives an index into panel_rgb for each palette entry
+ * @return number of entries that aren't exactly one of the panel colors
+ */
+int palette_map_nearest(const uint8_t *palette, int entries, const uint32_t *panel_rgb, int panel_colors, uint8_t *map);
+
+/** @return hash of a palette together with the panel colors it is mapped to, never 0 */
+uint32_t palette_map_key(const uint8_t *palette, int entries, const uint32_t *panel_rgb, int panel_colors);
+
+struct PaletteMapCacheEntry
+{
+  uint32_t key; // 0 = free slot
+  uint32_t last_used;
+  uint16_t entries;
+  uint16_t inexact;
+  uint8_t map[PALETTE_MAP_MAX_ENTRIES];
+};
+
+/** Cache contents, meant to live in RTC memory (RTC_DATA_ATTR) so maps survive deep sleep */
+struct PaletteMapRtc
+{
+  uint32_t magic;
+  uint32_t uses;
+  PaletteMapCacheEntry entries[PALETTE_MAP_CACHE_ENTRIES];
+};
+
+/**
+ * Remembers the palette maps of the last few images, since the server sends the same
+ * palette with every image of a playlist.
+ */
+class PaletteMapCache
+{
+public:
+  PaletteMapCache(PaletteMapRtc &rtc);
+
+  /**
+   * @brief Gets the map for a palette, from the cache or by palette_map_nearest()
+   * @param map receives an index into panel_rgb for each palette entry
+   * @param inexact set to the number of entries that aren't exactly a panel color, may be nullptr
+   * @return true if the map came from the cache
+   */
+  bool map(const uint8_t *palette, int entries, const uint32_t *panel_rgb, int panel_colors, uint8_t *map,
+           int *inexact);
+
+private:
+  void init();
+
+  PaletteMapRtc &rtc;
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PHASE_TIMER_MAX 12 // phases kept per wake; begin() returns -1 after that
+
+/** One timed phase of a wake, in ms of the timer's clock */
+struct Phase
+{
+  const char *name; // not copied: a string literal
+  uint32_t start_ms;
+  uint32_t end_ms;
+  bool open; // end() not called yet; counts up to now
+};
+
+/**
+ * Times the phases of a wake (download, panel refresh, log upload, WiFi teardown...)
+ * and how long they ran at the same time.
+ *
+ * The panel refresh runs on its own once it is started, so the work done until it is
+ * joined is free as far as the wake time goes. summary() shows, for each phase, how
+ * much of it overlapped a given one (normally the refresh).
+ */
+class PhaseTimer
+{
+public:
+  /** @param now_ms clock in ms, allowed to wrap (millis() on the device) */
+  explicit PhaseTimer(uint32_t (*now_ms)());
+
+  /** @return id of the new phase for end(), -1 if there is no room left */
+  int begin(const char *name);
+
+  /** @brief Ends a phase; ignores -1 and phases already ended */
+  void end(int id);
+
+  /** @return id of the last phase with that name, -1 if there is none */
+  int find(const char *name) const;
+
+  int count() const { return phase_count; }
+
+  /** @return the phase, nullptr for an unknown id */
+  const Phase *get(int id) const;
+
+  /** @return length of the phase so far, 0 for an unknown id */
+  uint32_t durationMs(int id) const;
+
+  /** @return ms during which both phases were running */
+  uint32_t overlapMs(int a, int b) const;
+
+  /**
+   * @brief Writes one entry per phase, in the order they began, e.g.
+   *        "refresh 3180 ms; logs 420 ms (420 overlapped); wifi off 230 ms (230 overlapped)"
+   *        The overlap is given against the phase named by against, when there is one.
+   * @return length written, without the terminating 0 (the text is cut to fit size)
+   */
+  size_t summary(const char *against, char *out, size_t size) const;
+
+  /** @brief Forgets all phases */
+  void reset() { phase_count = 0; }
+
+private:
+  uint32_t endOf(const Phase &phase, uint32_t now) const;
+
+  uint32_t (*now_ms)();
+  Phase phases[PHASE_TIMER_MAX];
+  int phase_count;
+};
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stdint.h>
+
+enum dither_mode_e
+{
+  DITHER_NONE,            // threshold every pixel on its own
+  DITHER_FLOYD_STEINBERG, // all of the error to 4 neighbors, smoothest gradients
+  DITHER_ATKINSON         // 3/4 of the error to 6 neighbors, more contrast, less noise in flat areas
+};
+
+/**
+ * @brief Converts a row of PNG pixels of any type and depth to 8-bit gray
+ * Color is weighted (r + 2g + b) / 4, indexed pixels go through the palette and
+ * alpha is ignored.
+ * @param iSrcBpp bits per sample, as in PNGDRAW::iBpp
+ */
+void png_row_to_gray(int iPixelType, const uint8_t *pPalette, const uint8_t *pSrc, uint8_t *pGray, int w, int iSrcBpp);
+
+/**
+ * Error diffusion for images drawn one row at a time, as PNGdec hands them to png_draw().
+ *
+ * Only the error carried into the next rows is kept (two rows for Floyd-Steinberg and
+ * three for Atkinson, 16-bit fixed point), so no framebuffer is needed. Rows must be
+ * passed in order, top to bottom; begin() starts a new image.
+ */
+class RowDither
+{
+public:
+  RowDither();
+  ~RowDither();
+
+  /**
+   * @brief Prepares for an image
+   * @return false if there isn't enough memory for the error rows; rows are thresholded then
+   */
+  bool begin(int width, dither_mode_e mode);
+
+  /** @brief Frees the error rows; rows are thresholded until the next begin() */
+  void end();
+
+  dither_mode_e mode() const { return errors ? diffusion : DITHER_NONE; }
+
+  /**
+   * @brief Reduces the next row of 8-bit gray to iDestBpp (1 or 2), packed MSB first
+   * 1-bpp output is 1 for white, 2-bpp output is inverted (0 for white) for the 4-gray
+   * planes, as ReduceBpp() always did.
+   */
+  void reduce(const uint8_t *pGray, uint8_t *pDest, int w, int iDestBpp);
+
+  /**
+   * @brief Reduces pixels x0 to x0 + n - 1 of the current row, for rows converted in pieces
+   * @param pDest byte holding pixel x0; x0 must be a multiple of 8
+   */
+  void reduceSpan(const uint8_t *pGray, uint8_t *pDest, int x0, int n, int iDestBpp);
+
+  /** @brief Moves on to the next row after reduceSpan() covered the current one */
+  void nextRow();
+
+private:
+  int16_t *errors; // 3 rows of width + 4: current, next, the one after (Atkinson)
+  int width;
+  dither_mode_e diffusion;
+  int row;
+};
+
+/**
+ * @brief ReduceBpp() for a whole row: gray conversion, then dithering or thresholding
+ * @param dither error diffusion state, or nullptr to threshold
+ */
+void png_reduce_row(int iDestBpp, int iPixelType, const uint8_t *pPalette, const uint8_t *pSrc, uint8_t *pDest, int w, int iSrcBpp, RowDither *dither);
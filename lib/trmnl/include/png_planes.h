@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdint.h>
+
+/** Which bit of each 2-bit pixel ends up in the 1-bit output */
+enum two_bit_plane_e
+{
+  TWO_BIT_PLANE_0, // low bit: plane 0 (black/white) of 3-color and 4-gray panels
+  TWO_BIT_PLANE_1, // high bit: plane 1 (red) of 3-color and 4-gray panels
+  TWO_BIT_NONZERO  // set for any pixel that isn't 0: 2-color images shown on a 1-bit panel
+};
+
+/**
+ * @brief Converts a row of 2-bpp pixels to 1-bpp, 8 pixels per output byte, MSB first
+ * @param src 2-bpp pixels, 4 per byte
+ * @param dst (width + 7) / 8 bytes; may be src, the output never overtakes the input
+ * @param invert XORed into every source byte before the conversion (0x00 or 0xff)
+ */
+void two_bit_to_one_bit(const uint8_t *src, uint8_t *dst, int width, uint8_t invert, two_bit_plane_e plane);
+
+/**
+ * @brief XORs a row of bytes with invert, a 32-bit word at a time
+ * @param dst may be src
+ */
+void invert_row(const uint8_t *src, uint8_t *dst, int len, uint8_t invert);
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Transposes an 8x8 block of 1-bpp pixels
+ * Row r of the block is src[r * src_stride], its leftmost pixel in bit 7. dst[c * dst_stride]
+ * receives column c, the pixel of row 0 in bit 7.
+ */
+void transpose8x8(const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride);
+
+/**
+ * @brief Receives the panel column stripe made from 8 image rows
+ * @param x leftmost panel column of the stripe, a multiple of 8
+ * @param column len bytes, one per panel row from the top, 8 pixels each, MSB on the left
+ * @return false to stop decoding
+ */
+typedef bool (*png_rotate_write_t)(void *ctx, int x, const uint8_t *column, int len);
+
+/**
+ * Rotates a portrait image onto a landscape panel as its rows are decoded, by 90 degrees
+ * counterclockwise (the top of the image on the left of the panel), as FastEPD's png_draw() does.
+ *
+ * Image row y becomes panel column y, so 8 rows make one byte-wide column stripe: they are
+ * buffered, transposed 8x8 pixels at a time and handed over as one stripe per 8 rows.
+ * Only 8 rows and one column are kept, no framebuffer.
+ */
+class PngRowRotator
+{
+public:
+  PngRowRotator();
+  ~PngRowRotator();
+
+  /**
+   * @brief Starts an image of width x height 1-bpp pixels (the panel is height x width)
+   * @param pad byte for the rows missing from the last stripe when height isn't a multiple of 8
+   * @return false if there isn't enough memory
+   */
+  bool begin(int width, int height, png_rotate_write_t write, void *ctx, uint8_t pad = 0xff);
+
+  void end();
+
+  bool active() const { return rows != nullptr; }
+
+  /**
+   * @brief Adds the next image row, (width + 7) / 8 bytes
+   * @return false if writing a stripe failed
+   */
+  bool addRow(const uint8_t *row);
+
+  /** @brief Sends the last stripe if it has fewer than 8 rows */
+  bool flush();
+
+private:
+  bool writeStripe();
+
+  int width, height, pitch;
+  png_rotate_write_t write;
+  void *ctx;
+  uint8_t pad;
+  uint8_t *rows;   // 8 rows of pitch bytes
+  uint8_t *column; // one byte per panel row
+  int y;           // image rows received
+};
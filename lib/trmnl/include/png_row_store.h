@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <PNGdec.h>
+
+/** Rows below this are left out of the color count: the icon in the lower left corner would always add a color */
+#define PNG_COUNT_COLORS_MAX_Y 430
+
+/**
+ * @brief Sets bits 0-3 for each of the 2-bit values 0-3 present in a row of 2-bpp pixels
+ * @param flags bits already set by previous rows
+ */
+uint8_t png_two_bit_color_flags(const uint8_t *pixels, int width, uint8_t flags);
+
+/** @return number of bits set in flags from png_two_bit_color_flags() */
+int png_two_bit_color_count(uint8_t flags);
+
+/**
+ * Keeps the decoded rows of a PNG so they can be sent to the panel once the whole image
+ * has been seen, as many times as the panel needs (e.g. once per plane).
+ *
+ * Deciding how to show a 2-bpp image needs the number of colors in it, which used to
+ * take a decode pass of its own before the passes that drew each plane. With the rows
+ * kept here, one decode counts the colors and every plane is drawn from memory.
+ */
+class PngRowStore
+{
+public:
+  PngRowStore();
+  ~PngRowStore();
+
+  /**
+   * @brief Allocates room for all rows of the image
+   * @return false if there isn't enough memory; the caller decodes the old way then
+   */
+  bool begin(int width, int height, int bpp);
+
+  /** @brief Frees the rows */
+  void end();
+
+  /** @return true once every row of the image was stored */
+  bool complete() const { return rows != nullptr && stored == height; }
+
+  /**
+   * @brief Copies a decoded row, and updates the color flags for 2-bpp images
+   * @return false if the row doesn't fit the size given to begin()
+   */
+  bool addRow(PNGDRAW *pDraw);
+
+  /** @return number of distinct 2-bit values in the image (2-bpp only) */
+  int colorCount() const { return png_two_bit_color_count(flags); }
+
+  /**
+   * @brief Calls draw for every stored row, as PNGdec would have during a decode
+   * @return false if draw asked to stop
+   */
+  bool replay(PNG_DRAW_CALLBACK *draw, void *pUser);
+
+  /** @return size of the row buffer, 0 if none is allocated */
+  size_t size() const { return rows ? (size_t)pitch * height : 0; }
+
+private:
+  uint8_t *rows;
+  int width;
+  int height;
+  int bpp;
+  int pitch;
+  int stored;
+  uint8_t flags;
+  PNGDRAW info; // everything about the rows but y and pPixels, for replay()
+};
+
+/** @brief PNGdec draw callback for decoding into a store; pass the store as pUser */
+int png_row_store_draw(PNGDRAW *pDraw);
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <PNGdec.h>
+#include <http_body_reader.h>
+#include <palette_map.h>
+
+/** Bytes of already-read data kept for the short backward seeks PNGdec does between chunks */
+#define PNG_STREAM_REWIND_SIZE 1024
+
+typedef void (*png_stream_tee_t)(void *ctx, const uint8_t *data, size_t len);
+
+/**
+ * Presents an HTTP response body to PNGdec as a seekable file, so the image can be decoded
+ * (and pushed to the panel) while the rest of it is still being downloaded.
+ *
+ * PNGdec only ever seeks forward or a few bytes back, so a small rewind window is enough;
+ * forward seeks are served by reading and discarding. Every byte pulled from the network
+ * can be forwarded to a tee (e.g. to keep a copy of the image in flash).
+ */
+class PngStreamSource
+{
+public:
+  /**
+   * @param reader body reader positioned at the first byte of the PNG
+   * @param max_size upper bound for the image size, reported to PNGdec when Content-Length is unknown
+   */
+  PngStreamSource(HttpBodyReader &reader, int32_t max_size);
+  ~PngStreamSource();
+
+  void setTee(png_stream_tee_t tee, void *ctx);
+
+  int32_t read(uint8_t *dst, int32_t len);
+
+  /** @return new position, or -1 if the position fell out of the rewind window */
+  int32_t seek(int32_t position);
+
+  int32_t position() const { return (int32_t)pos; }
+
+  /** @return file size to report to PNGdec */
+  int32_t size() const;
+
+  /** @return true if a seek could not be served or the body reader failed */
+  bool failed() const;
+
+  /**
+   * @brief Copies everything read so far plus the rest of the body into buf.
+   * Used to fall back to in-memory decoding after only the header was inspected.
+   * @param received total size of the image stored in buf
+   */
+  body_read_err_e bufferAll(uint8_t *buf, size_t capacity, size_t *received);
+
+  /**
+   * @brief Reads (and tees) whatever is left of the body after decoding, e.g. the IEND CRC.
+   * @return number of bytes drained
+   */
+  size_t finish();
+
+  /** @return number of body bytes pulled from the network so far */
+  size_t bytesReceived() const { return stream_pos; }
+
+  /** @return number of entries of the PLTE chunk once it went by, 0 before that or without one */
+  int paletteEntries() const { return palette.entries(); }
+
+private:
+  size_t pull(uint8_t *dst, size_t len);
+
+  HttpBodyReader &reader;
+  int32_t max_size;
+  uint8_t *window;
+  size_t stream_pos; // bytes pulled from the reader
+  size_t pos;        // logical read position
+  bool seek_failed;
+  png_stream_tee_t tee;
+  void *tee_ctx;
+  PngPaletteScanner palette;
+};
+
+/**
+ * PNGdec file callbacks for PngStreamSource.
+ * Pass the source pointer as the file name: png.open((const char *)&source, png_stream_open, ...)
+ */
+void *png_stream_open(const char *szFilename, int32_t *pFileSize);
+void png_stream_close(void *pHandle);
+int32_t png_stream_read(PNGFILE *pFile, uint8_t *pBuf, int32_t iLen);
+int32_t png_stream_seek(PNGFILE *pFile, int32_t iPosition);
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <image_validators.h>
+
+#define PARTIAL_DOWNLOAD_MAGIC 0x50415254 // "PART"
+
+/** What is known about the body stored next to it, enough to ask for the rest */
+struct PartialDownloadMeta
+{
+  uint32_t magic;
+  uint32_t url_hash;
+  uint32_t total;                // full length of the body
+  char etag[IMAGE_ETAG_MAX_LEN]; // strong ETag of the body, sent as If-Range
+};
+
+/**
+ * Storage for an interrupted download: the first bytes of the body and their metadata.
+ * Implemented over SPIFFS on the device and in memory in the tests.
+ */
+class PartialDownloadStore
+{
+public:
+  virtual ~PartialDownloadStore() {}
+
+  virtual bool readMeta(PartialDownloadMeta &meta) = 0;
+  virtual bool writeMeta(const PartialDownloadMeta &meta) = 0;
+
+  /** @return number of body bytes stored */
+  virtual size_t bodySize() = 0;
+  virtual bool readBody(uint8_t *buf, size_t len) = 0;
+  /** @brief Replaces the stored body */
+  virtual bool writeBody(const uint8_t *data, size_t len) = 0;
+
+  /** @brief Removes body and metadata */
+  virtual void remove() = 0;
+};
+
+enum resume_decision_e
+{
+  RESUME_NONE,     // no Range was sent or the server sent the whole body: read it from the start
+  RESUME_CONTINUE, // 206 that continues the stored bytes
+  RESUME_MISMATCH  // 206/416 that doesn't fit what is stored; the stored bytes were dropped
+};
+
+/**
+ * Continues image downloads that were cut off (e.g. on weak WiFi) on the next attempt,
+ * instead of fetching the whole body again.
+ *
+ * When a download fails, the bytes received so far are kept together with the ETag and
+ * length of the body. The next request for the same URL asks for the rest with
+ * "Range: bytes=N-" and "If-Range: <etag>", so a server whose image changed in the
+ * meantime answers with the full new body (200) and the stored bytes are dropped.
+ * Only strong ETags can be used with If-Range, so bodies without one are never kept.
+ */
+class ResumableDownload
+{
+public:
+  ResumableDownload(PartialDownloadStore &store);
+
+  /**
+   * @brief Checks for stored bytes of url
+   * @param etag set to the If-Range value when there is something to resume
+   * @return number of bytes to ask for with Range, 0 to download from the start
+   */
+  size_t prepare(const char *url, String &etag);
+
+  /**
+   * @brief Decides what to do with the answer to a request made after prepare()
+   * @param content_range value of the Content-Range header ("" if none)
+   */
+  resume_decision_e onResponse(int http_code, const char *content_range);
+
+  /** @return full body length of the response accepted with RESUME_CONTINUE */
+  size_t total() const { return meta.total; }
+
+  /** @brief Copies the stored bytes (as many as prepare() returned) in front of the rest */
+  bool restore(uint8_t *buf, size_t capacity);
+
+  /**
+   * @brief Keeps the bytes of a download that failed, so the next attempt can continue
+   * @param data received bytes, or nullptr if the caller already wrote them to the store
+   * @return false if the download can't be resumed (no strong ETag, length unknown, nothing received)
+   */
+  bool keep(const char *url, const String &etag, size_t total, const uint8_t *data, size_t received);
+
+  /** @brief Drops the stored bytes, e.g. once the download completed */
+  void discard();
+
+private:
+  PartialDownloadStore &store;
+  PartialDownloadMeta meta;
+  size_t offset;
+};
+
+/**
+ * @brief Parses "bytes first-last/total"
+ * @return false if the value is not a satisfied byte range with a known total
+ */
+bool parse_content_range(const char *value, uint32_t *first, uint32_t *last, uint32_t *total);
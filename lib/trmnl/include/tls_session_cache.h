@@ -0,0 +1,77 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define TLS_SESSION_CACHE_MAGIC 0x544c5353 // "TLSS"
+#define TLS_SESSION_CACHE_ENTRIES 3        // API host, image host and one spare
+#define TLS_SESSION_MAX_SIZE 512           // serialized session without the peer certificate
+#define TLS_SESSION_MAX_AGE_S 7200         // upper bound when the server doesn't give a ticket lifetime
+
+struct TlsSessionEntry
+{
+  uint32_t host_hash; // 0 = free slot
+  uint32_t saved_at;
+  uint32_t expires_at;
+  uint16_t size;
+  uint8_t data[TLS_SESSION_MAX_SIZE];
+};
+
+struct TlsHandshakeStats
+{
+  uint32_t count;
+  uint32_t total_ms;
+};
+
+/**
+ * Cache contents, meant to live in RTC memory (RTC_DATA_ATTR) so that sessions
+ * survive deep sleep. A zero-initialized struct is an empty cache.
+ */
+struct TlsSessionCacheRtc
+{
+  uint32_t magic;
+  TlsSessionEntry entries[TLS_SESSION_CACHE_ENTRIES];
+  TlsHandshakeStats full;
+  TlsHandshakeStats resumed;
+};
+
+/**
+ * Per-host store of serialized TLS sessions (session ID or ticket), so the next
+ * connection to the same host can do an abbreviated handshake.
+ * The TLS library specific part (serializing, offering the session) is done by the caller.
+ */
+class TlsSessionCache
+{
+public:
+  /**
+   * @param rtc storage for the cache
+   * @param now_s wall clock in seconds; entries saved "in the future" are treated as expired
+   */
+  TlsSessionCache(TlsSessionCacheRtc &rtc, uint32_t (*now_s)());
+
+  /** @return session saved for host, or nullptr if there is none or it expired */
+  const TlsSessionEntry *find(const char *host);
+
+  /**
+   * @brief Saves a session for host, replacing the previous one
+   * @param lifetime_s how long the server will accept it; capped at TLS_SESSION_MAX_AGE_S
+   * @return false if the session is too big to be cached
+   */
+  bool store(const char *host, const uint8_t *data, size_t size, uint32_t lifetime_s);
+
+  /** @brief Drops the session for host, e.g. after a failed resumption */
+  void forget(const char *host);
+
+  /** @brief Accounts a completed handshake, for comparing resumed and full handshake times */
+  void recordHandshake(bool resumed, uint32_t ms);
+
+  const TlsHandshakeStats &fullStats() const { return rtc.full; }
+  const TlsHandshakeStats &resumedStats() const { return rtc.resumed; }
+
+private:
+  void init();
+  bool expired(const TlsSessionEntry &entry, uint32_t now) const;
+
+  TlsSessionCacheRtc &rtc;
+  uint32_t (*now_s)();
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <stdint.h>
+
+#define WALL_CLOCK_MAGIC 0x57434c4b     // "WCLK"
+#define WALL_CLOCK_MAX_DRIFT_PPM 100000 // samples beyond 10% are glitches (e.g. the clock was set by hand), not drift
+
+/**
+ * Clock state, meant to live in RTC memory (RTC_DATA_ATTR) so it survives deep sleep.
+ * A zero-initialized struct is a clock that was never synced.
+ */
+struct WallClockRtc
+{
+  uint32_t magic;
+  uint8_t synced;
+  uint8_t samples;           // drift measurements so far
+  uint16_t wakes_since_sync;
+  int32_t drift_ppm;         // how much the local clock falls behind real time; positive = too slow
+  int32_t uncertainty_ppm;   // how far drift_ppm may be off
+  int32_t last_error_ms;     // corrected time minus real time at the last sync; negative = was behind
+  int64_t synced_at_ms;      // local clock at the last sync (SNTP set it to the real time then)
+};
+
+struct WallClockOptions
+{
+  /** local clock in ms since the epoch; keeps counting in deep sleep (gettimeofday() on the device) */
+  int64_t (*local_ms)();
+  /** sync at least this often, whatever the estimated error */
+  uint16_t sync_every_wakes;
+  /** sync as soon as the estimated error could be larger than this */
+  uint32_t max_error_ms;
+  /** syncs closer together than this don't update the drift estimate: they are mostly rounding */
+  uint32_t min_sample_ms;
+  /** uncertainty assumed before the first drift measurement */
+  int32_t initial_uncertainty_ppm;
+  /** the estimate never gets more trusted than this */
+  int32_t min_uncertainty_ppm;
+};
+
+/**
+ * Wall clock kept between network time syncs.
+ *
+ * The local clock keeps counting through deep sleep but drifts. Every sync measures
+ * how far it drifted since the previous one, which gives a drift rate that is used to
+ * correct the local clock until the next sync, and an uncertainty of that rate. A new
+ * sync is due every sync_every_wakes wakes, or sooner when the uncertainty times the
+ * time since the last sync exceeds max_error_ms.
+ *
+ * Nothing here waits for the network: the caller starts a sync when needed() says so,
+ * keeps working, and reports the result with onSync() whenever it arrives.
+ */
+class WallClock
+{
+public:
+  WallClock(WallClockRtc &rtc, const WallClockOptions &options);
+
+  /** @brief Counts a wake; call once per boot */
+  void wake();
+
+  /** @return true if a sync should be started on this wake */
+  bool syncNeeded();
+
+  /** @return corrected time in ms since the epoch, 0 if the time is unknown */
+  int64_t nowMs();
+
+  /**
+   * @brief Records a completed sync
+   * @param local_before_ms local clock just before it was set to the synced time
+   * @param synced_ms time received from the server
+   */
+  void onSync(int64_t local_before_ms, int64_t synced_ms);
+
+  /** @return upper bound of the error of nowMs(), -1 if the time is unknown */
+  int64_t estimatedErrorMs();
+
+  int32_t driftPpm() const { return rtc.drift_ppm; }
+  int32_t lastErrorMs() const { return rtc.last_error_ms; }
+  uint16_t wakesSinceSync() const { return rtc.wakes_since_sync; }
+
+private:
+  void init();
+  bool valid(int64_t local);
+  int64_t corrected(int64_t local);
+
+  WallClockRtc &rtc;
+  WallClockOptions options;
+};
@@ -0,0 +1,56 @@
+#include <connection_pool.h>
+#include <stdlib.h>
+#include <strings.h>
+
+bool url_origin(const char *url, UrlOrigin &origin)
+{
+  const char *p;
+  if (strncasecmp(url, "https://", 8) == 0)
+  {
+    origin.secure = true;
+    origin.port = 443;
+    p = url + 8;
+  }
+  else if (strncasecmp(url, "http://", 7) == 0)
+  {
+    origin.secure = false;
+    origin.port = 80;
+    p = url + 7;
+  }
+  else
+  {
+    return false;
+  }
+
+  // skip credentials
+  const char *end = p + strcspn(p, "/?#");
+  const char *at = (const char *)memchr(p, '@', end - p);
+  if (at != nullptr)
+    p = at + 1;
+
+  size_t host_len = strcspn(p, ":/?#");
+  if (host_len == 0 || host_len > URL_HOST_MAX_LEN)
+    return false;
+
+  for (size_t i = 0; i < host_len; i++)
+  {
+    char c = p[i];
+    origin.host[i] = (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  }
+  origin.host[host_len] = 0;
+
+  if (p[host_len] == ':')
+  {
+    char *port_end;
+    long port = strtol(p + host_len + 1, &port_end, 10);
+    if (port <= 0 || port > 65535 || (*port_end != 0 && strchr("/?#", *port_end) == nullptr))
+      return false;
+    origin.port = (uint16_t)port;
+  }
+  return true;
+}
+
+bool same_origin(const UrlOrigin &a, const UrlOrigin &b)
+{
+  return a.secure == b.secure && a.port == b.port && strcmp(a.host, b.host) == 0;
+}
@@ -0,0 +1,62 @@
+#include <display_envelope.h>
+#include <string.h>
+#include <trmnl_log.h>
+
+static uint32_t read_le32(const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+bool is_display_envelope(const char *content_type)
+{
+  // parameters (e.g. "; charset=binary") don't matter
+  size_t len = strlen(DISPLAY_ENVELOPE_CONTENT_TYPE);
+  return strncmp(content_type, DISPLAY_ENVELOPE_CONTENT_TYPE, len) == 0 &&
+         (content_type[len] == 0 || content_type[len] == ';' || content_type[len] == ' ');
+}
+
+bool parse_display_envelope_header(const uint8_t *data, size_t len, DisplayEnvelopeHeader *out)
+{
+  if (len < DISPLAY_ENVELOPE_HEADER_SIZE || memcmp(data, DISPLAY_ENVELOPE_MAGIC, 4) != 0)
+    return false;
+
+  out->version = data[4];
+  out->image_type = data[5];
+  out->metadata_length = read_le32(data + 8);
+  out->image_length = read_le32(data + 12);
+
+  if (out->version != DISPLAY_ENVELOPE_VERSION || out->image_type > ENVELOPE_IMAGE_JPEG)
+    return false;
+  return out->metadata_length > 0 && out->metadata_length <= DISPLAY_ENVELOPE_MAX_METADATA;
+}
+
+display_envelope_err_e read_display_envelope(HttpBodyReader &body, JsonArena &arena, DisplayEnvelopeHeader *header, ApiDisplayResponse *response)
+{
+  uint8_t raw[DISPLAY_ENVELOPE_HEADER_SIZE];
+  if (body.read(raw, sizeof(raw)) < sizeof(raw))
+  {
+    Log_error("Envelope ended in its header (%d)", body.error());
+    return ENVELOPE_TRUNCATED;
+  }
+  if (!parse_display_envelope_header(raw, sizeof(raw), header))
+  {
+    Log_error("Invalid envelope header");
+    return ENVELOPE_BAD_HEADER;
+  }
+
+  HttpBodyStream metadata(body, header->metadata_length);
+  *response = parseResponse_apiDisplay(metadata, arena);
+  // the parser stops at the closing brace, the image starts after the last metadata byte
+  bool complete = metadata.finish();
+
+  if (!complete)
+  {
+    Log_error("Envelope ended in its metadata (%d)", body.error());
+    return ENVELOPE_TRUNCATED;
+  }
+  if (response->outcome != ApiDisplayOutcome::Ok)
+    return ENVELOPE_BAD_METADATA;
+
+  Log_info("Envelope: %d bytes of metadata, image type %d of %d bytes", header->metadata_length, header->image_type, header->image_length);
+  return ENVELOPE_OK;
+}
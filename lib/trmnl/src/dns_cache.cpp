@@ -0,0 +1,190 @@
+#include <dns_cache.h>
+#include <string.h>
+#include <trmnl_log.h>
+
+static uint32_t host_hash(const char *host)
+{
+  uint32_t hash = 2166136261u;
+  for (const char *p = host; *p; p++)
+  {
+    char c = (*p >= 'A' && *p <= 'Z') ? *p - 'A' + 'a' : *p;
+    hash ^= (uint8_t)c;
+    hash *= 16777619u;
+  }
+  return hash == 0 ? 1 : hash;
+}
+
+DnsCache::DnsCache(DnsCacheRtc &rtc, DnsResolver &resolver, const DnsCacheOptions &options)
+    : rtc(rtc), resolver(resolver), options(options)
+{
+  memset(pending, 0, sizeof(pending));
+}
+
+void DnsCache::init()
+{
+  if (rtc.magic != DNS_CACHE_MAGIC)
+  {
+    memset(&rtc, 0, sizeof(rtc));
+    rtc.magic = DNS_CACHE_MAGIC;
+  }
+}
+
+DnsCacheEntry *DnsCache::find(const char *host)
+{
+  uint32_t hash = host_hash(host);
+  for (int i = 0; i < DNS_CACHE_ENTRIES; i++)
+  {
+    if (rtc.entries[i].host_hash == hash)
+      return &rtc.entries[i];
+  }
+  return nullptr;
+}
+
+void DnsCache::store(const char *host, uint32_t address, uint32_t ttl_s)
+{
+  if (ttl_s < DNS_CACHE_MIN_TTL_S)
+    ttl_s = DNS_CACHE_MIN_TTL_S;
+  if (ttl_s > DNS_CACHE_MAX_TTL_S)
+    ttl_s = DNS_CACHE_MAX_TTL_S;
+
+  DnsCacheEntry *entry = find(host);
+  for (int i = 0; i < DNS_CACHE_ENTRIES && entry == nullptr; i++)
+  {
+    if (rtc.entries[i].host_hash == 0)
+      entry = &rtc.entries[i];
+  }
+  if (entry == nullptr)
+  {
+    // replace the entry that expires first
+    entry = &rtc.entries[0];
+    for (int i = 1; i < DNS_CACHE_ENTRIES; i++)
+    {
+      if (rtc.entries[i].expires_at < entry->expires_at)
+        entry = &rtc.entries[i];
+    }
+  }
+
+  uint32_t now = options.now_s();
+  entry->host_hash = host_hash(host);
+  entry->address = address;
+  entry->resolved_at = now;
+  entry->expires_at = now + ttl_s;
+}
+
+void DnsCache::startRefresh(const char *host)
+{
+  if (strlen(host) >= DNS_CACHE_HOST_MAX_LEN)
+    return;
+
+  int free_slot = -1;
+  for (int i = 0; i < DNS_CACHE_ENTRIES; i++)
+  {
+    if (strcmp(pending[i], host) == 0)
+      return; // already on its way
+    if (pending[i][0] == 0 && free_slot < 0)
+      free_slot = i;
+  }
+  if (free_slot < 0 || !resolver.start(host))
+    return;
+
+  strcpy(pending[free_slot], host);
+  Log_info_serial("DNS: refreshing %s in the background", host);
+}
+
+void DnsCache::dropPending(const char *host)
+{
+  for (int i = 0; i < DNS_CACHE_ENTRIES; i++)
+  {
+    if (strcmp(pending[i], host) == 0)
+      pending[i][0] = 0;
+  }
+}
+
+void DnsCache::poll()
+{
+  init();
+  for (int i = 0; i < DNS_CACHE_ENTRIES; i++)
+  {
+    if (pending[i][0] == 0)
+      continue;
+
+    uint32_t address, ttl;
+    dns_query_state_e state = resolver.poll(pending[i], &address, &ttl);
+    if (state == DNS_QUERY_PENDING)
+      continue;
+    if (state == DNS_QUERY_DONE)
+      store(pending[i], address, ttl);
+    else
+      Log_info_serial("DNS: background refresh of %s failed, keeping the old address", pending[i]);
+    pending[i][0] = 0;
+  }
+}
+
+bool DnsCache::resolve(const char *host, uint32_t *address)
+{
+  poll();
+
+  uint32_t now = options.now_s();
+  DnsCacheEntry *entry = find(host);
+  if (entry != nullptr)
+  {
+    if (now >= entry->resolved_at && now < entry->expires_at)
+    {
+      *address = entry->address;
+      return true;
+    }
+
+    // expired (or the clock was set back): use it anyway while a fresh answer is fetched
+    if (now < entry->resolved_at || now - entry->expires_at < DNS_CACHE_MAX_STALE_S)
+    {
+      startRefresh(host);
+      *address = entry->address;
+      return true;
+    }
+  }
+
+  // nothing usable, the caller has to wait
+  dropPending(host);
+  for (uint8_t attempt = 1; attempt <= options.attempts; attempt++)
+  {
+    uint32_t start = options.now_ms();
+    if (resolver.start(host))
+    {
+      while (options.now_ms() - start < options.timeout_ms)
+      {
+        uint32_t ttl;
+        dns_query_state_e state = resolver.poll(host, address, &ttl);
+        if (state == DNS_QUERY_DONE)
+        {
+          store(host, *address, ttl);
+          return true;
+        }
+        if (state == DNS_QUERY_FAILED)
+          break;
+        options.wait();
+      }
+    }
+    Log_error("DNS: failed to resolve %s on attempt %d", host, attempt);
+
+    // a quick failure usually means the network isn't up yet: space the attempts out
+    while (attempt < options.attempts && options.now_ms() - start < options.timeout_ms)
+      options.wait();
+  }
+  return false;
+}
+
+void DnsCache::forget(const char *host)
+{
+  init();
+  DnsCacheEntry *entry = find(host);
+  if (entry != nullptr)
+    entry->host_hash = 0;
+}
+
+int DnsCache::pendingRefreshes() const
+{
+  int n = 0;
+  for (int i = 0; i < DNS_CACHE_ENTRIES; i++)
+    n += pending[i][0] != 0;
+  return n;
+}
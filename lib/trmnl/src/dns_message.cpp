@@ -0,0 +1,138 @@
+#include <dns_message.h>
+#include <string.h>
+
+#define DNS_HEADER_SIZE 12
+#define DNS_TYPE_A 1
+#define DNS_TYPE_CNAME 5
+#define DNS_CLASS_IN 1
+
+#define DNS_FLAG_QR 0x8000
+#define DNS_FLAG_TC 0x0200
+#define DNS_FLAG_RD 0x0100
+#define DNS_RCODE_MASK 0x000f
+#define DNS_RCODE_NXDOMAIN 3
+
+static uint16_t read16(const uint8_t *p)
+{
+  return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static uint32_t read32(const uint8_t *p)
+{
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static void write16(uint8_t *p, uint16_t value)
+{
+  p[0] = value >> 8;
+  p[1] = value & 0xff;
+}
+
+size_t dns_build_query(uint8_t *buf, size_t size, uint16_t id, const char *host)
+{
+  size_t host_len = strlen(host);
+  // labels plus the root label; a trailing dot is allowed
+  if (host_len > 0 && host[host_len - 1] == '.')
+    host_len--;
+  if (host_len == 0 || host_len > 253 || DNS_HEADER_SIZE + host_len + 2 + 4 > size)
+    return 0;
+
+  memset(buf, 0, DNS_HEADER_SIZE);
+  write16(buf, id);
+  write16(buf + 2, DNS_FLAG_RD);
+  write16(buf + 4, 1); // one question
+
+  size_t pos = DNS_HEADER_SIZE;
+  const char *label = host;
+  const char *end = host + host_len;
+  while (label < end)
+  {
+    const char *dot = (const char *)memchr(label, '.', end - label);
+    size_t label_len = (dot ? dot : end) - label;
+    if (label_len == 0 || label_len > 63)
+      return 0;
+    buf[pos++] = (uint8_t)label_len;
+    memcpy(buf + pos, label, label_len);
+    pos += label_len;
+    label += label_len + 1;
+  }
+  buf[pos++] = 0;
+
+  write16(buf + pos, DNS_TYPE_A);
+  write16(buf + pos + 2, DNS_CLASS_IN);
+  return pos + 4;
+}
+
+/** @return offset just past the (possibly compressed) name at pos, 0 if malformed */
+static size_t skip_name(const uint8_t *msg, size_t len, size_t pos)
+{
+  while (pos < len)
+  {
+    uint8_t b = msg[pos];
+    if (b == 0)
+      return pos + 1;
+    if ((b & 0xc0) == 0xc0)
+      return pos + 2 <= len ? pos + 2 : 0;
+    if (b & 0xc0)
+      return 0;
+    pos += 1 + b;
+  }
+  return 0;
+}
+
+dns_parse_err_e dns_parse_response(const uint8_t *msg, size_t len, uint16_t id, uint32_t *address, uint32_t *ttl_s)
+{
+  if (len < DNS_HEADER_SIZE)
+    return DNS_PARSE_MALFORMED;
+  if (read16(msg) != id)
+    return DNS_PARSE_WRONG_ID;
+
+  uint16_t flags = read16(msg + 2);
+  if (!(flags & DNS_FLAG_QR) || (flags & DNS_FLAG_TC))
+    return DNS_PARSE_MALFORMED;
+  if ((flags & DNS_RCODE_MASK) == DNS_RCODE_NXDOMAIN)
+    return DNS_PARSE_NXDOMAIN;
+  if ((flags & DNS_RCODE_MASK) != 0)
+    return DNS_PARSE_SERVER_ERROR;
+
+  uint16_t questions = read16(msg + 4);
+  uint16_t answers = read16(msg + 6);
+  size_t pos = DNS_HEADER_SIZE;
+
+  for (uint16_t i = 0; i < questions; i++)
+  {
+    pos = skip_name(msg, len, pos);
+    if (pos == 0 || pos + 4 > len)
+      return DNS_PARSE_MALFORMED;
+    pos += 4;
+  }
+
+  uint32_t chain_ttl = UINT32_MAX;
+  for (uint16_t i = 0; i < answers; i++)
+  {
+    pos = skip_name(msg, len, pos);
+    if (pos == 0 || pos + 10 > len)
+      return DNS_PARSE_MALFORMED;
+
+    uint16_t type = read16(msg + pos);
+    uint16_t rclass = read16(msg + pos + 2);
+    uint32_t ttl = read32(msg + pos + 4);
+    uint16_t rdlength = read16(msg + pos + 8);
+    pos += 10;
+    if (pos + rdlength > len)
+      return DNS_PARSE_MALFORMED;
+
+    if (rclass == DNS_CLASS_IN && type == DNS_TYPE_CNAME && ttl < chain_ttl)
+    {
+      chain_ttl = ttl;
+    }
+    else if (rclass == DNS_CLASS_IN && type == DNS_TYPE_A && rdlength == 4)
+    {
+      memcpy(address, msg + pos, 4);
+      *ttl_s = ttl < chain_ttl ? ttl : chain_ttl;
+      return DNS_PARSE_OK;
+    }
+    pos += rdlength;
+  }
+  return DNS_PARSE_NO_ADDRESS;
+}
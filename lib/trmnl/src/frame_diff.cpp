@@ -0,0 +1,241 @@
+#include <frame_diff.h>
+#include <string.h>
+
+/** A box of tiles: columns [c0, c1), bands [b0, b1) */
+struct TileBox
+{
+  int c0, b0, c1, b1;
+};
+
+static int box_area(const TileBox &box)
+{
+  return (box.c1 - box.c0) * (box.b1 - box.b0);
+}
+
+static TileBox box_union(const TileBox &a, const TileBox &b)
+{
+  TileBox box;
+  box.c0 = a.c0 < b.c0 ? a.c0 : b.c0;
+  box.b0 = a.b0 < b.b0 ? a.b0 : b.b0;
+  box.c1 = a.c1 > b.c1 ? a.c1 : b.c1;
+  box.b1 = a.b1 > b.b1 ? a.b1 : b.b1;
+  return box;
+}
+
+static int box_overlap(const TileBox &a, const TileBox &b)
+{
+  int columns = (a.c1 < b.c1 ? a.c1 : b.c1) - (a.c0 > b.c0 ? a.c0 : b.c0);
+  int bands = (a.b1 < b.b1 ? a.b1 : b.b1) - (a.b0 > b.b0 ? a.b0 : b.b0);
+  return (columns > 0 && bands > 0) ? columns * bands : 0;
+}
+
+static int tile_columns(int width)
+{
+  return ((width + 7) / 8 + FRAME_DIFF_TILE_BYTES - 1) / FRAME_DIFF_TILE_BYTES;
+}
+
+static int tile_bands(int height)
+{
+  return (height + FRAME_DIFF_BAND_ROWS - 1) / FRAME_DIFF_BAND_ROWS;
+}
+
+FrameDiff::FrameDiff(FrameDiffRtc &rtc, const FrameDiffOptions &options)
+    : rtc(rtc), options(options), pending_width(0), pending_height(0), has_pending(false), panel_ram_valid(false)
+{
+  if (this->options.max_windows < 1)
+    this->options.max_windows = 1;
+  if (this->options.max_windows > FRAME_DIFF_MAX_WINDOWS)
+    this->options.max_windows = FRAME_DIFF_MAX_WINDOWS;
+}
+
+int FrameDiff::tileCount(int width, int height)
+{
+  if (width <= 0 || height <= 0)
+    return 0;
+  int count = tile_columns(width) * tile_bands(height);
+  return count <= FRAME_DIFF_MAX_TILES ? count : 0;
+}
+
+void FrameDiff::hash(const uint8_t *frame, int width, int height, int pitch)
+{
+  int columns = tile_columns(width), bytes = (width + 7) / 8;
+  uint8_t last_mask = (width & 7) ? (uint8_t)(0xff << (8 - (width & 7))) : 0xff; // padding bits don't count
+  for (int i = 0; i < columns * tile_bands(height); i++)
+    pending[i] = 2166136261u; // FNV-1a
+  for (int y = 0; y < height; y++)
+  {
+    const uint8_t *row = &frame[y * pitch];
+    uint32_t *band = &pending[(y / FRAME_DIFF_BAND_ROWS) * columns];
+    for (int x = 0; x < bytes; x++)
+    {
+      uint8_t value = (x == bytes - 1) ? (row[x] & last_mask) : row[x];
+      uint32_t &h = band[x / FRAME_DIFF_TILE_BYTES];
+      h = (h ^ value) * 16777619u;
+    }
+  }
+}
+
+int FrameDiff::findWindows(const bool *dirty, int columns, int bands, FrameDiffResult &result)
+{
+  TileBox boxes[FRAME_DIFF_MAX_RUNS];
+  int count = 0;
+
+  // runs of changed tiles in each band
+  for (int b = 0; b < bands; b++)
+  {
+    for (int c = 0; c < columns; c++)
+    {
+      if (!dirty[b * columns + c])
+        continue;
+      int end = c;
+      while (end < columns && dirty[b * columns + end])
+        end++;
+      if (count == FRAME_DIFF_MAX_RUNS)
+        return -1; // scattered all over
+      TileBox box = {c, b, end, b + 1};
+      boxes[count++] = box;
+      c = end;
+    }
+  }
+
+  // merge the pair that wastes the fewest unchanged tiles, while that's cheap or there are too many
+  while (count > 1)
+  {
+    int best_a = 0, best_b = 1, best_waste = 0x7fffffff;
+    for (int a = 0; a < count; a++)
+    {
+      for (int b = a + 1; b < count; b++)
+      {
+        int waste = box_area(box_union(boxes[a], boxes[b])) - box_area(boxes[a]) - box_area(boxes[b]) +
+                    box_overlap(boxes[a], boxes[b]);
+        if (waste < best_waste)
+        {
+          best_waste = waste;
+          best_a = a;
+          best_b = b;
+        }
+      }
+    }
+    if (best_waste > options.merge_tiles && count <= options.max_windows)
+      break;
+    boxes[best_a] = box_union(boxes[best_a], boxes[best_b]);
+    boxes[best_b] = boxes[--count];
+  }
+
+  // merged boxes may still overlap (a box grown over another): merge those too, they'd be sent twice
+  for (int a = 0; a < count; a++)
+  {
+    for (int b = a + 1; b < count; b++)
+    {
+      if (box_overlap(boxes[a], boxes[b]))
+      {
+        boxes[a] = box_union(boxes[a], boxes[b]);
+        boxes[b] = boxes[--count];
+        b = a; // look again with the bigger box
+      }
+    }
+  }
+
+  // top to bottom, then left to right
+  for (int a = 1; a < count; a++)
+  {
+    TileBox box = boxes[a];
+    int b = a;
+    while (b > 0 && (boxes[b - 1].b0 > box.b0 || (boxes[b - 1].b0 == box.b0 && boxes[b - 1].c0 > box.c0)))
+    {
+      boxes[b] = boxes[b - 1];
+      b--;
+    }
+    boxes[b] = box;
+  }
+
+  result.window_tiles = 0;
+  for (int i = 0; i < count; i++)
+  {
+    TileBox &box = boxes[i];
+    DirtyWindow &window = result.windows[i];
+    int right = box.c1 * FRAME_DIFF_TILE_BYTES * 8, bottom = box.b1 * FRAME_DIFF_BAND_ROWS;
+    window.x = box.c0 * FRAME_DIFF_TILE_BYTES * 8;
+    window.y = box.b0 * FRAME_DIFF_BAND_ROWS;
+    window.width = (right < pending_width ? right : pending_width) - window.x;
+    window.height = (bottom < pending_height ? bottom : pending_height) - window.y;
+    result.window_tiles += box_area(box);
+  }
+  return count;
+}
+
+frame_diff_e FrameDiff::compare(const uint8_t *frame, int width, int height, int pitch, FrameDiffResult &result)
+{
+  int tiles = tileCount(width, height);
+  memset(&result, 0, sizeof(result));
+  result.kind = FRAME_DIFF_FULL;
+  has_pending = false;
+  if (!frame || tiles == 0 || pitch < (width + 7) / 8)
+    return result.kind;
+
+  hash(frame, width, height, pitch);
+  pending_width = width;
+  pending_height = height;
+  has_pending = true;
+
+  if (rtc.magic != FRAME_DIFF_MAGIC || rtc.width != width || rtc.height != height)
+  {
+    result.dirty_tiles = tiles;
+    result.window_tiles = tiles;
+    return result.kind;
+  }
+
+  bool dirty[FRAME_DIFF_MAX_TILES];
+  for (int i = 0; i < tiles; i++)
+  {
+    dirty[i] = pending[i] != rtc.hashes[i];
+    if (dirty[i])
+      result.dirty_tiles++;
+  }
+  if (result.dirty_tiles == 0)
+  {
+    result.kind = FRAME_DIFF_UNCHANGED;
+    return result.kind;
+  }
+
+  if (!panel_ram_valid)
+  {
+    // the glass shows the last frame, but the panel's memory lost it: nothing to write windows over
+    result.window_tiles = tiles;
+    return result.kind;
+  }
+  int count = findWindows(dirty, tile_columns(width), tile_bands(height), result);
+  if (count < 0 || result.window_tiles * 100 > tiles * options.max_percent)
+  {
+    result.count = 0;
+    result.window_tiles = tiles;
+    return result.kind;
+  }
+  result.kind = FRAME_DIFF_WINDOWS;
+  result.count = count;
+  return result.kind;
+}
+
+void FrameDiff::commit()
+{
+  if (!has_pending)
+    return;
+  rtc.magic = FRAME_DIFF_MAGIC;
+  rtc.width = pending_width;
+  rtc.height = pending_height;
+  memcpy(rtc.hashes, pending, tileCount(pending_width, pending_height) * sizeof(uint32_t));
+  has_pending = false;
+  panel_ram_valid = true;
+}
+
+void FrameDiff::forget()
+{
+  rtc.magic = 0;
+  has_pending = false;
+  panel_ram_valid = false;
+}
+
+void FrameDiff::panelReset()
+{
+  panel_ram_valid = false;
+}
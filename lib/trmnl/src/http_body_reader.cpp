@@ -0,0 +1,302 @@
+#include <http_body_reader.h>
+#include <string.h>
+
+#define BODY_READER_MAX_LINE 256
+
+HttpBodyReader::HttpBodyReader(ByteSource &source, int32_t content_length, bool chunked, const HttpBodyReaderOptions &options)
+    : source(source), content_length(content_length), chunked(chunked), options(options),
+      state(STATE_DATA), err(BODY_READ_OK), remaining(0), total(0), limit(0)
+{
+  start_time = last_data_time = options.now_ms();
+
+  if (chunked)
+  {
+    state = STATE_CHUNK_SIZE;
+  }
+  else if (content_length >= 0)
+  {
+    remaining = (size_t)content_length;
+    if (remaining == 0)
+      state = STATE_DONE;
+  }
+  else
+  {
+    // no framing at all: the body ends when the server closes the connection
+    remaining = SIZE_MAX;
+  }
+}
+
+void HttpBodyReader::fail(body_read_err_e e)
+{
+  if (err == BODY_READ_OK)
+    err = e;
+}
+
+bool HttpBodyReader::waitForData()
+{
+  while (source.available() <= 0)
+  {
+    if (!source.connected())
+    {
+      if (!chunked && content_length < 0)
+        state = STATE_DONE;
+      else
+        fail(BODY_READ_TRUNCATED);
+      return false;
+    }
+
+    uint32_t now = options.now_ms();
+    if (now - last_data_time > options.idle_timeout_ms || now - start_time > options.total_timeout_ms)
+    {
+      fail(BODY_READ_TIMEOUT);
+      return false;
+    }
+    options.wait();
+  }
+
+  if (options.now_ms() - start_time > options.total_timeout_ms)
+  {
+    fail(BODY_READ_TIMEOUT);
+    return false;
+  }
+  return true;
+}
+
+bool HttpBodyReader::readByte(uint8_t *out)
+{
+  while (waitForData())
+  {
+    if (source.read(out, 1) == 1)
+    {
+      last_data_time = options.now_ms();
+      return true;
+    }
+  }
+  return false;
+}
+
+bool HttpBodyReader::readLine(char *line, size_t size)
+{
+  size_t len = 0;
+  size_t consumed = 0;
+  uint8_t c;
+
+  while (readByte(&c))
+  {
+    if (c == '\n')
+    {
+      line[len] = 0;
+      return true;
+    }
+    if (++consumed > BODY_READER_MAX_LINE)
+    {
+      fail(BODY_READ_MALFORMED);
+      return false;
+    }
+    if (c != '\r' && len < size - 1)
+      line[len++] = (char)c;
+  }
+  return false;
+}
+
+bool HttpBodyReader::nextChunk()
+{
+  char line[20];
+  if (!readLine(line, sizeof(line)))
+    return false;
+
+  size_t size = 0;
+  int digits = 0;
+  for (const char *p = line; *p && *p != ';'; p++)
+  {
+    char c = *p;
+    int v;
+    if (c >= '0' && c <= '9')
+      v = c - '0';
+    else if (c >= 'a' && c <= 'f')
+      v = c - 'a' + 10;
+    else if (c >= 'A' && c <= 'F')
+      v = c - 'A' + 10;
+    else if (c == ' ' || c == '\t')
+      continue;
+    else
+    {
+      fail(BODY_READ_MALFORMED);
+      return false;
+    }
+    if (++digits > 8)
+    {
+      fail(BODY_READ_MALFORMED);
+      return false;
+    }
+    size = (size << 4) | (size_t)v;
+  }
+
+  if (digits == 0)
+  {
+    fail(BODY_READ_MALFORMED);
+    return false;
+  }
+
+  if (size == 0)
+  {
+    state = STATE_TRAILER;
+    return true;
+  }
+
+  // Refuse before pulling the chunk payload if it cannot fit anyway
+  if (limit && (size > limit || total + size > limit))
+  {
+    fail(BODY_READ_TOO_BIG);
+    return false;
+  }
+
+  remaining = size;
+  state = STATE_DATA;
+  return true;
+}
+
+size_t HttpBodyReader::read(uint8_t *dst, size_t len)
+{
+  size_t done = 0;
+  char line[32];
+
+  while (done < len && state != STATE_DONE && err == BODY_READ_OK)
+  {
+    switch (state)
+    {
+    case STATE_CHUNK_SIZE:
+      nextChunk();
+      break;
+
+    case STATE_CHUNK_END:
+      if (readLine(line, sizeof(line)))
+      {
+        if (line[0] != 0)
+          fail(BODY_READ_MALFORMED);
+        else
+          state = STATE_CHUNK_SIZE;
+      }
+      break;
+
+    case STATE_TRAILER:
+      if (readLine(line, sizeof(line)))
+      {
+        if (line[0] == 0)
+          state = STATE_DONE;
+      }
+      else if (err == BODY_READ_TRUNCATED)
+      {
+        // some servers close right after the last chunk; the payload is complete
+        err = BODY_READ_OK;
+        state = STATE_DONE;
+      }
+      break;
+
+    case STATE_DATA:
+    {
+      if (remaining == 0)
+      {
+        state = chunked ? STATE_CHUNK_END : STATE_DONE;
+        break;
+      }
+      if (!waitForData())
+        break;
+
+      size_t want = len - done;
+      if (want > remaining)
+        want = remaining;
+      int avail = source.available();
+      if (avail > 0 && want > (size_t)avail)
+        want = (size_t)avail;
+
+      int n = source.read(dst + done, want);
+      if (n > 0)
+      {
+        done += n;
+        total += n;
+        if (remaining != SIZE_MAX)
+          remaining -= n;
+        last_data_time = options.now_ms();
+      }
+      break;
+    }
+
+    case STATE_DONE:
+      break;
+    }
+  }
+
+  return done;
+}
+
+body_read_err_e HttpBodyReader::readAll(uint8_t *buf, size_t capacity, size_t *received)
+{
+  *received = 0;
+  limit = total + capacity;
+
+  if (!chunked && content_length > 0 && (size_t)content_length - total > capacity)
+    return BODY_READ_TOO_BIG;
+
+  size_t n = read(buf, capacity);
+  *received = n;
+
+  if (err != BODY_READ_OK)
+    return err;
+
+  if (!finished())
+  {
+    // buffer is full; anything beyond it means the body does not fit
+    uint8_t extra;
+    if (read(&extra, 1) > 0)
+      return BODY_READ_TOO_BIG;
+    if (err != BODY_READ_OK)
+      return err;
+  }
+
+  return n == 0 ? BODY_READ_EMPTY : BODY_READ_OK;
+}
+
+HttpBodyStream::HttpBodyStream(HttpBodyReader &reader, size_t limit) : reader(reader), limit(limit), bounded(limit != SIZE_MAX), pos(0), len(0) {}
+
+bool HttpBodyStream::fill(uint8_t *dst, size_t size, size_t *n)
+{
+  if (size > limit)
+    size = limit;
+  *n = size > 0 ? reader.read(dst, size) : 0;
+  limit -= *n;
+  return *n > 0;
+}
+
+int HttpBodyStream::read()
+{
+  if (pos == len)
+  {
+    pos = 0;
+    if (!fill(buf, sizeof(buf), &len))
+      return -1;
+  }
+  return buf[pos++];
+}
+
+size_t HttpBodyStream::readBytes(char *dst, size_t size)
+{
+  size_t n = len - pos < size ? len - pos : size;
+  memcpy(dst, buf + pos, n);
+  pos += n;
+  size_t more = 0;
+  if (n < size)
+    fill((uint8_t *)dst + n, size - n, &more);
+  return n + more;
+}
+
+bool HttpBodyStream::finish()
+{
+  pos = len = 0;
+  while (fill(buf, sizeof(buf), &len))
+    ;
+  len = 0;
+  if (reader.error() != BODY_READ_OK)
+    return false;
+  return bounded ? limit == 0 : reader.finished();
+}
@@ -0,0 +1,88 @@
+#include <image_formats.h>
+#include <stdio.h>
+#include <string.h>
+
+static uint16_t read_u16_le(const uint8_t *p)
+{
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+uint32_t image_formats_for_panel(const PanelImageCaps &panel)
+{
+  uint32_t formats = IMAGE_FORMAT_G5 | IMAGE_FORMAT_PNG_INDEXED | IMAGE_FORMAT_PNG | IMAGE_FORMAT_JPEG | IMAGE_FORMAT_BMP;
+  // bbepLoadG5() writes the second plane as the panel's own: gray bit 1 or red
+  if ((panel.four_gray || panel.red) && !panel.full_color)
+    formats |= IMAGE_FORMAT_G5_2PLANE;
+  return formats;
+}
+
+size_t image_formats_header(uint32_t formats, char *out, size_t size)
+{
+  static const struct
+  {
+    uint32_t format;
+    const char *entry;
+  } entries[] = {
+      {IMAGE_FORMAT_G5, "g5;bpp=1"},
+      {IMAGE_FORMAT_G5_2PLANE, "g5;bpp=2"},
+      {IMAGE_FORMAT_PNG_INDEXED, "png;bpp=1|2|4|8;indexed"},
+      {IMAGE_FORMAT_PNG, "png;bpp=8|16|24|32"},
+      {IMAGE_FORMAT_JPEG, "jpeg;bpp=8|24"},
+      {IMAGE_FORMAT_BMP, "bmp;bpp=1"},
+  };
+  size_t len = 0;
+  if (size == 0)
+    return 0;
+  out[0] = 0;
+  for (auto &e : entries)
+  {
+    if (!(formats & e.format))
+      continue;
+    // whole entries only: a cut one would advertise a format that doesn't exist
+    size_t need = strlen(e.entry) + (len ? 2 : 0);
+    if (len + need >= size)
+      break;
+    len += snprintf(out + len, size - len, "%s%s", len ? ", " : "", e.entry);
+  }
+  return len;
+}
+
+uint32_t image_format_detect(const uint8_t *data, size_t len)
+{
+  static const uint8_t png_signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+  if (!data || len < 2)
+    return 0;
+  uint16_t marker = read_u16_le(data);
+  if (marker == G5_IMAGE_MARKER)
+    return IMAGE_FORMAT_G5;
+  if (marker == G5_IMAGE2_MARKER)
+    return IMAGE_FORMAT_G5_2PLANE;
+  if (data[0] == 0xff && data[1] == 0xd8)
+    return IMAGE_FORMAT_JPEG;
+  if (data[0] == 'B' && data[1] == 'M')
+    return IMAGE_FORMAT_BMP;
+  if (len >= 26 && memcmp(data, png_signature, sizeof(png_signature)) == 0)
+    return (data[25] == 3) ? IMAGE_FORMAT_PNG_INDEXED : IMAGE_FORMAT_PNG; // IHDR color type
+  return 0;
+}
+
+g5_image_err_e g5_image_check(const uint8_t *data, size_t len, int panel_width, int panel_height, uint32_t formats,
+                              G5ImageInfo *info)
+{
+  uint32_t format = image_format_detect(data, len);
+  if (format != IMAGE_FORMAT_G5 && format != IMAGE_FORMAT_G5_2PLANE)
+    return G5_IMAGE_NOT_G5;
+  if (len < G5_IMAGE_HEADER_SIZE || G5_IMAGE_HEADER_SIZE + (size_t)read_u16_le(data + 6) > len)
+    return G5_IMAGE_TRUNCATED;
+  info->width = read_u16_le(data + 2);
+  info->height = read_u16_le(data + 4);
+  info->planes = (format == IMAGE_FORMAT_G5_2PLANE) ? 2 : 1;
+  if (info->width == 0 || info->height == 0)
+    return G5_IMAGE_BAD_SIZE;
+  if (!(formats & format))
+    return G5_IMAGE_UNSUPPORTED;
+  // centered either way: larger images lose the same amount on both sides
+  info->x = (panel_width - info->width) / 2;
+  info->y = (panel_height - info->height) / 2;
+  return G5_IMAGE_OK;
+}
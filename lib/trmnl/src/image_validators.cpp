@@ -0,0 +1,87 @@
+#include <image_validators.h>
+#include <string.h>
+#include <trmnl_log.h>
+
+uint32_t image_url_hash(const char *url)
+{
+  uint32_t hash = 2166136261u;
+  for (const char *p = url; p && *p; p++)
+  {
+    hash ^= (uint8_t)*p;
+    hash *= 16777619u;
+  }
+  return hash == 0 ? 1 : hash;
+}
+
+static void copy_validator(char *dst, size_t size, const String &value)
+{
+  // a truncated validator would never match, so don't keep it at all
+  if (value.length() >= size)
+  {
+    dst[0] = 0;
+    return;
+  }
+  memcpy(dst, value.c_str(), value.length() + 1);
+}
+
+ImageValidatorStore::ImageValidatorStore(ImageValidatorsRtc &rtc, const char *etag_key, const char *last_modified_key, const char *url_key, Persistence &persistence)
+    : rtc(rtc), etag_key(etag_key), last_modified_key(last_modified_key), url_key(url_key), persistence(persistence) {}
+
+bool ImageValidatorStore::restore()
+{
+  if (rtc.magic == IMAGE_VALIDATORS_MAGIC)
+    return true;
+
+  // cold boot: RTC memory is gone, NVS still has what was shown before power off
+  copy_validator(rtc.etag, sizeof(rtc.etag), persistence.readString(etag_key, ""));
+  copy_validator(rtc.last_modified, sizeof(rtc.last_modified), persistence.readString(last_modified_key, ""));
+  rtc.url_hash = persistence.readUint(url_key, 0);
+  rtc.magic = IMAGE_VALIDATORS_MAGIC;
+  return false;
+}
+
+ImageValidators ImageValidatorStore::load(const char *url)
+{
+  ImageValidators validators;
+  bool from_rtc = restore();
+
+  validators.etag = rtc.etag;
+  if (rtc.url_hash == image_url_hash(url))
+  {
+    validators.last_modified = rtc.last_modified;
+  }
+  Log_verbose_serial("image validators (%s): etag '%s', last modified '%s'", from_rtc ? "RTC" : "NVS",
+                     validators.etag.c_str(), validators.last_modified.c_str());
+  return validators;
+}
+
+void ImageValidatorStore::save(const char *url, const String &etag, const String &last_modified)
+{
+  restore();
+
+  ImageValidatorsRtc updated = rtc;
+  copy_validator(updated.etag, sizeof(updated.etag), etag);
+  copy_validator(updated.last_modified, sizeof(updated.last_modified), last_modified);
+  updated.url_hash = image_url_hash(url);
+
+  if (strcmp(updated.etag, rtc.etag) != 0)
+    persistence.writeString(etag_key, updated.etag);
+  if (strcmp(updated.last_modified, rtc.last_modified) != 0)
+    persistence.writeString(last_modified_key, updated.last_modified);
+  if (updated.url_hash != rtc.url_hash)
+    persistence.writeUint(url_key, updated.url_hash);
+
+  rtc = updated;
+}
+
+void ImageValidatorStore::clear()
+{
+  if (restore() && rtc.etag[0] == 0 && rtc.last_modified[0] == 0)
+    return;
+
+  persistence.remove(etag_key);
+  persistence.remove(last_modified_key);
+  persistence.remove(url_key);
+  memset(&rtc, 0, sizeof(rtc));
+  rtc.magic = IMAGE_VALIDATORS_MAGIC;
+}
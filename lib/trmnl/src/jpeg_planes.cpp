@@ -0,0 +1,148 @@
+#include <jpeg_planes.h>
+#include <png_planes.h>
+#include <stdlib.h>
+#include <string.h>
+
+JpegPlanes::JpegPlanes()
+    : width(0), height(0), pitch(0), mode(JPEG_PLANES_FOUR_GRAY), write(nullptr), ctx(nullptr), gray(nullptr),
+      red(nullptr), planes(nullptr), strip_y(0), strip_h(0), filled(0), strip_count(0)
+{
+}
+
+JpegPlanes::~JpegPlanes()
+{
+  end();
+}
+
+bool JpegPlanes::begin(int width, int height, jpeg_planes_mode_e mode, dither_mode_e dither_mode,
+                       jpeg_planes_write_t write, void *ctx)
+{
+  end();
+  this->width = width;
+  this->height = height;
+  this->mode = mode;
+  this->write = write;
+  this->ctx = ctx;
+  pitch = (width + 7) / 8;
+  strip_h = 0;
+  filled = 0;
+  strip_count = 0;
+
+  gray = (uint8_t *)malloc(width * JPEG_PLANES_MAX_STRIP);
+  // plane 0, plane 1 and the 2-bpp row they're split from
+  planes = (uint8_t *)malloc(2 * pitch * JPEG_PLANES_MAX_STRIP + (width + 3) / 4);
+  if (mode == JPEG_PLANES_BWR)
+    red = (uint8_t *)calloc(pitch * JPEG_PLANES_MAX_STRIP, 1);
+  if (!gray || !planes || (mode == JPEG_PLANES_BWR && !red))
+  {
+    end();
+    return false;
+  }
+  // without memory for the error rows the strips are thresholded, not worth failing for
+  dither.begin(width, dither_mode);
+  return true;
+}
+
+void JpegPlanes::end()
+{
+  free(gray);
+  free(red);
+  free(planes);
+  gray = red = planes = nullptr;
+  dither.end();
+}
+
+bool JpegPlanes::addBlock(int x, int y, int w, int h, int stride, const void *pixels)
+{
+  if (!gray || x < 0 || y < 0 || x >= width || y >= height)
+    return false;
+  if (x + w > width)
+    w = width - x;
+  if (y + h > height)
+    h = height - y; // the last MCU row can reach past the image
+  if (h > JPEG_PLANES_MAX_STRIP)
+    return false;
+
+  if (strip_h && y != strip_y)
+  {
+    // the decoder moved on without finishing the row; keep what there is
+    if (!writeStrip())
+      return false;
+  }
+  if (!strip_h)
+  {
+    strip_y = y;
+    strip_h = h;
+    filled = 0;
+    memset(gray, 0xff, width * JPEG_PLANES_MAX_STRIP); // white where no block arrives
+    if (red)
+      memset(red, 0, pitch * JPEG_PLANES_MAX_STRIP);
+  }
+
+  for (int row = 0; row < h && row < strip_h; row++)
+  {
+    uint8_t *g = &gray[row * width + x];
+    if (mode == JPEG_PLANES_FOUR_GRAY)
+    {
+      memcpy(g, (const uint8_t *)pixels + row * stride, w);
+      continue;
+    }
+    const uint16_t *s = (const uint16_t *)pixels + row * stride;
+    uint8_t *r = &red[row * pitch];
+    for (int i = 0; i < w; i++)
+    {
+      uint16_t v = s[i];
+      int r8 = ((v >> 8) & 0xf8) | (v >> 13);
+      int g8 = ((v >> 3) & 0xfc) | ((v >> 9) & 3);
+      int b8 = ((v << 3) & 0xf8) | ((v >> 2) & 7);
+      g[i] = (uint8_t)((r8 + g8 * 2 + b8) >> 2);
+      if (r8 - g8 > JPEG_PLANES_RED_MARGIN && r8 - b8 > JPEG_PLANES_RED_MARGIN)
+        r[(x + i) >> 3] |= (uint8_t)(0x80 >> ((x + i) & 7));
+    }
+  }
+  if (x + w > filled)
+    filled = x + w;
+
+  if (filled >= width)
+    return writeStrip();
+  return true;
+}
+
+bool JpegPlanes::flush()
+{
+  return strip_h ? writeStrip() : true;
+}
+
+bool JpegPlanes::writeStrip()
+{
+  uint8_t *plane0 = planes, *plane1 = planes + pitch * JPEG_PLANES_MAX_STRIP;
+  uint8_t *two_bit = planes + 2 * pitch * JPEG_PLANES_MAX_STRIP;
+  int h = strip_h;
+
+  strip_h = 0;
+  for (int row = 0; row < h; row++)
+  {
+    const uint8_t *g = &gray[row * width];
+    uint8_t *d0 = &plane0[row * pitch], *d1 = &plane1[row * pitch];
+    if (mode == JPEG_PLANES_FOUR_GRAY)
+    {
+      // inverted 2-bpp, as bb_epaper's 4-gray lookup has it: the bits of each value go to the two planes
+      dither.reduce(g, two_bit, width, 2);
+      two_bit_to_one_bit(two_bit, d0, width, 0, TWO_BIT_PLANE_0);
+      two_bit_to_one_bit(two_bit, d1, width, 0, TWO_BIT_PLANE_1);
+    }
+    else
+    {
+      // red takes priority: those pixels are black in the B/W plane, like bbepFill() does
+      const uint8_t *r = &red[row * pitch];
+      dither.reduce(g, d0, width, 1);
+      for (int i = 0; i < pitch; i++)
+      {
+        d0[i] &= (uint8_t)~r[i];
+        d1[i] = r[i];
+      }
+    }
+  }
+  strip_count++;
+  return write(ctx, strip_y, h, plane0, plane1, pitch);
+}
@@ -0,0 +1,85 @@
+#include <jpeg_strip.h>
+#include <stdlib.h>
+#include <string.h>
+
+JpegStrip::JpegStrip()
+    : width(0), height(0), pitch(0), write(nullptr), ctx(nullptr), strip(nullptr), strip_y(0), strip_h(0), filled(0),
+      strip_count(0)
+{
+}
+
+JpegStrip::~JpegStrip()
+{
+  end();
+}
+
+bool JpegStrip::begin(int width, int height, jpeg_strip_write_t write, void *ctx)
+{
+  end();
+  this->width = width;
+  this->height = height;
+  this->write = write;
+  this->ctx = ctx;
+  pitch = (width + 7) / 8;
+  strip_h = 0;
+  filled = 0;
+  strip_count = 0;
+  strip = (uint8_t *)malloc(pitch * JPEG_STRIP_MAX_HEIGHT);
+  return strip != nullptr;
+}
+
+void JpegStrip::end()
+{
+  free(strip);
+  strip = nullptr;
+}
+
+bool JpegStrip::addBlock(int x, int y, int w, int h, int stride, const uint8_t *pixels)
+{
+  if (!strip || x < 0 || y < 0 || (x & 7) || x >= width || y >= height)
+    return false;
+  if (x + w > width)
+    w = width - x;
+  if (y + h > height)
+    h = height - y; // the last MCU row can reach past the image
+  if (h > JPEG_STRIP_MAX_HEIGHT)
+    return false;
+
+  if (strip_h && y != strip_y)
+  {
+    // the decoder moved on without finishing the row; keep what there is
+    if (!writeStrip())
+      return false;
+  }
+  if (!strip_h)
+  {
+    strip_y = y;
+    strip_h = h;
+    filled = 0;
+    memset(strip, 0xff, pitch * JPEG_STRIP_MAX_HEIGHT); // white where no block arrives
+  }
+
+  int src_pitch = (stride + 7) / 8;
+  int bytes = (w + 7) / 8;
+  for (int row = 0; row < h && row < strip_h; row++)
+    memcpy(&strip[row * pitch + x / 8], pixels + row * src_pitch, bytes);
+  if (x + w > filled)
+    filled = x + w;
+
+  if (filled >= width)
+    return writeStrip();
+  return true;
+}
+
+bool JpegStrip::flush()
+{
+  return strip_h ? writeStrip() : true;
+}
+
+bool JpegStrip::writeStrip()
+{
+  int h = strip_h;
+  strip_h = 0;
+  strip_count++;
+  return write(ctx, strip_y, h, strip, pitch);
+}
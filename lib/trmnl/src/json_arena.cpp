@@ -0,0 +1,78 @@
+#include <json_arena.h>
+#include <string.h>
+
+#define JSON_ARENA_ALIGN 8
+#define JSON_ARENA_HEADER JSON_ARENA_ALIGN // each block starts with its size
+
+static size_t align_up(size_t n)
+{
+  return (n + JSON_ARENA_ALIGN - 1) & ~(size_t)(JSON_ARENA_ALIGN - 1);
+}
+
+JsonArena::JsonArena(uint8_t *buffer, size_t capacity) : high_water(0)
+{
+  size_t skip = align_up((uintptr_t)buffer) - (uintptr_t)buffer;
+  this->buffer = buffer + skip;
+  size = capacity > skip ? capacity - skip : 0;
+  reset();
+}
+
+void JsonArena::reset()
+{
+  top = 0;
+  last = size;
+}
+
+void *JsonArena::allocate(size_t n)
+{
+  size_t need = JSON_ARENA_HEADER + align_up(n);
+  if (need > size - top)
+    return nullptr;
+
+  memcpy(buffer + top, &n, sizeof(n));
+  last = top;
+  top += need;
+  if (top > high_water)
+    high_water = top;
+  return buffer + last + JSON_ARENA_HEADER;
+}
+
+void JsonArena::deallocate(void *ptr)
+{
+  if (ptr != nullptr && ptr == buffer + last + JSON_ARENA_HEADER)
+  {
+    top = last;
+    last = size;
+  }
+}
+
+void *JsonArena::reallocate(void *ptr, size_t n)
+{
+  if (ptr == nullptr)
+    return allocate(n);
+
+  uint8_t *block = (uint8_t *)ptr - JSON_ARENA_HEADER;
+  size_t old_size;
+  memcpy(&old_size, block, sizeof(old_size));
+
+  if (block == buffer + last)
+  {
+    // the block on top grows or shrinks in place
+    size_t need = JSON_ARENA_HEADER + align_up(n);
+    if (need > size - last)
+      return nullptr;
+    memcpy(block, &n, sizeof(n));
+    top = last + need;
+    if (top > high_water)
+      high_water = top;
+    return ptr;
+  }
+
+  if (n <= old_size)
+    return ptr;
+
+  void *moved = allocate(n);
+  if (moved != nullptr)
+    memcpy(moved, ptr, old_size);
+  return moved;
+}
@@ -0,0 +1,235 @@
+#include <palette_map.h>
+#include <math.h>
+#include <string.h>
+
+static const uint8_t png_signature[8] = {0x89, 'P', 'N', 'G', 0x0d, 0x0a, 0x1a, 0x0a};
+
+PngPaletteScanner::PngPaletteScanner()
+{
+  reset();
+}
+
+void PngPaletteScanner::reset()
+{
+  state = SCAN_SIGNATURE;
+  remaining = sizeof(png_signature);
+  header_len = 0;
+  palette_entries = 0;
+}
+
+void PngPaletteScanner::feed(const uint8_t *data, size_t len)
+{
+  while (len > 0 && state != SCAN_DONE)
+  {
+    switch (state)
+    {
+    case SCAN_SIGNATURE:
+      if (*data != png_signature[sizeof(png_signature) - remaining])
+      {
+        state = SCAN_DONE; // not a PNG
+        break;
+      }
+      data++;
+      len--;
+      if (--remaining == 0)
+        state = SCAN_CHUNK_HEADER;
+      break;
+
+    case SCAN_CHUNK_HEADER:
+      header[header_len++] = *data++;
+      len--;
+      if (header_len == sizeof(header))
+      {
+        uint32_t chunk_len = ((uint32_t)header[0] << 24) | ((uint32_t)header[1] << 16) | ((uint32_t)header[2] << 8) |
+                             header[3];
+        header_len = 0;
+        if (memcmp(&header[4], "PLTE", 4) == 0)
+        {
+          palette_entries = (int)(chunk_len / 3);
+          if (palette_entries > PALETTE_MAP_MAX_ENTRIES)
+            palette_entries = PALETTE_MAP_MAX_ENTRIES;
+          state = SCAN_DONE;
+        }
+        else if (memcmp(&header[4], "IDAT", 4) == 0)
+        {
+          state = SCAN_DONE; // PLTE has to come before the image data
+        }
+        else
+        {
+          remaining = chunk_len + 4; // data and CRC
+          state = remaining ? SCAN_CHUNK_BODY : SCAN_CHUNK_HEADER;
+        }
+      }
+      break;
+
+    case SCAN_CHUNK_BODY:
+    {
+      size_t skip = len < remaining ? len : remaining;
+      data += skip;
+      len -= skip;
+      remaining -= (uint32_t)skip;
+      if (remaining == 0)
+        state = SCAN_CHUNK_HEADER;
+      break;
+    }
+
+    case SCAN_DONE:
+      break;
+    }
+  }
+}
+
+int png_palette_entries(const uint8_t *png, size_t size)
+{
+  PngPaletteScanner scanner;
+  scanner.feed(png, size);
+  return scanner.entries();
+}
+
+struct LabColor
+{
+  float l, a, b;
+};
+
+static float srgb_to_linear(uint8_t c)
+{
+  float v = c / 255.0f;
+  return v <= 0.04045f ? v / 12.92f : powf((v + 0.055f) / 1.055f, 2.4f);
+}
+
+static float lab_f(float t)
+{
+  return t > 0.008856f ? cbrtf(t) : 7.787f * t + 16.0f / 116.0f;
+}
+
+/** @brief sRGB to CIELAB, D65 white point */
+static LabColor rgb_to_lab(uint8_t r8, uint8_t g8, uint8_t b8)
+{
+  float r = srgb_to_linear(r8), g = srgb_to_linear(g8), b = srgb_to_linear(b8);
+  float fx = lab_f((0.4124f * r + 0.3576f * g + 0.1805f * b) / 0.95047f);
+  float fy = lab_f(0.2126f * r + 0.7152f * g + 0.0722f * b);
+  float fz = lab_f((0.0193f * r + 0.1192f * g + 0.9505f * b) / 1.08883f);
+  LabColor lab = {116.0f * fy - 16.0f, 500.0f * (fx - fy), 200.0f * (fy - fz)};
+  return lab;
+}
+
+int palette_map_nearest(const uint8_t *palette, int entries, const uint32_t *panel_rgb, int panel_colors, uint8_t *map)
+{
+  LabColor panel[PALETTE_MAP_MAX_PANEL_COLORS];
+  int inexact = 0;
+
+  if (panel_colors > PALETTE_MAP_MAX_PANEL_COLORS)
+    panel_colors = PALETTE_MAP_MAX_PANEL_COLORS;
+  if (entries > PALETTE_MAP_MAX_ENTRIES)
+    entries = PALETTE_MAP_MAX_ENTRIES;
+  for (int c = 0; c < panel_colors; c++)
+    panel[c] = rgb_to_lab((uint8_t)(panel_rgb[c] >> 16), (uint8_t)(panel_rgb[c] >> 8), (uint8_t)panel_rgb[c]);
+
+  for (int i = 0; i < entries; i++)
+  {
+    const uint8_t *p = &palette[i * 3];
+    uint32_t rgb = ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+    int best = -1;
+
+    for (int c = 0; c < panel_colors && best < 0; c++)
+    {
+      if ((panel_rgb[c] & 0xffffff) == rgb)
+        best = c;
+    }
+    if (best < 0)
+    {
+      LabColor lab = rgb_to_lab(p[0], p[1], p[2]);
+      float best_dist = 0;
+      for (int c = 0; c < panel_colors; c++)
+      {
+        float dl = lab.l - panel[c].l, da = lab.a - panel[c].a, db = lab.b - panel[c].b;
+        float dist = dl * dl + da * da + db * db;
+        if (best < 0 || dist < best_dist)
+        {
+          best = c;
+          best_dist = dist;
+        }
+      }
+      inexact++;
+    }
+    map[i] = (uint8_t)(best < 0 ? 0 : best);
+  }
+  return inexact;
+}
+
+uint32_t palette_map_key(const uint8_t *palette, int entries, const uint32_t *panel_rgb, int panel_colors)
+{
+  // FNV-1a over both palettes and their lengths
+  uint32_t hash = 2166136261u;
+  uint32_t lengths = ((uint32_t)entries << 16) | (uint16_t)panel_colors;
+  for (int i = 0; i < 4; i++)
+  {
+    hash ^= (uint8_t)(lengths >> (8 * i));
+    hash *= 16777619u;
+  }
+  for (int i = 0; i < entries * 3; i++)
+  {
+    hash ^= palette[i];
+    hash *= 16777619u;
+  }
+  for (int c = 0; c < panel_colors; c++)
+  {
+    for (int i = 0; i < 3; i++)
+    {
+      hash ^= (uint8_t)(panel_rgb[c] >> (8 * i));
+      hash *= 16777619u;
+    }
+  }
+  return hash == 0 ? 1 : hash;
+}
+
+PaletteMapCache::PaletteMapCache(PaletteMapRtc &rtc) : rtc(rtc)
+{
+}
+
+void PaletteMapCache::init()
+{
+  if (rtc.magic != PALETTE_MAP_MAGIC)
+  {
+    memset(&rtc, 0, sizeof(rtc));
+    rtc.magic = PALETTE_MAP_MAGIC;
+  }
+}
+
+bool PaletteMapCache::map(const uint8_t *palette, int entries, const uint32_t *panel_rgb, int panel_colors,
+                          uint8_t *map, int *inexact)
+{
+  init();
+  if (entries > PALETTE_MAP_MAX_ENTRIES)
+    entries = PALETTE_MAP_MAX_ENTRIES;
+  uint32_t key = palette_map_key(palette, entries, panel_rgb, panel_colors);
+  rtc.uses++;
+
+  PaletteMapCacheEntry *entry = nullptr;
+  for (int i = 0; i < PALETTE_MAP_CACHE_ENTRIES; i++)
+  {
+    if (rtc.entries[i].key == key && rtc.entries[i].entries == entries)
+    {
+      entry = &rtc.entries[i];
+      entry->last_used = rtc.uses;
+      memcpy(map, entry->map, entries);
+      if (inexact)
+        *inexact = entry->inexact;
+      return true;
+    }
+    // otherwise replace a free slot, or the one used longest ago
+    if (entry == nullptr || rtc.entries[i].key == 0 ||
+        (entry->key != 0 && rtc.entries[i].last_used < entry->last_used))
+      entry = &rtc.entries[i];
+  }
+
+  int n = palette_map_nearest(palette, entries, panel_rgb, panel_colors, map);
+  if (inexact)
+    *inexact = n;
+  entry->key = key;
+  entry->last_used = rtc.uses;
+  entry->entries = (uint16_t)entries;
+  entry->inexact = (uint16_t)n;
+  memcpy(entry->map, map, entries);
+  return false;
+}
@@ -1,14 +1,26 @@
-
 #include <ArduinoJson.h>
 #include "api_response_parsing.h"
 #include <trmnl_log.h>
 #include <special_function.h>
 
-ApiDisplayResponse parseResponse_apiDisplay(String &payload)
+/** @brief Keeps only the members ApiDisplayResponse uses, everything else is skipped while parsing */
+static void buildFilter(JsonDocument &filter)
 {
-  JsonDocument doc;
-  DeserializationError error = deserializeJson(doc, payload);
+  filter["status"] = true;
+  filter["image_url"] = true;
+  filter["image_url_timeout"] = true;
+  filter["filename"] = true;
+  filter["update_firmware"] = true;
+  filter["maximum_compatibility"] = true;
+  filter["firmware_url"] = true;
+  filter["refresh_rate"] = true;
+  filter["reset_firmware"] = true;
+  filter["special_function"] = true;
+  filter["action"] = true;
+}
 
+static ApiDisplayResponse responseFromDocument(JsonDocument &doc, DeserializationError error)
+{
   if (error)
   {
     Log_error("JSON deserialization error.");
@@ -34,3 +46,34 @@ ApiDisplayResponse parseResponse_apiDisplay(String &payload)
       .action = doc["action"] | "",
   };
 }
+
+ApiDisplayResponse parseResponse_apiDisplay(String &payload)
+{
+  JsonDocument filter;
+  buildFilter(filter);
+  JsonDocument doc;
+  DeserializationError error = deserializeJson(doc, payload, DeserializationOption::Filter(filter));
+  return responseFromDocument(doc, error);
+}
+
+ApiDisplayResponse parseResponse_apiDisplay(HttpBodyStream &stream, JsonArena &arena)
+{
+  arena.reset();
+  JsonDocument filter(&arena);
+  buildFilter(filter);
+  filter.shrinkToFit(); // its pool is on top of the arena, so this gives most of it back
+  JsonDocument doc(&arena);
+  DeserializationError error = filter.overflowed()
+                                   ? DeserializationError(DeserializationError::NoMemory)
+                                   : deserializeJson(doc, stream, DeserializationOption::Filter(filter));
+  return responseFromDocument(doc, error);
+}
+
+ApiDisplayResponse parseResponse_apiDisplay(HttpBodyReader &body, JsonArena &arena)
+{
+  HttpBodyStream stream(body);
+  ApiDisplayResponse response = parseResponse_apiDisplay(stream, arena);
+  if (!stream.finish())
+    Log_info("Body not consumed completely (%d), the connection won't be reused", body.error());
+  return response;
+}
@@ -0,0 +1,96 @@
+#include <phase_timer.h>
+#include <stdio.h>
+#include <string.h>
+
+PhaseTimer::PhaseTimer(uint32_t (*now_ms)())
+    : now_ms(now_ms), phase_count(0)
+{
+}
+
+int PhaseTimer::begin(const char *name)
+{
+  if (phase_count >= PHASE_TIMER_MAX)
+    return -1;
+  Phase &phase = phases[phase_count];
+  phase.name = name;
+  phase.start_ms = now_ms();
+  phase.end_ms = phase.start_ms;
+  phase.open = true;
+  return phase_count++;
+}
+
+void PhaseTimer::end(int id)
+{
+  if (id < 0 || id >= phase_count || !phases[id].open)
+    return;
+  phases[id].end_ms = now_ms();
+  phases[id].open = false;
+}
+
+int PhaseTimer::find(const char *name) const
+{
+  for (int id = phase_count - 1; id >= 0; id--)
+  {
+    if (strcmp(phases[id].name, name) == 0)
+      return id;
+  }
+  return -1;
+}
+
+const Phase *PhaseTimer::get(int id) const
+{
+  if (id < 0 || id >= phase_count)
+    return nullptr;
+  return &phases[id];
+}
+
+uint32_t PhaseTimer::endOf(const Phase &phase, uint32_t now) const
+{
+  return phase.open ? now : phase.end_ms;
+}
+
+uint32_t PhaseTimer::durationMs(int id) const
+{
+  const Phase *phase = get(id);
+  if (!phase)
+    return 0;
+  return endOf(*phase, now_ms()) - phase->start_ms;
+}
+
+uint32_t PhaseTimer::overlapMs(int a, int b) const
+{
+  const Phase *first = get(a), *second = get(b);
+  if (!first || !second)
+    return 0;
+  // times relative to the start of the first, so a wrap of the clock doesn't matter
+  uint32_t now = now_ms(), origin = first->start_ms;
+  uint32_t first_end = endOf(*first, now) - origin;
+  int64_t second_start = (int32_t)(second->start_ms - origin);
+  int64_t second_end = second_start + (uint32_t)(endOf(*second, now) - second->start_ms);
+  int64_t from = second_start > 0 ? second_start : 0;
+  int64_t to = second_end < (int64_t)first_end ? second_end : (int64_t)first_end;
+  return to > from ? (uint32_t)(to - from) : 0;
+}
+
+size_t PhaseTimer::summary(const char *against, char *out, size_t size) const
+{
+  int other = against ? find(against) : -1;
+  size_t len = 0;
+  if (size == 0)
+    return 0;
+  out[0] = 0;
+  for (int id = 0; id < phase_count && len < size - 1; id++)
+  {
+    int n;
+    if (id == other || other < 0)
+      n = snprintf(out + len, size - len, "%s%s %u ms%s", id ? "; " : "", phases[id].name,
+                   (unsigned)durationMs(id), phases[id].open ? " (open)" : "");
+    else
+      n = snprintf(out + len, size - len, "%s%s %u ms (%u overlapped)%s", id ? "; " : "", phases[id].name,
+                   (unsigned)durationMs(id), (unsigned)overlapMs(other, id), phases[id].open ? " (open)" : "");
+    if (n < 0)
+      break;
+    len += (size_t)n < size - len ? (size_t)n : size - len - 1;
+  }
+  return len;
+}
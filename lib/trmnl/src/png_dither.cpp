@@ -0,0 +1,240 @@
+#include <png_dither.h>
+#include <PNGdec.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DITHER_CHUNK 64 // pixels converted to gray at a time, a multiple of 8 keeps every depth byte aligned
+
+//
+// One tight loop per pixel format, no branches per pixel: the compiler can unroll
+// and vectorize them, unlike a switch on the depth for every pixel.
+//
+static void palette_to_gray(const uint8_t *pPalette, const uint8_t *pIndex, uint8_t *pGray, int w)
+{
+  for (int x = 0; x < w; x++)
+  {
+    const uint8_t *pPal = &pPalette[pIndex[x] * 3];
+    pGray[x] = (uint8_t)((pPal[0] + pPal[1] * 2 + pPal[2]) >> 2);
+  }
+}
+
+void png_row_to_gray(int iPixelType, const uint8_t *pPalette, const uint8_t *pSrc, uint8_t *pGray, int w, int iSrcBpp)
+{
+  static const uint8_t u8G2ToG8[4] = {0x00, 0x55, 0xaa, 0xff}; // 2-bit to 8-bit gray
+  uint8_t ucIndex[DITHER_CHUNK];
+  int x, n;
+
+  switch (iPixelType)
+  {
+  case PNG_PIXEL_TRUECOLOR:
+  case PNG_PIXEL_TRUECOLOR_ALPHA:
+  {
+    int iDelta = (iPixelType == PNG_PIXEL_TRUECOLOR) ? 3 : 4;
+    for (x = 0; x < w; x++, pSrc += iDelta)
+      pGray[x] = (uint8_t)((pSrc[0] + pSrc[1] * 2 + pSrc[2]) >> 2);
+    return;
+  }
+  case PNG_PIXEL_GRAY_ALPHA:
+    for (x = 0; x < w; x++, pSrc += 2)
+      pGray[x] = pSrc[0];
+    return;
+  }
+
+  // grayscale or indexed, 1 to 8 bits per pixel
+  if (iSrcBpp == 8)
+  {
+    if (iPixelType == PNG_PIXEL_INDEXED)
+      palette_to_gray(pPalette, pSrc, pGray, w);
+    else
+      memcpy(pGray, pSrc, w);
+    return;
+  }
+  for (x = 0; x < w; x += n)
+  {
+    n = (w - x < DITHER_CHUNK) ? w - x : DITHER_CHUNK;
+    uint8_t *pOut = (iPixelType == PNG_PIXEL_INDEXED) ? ucIndex : &pGray[x];
+    const uint8_t *s = pSrc + (x * iSrcBpp) / 8;
+    int i;
+    switch (iSrcBpp)
+    {
+    case 4:
+      for (i = 0; i < n; i++)
+        pOut[i] = (s[i >> 1] >> (4 - 4 * (i & 1))) & 0xf;
+      if (iPixelType != PNG_PIXEL_INDEXED)
+        for (i = 0; i < n; i++)
+          pOut[i] |= pOut[i] << 4;
+      break;
+    case 2:
+      for (i = 0; i < n; i++)
+        pOut[i] = (s[i >> 2] >> (6 - 2 * (i & 3))) & 3;
+      if (iPixelType != PNG_PIXEL_INDEXED)
+        for (i = 0; i < n; i++)
+          pOut[i] = u8G2ToG8[pOut[i]];
+      break;
+    default: // 1-bit
+      for (i = 0; i < n; i++)
+        pOut[i] = (s[i >> 3] >> (7 - (i & 7))) & 1;
+      if (iPixelType != PNG_PIXEL_INDEXED)
+        for (i = 0; i < n; i++)
+          pOut[i] = pOut[i] ? 0xff : 0x00;
+      break;
+    }
+    if (iPixelType == PNG_PIXEL_INDEXED)
+      palette_to_gray(pPalette, ucIndex, &pGray[x], n);
+  }
+}
+
+RowDither::RowDither() : errors(nullptr), width(0), diffusion(DITHER_NONE), row(0)
+{
+}
+
+RowDither::~RowDither()
+{
+  end();
+}
+
+bool RowDither::begin(int width, dither_mode_e mode)
+{
+  end();
+  if (mode == DITHER_NONE)
+    return true;
+  errors = (int16_t *)calloc(3 * (width + 4), sizeof(int16_t));
+  if (!errors)
+    return false;
+  this->width = width;
+  diffusion = mode;
+  row = 0;
+  return true;
+}
+
+void RowDither::end()
+{
+  free(errors);
+  errors = nullptr;
+}
+
+void RowDither::reduceSpan(const uint8_t *pGray, uint8_t *pDest, int x0, int n, int iDestBpp)
+{
+  uint8_t u8 = 0;
+  int count = 8; // bits left in the output byte
+  int x;
+
+  if (!errors || x0 + n > width)
+  {
+    for (x = 0; x < n; x++)
+    {
+      u8 <<= iDestBpp;
+      if (iDestBpp == 1)
+        u8 |= pGray[x] >> 7; // B/W
+      else
+        u8 |= 3 ^ (pGray[x] >> 6); // 4 gray levels (inverted relative to 1-bit)
+      count -= iDestBpp;
+      if (count == 0)
+      {
+        *pDest++ = u8;
+        u8 = 0;
+        count = 8;
+      }
+    }
+    if (count != 8)
+      *pDest = (uint8_t)(u8 << count); // partial byte remaining
+    return;
+  }
+
+  // errors are kept in 1/16 of a gray level; index 2 is pixel 0, so x - 1 and x + 2 stay inside
+  const int stride = width + 4;
+  int16_t *cur = errors + (row % 3) * stride + 2 + x0;
+  int16_t *next = errors + ((row + 1) % 3) * stride + 2 + x0;
+  int16_t *after = errors + ((row + 2) % 3) * stride + 2 + x0;
+
+  for (x = 0; x < n; x++)
+  {
+    int v = pGray[x] + ((cur[x] + 8) >> 4);
+    v = v < 0 ? 0 : (v > 255 ? 255 : v);
+    int level, out;
+    if (iDestBpp == 1)
+    {
+      out = v >> 7;
+      level = out ? 255 : 0;
+    }
+    else
+    {
+      int idx = (v * 3 + 127) / 255; // nearest of 0, 85, 170, 255
+      level = idx * 85;
+      out = 3 ^ idx; // inverted like the thresholded 2-bpp output
+    }
+    int e = v - level;
+    if (diffusion == DITHER_FLOYD_STEINBERG)
+    {
+      cur[x + 1] += e * 7;
+      next[x - 1] += e * 3;
+      next[x] += e * 5;
+      next[x + 1] += e;
+    }
+    else
+    { // Atkinson: 1/8 of the error to each of 6 neighbors
+      e *= 2;
+      cur[x + 1] += e;
+      cur[x + 2] += e;
+      next[x - 1] += e;
+      next[x] += e;
+      next[x + 1] += e;
+      after[x] += e;
+    }
+
+    u8 = (uint8_t)((u8 << iDestBpp) | out);
+    count -= iDestBpp;
+    if (count == 0)
+    {
+      *pDest++ = u8;
+      u8 = 0;
+      count = 8;
+    }
+  }
+  if (count != 8)
+    *pDest = (uint8_t)(u8 << count);
+}
+
+void RowDither::nextRow()
+{
+  if (!errors)
+    return;
+  // the finished row's errors are used up: it becomes the one after next
+  memset(errors + (row % 3) * (width + 4), 0, (width + 4) * sizeof(int16_t));
+  row++;
+}
+
+void RowDither::reduce(const uint8_t *pGray, uint8_t *pDest, int w, int iDestBpp)
+{
+  reduceSpan(pGray, pDest, 0, w, iDestBpp);
+  nextRow();
+}
+
+void png_reduce_row(int iDestBpp, int iPixelType, const uint8_t *pPalette, const uint8_t *pSrc, uint8_t *pDest, int w, int iSrcBpp, RowDither *dither)
+{
+  uint8_t ucGray[DITHER_CHUNK];
+  int iBits; // bits per pixel
+
+  if (iPixelType == PNG_PIXEL_TRUECOLOR) iBits = 24;
+  else if (iPixelType == PNG_PIXEL_TRUECOLOR_ALPHA) iBits = 32;
+  else if (iPixelType == PNG_PIXEL_GRAY_ALPHA) iBits = 16;
+  else iBits = iSrcBpp;
+
+  // in chunks, so no row of gray has to be kept
+  for (int x = 0; x < w; x += DITHER_CHUNK)
+  {
+    int n = (w - x < DITHER_CHUNK) ? w - x : DITHER_CHUNK;
+    png_row_to_gray(iPixelType, pPalette, pSrc + (x * iBits) / 8, ucGray, n, iSrcBpp);
+    if (dither)
+    {
+      dither->reduceSpan(ucGray, pDest + (x * iDestBpp) / 8, x, n, iDestBpp);
+    }
+    else
+    {
+      RowDither threshold;
+      threshold.reduceSpan(ucGray, pDest + (x * iDestBpp) / 8, x, n, iDestBpp);
+    }
+  }
+  if (dither)
+    dither->nextRow();
+}
@@ -0,0 +1,102 @@
+#include <png_planes.h>
+#include <string.h>
+
+//
+// Tables turning one byte of 2-bpp pixels into the 4 output bits of that byte,
+// in the low nibble, for each of the two_bit_plane_e conversions.
+//
+static const uint8_t ucPlane0Bits[256] = {
+0x00,0x01,0x00,0x01,0x02,0x03,0x02,0x03,0x00,0x01,0x00,0x01,0x02,0x03,0x02,0x03,
+0x04,0x05,0x04,0x05,0x06,0x07,0x06,0x07,0x04,0x05,0x04,0x05,0x06,0x07,0x06,0x07,
+0x00,0x01,0x00,0x01,0x02,0x03,0x02,0x03,0x00,0x01,0x00,0x01,0x02,0x03,0x02,0x03,
+0x04,0x05,0x04,0x05,0x06,0x07,0x06,0x07,0x04,0x05,0x04,0x05,0x06,0x07,0x06,0x07,
+0x08,0x09,0x08,0x09,0x0a,0x0b,0x0a,0x0b,0x08,0x09,0x08,0x09,0x0a,0x0b,0x0a,0x0b,
+0x0c,0x0d,0x0c,0x0d,0x0e,0x0f,0x0e,0x0f,0x0c,0x0d,0x0c,0x0d,0x0e,0x0f,0x0e,0x0f,
+0x08,0x09,0x08,0x09,0x0a,0x0b,0x0a,0x0b,0x08,0x09,0x08,0x09,0x0a,0x0b,0x0a,0x0b,
+0x0c,0x0d,0x0c,0x0d,0x0e,0x0f,0x0e,0x0f,0x0c,0x0d,0x0c,0x0d,0x0e,0x0f,0x0e,0x0f,
+0x00,0x01,0x00,0x01,0x02,0x03,0x02,0x03,0x00,0x01,0x00,0x01,0x02,0x03,0x02,0x03,
+0x04,0x05,0x04,0x05,0x06,0x07,0x06,0x07,0x04,0x05,0x04,0x05,0x06,0x07,0x06,0x07,
+0x00,0x01,0x00,0x01,0x02,0x03,0x02,0x03,0x00,0x01,0x00,0x01,0x02,0x03,0x02,0x03,
+0x04,0x05,0x04,0x05,0x06,0x07,0x06,0x07,0x04,0x05,0x04,0x05,0x06,0x07,0x06,0x07,
+0x08,0x09,0x08,0x09,0x0a,0x0b,0x0a,0x0b,0x08,0x09,0x08,0x09,0x0a,0x0b,0x0a,0x0b,
+0x0c,0x0d,0x0c,0x0d,0x0e,0x0f,0x0e,0x0f,0x0c,0x0d,0x0c,0x0d,0x0e,0x0f,0x0e,0x0f,
+0x08,0x09,0x08,0x09,0x0a,0x0b,0x0a,0x0b,0x08,0x09,0x08,0x09,0x0a,0x0b,0x0a,0x0b,
+0x0c,0x0d,0x0c,0x0d,0x0e,0x0f,0x0e,0x0f,0x0c,0x0d,0x0c,0x0d,0x0e,0x0f,0x0e,0x0f
+};
+
+static const uint8_t ucPlane1Bits[256] = {
+0x00,0x00,0x01,0x01,0x00,0x00,0x01,0x01,0x02,0x02,0x03,0x03,0x02,0x02,0x03,0x03,
+0x00,0x00,0x01,0x01,0x00,0x00,0x01,0x01,0x02,0x02,0x03,0x03,0x02,0x02,0x03,0x03,
+0x04,0x04,0x05,0x05,0x04,0x04,0x05,0x05,0x06,0x06,0x07,0x07,0x06,0x06,0x07,0x07,
+0x04,0x04,0x05,0x05,0x04,0x04,0x05,0x05,0x06,0x06,0x07,0x07,0x06,0x06,0x07,0x07,
+0x00,0x00,0x01,0x01,0x00,0x00,0x01,0x01,0x02,0x02,0x03,0x03,0x02,0x02,0x03,0x03,
+0x00,0x00,0x01,0x01,0x00,0x00,0x01,0x01,0x02,0x02,0x03,0x03,0x02,0x02,0x03,0x03,
+0x04,0x04,0x05,0x05,0x04,0x04,0x05,0x05,0x06,0x06,0x07,0x07,0x06,0x06,0x07,0x07,
+0x04,0x04,0x05,0x05,0x04,0x04,0x05,0x05,0x06,0x06,0x07,0x07,0x06,0x06,0x07,0x07,
+0x08,0x08,0x09,0x09,0x08,0x08,0x09,0x09,0x0a,0x0a,0x0b,0x0b,0x0a,0x0a,0x0b,0x0b,
+0x08,0x08,0x09,0x09,0x08,0x08,0x09,0x09,0x0a,0x0a,0x0b,0x0b,0x0a,0x0a,0x0b,0x0b,
+0x0c,0x0c,0x0d,0x0d,0x0c,0x0c,0x0d,0x0d,0x0e,0x0e,0x0f,0x0f,0x0e,0x0e,0x0f,0x0f,
+0x0c,0x0c,0x0d,0x0d,0x0c,0x0c,0x0d,0x0d,0x0e,0x0e,0x0f,0x0f,0x0e,0x0e,0x0f,0x0f,
+0x08,0x08,0x09,0x09,0x08,0x08,0x09,0x09,0x0a,0x0a,0x0b,0x0b,0x0a,0x0a,0x0b,0x0b,
+0x08,0x08,0x09,0x09,0x08,0x08,0x09,0x09,0x0a,0x0a,0x0b,0x0b,0x0a,0x0a,0x0b,0x0b,
+0x0c,0x0c,0x0d,0x0d,0x0c,0x0c,0x0d,0x0d,0x0e,0x0e,0x0f,0x0f,0x0e,0x0e,0x0f,0x0f,
+0x0c,0x0c,0x0d,0x0d,0x0c,0x0c,0x0d,0x0d,0x0e,0x0e,0x0f,0x0f,0x0e,0x0e,0x0f,0x0f
+};
+
+static const uint8_t ucNonzeroBits[256] = {
+0x00,0x01,0x01,0x01,0x02,0x03,0x03,0x03,0x02,0x03,0x03,0x03,0x02,0x03,0x03,0x03,
+0x04,0x05,0x05,0x05,0x06,0x07,0x07,0x07,0x06,0x07,0x07,0x07,0x06,0x07,0x07,0x07,
+0x04,0x05,0x05,0x05,0x06,0x07,0x07,0x07,0x06,0x07,0x07,0x07,0x06,0x07,0x07,0x07,
+0x04,0x05,0x05,0x05,0x06,0x07,0x07,0x07,0x06,0x07,0x07,0x07,0x06,0x07,0x07,0x07,
+0x08,0x09,0x09,0x09,0x0a,0x0b,0x0b,0x0b,0x0a,0x0b,0x0b,0x0b,0x0a,0x0b,0x0b,0x0b,
+0x0c,0x0d,0x0d,0x0d,0x0e,0x0f,0x0f,0x0f,0x0e,0x0f,0x0f,0x0f,0x0e,0x0f,0x0f,0x0f,
+0x0c,0x0d,0x0d,0x0d,0x0e,0x0f,0x0f,0x0f,0x0e,0x0f,0x0f,0x0f,0x0e,0x0f,0x0f,0x0f,
+0x0c,0x0d,0x0d,0x0d,0x0e,0x0f,0x0f,0x0f,0x0e,0x0f,0x0f,0x0f,0x0e,0x0f,0x0f,0x0f,
+0x08,0x09,0x09,0x09,0x0a,0x0b,0x0b,0x0b,0x0a,0x0b,0x0b,0x0b,0x0a,0x0b,0x0b,0x0b,
+0x0c,0x0d,0x0d,0x0d,0x0e,0x0f,0x0f,0x0f,0x0e,0x0f,0x0f,0x0f,0x0e,0x0f,0x0f,0x0f,
+0x0c,0x0d,0x0d,0x0d,0x0e,0x0f,0x0f,0x0f,0x0e,0x0f,0x0f,0x0f,0x0e,0x0f,0x0f,0x0f,
+0x0c,0x0d,0x0d,0x0d,0x0e,0x0f,0x0f,0x0f,0x0e,0x0f,0x0f,0x0f,0x0e,0x0f,0x0f,0x0f,
+0x08,0x09,0x09,0x09,0x0a,0x0b,0x0b,0x0b,0x0a,0x0b,0x0b,0x0b,0x0a,0x0b,0x0b,0x0b,
+0x0c,0x0d,0x0d,0x0d,0x0e,0x0f,0x0f,0x0f,0x0e,0x0f,0x0f,0x0f,0x0e,0x0f,0x0f,0x0f,
+0x0c,0x0d,0x0d,0x0d,0x0e,0x0f,0x0f,0x0f,0x0e,0x0f,0x0f,0x0f,0x0e,0x0f,0x0f,0x0f,
+0x0c,0x0d,0x0d,0x0d,0x0e,0x0f,0x0f,0x0f,0x0e,0x0f,0x0f,0x0f,0x0e,0x0f,0x0f,0x0f
+};
+
+void two_bit_to_one_bit(const uint8_t *src, uint8_t *dst, int width, uint8_t invert, two_bit_plane_e plane)
+{
+  const uint8_t *bits = plane == TWO_BIT_PLANE_0 ? ucPlane0Bits : (plane == TWO_BIT_PLANE_1 ? ucPlane1Bits : ucNonzeroBits);
+  int x;
+
+  // 8 pixels (2 source bytes) per output byte; dst[i] is written after src[2i] and src[2i+1] were read
+  for (x = 0; x + 8 <= width; x += 8)
+  {
+    uint8_t hi = bits[src[0] ^ invert];
+    uint8_t lo = bits[src[1] ^ invert];
+    *dst++ = (uint8_t)((hi << 4) | lo);
+    src += 2;
+  }
+  if (x < width)
+  {
+    // the last pixels, left aligned and padded with 0 bits
+    int left = width - x;
+    uint8_t uc = (uint8_t)(bits[src[0] ^ invert] << 4);
+    if (left > 4)
+      uc |= bits[src[1] ^ invert];
+    *dst = (uint8_t)(uc & (0xff << (8 - left)));
+  }
+}
+
+void invert_row(const uint8_t *src, uint8_t *dst, int len, uint8_t invert)
+{
+  uint32_t mask = invert * 0x01010101u;
+  int i = 0;
+  for (; i + 4 <= len; i += 4)
+  {
+    uint32_t word;
+    memcpy(&word, src + i, 4); // compiles to a single load when aligned
+    word ^= mask;
+    memcpy(dst + i, &word, 4);
+  }
+  for (; i < len; i++)
+    dst[i] = src[i] ^ invert;
+}
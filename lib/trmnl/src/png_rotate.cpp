@@ -0,0 +1,98 @@
+#include <png_rotate.h>
+#include <stdlib.h>
+#include <string.h>
+
+void transpose8x8(const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride)
+{
+  // the block as one 64-bit word, row 0 in the top byte; 3 rounds of swapping
+  // 1x1, 2x2 and 4x4 sub-blocks across the diagonal (Hacker's Delight, 7-3)
+  uint64_t x = 0, t;
+  for (int r = 0; r < 8; r++)
+    x = (x << 8) | src[r * src_stride];
+
+  t = (x ^ (x >> 7)) & 0x00aa00aa00aa00aaULL;
+  x = x ^ t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000cccc0000ccccULL;
+  x = x ^ t ^ (t << 14);
+  t = (x ^ (x >> 28)) & 0x00000000f0f0f0f0ULL;
+  x = x ^ t ^ (t << 28);
+
+  for (int c = 7; c >= 0; c--, x >>= 8)
+    dst[c * dst_stride] = (uint8_t)x;
+}
+
+PngRowRotator::PngRowRotator()
+    : width(0), height(0), pitch(0), write(nullptr), ctx(nullptr), pad(0xff), rows(nullptr), column(nullptr), y(0)
+{
+}
+
+PngRowRotator::~PngRowRotator()
+{
+  end();
+}
+
+bool PngRowRotator::begin(int width, int height, png_rotate_write_t write, void *ctx, uint8_t pad)
+{
+  end();
+  this->width = width;
+  this->height = height;
+  this->write = write;
+  this->ctx = ctx;
+  this->pad = pad;
+  pitch = (width + 7) / 8;
+  y = 0;
+  rows = (uint8_t *)malloc(8 * pitch);
+  column = (uint8_t *)malloc(pitch * 8); // the transposes write whole blocks, even past width
+  if (!rows || !column)
+  {
+    end();
+    return false;
+  }
+  return true;
+}
+
+void PngRowRotator::end()
+{
+  free(rows);
+  free(column);
+  rows = column = nullptr;
+}
+
+bool PngRowRotator::addRow(const uint8_t *row)
+{
+  if (!rows || y >= height)
+    return false;
+  memcpy(&rows[(y & 7) * pitch], row, pitch);
+  y++;
+  if ((y & 7) == 0)
+    return writeStripe();
+  return true;
+}
+
+bool PngRowRotator::flush()
+{
+  if (!rows || (y & 7) == 0)
+    return true;
+  for (int r = y & 7; r < 8; r++)
+    memset(&rows[r * pitch], pad, pitch);
+  y = (y + 7) & ~7;
+  return writeStripe();
+}
+
+bool PngRowRotator::writeStripe()
+{
+  // image column x lands on panel row width - 1 - x: transpose into reversed order, so
+  // column[0] is the rightmost image column
+  for (int b = 0; b < pitch; b++)
+  {
+    uint8_t block[8];
+    transpose8x8(&rows[b], pitch, block, 1);
+    for (int c = 0; c < 8; c++)
+    {
+      int x = b * 8 + c;
+      if (x < width)
+        column[width - 1 - x] = block[c];
+    }
+  }
+  return write(ctx, y - 8, column, width);
+}
@@ -0,0 +1,118 @@
+#include <png_row_store.h>
+#include <stdlib.h>
+#include <string.h>
+#include <trmnl_log.h>
+
+//
+// A table to accelerate the testing of 2-bit images for the number
+// of unique colors. Each entry sets bits 0-3 depending on the presence
+// of colors 0-3 in each 2-bit pixel
+//
+static const uint8_t ucTwoBitFlags[256] = {
+0x01,0x03,0x05,0x09,0x03,0x03,0x07,0x0b,0x05,0x07,0x05,0x0d,0x09,0x0b,0x0d,0x09,
+0x03,0x03,0x07,0x0b,0x03,0x03,0x07,0x0b,0x07,0x07,0x07,0x0f,0x0b,0x0b,0x0f,0x0b,
+0x05,0x07,0x05,0x0d,0x07,0x07,0x07,0x0f,0x05,0x07,0x05,0x0d,0x0d,0x0f,0x0d,0x0d,
+0x09,0x0b,0x0d,0x09,0x0b,0x0b,0x0f,0x0b,0x0d,0x0f,0x0d,0x0d,0x09,0x0b,0x0d,0x09,
+0x03,0x03,0x07,0x0b,0x03,0x03,0x07,0x0b,0x07,0x07,0x07,0x0f,0x0b,0x0b,0x0f,0x0b,
+0x03,0x03,0x07,0x0b,0x03,0x02,0x06,0x0a,0x07,0x06,0x06,0x0e,0x0b,0x0a,0x0e,0x0a,
+0x07,0x07,0x07,0x0f,0x07,0x06,0x06,0x0e,0x07,0x06,0x06,0x0e,0x0f,0x0e,0x0e,0x0e,
+0x0b,0x0b,0x0f,0x0b,0x0b,0x0a,0x0e,0x0a,0x0f,0x0e,0x0e,0x0e,0x0b,0x0a,0x0e,0x0a,
+0x05,0x07,0x05,0x0d,0x07,0x07,0x07,0x0f,0x05,0x07,0x05,0x0d,0x0d,0x0f,0x0d,0x0d,
+0x07,0x07,0x07,0x0f,0x07,0x06,0x06,0x0e,0x07,0x06,0x06,0x0e,0x0f,0x0e,0x0e,0x0e,
+0x05,0x07,0x05,0x0d,0x07,0x06,0x06,0x0e,0x05,0x06,0x04,0x0c,0x0d,0x0e,0x0c,0x0c,
+0x0d,0x0f,0x0d,0x0d,0x0f,0x0e,0x0e,0x0e,0x0d,0x0e,0x0c,0x0c,0x0d,0x0e,0x0c,0x0c,
+0x09,0x0b,0x0d,0x09,0x0b,0x0b,0x0f,0x0b,0x0d,0x0f,0x0d,0x0d,0x09,0x0b,0x0d,0x09,
+0x0b,0x0b,0x0f,0x0b,0x0b,0x0a,0x0e,0x0a,0x0f,0x0e,0x0e,0x0e,0x0b,0x0a,0x0e,0x0a,
+0x0d,0x0f,0x0d,0x0d,0x0f,0x0e,0x0e,0x0e,0x0d,0x0e,0x0c,0x0c,0x0d,0x0e,0x0c,0x0c,
+0x09,0x0b,0x0d,0x09,0x0b,0x0a,0x0e,0x0a,0x0d,0x0e,0x0c,0x0c,0x09,0x0a,0x0c,0x08
+};
+
+uint8_t png_two_bit_color_flags(const uint8_t *pixels, int width, uint8_t flags)
+{
+  for (int x = 0; x < width; x += 4)
+    flags |= ucTwoBitFlags[*pixels++]; // do 4 pixels at a time
+  return flags;
+}
+
+int png_two_bit_color_count(uint8_t flags)
+{
+  int count = 0;
+  for (int i = 0; i < 4; i++)
+    if (flags & (1 << i))
+      count++;
+  return count;
+}
+
+PngRowStore::PngRowStore() : rows(nullptr), width(0), height(0), bpp(0), pitch(0), stored(0), flags(0)
+{
+  memset(&info, 0, sizeof(info));
+}
+
+PngRowStore::~PngRowStore()
+{
+  end();
+}
+
+bool PngRowStore::begin(int width, int height, int bpp)
+{
+  end();
+  this->width = width;
+  this->height = height;
+  this->bpp = bpp;
+  pitch = (width * bpp + 7) / 8;
+  stored = 0;
+  flags = 0;
+  rows = (uint8_t *)malloc((size_t)pitch * height);
+  if (!rows)
+  {
+    Log_info("Not enough memory to keep %d bytes of decoded rows", pitch * height);
+    return false;
+  }
+  return true;
+}
+
+void PngRowStore::end()
+{
+  free(rows);
+  rows = nullptr;
+  stored = 0;
+}
+
+bool PngRowStore::addRow(PNGDRAW *pDraw)
+{
+  if (!rows || pDraw->y < 0 || pDraw->y >= height || pDraw->iWidth != width || pDraw->iBpp != bpp)
+    return false;
+
+  if (stored == 0)
+  {
+    info = *pDraw;
+    info.pUser = nullptr;
+  }
+  memcpy(rows + (size_t)pDraw->y * pitch, pDraw->pPixels, pitch);
+  if (bpp == 2 && pDraw->y <= PNG_COUNT_COLORS_MAX_Y)
+    flags = png_two_bit_color_flags(pDraw->pPixels, width, flags);
+  stored++;
+  return true;
+}
+
+bool PngRowStore::replay(PNG_DRAW_CALLBACK *draw, void *pUser)
+{
+  if (!complete())
+    return false;
+
+  PNGDRAW row = info;
+  row.pUser = pUser;
+  for (int y = 0; y < height; y++)
+  {
+    row.y = y;
+    row.pPixels = rows + (size_t)y * pitch;
+    if (!draw(&row))
+      return false;
+  }
+  return true;
+}
+
+int png_row_store_draw(PNGDRAW *pDraw)
+{
+  return ((PngRowStore *)pDraw->pUser)->addRow(pDraw) ? 1 : 0;
+}
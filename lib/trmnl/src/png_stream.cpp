@@ -0,0 +1,172 @@
+#include <png_stream.h>
+#include <stdlib.h>
+#include <string.h>
+#include <trmnl_log.h>
+
+PngStreamSource::PngStreamSource(HttpBodyReader &reader, int32_t max_size)
+    : reader(reader), max_size(max_size), stream_pos(0), pos(0), seek_failed(false), tee(nullptr), tee_ctx(nullptr)
+{
+  window = (uint8_t *)malloc(PNG_STREAM_REWIND_SIZE);
+}
+
+PngStreamSource::~PngStreamSource()
+{
+  free(window);
+}
+
+void PngStreamSource::setTee(png_stream_tee_t tee, void *ctx)
+{
+  this->tee = tee;
+  tee_ctx = ctx;
+}
+
+int32_t PngStreamSource::size() const
+{
+  int32_t expected = reader.expectedLength();
+  return expected > 0 ? expected : max_size;
+}
+
+bool PngStreamSource::failed() const
+{
+  return seek_failed || window == nullptr || reader.error() != BODY_READ_OK;
+}
+
+size_t PngStreamSource::pull(uint8_t *dst, size_t len)
+{
+  size_t n = reader.read(dst, len);
+  if (n == 0)
+    return 0;
+
+  // remember the tail of what went by for backward seeks
+  for (size_t i = 0; i < n; i++)
+  {
+    window[(stream_pos + i) % PNG_STREAM_REWIND_SIZE] = dst[i];
+  }
+  if (tee)
+    tee(tee_ctx, dst, n);
+  palette.feed(dst, n);
+  stream_pos += n;
+  return n;
+}
+
+int32_t PngStreamSource::read(uint8_t *dst, int32_t len)
+{
+  if (window == nullptr || len <= 0)
+    return 0;
+
+  size_t done = 0;
+
+  // replay from the rewind window first
+  while (pos < stream_pos && done < (size_t)len)
+  {
+    dst[done++] = window[pos % PNG_STREAM_REWIND_SIZE];
+    pos++;
+  }
+
+  if (done < (size_t)len)
+  {
+    size_t n = pull(dst + done, (size_t)len - done);
+    done += n;
+    pos += n;
+  }
+
+  return (int32_t)done;
+}
+
+int32_t PngStreamSource::seek(int32_t position)
+{
+  if (position < 0 || window == nullptr)
+    return -1;
+
+  size_t target = (size_t)position;
+  size_t oldest = stream_pos > PNG_STREAM_REWIND_SIZE ? stream_pos - PNG_STREAM_REWIND_SIZE : 0;
+
+  if (target < oldest)
+  {
+    Log_error("PNG stream can't seek back to %d (oldest buffered byte is %d)", position, (int)oldest);
+    seek_failed = true;
+    return -1;
+  }
+
+  // skip forward by reading and discarding
+  uint8_t scratch[64];
+  while (stream_pos < target)
+  {
+    size_t want = target - stream_pos;
+    if (want > sizeof(scratch))
+      want = sizeof(scratch);
+    if (pull(scratch, want) == 0)
+      break;
+  }
+
+  pos = target < stream_pos ? target : stream_pos;
+  return (int32_t)pos;
+}
+
+body_read_err_e PngStreamSource::bufferAll(uint8_t *buf, size_t capacity, size_t *received)
+{
+  *received = 0;
+  if (window == nullptr || stream_pos > PNG_STREAM_REWIND_SIZE)
+  {
+    // the start of the file is gone; only possible if this was called mid-decode
+    return BODY_READ_MALFORMED;
+  }
+  if (stream_pos > capacity)
+    return BODY_READ_TOO_BIG;
+
+  memcpy(buf, window, stream_pos);
+
+  size_t n = 0;
+  body_read_err_e err = reader.readAll(buf + stream_pos, capacity - stream_pos, &n);
+  if (tee && n > 0)
+    tee(tee_ctx, buf + stream_pos, n);
+  palette.feed(buf + stream_pos, n);
+  stream_pos += n;
+  pos = stream_pos;
+  *received = stream_pos;
+
+  if (err == BODY_READ_EMPTY)
+    err = stream_pos > 0 ? BODY_READ_OK : BODY_READ_EMPTY;
+  return err;
+}
+
+size_t PngStreamSource::finish()
+{
+  uint8_t scratch[64];
+  size_t drained = 0;
+  size_t n;
+  while (window && (n = pull(scratch, sizeof(scratch))) > 0)
+  {
+    drained += n;
+  }
+  pos = stream_pos;
+  return drained;
+}
+
+void *png_stream_open(const char *szFilename, int32_t *pFileSize)
+{
+  PngStreamSource *source = (PngStreamSource *)szFilename;
+  *pFileSize = source->size();
+  return source;
+}
+
+void png_stream_close(void *pHandle)
+{
+  // the source is owned by the caller
+}
+
+int32_t png_stream_read(PNGFILE *pFile, uint8_t *pBuf, int32_t iLen)
+{
+  PngStreamSource *source = (PngStreamSource *)pFile->fHandle;
+  int32_t n = source->read(pBuf, iLen);
+  pFile->iPos = source->position();
+  return n;
+}
+
+int32_t png_stream_seek(PNGFILE *pFile, int32_t iPosition)
+{
+  PngStreamSource *source = (PngStreamSource *)pFile->fHandle;
+  int32_t rc = source->seek(iPosition);
+  pFile->iPos = source->position();
+  return rc;
+}
@@ -0,0 +1,134 @@
+#include <resumable_download.h>
+#include <stdlib.h>
+#include <string.h>
+#include <trmnl_log.h>
+
+static bool parse_number(const char **p, uint32_t *value)
+{
+  if (**p < '0' || **p > '9')
+    return false;
+  char *end;
+  unsigned long n = strtoul(*p, &end, 10);
+  if (n > UINT32_MAX)
+    return false;
+  *value = (uint32_t)n;
+  *p = end;
+  return true;
+}
+
+bool parse_content_range(const char *value, uint32_t *first, uint32_t *last, uint32_t *total)
+{
+  const char *p = value;
+  if (strncmp(p, "bytes ", 6) != 0)
+    return false;
+  p += 6;
+  if (!parse_number(&p, first) || *p++ != '-')
+    return false;
+  if (!parse_number(&p, last) || *p++ != '/')
+    return false;
+  if (!parse_number(&p, total) || *p != 0)
+    return false;
+  return *first <= *last && *last < *total;
+}
+
+static bool strong_etag(const String &etag)
+{
+  return etag.length() > 0 && !etag.startsWith("W/") && etag.length() < IMAGE_ETAG_MAX_LEN;
+}
+
+ResumableDownload::ResumableDownload(PartialDownloadStore &store) : store(store), offset(0)
+{
+  memset(&meta, 0, sizeof(meta));
+}
+
+size_t ResumableDownload::prepare(const char *url, String &etag)
+{
+  offset = 0;
+  etag = "";
+  if (!store.readMeta(meta) || meta.magic != PARTIAL_DOWNLOAD_MAGIC)
+    return 0;
+
+  size_t stored = store.bodySize();
+  if (meta.url_hash != image_url_hash(url) || stored == 0 || stored >= meta.total)
+  {
+    // another image by now (or nothing useful): don't let it take flash space any longer
+    discard();
+    return 0;
+  }
+
+  offset = stored;
+  etag = meta.etag;
+  Log_info("Resuming download at %d of %d bytes", offset, meta.total);
+  return offset;
+}
+
+resume_decision_e ResumableDownload::onResponse(int http_code, const char *content_range)
+{
+  if (offset == 0)
+    return RESUME_NONE;
+
+  if (http_code == 206)
+  {
+    uint32_t first, last, total;
+    if (parse_content_range(content_range, &first, &last, &total) &&
+        first == offset && last == total - 1 && total == meta.total)
+      return RESUME_CONTINUE;
+  }
+  else if (http_code != 416)
+  {
+    // 200: If-Range didn't match, the image changed. Other codes are plain errors,
+    // the stored bytes are still good for the next attempt.
+    if (http_code == 200)
+    {
+      Log_info("Image changed since the interrupted download, starting over");
+      discard();
+    }
+    return RESUME_NONE;
+  }
+
+  Log_error("Range request not honored (%d, '%s'), dropping %d stored bytes", http_code, content_range, offset);
+  discard();
+  return RESUME_MISMATCH;
+}
+
+bool ResumableDownload::restore(uint8_t *buf, size_t capacity)
+{
+  if (offset == 0 || offset > capacity)
+    return false;
+  return store.readBody(buf, offset);
+}
+
+bool ResumableDownload::keep(const char *url, const String &etag, size_t total, const uint8_t *data, size_t received)
+{
+  if (!strong_etag(etag) || total == 0 || received == 0 || received >= total)
+  {
+    discard();
+    return false;
+  }
+
+  if (data != nullptr && !store.writeBody(data, received))
+  {
+    discard();
+    return false;
+  }
+
+  memset(&meta, 0, sizeof(meta));
+  meta.magic = PARTIAL_DOWNLOAD_MAGIC;
+  meta.url_hash = image_url_hash(url);
+  meta.total = total;
+  memcpy(meta.etag, etag.c_str(), etag.length() + 1);
+  if (!store.writeMeta(meta))
+  {
+    discard();
+    return false;
+  }
+
+  Log_info("Kept %d of %d bytes to resume the download later", received, total);
+  return true;
+}
+
+void ResumableDownload::discard()
+{
+  offset = 0;
+  store.remove();
+}
@@ -0,0 +1,115 @@
+#include <tls_session_cache.h>
+#include <string.h>
+
+static uint32_t host_hash(const char *host)
+{
+  uint32_t hash = 2166136261u;
+  for (const char *p = host; p && *p; p++)
+  {
+    hash ^= (uint8_t)*p;
+    hash *= 16777619u;
+  }
+  return hash == 0 ? 1 : hash;
+}
+
+TlsSessionCache::TlsSessionCache(TlsSessionCacheRtc &rtc, uint32_t (*now_s)()) : rtc(rtc), now_s(now_s) {}
+
+void TlsSessionCache::init()
+{
+  if (rtc.magic != TLS_SESSION_CACHE_MAGIC)
+  {
+    memset(&rtc, 0, sizeof(rtc));
+    rtc.magic = TLS_SESSION_CACHE_MAGIC;
+  }
+}
+
+bool TlsSessionCache::expired(const TlsSessionEntry &entry, uint32_t now) const
+{
+  // the clock may have been set (or reset) since the session was saved
+  return now < entry.saved_at || now >= entry.expires_at;
+}
+
+const TlsSessionEntry *TlsSessionCache::find(const char *host)
+{
+  init();
+  uint32_t hash = host_hash(host);
+  uint32_t now = now_s();
+
+  for (int i = 0; i < TLS_SESSION_CACHE_ENTRIES; i++)
+  {
+    TlsSessionEntry &entry = rtc.entries[i];
+    if (entry.host_hash != hash)
+      continue;
+    if (expired(entry, now))
+    {
+      entry.host_hash = 0;
+      return nullptr;
+    }
+    return &entry;
+  }
+  return nullptr;
+}
+
+bool TlsSessionCache::store(const char *host, const uint8_t *data, size_t size, uint32_t lifetime_s)
+{
+  init();
+  if (size == 0 || size > TLS_SESSION_MAX_SIZE)
+  {
+    forget(host);
+    return false;
+  }
+
+  uint32_t hash = host_hash(host);
+  uint32_t now = now_s();
+
+  // same host, else a free or expired slot, else the oldest one
+  TlsSessionEntry *slot = nullptr;
+  for (int i = 0; i < TLS_SESSION_CACHE_ENTRIES && slot == nullptr; i++)
+  {
+    if (rtc.entries[i].host_hash == hash)
+      slot = &rtc.entries[i];
+  }
+  for (int i = 0; i < TLS_SESSION_CACHE_ENTRIES && slot == nullptr; i++)
+  {
+    if (rtc.entries[i].host_hash == 0 || expired(rtc.entries[i], now))
+      slot = &rtc.entries[i];
+  }
+  if (slot == nullptr)
+  {
+    slot = &rtc.entries[0];
+    for (int i = 1; i < TLS_SESSION_CACHE_ENTRIES; i++)
+    {
+      if (rtc.entries[i].saved_at < slot->saved_at)
+        slot = &rtc.entries[i];
+    }
+  }
+
+  if (lifetime_s == 0 || lifetime_s > TLS_SESSION_MAX_AGE_S)
+    lifetime_s = TLS_SESSION_MAX_AGE_S;
+
+  slot->host_hash = hash;
+  slot->saved_at = now;
+  slot->expires_at = now + lifetime_s;
+  slot->size = (uint16_t)size;
+  memcpy(slot->data, data, size);
+  return true;
+}
+
+void TlsSessionCache::forget(const char *host)
+{
+  init();
+  uint32_t hash = host_hash(host);
+  for (int i = 0; i < TLS_SESSION_CACHE_ENTRIES; i++)
+  {
+    if (rtc.entries[i].host_hash == hash)
+      rtc.entries[i].host_hash = 0;
+  }
+}
+
+void TlsSessionCache::recordHandshake(bool resumed, uint32_t ms)
+{
+  init();
+  TlsHandshakeStats &stats = resumed ? rtc.resumed : rtc.full;
+  stats.count++;
+  stats.total_ms += ms;
+}
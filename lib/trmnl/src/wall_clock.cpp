@@ -0,0 +1,97 @@
+#include <wall_clock.h>
+#include <string.h>
+
+static int64_t abs64(int64_t value)
+{
+  return value < 0 ? -value : value;
+}
+
+WallClock::WallClock(WallClockRtc &rtc, const WallClockOptions &options)
+    : rtc(rtc), options(options)
+{
+}
+
+void WallClock::init()
+{
+  if (rtc.magic != WALL_CLOCK_MAGIC)
+  {
+    memset(&rtc, 0, sizeof(rtc));
+    rtc.magic = WALL_CLOCK_MAGIC;
+    rtc.uncertainty_ppm = options.initial_uncertainty_ppm;
+  }
+}
+
+bool WallClock::valid(int64_t local)
+{
+  init();
+  // a local clock behind the last sync was reset (e.g. by a power loss)
+  return rtc.synced && local >= rtc.synced_at_ms;
+}
+
+int64_t WallClock::corrected(int64_t local)
+{
+  return local + (local - rtc.synced_at_ms) * rtc.drift_ppm / 1000000;
+}
+
+void WallClock::wake()
+{
+  init();
+  if (rtc.wakes_since_sync < UINT16_MAX)
+    rtc.wakes_since_sync++;
+}
+
+bool WallClock::syncNeeded()
+{
+  if (!valid(options.local_ms()))
+    return true;
+  if (rtc.wakes_since_sync >= options.sync_every_wakes)
+    return true;
+  return estimatedErrorMs() > (int64_t)options.max_error_ms;
+}
+
+int64_t WallClock::nowMs()
+{
+  int64_t local = options.local_ms();
+  return valid(local) ? corrected(local) : 0;
+}
+
+int64_t WallClock::estimatedErrorMs()
+{
+  int64_t local = options.local_ms();
+  if (!valid(local))
+    return -1;
+  return (local - rtc.synced_at_ms) * rtc.uncertainty_ppm / 1000000;
+}
+
+void WallClock::onSync(int64_t local_before_ms, int64_t synced_ms)
+{
+  init();
+  if (valid(local_before_ms))
+  {
+    rtc.last_error_ms = (int32_t)(corrected(local_before_ms) - synced_ms);
+
+    int64_t elapsed = local_before_ms - rtc.synced_at_ms;
+    if (elapsed >= (int64_t)options.min_sample_ms)
+    {
+      int64_t measured = (synced_ms - local_before_ms) * 1000000 / elapsed;
+      if (abs64(measured) <= WALL_CLOCK_MAX_DRIFT_PPM)
+      {
+        // the uncertainty follows how far the measurements stray from the estimate
+        int64_t deviation = abs64(measured - rtc.drift_ppm);
+        int64_t uncertainty = (3 * (int64_t)rtc.uncertainty_ppm + deviation) / 4;
+        rtc.uncertainty_ppm = uncertainty < options.min_uncertainty_ppm ? options.min_uncertainty_ppm : (int32_t)uncertainty;
+        rtc.drift_ppm = rtc.samples == 0 ? (int32_t)measured : (int32_t)((3 * (int64_t)rtc.drift_ppm + measured) / 4);
+        if (rtc.samples < UINT8_MAX)
+          rtc.samples++;
+      }
+    }
+  }
+  else
+  {
+    rtc.last_error_ms = 0;
+  }
+
+  rtc.synced = 1;
+  rtc.synced_at_ms = synced_ms;
+  rtc.wakes_since_sync = 0;
+}
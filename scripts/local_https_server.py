@@ -0,0 +1,264 @@
+#!/usr/bin/env python3
+"""
+Local HTTPS server for checking connection reuse, TLS session resumption and
+resumable image downloads.
+
+Every request is answered with a small JSON body. Every connection is reported
+as a full or resumed handshake, and every request with the connection that
+carried it. Point the device at it (API URL https://<this machine>:<port>) and
+compare with its "TLS handshake with ..." and "Closing HTTP connections" logs.
+
+With --image, /api/display points the device at that image, which is served
+with an ETag and honors Range / If-Range. --truncate cuts every image response
+at a random offset, like a connection dropping on weak WiFi, so the device has
+to resume the download over several wakes. A device that offers the display
+envelope in Accept gets the image in the /api/display response itself (see
+lib/trmnl/include/display_envelope.h); --no-envelope answers with JSON only.
+
+    python3 scripts/local_https_server.py --port 8443
+    python3 scripts/local_https_server.py --image screen.png --truncate
+    python3 scripts/local_https_server.py --self-test
+"""
+
+import argparse
+import hashlib
+import http.server
+import os
+import random
+import re
+import struct
+import socket
+import ssl
+import subprocess
+import sys
+import tempfile
+import threading
+
+stats = {"full": 0, "resumed": 0, "requests": 0, "image_bytes": 0}
+image = {"data": None, "etag": None, "truncate": False, "envelope": True}
+
+ENVELOPE_TYPE = "application/vnd.trmnl.display-envelope"
+ENVELOPE_IMAGE_TYPES = {b"BM": 1, b"\x89P": 2, b"\xff\xd8": 3}
+
+
+def envelope(metadata, data):
+    """Header, /api/display JSON, image: the layout described in display_envelope.h"""
+    image_type = ENVELOPE_IMAGE_TYPES.get(data[:2], 0) if data else 0
+    return b"TRME" + struct.pack("<BBHII", 1, image_type, 0, len(metadata), len(data)) + metadata + data
+
+
+def make_certificate(directory):
+    cert = os.path.join(directory, "cert.pem")
+    key = os.path.join(directory, "key.pem")
+    subprocess.run(
+        ["openssl", "req", "-x509", "-newkey", "ec", "-pkeyopt", "ec_paramgen_curve:prime256v1",
+         "-nodes", "-days", "1", "-subj", "/CN=localhost", "-keyout", key, "-out", cert],
+        check=True, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    return cert, key
+
+
+class Handler(http.server.BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+
+    def setup(self):
+        super().setup()
+        kind = "resumed" if self.connection.session_reused else "full"
+        stats[kind] += 1
+        self.number = stats["full"] + stats["resumed"]
+        print(f"{self.client_address[0]}: connection {self.number}, {kind} handshake "
+              f"({self.connection.version()}, {stats['full']} full / {stats['resumed']} resumed so far)", flush=True)
+
+    def do_GET(self):
+        stats["requests"] += 1
+        length = int(self.headers.get("Content-Length", 0))
+        if length:
+            self.rfile.read(length)
+        print(f"  connection {self.number}: {self.command} {self.path} "
+              f"({stats['requests']} requests over {stats['full'] + stats['resumed']} connections)", flush=True)
+
+        if self.path.startswith("/image") and image["data"] is not None:
+            self.send_image()
+            return
+
+        # HTTP/1.1 keep-alive unless the client asks to close
+        body = b'{"status":0}'
+        if image["data"] is not None:
+            url = f"https://{self.headers.get('Host', 'localhost')}/image.png"
+            body = (f'{{"status":0,"image_url":"{url}","filename":"{image["etag"][1:-1]}",'
+                    f'"refresh_rate":60}}').encode()
+        content_type = "application/json"
+        if image["data"] is not None and image["envelope"] and ENVELOPE_TYPE in self.headers.get("Accept", ""):
+            body = envelope(body, image["data"])
+            content_type = ENVELOPE_TYPE
+            print(f"  envelope: {len(body)} bytes, image included", flush=True)
+        self.send_response(200)
+        self.send_header("Content-Type", content_type)
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+    do_POST = do_GET
+
+    def send_image(self):
+        data = image["data"]
+        start = 0
+        match = re.fullmatch(r"bytes=(\d+)-", self.headers.get("Range", ""))
+        # If-Range: the range only applies if the client has bytes of this very image
+        if match and self.headers.get("If-Range") == image["etag"]:
+            start = int(match.group(1))
+            if start >= len(data):
+                self.send_response(416)
+                self.send_header("Content-Range", f"bytes */{len(data)}")
+                self.send_header("Content-Length", "0")
+                self.end_headers()
+                return
+            self.send_response(206)
+            self.send_header("Content-Range", f"bytes {start}-{len(data) - 1}/{len(data)}")
+        else:
+            self.send_response(200)
+        self.send_header("Content-Type", "image/png")
+        self.send_header("ETag", image["etag"])
+        self.send_header("Content-Length", str(len(data) - start))
+        self.end_headers()
+
+        end = len(data)
+        if image["truncate"]:
+            end = random.randrange(start, len(data))
+            self.close_connection = True
+        self.wfile.write(data[start:end])
+        stats["image_bytes"] += end - start
+        print(f"  image: sent bytes {start}-{end} of {len(data)}" + (" (truncated)" if end < len(data) else ""), flush=True)
+
+    def log_message(self, format, *args):
+        pass
+
+
+def make_server(port, directory):
+    cert, key = make_certificate(directory)
+    context = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+    # mbedtls 2.x on the device only speaks TLS 1.2
+    context.maximum_version = ssl.TLSVersion.TLSv1_2
+    context.load_cert_chain(cert, key)
+    server = http.server.ThreadingHTTPServer(("0.0.0.0", port), Handler)
+    server.socket = context.wrap_socket(server.socket, server_side=True)
+    return server
+
+
+def self_test(port):
+    """
+    Connects three times, offering the session of the previous connection,
+    and sends two requests over the last connection.
+    """
+    context = ssl.SSLContext(ssl.PROTOCOL_TLS_CLIENT)
+    context.check_hostname = False
+    context.verify_mode = ssl.CERT_NONE
+    session = None
+    for i in range(3):
+        with socket.create_connection(("127.0.0.1", port)) as raw:
+            with context.wrap_socket(raw, server_hostname="localhost", session=session) as tls:
+                if i == 2:
+                    tls.sendall(b"GET /api/display HTTP/1.1\r\nHost: localhost\r\n\r\n")
+                    tls.recv(4096)
+                tls.sendall(b"GET /api/log HTTP/1.1\r\nHost: localhost\r\nConnection: close\r\n\r\n")
+                while tls.recv(4096):
+                    pass
+                session = tls.session
+    return stats["full"] == 1 and stats["resumed"] == 2 and stats["requests"] == 4
+
+
+def set_image(data, truncate):
+    image["data"] = data
+    image["etag"] = '"' + hashlib.sha1(data).hexdigest()[:16] + '"'
+    image["truncate"] = truncate
+
+
+def fetch(port, path, headers):
+    """One request over a new connection; returns status, headers and whatever body arrived"""
+    context = ssl.SSLContext(ssl.PROTOCOL_TLS_CLIENT)
+    context.check_hostname = False
+    context.verify_mode = ssl.CERT_NONE
+    with socket.create_connection(("127.0.0.1", port)) as raw:
+        with context.wrap_socket(raw, server_hostname="localhost") as tls:
+            request = f"GET {path} HTTP/1.1\r\nHost: localhost\r\nConnection: close\r\n"
+            request += "".join(f"{k}: {v}\r\n" for k, v in headers.items()) + "\r\n"
+            tls.sendall(request.encode())
+            response = b""
+            while True:
+                chunk = tls.recv(4096)
+                if not chunk:
+                    break
+                response += chunk
+    head, _, body = response.partition(b"\r\n\r\n")
+    lines = head.decode().split("\r\n")
+    fields = dict(line.split(": ", 1) for line in lines[1:])
+    return int(lines[0].split()[1]), fields, body
+
+
+def self_test_resume(port):
+    """Downloads a truncated image the way the device does: keep what arrived, ask for the rest"""
+    set_image(os.urandom(50000), truncate=True)
+    received, etag = b"", None
+    for _ in range(200):
+        headers = {"Range": f"bytes={len(received)}-", "If-Range": etag} if received else {}
+        status, fields, body = fetch(port, "/image.png", headers)
+        if status == 200:
+            received = b""
+        elif status != 206:
+            return False
+        received += body
+        etag = fields["ETag"]
+        if len(received) == len(image["data"]):
+            break
+        if len(received) > len(image["data"]) * 0.9:
+            image["truncate"] = False
+    return received == image["data"] and stats["image_bytes"] == len(image["data"])
+
+
+def self_test_envelope(port):
+    """Both forms of /api/display: an envelope when offered, JSON with image_url otherwise"""
+    set_image(b"\x89PNG\r\n\x1a\n" + os.urandom(20000), truncate=False)
+    status, fields, body = fetch(port, "/api/display", {"Accept": ENVELOPE_TYPE + ", application/json"})
+    if status != 200 or fields["Content-Type"] != ENVELOPE_TYPE or body[:4] != b"TRME":
+        return False
+    version, image_type, _, metadata_length, image_length = struct.unpack("<BBHII", body[4:16])
+    metadata = body[16:16 + metadata_length]
+    if (version, image_type) != (1, 2) or body[16 + metadata_length:] != image["data"]:
+        return False
+    if b"image_url" not in metadata or image_length != len(image["data"]):
+        return False
+
+    status, fields, body = fetch(port, "/api/display", {})
+    return status == 200 and fields["Content-Type"] == "application/json" and b"image_url" in body
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--port", type=int, default=8443)
+    parser.add_argument("--image", help="PNG to send as the screen image")
+    parser.add_argument("--truncate", action="store_true", help="cut image responses at a random offset")
+    parser.add_argument("--no-envelope", action="store_true", help="never send the image with /api/display")
+    parser.add_argument("--self-test", action="store_true", help="check session resumption and ranged downloads, then exit")
+    args = parser.parse_args()
+
+    if args.image:
+        with open(args.image, "rb") as f:
+            set_image(f.read(), args.truncate)
+        image["envelope"] = not args.no_envelope
+
+    with tempfile.TemporaryDirectory() as directory:
+        server = make_server(0 if args.self_test else args.port, directory)
+        if not args.self_test:
+            print(f"listening on port {args.port}", flush=True)
+            server.serve_forever()
+            return
+
+        threading.Thread(target=server.serve_forever, daemon=True).start()
+        port = server.server_address[1]
+        ok = self_test(port) and self_test_resume(port) and self_test_envelope(port)
+        server.shutdown()
+        print("self-test " + ("passed" if ok else "FAILED"))
+        sys.exit(0 if ok else 1)
+
+
+if __name__ == "__main__":
+    main()
@@ -4,10 +4,20 @@
 #include <WiFiClientSecure.h>
 #include <config.h>
 #include <api_response_parsing.h>
+#include <display_envelope.h>
+#include <image_formats.h>
 #include <http_client.h>
+#include <wifi_client_source.h>
+
+// Filter and document of the /api/display response; static so parsing it never grows the heap
+static uint8_t apiDisplayJsonBuffer[API_DISPLAY_JSON_ARENA_SIZE];
+static JsonArena apiDisplayJsonArena(apiDisplayJsonBuffer, sizeof(apiDisplayJsonBuffer));
 
 void addHeaders(HTTPClient &https, ApiDisplayInputs &inputs)
 {
+  char imageFormats[IMAGE_FORMATS_HEADER_MAX_LEN];
+  image_formats_header(inputs.imageFormats, imageFormats, sizeof(imageFormats));
+
   Log_info("Added headers:\n\r"
            "ID: %s\n\r"
            "Special function: %d\n\r"
@@ -16,7 +26,8 @@ void addHeaders(HTTPClient &https, ApiDisplayInputs &inputs)
            "Battery-Voltage: %s\n\r"
            "FW-Version: %s\r\n"
            "Model: %s\r\n"
-           "RSSI: %s\r\n",
+           "RSSI: %s\r\n"
+           "Image-Formats: %s\r\n",
            inputs.macAddress.c_str(),
            inputs.specialFunction,
            inputs.apiKey.c_str(),
@@ -24,7 +35,8 @@ void addHeaders(HTTPClient &https, ApiDisplayInputs &inputs)
            String(inputs.batteryVoltage).c_str(),
            inputs.firmwareVersion.c_str(),
            inputs.model.c_str(),
-           String(inputs.rssi));
+           String(inputs.rssi),
+           imageFormats);
 
   https.addHeader("ID", inputs.macAddress);
   https.addHeader("Content-Type", "application/json");
@@ -36,6 +48,10 @@ void addHeaders(HTTPClient &https, ApiDisplayInputs &inputs)
   https.addHeader("RSSI", String(inputs.rssi));
   https.addHeader("Width", String(inputs.displayWidth));
   https.addHeader("Height", String(inputs.displayHeight));
+  // what the server may render to: G5 is smaller and cheaper to decode than PNG for text
+  https.addHeader(IMAGE_FORMATS_HEADER, imageFormats);
+  // the image may come in the same response (see display_envelope.h)
+  https.addHeader("Accept", DISPLAY_ENVELOPE_CONTENT_TYPE ", application/json");
 
   if (inputs.specialFunction != SF_NONE)
   {
@@ -44,12 +60,12 @@ void addHeaders(HTTPClient &https, ApiDisplayInputs &inputs)
   }
 }
 
-ApiDisplayResult fetchApiDisplay(ApiDisplayInputs &apiDisplayInputs)
+ApiDisplayResult fetchApiDisplay(ApiDisplayInputs &apiDisplayInputs, InlineImageHandler onInlineImage)
 {
 
   return withHttp(
       apiDisplayInputs.baseUrl + "/api/display",
-      [&apiDisplayInputs](HTTPClient *https, HttpError error) -> ApiDisplayResult
+      [&apiDisplayInputs, &onInlineImage](HTTPClient *https, HttpError error) -> ApiDisplayResult
       {
         if (error == HttpError::HTTPCLIENT_WIFICLIENT_ERROR)
         {
@@ -74,6 +90,8 @@ ApiDisplayResult fetchApiDisplay(ApiDisplayInputs &apiDisplayInputs)
         https->setConnectTimeout(15000);
 
         addHeaders(*https, apiDisplayInputs);
+        const char *headers[] = {"Transfer-Encoding", "Content-Type"};
+        https->collectHeaders(headers, 2);
 
         delay(5);
 
@@ -106,14 +124,51 @@ ApiDisplayResult fetchApiDisplay(ApiDisplayInputs &apiDisplayInputs)
         // HTTP header has been send and Server response header has been handled
         Log_info("GET... code: %d", httpCode);
 
-        String payload = https->getString();
-        size_t size = https->getSize();
+        int size = https->getSize();
+        bool chunked = https->header("Transfer-Encoding").equalsIgnoreCase("chunked");
         Log_info("Content size: %d", size);
         Log_info("Free heap size: %d", ESP.getFreeHeap());
         Log_info("Free PSRAM size: %d", ESP.getFreePsram());
-        Log_info("Payload - %s", payload.c_str());
 
-        auto apiResponse = parseResponse_apiDisplay(payload);
+        // Parsed as it arrives: the payload itself is never held in memory
+        WiFiClientSource source(*https->getStreamPtr());
+        HttpBodyReader body(source, chunked ? -1 : size, chunked, downloadReaderOptions(15000, 15000));
+
+        if (is_display_envelope(https->header("Content-Type").c_str()))
+        {
+          DisplayEnvelopeHeader envelope;
+          ApiDisplayResponse response;
+          display_envelope_err_e envelope_error = read_display_envelope(body, apiDisplayJsonArena, &envelope, &response);
+          if (envelope_error != ENVELOPE_OK)
+          {
+            return ApiDisplayResult{
+                .error = https_request_err_e::HTTPS_JSON_PARSING_ERR,
+                .response = {},
+                .error_detail = "Envelope read failed with error: " + String(envelope_error) + " " + response.error_detail};
+          }
+
+          ApiDisplayResult result = {
+              .error = https_request_err_e::HTTPS_NO_ERR,
+              .response = response,
+              .error_detail = ""};
+          if (display_envelope_has_image(envelope))
+          {
+            InlineImage image = {body, envelope.image_type, envelope.image_length};
+            result.image_inline = true;
+            result.image_result = onInlineImage(result.response, image);
+            // the wake is done with the API once the image is in: close rather than read past what's left
+            https->setReuse(false);
+            return result;
+          }
+
+          // read past the end of the envelope so the connection stays usable
+          HttpBodyStream rest(body);
+          rest.finish();
+          return result;
+        }
+
+        auto apiResponse = parseResponse_apiDisplay(body, apiDisplayJsonArena);
+        Log_info("JSON arena peak: %d of %d bytes", apiDisplayJsonArena.peak(), apiDisplayJsonArena.capacity());
 
         if (apiResponse.outcome == ApiDisplayOutcome::DeserializationError)
         {
@@ -17,6 +17,7 @@
 #include <cstdint>
 #include "png.h"
 #include <bmp.h>
+#include <image_formats.h>
 #include <Update.h>
 #include <math.h>
 #include <filesystem.h>
@@ -31,10 +32,19 @@
 #include <SPIFFS.h>
 #include "http_client.h"
 #include <api-client/display.h>
+#include <display_envelope.h>
 #include "driver/gpio.h"
 #include <nvs.h>
 #include <serialize_log.h>
 #include <preferences_persistence.h>
+#include <wifi_client_source.h>
+#include <image_validators.h>
+#include <partial_download_store.h>
+#include <tls_session_resume.h>
+#include <udp_dns_resolver.h>
+#include <clock_service.h>
+#include <phase_timer.h>
+#include <rtc_budget.h>
 #include "logo_small.h"
 #include "logo_medium.h"
 #include "loading.h"
@@ -66,8 +76,27 @@ RTC_DATA_ATTR uint8_t need_to_refresh_display = 1;
 Preferences preferences;
 PreferencesPersistence preferencesPersistence(preferences);
 StoredLogs storedLogs(LOG_MAX_NOTES_NUMBER / 2, LOG_MAX_NOTES_NUMBER / 2, PREFERENCES_LOG_KEY, PREFERENCES_LOG_BUFFER_HEAD_KEY, preferencesPersistence);
+RTC_DATA_ATTR ImageValidatorsRtc image_validators_rtc;
+static_assert(sizeof(need_to_refresh_display) + sizeof(image_validators_rtc) <= RTC_BUDGET_BL, "bl.cpp RTC data over its share (rtc_budget.h)");
+ImageValidatorStore imageValidators(image_validators_rtc, PREFERENCES_IMAGE_ETAG_KEY, PREFERENCES_IMAGE_LAST_MODIFIED_KEY, PREFERENCES_IMAGE_URL_KEY, preferencesPersistence);
+SpiffsPartialStore partialDownloadStore;
+ResumableDownload resumableDownload(partialDownloadStore);
+
+// What is known about an image body before it is read
+struct ImageBody
+{
+  int content_size;   // size of the whole image, <= 0 if unknown
+  bool isPNG;
+  bool isJPEG;
+  bool resuming;      // the first resume_from bytes are stored by resumableDownload
+  size_t resume_from;
+  String etag;
+  String last_modified;
+};
 
 static https_request_err_e downloadAndShow(); // download and show the image
+static https_request_err_e receiveAndShowImage(HTTPClient *https, HttpBodyReader &reader, ImageBody &image, https_request_err_e &result);
+static void radioOff(HTTPClient *https);
 static uint32_t downloadStream(WiFiClient *stream, int content_size, uint8_t *buffer);
 static https_request_err_e handleApiDisplayResponse(ApiDisplayResponse &apiResponse);
 static void getDeviceCredentials();                  // receiveing API key and Friendly ID
@@ -76,11 +105,13 @@ static void downloadSetupImage();                    // download and display set
 static void resetDeviceCredentials(void);            // reset device credentials API key, Friendly ID, Wi-Fi SSID and password
 static void checkAndPerformFirmwareUpdate(void);     // OTA update
 static void goToSleep(void);                         // sleep preparing
-static bool setClock(void);                          // clock synchronization
 static float readBatteryVoltage(void);               // battery voltage reading
 static void submitStoredLogs(void);
 static void writeSpecialFunction(SPECIAL_FUNCTION function);
 static void writeImageToFile(const char *name, uint8_t *in_buffer, size_t size);
+static void writeStreamToFile(void *ctx, const uint8_t *data, size_t len);
+static void addConditionalHeaders(HTTPClient &https, const ImageValidators &validators);
+static void addRangeHeaders(HTTPClient &https, size_t resume_from, const String &etag);
 static void showMessageWithLogo(MSG message_type);
 static void showMessageWithLogo(MSG message_type, String friendly_id, bool id, const char *fw_version, String message);
 static void showMessageWithLogo(MSG message_type, const ApiSetupResponse &apiResponse);
@@ -92,6 +123,10 @@ static DeviceStatusStamp getDeviceStatusStamp();
 void log_nvs_usage();
 
 static unsigned long startup_time = 0;
+static uint32_t phase_clock() { return millis(); }
+static PhaseTimer phases(phase_clock); // what the wake spends its time on after the image is shown
+static int refresh_phase = -1;
+static bool radio_off_pending = false; // an inline image is in; WiFi goes off once fetchApiDisplay() is done
 
 void wait_for_serial() {
 #ifdef WAIT_FOR_SERIAL
@@ -348,16 +383,18 @@ void bl_init(void)
 
 #endif
 
-  // clock synchronization
-  if (setClock())
+  // clock synchronization, in the background and only when due
+  clock_service_begin();
+  uint32_t now = getTime();
+  if (now)
   {
     time_since_sleep = preferences.getUInt(PREFERENCES_LAST_SLEEP_TIME, 0);
-    time_since_sleep = time_since_sleep ? getTime() - time_since_sleep : 0; // may be can be used even if no sync
+    time_since_sleep = time_since_sleep ? now - time_since_sleep : 0;
   }
   else
   {
     time_since_sleep = 0;
-    Log.info("%s [%d]: Time wasn't synced.\r\n", __FILE__, __LINE__);
+    Log.info("%s [%d]: Time isn't known yet.\r\n", __FILE__, __LINE__);
   }
 
   Log.info("%s [%d]: Time since last sleep: %d\r\n", __FILE__, __LINE__, time_since_sleep);
@@ -377,6 +414,9 @@ void bl_init(void)
 
   log_retry = true;
 
+  // from here on the panel refreshes while the wake goes on; goToSleep() joins it
+  display_set_async_refresh(true);
+
   // OTA checking, image checking and drawing
   https_request_err_e request_result = downloadAndShow();
   Log.info("%s [%d]: request result - %d\r\n", __FILE__, __LINE__, request_result);
@@ -401,7 +441,6 @@ void bl_init(void)
       Log.info("%s [%d]: retry: %d - time to sleep: %d\r\n", __FILE__, __LINE__, retries, API_CONNECT_RETRY_TIME::API_FIRST_RETRY);
       res = preferences.putUInt(PREFERENCES_SLEEP_TIME_KEY, API_CONNECT_RETRY_TIME::API_FIRST_RETRY);
       preferences.putInt(PREFERENCES_CONNECT_API_RETRY_COUNT, ++retries);
-      display_sleep();
       goToSleep();
       break;
 
@@ -409,7 +448,6 @@ void bl_init(void)
       Log.info("%s [%d]: retry:%d - time to sleep: %d\r\n", __FILE__, __LINE__, retries, API_CONNECT_RETRY_TIME::API_SECOND_RETRY);
       res = preferences.putUInt(PREFERENCES_SLEEP_TIME_KEY, API_CONNECT_RETRY_TIME::API_SECOND_RETRY);
       preferences.putInt(PREFERENCES_CONNECT_API_RETRY_COUNT, ++retries);
-      display_sleep();
       goToSleep();
       break;
 
@@ -417,7 +455,6 @@ void bl_init(void)
       Log.info("%s [%d]: retry:%d - time to sleep: %d\r\n", __FILE__, __LINE__, retries, API_CONNECT_RETRY_TIME::API_THIRD_RETRY);
       res = preferences.putUInt(PREFERENCES_SLEEP_TIME_KEY, API_CONNECT_RETRY_TIME::API_THIRD_RETRY);
       preferences.putInt(PREFERENCES_CONNECT_API_RETRY_COUNT, ++retries);
-      display_sleep();
       goToSleep();
       break;
 
@@ -526,12 +563,13 @@ void bl_init(void)
     break;
   }
 
-  // display go to sleep
-  display_sleep();
   if (!update_firmware)
-    goToSleep();
+    goToSleep(); // puts the display to sleep too, once the radio is down
   else
+  {
+    display_sleep();
     ESP.restart();
+  }
 }
 
 /**
@@ -590,6 +628,7 @@ ApiDisplayInputs loadApiDisplayInputs(Preferences &preferences)
   inputs.rssi = WiFi.RSSI();
   inputs.displayWidth = display_width();
   inputs.displayHeight = display_height();
+  inputs.imageFormats = display_image_formats();
   inputs.model = DEVICE_MODEL;
   inputs.specialFunction = special_function;
 
@@ -603,34 +642,40 @@ ApiDisplayInputs loadApiDisplayInputs(Preferences &preferences)
  */
 static https_request_err_e downloadAndShow()
 {
-  IPAddress serverIP;
-  String apiHostname = preferences.getString(PREFERENCES_API_URL, API_BASE_URL);
-  apiHostname.replace("https://", "");
-  apiHostname.replace("http://", "");
-  apiHostname.replace("/", "");
-
-  int colon = apiHostname.indexOf(':');
-  if (colon != -1) {
-    apiHostname = apiHostname.substring(0, colon);
-  }
+  // The host is resolved by the connections of withHttp(), through the RTC DNS cache
+  auto apiDisplayInputs = loadApiDisplayInputs(preferences);
 
-  for (int attempt = 1; attempt <= 5; ++attempt)
-  {
-    if (WiFi.hostByName(apiHostname.c_str(), serverIP) == 1)
-    {
-      Log.info("%s [%d]: Hostname resolved to %s on attempt %d\r\n", __FILE__, __LINE__, serverIP.toString().c_str(), attempt);
-      break;
-    }
-    else
-    {
-      Log_error("Failed to resolve hostname on attempt %d", attempt);
-      delay(2000);
-    }
-  }
+  https_request_err_e result = HTTPS_NO_ERR;
+  apiDisplayResult = fetchApiDisplay(
+      apiDisplayInputs,
+      [&](ApiDisplayResponse &response, InlineImage &image) -> https_request_err_e
+      {
+        // The server sent the image along: the same steps as the image request below, minus the request
+        apiDisplayResult.response = response;
+        result = handleApiDisplayResponse(response);
+        if (!status || update_firmware || reset_firmware)
+        {
+          return result;
+        }
+        status = false;
 
-  auto apiDisplayInputs = loadApiDisplayInputs(preferences);
+        if (image.length > MAX_IMAGE_SIZE)
+        {
+          Log_error_submit("Receiving failed; file size too big: %d", image.length);
+          return HTTPS_IMAGE_FILE_TOO_BIG;
+        }
 
-  apiDisplayResult = fetchApiDisplay(apiDisplayInputs);
+        ImageBody body = {
+            .content_size = (int)image.length,
+            .isPNG = image.type == ENVELOPE_IMAGE_PNG,
+            .isJPEG = image.type == ENVELOPE_IMAGE_JPEG,
+            .resuming = false,
+            .resume_from = 0,
+            .etag = "",
+            .last_modified = "",
+        };
+        return receiveAndShowImage(nullptr, image.body, body, result);
+      });
 
   if (apiDisplayResult.error != HTTPS_NO_ERR)
   {
@@ -638,7 +683,19 @@ static https_request_err_e downloadAndShow()
     return apiDisplayResult.error;
   }
 
-  https_request_err_e result = handleApiDisplayResponse(apiDisplayResult.response);
+  if (apiDisplayResult.image_inline)
+  {
+    Log_info("Image came with the display response (%d), no image request", apiDisplayResult.image_result);
+    if (radio_off_pending)
+    {
+      // its connection is released now
+      radio_off_pending = false;
+      radioOff(nullptr);
+    }
+    return result;
+  }
+
+  result = handleApiDisplayResponse(apiDisplayResult.response);
 
   withHttp(
       filename,
@@ -689,15 +746,20 @@ static https_request_err_e downloadAndShow()
             }
           }
 
-          const char *headers[] = {"Content-Type"};
-          https.collectHeaders(headers, 1);
+          // Let the server answer 304 if the panel already shows this image
+          ImageValidators validators = imageValidators.load(filename);
+          addConditionalHeaders(https, validators);
+
+          // Ask only for the rest of a download that was cut off on an earlier attempt
+          String resume_etag;
+          size_t resume_from = resumableDownload.prepare(filename, resume_etag);
+          addRangeHeaders(https, resume_from, resume_etag);
+
+          const char *headers[] = {"Content-Type", "Transfer-Encoding", "ETag", "Last-Modified", "Content-Range"};
+          https.collectHeaders(headers, 5);
           Log_info("GET...");
           Log_info("RSSI: %d", WiFi.RSSI());
           // start connection and send HTTP header
-
-          // Ensure the HTTP connection won’t be kept alive and cause an error when
-          //  tearing down the wifi software and hardware before going to sleep.
-          https.setReuse(false);
           int httpCode = https.GET();
           int content_size = https.getSize();
           if(httpCode == HTTP_CODE_PERMANENT_REDIRECT ||
@@ -707,6 +769,8 @@ static https_request_err_e downloadAndShow()
               Log_info("Redirected to: %s", https.getLocation().c_str());
               https.setTimeout(15000);
               https.setConnectTimeout(15000);
+              addConditionalHeaders(https, validators);
+              addRangeHeaders(https, resume_from, resume_etag);
               httpCode = https.GET();
               content_size = https.getSize();
             }
@@ -724,8 +788,28 @@ static https_request_err_e downloadAndShow()
           // HTTP header has been send and Server response header has been handled
           Log.error("%s [%d]: [HTTPS] GET... code: %d\r\n", __FILE__, __LINE__, httpCode);
           Log.info("%s [%d]: RSSI: %d\r\n", __FILE__, __LINE__, WiFi.RSSI());
+          if (httpCode == HTTP_CODE_NOT_MODIFIED)
+          {
+            // Same image as on the panel (e.g. an identical render under a new name):
+            // no download, no decode, no refresh
+            Log_info("Image not modified, skipping download");
+            new_filename = apiDisplayResult.response.filename;
+            saveCurrentFileName(new_filename);
+            if (result != HTTPS_PLUGIN_NOT_ATTACHED)
+              result = HTTPS_SUCCESS;
+            return result;
+          }
+
+          resume_decision_e resume = resumableDownload.onResponse(httpCode, https.header("Content-Range").c_str());
+          if (resume == RESUME_MISMATCH)
+          {
+            // the stored bytes are gone, the next attempt downloads the whole image
+            return HTTPS_REQUEST_FAILED;
+          }
+          bool resuming = resume == RESUME_CONTINUE;
+
           // file found at server
-          if (httpCode != HTTP_CODE_OK && httpCode != HTTP_CODE_MOVED_PERMANENTLY)
+          if (httpCode != HTTP_CODE_OK && httpCode != HTTP_CODE_MOVED_PERMANENTLY && !resuming)
           {
             Log_error_submit("[HTTPS] GET... failed, code: %d (%s)", httpCode, https.errorToString(httpCode).c_str());
             return HTTPS_REQUEST_FAILED;
@@ -733,261 +817,440 @@ static https_request_err_e downloadAndShow()
 
           Log.info("%s [%d]: Content size: %d\r\n", __FILE__, __LINE__, https.getSize());
 
-          uint32_t counter = 0;
+          bool chunked = https.header("Transfer-Encoding").equalsIgnoreCase("chunked");
 
-          if (content_size <= 0)
+          // content_size is the size of the whole image, body_length what is left to receive
+          int body_length = content_size;
+          if (resuming)
           {
-            Log.warning("%s [%d]: Content-Length not provided (size: %d)\r\n", __FILE__, __LINE__, content_size);
+            content_size = resumableDownload.total();
+            Log_info("Resuming image download: %d of %d bytes already stored", resume_from, content_size);
           }
 
-          bool isPNG = https.header("Content-Type") == "image/png";
-          bool isJPEG = https.header("Content-Type") == "image/jpeg";
-
-          Log.info("%s [%d]: Starting a download at: %d\r\n", __FILE__, __LINE__, getTime());
-          heap_caps_check_integrity_all(true);
-
-          // getString() handles chunked transfer encoding automatically
-          String payload = https.getString();
-          counter = payload.length();
-
-          if (counter == 0)
+          if (content_size <= 0)
           {
-            Log_error_submit("Receiving failed. No data received");
-            return HTTPS_WRONG_IMAGE_SIZE;
+            Log.warning("%s [%d]: Content-Length not provided (size: %d, chunked: %d)\r\n", __FILE__, __LINE__, content_size, chunked);
           }
-
-          if (counter > MAX_IMAGE_SIZE)
+          else if (content_size > MAX_IMAGE_SIZE)
           {
-            Log_error_submit("Receiving failed; file size too big: %d", counter);
+            // Don't bother pulling the body over the air if it can't be shown anyway
+            Log_error_submit("Receiving failed; file size too big: %d", content_size);
             return HTTPS_IMAGE_FILE_TOO_BIG;
           }
 
-          buffer = (uint8_t *)malloc(counter);
+          WiFiClientSource source(*https.getStreamPtr());
+          HttpBodyReader reader(source, chunked ? -1 : body_length, chunked, downloadReaderOptions(30000, 5000));
+          ImageBody image = {
+              .content_size = content_size,
+              .isPNG = https.header("Content-Type") == "image/png",
+              .isJPEG = https.header("Content-Type") == "image/jpeg",
+              .resuming = resuming,
+              .resume_from = resume_from,
+              .etag = https.header("ETag"),
+              .last_modified = https.header("Last-Modified"),
+          };
+          return receiveAndShowImage(&https, reader, image, result);
+        }
 
-          if (buffer == NULL)
-          {
-            Log_error_submit("Failed to allocate %d bytes for image buffer", counter);
-            return HTTPS_OUT_OF_MEMORY;
-          }
+        return result;
+      });
 
-          memcpy(buffer, payload.c_str(), counter);
-          content_size = counter;
+  if (result == HTTPS_UNABLE_TO_CONNECT)
+  {
+    Log_error_submit("unable to connect");
+  }
 
-          if (counter >= 2 && buffer[0] == 'B' && buffer[1] == 'M')
-          {
-            isPNG = false;
-            Log.info("BMP file detected");
-          }
+  if (send_log)
+  {
+    send_log = false;
+  }
 
-          submitStoredLogs();
+  Log_info("Returned result - %d", result);
 
-            // Close HTTP/TCP cleanly
-            https.end();
-            vTaskDelay(pdMS_TO_TICKS(100));
+  return result;
+}
 
-            // Bring the station down but keep the driver running
-            WiFi.disconnect(false);
+/**
+ * @brief Reads an image body and shows it: streamed into the panel when it is a PNG that
+ * allows it, otherwise buffered and decoded once complete. Turns WiFi off once the body is in.
+ * @param https request the body belongs to; ended before WiFi goes off. nullptr if the
+ * connection is still someone else's: WiFi then stays on for the caller to turn off
+ * @param result set to HTTPS_SUCCESS once the image is shown (unless the plugin isn't attached)
+ * @return result, or the error that stopped receiving or decoding
+ */
+static https_request_err_e receiveAndShowImage(HTTPClient *https, HttpBodyReader &reader, ImageBody &image, https_request_err_e &result)
+{
+  int content_size = image.content_size;
+  bool isPNG = image.isPNG;
+  bool isJPEG = image.isJPEG;
+  bool resuming = image.resuming;
+  size_t resume_from = image.resume_from;
+  const String &etag = image.etag;
+  const String &last_modified = image.last_modified;
+  size_t counter = 0;
+
+  Log.info("%s [%d]: Starting a download at: %d\r\n", __FILE__, __LINE__, getTime());
+  heap_caps_check_integrity_all(true);
+
+  PngStreamSource png_source(reader, MAX_IMAGE_SIZE);
+  File image_file;
+  bool png_copied_to_file = false;
+  int stream_refresh = DISPLAY_STREAM_NEEDS_BUFFER;
+  body_read_err_e read_result;
+  unsigned long download_start = millis();
 
-            // Give a few ticks for disconnect to be processed on the wifi task
-            vTaskDelay(pdMS_TO_TICKS(100));
+  if (isPNG && !resuming)
+  {
+    // Let PNGdec pull the image straight from the socket and push lines to the panel
+    // while the rest is still in flight. The copy replaces /current.png once the image is shown.
+    image_file = SPIFFS.open("/next.png", FILE_WRITE);
+    if (image_file)
+    {
+      png_source.setTee(writeStreamToFile, &image_file);
+      png_copied_to_file = true;
+    }
+    stream_refresh = display_stream_png(png_source);
+  }
 
-            // Now it’s safe to power the radio down
-            WiFi.mode(WIFI_OFF);
+  // Allocate once: the exact size when it is known, otherwise the largest image we accept.
+  // The body (plain or chunked) is then read straight from the socket into this buffer.
+  size_t capacity = content_size > 0 ? (size_t)content_size : MAX_IMAGE_SIZE;
 
-          // https.end();
-          // WiFi.disconnect(true); // no need for WiFi, save power starting here
-          Log.info("%s [%d]: Received successfully; WiFi off\r\n", __FILE__, __LINE__);
-          bool bmp_rename = false;
+  if (stream_refresh != DISPLAY_STREAM_NEEDS_BUFFER)
+  {
+    png_source.finish(); // trailing chunks (IEND) still go to the file copy
+    counter = png_source.bytesReceived();
+    read_result = reader.error();
+  }
+  else
+  {
+    buffer = allocDownloadBuffer(capacity);
 
-          if (filesystem_file_exists("/current.bmp") || filesystem_file_exists("/current.png"))
-          {
-            filesystem_file_delete("/last.bmp");
-            filesystem_file_delete("/last.png");
-            filesystem_file_rename("/current.png", "/last.png");
-            filesystem_file_rename("/current.bmp", "/last.bmp");
-// Disable partial update (for now)
-//            if (filesystem_file_exists("/last.png")) {
-//                buffer_old = display_read_file("/last.png", &file_size_old);
-//                Log.info("%s [%d]: Reading last.png to use for partial update, size = %d\r\n", __FILE__, __LINE__, file_size_old);
-//            }
-          }
+    if (buffer == NULL)
+    {
+      image_file.close();
+      Log_error_submit("Failed to allocate %d bytes for image buffer", capacity);
+      return HTTPS_OUT_OF_MEMORY;
+    }
 
-          bool image_reverse = false;
-          if (isPNG || isJPEG)
-          {
-            writeImageToFile("/current.png", buffer, content_size);
-            Log.info("%s [%d]: Decoding %s\r\n", __FILE__, __LINE__, (isPNG) ? "png" : "jpeg");
-            display_show_image(buffer, content_size, true);
+    if (resuming)
+    {
+      // stored bytes first, then the rest straight from the socket behind them
+      if (!resumableDownload.restore(buffer, capacity))
+      {
+        resumableDownload.discard();
+        free(buffer);
+        buffer = nullptr;
+        Log_error_submit("Failed to read the stored part of the image");
+        return HTTPS_REQUEST_FAILED;
+      }
+      read_result = reader.readAll(buffer + resume_from, capacity - resume_from, &counter);
+      counter += resume_from;
+    }
+    else
+    {
+      // a PNG which can't be streamed has only had its header read at this point
+      read_result = isPNG ? png_source.bufferAll(buffer, capacity, &counter) : reader.readAll(buffer, capacity, &counter);
+    }
+  }
+  image_file.close();
+  Log_info("Download end: %d bytes in %d ms, result %d, streamed %d", counter, millis() - download_start, read_result, stream_refresh != DISPLAY_STREAM_NEEDS_BUFFER);
+
+  if (read_result != BODY_READ_OK)
+  {
+    // Keep what did arrive, so the next attempt only has to fetch the rest
+    if (read_result == BODY_READ_TOO_BIG || content_size <= 0)
+      resumableDownload.discard();
+    else if (buffer != nullptr)
+      resumableDownload.keep(filename, etag, content_size, buffer, counter);
+    else if (png_copied_to_file && partialDownloadStore.adopt("/next.png"))
+      resumableDownload.keep(filename, etag, content_size, nullptr, counter);
+
+    free(buffer);
+    buffer = nullptr;
+    filesystem_file_delete("/next.png");
+
+    if (read_result == BODY_READ_TOO_BIG)
+    {
+      Log_error_submit("Receiving failed; file size too big: %d", content_size);
+      return HTTPS_IMAGE_FILE_TOO_BIG;
+    }
+
+    Log_error_submit("Receiving failed (%d). Read %d bytes", read_result, counter);
+    return HTTPS_WRONG_IMAGE_SIZE;
+  }
+
+  content_size = counter;
+  resumableDownload.discard();
+
+  // G5 comes as whatever Content-Type the server picks, so it is recognized by its marker
+  bool isG5 = buffer != nullptr && (image_format_detect(buffer, counter) & (IMAGE_FORMAT_G5 | IMAGE_FORMAT_G5_2PLANE));
+
+  if (buffer != nullptr && counter >= 2 && buffer[0] == 'B' && buffer[1] == 'M')
+  {
+    isPNG = false;
+    Log.info("BMP file detected");
+    if (png_copied_to_file)
+    {
+      filesystem_file_delete("/next.png");
+      png_copied_to_file = false;
+    }
+  }
+
+  bool bmp_rename = false;
+  bool save_image = false;
+  bool bmp_saved = false;
+  bool shown = false;
+
+  // The image goes to the panel first: with async refresh on, the update runs while the logs
+  // are submitted, the radio goes down and the image is saved below
+  bool image_reverse = false;
+  if (stream_refresh != DISPLAY_STREAM_NEEDS_BUFFER)
+  {
+    // already decoded into the panel while downloading; only the refresh is left
+    if (stream_refresh == -1)
+    {
+      png_res = PNG_DECODE_ERR;
+    }
+    else
+    {
+      display_refresh_image(stream_refresh, true);
+      png_res = PNG_NO_ERR;
+      shown = true;
+    }
+  }
+  else if (isPNG || isJPEG || isG5)
+  {
+    Log.info("%s [%d]: Decoding %s\r\n", __FILE__, __LINE__, (isPNG) ? "png" : (isJPEG) ? "jpeg" : "g5");
+    if (display_show_image(buffer, content_size, true))
+    {
 //            delay(100);
 //            free(buffer);
 //            buffer = nullptr;
 //            png_res = decodePNG("/current.png", decodedPng);
-            png_res = PNG_NO_ERR; // DEBUG
-          }
-          else
-          {
-            bmp_res = parseBMPHeader(buffer, image_reverse);
-            Log.info("%s [%d]: BMP Parsing result: %d\r\n", __FILE__, __LINE__, bmp_res);
-          }
-          Serial.println();
-          String error = "";
-         // uint8_t *imagePointer = buffer;
-//          uint8_t *imagePointer = (decodedPng == nullptr) ? buffer : decodedPng;
-        //  bool lastImageExists = filesystem_file_exists("/last.bmp") || filesystem_file_exists("/last.png");
-
-          switch (png_res)
-          {
-          case PNG_NO_ERR:
-          {
+      png_res = PNG_NO_ERR; // DEBUG
+      save_image = !png_copied_to_file; // the decoders leave the buffer as it was
+      shown = true;
+    }
+    else
+    {
+      png_res = PNG_WRONG_FORMAT; // rejected before anything was drawn
+    }
+  }
+  else
+  {
+    bmp_res = parseBMPHeader(buffer, image_reverse);
+    Log.info("%s [%d]: BMP Parsing result: %d\r\n", __FILE__, __LINE__, bmp_res);
+    if (bmp_res == BMP_NO_ERR)
+    {
+      // saved before it's shown: display_show_image() inverts a BMP in place
+      writeImageToFile("/next.bmp", buffer, content_size);
+      bmp_saved = true;
+      Log.info("Free heap at before display - %d", ESP.getFreeHeap());
+      Log.info("Free PSRAM at before display - %d", ESP.getFreePsram());
+      display_show_image(buffer, content_size, true);
+      shown = true;
+    }
+  }
+  if (display_refresh_pending())
+  {
+    refresh_phase = phases.begin("refresh");
+  }
 
-           // Log.info("Free heap at before display - %d", ESP.getMaxAllocHeap());
-           // display_show_image(imagePointer, image_reverse, isPNG);
+  if (https != nullptr)
+  {
+    radioOff(https);
+  }
+  else
+  {
+    radio_off_pending = true;
+  }
 
-            // Using filename from API response
-            new_filename = apiDisplayResult.response.filename;
+  // https.end();
+  // WiFi.disconnect(true); // no need for WiFi, save power starting here
+  Log.info("%s [%d]: Received successfully\r\n", __FILE__, __LINE__);
 
-            // Print the extracted string
-            Log.info("%s [%d]: New filename - %s\r\n", __FILE__, __LINE__, new_filename.c_str());
+  int phase;
 
-            bool res = saveCurrentFileName(new_filename);
-            if (res)
-              Log.info("%s [%d]: New filename saved\r\n", __FILE__, __LINE__);
-            else
-              Log.error("%s [%d]: New image name saving error!", __FILE__, __LINE__);
+  // Only an image which made it to the panel replaces /current.*; the one before moves to /last.*
+  if (shown)
+  {
+    phase = phases.begin("spiffs");
+    if (filesystem_file_exists("/current.bmp") || filesystem_file_exists("/current.png"))
+    {
+      filesystem_file_delete("/last.bmp");
+      filesystem_file_delete("/last.png");
+      filesystem_file_rename("/current.png", "/last.png");
+      filesystem_file_rename("/current.bmp", "/last.bmp");
+// Disable partial update (for now)
+//            if (filesystem_file_exists("/last.png")) {
+//                buffer_old = display_read_file("/last.png", &file_size_old);
+//                Log.info("%s [%d]: Reading last.png to use for partial update, size = %d\r\n", __FILE__, __LINE__, file_size_old);
+//            }
+    }
+    if (png_copied_to_file)
+      filesystem_file_rename("/next.png", "/current.png");
+    else if (bmp_saved)
+      filesystem_file_rename("/next.bmp", "/current.bmp");
+    else if (save_image)
+      writeImageToFile("/current.png", buffer, content_size);
+    phases.end(phase);
+  }
+  else
+  {
+    filesystem_file_delete("/next.png");
+  }
+  Serial.println();
+  String error = "";
+ // uint8_t *imagePointer = buffer;
+//          uint8_t *imagePointer = (decodedPng == nullptr) ? buffer : decodedPng;
+//  bool lastImageExists = filesystem_file_exists("/last.bmp") || filesystem_file_exists("/last.png");
 
-            if (result != HTTPS_PLUGIN_NOT_ATTACHED)
-              result = HTTPS_SUCCESS;
-          }
-          break;
-          case PNG_WRONG_FORMAT:
-          {
-            error = "Wrong image format. Did not pass signature check";
-          }
-          break;
-          case PNG_BAD_SIZE:
-          {
-            error = "IMAGE width, height or size are invalid";
-          }
-          break;
-          case PNG_DECODE_ERR:
-          {
-            error = "could not decode png image";
-          }
-          break;
-          case PNG_MALLOC_FAILED:
-          {
-            error = "could not allocate memory for png image decoder";
-          }
-          break;
-          default:
-            break;
-          }
+  switch (png_res)
+  {
+  case PNG_NO_ERR:
+  {
 
-          switch (bmp_res)
-          {
-          case BMP_NO_ERR:
-          {
-            if (!filesystem_file_exists("/current.png"))
-            {
-              writeImageToFile("/current.bmp", buffer, content_size);
-            }
-            Log.info("Free heap at before display - %d", ESP.getFreeHeap());
-            Log.info("Free PSRAM at before display - %d", ESP.getFreePsram());
-            display_show_image(buffer, content_size, true);
+   // Log.info("Free heap at before display - %d", ESP.getMaxAllocHeap());
+   // display_show_image(imagePointer, image_reverse, isPNG);
 
-            // Using filename from API response
-            new_filename = apiDisplayResult.response.filename;
+    // Using filename from API response
+    new_filename = apiDisplayResult.response.filename;
 
-            // Print the extracted string
-            Log.info("%s [%d]: New filename - %s\r\n", __FILE__, __LINE__, new_filename.c_str());
+    // Print the extracted string
+    Log.info("%s [%d]: New filename - %s\r\n", __FILE__, __LINE__, new_filename.c_str());
 
-            bool res = saveCurrentFileName(new_filename);
-            if (res)
-              Log.info("%s [%d]: New filename saved\r\n", __FILE__, __LINE__);
-            else
-              Log.error("%s [%d]: New image name saving error!", __FILE__, __LINE__);
+    phase = phases.begin("nvs");
+    bool res = saveCurrentFileName(new_filename);
+    if (res)
+      Log.info("%s [%d]: New filename saved\r\n", __FILE__, __LINE__);
+    else
+      Log.error("%s [%d]: New image name saving error!", __FILE__, __LINE__);
+    imageValidators.save(filename, etag, last_modified);
+    phases.end(phase);
 
-            if (result != HTTPS_PLUGIN_NOT_ATTACHED)
-              result = HTTPS_SUCCESS;
-          }
-          break;
-          case BMP_NOT_BMP:
-          {
-            error = "First two header bytes are invalid!";
-          }
-          break;
-          case BMP_BAD_SIZE:
-          {
-            error = "BMP width, height or size are invalid";
-          }
-          break;
-          case BMP_COLOR_SCHEME_FAILED:
-          {
-            error = "BMP color scheme is invalid";
-          }
-          break;
-          case BMP_INVALID_OFFSET:
-          {
-            error = "BMP header offset is invalid";
-          }
-          break;
-          default:
-            break;
-          }
+    if (result != HTTPS_PLUGIN_NOT_ATTACHED)
+      result = HTTPS_SUCCESS;
+  }
+  break;
+  case PNG_WRONG_FORMAT:
+  {
+    error = "Wrong image format. Did not pass signature check";
+  }
+  break;
+  case PNG_BAD_SIZE:
+  {
+    error = "IMAGE width, height or size are invalid";
+  }
+  break;
+  case PNG_DECODE_ERR:
+  {
+    error = "could not decode png image";
+  }
+  break;
+  case PNG_MALLOC_FAILED:
+  {
+    error = "could not allocate memory for png image decoder";
+  }
+  break;
+  default:
+    break;
+  }
 
-          if (isPNG && png_res != PNG_NO_ERR)
-          {
-            filesystem_file_delete("/current.png");
-            Log_error_submit("error parsing image file - %s", error.c_str());
+  switch (bmp_res)
+  {
+  case BMP_NO_ERR:
+  {
+    // Using filename from API response
+    new_filename = apiDisplayResult.response.filename;
 
-            return HTTPS_WRONG_IMAGE_FORMAT;
-          }
-        }
+    // Print the extracted string
+    Log.info("%s [%d]: New filename - %s\r\n", __FILE__, __LINE__, new_filename.c_str());
 
-        return result;
-      });
+    phase = phases.begin("nvs");
+    bool res = saveCurrentFileName(new_filename);
+    if (res)
+      Log.info("%s [%d]: New filename saved\r\n", __FILE__, __LINE__);
+    else
+      Log.error("%s [%d]: New image name saving error!", __FILE__, __LINE__);
+    imageValidators.save(filename, etag, last_modified);
+    phases.end(phase);
 
-  if (result == HTTPS_UNABLE_TO_CONNECT)
+    if (result != HTTPS_PLUGIN_NOT_ATTACHED)
+      result = HTTPS_SUCCESS;
+  }
+  break;
+  case BMP_NOT_BMP:
   {
-    Log_error_submit("unable to connect");
+    error = "First two header bytes are invalid!";
   }
-
-  if (send_log)
+  break;
+  case BMP_BAD_SIZE:
   {
-    send_log = false;
+    error = "BMP width, height or size are invalid";
+  }
+  break;
+  case BMP_COLOR_SCHEME_FAILED:
+  {
+    error = "BMP color scheme is invalid";
+  }
+  break;
+  case BMP_INVALID_OFFSET:
+  {
+    error = "BMP header offset is invalid";
+  }
+  break;
+  default:
+    break;
   }
 
-  Log_info("Returned result - %d", result);
+  if ((isPNG || isG5) && png_res != PNG_NO_ERR)
+  {
+    Log_error_submit("error parsing image file - %s", error.c_str());
+
+    return HTTPS_WRONG_IMAGE_FORMAT;
+  }
 
   return result;
 }
 
+/**
+ * @brief Submits the logs and powers the radio down once the image is in, while the panel refreshes
+ * @param https request to end first; nullptr once it is released
+ */
+static void radioOff(HTTPClient *https)
+{
+  int phase = phases.begin("logs");
+  submitStoredLogs();
+  phases.end(phase);
+
+  phase = phases.begin("wifi off");
+    // Close HTTP/TCP cleanly, including the kept-alive API connection
+    if (https != nullptr)
+      https->end();
+    drainHttpConnections();
+    vTaskDelay(pdMS_TO_TICKS(100));
+
+    // Bring the station down but keep the driver running
+    WiFi.disconnect(false);
+
+    // Give a few ticks for disconnect to be processed on the wifi task
+    vTaskDelay(pdMS_TO_TICKS(100));
+
+    // Now it’s safe to power the radio down
+    WiFi.mode(WIFI_OFF);
+  phases.end(phase);
+  Log.info("%s [%d]: WiFi off\r\n", __FILE__, __LINE__);
+}
+
 uint32_t downloadStream(WiFiClient *stream, int content_size, uint8_t *buffer)
 {
-  int iteration_counter = 0;
-  int counter2 = content_size;
   unsigned long download_start = millis();
-  unsigned long last_data_time = millis();
-  int counter = 0;
+  WiFiClientSource source(*stream);
+  HttpBodyReader reader(source, content_size, false, downloadReaderOptions(30000, 5000));
+  size_t counter = reader.read(buffer, content_size);
 
-  while (counter < content_size && millis() - download_start < 30000)
-  {
-    if (stream->available())
-    {
-      Log.info("%s [%d]: Downloading... Available bytes: %d\r\n", __FILE__, __LINE__, stream->available());
-      int bytes_to_read = min(stream->available(), counter2 - counter);
-      counter += stream->readBytes(buffer + counter, bytes_to_read);
-      iteration_counter++;
-      last_data_time = millis();
-    }
-    else if (!stream->connected() || millis() - last_data_time > 5000)
-    {
-      break;
-    }
-    delay(10);
-  }
-
-  Log_info("Download end: %d/%d bytes in %d ms (%d iterations)", counter, content_size, millis() - download_start, iteration_counter);
+  Log_info("Download end: %d/%d bytes in %d ms (result %d)", counter, content_size, millis() - download_start, reader.error());
   return counter;
 }
 
@@ -1356,6 +1619,7 @@ https_request_err_e handleApiDisplayResponse(ApiDisplayResponse &apiResponse)
               Log.info("Showing image\n\r");
               display_show_image(buffer, file_size, true);
               need_to_refresh_display = 1;
+              imageValidators.clear(); // the panel no longer shows the current image
             }
             break;
             default:
@@ -1370,6 +1634,7 @@ https_request_err_e handleApiDisplayResponse(ApiDisplayResponse &apiResponse)
               Log.info("Showing image\n\r");
               display_show_image(buffer, DISPLAY_BMP_IMAGE_SIZE, true);
               need_to_refresh_display = 1;
+              imageValidators.clear(); // the panel no longer shows the current image
             }
             break;
             default:
@@ -1651,13 +1916,13 @@ static bool performApiSetup()
       Log.info("%s [%d]: Display test image start\r\n", __FILE__, __LINE__);
 
       display_show_image(storedLogoOrDefault(0), DEFAULT_IMAGE_SIZE, true);
+      imageValidators.clear();
 
       need_to_refresh_display = 1;
       Log.info("%s [%d]: Display test image end\r\n", __FILE__, __LINE__);
 
     preferences.putUInt(PREFERENCES_SLEEP_TIME_KEY, SLEEP_TIME_TO_SLEEP);
 
-    display_sleep();
     goToSleep();
     return false;
   }
@@ -1765,6 +2030,7 @@ static void downloadSetupImage()
       // show the image
       String friendly_id = preferences.getString(PREFERENCES_FRIENDLY_ID, PREFERENCES_FRIENDLY_ID_DEFAULT);
       display_show_msg(storedLogoOrDefault(0), FRIENDLY_ID, friendly_id, true, "", String(message_buffer));
+      imageValidators.clear();
       need_to_refresh_display = 0;
     }
     else
@@ -1817,6 +2083,7 @@ static void resetDeviceCredentials(void)
   else
     Log.error("%s [%d]: The device reseting error. The device will be reset now...\r\n", __FILE__, __LINE__);
   preferences.end();
+  display_refresh_join(); // a reset during the refresh would leave the panel half updated
   ESP.restart();
 }
 
@@ -1890,21 +2157,40 @@ static void checkAndPerformFirmwareUpdate(void)
  */
 static void goToSleep(void)
 {
+  int phase = phases.begin("logs");
   submitStoredLogs();
+  phases.end(phase);
+  phase = phases.begin("wifi off");
+  dnsCache.poll(); // keep background refreshes that have come back
+  clock_service_end();
+  drainHttpConnections();
   if (WiFi.status() == WL_CONNECTED) {
     WiFi.disconnect();
     // Give WiFi stack a few ticks to do tear down stuff
     vTaskDelay(pdMS_TO_TICKS(100));
   }
   WiFi.mode(WIFI_OFF); 
+  phases.end(phase);
+  phase = phases.begin("spiffs");
   filesystem_deinit();
+  phases.end(phase);
   uint32_t time_to_sleep = SLEEP_TIME_TO_SLEEP;
   if (preferences.isKey(PREFERENCES_SLEEP_TIME_KEY))
     time_to_sleep = preferences.getUInt(PREFERENCES_SLEEP_TIME_KEY, SLEEP_TIME_TO_SLEEP);
-  Log.info("%s [%d]: total awake time - %d ms\r\n", __FILE__, __LINE__, millis() - startup_time); 
-  Log.info("%s [%d]: time to sleep - %d\r\n", __FILE__, __LINE__, time_to_sleep);
+  phase = phases.begin("nvs");
   preferences.putUInt(PREFERENCES_LAST_SLEEP_TIME, getTime());
   preferences.end();
+  phases.end(phase);
+  // the refresh started with the image has had all of the above to finish
+  int refresh_wait = display_refresh_join();
+  phases.end(refresh_phase);
+  display_sleep();
+  char summary[256];
+  phases.summary("refresh", summary, sizeof(summary));
+  Log.info("%s [%d]: phases: %s; waited %d ms for the refresh\r\n", __FILE__, __LINE__, summary, refresh_wait);
+  Log.info("%s [%d]: total awake time - %d ms\r\n", __FILE__, __LINE__, millis() - startup_time); 
+  tls_session_log_stats();
+  Log.info("%s [%d]: time to sleep - %d\r\n", __FILE__, __LINE__, time_to_sleep);
   esp_sleep_enable_timer_wakeup((uint64_t)time_to_sleep * SLEEP_uS_TO_S_FACTOR);
   // Configure GPIO pin for wakeup
 #if CONFIG_IDF_TARGET_ESP32
@@ -1920,37 +2206,6 @@ static void goToSleep(void)
   esp_deep_sleep_start();
 }
 
-// Not sure if WiFiClientSecure checks the validity date of the certificate.
-// Setting clock just to be sure...
-/**
- * @brief Function to clock synchronization
- * @param none
- * @return none
- */
-static bool setClock()
-{
-  bool sync_status = false;
-  struct tm timeinfo;
-
-  configTime(0, 0, "time.google.com", "time.cloudflare.com");
-  Log.info("%s [%d]: Time synchronization...\r\n", __FILE__, __LINE__);
-
-  // Wait for time to be set
-  if (getLocalTime(&timeinfo))
-  {
-    sync_status = true;
-    Log.info("%s [%d]: Time synchronization succeed!\r\n", __FILE__, __LINE__);
-  }
-  else
-  {
-    Log.info("%s [%d]: Time synchronization failed...\r\n", __FILE__, __LINE__);
-  }
-
-  Log.info("%s [%d]: Current time - %s\r\n", __FILE__, __LINE__, asctime(&timeinfo));
-
-  return sync_status;
-}
-
 /**
  * @brief Function to read the battery voltage
  * @param none
@@ -2028,15 +2283,7 @@ bool storeLogString(const char *log_buffer)
 
 uint32_t getTime(void)
 {
-  time_t now;
-  struct tm timeinfo;
-  if (!getLocalTime(&timeinfo, 200))
-  {
-    Log.info("%s [%d]: Failed to obtain time. \r\n", __FILE__, __LINE__);
-    return (0);
-  }
-  time(&now);
-  return now;
+  return clock_service_now();
 }
 
 static void submitStoredLogs(void)
@@ -2078,6 +2325,44 @@ static void submitStoredLogs(void)
   }
 }
 
+static void writeStreamToFile(void *ctx, const uint8_t *data, size_t len)
+{
+  File *file = (File *)ctx;
+  if (file->write(data, len) != len)
+  {
+    Log_error("File writing ERROR while streaming image");
+  }
+}
+
+/**
+ * @brief Adds Range / If-Range to continue an interrupted image download
+ * @param https client the request is being built on
+ * @param resume_from number of bytes already stored, 0 for none
+ * @param etag ETag of the stored bytes
+ * @return none
+ */
+static void addRangeHeaders(HTTPClient &https, size_t resume_from, const String &etag)
+{
+  if (resume_from == 0)
+    return;
+  https.addHeader("Range", "bytes=" + String(resume_from) + "-");
+  https.addHeader("If-Range", etag);
+}
+
+/**
+ * @brief Adds If-None-Match / If-Modified-Since for the image that is on the panel
+ * @param https client the request is being built on
+ * @param validators validators of the shown image (empty if unknown)
+ * @return none
+ */
+static void addConditionalHeaders(HTTPClient &https, const ImageValidators &validators)
+{
+  if (validators.etag.length() > 0)
+    https.addHeader("If-None-Match", validators.etag);
+  if (validators.last_modified.length() > 0)
+    https.addHeader("If-Modified-Since", validators.last_modified);
+}
+
 static void writeImageToFile(const char *name, uint8_t *in_buffer, size_t size)
 {
   size_t res = filesystem_write_to_file(name, in_buffer, size);
@@ -2124,6 +2409,7 @@ static void writeSpecialFunction(SPECIAL_FUNCTION function)
 static void showMessageWithLogo(MSG message_type, String friendly_id, bool id, const char *fw_version, String message)
 {
   display_show_msg(storedLogoOrDefault(0), message_type, friendly_id, id, fw_version, message);
+  imageValidators.clear();
   need_to_refresh_display = 1;
   preferences.putBool(PREFERENCES_DEVICE_REGISTERED_KEY, false);
 }
@@ -2131,6 +2417,7 @@ static void showMessageWithLogo(MSG message_type, String friendly_id, bool id, c
 static void showMessageWithLogo(MSG message_type)
 {
   display_show_msg(storedLogoOrDefault(0), message_type);
+  imageValidators.clear();
 }
 
 /**
@@ -2142,6 +2429,7 @@ static void showMessageWithLogo(MSG message_type)
 static void showMessageWithLogo(MSG message_type, const ApiSetupResponse &apiResponse)
 {
   display_show_msg(storedLogoOrDefault(0), message_type, "", false, "", apiResponse.message);
+  imageValidators.clear();
   need_to_refresh_display = 1;
   preferences.putBool(PREFERENCES_DEVICE_REGISTERED_KEY, false);
 }
@@ -2242,7 +2530,6 @@ static void wifiErrorDeepSleep()
   retry_count++;
   preferences.putInt(PREFERENCES_CONNECT_WIFI_RETRY_COUNT, retry_count);
 
-  display_sleep();
   goToSleep();
 }
 
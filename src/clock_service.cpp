@@ -0,0 +1,113 @@
+#include <Arduino.h>
+#include <sys/time.h>
+#include <esp_sntp.h>
+#include <trmnl_log.h>
+#include <wall_clock.h>
+#include <clock_service.h>
+#include <rtc_budget.h>
+
+static int64_t clock_local_ms()
+{
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return (int64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000;
+}
+
+RTC_DATA_ATTR static WallClockRtc wall_clock_rtc;
+static_assert(sizeof(wall_clock_rtc) <= RTC_BUDGET_CLOCK, "wall clock over its RTC share (rtc_budget.h)");
+
+static const WallClockOptions wall_clock_options = {
+    .local_ms = clock_local_ms,
+    .sync_every_wakes = 48,       // 12 hours at the default refresh rate
+    .max_error_ms = 1000,
+    .min_sample_ms = 10 * 60 * 1000,
+    .initial_uncertainty_ppm = 1000, // the RTC oscillator is only calibrated to a few hundred ppm
+    .min_uncertainty_ppm = 20,
+};
+
+static WallClock wallClock(wall_clock_rtc, wall_clock_options);
+
+// Written by the SNTP client on the lwIP thread, taken over on the main task
+static portMUX_TYPE sync_mux = portMUX_INITIALIZER_UNLOCKED;
+static bool sync_pending = false;
+static int64_t sync_local_before_ms;
+static int64_t sync_ms;
+
+static bool sntp_started = false;
+static bool synced_this_wake = false;
+
+/**
+ * Replaces the (weak) default of the SNTP client, which only sets the time:
+ * the local clock is read first, so the drift since the last sync can be measured.
+ */
+void sntp_sync_time(struct timeval *tv)
+{
+  int64_t before = clock_local_ms();
+  settimeofday(tv, NULL);
+
+  portENTER_CRITICAL(&sync_mux);
+  sync_local_before_ms = before;
+  sync_ms = (int64_t)tv->tv_sec * 1000 + tv->tv_usec / 1000;
+  sync_pending = true;
+  portEXIT_CRITICAL(&sync_mux);
+
+  sntp_set_sync_status(SNTP_SYNC_STATUS_COMPLETED);
+}
+
+/** @brief Hands a sync that arrived to the WallClock. Doesn't log: it runs inside getTime() */
+static void take_pending_sync()
+{
+  portENTER_CRITICAL(&sync_mux);
+  bool pending = sync_pending;
+  int64_t local_before_ms = sync_local_before_ms;
+  int64_t synced_ms = sync_ms;
+  sync_pending = false;
+  portEXIT_CRITICAL(&sync_mux);
+
+  if (pending)
+  {
+    wallClock.onSync(local_before_ms, synced_ms);
+    synced_this_wake = true;
+  }
+}
+
+void clock_service_begin(void)
+{
+  wallClock.wake();
+  if (!wallClock.syncNeeded())
+  {
+    Log_info("Clock: %d wakes since sync, error within %d ms; no SNTP needed",
+             wallClock.wakesSinceSync(), (int)wallClock.estimatedErrorMs());
+    return;
+  }
+
+  // only starts the client; the answer is handled by sntp_sync_time()
+  configTime(0, 0, "time.google.com", "time.cloudflare.com");
+  sntp_started = true;
+  Log_info("Clock: SNTP sync started in the background");
+}
+
+uint32_t clock_service_now(void)
+{
+  take_pending_sync();
+  return (uint32_t)(wallClock.nowMs() / 1000);
+}
+
+void clock_service_end(void)
+{
+  take_pending_sync();
+  if (!sntp_started)
+    return;
+
+  sntp_stop();
+  sntp_started = false;
+  if (synced_this_wake)
+  {
+    Log_info("Clock: synced, was off by %d ms, drift %d ppm",
+             wallClock.lastErrorMs(), wallClock.driftPpm());
+  }
+  else
+  {
+    Log_info("Clock: no SNTP answer during this wake, trying again on the next one");
+  }
+}
@@ -2,8 +2,19 @@
 #include <ArduinoLog.h>
 #include <display.h>
 #include <PNGdec.h>
+#include <png_row_store.h>
+#include <png_planes.h>
+#include <png_dither.h>
+#include <palette_map.h>
+#include <jpeg_planes.h>
+#include <jpeg_strip.h>
+#include <png_rotate.h>
+#include <image_formats.h>
+#include <frame_diff.h>
+#include <rtc_budget.h>
 #include <JPEGDEC.h>
 #include <SPIFFS.h>
+#include <filesystem.h>
 #include <Preferences.h>
 #include <preferences_persistence.h>
 #include "DEV_Config.h"
@@ -56,7 +67,9 @@ RTC_DATA_ATTR int iUpdateCount = 0;
 extern char filename[];
 extern Preferences preferences;
 extern ApiDisplayResult apiDisplayResult;
-static uint8_t *pDither;
+static RowDither pngDither; // error diffusion state of the PNG being drawn, see ReduceBpp()
+static bool bPngRotate; // portrait PNG on a landscape panel, see png_draw_pass()
+static PngRowRotator pngRotator; // turns the rows of a portrait PNG into panel columns
 
 int paletteMapSize;
 /**
@@ -73,7 +86,38 @@ int paletteMapSize;
  * - Display palette: first 6 of u8Colors_spectra6
  * This array would then be: [0x03, 0x05] (spectra 6 color codes for red and blue)
  */
-uint8_t paletteMap[MAX_COLOR_COUNT];
+uint8_t paletteMap[PALETTE_MAP_MAX_ENTRIES];
+RTC_DATA_ATTR static PaletteMapRtc palette_map_rtc;
+static PaletteMapCache paletteMapCache(palette_map_rtc);
+static PngStreamSource *pStreamingPng; // image being streamed, for the length of its PLTE chunk
+static void build_palette_map(const uint8_t *pngPalette, int iEntries, int iBpp);
+static void display_refresh_buffer(int iRefreshMode, bool bWait, bool bAlloc);
+static int display_refresh_mode(int iRefreshMode, bool bWait, bool bLog);
+RTC_DATA_ATTR static FrameDiffRtc frame_diff_rtc; // hashes of the 1-bit image on the panel
+static const FrameDiffOptions frame_diff_options = {
+    .max_windows = 3,  // each one costs a few commands; closer ones merge
+    .merge_tiles = 24, // 24 tiles of 64x16 pixels is 3 KB more to send
+    .max_percent = 50, // beyond half the panel, the whole frame goes in one go
+};
+static FrameDiff frameDiff(frame_diff_rtc, frame_diff_options);
+static bool bFrameTracked; // the frame being refreshed went through frameDiff
+#define PREV_FRAME_MAGIC 0x50524556 // "PREV"
+#define PREV_FRAME_FILE "/prev_frame.bin"
+/** Where to find the last frame committed to frameDiff, packed in PREV_FRAME_FILE, to give the EPD its old plane back after deep sleep */
+struct PrevFrameRtc
+{
+    uint32_t magic;
+    uint16_t width;
+    uint16_t height;
+    int32_t size;
+    uint32_t hash; // of the packed frame, to catch a stale or short file
+};
+RTC_DATA_ATTR static PrevFrameRtc prev_frame_rtc; // the frame itself (~4.5 KB packed) doesn't fit in RTC memory
+static_assert(sizeof(iUpdateCount) + sizeof(palette_map_rtc) + sizeof(frame_diff_rtc) + sizeof(prev_frame_rtc) <= RTC_BUDGET_DISPLAY,
+              "display RTC data over its share (rtc_budget.h)");
+static void display_forget_frame(void);
+static bool bAsyncRefresh; // display_refresh_buffer() starts the refresh and returns
+static bool bRefreshPending; // started that way and not joined yet
 
 /**
  * @brief Function to init the display
@@ -107,6 +151,17 @@ void display_sleep(uint32_t u32Millis)
 #endif
 }
 
+/**
+ * @brief Function to note that the panel shows something frameDiff didn't see
+ * @param none
+ * @return none
+ */
+static void display_forget_frame(void)
+{
+    frameDiff.forget();
+    prev_frame_rtc.magic = 0;
+} /* display_forget_frame() */
+
 /**
  * @brief Function to reset the display
  * @param none
@@ -116,6 +171,7 @@ void display_reset(void)
 {
     Log_info("e-Paper Clear start");
     bbep.fillScreen(BBEP_WHITE);
+    display_forget_frame();
 #ifdef BB_EPAPER
     if (!apiDisplayResult.response.maximum_compatibility) {
         bbep.refresh(REFRESH_FAST, true);
@@ -147,6 +203,23 @@ uint16_t display_width()
     return bbep.width();
 }
 
+/**
+ * @brief Function to list the image formats display_show_image() can render on this panel
+ * @return set of image_format_e
+ */
+uint32_t display_image_formats()
+{
+    PanelImageCaps panel = {false, false, false};
+#ifdef BB_EPAPER
+    uint32_t u32Caps = bbep.capabilities();
+    panel.red = (u32Caps & BBEP_3COLOR) != 0;
+    panel.full_color = (u32Caps & BBEP_FULL_COLOR) != 0;
+    // plain B/W panels show 4 grays through TWO_BIT_PANEL
+    panel.four_gray = !(u32Caps & (BBEP_3COLOR | BBEP_4COLOR | BBEP_FULL_COLOR));
+#endif
+    return image_formats_for_panel(panel);
+}
+
 /**
  * @brief Function to draw multi-line text onto the display
  * @param x_start X coordinate to start drawing
@@ -307,7 +380,8 @@ void Paint_DrawMultilineText(UWORD x_start, UWORD y_start, const char *message,
     }
 }
 /** 
- * @brief Reduce the bit depth of line of pixels using thresholding (aka simple color mapping)
+ * @brief Reduce the bit depth of line of pixels, with error diffusion while pngDither
+ *        was begun for the image, otherwise using thresholding (aka simple color mapping)
  * @param Destination bit count (1 or 2)
  * @param Pointer to a PNG palette (3 bytes per entry)
  * @param Pointer to the source pixels
@@ -318,83 +392,23 @@ void Paint_DrawMultilineText(UWORD x_start, UWORD y_start, const char *message,
  */
 void ReduceBpp(int iDestBpp, int iPixelType, uint8_t *pPalette, uint8_t *pSrc, uint8_t *pDest, int w, int iSrcBpp)
 {
-    int g = 0, x, iDelta;
-    uint8_t *s, *d, *pPal, u8, count;
-    const uint8_t u8G2ToG8[4] = {0x00, 0x55, 0xaa, 0xff}; // 2-bit to 8-bit gray
-
-    if (iPixelType == PNG_PIXEL_TRUECOLOR) iSrcBpp = 24;
-    else if (iPixelType == PNG_PIXEL_TRUECOLOR_ALPHA) iSrcBpp = 32;
-    iDelta = iSrcBpp/8; // bytes per pixel
-    count = 8; // bits in a byte
-    u8 = 0; // start with all black
-    d = pDest;
-    s = pSrc;
-    for (x=0; x<w; x++) {
-        u8 <<= iDestBpp;
-        switch (iSrcBpp) {
-            case 24:
-            case 32:
-                g = (s[0] + s[1]*2 + s[2])/4; // convert color to gray value
-                s += iDelta;
-                break;
-            case 8:
-                if (iPixelType == PNG_PIXEL_INDEXED) {
-                    pPal = &pPalette[s[0] * 3];
-                    g = (pPal[0] + pPal[1]*2 + pPal[2])/4;
-                } else { // must be grayscale
-                    g = s[0];
-                }
-                s++;
-                break;
-            case 4:
-                if (x & 1) {
-                    if (iPixelType == PNG_PIXEL_INDEXED) {
-                        pPal = &pPalette[(s[0] & 0xf) * 3];
-                        g = (pPal[0] + pPal[1]*2 + pPal[2])/4;
-                    } else {
-                        g = (s[0] & 0xf) | (s[0] << 4);
-                    }
-                    s++;
-                } else {
-                    if (iPixelType == PNG_PIXEL_INDEXED) {
-                        pPal = &pPalette[(s[0]>>4) * 3];
-                        g = (pPal[0] + pPal[1]*2 + pPal[2])/4;
-                    } else {
-                        g = (s[0] & 0xf0) | (s[0] >> 4);
-                    }
-                }
-                break;
-            case 2: // We need to handle this case for 2-bit images with (random) palettes
-                g = s[0] >> (6-((x & 3) * 2));
-                if (iPixelType == PNG_PIXEL_INDEXED) {
-                    pPal = &pPalette[(g & 3)*3];
-                    g = (pPal[0] + pPal[1]*2 + pPal[2])/4;
-                } else {
-                    g = u8G2ToG8[g & 3];
-                }
-                if ((x & 3) == 3) {
-                    s++;
-                }
-                break;
-        } // switch on bpp
-        if (iDestBpp == 1) {
-            u8 |= (g >> 7); // B/W
-        } else { // generate 4 gray levels (2 bits)
-            u8 |= (3 ^ (g >> 6)); // 4 gray levels (inverted relative to 1-bit)
-        }
-        count -= iDestBpp;        
-        if (count == 0) { // byte is full, move on
-            *d++ = u8;
-            u8 = 0;
-            count = 8;
-        }
-    } // for x
-    if (count != 8) { // partial byte remaining
-        u8 <<= count;
-        *d++ = u8;
-    }
+    png_reduce_row(iDestBpp, iPixelType, pPalette, pSrc, pDest, w, iSrcBpp, &pngDither);
 } /* ReduceBpp() */
 
+#ifdef BB_EPAPER
+/**
+ * @brief PngRowRotator callback: sends a column stripe (8 image rows) of a portrait PNG
+ * @param ctx png_draw() user pointer, selects the plane like png_draw() does
+ */
+static bool png_write_column(void *ctx, int x, const uint8_t *pColumn, int iLen)
+{
+    bbep.setAddrWindow(x, 0, 8, iLen);
+    bbep.startWrite((ctx && *(int *)ctx == 1) ? PLANE_1 : PLANE_0);
+    bbep.writeData((uint8_t *)pColumn, iLen);
+    return true;
+} /* png_write_column() */
+#endif // BB_EPAPER
+
 /**
  * @brief Callback function for each line of PNG decoded
  * @param PNGDRAW structure containing the current line and relevant info
@@ -405,7 +419,7 @@ int png_draw(PNGDRAW *pDraw)
 {
     int x;
     uint8_t ucBppChanged = 0, ucInvert = 0;
-    uint8_t uc, ucMask, src, *s, *d, *pTemp = bbep.getCache(); // get some scratch memory (not from the stack)
+    uint8_t *s, *d, *pTemp = bbep.getCache(); // get some scratch memory (not from the stack)
 
     if (pDraw->iPixelType == PNG_PIXEL_INDEXED && pDraw->iBpp == 1) {
         // 1-bit output, just see which color is brighter
@@ -419,7 +433,11 @@ int png_draw(PNGDRAW *pDraw)
         // "full" "color" display with indexed PNG (happy path for color displays)
 
         if (paletteMapSize == 0) {
-            return 0;
+            // When streaming, the PLTE chunk is only seen once decoding has started
+            build_palette_map(pDraw->pPalette, pStreamingPng ? pStreamingPng->paletteEntries() : 0, pDraw->iBpp);
+            if (paletteMapSize == 0) {
+                return 0;
+            }
         }
     } else if (pDraw->iBpp == 2) {
         ucInvert = 0xff; // 2-bit non-palette images need to be inverted colors for 4-gray mode
@@ -491,48 +509,15 @@ int png_draw(PNGDRAW *pDraw)
     }
     if (!pDraw->pUser) {
         // 1-bit output, decode the single plane and write it
-        for (x=0; x<pDraw->iWidth; x+= 8) {
-          d[0] = s[0] ^ ucInvert;
-          d++; s++;
-        }
+        invert_row(s, d, (pDraw->iWidth+7)/8, ucInvert);
+    } else if (*(int *)pDraw->pUser > 1) { // draw 2bpp data as 1-bit to use for partial update
+        // the invert rule is backwards for grayscale data: non-white -> black
+        two_bit_to_one_bit(s, d, pDraw->iWidth, (uint8_t)~ucInvert, TWO_BIT_NONZERO);
     } else { // we need to split the 2-bit data into plane 0 and 1
-        src = *s++;
-        src ^= ucInvert;
-        uc = 0; // suppress warning/error
-        if (*(int *)pDraw->pUser > 1) { // draw 2bpp data as 1-bit to use for partial update
-            ucInvert = ~ucInvert; // the invert rule is backwards for grayscale data
-            src = ~src;
-            for (x=0; x<pDraw->iWidth; x++) {
-                uc <<= 1;
-                if (src & 0xc0) { // non-white -> black
-                    uc |= 1; // high bit of source pair
-                }
-                src <<= 2;
-                if ((x & 3) == 3) { // new input byte
-                    src = *s++;
-                    src ^= ucInvert;
-                }
-                if ((x & 7) == 7) { // new output byte
-                    *d++ = uc;
-                }
-            } // for x
-        } else { // normal 0/1 split plane
-            ucMask = (*(int *)pDraw->pUser == 0) ? 0x40 : 0x80; // lower or upper source bit
-            for (x=0; x<pDraw->iWidth; x++) {
-                uc <<= 1;
-                if (src & ucMask) {
-                    uc |= 1; // high bit of source pair
-                }
-                src <<= 2;
-                if ((x & 3) == 3) { // new input byte
-                    src = *s++;
-                    src ^= ucInvert;
-                }
-                if ((x & 7) == 7) { // new output byte
-                    *d++ = uc;
-                }
-            } // for x
-        }
+        two_bit_to_one_bit(s, d, pDraw->iWidth, ucInvert, (*(int *)pDraw->pUser == 0) ? TWO_BIT_PLANE_0 : TWO_BIT_PLANE_1);
+    }
+    if (pngRotator.active()) {
+        return pngRotator.addRow(pTemp) ? 1 : 0;
     }
     bbep.writeData(pTemp, (pDraw->iWidth+7)/8);
     return 1;
@@ -677,43 +662,13 @@ int png_draw(PNGDRAW *pDraw)
 } /* png_draw() */
 #endif
 
-//
-// A table to accelerate the testing of 2-bit images for the number
-// of unique colors. Each entry sets bits 0-3 depending on the presence
-// of colors 0-3 in each 2-bit pixel
-//
-const uint8_t ucTwoBitFlags[256] = {
-0x01,0x03,0x05,0x09,0x03,0x03,0x07,0x0b,0x05,0x07,0x05,0x0d,0x09,0x0b,0x0d,0x09,
-0x03,0x03,0x07,0x0b,0x03,0x03,0x07,0x0b,0x07,0x07,0x07,0x0f,0x0b,0x0b,0x0f,0x0b,
-0x05,0x07,0x05,0x0d,0x07,0x07,0x07,0x0f,0x05,0x07,0x05,0x0d,0x0d,0x0f,0x0d,0x0d,
-0x09,0x0b,0x0d,0x09,0x0b,0x0b,0x0f,0x0b,0x0d,0x0f,0x0d,0x0d,0x09,0x0b,0x0d,0x09,
-0x03,0x03,0x07,0x0b,0x03,0x03,0x07,0x0b,0x07,0x07,0x07,0x0f,0x0b,0x0b,0x0f,0x0b,
-0x03,0x03,0x07,0x0b,0x03,0x02,0x06,0x0a,0x07,0x06,0x06,0x0e,0x0b,0x0a,0x0e,0x0a,
-0x07,0x07,0x07,0x0f,0x07,0x06,0x06,0x0e,0x07,0x06,0x06,0x0e,0x0f,0x0e,0x0e,0x0e,
-0x0b,0x0b,0x0f,0x0b,0x0b,0x0a,0x0e,0x0a,0x0f,0x0e,0x0e,0x0e,0x0b,0x0a,0x0e,0x0a,
-0x05,0x07,0x05,0x0d,0x07,0x07,0x07,0x0f,0x05,0x07,0x05,0x0d,0x0d,0x0f,0x0d,0x0d,
-0x07,0x07,0x07,0x0f,0x07,0x06,0x06,0x0e,0x07,0x06,0x06,0x0e,0x0f,0x0e,0x0e,0x0e,
-0x05,0x07,0x05,0x0d,0x07,0x06,0x06,0x0e,0x05,0x06,0x04,0x0c,0x0d,0x0e,0x0c,0x0c,
-0x0d,0x0f,0x0d,0x0d,0x0f,0x0e,0x0e,0x0e,0x0d,0x0e,0x0c,0x0c,0x0d,0x0e,0x0c,0x0c,
-0x09,0x0b,0x0d,0x09,0x0b,0x0b,0x0f,0x0b,0x0d,0x0f,0x0d,0x0d,0x09,0x0b,0x0d,0x09,
-0x0b,0x0b,0x0f,0x0b,0x0b,0x0a,0x0e,0x0a,0x0f,0x0e,0x0e,0x0e,0x0b,0x0a,0x0e,0x0a,
-0x0d,0x0f,0x0d,0x0d,0x0f,0x0e,0x0e,0x0e,0x0d,0x0e,0x0c,0x0c,0x0d,0x0e,0x0c,0x0c,
-0x09,0x0b,0x0d,0x09,0x0b,0x0a,0x0e,0x0a,0x0d,0x0e,0x0c,0x0c,0x09,0x0a,0x0c,0x08
-};
-
 int png_draw_count(PNGDRAW *pDraw)
 {
-    int x, *pFlags = (int *)pDraw->pUser;
-    uint8_t *s, set_bits;
+    uint8_t *pFlags = (uint8_t *)pDraw->pUser;
 
-    if (pDraw->y > 430) return 0; // Workaround to ignore the icon in the lower left corner
+    if (pDraw->y > PNG_COUNT_COLORS_MAX_Y) return 0; // Workaround to ignore the icon in the lower left corner
 
-    set_bits = pFlags[0]; // use a local var
-    s = (uint8_t *)pDraw->pPixels;
-    for (x=0; x<pDraw->iWidth; x+=4) {
-        set_bits |= ucTwoBitFlags[*s++]; // do 4 pixels at a time
-    } // for x
-    pFlags[0] = set_bits; // put it back in the flags array
+    *pFlags = png_two_bit_color_flags(pDraw->pPixels, pDraw->iWidth, *pFlags);
     return 1;
 } /* png_draw_count() */
 /** 
@@ -728,146 +683,61 @@ int png_draw_count(PNGDRAW *pDraw)
  */
 int png_count_colors(PNG *png, const uint8_t *pData, int iDataSize)
 {
-int i, iColors;
+int iColors;
+uint8_t ucFlags = 0;
     png->openRAM((uint8_t *)pData, iDataSize, png_draw_count);
-    i = 0;
-    png->decode(&i, 0);
+    png->decode(&ucFlags, 0);
     png->close();
-    iColors = 0;
-    if (i & 1) iColors++;
-    if (i & 2) iColors++;
-    if (i & 4) iColors++;
-    if (i & 8) iColors++;
+    iColors = png_two_bit_color_count(ucFlags);
     Log_info("%s [%d]: png_count_colors: %d\r\n", __FILE__, __LINE__, iColors);
     return iColors;
 } /* png_count_colors() */
 
-/**
- * Simple linear array search.
- *
- * @param array Search array (haystack)
- * @param size Size of the search array
- * @param targetValue Value to search for (needle)
- * @return Index of target value in array, or -1 if not found.
- */
-static int uint32_array_search(const uint32_t *array, int size, uint32_t targetValue) {
-    for (int i = 0; i < size; ++i) {
-        if (array[i] == targetValue) {
-            return i;
-        }
-    }
-    return -1;
-}
-
-static uint32_t png_palette_triplet_to_rgb888(const uint8_t *pTripletStart) {
-    return
-    // Red
-    (pTripletStart[0] << 16) |
-    // Green
-    (pTripletStart[1] << 8) |
-    // Blue
-    (pTripletStart[2]);
-}
-
-/**
- * Gets the number of actually used entries in the palette (PNG PLTE) table by the crude
- *  means of just iterating through the array until we find a null entry.
- *
- * This algorithm is unable to distinguish between a palette with a black (0x000000) entry
- *  at the end and a palette with no black entry.
- * It will always interpret that case as a black entry at the end because an extra palette
- *  entry has no negative effect.
- *
- * Future improvement: store the size of the palette in PNGDRAW on image decode so we
- *  don't have to do this crap.
- *
- * TODO: write a unit test for this once I can sort out the tooling
- * @param pPalette PNGDRAW::pPalette pointer. 768 bytes where each set of 3 bytes is
- *  red, green, blue values to define a single color in the palette.
- * Bytes 769-1024 are alpha values, but we don't care about those for this application.
- * @return number of actually used entries (colors) in the palette.
- */
-static int get_palette_size(uint8_t *pPalette) {
-    bool haveSeenBlack = false;
-    if (!pPalette) {
-        return -1;
-    }
-    int count = 0;
-    for (int i = 0; i < 256; ++i) {
-        const int idx = i * 3;
-        if (png_palette_triplet_to_rgb888(&pPalette[idx]) == 0) {
-            if (haveSeenBlack) {
-                // If we've already recorded a black palette entry, then we're done here
-                break;
-            } else {
-                // If we haven't seen a full black palette entry so far, now we have
-                haveSeenBlack = true;
-                // Move on because this was a valid color.
-                ++count;
-                continue;
-            }
-        }
-        ++count;
-    }
-    return count;
-}
-
 /**
  * Builds the paletteMap global variable and sets the corresponding paletteMapSize global variable.
  *
  * For "full" "color" displays, this function must be called before attempting to decode
  *  and write to the EPD display.
  *
- * The assumption here is that for "full color" displays, the server should only ever
- *  provide PNG images with color mode = indexed, where the palette exactly corresponds
- *  to the model's display's palette. This is because the server is expected to do all
- *  necessary processing to prepare the image for the EPD, specifically quantization/dithering.
+ * The server is expected to quantize/dither images to the display's palette, so normally
+ *  every PNG palette entry is exactly one of the panel colors. Entries that aren't are
+ *  drawn as the closest panel color (see palette_map_nearest()). Maps are kept in RTC
+ *  memory, so the next image with the same palette doesn't compute it again.
  *
  * @param pngPalette Array of palette values defined in the indexed PNG file being decoded
+ * @param iEntries Number of entries of the PLTE chunk, 0 if unknown
+ * @param iBpp Bits per pixel of the image, bounds the palette when its length is unknown
  */
-static void build_palette_map(uint8_t pngPalette[]) {
-    int pngPaletteSize = get_palette_size(pngPalette);
-    if (pngPaletteSize <= 0) {
-        Log_error("Unable to determine palette size for indexed PNG");
-        // TODO: restart the MCU or something more fatal
+static void build_palette_map(const uint8_t *pngPalette, int iEntries, int iBpp) {
+    uint8_t ucIndexes[PALETTE_MAP_MAX_ENTRIES];
+    int iInexact;
+
+    if (!pngPalette) {
+        Log_error("Unable to build palette map without a PNG palette");
         return;
     }
-
-    // Validate that the PNG's palette is the same size as the display's palette
-    if (pngPaletteSize != bbep.getColorCount()) {
-        // If it's not, we'll still give it a go, but this is not expected behavior.
-        Log_error("WARNING: PNG palette size %d does not equal the palette size expected by this model's display %d",
-            pngPaletteSize, bbep.getColorCount());
+    if (iEntries <= 0) {
+        iEntries = 1 << iBpp;
+        Log_error("PLTE length unknown, mapping all %d entries", iEntries);
+    }
+    if (iEntries > PALETTE_MAP_MAX_ENTRIES) {
+        iEntries = PALETTE_MAP_MAX_ENTRIES;
     }
 
-    int i = 0;
-
-    esp_log_buffer_hex("display rgb lookup table", bbep.getRgbColorLookup(), bbep.getColorCount() * 3);
-    // Iterate over all PNG palette entries
-    for (i = 0; i < pngPaletteSize; ++i) {
-        uint32_t pngPaletteEntry = png_palette_triplet_to_rgb888(&pngPalette[i*3]);
-        Log_info_serial("PNG palette entry index %d is %X", i, pngPaletteEntry);
-        // Find the PNG palette entry in the display's list of supported PNG color codes
-        int displayPngPaletteIndex = uint32_array_search(bbep.getRgbColorLookup(), bbep.getColorCount(), pngPaletteEntry);
-        Log_info_serial("PNG palette entry index %d index into display palette is %d", i, displayPngPaletteIndex);
-
-        if (displayPngPaletteIndex < 0) {
-            // PNG palette entry is not supported by the display
-            Log_error("WARNING: PNG palette entry %X with index %d is not in the device's supported color list."
-                " PNG pixels with this palette's entry index will be drawn to the display as the first color in the palette (probably black).",
-                pngPaletteEntry,
-                i
-            );
-            paletteMap[i] = 0x00;
-            continue;
-        }
-
-        // Write to the palette map
-        paletteMap[i] = bbep.getColorLookup()[displayPngPaletteIndex];
+    bool bCached = paletteMapCache.map(pngPalette, iEntries, bbep.getRgbColorLookup(), bbep.getColorCount(),
+        ucIndexes, &iInexact);
+    for (int i = 0; i < iEntries; i++) {
+        paletteMap[i] = bbep.getColorLookup()[ucIndexes[i]];
     }
+    paletteMapSize = iEntries;
 
-    paletteMapSize = i;
-}
+    Log_info("Palette map for %d entries %s", iEntries, bCached ? "from RTC cache" : "computed");
+    if (iInexact) {
+        // The server should have quantized to the panel colors; not fatal, but worth knowing
+        Log_error("WARNING: %d of %d PNG palette entries are not panel colors, using the nearest ones",
+            iInexact, iEntries);
+    }
+} /* build_palette_map() */
 
 /** 
  * @brief JPEGDEC callback function passed blocks of MCUs (minimum coded units)
@@ -877,41 +747,10 @@ static void build_palette_map(uint8_t pngPalette[]) {
 int jpeg_draw(JPEGDRAW *pDraw)
 {
 #ifdef BB_EPAPER
-int x, y;
-int iPlane = *(int *)pDraw->pUser;
-uint8_t src=0, uc=0, ucMask, *s, *d, *pTemp = bbep.getCache();
-
-    bbep.setAddrWindow(pDraw->x, pDraw->y, pDraw->iWidth, pDraw->iHeight);
-    if (iPlane == 0) { // 1-bit mode
-        bbep.startWrite(PLANE_0); // start writing image data to plane 0
-        for (y=0; y<pDraw->iHeight; y++) { // this is 8 or 16 depending on the color subsampling
-            s = (uint8_t *)pDraw->pPixels;
-            s += (y * (pDraw->iWidth >> 3));
-            // The pixel format of the display is the same as JPEGDEC, so just copy it
-            bbep.writeData(s, (pDraw->iWidth+7)/8);
-        } // for y
-    } else {
-        bbep.startWrite((iPlane == 1) ? PLANE_0 : PLANE_1); // start writing image data to plane 0
-        for (y=0; y<pDraw->iHeight; y++) { // this is 8 or 16 depending on the color subsampling
-            d = pTemp;
-            s = (uint8_t *)pDither;
-            s += (y * (pDraw->iWidth >> 2));
-            ucMask = (iPlane == 1) ? 0x40 : 0x80; // lower or upper source bit
-            for (x=0; x<pDraw->iWidth; x++) {
-                if ((x & 3) == 0) { // new input byte
-                    src = *s++;
-                }
-                uc <<= 1;
-                if (src & ucMask) {
-                    uc |= 1; // high bit of source pair
-                }
-                src <<= 2;
-                if ((x & 7) == 7) { // new output byte
-                    *d++ = uc;
-                }
-            } // for x
-            bbep.writeData(pTemp, (pDraw->iWidth+7)/8);
-        } // for y
+    // The pixel format of the display is the same as JPEGDEC; blocks are sent a strip at a time
+    JpegStrip *strip = (JpegStrip *)pDraw->pUser;
+    if (!strip->addBlock(pDraw->x, pDraw->y, pDraw->iWidthUsed, pDraw->iHeight, pDraw->iWidth, (uint8_t *)pDraw->pPixels)) {
+        return 0;
     }
 #else // FastEPD
   int x, y, iPitch = bbep.width()/2; // assume 4-bpp drawing mode
@@ -925,6 +764,84 @@ uint8_t src=0, uc=0, ucMask, *s, *d, *pTemp = bbep.getCache();
 #endif
     return 1; // continue decoding
 } /* jpeg_draw() */
+#ifdef BB_EPAPER
+/**
+ * @brief JpegStrip callback: sends a full-width strip of 1-bpp rows as one transfer
+ */
+static bool jpeg_write_strip(void *ctx, int y, int iHeight, const uint8_t *pData, int iPitch)
+{
+    bbep.setAddrWindow(0, y, bbep.width(), iHeight);
+    bbep.startWrite(PLANE_0);
+    bbep.writeData((uint8_t *)pData, iPitch * iHeight);
+    return true;
+} /* jpeg_write_strip() */
+
+/**
+ * @brief JpegPlanes callback: sends a finished strip to both planes of the panel
+ * Each plane gets its own address window, so one decode fills both.
+ */
+static bool jpeg_write_planes(void *ctx, int y, int iHeight, const uint8_t *pPlane0, const uint8_t *pPlane1, int iPitch)
+{
+    bbep.setAddrWindow(0, y, bbep.width(), iHeight);
+    bbep.startWrite(PLANE_0);
+    bbep.writeData((uint8_t *)pPlane0, iPitch * iHeight);
+    bbep.setAddrWindow(0, y, bbep.width(), iHeight);
+    bbep.startWrite(PLANE_1);
+    bbep.writeData((uint8_t *)pPlane1, iPitch * iHeight);
+    return true;
+} /* jpeg_write_planes() */
+
+/**
+ * @brief JPEGDEC callback for 4-gray and B/W/R panels: collects blocks in the strip of JpegPlanes
+ * @return 1 to continue decoding or 0 to abort
+ */
+static int jpeg_draw_planes(JPEGDRAW *pDraw)
+{
+    JpegPlanes *planes = (JpegPlanes *)pDraw->pUser;
+    return planes->addBlock(pDraw->x, pDraw->y, pDraw->iWidthUsed, pDraw->iHeight, pDraw->iWidth, pDraw->pPixels) ? 1 : 0;
+} /* jpeg_draw_planes() */
+
+/**
+ * @brief Decodes a JPEG once into both planes of a 4-gray or B/W/R panel
+ * @param jpg decoder, opened on the image
+ * @param pointer to the buffer holding the JPEG file
+ * @param size of the JPEG file
+ * @return refresh mode, or -1 on error
+ */
+static int jpeg_to_planes(JPEGDEC *jpg, const uint8_t *pJPEG, int iDataSize, jpeg_planes_mode_e mode)
+{
+JpegPlanes planes;
+int rc;
+
+    if (!planes.begin(jpg->getWidth(), jpg->getHeight(), mode, PNG_DITHER_MODE, jpeg_write_planes, NULL)) {
+        Log_error("Not enough memory for the JPEG strip buffer");
+        return -1;
+    }
+    if (mode == JPEG_PLANES_FOUR_GRAY) {
+        Log_info("Decoding jpeg as 2-bpp gray in one pass");
+        bbep.setPanelType(TWO_BIT_PANEL);
+        iUpdateCount = 0; // grayscale mode resets the partial update counter
+    } else {
+        Log_info("Decoding jpeg as black/white/red in one pass");
+    }
+    jpg->close(); // open again with the strip callback
+    if (!jpg->openRAM((uint8_t *)pJPEG, iDataSize, jpeg_draw_planes)) {
+        return -1;
+    }
+    jpg->setPixelType((mode == JPEG_PLANES_FOUR_GRAY) ? EIGHT_BIT_GRAYSCALE : RGB565_LITTLE_ENDIAN);
+    jpg->setUserPointer((void *)&planes);
+    rc = jpg->decode(0, 0, 0) ? REFRESH_FULL : -1;
+    if (!planes.flush()) {
+        rc = -1;
+    }
+    if (rc < 0) {
+        Log_error("JPEG decode failed: %d", jpg->getLastError());
+    }
+    Log_info("%d strips sent to both planes", planes.strips());
+    return rc;
+} /* jpeg_to_planes() */
+#endif // BB_EPAPER
+
 /** 
  * @brief Function to decode and display a JPEG image from memory
  *        The decoded lines are written directly into the EPD framebuffer
@@ -937,7 +854,6 @@ int jpeg_to_epd(const uint8_t *pJPEG, int iDataSize)
 {
 JPEGDEC *jpg = new JPEGDEC();
 int rc = -1; // invalid mode
-int iPlane = 0;
 
     if (!jpg) return JPEG_ERROR_MEMORY; // not enough memory for the decoder instance
     rc = jpg->openRAM((uint8_t *)pJPEG, iDataSize, jpeg_draw);
@@ -947,30 +863,37 @@ int iPlane = 0;
             rc = -1;
         } else { // okay to decode
 #ifdef BB_EPAPER
-            //bbep.setPanelType(TWO_BIT_PANEL);
-            Log_info("%s [%d]: Decoding jpeg as 1-bpp dithered\r\n", __FILE__, __LINE__);
-            jpg->setPixelType(ONE_BIT_DITHERED); // request 1-bit dithered output
+            uint32_t u32Caps = bbep.capabilities();
+            if ((u32Caps & BBEP_3COLOR) || (JPEG_FOUR_GRAY && !(u32Caps & BBEP_FULL_COLOR))) {
+                rc = jpeg_to_planes(jpg, pJPEG, iDataSize, (u32Caps & BBEP_3COLOR) ? JPEG_PLANES_BWR : JPEG_PLANES_FOUR_GRAY);
+            } else {
+                uint8_t *pDither = (uint8_t *)malloc(jpg->getWidth() * 16);
+                JpegStrip strip;
+                if (!pDither || !strip.begin(jpg->getWidth(), jpg->getHeight(), jpeg_write_strip, NULL)) {
+                    Log_error("Not enough memory to decode the JPEG");
+                    rc = -1;
+                } else {
+                    Log_info("%s [%d]: Decoding jpeg as 1-bpp dithered\r\n", __FILE__, __LINE__);
+                    jpg->setPixelType(ONE_BIT_DITHERED); // request 1-bit dithered output
+                    jpg->setUserPointer((void *)&strip);
+                    rc = jpg->decodeDither(pDither, 0) ? REFRESH_FULL : -1;
+                    if (!strip.flush()) {
+                        rc = -1;
+                    }
+                    if (rc < 0) {
+                        Log_error("JPEG decode failed: %d", jpg->getLastError());
+                    }
+                    Log_info("%d strips sent", strip.strips());
+                }
+                free(pDither);
+            }
 #else
+            uint8_t *pDither = (uint8_t *)malloc(jpg->getWidth() * 16);
             bbep.setMode(BB_MODE_4BPP);
             Log_info("%s [%d]: Decoding jpeg as 4-bpp dithered\r\n", __FILE__, __LINE__);
             jpg->setPixelType(FOUR_BIT_DITHERED); // request 4-bit dithered output
-#endif
-            pDither = (uint8_t *)malloc(jpg->getWidth() * 16);
-            iPlane = 0;//1; // Decode first plane
-            Log_info("%s [%d]: Decoding plane 0\r\n", __FILE__, __LINE__);
-            jpg->setUserPointer((void *)&iPlane);
             jpg->decodeDither(pDither, 0);
-            jpg->close();
-            // Decode the second plane
-//            iPlane = 2;
-//            Log_info("%s [%d]: Decoding plane 1\r\n", __FILE__, __LINE__);
-//            jpg->openRAM((uint8_t *)pJPEG, iDataSize, jpeg_draw);
-//            jpg->setPixelType(TWO_BIT_DITHERED); // request 1-bit dithered output
-//            jpg->setUserPointer((void *)&iPlane);
-//            jpg->decodeDither(pDither, 0);
             free(pDither);
-#ifdef BB_EPAPER
-            rc = REFRESH_FULL;
 #endif
         }
     }
@@ -978,6 +901,46 @@ int iPlane = 0;
     free(jpg);
     return rc;
 } /* jpeg_to_epd() */
+/**
+ * @brief Sends the image to the panel through png_draw(), from the rows kept
+ *        in RAM by the first decode when there are any, otherwise by decoding it
+ * @param pointer to the PNG class instance
+ * @param rows kept by the first decode (may be empty)
+ * @param pointer to the buffer holding the PNG file
+ * @param size of the PNG file
+ * @param user pointer passed to png_draw()
+ * @return PNG_SUCCESS or a PNGdec error code
+ *
+ * When the PNG is portrait (bPngRotate), png_draw() hands its rows to pngRotator,
+ * which sends them to the panel as columns, 8 rows at a time.
+ */
+static int png_draw_pass(PNG *png, PngRowStore &rows, const uint8_t *pPNG, int iDataSize, void *pUser)
+{
+int rc;
+#ifdef BB_EPAPER
+    // plane 1 of a B/W/R panel is set for red, so it's padded with 0 for white
+    if (bPngRotate && !pngRotator.begin(png->getWidth(), png->getHeight(), png_write_column, pUser,
+                                        (pUser && *(int *)pUser == 1) ? 0x00 : 0xff)) {
+        Log_error("Not enough memory to rotate the PNG");
+        return PNG_MEM_ERROR;
+    }
+#endif
+    if (rows.complete()) {
+        rc = rows.replay(png_draw, pUser) ? PNG_SUCCESS : PNG_QUIT_EARLY;
+    } else {
+        png->openRAM((uint8_t *)pPNG, iDataSize, png_draw);
+        rc = png->decode(pUser, 0);
+        png->close();
+    }
+    if (pngRotator.active()) {
+        if (!pngRotator.flush() && rc == PNG_SUCCESS) {
+            rc = PNG_QUIT_EARLY;
+        }
+        pngRotator.end();
+    }
+    return rc;
+} /* png_draw_pass() */
+
 /** 
  * @brief Function to decode and display a PNG image from memory
  *        The decoded lines are written directly into the EPD framebuffer
@@ -991,14 +954,25 @@ int png_to_epd(const uint8_t *pPNG, int iDataSize)
 {
 int iPlane, rc = -1;
 PNG *png = new PNG();
+PngRowStore rows;
 
     if (!png) return PNG_MEM_ERROR; // not enough memory for the decoder instance
+    bPngRotate = false; // set below for portrait images
     rc = png->openRAM((uint8_t *)pPNG, iDataSize, png_draw);
     png->close();
     if (rc == PNG_SUCCESS) {
         Log_error("Decoding %d x %d PNG", png->getWidth(), png->getHeight());
         if (png->getWidth() == bbep.height() && png->getHeight() == bbep.width()) {
             Log_error("Rotating canvas to portrait orientation");
+#ifdef BB_EPAPER
+            if (bbep.capabilities() & BBEP_FULL_COLOR) {
+                // PngRowRotator works on 1-bpp rows; the 4-bpp color rows aren't rotated
+                Log_error("Portrait images are not supported on full color panels");
+                rc = -1;
+            } else {
+                bPngRotate = true;
+            }
+#endif
         } else if (png->getWidth() > bbep.width() || png->getHeight() > bbep.height()) {
             Log_error("PNG image is too large for display size (%dx%d)", png->getWidth(), png->getHeight());
             rc = -1;
@@ -1008,11 +982,22 @@ PNG *png = new PNG();
         }
         if (rc == PNG_SUCCESS) { // okay to decode
             bool bDisplayIsFullColor = bbep.capabilities() & BBEP_FULL_COLOR;
-            auto iPngColorCount = png_count_colors(png, pPNG, iDataSize);
+            int iPngColorCount = 0; // only needed to choose how to show 2-bpp images
+#ifdef BB_EPAPER
+            if (png->getBpp() == 2) {
+                // Decode once into RAM, counting the colors on the way; every plane is drawn from there
+                if (rows.begin(png->getWidth(), png->getHeight(), png->getBpp())) {
+                    png->openRAM((uint8_t *)pPNG, iDataSize, png_row_store_draw);
+                    if (png->decode(&rows, 0) != PNG_SUCCESS || !rows.complete()) {
+                        Log_error("Decode into RAM failed: %d", png->getLastError());
+                        rows.end();
+                    }
+                    png->close();
+                }
+                iPngColorCount = rows.complete() ? rows.colorCount() : png_count_colors(png, pPNG, iDataSize);
+            }
             Log_info("%s [%d]: Decoding %d-bpp png with %d colors; display supports >= 6 colors: %d", __FILE__, __LINE__, png->getBpp(), iPngColorCount, bDisplayIsFullColor);
-            Log_info("%s [%d]: Decoding %d-bpp png (current)\r\n", __FILE__, __LINE__, png->getBpp());
             // Prepare target memory window (entire display)
-#ifdef BB_EPAPER
             bbep.setAddrWindow(0, 0, bbep.width(), bbep.height());
             if (png->getBpp() == 1 || (png->getBpp() == 2 && iPngColorCount == 2)) {
                 Log_info("Drawing monochrome image");
@@ -1021,17 +1006,15 @@ PNG *png = new PNG();
                 bbep.setPanelType(ONE_BIT_PANEL);
                 rc = REFRESH_PARTIAL; // the new image is 1bpp - try a partial update
                 bbep.startWrite(PLANE_0); // start writing image data to plane 0
-                png->openRAM((uint8_t *)pPNG, iDataSize, png_draw);
-                if (png->getBpp() == 1 || png->getBpp() > 2) {
-                    png->decode(NULL, 0);
+                if (png->getBpp() == 1) {
+                    png_draw_pass(png, rows, pPNG, iDataSize, NULL);
                 } else { // convert the 2-bit image to 1-bit output
                     Log_info("%s [%d]: Current png only has 2 unique colors!\n", __FILE__, __LINE__);
                     iPlane = 2;
-                    if (png->decode(&iPlane, 0) != PNG_SUCCESS) {
+                    if (png_draw_pass(png, rows, pPNG, iDataSize, &iPlane) != PNG_SUCCESS) {
                         Log_info("%s [%d]: Error decoding image = %d\n", __FILE__, __LINE__, png->getLastError());
                     }
                 }
-                png->close();
             } else if (png->getBpp() == 2 && iPngColorCount == 3 && !bDisplayIsFullColor) {
                 Log_info("Drawing 3 color image");
                 // If the image is 2 bits per pixel and 3 colors, it's a 3 color display B/W/R
@@ -1039,20 +1022,17 @@ PNG *png = new PNG();
                 bbep.startWrite(PLANE_0); // start writing image data to plane 0
                 iPlane = 0;
                 Log_info("Writing plane 0 B\\W");
-                png->openRAM((uint8_t *)pPNG, iDataSize, png_draw);
-                if (png->decode(&iPlane, 0) != PNG_SUCCESS) {
+                if (png_draw_pass(png, rows, pPNG, iDataSize, &iPlane) != PNG_SUCCESS) {
                     Log_error("Plane 0 decode failed: %d", png->getLastError());
-                    png->close();
+                    free(png);
                     return -1;
                 }
-                png->close(); // start over for plane 1
-                iPlane = 1;
+                iPlane = 1; // start over for plane 1
                 Log_info("Writing plane 1 R");
-                png->openRAM((uint8_t *)pPNG, iDataSize, png_draw);
                 bbep.startWrite(PLANE_1); // start writing image data to plane 1
-                if (png->decode(&iPlane, 0) != PNG_SUCCESS) {
+                if (png_draw_pass(png, rows, pPNG, iDataSize, &iPlane) != PNG_SUCCESS) {
                     Log_error("Plane 1 decode failed: %d", png->getLastError());
-                    png->close();
+                    free(png);
                     return -1;
                 }
 
@@ -1080,47 +1060,219 @@ PNG *png = new PNG();
                 // png->openRAM((uint8_t *)pPNG, iDataSize, png_draw);
                 // bbep.startWrite(PLANE_1); // start writing image data to plane 1
                 // png->decode(&iPlane, 0); // decode it again to get plane 1 data
+            } else if (png->getBpp() > 2 && png->getPixelType() != PNG_PIXEL_INDEXED) {
+                // Grayscale and truecolor images are reduced to 1-bit in png_draw(), dithered row by row
+                Log_info("Drawing %d-bpp image dithered to monochrome", png->getBpp());
+                bbep.setPanelType(ONE_BIT_PANEL);
+                rc = REFRESH_PARTIAL;
+                bbep.startWrite(PLANE_0);
+                pngDither.begin(png->getWidth(), PNG_DITHER_MODE);
+                if (png_draw_pass(png, rows, pPNG, iDataSize, NULL) != PNG_SUCCESS) {
+                    Log_error("Dithered decode failed: %d", png->getLastError());
+                }
+                pngDither.end();
             } else if ((png->getBpp() >= 1 && png->getBpp() <= 8) && bDisplayIsFullColor) {
                 Log_info("Drawing %d color image to 'full color' display", iPngColorCount);
 
                 // Build palette map in global memory
                 // TODO: change PNGdec to accept palette map as a callback parameter so it's not always
                 //  sitting around in global memory even when not needed.
-                build_palette_map(png->getPalette());
+                build_palette_map(png->getPalette(), png_palette_entries(pPNG, iDataSize), png->getBpp());
 
                 // Send "data start transmission" command
                 bbep.startWrite(PLANE_0);
 
-                // Allocate RAM and set decode callback
-                png->openRAM((uint8_t *)pPNG, iDataSize, png_draw);
                 // Actually do the decoding (the callback will write image data to the EPD as it's decoded)
-                if (png->decode(&iPlane, 0) != PNG_SUCCESS) {
+                iPlane = 0;
+                if (png_draw_pass(png, rows, pPNG, iDataSize, &iPlane) != PNG_SUCCESS) {
                     Log_error("Plane 0 decode failed: %d", png->getLastError());
-                    png->close();
+                    free(png);
                     return -1;
                 }
-                png->close();
             } else {
                 Log_info("Unhandled display configuration");
                 rc = -1;
             }
 #else // FastEPD
             bbep.setMode((png->getBpp() == 1) ? BB_MODE_1BPP : BB_MODE_4BPP);
-            png->decode(NULL, 0);
-            png->close();
+            png_draw_pass(png, rows, pPNG, iDataSize, NULL);
 #endif
         }
     }
+    bPngRotate = false;
     free(png); // free the decoder instance
     return rc;
 } /* png_to_epd() */
+#ifdef BB_EPAPER
+/**
+ * @brief Function to pick the refresh the EPD gets instead of the one the decoder asked for
+ * @param iRefreshMode refresh mode requested by the decoder
+ * @param bWait the caller waits for the refresh; false for the loading screen
+ * @param bLog log why the mode was changed
+ * @return refresh mode to use
+ */
+static int display_refresh_mode(int iRefreshMode, bool bWait, bool bLog)
+{
+    if ((iUpdateCount & 7) == 0 || apiDisplayResult.response.maximum_compatibility == true) {
+        if (bLog) {
+            Log_info("%s [%d]: Forcing full refresh; desired refresh mode was: %d", __FILE__, __LINE__, iRefreshMode);
+        }
+        iRefreshMode = REFRESH_FULL; // force full refresh every 8 partials
+    }
+    int refresh_seconds = preferences.getUInt(PREFERENCES_SLEEP_TIME_KEY, SLEEP_TIME_TO_SLEEP);
+    if (refresh_seconds >= 30*60 && iRefreshMode == REFRESH_PARTIAL) {
+        // For users who set updates 30 minutes or longer, use the "fast" update to prevent ghosting
+        if (bLog) {
+            Log_info("%s [%d]: Forcing fast refresh (not partial) since the TRMNL refresh_rate is set to > 30 min\n", __FILE__, __LINE__);
+        }
+        iRefreshMode = REFRESH_FAST;
+    }
+    if (!bWait) iRefreshMode = REFRESH_PARTIAL; // fast update when showing loading screen
+    return iRefreshMode;
+} /* display_refresh_mode() */
+
+/**
+ * @brief Function to hash a packed frame (FNV-1a)
+ * @param pData packed frame
+ * @param iSize its size in bytes
+ * @return hash
+ */
+static uint32_t display_frame_hash(const uint8_t *pData, int iSize)
+{
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < iSize; i++) {
+        h = (h ^ pData[i]) * 16777619u;
+    }
+    return h;
+} /* display_frame_hash() */
+
+/**
+ * @brief Function to keep the 1-bit image just sent to the EPD, packed, in SPIFFS for the next wake
+ * @param none
+ * @return none
+ */
+static void display_keep_frame(void)
+{
+    int iRaw = ((bbep.width() + 7) / 8) * bbep.height();
+    int iSize;
+    uint8_t *pPacked;
+    const uint8_t *pData;
+
+    prev_frame_rtc.magic = 0; // not valid until it's all written
+    // packed frames which don't save half of it aren't worth the RAM: the framebuffer is kept as is
+    pPacked = (uint8_t *)malloc(iRaw / 2);
+    iSize = pPacked ? bbep.packPlane(pPacked, iRaw / 2) : 0;
+    pData = iSize ? pPacked : (const uint8_t *)bbep.getBuffer();
+    if (!iSize) iSize = iRaw;
+    if (filesystem_write_to_file(PREV_FRAME_FILE, (uint8_t *)pData, iSize) != (size_t)iSize) {
+        Log_error("%s [%d]: Unable to keep the frame for the next wake", __FILE__, __LINE__);
+        free(pPacked);
+        return;
+    }
+    prev_frame_rtc.width = bbep.width();
+    prev_frame_rtc.height = bbep.height();
+    prev_frame_rtc.size = iSize;
+    prev_frame_rtc.hash = display_frame_hash(pData, iSize);
+    prev_frame_rtc.magic = PREV_FRAME_MAGIC;
+    free(pPacked);
+    Log_info("%s [%d]: Kept the frame for the next wake: %d bytes in %s", __FILE__, __LINE__, iSize, PREV_FRAME_FILE);
+} /* display_keep_frame() */
+
+/**
+ * @brief Function to write the frame kept by display_keep_frame() to the EPD's old plane
+ *        A partial refresh then only moves the pixels which changed, as if it never slept.
+ * @param none
+ * @return true if the old plane holds the frame on the panel
+ */
+static bool display_restore_frame(void)
+{
+    uint8_t *pData;
+    int rc;
+
+    if (prev_frame_rtc.magic != PREV_FRAME_MAGIC || prev_frame_rtc.width != bbep.width() || prev_frame_rtc.height != bbep.height()) {
+        Log_info("%s [%d]: No frame kept for the EPD's old plane", __FILE__, __LINE__);
+        return false;
+    }
+    pData = (uint8_t *)malloc(prev_frame_rtc.size + 4); // G5 is read a few bytes ahead
+    if (!pData || !filesystem_read_from_file(PREV_FRAME_FILE, pData, prev_frame_rtc.size)) {
+        Log_error("%s [%d]: Unable to read %s", __FILE__, __LINE__, PREV_FRAME_FILE);
+        free(pData);
+        return false;
+    }
+    if (display_frame_hash(pData, prev_frame_rtc.size) != prev_frame_rtc.hash) {
+        rc = BBEP_ERROR_BAD_DATA;
+    } else {
+        rc = bbep.writeOldPlane(pData, prev_frame_rtc.size);
+    }
+    free(pData);
+    if (rc != BBEP_SUCCESS) {
+        Log_error("%s [%d]: Unable to restore the EPD's old plane (error %d)", __FILE__, __LINE__, rc);
+        return false;
+    }
+    Log_info("%s [%d]: Restored the EPD's old plane from %d bytes in %d ms", __FILE__, __LINE__, prev_frame_rtc.size, bbep.dataTime());
+    return true;
+} /* display_restore_frame() */
+
+/**
+ * @brief Function to send the 1-bit image in the framebuffer to the EPD
+ *        An image the panel already shows isn't sent or refreshed at all. When it gets a
+ *        partial refresh in the wake of the last image, only the windows which changed are
+ *        sent; the panel keeps the rest in its memory. After deep sleep (i.e. the first image
+ *        of every wake) that memory is gone: the last image goes back to its old plane and
+ *        the new one is sent whole, since its plane has nothing outside the windows either.
+ * @param bWait the caller waits for the refresh; false for the loading screen
+ * @return false if the panel already shows this image and needs no refresh
+ */
+static bool display_write_frame(bool bWait)
+{
+    FrameDiffResult diff;
+    int iWidth = bbep.width(), iHeight = bbep.height();
+
+    bFrameTracked = false;
+    if (!bWait || bbep.getRotation() != 0 || display_refresh_mode(REFRESH_PARTIAL, bWait, false) != REFRESH_PARTIAL) {
+        bbep.writePlane(PLANE_0); // the whole panel gets redrawn anyway
+        return true;
+    }
+    bFrameTracked = true;
+    frameDiff.compare((const uint8_t *)bbep.getBuffer(), iWidth, iHeight, (iWidth + 7) / 8, diff);
+    if (diff.kind == FRAME_DIFF_UNCHANGED) {
+        return false;
+    }
+    if (!frameDiff.panelRamValid()) {
+        // the EPD was reset since (deep sleep): both planes lost the frame it shows
+        if (display_restore_frame()) {
+            bbep.writePlane(PLANE_0);
+        } else {
+            // the old plane holds nothing known: an inverted one makes the partial refresh drive every pixel
+            bbep.writePlane(PLANE_FALSE_DIFF);
+        }
+        return true;
+    }
+    if (diff.kind == FRAME_DIFF_WINDOWS) {
+        for (int i = 0; i < diff.count; i++) {
+            const DirtyWindow &w = diff.windows[i];
+            if (bbep.writeWindow(w.x, w.y, w.width, w.height) != BBEP_SUCCESS) {
+                Log_info("%s [%d]: EPD can't take windows (error %d); sending the whole image", __FILE__, __LINE__, bbep.getLastError());
+                bbep.writePlane(PLANE_0);
+                return true;
+            }
+            Log_info("%s [%d]: Changed window %d: %dx%d at (%d,%d)", __FILE__, __LINE__, i, w.width, w.height, w.x, w.y);
+        }
+        Log_info("%s [%d]: Sent %d of %d tiles (%d changed)", __FILE__, __LINE__, diff.window_tiles, FrameDiff::tileCount(iWidth, iHeight), diff.dirty_tiles);
+        return true;
+    }
+    bbep.writePlane(PLANE_0);
+    return true;
+} /* display_write_frame() */
+#endif // BB_EPAPER
+
 /** 
  * @brief Function to show the image on the display
  * @param image_buffer pointer to the uint8_t image buffer
  * @param reverse shows if the color scheme is reverse
- * @return none
+ * @return false if the image was rejected and the panel left as it was
  */
-void display_show_image(uint8_t *image_buffer, int data_size, bool bWait)
+bool display_show_image(uint8_t *image_buffer, int data_size, bool bWait)
 
 {
     Log_info("display_show_image start. Data size: %d; wait: %d", data_size, bWait);
@@ -1130,6 +1282,7 @@ void display_show_image(uint8_t *image_buffer, int data_size, bool bWait)
     auto height = display_height();
 //    uint32_t *d32;
     bool bAlloc = false;
+    int iPlanes = 1; // of a G5 image
 #ifdef BB_EPAPER
     int iRefreshMode = REFRESH_FULL; // assume full (slow) refresh
 #else
@@ -1172,49 +1325,28 @@ void display_show_image(uint8_t *image_buffer, int data_size, bool bWait)
     }
     else // uncompressed BMP or Group5 compressed image
     {
-        if (*(uint16_t *)image_buffer == BB_BITMAP_MARKER)
+        if (image_format_detect(image_buffer, data_size) & (IMAGE_FORMAT_G5 | IMAGE_FORMAT_G5_2PLANE))
         {
-            Log_info("G5 compressed image");
-            BB_BITMAP *pBBB = (BB_BITMAP *)image_buffer;
+            G5ImageInfo g5;
+            g5_image_err_e g5Err = g5_image_check(image_buffer, data_size, width, height, display_image_formats(), &g5);
+            if (g5Err != G5_IMAGE_OK) {
+                Log_error("G5 image rejected: error %d, %d bytes, panel=%dx%d", g5Err, data_size, width, height);
+                return false; // nothing was drawn yet; the caller reports it
+            }
+            Log_info("G5 compressed image: %dx%d, %d plane(s) at (%d,%d)", g5.width, g5.height, g5.planes, g5.x, g5.y);
+            iPlanes = g5.planes;
 #ifdef BB_EPAPER
-            bbep.allocBuffer(false);
+            if (iPlanes == 2 && !(bbep.capabilities() & BBEP_3COLOR)) {
+                bbep.setPanelType(TWO_BIT_PANEL); // the planes are the 2 bits of each gray
+                iUpdateCount = 0; // grayscale mode resets the partial update counter
+            }
+            bbep.allocBuffer(iPlanes == 2);
             bAlloc = true;
 #endif
-            const int panel_w = width;
-            const int panel_h = height;
-            if (pBBB->width <= 0 || pBBB->height <= 0 ||
-                pBBB->width > 8192 || pBBB->height > 8192) {
-                Log_fatal("G5 header invalid: %dx%d", pBBB->width, pBBB->height);
-                ESP.restart();
-            }
-            int x = (panel_w - pBBB->width)/2;
-            int y = (panel_h - pBBB->height)/2;
-            if (pBBB->width > panel_w || pBBB->height > panel_h) {
-                Log_fatal("G5 image too large for panel: %dx%d > %dx%d", pBBB->width, pBBB->height, panel_w, panel_h);
-                // Option A: scale down using bbep.loadG5Image(..., scale)
-                // Option B: implement a clipped blit (preferred for safety)
-                // Until clipping is implemented, refuse to draw to avoid overflow:
-                ESP.restart();
-            }
-
-            const int frame_bytes = ((panel_w + 7) >> 3) * panel_h;
-            const bool width_byte_aligned = pBBB->width % 8 == 0;
-            const bool x_byte_aligned = x % 8 == 0;
-
-            if (pBBB->width != panel_w || pBBB->height != panel_h) {
-                Log_fatal("G5 not full-frame: %dx%d, panel=%dx%d", pBBB->width, pBBB->height, panel_w, panel_h);
-                ESP.restart();
-            }
-
-            if (!width_byte_aligned || !x_byte_aligned) {
-                Log_info("G5 placement not byte-aligned (w=%d, x=%d). Drawing at (0,0) to avoid overrun.", pBBB->width, x);
-                // Optional: clear to white if image smaller than panel
+            if (g5.width < width || g5.height < height) { // parts of the panel stay uncovered
                 bbep.fillScreen(BBEP_WHITE);
-                bbep.loadG5Image(image_buffer, 0, 0, BBEP_WHITE, BBEP_BLACK);
-            } else {
-                if (x > 0 || y > 0) bbep.fillScreen(BBEP_WHITE);
-                bbep.loadG5Image(image_buffer, x, y, BBEP_WHITE, BBEP_BLACK);
             }
+            bbep.loadG5Image(image_buffer, g5.x, g5.y, BBEP_WHITE, BBEP_BLACK);
         }
         else 
         {
@@ -1227,26 +1359,61 @@ void display_show_image(uint8_t *image_buffer, int data_size, bool bWait)
 #endif
         }
 #ifdef BB_EPAPER
-        bbep.writePlane(PLANE_0); // send image data to the EPD
-        iRefreshMode = REFRESH_PARTIAL;
-#endif
+        if (iPlanes == 2) { // gray levels and red need a full refresh
+            bbep.writePlane(PLANE_BOTH);
+            iRefreshMode = REFRESH_FULL;
+        } else {
+            iRefreshMode = REFRESH_PARTIAL;
+            iUpdateCount = 1; // use partial update
+            if (!display_write_frame(bWait)) { // send image data to the EPD
+                Log_info("%s [%d]: The panel already shows this image; no refresh", __FILE__, __LINE__);
+                if (bAlloc) {
+                    bbep.freeBuffer();
+                }
+                return true;
+            }
+        }
+#else
         iUpdateCount = 1; // use partial update
+#endif
     }
+    display_refresh_buffer(iRefreshMode, bWait, bAlloc);
+    return true;
+}
+
+/**
+ * @brief Function to refresh the EPD with the image data already sent to it
+ * @param iRefreshMode refresh mode requested by the decoder
+ * @param bWait wait for the refresh to complete
+ * @param bAlloc a local framebuffer was allocated and must be freed
+ * @return none
+ */
+static void display_refresh_buffer(int iRefreshMode, bool bWait, bool bAlloc)
+{
     Log_info("Display refresh start");
 #ifdef BB_EPAPER
-    if ((iUpdateCount & 7) == 0 || apiDisplayResult.response.maximum_compatibility == true) {
-        Log_info("%s [%d]: Forcing full refresh; desired refresh mode was: %d", __FILE__, __LINE__, iRefreshMode);
-        iRefreshMode = REFRESH_FULL; // force full refresh every 8 partials
+    int rc;
+
+    iRefreshMode = display_refresh_mode(iRefreshMode, bWait, true);
+    Log_info("%s [%d]: EPD refresh mode: %d", __FILE__, __LINE__, iRefreshMode);
+    if (bWait && bAsyncRefresh) {
+        // the panel updates on its own; the next command to it or display_refresh_join() waits
+        rc = bbep.refresh(iRefreshMode, false);
+        bRefreshPending = true;
+    } else {
+        rc = bbep.refresh(iRefreshMode, bWait);
+        if (bWait) {
+            Log_info("%s [%d]: EPD busy for %d ms", __FILE__, __LINE__, bbep.busyTime());
+        }
     }
-    int refresh_seconds = preferences.getUInt(PREFERENCES_SLEEP_TIME_KEY, SLEEP_TIME_TO_SLEEP);
-    if (refresh_seconds >= 30*60 && iRefreshMode == REFRESH_PARTIAL) {
-        // For users who set updates 30 minutes or longer, use the "fast" update to prevent ghosting
-        Log_info("%s [%d]: Forcing fast refresh (not partial) since the TRMNL refresh_rate is set to > 30 min\n", __FILE__, __LINE__);
-        iRefreshMode = REFRESH_FAST;
+    // the next 1-bit image is compared with this one only if it went through frameDiff
+    if (bFrameTracked && rc == BBEP_SUCCESS) {
+        frameDiff.commit();
+        display_keep_frame(); // while the panel updates
+    } else {
+        display_forget_frame();
     }
-    if (!bWait) iRefreshMode = REFRESH_PARTIAL; // fast update when showing loading screen
-    Log_info("%s [%d]: EPD refresh mode: %d", __FILE__, __LINE__, iRefreshMode);
-    bbep.refresh(iRefreshMode, bWait);
+    bFrameTracked = false;
     Log_info("display_show_image near end; freeing buffer: %d", bAlloc);
     if (bAlloc) {
         bbep.freeBuffer();
@@ -1258,6 +1425,139 @@ void display_show_image(uint8_t *image_buffer, int data_size, bool bWait)
 #endif
     Log_info("display_show_image end");
 }
+
+/**
+ * @brief Function to decode a PNG while it is being downloaded and write it to the EPD
+ *        PNGdec pulls the compressed data through the stream callbacks and png_draw()
+ *        pushes each line to the panel, so the radio time overlaps decoding and SPI.
+ *        Only images which don't need a color counting pass are handled here.
+ * @param source PNG stream positioned at the start of the response body
+ * @return refresh mode, -1 on failure or DISPLAY_STREAM_NEEDS_BUFFER
+ */
+int display_stream_png(PngStreamSource &source)
+{
+int iPlane = 0, rc;
+PNG *png = new PNG();
+
+    if (!png) return DISPLAY_STREAM_NEEDS_BUFFER;
+    rc = png->open((const char *)&source, png_stream_open, png_stream_close, png_stream_read, png_stream_seek, png_draw);
+    if (rc != PNG_SUCCESS) {
+        Log_error("PNG stream open failed: %d", rc);
+        free(png);
+        return source.failed() ? -1 : DISPLAY_STREAM_NEEDS_BUFFER;
+    }
+    if (png->getWidth() > bbep.width() || png->getHeight() > bbep.height()) {
+        // Rotated or oversized images take the buffered path which knows how to deal with them
+        png->close();
+        free(png);
+        return DISPLAY_STREAM_NEEDS_BUFFER;
+    }
+#ifdef BB_EPAPER
+    bool bDisplayIsFullColor = bbep.capabilities() & BBEP_FULL_COLOR;
+    if (png->getBpp() == 1) {
+        Log_info("Streaming monochrome image");
+        bbep.fillScreen(BBEP_WHITE);
+        bbep.setPanelType(ONE_BIT_PANEL);
+        rc = REFRESH_PARTIAL;
+        bbep.setAddrWindow(0, 0, bbep.width(), bbep.height());
+        bbep.startWrite(PLANE_0);
+        if (png->decode(NULL, 0) != PNG_SUCCESS) {
+            Log_error("Streamed decode failed: %d", png->getLastError());
+            rc = -1;
+        }
+    } else if (png->getBpp() <= 8 && png->getPixelType() == PNG_PIXEL_INDEXED && bDisplayIsFullColor) {
+        Log_info("Streaming %d-bpp indexed image to 'full color' display", png->getBpp());
+        bbep.fillScreen(BBEP_WHITE);
+        rc = REFRESH_FULL;
+        paletteMapSize = 0; // built from the PLTE chunk on the first line
+        pStreamingPng = &source;
+        bbep.setAddrWindow(0, 0, bbep.width(), bbep.height());
+        bbep.startWrite(PLANE_0);
+        if (png->decode(&iPlane, 0) != PNG_SUCCESS) {
+            Log_error("Streamed decode failed: %d", png->getLastError());
+            rc = -1;
+        }
+        pStreamingPng = NULL;
+    } else if (png->getBpp() > 2 && png->getPixelType() != PNG_PIXEL_INDEXED) {
+        Log_info("Streaming %d-bpp image dithered to monochrome", png->getBpp());
+        bbep.fillScreen(BBEP_WHITE);
+        bbep.setPanelType(ONE_BIT_PANEL);
+        rc = REFRESH_PARTIAL;
+        bbep.setAddrWindow(0, 0, bbep.width(), bbep.height());
+        bbep.startWrite(PLANE_0);
+        pngDither.begin(png->getWidth(), PNG_DITHER_MODE);
+        if (png->decode(NULL, 0) != PNG_SUCCESS) {
+            Log_error("Streamed decode failed: %d", png->getLastError());
+            rc = -1;
+        }
+        pngDither.end();
+    } else {
+        // 2-bpp images need png_count_colors() before the first line can be sent
+        rc = DISPLAY_STREAM_NEEDS_BUFFER;
+    }
+#else // FastEPD
+    bbep.fillScreen(BBEP_WHITE);
+    bbep.setMode((png->getBpp() == 1) ? BB_MODE_1BPP : BB_MODE_4BPP);
+    rc = 0;
+    if (png->decode(NULL, 0) != PNG_SUCCESS) {
+        Log_error("Streamed decode failed: %d", png->getLastError());
+        rc = -1;
+    }
+#endif
+    png->close();
+    free(png);
+    if (rc != DISPLAY_STREAM_NEEDS_BUFFER && source.failed()) {
+        Log_error("PNG stream failed after %d bytes", (int)source.bytesReceived());
+        rc = -1;
+    }
+    return rc;
+} /* display_stream_png() */
+
+void display_refresh_image(int iRefreshMode, bool bWait)
+{
+    display_refresh_buffer(iRefreshMode, bWait, false);
+} /* display_refresh_image() */
+
+/**
+ * @brief Function to let the refreshes which wait return as soon as they are started
+ * @param async true to start refreshes and join them later with display_refresh_join()
+ * @return none
+ */
+void display_set_async_refresh(bool async)
+{
+    bAsyncRefresh = async;
+} /* display_set_async_refresh() */
+
+/**
+ * @brief Function to tell if a refresh was started asynchronously and not joined yet
+ * @param none
+ * @return true if display_refresh_join() has something to wait for
+ */
+bool display_refresh_pending(void)
+{
+    return bRefreshPending;
+} /* display_refresh_pending() */
+
+/**
+ * @brief Function to wait for the refresh started asynchronously
+ * @param none
+ * @return time waited in ms, 0 if no refresh was pending
+ */
+int display_refresh_join(void)
+{
+    int iWaited = 0;
+
+    if (!bRefreshPending) {
+        return 0;
+    }
+    bRefreshPending = false;
+#ifdef BB_EPAPER
+    bbep.wait();
+    iWaited = bbep.busyTime();
+    Log_info("%s [%d]: EPD refresh joined; waited %d ms for it", __FILE__, __LINE__, iWaited);
+#endif
+    return iWaited;
+} /* display_refresh_join() */
 /**
  * @brief Function to read an image from the file system
  * @param filename
@@ -1614,6 +1914,7 @@ void display_show_msg(uint8_t *image_buffer, MSG message_type)
     }
 #ifdef BB_EPAPER
     bbep.writePlane(PLANE_0);
+    display_forget_frame(); // not a tracked image
     bbep.refresh(REFRESH_FULL, true);
     bbep.freeBuffer();
 #else
@@ -1702,6 +2003,7 @@ void display_show_msg_qa(uint8_t *image_buffer, const float *voltage, const floa
 
     #ifdef BB_EPAPER
         bbep.writePlane(PLANE_0);
+        display_forget_frame(); // not a tracked image
         bbep.refresh(REFRESH_FULL, true);
         bbep.freeBuffer();
     #else
@@ -1747,6 +2049,7 @@ void display_show_msg(uint8_t *image_buffer, MSG message_type, String friendly_i
         bbep.fillScreen(BBEP_BLACK);
 #ifdef BB_EPAPER
         bbep.writePlane(PLANE_0);
+        display_forget_frame(); // not a tracked image
         if (!apiDisplayResult.response.maximum_compatibility) {
             bbep.refresh(REFRESH_FAST, true); // newer panel can handle the fast refresh
         } else {
@@ -1861,6 +2164,7 @@ void display_show_msg(uint8_t *image_buffer, MSG message_type, String friendly_i
     Log_info("Start drawing...");
 #ifdef BB_EPAPER
     bbep.writePlane(PLANE_0);
+    display_forget_frame(); // not a tracked image
     bbep.refresh(REFRESH_FULL, true);
     bbep.freeBuffer();
 #else
@@ -1876,9 +2180,11 @@ void display_show_msg(uint8_t *image_buffer, MSG message_type, String friendly_i
  */
 void display_sleep(void)
 {
+    display_refresh_join();
     Log_info("Goto Sleep...");
 #ifdef BB_EPAPER
     bbep.sleep(DEEP_SLEEP);
+    frameDiff.panelReset(); // its memory is gone, the glass keeps the image
 #else
     bbep.einkPower(0);
     bbep.deInit();
@@ -0,0 +1,88 @@
+#include <Arduino.h>
+#include <trmnl_log.h>
+#include <http_client.h>
+#include <udp_dns_resolver.h>
+
+/** @return true if host was resolved through the cache (IP literals are left to the client) */
+static bool resolveCached(const char *host, IPAddress &ip)
+{
+  if (ip.fromString(host))
+    return false;
+  uint32_t address;
+  if (!dnsCache.resolve(host, &address))
+    return false;
+  ip = IPAddress(address);
+  return true;
+}
+
+/**
+ * HTTPClient connects by host name, which makes WiFiClient(Secure) call hostByName()
+ * for every new connection. These look the name up in dnsCache instead, and fall back
+ * to the regular lookup when the cached address doesn't answer.
+ */
+class CachedDnsClient : public WiFiClient
+{
+public:
+  using WiFiClient::connect;
+
+  int connect(const char *host, uint16_t port, int32_t timeout) override
+  {
+    IPAddress ip;
+    if (resolveCached(host, ip))
+    {
+      if (WiFiClient::connect(ip, port, timeout))
+        return 1;
+      dnsCache.forget(host);
+    }
+    return WiFiClient::connect(host, port, timeout);
+  }
+};
+
+class CachedDnsSecureClient : public WiFiClientSecure
+{
+public:
+  using WiFiClientSecure::connect;
+
+  int connect(const char *host, uint16_t port, int32_t timeout) override
+  {
+    IPAddress ip;
+    if (resolveCached(host, ip))
+    {
+      _timeout = timeout;
+      // host is still passed for SNI and certificate checks
+      if (WiFiClientSecure::connect(ip, port, host, NULL, NULL, NULL))
+        return 1;
+      dnsCache.forget(host);
+    }
+    return WiFiClientSecure::connect(host, port, timeout);
+  }
+};
+
+static HttpConnection *createHttpConnection(const UrlOrigin &origin)
+{
+  HttpConnection *connection = new HttpConnection();
+  if (origin.secure)
+  {
+    WiFiClientSecure *secureClient = new CachedDnsSecureClient();
+    secureClient->setInsecure();
+    connection->client.reset(secureClient);
+  }
+  else
+  {
+    connection->client.reset(new CachedDnsClient());
+  }
+  Log_info("New connection to %s:%d", origin.host, origin.port);
+  return connection;
+}
+
+ConnectionPool<HttpConnection> httpConnectionPool(createHttpConnection);
+
+void drainHttpConnections(void)
+{
+  if (httpConnectionPool.size() > 0)
+  {
+    Log_info("Closing HTTP connections: %d opened, %d requests reused one",
+             httpConnectionPool.openedCount(), httpConnectionPool.reusedCount());
+  }
+  httpConnectionPool.drain();
+}
@@ -0,0 +1,73 @@
+#include <Arduino.h>
+#include <SPIFFS.h>
+#include <filesystem.h>
+#include <partial_download_store.h>
+
+bool SpiffsPartialStore::readMeta(PartialDownloadMeta &meta)
+{
+  if (!SPIFFS.exists(PARTIAL_DOWNLOAD_META_FILE))
+    return false;
+  File file = SPIFFS.open(PARTIAL_DOWNLOAD_META_FILE, FILE_READ);
+  if (!file)
+    return false;
+  bool ok = file.read((uint8_t *)&meta, sizeof(meta)) == sizeof(meta);
+  file.close();
+  return ok;
+}
+
+bool SpiffsPartialStore::writeMeta(const PartialDownloadMeta &meta)
+{
+  File file = SPIFFS.open(PARTIAL_DOWNLOAD_META_FILE, FILE_WRITE);
+  if (!file)
+    return false;
+  bool ok = file.write((const uint8_t *)&meta, sizeof(meta)) == sizeof(meta);
+  file.close();
+  return ok;
+}
+
+size_t SpiffsPartialStore::bodySize()
+{
+  if (!SPIFFS.exists(PARTIAL_DOWNLOAD_BODY_FILE))
+    return 0;
+  File file = SPIFFS.open(PARTIAL_DOWNLOAD_BODY_FILE, FILE_READ);
+  if (!file)
+    return 0;
+  size_t size = file.size();
+  file.close();
+  return size;
+}
+
+bool SpiffsPartialStore::readBody(uint8_t *buf, size_t len)
+{
+  File file = SPIFFS.open(PARTIAL_DOWNLOAD_BODY_FILE, FILE_READ);
+  if (!file)
+    return false;
+  bool ok = file.read(buf, len) == len;
+  file.close();
+  return ok;
+}
+
+bool SpiffsPartialStore::writeBody(const uint8_t *data, size_t len)
+{
+  File file = SPIFFS.open(PARTIAL_DOWNLOAD_BODY_FILE, FILE_WRITE);
+  if (!file)
+    return false;
+  bool ok = file.write(data, len) == len;
+  file.close();
+  return ok;
+}
+
+void SpiffsPartialStore::remove()
+{
+  if (SPIFFS.exists(PARTIAL_DOWNLOAD_BODY_FILE))
+    SPIFFS.remove(PARTIAL_DOWNLOAD_BODY_FILE);
+  if (SPIFFS.exists(PARTIAL_DOWNLOAD_META_FILE))
+    SPIFFS.remove(PARTIAL_DOWNLOAD_META_FILE);
+}
+
+bool SpiffsPartialStore::adopt(const char *path)
+{
+  if (SPIFFS.exists(PARTIAL_DOWNLOAD_BODY_FILE))
+    SPIFFS.remove(PARTIAL_DOWNLOAD_BODY_FILE);
+  return filesystem_file_rename(path, PARTIAL_DOWNLOAD_BODY_FILE);
+}
@@ -0,0 +1,136 @@
+#include <Arduino.h>
+#include <time.h>
+#include <mbedtls/ssl.h>
+#include <mbedtls/platform.h>
+#include <trmnl_log.h>
+#include <tls_session_cache.h>
+#include <tls_session_resume.h>
+#include <rtc_budget.h>
+
+RTC_DATA_ATTR static TlsSessionCacheRtc tls_session_rtc;
+static_assert(sizeof(tls_session_rtc) <= RTC_BUDGET_TLS, "TLS session cache over its RTC share (rtc_budget.h)");
+
+static uint32_t tls_session_now_s()
+{
+  // system time keeps running through deep sleep
+  return (uint32_t)time(nullptr);
+}
+
+static TlsSessionCache tls_sessions(tls_session_rtc, tls_session_now_s);
+
+/** Handshake in progress; ssl_client does one at a time */
+static struct
+{
+  mbedtls_ssl_context *ssl;
+  char host[64];
+  unsigned long start;
+  bool offered;
+  mbedtls_time_t offered_start;
+} pending;
+
+static void save_session(const mbedtls_ssl_context *ssl, const char *host, mbedtls_time_t *session_start)
+{
+  mbedtls_ssl_session session;
+  mbedtls_ssl_session_init(&session);
+
+  if (mbedtls_ssl_get_session(ssl, &session) == 0)
+  {
+    *session_start = session.start;
+
+#if defined(MBEDTLS_SSL_KEEP_PEER_CERTIFICATE)
+    // the certificate is only needed to verify a full handshake and would not fit in RTC memory
+    if (session.peer_cert != NULL)
+    {
+      mbedtls_x509_crt_free(session.peer_cert);
+      mbedtls_free(session.peer_cert);
+      session.peer_cert = NULL;
+    }
+#endif
+
+    uint32_t lifetime = TLS_SESSION_MAX_AGE_S;
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+    if (session.ticket_len > 0)
+      lifetime = session.ticket_lifetime;
+#endif
+
+    uint8_t buf[TLS_SESSION_MAX_SIZE];
+    size_t len = 0;
+    if (mbedtls_ssl_session_save(&session, buf, sizeof(buf), &len) != 0 || !tls_sessions.store(host, buf, len, lifetime))
+    {
+      Log_info("TLS session for %s not cached (too large)", host);
+    }
+  }
+
+  mbedtls_ssl_session_free(&session);
+}
+
+extern "C"
+{
+  int __real_mbedtls_ssl_set_hostname(mbedtls_ssl_context *ssl, const char *hostname);
+  int __real_mbedtls_ssl_handshake(mbedtls_ssl_context *ssl);
+
+  int __wrap_mbedtls_ssl_set_hostname(mbedtls_ssl_context *ssl, const char *hostname)
+  {
+    int ret = __real_mbedtls_ssl_set_hostname(ssl, hostname);
+    if (ret != 0 || hostname == NULL || strlen(hostname) >= sizeof(pending.host))
+      return ret;
+
+    pending.ssl = ssl;
+    strcpy(pending.host, hostname);
+    pending.start = millis();
+    pending.offered = false;
+
+    const TlsSessionEntry *entry = tls_sessions.find(hostname);
+    if (entry != nullptr)
+    {
+      mbedtls_ssl_session session;
+      mbedtls_ssl_session_init(&session);
+      if (mbedtls_ssl_session_load(&session, entry->data, entry->size) == 0 && mbedtls_ssl_set_session(ssl, &session) == 0)
+      {
+        pending.offered = true;
+        pending.offered_start = session.start;
+      }
+      else
+      {
+        tls_sessions.forget(hostname);
+      }
+      mbedtls_ssl_session_free(&session);
+    }
+    return ret;
+  }
+
+  int __wrap_mbedtls_ssl_handshake(mbedtls_ssl_context *ssl)
+  {
+    int ret = __real_mbedtls_ssl_handshake(ssl);
+    if (ssl != pending.ssl || ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE)
+      return ret;
+
+    pending.ssl = NULL;
+    if (ret != 0)
+    {
+      // don't offer the same session again if that is what the server choked on
+      if (pending.offered)
+        tls_sessions.forget(pending.host);
+      return ret;
+    }
+
+    uint32_t elapsed = millis() - pending.start;
+    mbedtls_time_t session_start = 0;
+    save_session(ssl, pending.host, &session_start);
+
+    // a resumed session keeps the start time of the handshake that created it
+    bool resumed = pending.offered && session_start == pending.offered_start;
+    tls_sessions.recordHandshake(resumed, elapsed);
+    Log_info("TLS handshake with %s: %u ms (%s)", pending.host, elapsed, resumed ? "resumed" : "full");
+    return ret;
+  }
+}
+
+void tls_session_log_stats(void)
+{
+  const TlsHandshakeStats &full = tls_sessions.fullStats();
+  const TlsHandshakeStats &resumed = tls_sessions.resumedStats();
+  Log_info("TLS handshakes since power on: %u full (avg %u ms), %u resumed (avg %u ms)",
+           full.count, full.count ? full.total_ms / full.count : 0,
+           resumed.count, resumed.count ? resumed.total_ms / resumed.count : 0);
+}
@@ -0,0 +1,147 @@
+#include <Arduino.h>
+#include <time.h>
+#include <esp_random.h>
+#include <lwip/sockets.h>
+#include <lwip/dns.h>
+#include <dns_message.h>
+#include <trmnl_log.h>
+#include <udp_dns_resolver.h>
+#include <rtc_budget.h>
+
+UdpDnsResolver::UdpDnsResolver()
+{
+  for (auto &query : queries)
+  {
+    query.host[0] = 0;
+    query.sock = -1;
+    query.id = 0;
+  }
+}
+
+UdpDnsResolver::Query *UdpDnsResolver::find(const char *host)
+{
+  for (auto &query : queries)
+  {
+    if (query.sock >= 0 && strcasecmp(query.host, host) == 0)
+      return &query;
+  }
+  return nullptr;
+}
+
+void UdpDnsResolver::close(Query &query)
+{
+  if (query.sock >= 0)
+    lwip_close(query.sock);
+  query.sock = -1;
+  query.host[0] = 0;
+}
+
+bool UdpDnsResolver::start(const char *host)
+{
+  if (strlen(host) >= DNS_CACHE_HOST_MAX_LEN)
+    return false;
+
+  Query *query = find(host);
+  if (query != nullptr)
+    close(*query);
+  for (int i = 0; query == nullptr && i < DNS_CACHE_ENTRIES + 1; i++)
+  {
+    if (queries[i].sock < 0)
+      query = &queries[i];
+  }
+  if (query == nullptr)
+    return false;
+
+  const ip_addr_t *server = dns_getserver(0);
+  if (server == nullptr || !IP_IS_V4(server) || ip_addr_isany(server))
+  {
+    Log_error_serial("DNS: no server configured");
+    return false;
+  }
+
+  uint8_t message[DNS_MAX_MESSAGE_SIZE];
+  uint16_t id = (uint16_t)esp_random();
+  size_t len = dns_build_query(message, sizeof(message), id, host);
+  if (len == 0)
+    return false;
+
+  int sock = lwip_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  if (sock < 0)
+    return false;
+  lwip_fcntl(sock, F_SETFL, O_NONBLOCK);
+
+  struct sockaddr_in to = {};
+  to.sin_family = AF_INET;
+  to.sin_port = htons(DNS_PORT);
+  to.sin_addr.s_addr = ip_2_ip4(server)->addr;
+  if (lwip_sendto(sock, message, len, 0, (struct sockaddr *)&to, sizeof(to)) != (int)len)
+  {
+    lwip_close(sock);
+    return false;
+  }
+
+  strcpy(query->host, host);
+  query->sock = sock;
+  query->id = id;
+  return true;
+}
+
+dns_query_state_e UdpDnsResolver::poll(const char *host, uint32_t *address, uint32_t *ttl_s)
+{
+  Query *query = find(host);
+  if (query == nullptr)
+    return DNS_QUERY_FAILED;
+
+  uint8_t message[DNS_MAX_MESSAGE_SIZE];
+  while (true)
+  {
+    int len = lwip_recv(query->sock, message, sizeof(message), MSG_DONTWAIT);
+    if (len < 0)
+    {
+      if (errno == EWOULDBLOCK || errno == EAGAIN)
+        return DNS_QUERY_PENDING;
+      close(*query);
+      return DNS_QUERY_FAILED;
+    }
+
+    dns_parse_err_e err = dns_parse_response(message, len, query->id, address, ttl_s);
+    if (err == DNS_PARSE_WRONG_ID)
+      continue; // late answer to an earlier query on this port
+
+    close(*query);
+    if (err == DNS_PARSE_OK)
+      return DNS_QUERY_DONE;
+    Log_info_serial("DNS: no address for %s (%d)", host, err);
+    return DNS_QUERY_FAILED;
+  }
+}
+
+static uint32_t dns_now_s()
+{
+  return (uint32_t)time(nullptr);
+}
+
+static uint32_t dns_now_ms()
+{
+  return millis();
+}
+
+static void dns_wait()
+{
+  delay(10);
+}
+
+RTC_DATA_ATTR static DnsCacheRtc dns_cache_rtc;
+static_assert(sizeof(dns_cache_rtc) <= RTC_BUDGET_DNS, "DNS cache over its RTC share (rtc_budget.h)");
+static UdpDnsResolver udpDnsResolver;
+
+// same worst case as the hostByName() loop this replaces: 5 tries, 2 s each
+static const DnsCacheOptions dns_cache_options = {
+    .now_s = dns_now_s,
+    .now_ms = dns_now_ms,
+    .wait = dns_wait,
+    .timeout_ms = 2000,
+    .attempts = 5,
+};
+
+DnsCache dnsCache(dns_cache_rtc, udpDnsResolver, dns_cache_options);
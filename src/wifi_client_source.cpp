@@ -0,0 +1,56 @@
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <wifi_client_source.h>
+
+WiFiClientSource::WiFiClientSource(WiFiClient &client) : _client(client) {}
+
+int WiFiClientSource::available()
+{
+  return _client.available();
+}
+
+int WiFiClientSource::read(uint8_t *buf, size_t size)
+{
+  int n = _client.read(buf, size);
+  return n < 0 ? 0 : n;
+}
+
+bool WiFiClientSource::connected()
+{
+  return _client.connected();
+}
+
+static uint32_t download_now_ms()
+{
+  return millis();
+}
+
+static void download_wait()
+{
+  delay(5);
+}
+
+HttpBodyReaderOptions downloadReaderOptions(uint32_t total_timeout_ms, uint32_t idle_timeout_ms)
+{
+  HttpBodyReaderOptions options = {
+      .total_timeout_ms = total_timeout_ms,
+      .idle_timeout_ms = idle_timeout_ms,
+      .now_ms = download_now_ms,
+      .wait = download_wait,
+  };
+  return options;
+}
+
+uint8_t *allocDownloadBuffer(size_t size)
+{
+  uint8_t *buf = nullptr;
+  if (psramFound())
+  {
+    buf = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  }
+  if (buf == nullptr)
+  {
+    buf = (uint8_t *)malloc(size);
+  }
+  return buf;
+}
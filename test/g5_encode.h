@@ -0,0 +1,30 @@
+#pragma once
+
+#include <string.h>
+#include <vector>
+
+/**
+ * Host-side G5 encoder shared by the suites that draw G5 images; include it after
+ * lib/bb_epaper/src/g5enc.inl.
+ */
+
+/**
+ * @brief Compresses a 1-bpp image (rows of (width + 7) / 8 bytes) without a header
+ *        g5_encode_encodeLine() reads a byte past each row, so every row is copied into
+ *        one with a spare byte first.
+ * @return the compressed lines, with room left behind them for the decoder to read ahead
+ */
+static std::vector<uint8_t> g5_encode_rows(const std::vector<uint8_t> &image, int width, int height)
+{
+  G5ENCIMAGE enc;
+  int pitch = (width + 7) / 8;
+  std::vector<uint8_t> out(image.size() * 2 + 1024), row(pitch + 1, 0xff);
+  g5_encode_init(&enc, width, height, out.data(), (int)out.size());
+  for (int y = 0; y < height; y++)
+  {
+    memcpy(row.data(), &image[y * pitch], pitch);
+    g5_encode_encodeLine(&enc, row.data());
+  }
+  out.resize(g5_encode_getOutSize(&enc)); // keeps the capacity
+  return out;
+}
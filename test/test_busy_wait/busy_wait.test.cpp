@@ -0,0 +1,195 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+// included by path: the rest of bb_epaper doesn't build on the host
+#include "../../lib/bb_epaper/src/bb_ep_busy.inl"
+
+/**
+ * Runs bbepWaitPin() against a simulated BUSY line: the panel is busy until a set time on a
+ * virtual clock, and a sleep ends at its deadline or, if the platform can wake on the pin, when
+ * the line goes idle. Checks the measured time and the deadline, and compares the overshoot with
+ * the 200 ms polling loop bbepWaitBusy() used before.
+ */
+
+#define BUSY 0
+#define IDLE 1
+
+/** The BUSY line and the clock */
+struct Timeline
+{
+  uint32_t now; // ms
+  uint32_t idle_at; // the panel is done at this time, UINT32_MAX for never
+  uint32_t start;
+  bool wake_on_pin; // GPIO wakeup, as on the ESP32
+  uint32_t max_sleep; // a sleep ends after this much at the latest, 0 for no limit
+  int sleeps, reads;
+
+  Timeline(uint32_t start, uint32_t busy_for, bool wake_on_pin)
+      : now(start), idle_at(busy_for == UINT32_MAX ? UINT32_MAX : start + busy_for), start(start),
+        wake_on_pin(wake_on_pin), max_sleep(0), sleeps(0), reads(0)
+  {
+  }
+
+  bool idle() const { return idle_at != UINT32_MAX && (uint32_t)(now - start) >= (uint32_t)(idle_at - start); }
+};
+
+static int read_pin(void *user)
+{
+  Timeline *t = (Timeline *)user;
+  t->reads++;
+  return t->idle() ? IDLE : BUSY;
+}
+
+static uint32_t read_millis(void *user)
+{
+  return ((Timeline *)user)->now;
+}
+
+static void sleep_until(void *user, uint32_t millis, int wake_level)
+{
+  Timeline *t = (Timeline *)user;
+  TEST_ASSERT_EQUAL(IDLE, wake_level);
+  TEST_ASSERT_TRUE(millis > 0);
+  t->sleeps++;
+  if (t->max_sleep && millis > t->max_sleep)
+    millis = t->max_sleep;
+  uint32_t wake = t->now + millis;
+  if (t->wake_on_pin && t->idle_at != UINT32_MAX && (uint32_t)(t->idle_at - t->now) < millis)
+    wake = t->idle_at; // the edge ends the sleep
+  t->now = wake;
+}
+
+static int wait(Timeline &t, uint32_t timeout, uint32_t *busy)
+{
+  BBEP_BUSY_IO io = {read_pin, read_millis, sleep_until, &t};
+  return bbepWaitPin(&io, IDLE, timeout, busy);
+}
+
+/** The loop bbepWaitBusy() had: 200 ms light sleeps, each counted twice against 5000 ms */
+static int old_wait(Timeline &t, uint32_t *busy)
+{
+  int timeout = 0;
+  uint32_t start = t.now;
+  while (timeout < 5000)
+  {
+    if (read_pin(&t) == IDLE)
+      break;
+    timeout += 200;
+    t.now += 200;
+    timeout += 200;
+  }
+  *busy = t.now - start;
+  return read_pin(&t) == IDLE ? BBEP_SUCCESS : BBEP_ERROR_TIMEOUT;
+}
+
+void test_wakes_at_the_edge(void)
+{
+  Timeline t(1000, 1234, true);
+  uint32_t busy;
+  TEST_ASSERT_EQUAL(BBEP_SUCCESS, wait(t, 5000, &busy));
+  TEST_ASSERT_EQUAL(1234, busy);
+  TEST_ASSERT_EQUAL(1, t.sleeps);
+}
+
+void test_already_idle(void)
+{
+  Timeline t(1000, 0, true);
+  uint32_t busy;
+  TEST_ASSERT_EQUAL(BBEP_SUCCESS, wait(t, 5000, &busy));
+  TEST_ASSERT_EQUAL(0, busy);
+  TEST_ASSERT_EQUAL(0, t.sleeps);
+}
+
+void test_timeout_is_the_deadline(void)
+{
+  // never idle: the wait ends at the timeout, not half of it
+  Timeline t(1000, UINT32_MAX, true);
+  uint32_t busy;
+  TEST_ASSERT_EQUAL(BBEP_ERROR_TIMEOUT, wait(t, 5000, &busy));
+  TEST_ASSERT_EQUAL(5000, busy);
+  TEST_ASSERT_EQUAL(1, t.sleeps);
+
+  Timeline old(1000, UINT32_MAX, true);
+  TEST_ASSERT_EQUAL(BBEP_ERROR_TIMEOUT, old_wait(old, &busy));
+  TEST_ASSERT_EQUAL(2600, busy); // what the double count gave
+}
+
+void test_short_sleeps(void)
+{
+  // sleeps that end early (polling, or another wakeup source) add up to the same result
+  Timeline t(1000, 1234, false);
+  uint32_t busy;
+  t.max_sleep = 10;
+  TEST_ASSERT_EQUAL(BBEP_SUCCESS, wait(t, 5000, &busy));
+  TEST_ASSERT_EQUAL(1240, busy);
+  TEST_ASSERT_EQUAL(124, t.sleeps);
+
+  Timeline never(1000, UINT32_MAX, false);
+  never.max_sleep = 300;
+  TEST_ASSERT_EQUAL(BBEP_ERROR_TIMEOUT, wait(never, 1000, &busy));
+  TEST_ASSERT_EQUAL(1000, busy); // the last sleep is cut to the deadline
+  TEST_ASSERT_EQUAL(4, never.sleeps);
+}
+
+void test_millis_wrap(void)
+{
+  Timeline t(0xffffff00u, 3000, true);
+  uint32_t busy;
+  TEST_ASSERT_EQUAL(BBEP_SUCCESS, wait(t, 5000, &busy));
+  TEST_ASSERT_EQUAL(3000, busy);
+
+  Timeline never(0xffffff00u, UINT32_MAX, true);
+  TEST_ASSERT_EQUAL(BBEP_ERROR_TIMEOUT, wait(never, 5000, &busy));
+  TEST_ASSERT_EQUAL(5000, busy);
+}
+
+void test_benchmark(void)
+{
+  const struct
+  {
+    const char *name;
+    uint32_t busy_for, timeout;
+  } refreshes[] = {
+      {"partial", 430, 5000},
+      {"fast", 1550, 5000},
+      {"full B/W", 2950, 5000},
+      {"B/W/R", 15300, 40000},
+      {"Spectra 6", 21700, 40000},
+  };
+  printf("\n%-12s %10s %14s %14s\n", "refresh", "busy (ms)", "polled (ms)", "on edge (ms)");
+  for (auto &r : refreshes)
+  {
+    Timeline polled(0, r.busy_for, false), edge(0, r.busy_for, true);
+    uint32_t polled_ms, edge_ms;
+    old_wait(polled, &polled_ms);
+    wait(edge, r.timeout, &edge_ms);
+    printf("%-12s %10u %14u %14u\n", r.name, (unsigned)r.busy_for, (unsigned)polled_ms, (unsigned)edge_ms);
+    TEST_ASSERT_EQUAL(r.busy_for, edge_ms);
+  }
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_wakes_at_the_edge);
+  RUN_TEST(test_already_idle);
+  RUN_TEST(test_timeout_is_the_deadline);
+  RUN_TEST(test_short_sleeps);
+  RUN_TEST(test_millis_wrap);
+  RUN_TEST(test_benchmark);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
@@ -0,0 +1,300 @@
+#include <unity.h>
+#include <connection_pool.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+/** Local stand-in server: counts the connections (TCP + TLS setups) it had to accept */
+struct StandInServer
+{
+  std::string host;
+  bool keep_alive;
+  int accepted;
+  int requests;
+};
+
+static std::vector<StandInServer *> servers;
+static int live_connections = 0;
+
+static StandInServer *server_for(const UrlOrigin &origin)
+{
+  for (size_t i = 0; i < servers.size(); i++)
+  {
+    if (servers[i]->host == origin.host)
+      return servers[i];
+  }
+  return nullptr;
+}
+
+class FakeConnection
+{
+public:
+  FakeConnection(const UrlOrigin &origin) : origin(origin), open(false), stopped(0) { live_connections++; }
+  ~FakeConnection() { live_connections--; }
+
+  bool connected() { return open; }
+  void stop() { open = false; stopped++; }
+
+  /** What HTTPClient does: connect if needed, send, read the response */
+  void request()
+  {
+    StandInServer *server = server_for(origin);
+    if (!open)
+    {
+      server->accepted++;
+      open = true;
+    }
+    server->requests++;
+    if (!server->keep_alive)
+      open = false;
+  }
+
+  UrlOrigin origin;
+  bool open;
+  int stopped;
+};
+
+static FakeConnection *create_connection(const UrlOrigin &origin)
+{
+  return new FakeConnection(origin);
+}
+
+static StandInServer api;
+static StandInServer cdn;
+
+/** The requests of one wake: display, image on the API host, two logs, an image on a CDN */
+static const char *wake_urls[] = {
+    "https://trmnl.app/api/display",
+    "https://trmnl.app/api/log",
+    "https://trmnl.app/plugin-renders/abc.png",
+    "https://trmnl.app/api/log",
+    "https://cdn.example.com/render.png",
+};
+
+void test_url_origin(void)
+{
+  UrlOrigin origin;
+  TEST_ASSERT_TRUE(url_origin("https://TRMNL.app/api/display", origin));
+  TEST_ASSERT_TRUE(origin.secure);
+  TEST_ASSERT_EQUAL_STRING("trmnl.app", origin.host);
+  TEST_ASSERT_EQUAL(443, origin.port);
+
+  TEST_ASSERT_TRUE(url_origin("http://192.168.1.10:2300/api/log", origin));
+  TEST_ASSERT_FALSE(origin.secure);
+  TEST_ASSERT_EQUAL_STRING("192.168.1.10", origin.host);
+  TEST_ASSERT_EQUAL(2300, origin.port);
+
+  TEST_ASSERT_TRUE(url_origin("https://user:pw@host.local:8443", origin));
+  TEST_ASSERT_EQUAL_STRING("host.local", origin.host);
+  TEST_ASSERT_EQUAL(8443, origin.port);
+
+  TEST_ASSERT_TRUE(url_origin("http://host?x=1", origin));
+  TEST_ASSERT_EQUAL_STRING("host", origin.host);
+
+  std::string long_host = "https://" + std::string(URL_HOST_MAX_LEN - 4, 'a') + ".com/image.png";
+  TEST_ASSERT_TRUE(url_origin(long_host.c_str(), origin));
+  TEST_ASSERT_EQUAL(URL_HOST_MAX_LEN, strlen(origin.host));
+
+  TEST_ASSERT_FALSE(url_origin("ftp://host/file", origin));
+  TEST_ASSERT_FALSE(url_origin("https:///path", origin));
+  TEST_ASSERT_FALSE(url_origin("https://host:99999/", origin));
+  TEST_ASSERT_FALSE(url_origin("https://host:12ab/", origin));
+}
+
+void test_benchmark_connections_per_wake(void)
+{
+  // without the pool: a new connection for every request
+  for (size_t i = 0; i < sizeof(wake_urls) / sizeof(wake_urls[0]); i++)
+  {
+    UrlOrigin origin;
+    url_origin(wake_urls[i], origin);
+    FakeConnection *connection = create_connection(origin);
+    connection->request();
+    connection->stop();
+    delete connection;
+  }
+  int without_pool = api.accepted + cdn.accepted;
+
+  api.accepted = cdn.accepted = 0;
+  ConnectionPool<FakeConnection> pool(create_connection);
+  for (size_t i = 0; i < sizeof(wake_urls) / sizeof(wake_urls[0]); i++)
+  {
+    FakeConnection *connection = pool.borrow(wake_urls[i]);
+    connection->request();
+    pool.release(connection);
+  }
+  pool.drain();
+  int with_pool = api.accepted + cdn.accepted;
+
+  printf("connections opened for %d requests: %d without pool, %d with pool\n",
+         (int)(sizeof(wake_urls) / sizeof(wake_urls[0])), without_pool, with_pool);
+  TEST_ASSERT_EQUAL(5, without_pool);
+  TEST_ASSERT_EQUAL(2, with_pool);
+  TEST_ASSERT_EQUAL(1, api.accepted);
+  TEST_ASSERT_EQUAL(2, pool.openedCount());
+  TEST_ASSERT_EQUAL(3, pool.reusedCount());
+  TEST_ASSERT_EQUAL(0, live_connections);
+}
+
+void test_server_closing_connection(void)
+{
+  api.keep_alive = false;
+  ConnectionPool<FakeConnection> pool(create_connection);
+  for (int i = 0; i < 3; i++)
+  {
+    FakeConnection *connection = pool.borrow("https://trmnl.app/api/log");
+    connection->request();
+    pool.release(connection);
+  }
+  TEST_ASSERT_EQUAL(3, api.accepted);
+  TEST_ASSERT_EQUAL(0, pool.size());
+  TEST_ASSERT_EQUAL(0, live_connections);
+}
+
+void test_idle_connection_closed_by_server(void)
+{
+  ConnectionPool<FakeConnection> pool(create_connection);
+  FakeConnection *first = pool.borrow("https://trmnl.app/api/display");
+  first->request();
+  pool.release(first);
+
+  first->open = false; // keep-alive timeout on the server side
+  FakeConnection *second = pool.borrow("https://trmnl.app/api/log");
+  second->request();
+  pool.release(second);
+
+  TEST_ASSERT_EQUAL(2, api.accepted);
+  TEST_ASSERT_EQUAL(0, pool.reusedCount());
+  TEST_ASSERT_EQUAL(1, pool.size());
+}
+
+void test_nested_request_gets_own_connection(void)
+{
+  ConnectionPool<FakeConnection> pool(create_connection);
+  FakeConnection *outer = pool.borrow("https://trmnl.app/api/display");
+  outer->request();
+
+  // error log submitted from inside the display request callback
+  FakeConnection *inner = pool.borrow("https://trmnl.app/api/log");
+  TEST_ASSERT_TRUE(inner != outer);
+  inner->request();
+  pool.release(inner);
+  pool.release(outer);
+
+  TEST_ASSERT_EQUAL(2, pool.size());
+  FakeConnection *next = pool.borrow("https://trmnl.app/api/log");
+  TEST_ASSERT_TRUE(next == inner || next == outer);
+  pool.release(next);
+}
+
+void test_port_and_scheme_are_part_of_origin(void)
+{
+  ConnectionPool<FakeConnection> pool(create_connection);
+  FakeConnection *a = pool.borrow("https://trmnl.app/api/display");
+  a->request();
+  pool.release(a);
+
+  FakeConnection *b = pool.borrow("https://trmnl.app:8443/api/display");
+  FakeConnection *c = pool.borrow("http://trmnl.app/api/display");
+  TEST_ASSERT_EQUAL(0, pool.reusedCount());
+  TEST_ASSERT_EQUAL(3, pool.openedCount());
+  pool.release(b);
+  pool.release(c);
+}
+
+void test_drain_closes_everything(void)
+{
+  ConnectionPool<FakeConnection> pool(create_connection);
+  FakeConnection *idle = pool.borrow("https://trmnl.app/api/display");
+  idle->request();
+  pool.release(idle);
+  FakeConnection *busy = pool.borrow("https://cdn.example.com/render.png");
+  busy->request();
+
+  // WiFi goes off in the middle of the image request
+  pool.drain();
+  TEST_ASSERT_EQUAL(1, live_connections);
+  TEST_ASSERT_FALSE(busy->connected());
+  pool.drain(); // again from goToSleep()
+
+  pool.release(busy);
+  TEST_ASSERT_EQUAL(0, live_connections);
+  TEST_ASSERT_EQUAL(0, pool.size());
+}
+
+void test_pool_full(void)
+{
+  ConnectionPool<FakeConnection> pool(create_connection);
+  char url[64];
+  std::vector<FakeConnection *> held;
+
+  // all slots busy: the extra connection is not pooled
+  for (int i = 0; i <= CONNECTION_POOL_SIZE; i++)
+  {
+    snprintf(url, sizeof(url), "https://cdn.example.com/%d.png", i);
+    held.push_back(pool.borrow(url));
+    held.back()->request();
+  }
+  TEST_ASSERT_EQUAL(CONNECTION_POOL_SIZE, pool.size());
+  for (size_t i = 0; i < held.size(); i++)
+    pool.release(held[i]);
+  TEST_ASSERT_EQUAL(CONNECTION_POOL_SIZE, live_connections);
+
+  // a new origin replaces the least recently used idle connection
+  FakeConnection *api_connection = pool.borrow("https://trmnl.app/api/display");
+  api_connection->request();
+  pool.release(api_connection);
+  TEST_ASSERT_EQUAL(CONNECTION_POOL_SIZE, pool.size());
+  TEST_ASSERT_EQUAL(CONNECTION_POOL_SIZE, live_connections);
+}
+
+void test_unparsed_url_gets_one_shot_connection(void)
+{
+  ConnectionPool<FakeConnection> pool(create_connection);
+
+  // pooling is only for origins it can tell apart; anything else still gets a connection
+  FakeConnection *connection = pool.borrow("https://host:12ab/image.png");
+  TEST_ASSERT_NOT_NULL(connection);
+  TEST_ASSERT_TRUE(connection->origin.secure);
+  TEST_ASSERT_EQUAL(0, pool.size());
+  pool.release(connection);
+  TEST_ASSERT_EQUAL(0, live_connections);
+  TEST_ASSERT_EQUAL(1, pool.openedCount());
+}
+
+void setUp(void)
+{
+  api = {"trmnl.app", true, 0, 0};
+  cdn = {"cdn.example.com", true, 0, 0};
+  servers.clear();
+  servers.push_back(&api);
+  servers.push_back(&cdn);
+  live_connections = 0;
+}
+
+void tearDown(void)
+{
+  // clean stuff up here
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_url_origin);
+  RUN_TEST(test_benchmark_connections_per_wake);
+  RUN_TEST(test_server_closing_connection);
+  RUN_TEST(test_idle_connection_closed_by_server);
+  RUN_TEST(test_nested_request_gets_own_connection);
+  RUN_TEST(test_port_and_scheme_are_part_of_origin);
+  RUN_TEST(test_drain_closes_everything);
+  RUN_TEST(test_pool_full);
+  RUN_TEST(test_unparsed_url_gets_one_shot_connection);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
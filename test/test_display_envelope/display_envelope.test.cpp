@@ -0,0 +1,285 @@
+#include <unity.h>
+#include <display_envelope.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+static uint32_t fake_now = 0;
+static uint32_t fake_now_ms() { return fake_now; }
+static void fake_wait() { fake_now += 10; }
+
+static const HttpBodyReaderOptions test_options = {
+    .total_timeout_ms = 15000,
+    .idle_timeout_ms = 5000,
+    .now_ms = fake_now_ms,
+    .wait = fake_wait,
+};
+
+/** Serves a response body in TCP-segment sized pieces */
+class FakeClient : public ByteSource
+{
+public:
+  FakeClient(const std::string &data, size_t piece) : data(data), piece(piece), pos(0) {}
+
+  int available() override
+  {
+    size_t left = data.size() - pos;
+    return (int)(piece < left ? piece : left);
+  }
+
+  int read(uint8_t *buf, size_t size) override
+  {
+    size_t n = size < (size_t)available() ? size : (size_t)available();
+    memcpy(buf, data.data() + pos, n);
+    pos += n;
+    return (int)n;
+  }
+
+  bool connected() override { return pos < data.size(); }
+
+private:
+  std::string data;
+  size_t piece;
+  size_t pos;
+};
+
+struct StandInResponse
+{
+  std::string content_type;
+  std::string body;
+};
+
+/**
+ * Stand-in for /api/display: answers with an envelope when the device offers it and
+ * the server supports it, with plain JSON otherwise
+ */
+class StandInServer
+{
+public:
+  bool supports_envelope = true;
+  bool include_image = true;
+  std::string image;
+
+  StandInServer()
+  {
+    image = "\x89PNG\r\n\x1a\n";
+    for (int i = 0; i < 20000; i++)
+      image += (char)(i * 7);
+  }
+
+  std::string metadata()
+  {
+    return "{\"status\":0,\"image_url\":\"https://trmnl.app/plugin-123.png\",\"filename\":\"plugin-123\","
+           "\"refresh_rate\":900,\"update_firmware\":false,\"playlist\":[1,2,3]}";
+  }
+
+  StandInResponse get(const char *accept)
+  {
+    if (!supports_envelope || strstr(accept, DISPLAY_ENVELOPE_CONTENT_TYPE) == nullptr)
+      return StandInResponse{"application/json; charset=utf-8", metadata()};
+    return StandInResponse{DISPLAY_ENVELOPE_CONTENT_TYPE, envelope(metadata(), include_image ? image : "")};
+  }
+
+  static std::string envelope(const std::string &meta, const std::string &img)
+  {
+    std::string out(DISPLAY_ENVELOPE_MAGIC);
+    out += (char)DISPLAY_ENVELOPE_VERSION;
+    out += (char)(img.empty() ? ENVELOPE_IMAGE_NONE : ENVELOPE_IMAGE_PNG);
+    out += std::string(2, '\0');
+    out += le32(meta.size());
+    out += le32(img.size());
+    return out + meta + img;
+  }
+
+  static std::string le32(uint32_t v)
+  {
+    std::string out;
+    for (int i = 0; i < 4; i++)
+      out += (char)((v >> (8 * i)) & 0xff);
+    return out;
+  }
+};
+
+static std::string chunked(const std::string &body, size_t chunk)
+{
+  std::string out;
+  char size_line[16];
+  for (size_t i = 0; i < body.size(); i += chunk)
+  {
+    std::string part = body.substr(i, chunk);
+    snprintf(size_line, sizeof(size_line), "%x\r\n", (unsigned)part.size());
+    out += size_line + part + "\r\n";
+  }
+  return out + "0\r\n\r\n";
+}
+
+static const char *accept = DISPLAY_ENVELOPE_CONTENT_TYPE ", application/json";
+static uint8_t arena_buffer[API_DISPLAY_JSON_ARENA_SIZE];
+static StandInServer *server;
+
+/** @return the image bytes left in the body after the envelope header and metadata */
+static std::string read_rest(HttpBodyReader &body)
+{
+  std::string rest;
+  uint8_t buf[1000];
+  size_t n;
+  while ((n = body.read(buf, sizeof(buf))) > 0)
+    rest.append((const char *)buf, n);
+  return rest;
+}
+
+void test_header(void)
+{
+  std::string raw = StandInServer::envelope("{}", "abc");
+  DisplayEnvelopeHeader header;
+  TEST_ASSERT_TRUE(parse_display_envelope_header((const uint8_t *)raw.data(), raw.size(), &header));
+  TEST_ASSERT_EQUAL(DISPLAY_ENVELOPE_VERSION, header.version);
+  TEST_ASSERT_EQUAL(ENVELOPE_IMAGE_PNG, header.image_type);
+  TEST_ASSERT_EQUAL(2, header.metadata_length);
+  TEST_ASSERT_EQUAL(3, header.image_length);
+  TEST_ASSERT_TRUE(display_envelope_has_image(header));
+
+  TEST_ASSERT_FALSE(parse_display_envelope_header((const uint8_t *)raw.data(), DISPLAY_ENVELOPE_HEADER_SIZE - 1, &header));
+
+  std::string bad = raw;
+  bad[0] = 'X';
+  TEST_ASSERT_FALSE(parse_display_envelope_header((const uint8_t *)bad.data(), bad.size(), &header));
+  bad = raw;
+  bad[4] = DISPLAY_ENVELOPE_VERSION + 1;
+  TEST_ASSERT_FALSE(parse_display_envelope_header((const uint8_t *)bad.data(), bad.size(), &header));
+  bad = raw;
+  bad[5] = ENVELOPE_IMAGE_JPEG + 1;
+  TEST_ASSERT_FALSE(parse_display_envelope_header((const uint8_t *)bad.data(), bad.size(), &header));
+
+  std::string huge = StandInServer::envelope(std::string(DISPLAY_ENVELOPE_MAX_METADATA + 1, ' '), "");
+  TEST_ASSERT_FALSE(parse_display_envelope_header((const uint8_t *)huge.data(), huge.size(), &header));
+  std::string empty = StandInServer::envelope("", "abc");
+  TEST_ASSERT_FALSE(parse_display_envelope_header((const uint8_t *)empty.data(), empty.size(), &header));
+}
+
+void test_content_type(void)
+{
+  TEST_ASSERT_TRUE(is_display_envelope(DISPLAY_ENVELOPE_CONTENT_TYPE));
+  TEST_ASSERT_TRUE(is_display_envelope(DISPLAY_ENVELOPE_CONTENT_TYPE "; charset=binary"));
+  TEST_ASSERT_FALSE(is_display_envelope("application/json"));
+  TEST_ASSERT_FALSE(is_display_envelope(DISPLAY_ENVELOPE_CONTENT_TYPE "2"));
+  TEST_ASSERT_FALSE(is_display_envelope(""));
+}
+
+void test_image_in_the_same_response(void)
+{
+  StandInResponse response = server->get(accept);
+  TEST_ASSERT_TRUE(is_display_envelope(response.content_type.c_str()));
+
+  // plain, and chunked with chunk boundaries falling anywhere in header, metadata and image
+  for (int framing = 0; framing < 2; framing++)
+  {
+    std::string wire = framing == 0 ? response.body : chunked(response.body, 333);
+    FakeClient client(wire, 1436);
+    HttpBodyReader body(client, framing == 0 ? (int32_t)wire.size() : -1, framing == 1, test_options);
+    JsonArena arena(arena_buffer, sizeof(arena_buffer));
+    DisplayEnvelopeHeader header;
+    ApiDisplayResponse metadata;
+
+    TEST_ASSERT_EQUAL(ENVELOPE_OK, read_display_envelope(body, arena, &header, &metadata));
+    TEST_ASSERT_EQUAL(ApiDisplayOutcome::Ok, metadata.outcome);
+    TEST_ASSERT_EQUAL_STRING("https://trmnl.app/plugin-123.png", metadata.image_url.c_str());
+    TEST_ASSERT_EQUAL_STRING("plugin-123", metadata.filename.c_str());
+    TEST_ASSERT_EQUAL(900, (int)metadata.refresh_rate);
+    TEST_ASSERT_TRUE(display_envelope_has_image(header));
+    TEST_ASSERT_EQUAL(server->image.size(), header.image_length);
+
+    // the body is left at the first image byte
+    std::string image = read_rest(body);
+    TEST_ASSERT_EQUAL(server->image.size(), image.size());
+    TEST_ASSERT_EQUAL_MEMORY(server->image.data(), image.data(), image.size());
+    TEST_ASSERT_TRUE(body.finished());
+  }
+}
+
+void test_server_without_envelope(void)
+{
+  // the server doesn't know the envelope: plain JSON, the image is fetched from image_url
+  server->supports_envelope = false;
+  StandInResponse response = server->get(accept);
+  TEST_ASSERT_FALSE(is_display_envelope(response.content_type.c_str()));
+
+  FakeClient client(response.body, 1436);
+  HttpBodyReader body(client, response.body.size(), false, test_options);
+  JsonArena arena(arena_buffer, sizeof(arena_buffer));
+  ApiDisplayResponse metadata = parseResponse_apiDisplay(body, arena);
+  TEST_ASSERT_EQUAL(ApiDisplayOutcome::Ok, metadata.outcome);
+  TEST_ASSERT_EQUAL_STRING("https://trmnl.app/plugin-123.png", metadata.image_url.c_str());
+}
+
+void test_envelope_without_image(void)
+{
+  server->include_image = false;
+  StandInResponse response = server->get(accept);
+
+  FakeClient client(response.body, 1436);
+  HttpBodyReader body(client, response.body.size(), false, test_options);
+  JsonArena arena(arena_buffer, sizeof(arena_buffer));
+  DisplayEnvelopeHeader header;
+  ApiDisplayResponse metadata;
+  TEST_ASSERT_EQUAL(ENVELOPE_OK, read_display_envelope(body, arena, &header, &metadata));
+  TEST_ASSERT_FALSE(display_envelope_has_image(header));
+  TEST_ASSERT_EQUAL_STRING("https://trmnl.app/plugin-123.png", metadata.image_url.c_str());
+  TEST_ASSERT_EQUAL(0, read_rest(body).size());
+  TEST_ASSERT_TRUE(body.finished());
+}
+
+void test_broken_envelopes(void)
+{
+  JsonArena arena(arena_buffer, sizeof(arena_buffer));
+  DisplayEnvelopeHeader header;
+  ApiDisplayResponse metadata;
+
+  std::string whole = server->get(accept).body;
+  size_t cuts[] = {5, DISPLAY_ENVELOPE_HEADER_SIZE + 10};
+  for (size_t i = 0; i < 2; i++)
+  {
+    std::string cut = whole.substr(0, cuts[i]);
+    FakeClient client(cut, 1436);
+    HttpBodyReader body(client, whole.size(), false, test_options);
+    TEST_ASSERT_EQUAL(ENVELOPE_TRUNCATED, read_display_envelope(body, arena, &header, &metadata));
+  }
+
+  std::string garbage = StandInServer::envelope("{\"status\":", "abc");
+  FakeClient client(garbage, 1436);
+  HttpBodyReader body(client, garbage.size(), false, test_options);
+  TEST_ASSERT_EQUAL(ENVELOPE_BAD_METADATA, read_display_envelope(body, arena, &header, &metadata));
+
+  std::string json = server->metadata();
+  FakeClient json_client(json, 1436);
+  HttpBodyReader json_body(json_client, json.size(), false, test_options);
+  TEST_ASSERT_EQUAL(ENVELOPE_BAD_HEADER, read_display_envelope(json_body, arena, &header, &metadata));
+}
+
+void setUp(void)
+{
+  server = new StandInServer();
+}
+
+void tearDown(void)
+{
+  delete server;
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_header);
+  RUN_TEST(test_content_type);
+  RUN_TEST(test_image_in_the_same_response);
+  RUN_TEST(test_server_without_envelope);
+  RUN_TEST(test_envelope_without_image);
+  RUN_TEST(test_broken_envelopes);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
@@ -0,0 +1,349 @@
+#include <unity.h>
+#include <dns_cache.h>
+#include <dns_message.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+
+static uint32_t fake_now_s_value = 0;
+static uint32_t fake_now_ms_value = 0;
+
+static uint32_t fake_now_s() { return fake_now_s_value; }
+static uint32_t fake_now_ms() { return fake_now_ms_value; }
+static void fake_wait() { fake_now_ms_value += 10; }
+
+static const DnsCacheOptions test_options = {
+    .now_s = fake_now_s,
+    .now_ms = fake_now_ms,
+    .wait = fake_wait,
+    .timeout_ms = 2000,
+    .attempts = 3,
+};
+
+static uint32_t ip(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+{
+  uint8_t bytes[4] = {a, b, c, d};
+  uint32_t address;
+  memcpy(&address, bytes, 4);
+  return address;
+}
+
+/** Scripted resolver: each host answers after a number of polls, or fails, or never answers */
+class FakeResolver : public DnsResolver
+{
+public:
+  struct Script
+  {
+    int delay_polls; // -1: never answers
+    bool fail;
+    uint32_t address;
+    uint32_t ttl;
+    int lost; // queries dropped before one gets this answer
+  };
+
+  std::map<std::string, Script> scripts;
+  std::map<std::string, int> in_flight; // polls left
+  int starts = 0;
+
+  bool start(const char *host) override
+  {
+    starts++;
+    auto it = scripts.find(host);
+    if (it != scripts.end() && it->second.lost > 0)
+    {
+      it->second.lost--;
+      in_flight[host] = -1;
+    }
+    else
+      in_flight[host] = it == scripts.end() ? 0 : it->second.delay_polls;
+    return true;
+  }
+
+  dns_query_state_e poll(const char *host, uint32_t *address, uint32_t *ttl_s) override
+  {
+    auto query = in_flight.find(host);
+    if (query == in_flight.end())
+      return DNS_QUERY_FAILED;
+    auto it = scripts.find(host);
+    if (it == scripts.end())
+    {
+      in_flight.erase(query);
+      return DNS_QUERY_FAILED;
+    }
+    if (query->second < 0 || it->second.delay_polls < 0)
+      return DNS_QUERY_PENDING;
+    if (query->second > 0)
+    {
+      query->second--;
+      return DNS_QUERY_PENDING;
+    }
+    in_flight.erase(query);
+    if (it->second.fail)
+      return DNS_QUERY_FAILED;
+    *address = it->second.address;
+    *ttl_s = it->second.ttl;
+    return DNS_QUERY_DONE;
+  }
+};
+
+static DnsCacheRtc rtc;
+static FakeResolver *resolver;
+
+void test_cold_lookup_waits_then_caches(void)
+{
+  resolver->scripts["trmnl.app"] = {5, false, ip(1, 2, 3, 4), 300, 0};
+  DnsCache cache(rtc, *resolver, test_options);
+
+  uint32_t address = 0;
+  TEST_ASSERT_TRUE(cache.resolve("trmnl.app", &address));
+  TEST_ASSERT_EQUAL_HEX32(ip(1, 2, 3, 4), address);
+  TEST_ASSERT_EQUAL(50, fake_now_ms_value);
+
+  // second request of the wake (the image): no query at all
+  address = 0;
+  TEST_ASSERT_TRUE(cache.resolve("TRMNL.app", &address));
+  TEST_ASSERT_EQUAL_HEX32(ip(1, 2, 3, 4), address);
+  TEST_ASSERT_EQUAL(1, resolver->starts);
+}
+
+void test_cached_across_deep_sleep(void)
+{
+  resolver->scripts["trmnl.app"] = {1, false, ip(1, 2, 3, 4), 3600, 0};
+  {
+    DnsCache cache(rtc, *resolver, test_options);
+    uint32_t address;
+    cache.resolve("trmnl.app", &address);
+  }
+
+  fake_now_s_value += 900;
+  fake_now_ms_value = 0;
+  DnsCache cache(rtc, *resolver, test_options);
+  uint32_t address = 0;
+  TEST_ASSERT_TRUE(cache.resolve("trmnl.app", &address));
+  TEST_ASSERT_EQUAL_HEX32(ip(1, 2, 3, 4), address);
+  TEST_ASSERT_EQUAL(1, resolver->starts);
+  TEST_ASSERT_EQUAL(0, fake_now_ms_value);
+}
+
+void test_expired_entry_served_while_refreshing(void)
+{
+  resolver->scripts["trmnl.app"] = {0, false, ip(1, 2, 3, 4), 300, 0};
+  DnsCache cache(rtc, *resolver, test_options);
+  uint32_t address;
+  cache.resolve("trmnl.app", &address);
+
+  fake_now_s_value += 301;
+  resolver->scripts["trmnl.app"] = {3, false, ip(5, 6, 7, 8), 300, 0};
+  uint32_t waited_from = fake_now_ms_value;
+
+  TEST_ASSERT_TRUE(cache.resolve("trmnl.app", &address));
+  TEST_ASSERT_EQUAL_HEX32(ip(1, 2, 3, 4), address); // old address, immediately
+  TEST_ASSERT_EQUAL(waited_from, fake_now_ms_value);
+  TEST_ASSERT_EQUAL(2, resolver->starts);
+  TEST_ASSERT_EQUAL(1, cache.pendingRefreshes());
+
+  // a second lookup while the refresh is in flight doesn't send another query
+  cache.resolve("trmnl.app", &address);
+  TEST_ASSERT_EQUAL(2, resolver->starts);
+
+  for (int i = 0; i < 3; i++)
+    cache.poll();
+  TEST_ASSERT_EQUAL(0, cache.pendingRefreshes());
+  cache.resolve("trmnl.app", &address);
+  TEST_ASSERT_EQUAL_HEX32(ip(5, 6, 7, 8), address);
+  TEST_ASSERT_EQUAL(2, resolver->starts);
+}
+
+void test_failed_refresh_keeps_address(void)
+{
+  resolver->scripts["trmnl.app"] = {0, false, ip(1, 2, 3, 4), 300, 0};
+  DnsCache cache(rtc, *resolver, test_options);
+  uint32_t address;
+  cache.resolve("trmnl.app", &address);
+
+  fake_now_s_value += 400;
+  resolver->scripts["trmnl.app"] = {0, true, 0, 0, 0};
+  TEST_ASSERT_TRUE(cache.resolve("trmnl.app", &address));
+  cache.poll();
+  TEST_ASSERT_EQUAL(0, cache.pendingRefreshes());
+  TEST_ASSERT_TRUE(cache.resolve("trmnl.app", &address));
+  TEST_ASSERT_EQUAL_HEX32(ip(1, 2, 3, 4), address);
+}
+
+void test_ttl_clamped(void)
+{
+  resolver->scripts["short.example"] = {0, false, ip(9, 9, 9, 9), 0, 0};
+  resolver->scripts["long.example"] = {0, false, ip(8, 8, 8, 8), 7 * 86400, 0};
+  DnsCache cache(rtc, *resolver, test_options);
+  uint32_t address;
+  cache.resolve("short.example", &address);
+  cache.resolve("long.example", &address);
+  int starts = resolver->starts;
+
+  fake_now_s_value += DNS_CACHE_MIN_TTL_S - 1;
+  cache.resolve("short.example", &address);
+  TEST_ASSERT_EQUAL(starts, resolver->starts);
+  fake_now_s_value += 1;
+  cache.resolve("short.example", &address);
+  TEST_ASSERT_EQUAL(starts + 1, resolver->starts);
+
+  fake_now_s_value += DNS_CACHE_MAX_TTL_S;
+  cache.resolve("long.example", &address);
+  TEST_ASSERT_EQUAL(starts + 2, resolver->starts);
+}
+
+void test_far_too_old_entry_waits(void)
+{
+  resolver->scripts["trmnl.app"] = {0, false, ip(1, 2, 3, 4), 300, 0};
+  DnsCache cache(rtc, *resolver, test_options);
+  uint32_t address;
+  cache.resolve("trmnl.app", &address);
+
+  fake_now_s_value += 300 + DNS_CACHE_MAX_STALE_S;
+  resolver->scripts["trmnl.app"] = {2, false, ip(5, 6, 7, 8), 300, 0};
+  TEST_ASSERT_TRUE(cache.resolve("trmnl.app", &address));
+  TEST_ASSERT_EQUAL_HEX32(ip(5, 6, 7, 8), address);
+}
+
+void test_failures_retried_then_reported(void)
+{
+  resolver->scripts["down.example"] = {2, true, 0, 0, 0};
+  DnsCache cache(rtc, *resolver, test_options);
+  uint32_t address;
+  TEST_ASSERT_FALSE(cache.resolve("down.example", &address));
+  TEST_ASSERT_EQUAL(test_options.attempts, resolver->starts);
+  // attempts are spaced out, but there is no wait after the last one
+  TEST_ASSERT_EQUAL((test_options.attempts - 1) * test_options.timeout_ms + 20, fake_now_ms_value);
+}
+
+void test_timeouts_bounded(void)
+{
+  resolver->scripts["slow.example"] = {-1, false, 0, 0, 0};
+  DnsCache cache(rtc, *resolver, test_options);
+  uint32_t address;
+  TEST_ASSERT_FALSE(cache.resolve("slow.example", &address));
+  TEST_ASSERT_EQUAL(test_options.attempts, resolver->starts);
+  TEST_ASSERT_EQUAL(test_options.attempts * test_options.timeout_ms, fake_now_ms_value);
+}
+
+void test_slow_answer_on_second_attempt(void)
+{
+  // first query is lost, the retry is answered
+  resolver->scripts["trmnl.app"] = {1, false, ip(1, 2, 3, 4), 300, 1};
+  DnsCache cache(rtc, *resolver, test_options);
+  uint32_t address = 0;
+  TEST_ASSERT_TRUE(cache.resolve("trmnl.app", &address));
+  TEST_ASSERT_EQUAL_HEX32(ip(1, 2, 3, 4), address);
+  TEST_ASSERT_EQUAL(2, resolver->starts);
+  TEST_ASSERT_EQUAL(test_options.timeout_ms + 10, fake_now_ms_value);
+}
+
+void test_forget(void)
+{
+  resolver->scripts["trmnl.app"] = {0, false, ip(1, 2, 3, 4), 300, 0};
+  DnsCache cache(rtc, *resolver, test_options);
+  uint32_t address;
+  cache.resolve("trmnl.app", &address);
+  cache.forget("trmnl.app");
+  cache.resolve("trmnl.app", &address);
+  TEST_ASSERT_EQUAL(2, resolver->starts);
+}
+
+void test_build_query(void)
+{
+  uint8_t buf[DNS_MAX_MESSAGE_SIZE];
+  size_t len = dns_build_query(buf, sizeof(buf), 0x1234, "trmnl.app");
+  const uint8_t expected[] = {
+      0x12, 0x34, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      5, 't', 'r', 'm', 'n', 'l', 3, 'a', 'p', 'p', 0,
+      0x00, 0x01, 0x00, 0x01};
+  TEST_ASSERT_EQUAL(sizeof(expected), len);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, buf, sizeof(expected));
+
+  TEST_ASSERT_EQUAL(len, dns_build_query(buf, sizeof(buf), 0x1234, "trmnl.app."));
+  TEST_ASSERT_EQUAL(0, dns_build_query(buf, sizeof(buf), 1, "bad..name"));
+  TEST_ASSERT_EQUAL(0, dns_build_query(buf, sizeof(buf), 1, ""));
+  TEST_ASSERT_EQUAL(0, dns_build_query(buf, 20, 1, "trmnl.app"));
+}
+
+/** Answer for usetrmnl.com: a CNAME (TTL 120) to a CDN name, then an A record (TTL 600), with name compression */
+static std::vector<uint8_t> make_answer(uint16_t id, uint16_t flags)
+{
+  uint8_t query[DNS_MAX_MESSAGE_SIZE];
+  size_t len = dns_build_query(query, sizeof(query), id, "usetrmnl.com");
+  std::vector<uint8_t> msg(query, query + len);
+  msg[2] = flags >> 8;
+  msg[3] = flags & 0xff;
+  msg[7] = 2; // two answers
+  const uint8_t answers[] = {
+      0xc0, 0x0c, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x78, 0x00, 0x06,
+      3, 'c', 'd', 'n', 0xc0, 0x0c,
+      0xc0, 0x2a, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x02, 0x58, 0x00, 0x04,
+      104, 18, 26, 48};
+  msg.insert(msg.end(), answers, answers + sizeof(answers));
+  return msg;
+}
+
+void test_parse_response(void)
+{
+  std::vector<uint8_t> msg = make_answer(0xbeef, 0x8180);
+  uint32_t address = 0, ttl = 0;
+  TEST_ASSERT_EQUAL(DNS_PARSE_OK, dns_parse_response(msg.data(), msg.size(), 0xbeef, &address, &ttl));
+  TEST_ASSERT_EQUAL_HEX32(ip(104, 18, 26, 48), address);
+  TEST_ASSERT_EQUAL(120, ttl); // the CNAME expires first
+
+  TEST_ASSERT_EQUAL(DNS_PARSE_WRONG_ID, dns_parse_response(msg.data(), msg.size(), 0xbeee, &address, &ttl));
+  TEST_ASSERT_EQUAL(DNS_PARSE_MALFORMED, dns_parse_response(msg.data(), msg.size() - 2, 0xbeef, &address, &ttl));
+  TEST_ASSERT_EQUAL(DNS_PARSE_MALFORMED, dns_parse_response(msg.data(), 8, 0xbeef, &address, &ttl));
+
+  std::vector<uint8_t> nx = make_answer(1, 0x8183);
+  TEST_ASSERT_EQUAL(DNS_PARSE_NXDOMAIN, dns_parse_response(nx.data(), nx.size(), 1, &address, &ttl));
+  std::vector<uint8_t> servfail = make_answer(1, 0x8182);
+  TEST_ASSERT_EQUAL(DNS_PARSE_SERVER_ERROR, dns_parse_response(servfail.data(), servfail.size(), 1, &address, &ttl));
+  std::vector<uint8_t> query = make_answer(1, 0x0100);
+  TEST_ASSERT_EQUAL(DNS_PARSE_MALFORMED, dns_parse_response(query.data(), query.size(), 1, &address, &ttl));
+
+  // CNAME only
+  std::vector<uint8_t> cname_only = make_answer(1, 0x8180);
+  cname_only[7] = 1;
+  cname_only.resize(cname_only.size() - 16);
+  TEST_ASSERT_EQUAL(DNS_PARSE_NO_ADDRESS, dns_parse_response(cname_only.data(), cname_only.size(), 1, &address, &ttl));
+}
+
+void setUp(void)
+{
+  memset(&rtc, 0, sizeof(rtc));
+  fake_now_s_value = 1700000000;
+  fake_now_ms_value = 0;
+  resolver = new FakeResolver();
+}
+
+void tearDown(void)
+{
+  delete resolver;
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_cold_lookup_waits_then_caches);
+  RUN_TEST(test_cached_across_deep_sleep);
+  RUN_TEST(test_expired_entry_served_while_refreshing);
+  RUN_TEST(test_failed_refresh_keeps_address);
+  RUN_TEST(test_ttl_clamped);
+  RUN_TEST(test_far_too_old_entry_waits);
+  RUN_TEST(test_failures_retried_then_reported);
+  RUN_TEST(test_timeouts_bounded);
+  RUN_TEST(test_slow_answer_on_second_attempt);
+  RUN_TEST(test_forget);
+  RUN_TEST(test_build_query);
+  RUN_TEST(test_parse_response);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
@@ -0,0 +1,412 @@
+#include <unity.h>
+#include <frame_diff.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+/**
+ * Sends a series of 1-bpp frames to a virtual panel the way display_show_image() does: the
+ * whole frame, or only the windows FrameDiff picks. After each frame the panel memory has to
+ * match it exactly, and the windows have to cover every changed pixel without overlapping.
+ */
+
+#define WIDTH 800
+#define HEIGHT 480
+#define PITCH (WIDTH / 8)
+
+static const FrameDiffOptions options = {
+    .max_windows = 3,
+    .merge_tiles = 24,
+    .max_percent = 50,
+};
+
+static FrameDiffRtc rtc;
+
+/** Panel memory that keeps what was written last, like the controller within a wake */
+struct VirtualPanel
+{
+  std::vector<uint8_t> ram;
+  int width, height, pitch;
+  int bytes_sent, updates;
+
+  VirtualPanel(int width, int height) : ram(((width + 7) / 8) * height), width(width), height(height), pitch((width + 7) / 8), bytes_sent(0), updates(0)
+  {
+    for (size_t i = 0; i < ram.size(); i++)
+      ram[i] = (uint8_t)rand(); // whatever it showed before
+  }
+
+  /** Deep sleep: the memory is gone, the glass still shows the last frame */
+  void reset()
+  {
+    for (size_t i = 0; i < ram.size(); i++)
+      ram[i] = (uint8_t)rand();
+  }
+
+  /** What display_show_image() does with the result; false if a window doesn't fit the panel */
+  bool show(const std::vector<uint8_t> &frame, const FrameDiffResult &result)
+  {
+    if (result.kind == FRAME_DIFF_FULL)
+    {
+      memcpy(ram.data(), frame.data(), ram.size());
+      bytes_sent += (int)ram.size();
+    }
+    else if (result.kind == FRAME_DIFF_WINDOWS)
+    {
+      for (int i = 0; i < result.count; i++)
+      {
+        const DirtyWindow &w = result.windows[i];
+        if (w.x < 0 || w.y < 0 || (w.x & 7) || w.width <= 0 || w.height <= 0 || w.x + w.width > width || w.y + w.height > height)
+          return false;
+        int start = w.x / 8, bytes = (w.x + w.width + 7) / 8 - start;
+        for (int y = w.y; y < w.y + w.height; y++)
+          memcpy(&ram[y * pitch + start], &frame[y * pitch + start], bytes);
+        bytes_sent += bytes * w.height;
+      }
+    }
+    if (result.kind != FRAME_DIFF_UNCHANGED)
+      updates++;
+    return true;
+  }
+};
+
+static std::vector<uint8_t> white_frame(int width = WIDTH, int height = HEIGHT)
+{
+  return std::vector<uint8_t>(((width + 7) / 8) * height, 0xff);
+}
+
+static void set_pixel(std::vector<uint8_t> &frame, int pitch, int x, int y, int white)
+{
+  uint8_t mask = 0x80 >> (x & 7);
+  if (white)
+    frame[y * pitch + x / 8] |= mask;
+  else
+    frame[y * pitch + x / 8] &= ~mask;
+}
+
+static int get_pixel(const std::vector<uint8_t> &frame, int pitch, int x, int y)
+{
+  return (frame[y * pitch + x / 8] >> (7 - (x & 7))) & 1;
+}
+
+/** Random black pixels in a rectangle, like text being redrawn */
+static void scribble(std::vector<uint8_t> &frame, int x, int y, int w, int h)
+{
+  for (int ty = y; ty < y + h; ty++)
+    for (int tx = x; tx < x + w; tx++)
+      set_pixel(frame, PITCH, tx, ty, rand() & 1);
+}
+
+/** Checks the windows cover every pixel that differs, and don't overlap each other */
+static bool windows_cover(const std::vector<uint8_t> &before, const std::vector<uint8_t> &after, const FrameDiffResult &result)
+{
+  for (int a = 0; a < result.count; a++)
+  {
+    for (int b = a + 1; b < result.count; b++)
+    {
+      const DirtyWindow &p = result.windows[a], &q = result.windows[b];
+      if (p.x < q.x + q.width && q.x < p.x + p.width && p.y < q.y + q.height && q.y < p.y + p.height)
+        return false;
+    }
+  }
+  for (int y = 0; y < HEIGHT; y++)
+  {
+    for (int x = 0; x < WIDTH; x++)
+    {
+      if (get_pixel(before, PITCH, x, y) == get_pixel(after, PITCH, x, y))
+        continue;
+      bool inside = false;
+      for (int i = 0; i < result.count && !inside; i++)
+      {
+        const DirtyWindow &w = result.windows[i];
+        inside = x >= w.x && x < w.x + w.width && y >= w.y && y < w.y + w.height;
+      }
+      if (!inside)
+        return false;
+    }
+  }
+  return true;
+}
+
+/** One wake: compare, send, and commit once the panel has it */
+static void show(FrameDiff &diff, VirtualPanel &panel, const std::vector<uint8_t> &frame, FrameDiffResult &result)
+{
+  diff.compare(frame.data(), panel.width, panel.height, panel.pitch, result);
+  TEST_ASSERT_TRUE(panel.show(frame, result));
+  diff.commit();
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(frame.data(), panel.ram.data(), panel.ram.size());
+}
+
+void test_first_frame_is_full(void)
+{
+  FrameDiff diff(rtc, options);
+  FrameDiffResult result;
+  VirtualPanel panel(WIDTH, HEIGHT);
+  std::vector<uint8_t> frame = white_frame();
+  scribble(frame, 40, 40, 300, 200);
+  show(diff, panel, frame, result);
+  TEST_ASSERT_EQUAL(FRAME_DIFF_FULL, result.kind);
+  TEST_ASSERT_EQUAL(FrameDiff::tileCount(WIDTH, HEIGHT), result.window_tiles);
+
+  // the same frame again: nothing to send
+  show(diff, panel, frame, result);
+  TEST_ASSERT_EQUAL(FRAME_DIFF_UNCHANGED, result.kind);
+  TEST_ASSERT_EQUAL(0, result.dirty_tiles);
+  TEST_ASSERT_EQUAL(1, panel.updates);
+}
+
+void test_clock_changes(void)
+{
+  // a dashboard where only the time changes: one small window
+  FrameDiff diff(rtc, options);
+  FrameDiffResult result;
+  VirtualPanel panel(WIDTH, HEIGHT);
+  std::vector<uint8_t> frame = white_frame();
+  scribble(frame, 0, 0, WIDTH, 100); // header
+  scribble(frame, 20, 300, 500, 150); // chart
+  show(diff, panel, frame, result);
+  for (int minute = 0; minute < 5; minute++)
+  {
+    std::vector<uint8_t> before = frame;
+    scribble(frame, 610, 210, 150, 60);
+    show(diff, panel, frame, result);
+    TEST_ASSERT_EQUAL(FRAME_DIFF_WINDOWS, result.kind);
+    TEST_ASSERT_EQUAL(1, result.count);
+    TEST_ASSERT_TRUE(windows_cover(before, frame, result));
+    // tiles of 64x16 around 610..760 x 210..270
+    TEST_ASSERT_EQUAL(576, result.windows[0].x);
+    TEST_ASSERT_EQUAL(208, result.windows[0].y);
+    TEST_ASSERT_EQUAL(192, result.windows[0].width);
+    TEST_ASSERT_EQUAL(64, result.windows[0].height);
+  }
+}
+
+void test_separate_changes(void)
+{
+  // two numbers far apart stay two windows; two close ones merge
+  FrameDiff diff(rtc, options);
+  FrameDiffResult result;
+  VirtualPanel panel(WIDTH, HEIGHT);
+  std::vector<uint8_t> frame = white_frame();
+  show(diff, panel, frame, result);
+
+  std::vector<uint8_t> before = frame;
+  scribble(frame, 10, 10, 100, 30);
+  scribble(frame, 650, 400, 120, 50);
+  show(diff, panel, frame, result);
+  TEST_ASSERT_EQUAL(FRAME_DIFF_WINDOWS, result.kind);
+  TEST_ASSERT_EQUAL(2, result.count);
+  TEST_ASSERT_TRUE(windows_cover(before, frame, result));
+  TEST_ASSERT_EQUAL(0, result.windows[0].y); // top to bottom
+  TEST_ASSERT_EQUAL(400, result.windows[1].y);
+
+  before = frame;
+  scribble(frame, 200, 200, 60, 20);
+  scribble(frame, 270, 200, 60, 20); // the tile next to it
+  show(diff, panel, frame, result);
+  TEST_ASSERT_EQUAL(1, result.count);
+  TEST_ASSERT_TRUE(windows_cover(before, frame, result));
+}
+
+void test_window_limit(void)
+{
+  // more changes than max_windows: the closest merge until they fit
+  FrameDiff diff(rtc, options);
+  FrameDiffResult result;
+  VirtualPanel panel(WIDTH, HEIGHT);
+  std::vector<uint8_t> frame = white_frame();
+  show(diff, panel, frame, result);
+  std::vector<uint8_t> before = frame;
+  const int spots[][2] = {{0, 0}, {700, 0}, {0, 440}, {700, 440}, {360, 220}};
+  for (auto &spot : spots)
+    scribble(frame, spot[0], spot[1], 20, 20);
+  show(diff, panel, frame, result);
+  TEST_ASSERT_EQUAL(FRAME_DIFF_WINDOWS, result.kind);
+  TEST_ASSERT_EQUAL(3, result.count);
+  TEST_ASSERT_TRUE(windows_cover(before, frame, result));
+}
+
+void test_large_changes_are_full(void)
+{
+  FrameDiff diff(rtc, options);
+  FrameDiffResult result;
+  VirtualPanel panel(WIDTH, HEIGHT);
+  std::vector<uint8_t> frame = white_frame();
+  show(diff, panel, frame, result);
+
+  // more than half of the panel
+  scribble(frame, 0, 0, WIDTH, 300);
+  show(diff, panel, frame, result);
+  TEST_ASSERT_EQUAL(FRAME_DIFF_FULL, result.kind);
+
+  // a pixel here and there all over: too many runs to merge
+  for (int i = 0; i < 200; i++)
+    set_pixel(frame, PITCH, rand() % WIDTH, rand() % HEIGHT, 0);
+  show(diff, panel, frame, result);
+  TEST_ASSERT_EQUAL(FRAME_DIFF_FULL, result.kind);
+  TEST_ASSERT_TRUE(result.dirty_tiles > FRAME_DIFF_MAX_RUNS);
+}
+
+void test_forget_and_uncommitted(void)
+{
+  FrameDiff diff(rtc, options);
+  FrameDiffResult result;
+  VirtualPanel panel(WIDTH, HEIGHT);
+  std::vector<uint8_t> frame = white_frame();
+  show(diff, panel, frame, result);
+
+  // a message went to the panel in between: the next image is sent whole
+  diff.forget();
+  memset(panel.ram.data(), 0x00, panel.ram.size());
+  show(diff, panel, frame, result);
+  TEST_ASSERT_EQUAL(FRAME_DIFF_FULL, result.kind);
+
+  // a frame that never made it to the panel isn't what the next one is compared with
+  std::vector<uint8_t> lost = frame;
+  scribble(lost, 100, 100, 50, 50);
+  diff.compare(lost.data(), WIDTH, HEIGHT, PITCH, result);
+  TEST_ASSERT_EQUAL(FRAME_DIFF_WINDOWS, result.kind);
+  std::vector<uint8_t> next = frame;
+  scribble(next, 500, 300, 50, 50);
+  show(diff, panel, next, result);
+  TEST_ASSERT_EQUAL(FRAME_DIFF_WINDOWS, result.kind);
+  TEST_ASSERT_EQUAL(1, result.count);
+  TEST_ASSERT_TRUE(windows_cover(frame, next, result));
+
+  // another size (rotated, or another panel): full
+  diff.compare(next.data(), HEIGHT, WIDTH, HEIGHT / 8, result);
+  TEST_ASSERT_EQUAL(FRAME_DIFF_FULL, result.kind);
+}
+
+void test_new_wake_is_full(void)
+{
+  VirtualPanel panel(WIDTH, HEIGHT);
+  FrameDiffResult result;
+  std::vector<uint8_t> frame = white_frame();
+  {
+    FrameDiff diff(rtc, options);
+    show(diff, panel, frame, result);
+  }
+
+  // the next wake: the hashes are still in RTC memory, the panel's memory isn't
+  panel.reset();
+  FrameDiff diff(rtc, options);
+  TEST_ASSERT_FALSE(diff.panelRamValid());
+  diff.compare(frame.data(), WIDTH, HEIGHT, PITCH, result);
+  TEST_ASSERT_EQUAL(FRAME_DIFF_UNCHANGED, result.kind); // the glass shows it already
+  std::vector<uint8_t> next = frame;
+  scribble(next, 610, 210, 150, 60);
+  show(diff, panel, next, result);
+  TEST_ASSERT_EQUAL(FRAME_DIFF_FULL, result.kind);
+  TEST_ASSERT_TRUE(diff.panelRamValid());
+
+  // then windows again, until the panel sleeps
+  scribble(next, 40, 20, 300, 40);
+  show(diff, panel, next, result);
+  TEST_ASSERT_EQUAL(FRAME_DIFF_WINDOWS, result.kind);
+  diff.panelReset();
+  panel.reset();
+  scribble(next, 40, 20, 300, 40);
+  show(diff, panel, next, result);
+  TEST_ASSERT_EQUAL(FRAME_DIFF_FULL, result.kind);
+}
+
+void test_odd_width_and_padding(void)
+{
+  // the bits past the width don't count, and the last window ends at the frame
+  const int width = 203, height = 61, pitch = 28; // rows padded like a BMP
+  FrameDiff diff(rtc, options);
+  FrameDiffResult result;
+  std::vector<uint8_t> frame(pitch * height, 0xff);
+  diff.compare(frame.data(), width, height, pitch, result);
+  diff.commit();
+  for (int y = 0; y < height; y++)
+    frame[y * pitch + pitch - 1] = (uint8_t)rand(); // padding only
+  diff.compare(frame.data(), width, height, pitch, result);
+  TEST_ASSERT_EQUAL(FRAME_DIFF_UNCHANGED, result.kind);
+
+  set_pixel(frame, pitch, width - 1, height - 1, 0);
+  diff.compare(frame.data(), width, height, pitch, result);
+  TEST_ASSERT_EQUAL(FRAME_DIFF_WINDOWS, result.kind);
+  TEST_ASSERT_EQUAL(1, result.count);
+  TEST_ASSERT_EQUAL(192, result.windows[0].x);
+  TEST_ASSERT_EQUAL(11, result.windows[0].width);
+  TEST_ASSERT_EQUAL(48, result.windows[0].y);
+  TEST_ASSERT_EQUAL(13, result.windows[0].height);
+}
+
+void test_benchmark(void)
+{
+  // bytes sent per update at 8 MHz SPI, whole frame vs windows. Only a second image in the
+  // same wake gets windows; the device sleeps between fetches, so its usual update is the
+  // last row: the first image of a wake always goes whole since the panel's memory is lost
+  const struct
+  {
+    const char *name;
+    int rects[3][4];
+    int count;
+    bool next_wake;
+  } cases[] = {
+      {"same wake: clock", {{610, 210, 150, 60}}, 1, false},
+      {"  clock and date", {{610, 210, 150, 60}, {40, 20, 300, 40}}, 2, false},
+      {"  weather panel", {{420, 120, 360, 240}}, 1, false},
+      {"  list row", {{20, 300, 760, 30}}, 1, false},
+      {"  new page", {{0, 0, WIDTH, HEIGHT}}, 1, false},
+      {"new wake: clock", {{610, 210, 150, 60}}, 1, true},
+  };
+  printf("\n%-18s %8s %12s %12s %10s\n", "update", "windows", "full (B)", "sent (B)", "SPI (ms)");
+  for (auto &c : cases)
+  {
+    FrameDiff diff(rtc, options);
+    FrameDiffResult result;
+    VirtualPanel panel(WIDTH, HEIGHT);
+    std::vector<uint8_t> frame = white_frame();
+    scribble(frame, 0, 0, WIDTH, HEIGHT);
+    show(diff, panel, frame, result);
+    panel.bytes_sent = 0;
+    if (c.next_wake)
+    {
+      diff.panelReset();
+      panel.reset();
+    }
+    for (int i = 0; i < c.count; i++)
+      scribble(frame, c.rects[i][0], c.rects[i][1], c.rects[i][2], c.rects[i][3]);
+    show(diff, panel, frame, result);
+    printf("%-18s %8d %12d %12d %10.1f\n", c.name, result.kind == FRAME_DIFF_WINDOWS ? result.count : 0,
+           (int)panel.ram.size(), panel.bytes_sent, panel.bytes_sent * 8 / 8000.0);
+    TEST_ASSERT_TRUE(panel.bytes_sent <= (int)panel.ram.size());
+    if (c.next_wake)
+      TEST_ASSERT_EQUAL((int)panel.ram.size(), panel.bytes_sent);
+  }
+}
+
+void setUp(void)
+{
+  srand(1234);
+  memset(&rtc, 0, sizeof(rtc));
+}
+
+void tearDown(void)
+{
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_first_frame_is_full);
+  RUN_TEST(test_clock_changes);
+  RUN_TEST(test_separate_changes);
+  RUN_TEST(test_window_limit);
+  RUN_TEST(test_large_changes_are_full);
+  RUN_TEST(test_forget_and_uncommitted);
+  RUN_TEST(test_new_wake_is_full);
+  RUN_TEST(test_odd_width_and_padding);
+  RUN_TEST(test_benchmark);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
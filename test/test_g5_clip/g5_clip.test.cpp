@@ -0,0 +1,253 @@
+#include <unity.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+// included by path: the rest of bb_epaper doesn't build on the host
+#include "../../lib/bb_epaper/src/Group5.h"
+#include "../../lib/bb_epaper/src/g5enc.inl"
+#include "../../lib/bb_epaper/src/g5dec.inl"
+#include "../../lib/bb_epaper/src/bb_ep_span.inl"
+#include "../g5_encode.h"
+
+/**
+ * Draws G5 images of odd sizes at odd and negative offsets onto a virtual 1-bpp panel the way
+ * bbepLoadG5() does at 1:1, with a back buffer and without one, and checks every pixel against
+ * a plain clipped copy of the source.
+ */
+
+#define PANEL_WIDTH 100
+#define PANEL_HEIGHT 60
+#define PANEL_PITCH ((PANEL_WIDTH + 7) / 8)
+
+/** A 1-bpp panel (1 = white) that takes a byte window and then its rows, like the panel RAM */
+struct VirtualPanel
+{
+  std::vector<uint8_t> ram;
+  int win_x, win_y, win_bytes, win_rows, row;
+
+  VirtualPanel() : ram(PANEL_PITCH * PANEL_HEIGHT), win_x(0), win_y(0), win_bytes(0), win_rows(0), row(0)
+  {
+    for (size_t i = 0; i < ram.size(); i++)
+      ram[i] = (uint8_t)(rand() & 0xff); // whatever was shown before
+  }
+
+  void set_addr_window(int x, int y, int cx, int cy)
+  {
+    win_x = x / 8;
+    win_y = y;
+    win_bytes = (cx + 7) / 8;
+    win_rows = cy;
+    row = 0;
+  }
+
+  /** @return false if the data doesn't fit the window */
+  bool write_data(const uint8_t *data, int len)
+  {
+    if (len != win_bytes || row >= win_rows || win_x + win_bytes > PANEL_PITCH)
+      return false;
+    memcpy(&ram[(win_y + row) * PANEL_PITCH + win_x], data, len);
+    row++;
+    return true;
+  }
+
+  int pixel(int x, int y) const { return (ram[y * PANEL_PITCH + x / 8] >> (7 - (x & 7))) & 1; }
+
+  void set_pixel(int x, int y, int white)
+  {
+    uint8_t mask = 0x80 >> (x & 7);
+    ram[y * PANEL_PITCH + x / 8] = white ? (ram[y * PANEL_PITCH + x / 8] | mask) : (ram[y * PANEL_PITCH + x / 8] & ~mask);
+  }
+};
+
+/** A 1-bpp image of random runs; 1 = white, as the G5 decoder writes it */
+static std::vector<uint8_t> run_image(int width, int height)
+{
+  int pitch = (width + 7) / 8;
+  std::vector<uint8_t> image(pitch * height, 0xff);
+  for (int y = 0; y < height; y++)
+  {
+    int color = rand() & 1;
+    for (int x = 0; x < width;)
+    {
+      int run = 1 + rand() % 9;
+      for (int i = 0; i < run && x < width; i++, x++)
+        if (!color)
+          image[y * pitch + x / 8] &= ~(0x80 >> (x & 7));
+      color ^= 1;
+    }
+  }
+  return image;
+}
+
+static int image_pixel(const std::vector<uint8_t> &image, int width, int x, int y)
+{
+  return (image[y * ((width + 7) / 8) + x / 8] >> (7 - (x & 7))) & 1;
+}
+
+/** The pixels of the image that land on the panel, everything else as it was */
+static void expected_copy(VirtualPanel &panel, const std::vector<uint8_t> &image, int cx, int cy, int x, int y)
+{
+  for (int sy = 0; sy < cy; sy++)
+    for (int sx = 0; sx < cx; sx++)
+      if (x + sx >= 0 && x + sx < PANEL_WIDTH && y + sy >= 0 && y + sy < PANEL_HEIGHT)
+        panel.set_pixel(x + sx, y + sy, image_pixel(image, cx, sx, sy));
+}
+
+/** bbepLoadG5() with a back buffer: each decoded line's runs into the framebuffer */
+static void draw_buffered(VirtualPanel &panel, const std::vector<uint8_t> &g5, int cx, int cy, int x, int y)
+{
+  static G5DECIMAGE dec;
+  uint8_t line[512];
+  BBEP_SPAN_TARGET span;
+  span.iLayout = BBEP_SPAN_2CLR;
+  span.iPitch = PANEL_PITCH;
+  span.pPlane0 = panel.ram.data();
+  g5_decode_init(&dec, cx, cy, (uint8_t *)g5.data(), (int)g5.size());
+  for (int ty = y; ty < y + cy && ty < PANEL_HEIGHT; ty++)
+  {
+    g5_decode_line(&dec, line);
+    if (ty < 0)
+      continue;
+    bbepDrawFlips(&span, dec.pRef, cx, x, ty, PANEL_WIDTH, BBEP_WHITE, BBEP_BLACK);
+  }
+}
+
+/** bbepLoadG5() without a back buffer: the visible rows through a byte window; false if one didn't fit */
+static bool draw_direct(VirtualPanel &panel, const std::vector<uint8_t> &g5, int cx, int cy, int x, int y)
+{
+  static G5DECIMAGE dec;
+  uint8_t line[512], out[512];
+  BBEP_SPAN_TARGET span;
+  BBEP_BYTE_WINDOW win;
+  bool fits = true;
+  g5_decode_init(&dec, cx, cy, (uint8_t *)g5.data(), (int)g5.size());
+  if (!bbepGetByteWindow(x, y, cx, cy, PANEL_WIDTH, PANEL_HEIGHT, &win))
+    return true;
+  panel.set_addr_window(win.x, win.y, win.iBytes * 8, win.iRows);
+  span.iLayout = BBEP_SPAN_2CLR;
+  span.iPitch = win.iBytes;
+  span.pPlane0 = out;
+  for (int ty = y; ty < y + cy && ty < PANEL_HEIGHT; ty++)
+  {
+    g5_decode_line(&dec, line);
+    if (ty < 0)
+      continue;
+    memset(out, 0xff, win.iBytes);
+    bbepDrawFlips(&span, dec.pRef, cx, x - win.x, 0, win.iRight - win.x, BBEP_WHITE, BBEP_BLACK);
+    fits &= panel.write_data(out, win.iBytes);
+  }
+  return fits && panel.row == win.iRows;
+}
+
+// x, y, width, height: inside, odd sizes, cut on each side, larger than the panel, and off it
+static const int places[][4] = {
+    {0, 0, 100, 60},    {3, 5, 61, 17},       {6, 33, 95, 27},  {1, 1, 1, 1},     // inside
+    {-5, 7, 23, 11},    {-13, -9, 37, 29},    {90, 50, 21, 19}, {77, -3, 30, 70}, // cut
+    {99, 59, 8, 8},     {-21, -17, 143, 93},  {-40, -30, 180, 120},                // larger
+    {-7, 20, 7, 5},     {100, 0, 10, 10},     {40, 60, 9, 9},                      // off the panel
+};
+
+void test_byte_window(void)
+{
+  BBEP_BYTE_WINDOW win;
+  TEST_ASSERT_EQUAL(1, bbepGetByteWindow(3, 5, 61, 17, PANEL_WIDTH, PANEL_HEIGHT, &win));
+  TEST_ASSERT_EQUAL(0, win.x);
+  TEST_ASSERT_EQUAL(5, win.y);
+  TEST_ASSERT_EQUAL(8, win.iBytes); // columns 0 to 63
+  TEST_ASSERT_EQUAL(17, win.iRows);
+  TEST_ASSERT_EQUAL(64, win.iRight);
+
+  TEST_ASSERT_EQUAL(1, bbepGetByteWindow(-21, -17, 143, 93, PANEL_WIDTH, PANEL_HEIGHT, &win));
+  TEST_ASSERT_EQUAL(0, win.x);
+  TEST_ASSERT_EQUAL(0, win.y);
+  TEST_ASSERT_EQUAL(PANEL_PITCH, win.iBytes);
+  TEST_ASSERT_EQUAL(PANEL_HEIGHT, win.iRows);
+  TEST_ASSERT_EQUAL(PANEL_WIDTH, win.iRight);
+
+  TEST_ASSERT_EQUAL(1, bbepGetByteWindow(90, 50, 21, 19, PANEL_WIDTH, PANEL_HEIGHT, &win));
+  TEST_ASSERT_EQUAL(88, win.x);
+  TEST_ASSERT_EQUAL(2, win.iBytes);
+  TEST_ASSERT_EQUAL(10, win.iRows);
+
+  TEST_ASSERT_EQUAL(0, bbepGetByteWindow(100, 0, 10, 10, PANEL_WIDTH, PANEL_HEIGHT, &win));
+  TEST_ASSERT_EQUAL(0, bbepGetByteWindow(-7, 20, 7, 5, PANEL_WIDTH, PANEL_HEIGHT, &win));
+  TEST_ASSERT_EQUAL(0, bbepGetByteWindow(0, 0, 0, 5, PANEL_WIDTH, PANEL_HEIGHT, &win));
+}
+
+void test_clipped_with_back_buffer(void)
+{
+  for (auto &place : places)
+  {
+    std::vector<uint8_t> image = run_image(place[2], place[3]);
+    std::vector<uint8_t> g5 = g5_encode_rows(image, place[2], place[3]);
+    VirtualPanel drawn, expected;
+    expected.ram = drawn.ram;
+    expected_copy(expected, image, place[2], place[3], place[0], place[1]);
+    draw_buffered(drawn, g5, place[2], place[3], place[0], place[1]);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected.ram.data(), drawn.ram.data(), drawn.ram.size());
+  }
+}
+
+void test_clipped_without_back_buffer(void)
+{
+  for (auto &place : places)
+  {
+    int x = place[0], y = place[1], cx = place[2], cy = place[3];
+    std::vector<uint8_t> image = run_image(cx, cy);
+    std::vector<uint8_t> g5 = g5_encode_rows(image, cx, cy);
+    VirtualPanel drawn, expected;
+    BBEP_BYTE_WINDOW win;
+    expected.ram = drawn.ram;
+    // the whole bytes the image touches turn white around it
+    if (bbepGetByteWindow(x, y, cx, cy, PANEL_WIDTH, PANEL_HEIGHT, &win))
+      for (int ty = win.y; ty < win.y + win.iRows; ty++)
+        memset(&expected.ram[ty * PANEL_PITCH + win.x / 8], 0xff, win.iBytes);
+    expected_copy(expected, image, cx, cy, x, y);
+    TEST_ASSERT_TRUE(draw_direct(drawn, g5, cx, cy, x, y));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected.ram.data(), drawn.ram.data(), drawn.ram.size());
+  }
+}
+
+void test_centered_on_white(void)
+{
+  // what display_show_image() does with a smaller image: white fill, then centered
+  const int cx = 37, cy = 23, x = (PANEL_WIDTH - cx) / 2, y = (PANEL_HEIGHT - cy) / 2;
+  std::vector<uint8_t> image = run_image(cx, cy);
+  std::vector<uint8_t> g5 = g5_encode_rows(image, cx, cy);
+  VirtualPanel panel;
+  memset(panel.ram.data(), 0xff, panel.ram.size());
+  draw_buffered(panel, g5, cx, cy, x, y);
+  for (int ty = 0; ty < PANEL_HEIGHT; ty++)
+  {
+    for (int tx = 0; tx < PANEL_WIDTH; tx++)
+    {
+      bool inside = tx >= x && tx < x + cx && ty >= y && ty < y + cy;
+      TEST_ASSERT_EQUAL(inside ? image_pixel(image, cx, tx - x, ty - y) : 1, panel.pixel(tx, ty));
+    }
+  }
+}
+
+void setUp(void)
+{
+  srand(1234);
+}
+
+void tearDown(void)
+{
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_byte_window);
+  RUN_TEST(test_clipped_with_back_buffer);
+  RUN_TEST(test_clipped_without_back_buffer);
+  RUN_TEST(test_centered_on_white);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
@@ -0,0 +1,288 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+// included by path: the rest of bb_epaper doesn't build on the host
+#include "../../lib/bb_epaper/src/Group5.h"
+#include "../../lib/bb_epaper/src/g5enc.inl"
+#include "../../lib/bb_epaper/src/g5dec.inl"
+#include "../../lib/bb_epaper/src/bb_ep_span.inl"
+#include "../g5_encode.h"
+
+/**
+ * Checks that bbepDrawFlips() leaves the framebuffer exactly as the per-pixel loop of
+ * bbepLoadG5() does, for every layout, and times both on a full 800x480 frame.
+ */
+
+#define SCREEN_WIDTH 800
+#define SCREEN_HEIGHT 480
+
+/** A framebuffer in one of the span layouts, both planes in one allocation like bb_epaper's */
+struct Screen
+{
+  int width, height, layout;
+  BBEP_SPAN_TARGET target;
+  std::vector<uint8_t> ram;
+
+  Screen(int width, int height, int layout) : width(width), height(height), layout(layout)
+  {
+    int pitch = (width + 7) / 8, plane = pitch * height;
+    if (layout == BBEP_SPAN_4CLR)
+      pitch = (width + 3) / 4;
+    else if (layout == BBEP_SPAN_16CLR)
+      pitch = width / 2;
+    ram.resize((layout == BBEP_SPAN_3CLR || layout == BBEP_SPAN_4GRAY) ? 2 * plane : pitch * height);
+    for (size_t i = 0; i < ram.size(); i++)
+      ram[i] = (uint8_t)(rand() & 0xff); // whatever was drawn before
+    target.iLayout = layout;
+    target.iPitch = pitch;
+    target.pPlane0 = ram.data();
+    target.pPlane1 = ram.data() + plane;
+  }
+};
+
+/** @brief What bb_epaper's pfnSetPixelFast functions do to each layout, one pixel at a time */
+static void set_pixel(void *p, int x, int y, unsigned char color)
+{
+  Screen *screen = (Screen *)p;
+  const BBEP_SPAN_TARGET &t = screen->target;
+  uint8_t mask = 0x80 >> (x & 7);
+  uint8_t *p0 = &t.pPlane0[y * t.iPitch + x / 8], *p1 = &t.pPlane1[y * t.iPitch + x / 8];
+  switch (screen->layout)
+  {
+  case BBEP_SPAN_2CLR:
+    *p0 = (color == BBEP_WHITE) ? (*p0 | mask) : (*p0 & ~mask);
+    break;
+  case BBEP_SPAN_3CLR:
+    if (color >= BBEP_YELLOW)
+      *p1 |= mask;
+    else
+    {
+      *p1 &= ~mask;
+      *p0 = (color == BBEP_WHITE) ? (*p0 | mask) : (*p0 & ~mask);
+    }
+    break;
+  case BBEP_SPAN_4GRAY:
+    *p0 = (color & 1) ? (*p0 | mask) : (*p0 & ~mask);
+    *p1 = (color & 2) ? (*p1 | mask) : (*p1 & ~mask);
+    break;
+  case BBEP_SPAN_4CLR:
+  {
+    uint8_t *d = &t.pPlane0[y * t.iPitch + x / 4];
+    *d = (*d & ~(0xc0 >> ((x & 3) * 2))) | (color << ((3 - (x & 3)) * 2));
+    break;
+  }
+  case BBEP_SPAN_16CLR:
+  {
+    uint8_t *d = &t.pPlane0[y * t.iPitch + x / 2];
+    *d = (x & 1) ? ((*d & 0xf0) | color) : ((*d & 0x0f) | (color << 4));
+    break;
+  }
+  }
+}
+
+typedef void(set_pixel_fast_t)(void *, int, int, unsigned char);
+static set_pixel_fast_t *volatile pfnSetPixelFast = set_pixel; // called through a pointer, as on the device
+
+/** The per-pixel loop of bbepLoadG5() at 1:1 scale */
+static void draw_pixels(Screen &screen, const uint8_t *line, int cx, int x, int y, int fg, int bg)
+{
+  for (int tx = x, sx = 0; sx < cx && tx < screen.width; tx++, sx++)
+  {
+    if (line[sx >> 3] & (0x80 >> (sx & 7)))
+    {
+      if (fg != BBEP_TRANSPARENT)
+        (*pfnSetPixelFast)(&screen, tx, y, (uint8_t)fg);
+    }
+    else if (bg != BBEP_TRANSPARENT)
+      (*pfnSetPixelFast)(&screen, tx, y, (uint8_t)bg);
+  }
+}
+
+/** A 1-bpp image of runs 1 to max_run pixels long, like text and dashboard lines */
+static std::vector<uint8_t> run_image(int width, int height, int max_run)
+{
+  int pitch = (width + 7) / 8;
+  std::vector<uint8_t> image(pitch * height, 0xff);
+  for (int y = 0; y < height; y++)
+  {
+    int color = rand() & 1;
+    for (int x = 0; x < width;)
+    {
+      int run = 1 + rand() % max_run;
+      for (int i = 0; i < run && x < width; i++, x++)
+        if (!color)
+          image[y * pitch + x / 8] &= ~(0x80 >> (x & 7));
+      color ^= 1;
+    }
+  }
+  return image;
+}
+
+/**
+ * @brief Decodes the image onto both screens at x, y: the per-pixel loop on one, the spans on the other
+ * @return false if a decoded line isn't the source line
+ */
+static bool draw_both_ways(const std::vector<uint8_t> &image, const std::vector<uint8_t> &g5, int cx, int cy, int x,
+                           int y, int fg, int bg, Screen &pixels, Screen &spans)
+{
+  static G5DECIMAGE dec;
+  uint8_t line[512];
+  int pitch = (cx + 7) / 8;
+  bool same = true;
+  g5_decode_init(&dec, cx, cy, (uint8_t *)g5.data(), (int)g5.size());
+  for (int ty = y; ty < y + cy && ty < pixels.height; ty++)
+  {
+    g5_decode_line(&dec, line);
+    same &= memcmp(line, &image[(ty - y) * pitch], pitch - 1) == 0;
+    draw_pixels(pixels, line, cx, x, ty, fg, bg);
+    bbepDrawFlips(&spans.target, dec.pRef, cx, x, ty, spans.width, fg, bg);
+  }
+  return same;
+}
+
+void test_fill_bits(void)
+{
+  // every start and end inside 3 bytes, against setting one bit at a time
+  for (int start = 0; start <= 24; start++)
+  {
+    for (int end = start; end <= 24; end++)
+    {
+      uint8_t line[3] = {0x5a, 0xc3, 0x96}, expected[3];
+      memcpy(expected, line, 3);
+      for (int bit = start; bit < end; bit++)
+        expected[bit / 8] = (expected[bit / 8] & ~(0x80 >> (bit & 7))) | (0xa5 & (0x80 >> (bit & 7)));
+      bbepFillBits(line, start, end, 0xa5);
+      TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, line, 3);
+    }
+  }
+}
+
+void test_same_pixels_every_layout(void)
+{
+  const int layouts[] = {BBEP_SPAN_2CLR, BBEP_SPAN_3CLR, BBEP_SPAN_4GRAY, BBEP_SPAN_4CLR, BBEP_SPAN_16CLR};
+  // fg, bg in panel colors; 255 is transparent
+  const int colors[][2] = {{BBEP_WHITE, BBEP_BLACK}, {BBEP_BLACK, BBEP_WHITE}, {BBEP_RED, BBEP_WHITE},
+                           {BBEP_YELLOW, BBEP_TRANSPARENT}, {BBEP_TRANSPARENT, BBEP_BLACK}, {2, 3}};
+  // x, y, width, height: aligned, unaligned, and cut off at the right and bottom edges
+  const int places[][4] = {{0, 0, 96, 40}, {3, 5, 61, 17}, {77, 2, 13, 9}, {100, 60, 64, 20}, {9, 70, 150, 30}};
+  for (int layout : layouts)
+  {
+    for (auto &color : colors)
+    {
+      for (auto &place : places)
+      {
+        Screen pixels(130, 80, layout), spans(130, 80, layout);
+        spans.ram = pixels.ram;
+        spans.target.pPlane0 = spans.ram.data();
+        spans.target.pPlane1 = spans.ram.data() + (pixels.target.pPlane1 - pixels.ram.data());
+        std::vector<uint8_t> image = run_image(place[2], place[3], 12);
+        std::vector<uint8_t> g5 = g5_encode_rows(image, place[2], place[3]);
+        TEST_ASSERT_TRUE(draw_both_ways(image, g5, place[2], place[3], place[0], place[1], color[0], color[1], pixels,
+                                        spans));
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(pixels.ram.data(), spans.ram.data(), pixels.ram.size());
+      }
+    }
+  }
+}
+
+void test_solid_lines(void)
+{
+  // all white and all black lines have no runs or a single one
+  std::vector<uint8_t> image(8 * 4, 0xff);
+  memset(&image[8], 0x00, 8);
+  image[2 * 8] = 0x7f;
+  image[3 * 8 + 7] = 0xfe;
+  std::vector<uint8_t> g5 = g5_encode_rows(image, 64, 4);
+  Screen pixels(64, 4, BBEP_SPAN_2CLR), spans(64, 4, BBEP_SPAN_2CLR);
+  spans.ram = pixels.ram;
+  spans.target.pPlane0 = spans.ram.data();
+  TEST_ASSERT_TRUE(draw_both_ways(image, g5, 64, 4, 0, 0, BBEP_WHITE, BBEP_BLACK, pixels, spans));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(image.data(), spans.ram.data(), image.size());
+}
+
+/** @brief Times drawing a full frame of the layout both ways; returns ms per frame through the pointers */
+static void time_layout(int layout, const std::vector<uint8_t> &g5, double *pixels_ms, double *spans_ms)
+{
+  const int loops = 10;
+  static G5DECIMAGE dec;
+  uint8_t line[512];
+  Screen pixels(SCREEN_WIDTH, SCREEN_HEIGHT, layout), spans(SCREEN_WIDTH, SCREEN_HEIGHT, layout);
+  clock_t t0, t1, t2;
+
+  t0 = clock();
+  for (int i = 0; i < loops; i++)
+  {
+    g5_decode_init(&dec, SCREEN_WIDTH, SCREEN_HEIGHT, (uint8_t *)g5.data(), (int)g5.size());
+    for (int y = 0; y < SCREEN_HEIGHT; y++)
+    {
+      g5_decode_line(&dec, line);
+      draw_pixels(pixels, line, SCREEN_WIDTH, 0, y, BBEP_WHITE, BBEP_BLACK);
+    }
+  }
+  t1 = clock();
+  for (int i = 0; i < loops; i++)
+  {
+    g5_decode_init(&dec, SCREEN_WIDTH, SCREEN_HEIGHT, (uint8_t *)g5.data(), (int)g5.size());
+    for (int y = 0; y < SCREEN_HEIGHT; y++)
+    {
+      g5_decode_line(&dec, line);
+      bbepDrawFlips(&spans.target, dec.pRef, SCREEN_WIDTH, 0, y, SCREEN_WIDTH, BBEP_WHITE, BBEP_BLACK);
+    }
+  }
+  t2 = clock();
+  *pixels_ms = 1000.0 * (t1 - t0) / CLOCKS_PER_SEC / loops;
+  *spans_ms = 1000.0 * (t2 - t1) / CLOCKS_PER_SEC / loops;
+}
+
+void test_benchmark(void)
+{
+  const struct
+  {
+    const char *name;
+    int layout;
+  } layouts[] = {
+      {"1-bpp", BBEP_SPAN_2CLR},
+      {"2 planes", BBEP_SPAN_4GRAY},
+      {"4-bpp", BBEP_SPAN_16CLR},
+  };
+  // runs of up to 60 pixels: about 27 per line, denser than most dashboards
+  std::vector<uint8_t> image = run_image(SCREEN_WIDTH, SCREEN_HEIGHT, 60);
+  std::vector<uint8_t> g5 = g5_encode_rows(image, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+  printf("\n%-10s %16s %16s\n", "layout", "per pixel (ms)", "spans (ms)");
+  for (auto &l : layouts)
+  {
+    double pixels_ms, spans_ms;
+    time_layout(l.layout, g5, &pixels_ms, &spans_ms);
+    printf("%-10s %16.3f %16.3f\n", l.name, pixels_ms, spans_ms);
+    TEST_ASSERT_TRUE(spans_ms < pixels_ms);
+  }
+}
+
+void setUp(void)
+{
+  srand(1234);
+}
+
+void tearDown(void)
+{
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_fill_bits);
+  RUN_TEST(test_same_pixels_every_layout);
+  RUN_TEST(test_solid_lines);
+  RUN_TEST(test_benchmark);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
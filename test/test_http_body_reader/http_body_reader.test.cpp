@@ -0,0 +1,318 @@
+#include <unity.h>
+#include <http_body_reader.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+static uint32_t fake_now = 0;
+
+static uint32_t fake_now_ms() { return fake_now; }
+static void fake_wait() { fake_now += 10; }
+
+static const HttpBodyReaderOptions test_options = {
+    .total_timeout_ms = 30000,
+    .idle_timeout_ms = 5000,
+    .now_ms = fake_now_ms,
+    .wait = fake_wait,
+};
+
+/**
+ * Serves a byte string in fixed-size pieces, with a few empty polls in between,
+ * like a WiFiClient being fed by TCP segments.
+ */
+class FakeClient : public ByteSource
+{
+public:
+  FakeClient(const std::string &data, size_t piece, bool close_at_end = true)
+      : data(data), piece(piece), close_at_end(close_at_end), pos(0), piece_left(piece), stall(0), reads(0) {}
+
+  int available() override
+  {
+    if (pos >= data.size())
+      return 0;
+    if (stall > 0)
+    {
+      stall--;
+      return 0;
+    }
+    size_t left = data.size() - pos;
+    return (int)(piece_left < left ? piece_left : left);
+  }
+
+  int read(uint8_t *buf, size_t size) override
+  {
+    int avail = available();
+    if (avail <= 0)
+      return 0;
+    size_t n = size < (size_t)avail ? size : (size_t)avail;
+    memcpy(buf, data.data() + pos, n);
+    pos += n;
+    piece_left -= n;
+    reads++;
+    if (piece_left == 0)
+    {
+      piece_left = piece;
+      stall = 3;
+    }
+    return (int)n;
+  }
+
+  bool connected() override
+  {
+    return pos < data.size() || !close_at_end;
+  }
+
+  size_t consumed() const { return pos; }
+  int readCalls() const { return reads; }
+
+private:
+  std::string data;
+  size_t piece;
+  bool close_at_end;
+  size_t pos;
+  size_t piece_left;
+  int stall;
+  int reads;
+};
+
+static std::string make_payload(size_t size)
+{
+  std::string s;
+  for (size_t i = 0; i < size; i++)
+    s += (char)((i * 7 + 3) & 0xff);
+  return s;
+}
+
+static std::string chunk_encode(const std::string &payload, size_t chunk_size)
+{
+  std::string out;
+  char header[16];
+  for (size_t i = 0; i < payload.size(); i += chunk_size)
+  {
+    size_t n = payload.size() - i < chunk_size ? payload.size() - i : chunk_size;
+    snprintf(header, sizeof(header), "%zx\r\n", n);
+    out += header;
+    out += payload.substr(i, n);
+    out += "\r\n";
+  }
+  out += "0\r\n\r\n";
+  return out;
+}
+
+void test_content_length_body(void)
+{
+  std::string payload = make_payload(5000);
+  FakeClient client(payload, 1460);
+  HttpBodyReader reader(client, payload.size(), false, test_options);
+
+  std::vector<uint8_t> buf(payload.size());
+  size_t received = 0;
+  TEST_ASSERT_EQUAL(BODY_READ_OK, reader.readAll(buf.data(), buf.size(), &received));
+  TEST_ASSERT_EQUAL(payload.size(), received);
+  TEST_ASSERT_EQUAL_MEMORY(payload.data(), buf.data(), payload.size());
+  TEST_ASSERT_TRUE(reader.finished());
+}
+
+void test_content_length_reads_directly_in_pieces(void)
+{
+  std::string payload = make_payload(4096);
+  FakeClient client(payload, 1000);
+  HttpBodyReader reader(client, payload.size(), false, test_options);
+
+  std::vector<uint8_t> buf(payload.size());
+  size_t received = 0;
+  TEST_ASSERT_EQUAL(BODY_READ_OK, reader.readAll(buf.data(), buf.size(), &received));
+  // one read() per TCP piece: no byte-by-byte copying of the payload
+  TEST_ASSERT_EQUAL(5, client.readCalls());
+}
+
+void test_chunked_body(void)
+{
+  std::string payload = make_payload(7000);
+  FakeClient client(chunk_encode(payload, 1024), 333);
+  HttpBodyReader reader(client, -1, true, test_options);
+
+  std::vector<uint8_t> buf(10000);
+  size_t received = 0;
+  TEST_ASSERT_EQUAL(BODY_READ_OK, reader.readAll(buf.data(), buf.size(), &received));
+  TEST_ASSERT_EQUAL(payload.size(), received);
+  TEST_ASSERT_EQUAL_MEMORY(payload.data(), buf.data(), payload.size());
+  TEST_ASSERT_TRUE(reader.finished());
+}
+
+void test_chunked_with_extensions_and_trailer(void)
+{
+  std::string body = "5;name=value\r\nhello\r\nA\r\n, chunked!\r\n0\r\nX-Trailer: 1\r\n\r\n";
+  FakeClient client(body, 4, false);
+  HttpBodyReader reader(client, -1, true, test_options);
+
+  uint8_t buf[64];
+  size_t received = 0;
+  TEST_ASSERT_EQUAL(BODY_READ_OK, reader.readAll(buf, sizeof(buf), &received));
+  TEST_ASSERT_EQUAL(15, received);
+  TEST_ASSERT_EQUAL_MEMORY("hello, chunked!", buf, 15);
+}
+
+void test_chunked_exact_fit(void)
+{
+  std::string payload = make_payload(2048);
+  FakeClient client(chunk_encode(payload, 512), 700);
+  HttpBodyReader reader(client, -1, true, test_options);
+
+  std::vector<uint8_t> buf(payload.size());
+  size_t received = 0;
+  TEST_ASSERT_EQUAL(BODY_READ_OK, reader.readAll(buf.data(), buf.size(), &received));
+  TEST_ASSERT_EQUAL(payload.size(), received);
+}
+
+void test_unknown_length_reads_until_close(void)
+{
+  std::string payload = make_payload(3000);
+  FakeClient client(payload, 512);
+  HttpBodyReader reader(client, -1, false, test_options);
+
+  std::vector<uint8_t> buf(4000);
+  size_t received = 0;
+  TEST_ASSERT_EQUAL(BODY_READ_OK, reader.readAll(buf.data(), buf.size(), &received));
+  TEST_ASSERT_EQUAL(payload.size(), received);
+  TEST_ASSERT_EQUAL_MEMORY(payload.data(), buf.data(), payload.size());
+}
+
+void test_oversize_content_length_rejected_before_reading(void)
+{
+  std::string payload = make_payload(5000);
+  FakeClient client(payload, 1460);
+  HttpBodyReader reader(client, payload.size(), false, test_options);
+
+  std::vector<uint8_t> buf(4000);
+  size_t received = 0;
+  TEST_ASSERT_EQUAL(BODY_READ_TOO_BIG, reader.readAll(buf.data(), buf.size(), &received));
+  TEST_ASSERT_EQUAL(0, client.consumed());
+}
+
+void test_oversize_chunk_rejected_from_header(void)
+{
+  std::string payload = make_payload(5000);
+  FakeClient client(chunk_encode(payload, 3000), 100);
+  HttpBodyReader reader(client, -1, true, test_options);
+
+  std::vector<uint8_t> buf(4000);
+  size_t received = 0;
+  TEST_ASSERT_EQUAL(BODY_READ_TOO_BIG, reader.readAll(buf.data(), buf.size(), &received));
+  // first chunk fits, the second chunk header is enough to give up
+  TEST_ASSERT_EQUAL(3000, received);
+  TEST_ASSERT_LESS_THAN(3100, client.consumed());
+}
+
+void test_oversize_unknown_length(void)
+{
+  std::string payload = make_payload(5000);
+  FakeClient client(payload, 1460);
+  HttpBodyReader reader(client, -1, false, test_options);
+
+  std::vector<uint8_t> buf(4000);
+  size_t received = 0;
+  TEST_ASSERT_EQUAL(BODY_READ_TOO_BIG, reader.readAll(buf.data(), buf.size(), &received));
+}
+
+void test_truncated_body(void)
+{
+  std::string payload = make_payload(1000);
+  FakeClient client(payload, 256);
+  HttpBodyReader reader(client, 2000, false, test_options);
+
+  std::vector<uint8_t> buf(2000);
+  size_t received = 0;
+  TEST_ASSERT_EQUAL(BODY_READ_TRUNCATED, reader.readAll(buf.data(), buf.size(), &received));
+  TEST_ASSERT_EQUAL(1000, received);
+}
+
+void test_idle_timeout(void)
+{
+  std::string payload = make_payload(1000);
+  FakeClient client(payload, 256, false);
+  HttpBodyReader reader(client, 2000, false, test_options);
+
+  std::vector<uint8_t> buf(2000);
+  size_t received = 0;
+  uint32_t start = fake_now;
+  TEST_ASSERT_EQUAL(BODY_READ_TIMEOUT, reader.readAll(buf.data(), buf.size(), &received));
+  TEST_ASSERT_EQUAL(1000, received);
+  TEST_ASSERT_LESS_THAN(start + 5500, fake_now);
+}
+
+void test_malformed_chunk_header(void)
+{
+  FakeClient client("zz\r\nhello\r\n0\r\n\r\n", 64);
+  HttpBodyReader reader(client, -1, true, test_options);
+
+  uint8_t buf[64];
+  size_t received = 0;
+  TEST_ASSERT_EQUAL(BODY_READ_MALFORMED, reader.readAll(buf, sizeof(buf), &received));
+}
+
+void test_empty_body(void)
+{
+  FakeClient client("0\r\n\r\n", 64);
+  HttpBodyReader reader(client, -1, true, test_options);
+
+  uint8_t buf[64];
+  size_t received = 0;
+  TEST_ASSERT_EQUAL(BODY_READ_EMPTY, reader.readAll(buf, sizeof(buf), &received));
+  TEST_ASSERT_EQUAL(0, received);
+}
+
+void test_incremental_reads_across_chunks(void)
+{
+  std::string payload = make_payload(3000);
+  FakeClient client(chunk_encode(payload, 700), 97);
+  HttpBodyReader reader(client, -1, true, test_options);
+
+  std::string out;
+  uint8_t buf[123];
+  size_t n;
+  while ((n = reader.read(buf, sizeof(buf))) > 0)
+  {
+    out.append((const char *)buf, n);
+  }
+  TEST_ASSERT_EQUAL(BODY_READ_OK, reader.error());
+  TEST_ASSERT_TRUE(reader.finished());
+  TEST_ASSERT_EQUAL(payload.size(), out.size());
+  TEST_ASSERT_TRUE(out == payload);
+}
+
+void setUp(void)
+{
+  fake_now = 1000;
+}
+
+void tearDown(void)
+{
+  // clean stuff up here
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_content_length_body);
+  RUN_TEST(test_content_length_reads_directly_in_pieces);
+  RUN_TEST(test_chunked_body);
+  RUN_TEST(test_chunked_with_extensions_and_trailer);
+  RUN_TEST(test_chunked_exact_fit);
+  RUN_TEST(test_unknown_length_reads_until_close);
+  RUN_TEST(test_oversize_content_length_rejected_before_reading);
+  RUN_TEST(test_oversize_chunk_rejected_from_header);
+  RUN_TEST(test_oversize_unknown_length);
+  RUN_TEST(test_truncated_body);
+  RUN_TEST(test_idle_timeout);
+  RUN_TEST(test_malformed_chunk_header);
+  RUN_TEST(test_empty_body);
+  RUN_TEST(test_incremental_reads_across_chunks);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
@@ -0,0 +1,230 @@
+#include <unity.h>
+#include <image_formats.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+// included by path: the rest of bb_epaper doesn't build on the host
+#include "../../lib/bb_epaper/src/Group5.h"
+#include "../../lib/bb_epaper/src/g5enc.inl"
+#include "../../lib/bb_epaper/src/g5dec.inl"
+#include "../../lib/bb_epaper/src/bb_ep_span.inl"
+#include "../g5_encode.h"
+
+/**
+ * Checks the formats a panel advertises, the G5 header checks of display_show_image(), and
+ * draws 2-plane G5 images onto a virtual display the way bbepLoadG5_2Bit() fills its planes.
+ */
+
+static const PanelImageCaps MONO = {true, false, false}; // 4 grays through TWO_BIT_PANEL
+static const PanelImageCaps BWR = {false, true, false};
+static const PanelImageCaps SPECTRA = {false, false, true};
+
+/** @brief G5 file of bb_epaper: 8 byte header, then the compressed lines of every plane */
+static std::vector<uint8_t> encode_g5(const std::vector<uint8_t> &planes, int width, int height, int plane_count)
+{
+  std::vector<uint8_t> lines = g5_encode_rows(planes, width, height * plane_count);
+  std::vector<uint8_t> out(G5_IMAGE_HEADER_SIZE);
+  int size = (int)lines.size();
+  out.reserve(G5_IMAGE_HEADER_SIZE + size + 4); // the decoder reads a few bytes ahead
+  uint16_t header[4] = {(uint16_t)(plane_count == 2 ? G5_IMAGE2_MARKER : G5_IMAGE_MARKER), (uint16_t)width,
+                        (uint16_t)height, (uint16_t)size};
+  for (int i = 0; i < 4; i++)
+  {
+    out[i * 2] = header[i] & 0xff;
+    out[i * 2 + 1] = header[i] >> 8;
+  }
+  out.insert(out.end(), lines.begin(), lines.end());
+  return out;
+}
+
+/** A virtual 2-plane display, as bb_epaper keeps it: plane 1 right behind plane 0 */
+struct VirtualDisplay
+{
+  int width, height, pitch;
+  std::vector<uint8_t> ram;
+
+  VirtualDisplay(int width, int height) : width(width), height(height), pitch((width + 7) / 8), ram(2 * pitch * height, 0xff)
+  {
+  }
+
+  int plane_bit(int plane, int x, int y) const { return (ram[plane * pitch * height + y * pitch + x / 8] >> (7 - (x & 7))) & 1; }
+};
+
+/**
+ * @brief Draws a 2-plane G5 image like bbepLoadG5_2Bit() at 1:1: each plane through the 1-bpp
+ *        span layout, the second one pointed behind the first
+ */
+static bool draw_g5_2plane(VirtualDisplay &display, const std::vector<uint8_t> &g5, const G5ImageInfo &info)
+{
+  static G5DECIMAGE dec;
+  uint8_t line[512];
+  BBEP_SPAN_TARGET target;
+  if (g5_decode_init(&dec, info.width, info.height * 2, (uint8_t *)&g5[G5_IMAGE_HEADER_SIZE],
+                     (int)g5.size() - G5_IMAGE_HEADER_SIZE) != G5_SUCCESS)
+    return false;
+  target.iLayout = BBEP_SPAN_2CLR;
+  target.iPitch = display.pitch;
+  for (int plane = 0; plane < 2; plane++)
+  {
+    target.pPlane0 = &display.ram[plane * display.pitch * display.height];
+    for (int y = 0; y < info.height; y++)
+    {
+      g5_decode_line(&dec, line);
+      bbepDrawFlips(&target, dec.pRef, info.width, info.x, info.y + y, display.width, 1, 0);
+    }
+  }
+  return true;
+}
+
+void test_formats_for_panel(void)
+{
+  uint32_t common = IMAGE_FORMAT_G5 | IMAGE_FORMAT_PNG_INDEXED | IMAGE_FORMAT_PNG | IMAGE_FORMAT_JPEG | IMAGE_FORMAT_BMP;
+  TEST_ASSERT_EQUAL_HEX32(common | IMAGE_FORMAT_G5_2PLANE, image_formats_for_panel(MONO));
+  TEST_ASSERT_EQUAL_HEX32(common | IMAGE_FORMAT_G5_2PLANE, image_formats_for_panel(BWR));
+  TEST_ASSERT_EQUAL_HEX32(common, image_formats_for_panel(SPECTRA)); // 4 bpp, no planes
+}
+
+void test_header_value(void)
+{
+  char value[IMAGE_FORMATS_HEADER_MAX_LEN];
+  size_t len = image_formats_header(image_formats_for_panel(MONO), value, sizeof(value));
+  TEST_ASSERT_EQUAL_STRING("g5;bpp=1, g5;bpp=2, png;bpp=1|2|4|8;indexed, png;bpp=8|16|24|32, jpeg;bpp=8|24, bmp;bpp=1",
+                           value);
+  TEST_ASSERT_EQUAL(strlen(value), len);
+
+  image_formats_header(image_formats_for_panel(SPECTRA), value, sizeof(value));
+  TEST_ASSERT_EQUAL_STRING("g5;bpp=1, png;bpp=1|2|4|8;indexed, png;bpp=8|16|24|32, jpeg;bpp=8|24, bmp;bpp=1", value);
+
+  // a short buffer keeps whole entries only
+  char small[24];
+  len = image_formats_header(IMAGE_FORMAT_G5 | IMAGE_FORMAT_G5_2PLANE | IMAGE_FORMAT_JPEG, small, sizeof(small));
+  TEST_ASSERT_EQUAL_STRING("g5;bpp=1, g5;bpp=2", small);
+  TEST_ASSERT_EQUAL(18, len);
+  TEST_ASSERT_EQUAL(0, image_formats_header(0, small, sizeof(small)));
+  TEST_ASSERT_EQUAL_STRING("", small);
+}
+
+void test_detect(void)
+{
+  uint8_t png[26] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n', 0, 0, 0, 13, 'I', 'H', 'D', 'R'};
+  png[24] = 8; // bit depth
+  png[25] = 3; // color type: palette
+  TEST_ASSERT_EQUAL_HEX32(IMAGE_FORMAT_PNG_INDEXED, image_format_detect(png, sizeof(png)));
+  png[25] = 2; // truecolor
+  TEST_ASSERT_EQUAL_HEX32(IMAGE_FORMAT_PNG, image_format_detect(png, sizeof(png)));
+  TEST_ASSERT_EQUAL_HEX32(0, image_format_detect(png, 20)); // no IHDR yet
+
+  const uint8_t g5[2] = {0xbf, 0xbb}, g5_2[2] = {0xb2, 0xbb}, jpeg[2] = {0xff, 0xd8}, bmp[2] = {'B', 'M'},
+                other[2] = {'<', 'h'};
+  TEST_ASSERT_EQUAL_HEX32(IMAGE_FORMAT_G5, image_format_detect(g5, 2));
+  TEST_ASSERT_EQUAL_HEX32(IMAGE_FORMAT_G5_2PLANE, image_format_detect(g5_2, 2));
+  TEST_ASSERT_EQUAL_HEX32(IMAGE_FORMAT_JPEG, image_format_detect(jpeg, 2));
+  TEST_ASSERT_EQUAL_HEX32(IMAGE_FORMAT_BMP, image_format_detect(bmp, 2));
+  TEST_ASSERT_EQUAL_HEX32(0, image_format_detect(other, 2));
+  TEST_ASSERT_EQUAL_HEX32(0, image_format_detect(g5, 1));
+  TEST_ASSERT_EQUAL_HEX32(0, image_format_detect(nullptr, 8));
+}
+
+void test_g5_check(void)
+{
+  uint32_t mono = image_formats_for_panel(MONO), spectra = image_formats_for_panel(SPECTRA);
+  std::vector<uint8_t> planes((800 / 8) * 480 * 2, 0xff);
+  std::vector<uint8_t> full = encode_g5(planes, 800, 480, 1);
+  G5ImageInfo info;
+
+  TEST_ASSERT_EQUAL(G5_IMAGE_OK, g5_image_check(full.data(), full.size(), 800, 480, mono, &info));
+  TEST_ASSERT_EQUAL(800, info.width);
+  TEST_ASSERT_EQUAL(480, info.height);
+  TEST_ASSERT_EQUAL(1, info.planes);
+  TEST_ASSERT_EQUAL(0, info.x);
+  TEST_ASSERT_EQUAL(0, info.y);
+
+  // smaller than the panel: centered instead of refused
+  std::vector<uint8_t> small = encode_g5(planes, 400, 200, 2);
+  TEST_ASSERT_EQUAL(G5_IMAGE_OK, g5_image_check(small.data(), small.size(), 800, 480, mono, &info));
+  TEST_ASSERT_EQUAL(2, info.planes);
+  TEST_ASSERT_EQUAL(200, info.x);
+  TEST_ASSERT_EQUAL(140, info.y);
+  TEST_ASSERT_EQUAL(G5_IMAGE_UNSUPPORTED, g5_image_check(small.data(), small.size(), 800, 480, spectra, &info));
+
+  // larger than the panel: centered, cut on both sides
+  TEST_ASSERT_EQUAL(G5_IMAGE_OK, g5_image_check(full.data(), full.size(), 480, 800, mono, &info));
+  TEST_ASSERT_EQUAL(-160, info.x);
+  TEST_ASSERT_EQUAL(160, info.y);
+  TEST_ASSERT_EQUAL(G5_IMAGE_TRUNCATED, g5_image_check(full.data(), full.size() - 1, 800, 480, mono, &info));
+  TEST_ASSERT_EQUAL(G5_IMAGE_TRUNCATED, g5_image_check(full.data(), 6, 800, 480, mono, &info));
+  std::vector<uint8_t> empty = full;
+  empty[2] = empty[3] = 0; // width 0
+  TEST_ASSERT_EQUAL(G5_IMAGE_BAD_SIZE, g5_image_check(empty.data(), empty.size(), 800, 480, mono, &info));
+  const uint8_t jpeg[8] = {0xff, 0xd8, 0xff, 0xe0};
+  TEST_ASSERT_EQUAL(G5_IMAGE_NOT_G5, g5_image_check(jpeg, sizeof(jpeg), 800, 480, mono, &info));
+}
+
+void test_two_planes_on_virtual_display(void)
+{
+  // 4 gray levels in bands, split the way bb_epaper keeps them: bit 0 in plane 0, bit 1 in plane 1
+  const int width = 200, height = 120, pitch = width / 8;
+  std::vector<uint8_t> planes(pitch * height * 2, 0x00);
+  std::vector<int> gray(width * height);
+  for (int y = 0; y < height; y++)
+  {
+    for (int x = 0; x < width; x++)
+    {
+      int g = ((x / 10) + (y / 15) + (rand() % 2)) & 3;
+      gray[y * width + x] = g;
+      if (g & 1)
+        planes[y * pitch + x / 8] |= 0x80 >> (x & 7);
+      if (g & 2)
+        planes[(height + y) * pitch + x / 8] |= 0x80 >> (x & 7);
+    }
+  }
+  std::vector<uint8_t> g5 = encode_g5(planes, width, height, 2);
+
+  VirtualDisplay display(320, 240);
+  G5ImageInfo info;
+  TEST_ASSERT_EQUAL(G5_IMAGE_OK, g5_image_check(g5.data(), g5.size(), display.width, display.height,
+                                                image_formats_for_panel(MONO), &info));
+  TEST_ASSERT_TRUE(draw_g5_2plane(display, g5, info));
+  for (int y = 0; y < display.height; y++)
+  {
+    for (int x = 0; x < display.width; x++)
+    {
+      bool inside = x >= info.x && x < info.x + width && y >= info.y && y < info.y + height;
+      int expected = inside ? gray[(y - info.y) * width + (x - info.x)] : 3; // untouched: both planes white
+      int shown = display.plane_bit(0, x, y) | (display.plane_bit(1, x, y) << 1);
+      if (shown != expected)
+      {
+        char msg[64];
+        snprintf(msg, sizeof(msg), "pixel %d,%d", x, y);
+        TEST_FAIL_MESSAGE(msg);
+      }
+    }
+  }
+}
+
+void setUp(void)
+{
+  srand(1234);
+}
+
+void tearDown(void)
+{
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_formats_for_panel);
+  RUN_TEST(test_header_value);
+  RUN_TEST(test_detect);
+  RUN_TEST(test_g5_check);
+  RUN_TEST(test_two_planes_on_virtual_display);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
@@ -0,0 +1,227 @@
+#include <unity.h>
+#include <image_validators.h>
+#include <memory_persistence.h>
+#include <string.h>
+
+#define ETAG_KEY "img_etag"
+#define LAST_MODIFIED_KEY "img_modified"
+#define URL_KEY "img_url"
+
+/** Counts NVS writes so the tests can check that unchanged validators don't wear the flash */
+class CountingPersistence : public MemoryPersistence
+{
+public:
+  int writes = 0;
+
+  size_t writeString(const char *key, const char *value) override
+  {
+    writes++;
+    return MemoryPersistence::writeString(key, value);
+  }
+
+  size_t writeUint(const char *key, const uint32_t value) override
+  {
+    writes++;
+    return MemoryPersistence::writeUint(key, value);
+  }
+};
+
+struct StandInResponse
+{
+  int code;
+  String etag;
+  String last_modified;
+};
+
+/**
+ * Stand-in for the image server: evaluates conditional headers like an HTTP origin would.
+ * If-None-Match takes precedence over If-Modified-Since (RFC 9110 13.2.2).
+ */
+class StandInServer
+{
+public:
+  StandInServer() : requests(0), conditional_requests(0) {}
+
+  void publish(const char *url, const char *etag, const char *last_modified)
+  {
+    this->url = url;
+    this->etag = etag;
+    this->last_modified = last_modified;
+  }
+
+  StandInResponse get(const char *url, const ImageValidators &validators)
+  {
+    requests++;
+    if (validators.etag.length() > 0 || validators.last_modified.length() > 0)
+      conditional_requests++;
+
+    bool same = false;
+    if (validators.etag.length() > 0)
+      same = etag.length() > 0 && validators.etag == etag;
+    else if (validators.last_modified.length() > 0)
+      same = this->url == url && validators.last_modified == last_modified;
+
+    if (same)
+      return {304, etag, last_modified};
+    return {200, etag, last_modified};
+  }
+
+  int requests;
+  int conditional_requests;
+
+private:
+  String url;
+  String etag;
+  String last_modified;
+};
+
+static ImageValidatorsRtc rtc;
+static CountingPersistence *persistence;
+static ImageValidatorStore *store;
+static int refreshes;
+
+/** What downloadAndShow() does with the image URL on every wake */
+static int wake(StandInServer &server, const char *url)
+{
+  StandInResponse response = server.get(url, store->load(url));
+  if (response.code == 304)
+    return 304;
+
+  // downloaded, decoded and shown
+  refreshes++;
+  store->save(url, response.etag, response.last_modified);
+  return response.code;
+}
+
+static void power_cycle()
+{
+  memset(&rtc, 0, sizeof(rtc));
+}
+
+void test_200_304_200(void)
+{
+  StandInServer server;
+  server.publish("https://cdn/a.png", "\"v1\"", "Wed, 21 Oct 2026 07:28:00 GMT");
+
+  TEST_ASSERT_EQUAL(200, wake(server, "https://cdn/a.png"));
+  TEST_ASSERT_EQUAL(304, wake(server, "https://cdn/a.png"));
+  TEST_ASSERT_EQUAL(304, wake(server, "https://cdn/a.png"));
+
+  server.publish("https://cdn/a.png", "\"v2\"", "Wed, 21 Oct 2026 07:43:00 GMT");
+  TEST_ASSERT_EQUAL(200, wake(server, "https://cdn/a.png"));
+  TEST_ASSERT_EQUAL(304, wake(server, "https://cdn/a.png"));
+
+  TEST_ASSERT_EQUAL(2, refreshes);
+  TEST_ASSERT_EQUAL(5, server.requests);
+  TEST_ASSERT_EQUAL(4, server.conditional_requests);
+}
+
+void test_renamed_identical_render_is_not_modified(void)
+{
+  StandInServer server;
+  server.publish("https://cdn/plugin-1.png", "\"abc\"", "");
+  TEST_ASSERT_EQUAL(200, wake(server, "https://cdn/plugin-1.png"));
+
+  // same render under a new name: the ETag still matches
+  server.publish("https://cdn/plugin-2.png", "\"abc\"", "");
+  TEST_ASSERT_EQUAL(304, wake(server, "https://cdn/plugin-2.png"));
+  TEST_ASSERT_EQUAL(1, refreshes);
+}
+
+void test_last_modified_only_for_same_url(void)
+{
+  StandInServer server;
+  server.publish("https://cdn/a.png", "", "Wed, 21 Oct 2026 07:28:00 GMT");
+  TEST_ASSERT_EQUAL(200, wake(server, "https://cdn/a.png"));
+  TEST_ASSERT_EQUAL(304, wake(server, "https://cdn/a.png"));
+
+  ImageValidators other = store->load("https://cdn/b.png");
+  TEST_ASSERT_EQUAL(0, other.last_modified.length());
+  TEST_ASSERT_EQUAL(0, other.etag.length());
+}
+
+void test_nvs_fallback_after_power_cycle(void)
+{
+  StandInServer server;
+  server.publish("https://cdn/a.png", "\"v1\"", "Wed, 21 Oct 2026 07:28:00 GMT");
+  TEST_ASSERT_EQUAL(200, wake(server, "https://cdn/a.png"));
+
+  power_cycle();
+  TEST_ASSERT_EQUAL(304, wake(server, "https://cdn/a.png"));
+  TEST_ASSERT_EQUAL_STRING("\"v1\"", rtc.etag);
+  TEST_ASSERT_EQUAL(IMAGE_VALIDATORS_MAGIC, rtc.magic);
+}
+
+void test_unchanged_validators_not_rewritten(void)
+{
+  StandInServer server;
+  server.publish("https://cdn/a.png", "\"v1\"", "Wed, 21 Oct 2026 07:28:00 GMT");
+  TEST_ASSERT_EQUAL(200, wake(server, "https://cdn/a.png"));
+  int writes = persistence->writes;
+  TEST_ASSERT_EQUAL(3, writes);
+
+  store->save("https://cdn/a.png", "\"v1\"", "Wed, 21 Oct 2026 07:28:00 GMT");
+  TEST_ASSERT_EQUAL(writes, persistence->writes);
+
+  store->save("https://cdn/a.png", "\"v2\"", "Wed, 21 Oct 2026 07:28:00 GMT");
+  TEST_ASSERT_EQUAL(writes + 1, persistence->writes);
+}
+
+void test_clear_forces_download(void)
+{
+  StandInServer server;
+  server.publish("https://cdn/a.png", "\"v1\"", "Wed, 21 Oct 2026 07:28:00 GMT");
+  TEST_ASSERT_EQUAL(200, wake(server, "https://cdn/a.png"));
+
+  // a message screen replaced the image
+  store->clear();
+  TEST_ASSERT_EQUAL(200, wake(server, "https://cdn/a.png"));
+
+  store->clear();
+  power_cycle();
+  TEST_ASSERT_EQUAL(200, wake(server, "https://cdn/a.png"));
+  TEST_ASSERT_EQUAL(3, refreshes);
+}
+
+void test_oversized_etag_not_kept(void)
+{
+  char etag[IMAGE_ETAG_MAX_LEN + 8];
+  memset(etag, 'x', sizeof(etag) - 1);
+  etag[sizeof(etag) - 1] = 0;
+
+  store->save("https://cdn/a.png", etag, "");
+  TEST_ASSERT_EQUAL(0, store->load("https://cdn/a.png").etag.length());
+}
+
+void setUp(void)
+{
+  power_cycle();
+  persistence = new CountingPersistence();
+  store = new ImageValidatorStore(rtc, ETAG_KEY, LAST_MODIFIED_KEY, URL_KEY, *persistence);
+  refreshes = 0;
+}
+
+void tearDown(void)
+{
+  delete store;
+  delete persistence;
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_200_304_200);
+  RUN_TEST(test_renamed_identical_render_is_not_modified);
+  RUN_TEST(test_last_modified_only_for_same_url);
+  RUN_TEST(test_nvs_fallback_after_power_cycle);
+  RUN_TEST(test_unchanged_validators_not_rewritten);
+  RUN_TEST(test_clear_forces_download);
+  RUN_TEST(test_oversized_etag_not_kept);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
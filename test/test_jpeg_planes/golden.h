@@ -0,0 +1,113 @@
+#pragma once
+
+#include <stdint.h>
+
+// Expected panel planes for a 72x40 image (see gray_source() and rgb565_source()), from an
+// independent reference implementation of the same Floyd-Steinberg and red threshold rules
+
+#define GOLDEN_WIDTH 72
+#define GOLDEN_HEIGHT 40
+
+static const uint8_t golden_gray_plane0[] = {
+    0xff, 0x6a, 0x00, 0x00, 0xab, 0x7f, 0xfe, 0xd4, 0x00, 0xf5, 0xa9, 0x40, 0x0a, 0x55, 0xff, 0xf5,
+    0x52, 0xa3, 0xde, 0xa4, 0x10, 0x22, 0xaf, 0x6f, 0xdb, 0x48, 0x07, 0xf5, 0x51, 0x00, 0x15, 0x5b,
+    0xff, 0xed, 0x52, 0x0f, 0xaa, 0x84, 0x00, 0x92, 0xef, 0xff, 0x55, 0x00, 0x3f, 0xd5, 0x20, 0x01,
+    0x4d, 0x7d, 0xfd, 0xb4, 0xa8, 0x7d, 0x6a, 0x10, 0x04, 0x35, 0xb7, 0xfe, 0xd2, 0x01, 0xf6, 0xa8,
+    0x80, 0x02, 0xcb, 0xff, 0xf5, 0x49, 0x43, 0xfb, 0x44, 0x20, 0x15, 0x3e, 0xdf, 0xda, 0xa4, 0x07,
+    0xad, 0xa9, 0x00, 0x49, 0x6b, 0xff, 0x6d, 0x50, 0x1f, 0xf5, 0x20, 0x00, 0x26, 0xbf, 0xff, 0xb5,
+    0x04, 0x3e, 0xaa, 0x88, 0x02, 0x9a, 0xed, 0xfd, 0x52, 0x50, 0xfb, 0x54, 0x20, 0x01, 0x55, 0xbf,
+    0xf6, 0xd4, 0x81, 0xfd, 0xaa, 0x00, 0x0a, 0x57, 0xff, 0xfb, 0x52, 0x03, 0xd6, 0xa0, 0x40, 0x12,
+    0xba, 0xff, 0xd5, 0x48, 0x0f, 0xfa, 0xaa, 0x00, 0x4a, 0xd7, 0xff, 0xba, 0xa2, 0x1f, 0x55, 0x40,
+    0x00, 0x95, 0x7f, 0xfe, 0xd5, 0x08, 0x3d, 0xd5, 0x14, 0x02, 0x55, 0xaf, 0xff, 0x54, 0xa0, 0xfe,
+    0xaa, 0x40, 0x09, 0x2b, 0x7f, 0xfa, 0xd2, 0x01, 0xf5, 0xa8, 0x80, 0x04, 0xae, 0xff, 0xf6, 0xa8,
+    0x87, 0xde, 0xa4, 0x00, 0x52, 0xdb, 0xff, 0xda, 0x84, 0x0f, 0xea, 0x92, 0x00, 0x15, 0x6f, 0xff,
+    0xea, 0xa8, 0x1e, 0xb5, 0x48, 0x00, 0x4a, 0xbd, 0xfe, 0xaa, 0x40, 0x7f, 0xd4, 0x20, 0x01, 0x57,
+    0xef, 0xff, 0x55, 0x00, 0xfa, 0x52, 0x80, 0x02, 0x5a, 0xbf, 0xf5, 0x50, 0x4b, 0xed, 0xaa, 0x00,
+    0x09, 0xad, 0xff, 0xfa, 0xaa, 0x07, 0xf6, 0xa4, 0x40, 0x04, 0x6f, 0xff, 0xab, 0x41, 0x0f, 0x5a,
+    0x90, 0x00, 0x55, 0xb6, 0xff, 0x6c, 0x94, 0x3f, 0xea, 0x44, 0x00, 0x2a, 0xdf, 0xfd, 0xb2, 0x40,
+    0x7d, 0x2a, 0x90, 0x01, 0x55, 0xbf, 0xfe, 0xca, 0x11, 0xf6, 0xd4, 0x40, 0x04, 0xab, 0xff, 0xf5,
+    0x51, 0x43, 0xfb, 0x52, 0x00, 0x02, 0xae, 0xff, 0xdb, 0x54, 0x07, 0xad, 0x48, 0x80, 0x2a, 0xb7,
+    0xff, 0xed, 0x20, 0x1f, 0xea, 0xa2, 0x00, 0x15, 0x5b, 0xff, 0x54, 0x89, 0x3e, 0xb5, 0x10, 0x01,
+    0x55, 0xef, 0xfe, 0xea, 0x40, 0xfb, 0x54, 0x80, 0x00, 0xaa, 0xbf, 0xfb, 0x52, 0x21, 0xfd, 0xaa,
+    0x20, 0x0a, 0x57, 0xff, 0xfd, 0x49, 0x03, 0xd6, 0xa0, 0x80, 0x05, 0x5a, 0xbf, 0xd5, 0x54, 0x0f,
+    0xfa, 0xaa, 0x00, 0x29, 0x6f, 0xff, 0xb5, 0x40, 0x1f, 0x55, 0x10, 0x00, 0x4a, 0xb6, 0xff, 0xd5,
+    0x24, 0x7d, 0xaa, 0xa0, 0x01, 0x2b, 0xdf, 0xfe,
+};
+
+static const uint8_t golden_gray_plane1[] = {
+    0xff, 0xff, 0xff, 0xff, 0x54, 0x80, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf5, 0xaa, 0x00, 0x00,
+    0x00, 0x03, 0xff, 0xff, 0xff, 0xdd, 0x50, 0x90, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xea, 0xa4,
+    0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x6d, 0x10, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xfe,
+    0xb2, 0x82, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xfb, 0xca, 0x48, 0x00, 0x00, 0x01, 0xff, 0xff,
+    0xff, 0xfd, 0x34, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xea, 0xc1, 0x20, 0x00, 0x00, 0x07,
+    0xff, 0xff, 0xff, 0xb6, 0x94, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xd9, 0x40, 0x00, 0x00,
+    0x00, 0x3f, 0xff, 0xff, 0xfd, 0x65, 0x12, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfe, 0xaa, 0x40,
+    0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xf5, 0xa8, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xed,
+    0x45, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xb5, 0x28, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff,
+    0xff, 0x6a, 0x80, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xfd, 0xaa, 0x50, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xf6, 0xd4, 0x80, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfb, 0x51, 0x00, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0xff, 0xad, 0x24, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xea, 0x90, 0x00,
+    0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xb5, 0x42, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0xa8,
+    0x10, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfd, 0xa5, 0x40, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff,
+    0xf6, 0x52, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xfb, 0x90, 0x00, 0x00, 0x00, 0x0f, 0xff,
+    0xff, 0xff, 0xaa, 0x49, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xd5, 0x20, 0x00, 0x00, 0x00,
+    0x7f, 0xff, 0xff, 0xfe, 0xaa, 0x40, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfb, 0x54, 0x00, 0x00,
+    0x00, 0x03, 0xff, 0xff, 0xff, 0xfd, 0x51, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xd5, 0x48,
+    0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xea, 0xa4, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xfe,
+    0xaa, 0x10, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x55, 0x40, 0x00, 0x00, 0x01, 0xff, 0xff,
+    0xff, 0xf5, 0xa8, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xfa, 0xa5, 0x40, 0x00, 0x00, 0x0f,
+    0xff, 0xff, 0xff, 0xd6, 0x90, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xb5, 0x49, 0x00, 0x00,
+    0x00, 0x7f, 0xff, 0xff, 0xfe, 0xd4, 0x20, 0x00,
+};
+
+static const uint8_t golden_bwr_plane0[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x4a, 0xaa, 0xaa, 0xaf, 0x00,
+    0x00, 0x92, 0xaa, 0x95, 0x29, 0x2a, 0xad, 0xda, 0x00, 0x24, 0x00, 0x04, 0xa0, 0xa5, 0x55, 0x56,
+    0xb7, 0x01, 0x01, 0x2a, 0xa9, 0x16, 0x95, 0x55, 0x6a, 0xda, 0x04, 0x08, 0x00, 0x12, 0x49, 0x55,
+    0x55, 0xad, 0x6d, 0x00, 0x21, 0x4a, 0xa1, 0x00, 0x55, 0x55, 0x56, 0xb7, 0x10, 0x80, 0x10, 0x14,
+    0x00, 0x24, 0xaa, 0xb5, 0xda, 0x00, 0x0a, 0x45, 0x40, 0x00, 0x0a, 0xab, 0x5b, 0x6f, 0x02, 0x20,
+    0x10, 0x28, 0x00, 0x05, 0x55, 0x6d, 0x5a, 0x10, 0x02, 0x85, 0x40, 0x00, 0x05, 0x5a, 0xab, 0xb7,
+    0x01, 0x28, 0x20, 0x80, 0x00, 0x02, 0xab, 0xb5, 0x6d, 0x04, 0x01, 0x15, 0x20, 0x00, 0x01, 0x55,
+    0x5e, 0xdb, 0x20, 0x48, 0x88, 0x80, 0x00, 0x01, 0x6d, 0xab, 0x76, 0x01, 0x02, 0x44, 0x40, 0x00,
+    0x02, 0xaa, 0xf5, 0xbf, 0x10, 0x28, 0x29, 0x20, 0x00, 0x03, 0x56, 0x9e, 0xd5, 0x04, 0x82, 0x82,
+    0x80, 0x00, 0x02, 0xbb, 0x6b, 0x7b, 0x20, 0x10, 0x54, 0x40, 0x00, 0x01, 0x55, 0xb5, 0xde, 0x02,
+    0x85, 0x09, 0x20, 0x00, 0x02, 0xd6, 0xde, 0xb7, 0x10, 0x20, 0xa2, 0x80, 0x00, 0x01, 0x5a, 0xab,
+    0xdb, 0x44, 0x94, 0x14, 0x50, 0x00, 0x02, 0xd6, 0xf6, 0xfd, 0x00, 0x02, 0xa2, 0xa8, 0x00, 0x05,
+    0x6b, 0x5b, 0x57, 0x12, 0xa8, 0x94, 0x40, 0x00, 0x0b, 0x5d, 0xad, 0xfd, 0x40, 0x04, 0x42, 0xac,
+    0x00, 0x35, 0xaa, 0xf7, 0x57, 0x0a, 0xa2, 0x95, 0x13, 0x00, 0x2a, 0xb7, 0x5d, 0xfd, 0x20, 0x11,
+    0x22, 0x54, 0xd7, 0x56, 0xda, 0xeb, 0x57, 0x04, 0x8a, 0x49, 0x55, 0x55, 0x5b, 0x6d, 0xbf, 0xff,
+    0x49, 0x21, 0x2a, 0x92, 0xaa, 0xaa, 0xb6, 0xd5, 0x5b, 0x00, 0x4a, 0x44, 0x55, 0x55, 0x6d, 0xab,
+    0x7f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t golden_bwr_plane1[] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1f, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1f, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1f, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xfc, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
@@ -0,0 +1,267 @@
+#include <unity.h>
+#include <jpeg_planes.h>
+#include <png_planes.h>
+#include <PNGdec.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "golden.h"
+
+/**
+ * Feeds JpegPlanes blocks the way JPEGDEC draws them and checks what a virtual bb_epaper
+ * panel ends up with in its two planes against golden images.
+ */
+
+#define MCU_HEIGHT 16
+
+/**
+ * Stands in for bbep: the address window and RAM counter of the controller, and both
+ * plane RAMs, 1 bit per pixel.
+ */
+struct VirtualPanel
+{
+  int width, height, pitch;
+  std::vector<uint8_t> ram[2];
+  int win_x, win_y, win_w, win_h;
+  int plane;
+  int cursor; // bytes written since startWrite()
+  int writes[2];
+
+  VirtualPanel(int width, int height) : width(width), height(height), pitch((width + 7) / 8), plane(0)
+  {
+    ram[0].assign(pitch * height, 0xaa);
+    ram[1].assign(pitch * height, 0xaa);
+    writes[0] = writes[1] = 0;
+  }
+
+  void setAddrWindow(int x, int y, int w, int h)
+  {
+    win_x = x / 8;
+    win_y = y;
+    win_w = (w + 7) / 8;
+    win_h = h;
+  }
+
+  void startWrite(int p)
+  {
+    plane = p;
+    cursor = 0;
+    writes[p]++;
+  }
+
+  void writeData(const uint8_t *data, int len)
+  {
+    for (int i = 0; i < len; i++, cursor++)
+    {
+      int row = win_y + cursor / win_w;
+      if (row < win_y + win_h && row < height)
+        ram[plane][row * pitch + win_x + cursor % win_w] = data[i];
+    }
+  }
+};
+
+/** The same calls jpeg_write_planes() makes on the device */
+static bool panel_write(void *ctx, int y, int height, const uint8_t *plane0, const uint8_t *plane1, int pitch)
+{
+  VirtualPanel *panel = (VirtualPanel *)ctx;
+  panel->setAddrWindow(0, y, panel->width, height);
+  panel->startWrite(0);
+  panel->writeData(plane0, pitch * height);
+  panel->setAddrWindow(0, y, panel->width, height);
+  panel->startWrite(1);
+  panel->writeData(plane1, pitch * height);
+  return true;
+}
+
+static uint8_t gray_source(int x, int y)
+{
+  return (uint8_t)((x * 255 / (GOLDEN_WIDTH - 1) + y * 5) % 256);
+}
+
+static uint16_t rgb565_source(int x, int y)
+{
+  int r, g, b, dx = x - 36, dy = y - 20;
+  if (dx * dx + dy * dy < 100)
+    r = 230, g = 20, b = 30; // red disc
+  else if (y < 6)
+    r = 140, g = 30, b = 30; // dark red
+  else if (y >= 34)
+    r = 250, g = 150, b = 40; // orange
+  else
+    r = (x * 3) & 0xff, g = (x * 3) & 0xff, b = (y * 6) & 0xff;
+  return (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+}
+
+/**
+ * @brief Draws the test image as JPEGDEC would: MCU rows of blocks block_w wide, left to right
+ * Blocks have a stride of block_w pixels; the last one of a row and the last row are only
+ * partly used, as with an image that isn't a multiple of the MCU size.
+ * @return false if addBlock() failed
+ */
+static bool decode(JpegPlanes &planes, jpeg_planes_mode_e mode, int block_w)
+{
+  std::vector<uint8_t> gray(block_w * MCU_HEIGHT);
+  std::vector<uint16_t> rgb(block_w * MCU_HEIGHT);
+  for (int y = 0; y < GOLDEN_HEIGHT; y += MCU_HEIGHT)
+  {
+    for (int x = 0; x < GOLDEN_WIDTH; x += block_w)
+    {
+      for (int row = 0; row < MCU_HEIGHT; row++)
+      {
+        for (int i = 0; i < block_w; i++)
+        {
+          // garbage past the edges of the image, which must not show up
+          bool inside = x + i < GOLDEN_WIDTH && y + row < GOLDEN_HEIGHT;
+          gray[row * block_w + i] = inside ? gray_source(x + i, y + row) : 0x00;
+          rgb[row * block_w + i] = inside ? rgb565_source(x + i, y + row) : 0xf800;
+        }
+      }
+      int used = (GOLDEN_WIDTH - x < block_w) ? GOLDEN_WIDTH - x : block_w;
+      const void *pixels = (mode == JPEG_PLANES_FOUR_GRAY) ? (const void *)gray.data() : (const void *)rgb.data();
+      if (!planes.addBlock(x, y, used, MCU_HEIGHT, block_w, pixels))
+        return false;
+    }
+  }
+  return true;
+}
+
+void test_four_gray_golden(void)
+{
+  VirtualPanel panel(GOLDEN_WIDTH, GOLDEN_HEIGHT);
+  JpegPlanes planes;
+  TEST_ASSERT_TRUE(planes.begin(GOLDEN_WIDTH, GOLDEN_HEIGHT, JPEG_PLANES_FOUR_GRAY, DITHER_FLOYD_STEINBERG,
+                                panel_write, &panel));
+  TEST_ASSERT_TRUE(decode(planes, JPEG_PLANES_FOUR_GRAY, 16));
+  TEST_ASSERT_TRUE(planes.flush());
+
+  TEST_ASSERT_EQUAL_MEMORY(golden_gray_plane0, panel.ram[0].data(), sizeof(golden_gray_plane0));
+  TEST_ASSERT_EQUAL_MEMORY(golden_gray_plane1, panel.ram[1].data(), sizeof(golden_gray_plane1));
+
+  // one decode: every strip went to both planes exactly once
+  int strips = (GOLDEN_HEIGHT + MCU_HEIGHT - 1) / MCU_HEIGHT;
+  TEST_ASSERT_EQUAL(strips, planes.strips());
+  TEST_ASSERT_EQUAL(strips, panel.writes[0]);
+  TEST_ASSERT_EQUAL(strips, panel.writes[1]);
+}
+
+void test_bwr_golden(void)
+{
+  VirtualPanel panel(GOLDEN_WIDTH, GOLDEN_HEIGHT);
+  JpegPlanes planes;
+  TEST_ASSERT_TRUE(planes.begin(GOLDEN_WIDTH, GOLDEN_HEIGHT, JPEG_PLANES_BWR, DITHER_FLOYD_STEINBERG, panel_write,
+                                &panel));
+  TEST_ASSERT_TRUE(decode(planes, JPEG_PLANES_BWR, 16));
+
+  TEST_ASSERT_EQUAL_MEMORY(golden_bwr_plane0, panel.ram[0].data(), sizeof(golden_bwr_plane0));
+  TEST_ASSERT_EQUAL_MEMORY(golden_bwr_plane1, panel.ram[1].data(), sizeof(golden_bwr_plane1));
+
+  // red is never also white: bbep shows such pixels red, but the B/W plane should agree
+  for (size_t i = 0; i < panel.ram[0].size(); i++)
+    TEST_ASSERT_EQUAL_HEX8(0, panel.ram[0][i] & panel.ram[1][i]);
+}
+
+void test_block_size_doesnt_matter(void)
+{
+  // JPEGDEC's block width depends on the subsampling and its output buffer
+  const int widths[] = {8, 24, 32, GOLDEN_WIDTH};
+  const jpeg_planes_mode_e modes[] = {JPEG_PLANES_FOUR_GRAY, JPEG_PLANES_BWR};
+  for (jpeg_planes_mode_e mode : modes)
+  {
+    const uint8_t *golden0 = (mode == JPEG_PLANES_FOUR_GRAY) ? golden_gray_plane0 : golden_bwr_plane0;
+    const uint8_t *golden1 = (mode == JPEG_PLANES_FOUR_GRAY) ? golden_gray_plane1 : golden_bwr_plane1;
+    for (int width : widths)
+    {
+      VirtualPanel panel(GOLDEN_WIDTH, GOLDEN_HEIGHT);
+      JpegPlanes planes;
+      TEST_ASSERT_TRUE(planes.begin(GOLDEN_WIDTH, GOLDEN_HEIGHT, mode, DITHER_FLOYD_STEINBERG, panel_write, &panel));
+      TEST_ASSERT_TRUE(decode(planes, mode, width));
+      TEST_ASSERT_EQUAL_MEMORY(golden0, panel.ram[0].data(), panel.ram[0].size());
+      TEST_ASSERT_EQUAL_MEMORY(golden1, panel.ram[1].data(), panel.ram[1].size());
+    }
+  }
+}
+
+void test_matches_png_four_gray(void)
+{
+  // the planes are what png_draw() sends for the same gray rows reduced by ReduceBpp()
+  VirtualPanel panel(GOLDEN_WIDTH, GOLDEN_HEIGHT);
+  JpegPlanes planes;
+  TEST_ASSERT_TRUE(planes.begin(GOLDEN_WIDTH, GOLDEN_HEIGHT, JPEG_PLANES_FOUR_GRAY, DITHER_NONE, panel_write, &panel));
+  TEST_ASSERT_TRUE(decode(planes, JPEG_PLANES_FOUR_GRAY, 32));
+
+  const int pitch = (GOLDEN_WIDTH + 7) / 8;
+  uint8_t gray[GOLDEN_WIDTH], two_bit[GOLDEN_WIDTH / 4 + 1], plane[pitch];
+  for (int y = 0; y < GOLDEN_HEIGHT; y++)
+  {
+    for (int x = 0; x < GOLDEN_WIDTH; x++)
+      gray[x] = gray_source(x, y);
+    png_reduce_row(2, PNG_PIXEL_GRAYSCALE, nullptr, gray, two_bit, GOLDEN_WIDTH, 8, nullptr);
+    two_bit_to_one_bit(two_bit, plane, GOLDEN_WIDTH, 0, TWO_BIT_PLANE_0);
+    TEST_ASSERT_EQUAL_MEMORY(plane, &panel.ram[0][y * pitch], pitch);
+    two_bit_to_one_bit(two_bit, plane, GOLDEN_WIDTH, 0, TWO_BIT_PLANE_1);
+    TEST_ASSERT_EQUAL_MEMORY(plane, &panel.ram[1][y * pitch], pitch);
+  }
+}
+
+void test_truncated_decode(void)
+{
+  // the decoder stopped halfway through a row of blocks: flush() still sends what arrived
+  VirtualPanel panel(GOLDEN_WIDTH, GOLDEN_HEIGHT);
+  JpegPlanes planes;
+  TEST_ASSERT_TRUE(planes.begin(GOLDEN_WIDTH, GOLDEN_HEIGHT, JPEG_PLANES_FOUR_GRAY, DITHER_FLOYD_STEINBERG,
+                                panel_write, &panel));
+  uint8_t block[16 * MCU_HEIGHT];
+  memset(block, 0x00, sizeof(block));
+  TEST_ASSERT_TRUE(planes.addBlock(0, 0, 16, MCU_HEIGHT, 16, block));
+  TEST_ASSERT_EQUAL(0, planes.strips());
+  TEST_ASSERT_TRUE(planes.flush());
+  TEST_ASSERT_EQUAL(1, planes.strips());
+  TEST_ASSERT_EQUAL_HEX8(0xff, panel.ram[0][0]); // black is panel value 3: both bits set
+  TEST_ASSERT_EQUAL_HEX8(0xff, panel.ram[1][0]);
+  TEST_ASSERT_EQUAL_HEX8(0x00, panel.ram[0][5]); // never drawn: white
+  TEST_ASSERT_EQUAL_HEX8(0x00, panel.ram[1][5]);
+  TEST_ASSERT_TRUE(planes.flush()); // nothing left
+  TEST_ASSERT_EQUAL(1, planes.strips());
+}
+
+void test_bad_blocks(void)
+{
+  VirtualPanel panel(GOLDEN_WIDTH, GOLDEN_HEIGHT);
+  JpegPlanes planes;
+  uint8_t block[8 * 32] = {0};
+  TEST_ASSERT_FALSE(planes.addBlock(0, 0, 8, 8, 8, block)); // before begin()
+  TEST_ASSERT_TRUE(planes.begin(GOLDEN_WIDTH, GOLDEN_HEIGHT, JPEG_PLANES_FOUR_GRAY, DITHER_FLOYD_STEINBERG,
+                                panel_write, &panel));
+  TEST_ASSERT_FALSE(planes.addBlock(0, 0, 8, 32, 8, block)); // taller than an MCU
+  TEST_ASSERT_FALSE(planes.addBlock(GOLDEN_WIDTH, 0, 8, 8, 8, block));
+  TEST_ASSERT_FALSE(planes.addBlock(0, GOLDEN_HEIGHT, 8, 8, 8, block));
+  planes.end();
+  TEST_ASSERT_FALSE(planes.addBlock(0, 0, 8, 8, 8, block));
+  TEST_ASSERT_EQUAL(0, panel.writes[0]);
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_four_gray_golden);
+  RUN_TEST(test_bwr_golden);
+  RUN_TEST(test_block_size_doesnt_matter);
+  RUN_TEST(test_matches_png_four_gray);
+  RUN_TEST(test_truncated_decode);
+  RUN_TEST(test_bad_blocks);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
@@ -0,0 +1,255 @@
+#include <unity.h>
+#include <jpeg_strip.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+/**
+ * Checks that sending JPEGDEC's 1-bpp blocks a strip at a time puts the same pixels in the
+ * panel RAM as the per-block jpeg_draw() did, and counts the SPI transactions of both.
+ */
+
+#define FRAME_WIDTH 800
+#define FRAME_HEIGHT 480
+
+/**
+ * Stands in for bbep on a UC81xx panel: keeps the plane RAM and counts SPI transactions.
+ * setAddrWindow() is 3 (PTIN, PTL and its data), startWrite() 1, writeData() 1 per call.
+ */
+struct CountingPanel
+{
+  int width, height, pitch;
+  std::vector<uint8_t> ram;
+  int win_x, win_y, win_w, win_h;
+  int cursor;
+  int transactions;
+  int windows;
+  size_t bytes;
+
+  CountingPanel(int width, int height)
+      : width(width), height(height), pitch((width + 7) / 8), ram(pitch * height, 0xaa), transactions(0),
+        windows(0), bytes(0)
+  {
+  }
+
+  void setAddrWindow(int x, int y, int w, int h)
+  {
+    win_x = x / 8;
+    win_y = y;
+    win_w = (w + 7) / 8;
+    win_h = h;
+    transactions += 3;
+    windows++;
+  }
+
+  void startWrite()
+  {
+    cursor = 0;
+    transactions++;
+  }
+
+  void writeData(const uint8_t *data, int len)
+  {
+    for (int i = 0; i < len; i++, cursor++)
+    {
+      int row = win_y + cursor / win_w;
+      int col = win_x + cursor % win_w;
+      if (row < win_y + win_h && row < height && col < pitch)
+        ram[row * pitch + col] = data[i];
+    }
+    transactions++;
+    bytes += len;
+  }
+};
+
+/** What jpeg_draw() did before: a window and a write command per block, a transfer per row of JPEGDRAW::iWidth */
+static void legacy_draw(CountingPanel &panel, int x, int y, int w, int h, const uint8_t *pixels)
+{
+  panel.setAddrWindow(x, y, w, h);
+  panel.startWrite();
+  for (int row = 0; row < h; row++)
+    panel.writeData(pixels + row * (w >> 3), (w + 7) / 8);
+}
+
+/** The same calls jpeg_write_strip() makes on the device */
+static bool strip_write(void *ctx, int y, int height, const uint8_t *data, int pitch)
+{
+  CountingPanel *panel = (CountingPanel *)ctx;
+  panel->setAddrWindow(0, y, panel->width, height);
+  panel->startWrite();
+  panel->writeData(data, pitch * height);
+  return true;
+}
+
+/** A frame of random 1-bpp pixels to cut blocks from */
+static std::vector<uint8_t> random_frame(int width, int height)
+{
+  std::vector<uint8_t> frame((width / 8) * height);
+  for (size_t i = 0; i < frame.size(); i++)
+    frame[i] = (uint8_t)(rand() & 0xff);
+  return frame;
+}
+
+/** @brief Copies the block at x, y out of the frame, block_w wide, as JPEGDEC would hand it over */
+static void cut_block(const std::vector<uint8_t> &frame, int width, int x, int y, int block_w, int mcu_h,
+                      std::vector<uint8_t> &block)
+{
+  block.assign((block_w / 8) * mcu_h, 0x00);
+  for (int row = 0; row < mcu_h; row++)
+  {
+    for (int b = 0; b < block_w / 8 && x / 8 + b < width / 8; b++)
+      block[row * (block_w / 8) + b] = frame[(y + row) * (width / 8) + x / 8 + b];
+  }
+}
+
+struct DrawCounts
+{
+  int blocks;
+  int transactions;
+  int windows;
+};
+
+/**
+ * @brief Draws a frame in blocks of block_w x mcu_h both ways and compares the panel RAM
+ * @param legacy, strip receive the counts of the per-block and the strip path
+ */
+static void draw_both_ways(int width, int height, int block_w, int mcu_h, DrawCounts *legacy, DrawCounts *strip)
+{
+  std::vector<uint8_t> frame = random_frame(width, height), block;
+  CountingPanel before(width, height), after(width, height);
+  JpegStrip assembler;
+  TEST_ASSERT_TRUE(assembler.begin(width, height, strip_write, &after));
+
+  legacy->blocks = 0;
+  for (int y = 0; y < height; y += mcu_h)
+  {
+    for (int x = 0; x < width; x += block_w)
+    {
+      int used = (width - x < block_w) ? width - x : block_w;
+      cut_block(frame, width, x, y, block_w, mcu_h, block);
+      legacy_draw(before, x, y, block_w, mcu_h, block.data());
+      TEST_ASSERT_TRUE(assembler.addBlock(x, y, used, mcu_h, block_w, block.data()));
+      legacy->blocks++;
+    }
+  }
+  TEST_ASSERT_TRUE(assembler.flush());
+
+  TEST_ASSERT_EQUAL_MEMORY(frame.data(), after.ram.data(), frame.size());
+  TEST_ASSERT_EQUAL_MEMORY(before.ram.data(), after.ram.data(), frame.size());
+  TEST_ASSERT_EQUAL(frame.size(), after.bytes); // no padding past the right edge either
+  TEST_ASSERT_TRUE(before.bytes >= after.bytes);
+  TEST_ASSERT_EQUAL(height / mcu_h, assembler.strips());
+
+  legacy->transactions = before.transactions;
+  legacy->windows = before.windows;
+  strip->blocks = legacy->blocks;
+  strip->transactions = after.transactions;
+  strip->windows = after.windows;
+}
+
+void test_same_pixels_fewer_transactions(void)
+{
+  const struct
+  {
+    const char *name;
+    int block_w, mcu_h;
+  } layouts[] = {
+      {"4:2:0, 128x16", 128, 16},
+      {"4:4:4, 256x8", 256, 8},
+      {"4:2:0, 16x16", 16, 16},
+  };
+
+  printf("\n%-16s %8s %14s %14s %10s %10s\n", "blocks", "count", "SPI before", "SPI after", "win before",
+         "win after");
+  for (auto &layout : layouts)
+  {
+    DrawCounts legacy = {0, 0, 0}, strip = {0, 0, 0};
+    draw_both_ways(FRAME_WIDTH, FRAME_HEIGHT, layout.block_w, layout.mcu_h, &legacy, &strip);
+    printf("%-16s %8d %14d %14d %10d %10d\n", layout.name, legacy.blocks, legacy.transactions, strip.transactions,
+           legacy.windows, strip.windows);
+
+    // a window, a write command and one transfer per MCU row
+    TEST_ASSERT_EQUAL(5 * FRAME_HEIGHT / layout.mcu_h, strip.transactions);
+    TEST_ASSERT_TRUE(strip.transactions * 5 < legacy.transactions);
+  }
+}
+
+void test_partial_last_row(void)
+{
+  // 100 rows: the last MCU row is only partly inside the image
+  std::vector<uint8_t> frame = random_frame(96, 112), block;
+  CountingPanel panel(96, 100);
+  JpegStrip assembler;
+  TEST_ASSERT_TRUE(assembler.begin(96, 100, strip_write, &panel));
+  for (int y = 0; y < 112; y += 16)
+  {
+    for (int x = 0; x < 96; x += 32)
+    {
+      cut_block(frame, 96, x, y, 32, 16, block);
+      TEST_ASSERT_TRUE(assembler.addBlock(x, y, 32, 16, 32, block.data()));
+    }
+  }
+  TEST_ASSERT_TRUE(assembler.flush());
+  TEST_ASSERT_EQUAL(7, assembler.strips());
+  TEST_ASSERT_EQUAL_MEMORY(frame.data(), panel.ram.data(), panel.ram.size());
+}
+
+void test_truncated_decode(void)
+{
+  // the decoder stopped halfway through a row of blocks: flush() still sends what arrived
+  CountingPanel panel(64, 16);
+  JpegStrip assembler;
+  uint8_t block[2 * 16];
+  memset(block, 0x00, sizeof(block));
+  TEST_ASSERT_TRUE(assembler.begin(64, 16, strip_write, &panel));
+  TEST_ASSERT_TRUE(assembler.addBlock(0, 0, 16, 16, 16, block));
+  TEST_ASSERT_EQUAL(0, panel.transactions);
+  TEST_ASSERT_TRUE(assembler.flush());
+  TEST_ASSERT_EQUAL(1, assembler.strips());
+  TEST_ASSERT_EQUAL_HEX8(0x00, panel.ram[0]);
+  TEST_ASSERT_EQUAL_HEX8(0xff, panel.ram[2]); // never drawn: white
+  TEST_ASSERT_TRUE(assembler.flush()); // nothing left
+  TEST_ASSERT_EQUAL(1, assembler.strips());
+}
+
+void test_bad_blocks(void)
+{
+  CountingPanel panel(64, 64);
+  JpegStrip assembler;
+  uint8_t block[4 * 32] = {0};
+  TEST_ASSERT_FALSE(assembler.addBlock(0, 0, 8, 8, 8, block)); // before begin()
+  TEST_ASSERT_TRUE(assembler.begin(64, 64, strip_write, &panel));
+  TEST_ASSERT_FALSE(assembler.addBlock(0, 0, 8, 32, 8, block)); // taller than an MCU
+  TEST_ASSERT_FALSE(assembler.addBlock(4, 0, 8, 8, 8, block));  // not on a byte boundary
+  TEST_ASSERT_FALSE(assembler.addBlock(64, 0, 8, 8, 8, block));
+  TEST_ASSERT_FALSE(assembler.addBlock(0, 64, 8, 8, 8, block));
+  assembler.end();
+  TEST_ASSERT_FALSE(assembler.addBlock(0, 0, 8, 8, 8, block));
+  TEST_ASSERT_EQUAL(0, panel.transactions);
+}
+
+void setUp(void)
+{
+  srand(1234);
+}
+
+void tearDown(void)
+{
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_same_pixels_fewer_transactions);
+  RUN_TEST(test_partial_last_row);
+  RUN_TEST(test_truncated_decode);
+  RUN_TEST(test_bad_blocks);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
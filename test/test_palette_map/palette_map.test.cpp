@@ -0,0 +1,276 @@
+#include <unity.h>
+#include <palette_map.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+/**
+ * Mapping of indexed PNG palettes to the panel colors, the RTC cache of the maps and
+ * finding the palette length in the PLTE chunk.
+ */
+
+// bb_epaper's Spectra 6 colors, in the order of the panel's color codes
+static const uint32_t spectra6[] = {0x000000, 0xffffff, 0xffff00, 0xff0000, 0x0000ff, 0x00ff00};
+#define SPECTRA6_COLORS 6
+enum
+{
+  BLACK,
+  WHITE,
+  YELLOW,
+  RED,
+  BLUE,
+  GREEN
+};
+
+static PaletteMapRtc rtc;
+
+static void set_entry(uint8_t *palette, int i, uint32_t rgb)
+{
+  palette[i * 3] = (uint8_t)(rgb >> 16);
+  palette[i * 3 + 1] = (uint8_t)(rgb >> 8);
+  palette[i * 3 + 2] = (uint8_t)rgb;
+}
+
+static void put_u32(std::vector<uint8_t> &png, uint32_t v)
+{
+  for (int shift = 24; shift >= 0; shift -= 8)
+    png.push_back((uint8_t)(v >> shift));
+}
+
+/** @brief Appends a chunk; the CRC isn't checked, so it is left 0 */
+static void put_chunk(std::vector<uint8_t> &png, const char *type, size_t len)
+{
+  put_u32(png, (uint32_t)len);
+  png.insert(png.end(), type, type + 4);
+  for (size_t i = 0; i < len; i++)
+    png.push_back((uint8_t)(i * 7));
+  put_u32(png, 0);
+}
+
+static std::vector<uint8_t> make_png(int palette_entries, bool text_chunk)
+{
+  static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', 0x0d, 0x0a, 0x1a, 0x0a};
+  std::vector<uint8_t> png(signature, signature + 8);
+  put_chunk(png, "IHDR", 13);
+  if (text_chunk)
+    put_chunk(png, "tEXt", 300);
+  if (palette_entries > 0)
+    put_chunk(png, "PLTE", palette_entries * 3);
+  put_chunk(png, "IDAT", 100);
+  put_chunk(png, "IEND", 0);
+  return png;
+}
+
+void test_exact_palette(void)
+{
+  // the server's usual output: the panel colors, in any order
+  uint8_t palette[6 * 3], map[6];
+  const int order[] = {WHITE, BLACK, GREEN, BLUE, RED, YELLOW};
+  for (int i = 0; i < 6; i++)
+    set_entry(palette, i, spectra6[order[i]]);
+
+  TEST_ASSERT_EQUAL(0, palette_map_nearest(palette, 6, spectra6, SPECTRA6_COLORS, map));
+  for (int i = 0; i < 6; i++)
+    TEST_ASSERT_EQUAL(order[i], map[i]);
+}
+
+void test_near_palette(void)
+{
+  // quantized with a slightly different palette, or off by a rounding step
+  const struct
+  {
+    uint32_t rgb;
+    int expected;
+  } cases[] = {
+      {0x010101, BLACK}, {0xfefefe, WHITE}, {0xfafa05, YELLOW}, {0xf00505, RED},
+      {0x0505f0, BLUE},  {0x05f005, GREEN}, {0x202020, BLACK},  {0xe8e8e8, WHITE},
+  };
+  const int n = sizeof(cases) / sizeof(cases[0]);
+  uint8_t palette[n * 3], map[n];
+  for (int i = 0; i < n; i++)
+    set_entry(palette, i, cases[i].rgb);
+
+  TEST_ASSERT_EQUAL(n, palette_map_nearest(palette, n, spectra6, SPECTRA6_COLORS, map));
+  for (int i = 0; i < n; i++)
+    TEST_ASSERT_EQUAL_MESSAGE(cases[i].expected, map[i], "near color");
+}
+
+void test_out_of_gamut_palette(void)
+{
+  // colors the panel doesn't have go to the one that looks closest, not to index 0
+  const struct
+  {
+    uint32_t rgb;
+    int expected;
+  } cases[] = {
+      {0xffc0cb, WHITE},  // pink
+      {0x000080, BLUE},   // navy
+      {0x32cd32, GREEN},  // lime green
+      {0x800000, RED},    // maroon
+      {0xffd700, YELLOW}, // gold
+      {0xff8000, RED},    // orange
+      {0x4b0082, BLUE},   // indigo
+      {0x303030, BLACK},  // dark gray
+  };
+  const int n = sizeof(cases) / sizeof(cases[0]);
+  uint8_t palette[n * 3], map[n];
+  for (int i = 0; i < n; i++)
+    set_entry(palette, i, cases[i].rgb);
+
+  TEST_ASSERT_EQUAL(n, palette_map_nearest(palette, n, spectra6, SPECTRA6_COLORS, map));
+  for (int i = 0; i < n; i++)
+    TEST_ASSERT_EQUAL_MESSAGE(cases[i].expected, map[i], "out of gamut color");
+}
+
+void test_full_palette(void)
+{
+  // 256 entries: every one mapped to a panel color, the mapping doesn't depend on the position
+  uint8_t palette[256 * 3], map[256], single[1];
+  for (int i = 0; i < 256; i++)
+    set_entry(palette, i, (uint32_t)rand() & 0xffffff);
+  palette_map_nearest(palette, 256, spectra6, SPECTRA6_COLORS, map);
+  for (int i = 0; i < 256; i++)
+  {
+    TEST_ASSERT_TRUE(map[i] < SPECTRA6_COLORS);
+    palette_map_nearest(&palette[i * 3], 1, spectra6, SPECTRA6_COLORS, single);
+    TEST_ASSERT_EQUAL(single[0], map[i]);
+  }
+}
+
+void test_cache_hit(void)
+{
+  uint8_t palette[4 * 3], map[4], cached[4];
+  int inexact = -1;
+  set_entry(palette, 0, 0x000000);
+  set_entry(palette, 1, 0xffffff);
+  set_entry(palette, 2, 0xff8000);
+  set_entry(palette, 3, 0x0000ff);
+
+  PaletteMapCache cache(rtc);
+  TEST_ASSERT_FALSE(cache.map(palette, 4, spectra6, SPECTRA6_COLORS, map, &inexact));
+  TEST_ASSERT_EQUAL(1, inexact);
+
+  // after deep sleep the RTC memory is still there, the cache object isn't
+  PaletteMapCache after_sleep(rtc);
+  memset(cached, 0xee, sizeof(cached));
+  inexact = -1;
+  TEST_ASSERT_TRUE(after_sleep.map(palette, 4, spectra6, SPECTRA6_COLORS, cached, &inexact));
+  TEST_ASSERT_EQUAL_MEMORY(map, cached, sizeof(map));
+  TEST_ASSERT_EQUAL(1, inexact);
+
+  // the same colors with a different panel, or one entry shorter, are different keys
+  static const uint32_t four_gray[] = {0x000000, 0x555555, 0xaaaaaa, 0xffffff};
+  TEST_ASSERT_FALSE(after_sleep.map(palette, 4, four_gray, 4, cached, nullptr));
+  TEST_ASSERT_FALSE(after_sleep.map(palette, 3, spectra6, SPECTRA6_COLORS, cached, nullptr));
+  TEST_ASSERT_NOT_EQUAL(palette_map_key(palette, 4, spectra6, SPECTRA6_COLORS),
+                        palette_map_key(palette, 4, four_gray, 4));
+}
+
+void test_cache_replaces_least_recently_used(void)
+{
+  uint8_t palettes[PALETTE_MAP_CACHE_ENTRIES + 1][3], map[1];
+  PaletteMapCache cache(rtc);
+  for (int i = 0; i <= PALETTE_MAP_CACHE_ENTRIES; i++)
+    set_entry(palettes[i], 0, 0x102030u * (i + 1));
+
+  for (int i = 0; i < PALETTE_MAP_CACHE_ENTRIES; i++)
+    TEST_ASSERT_FALSE(cache.map(palettes[i], 1, spectra6, SPECTRA6_COLORS, map, nullptr));
+  TEST_ASSERT_TRUE(cache.map(palettes[0], 1, spectra6, SPECTRA6_COLORS, map, nullptr));
+
+  // a new palette pushes out palette 1, used longest ago
+  TEST_ASSERT_FALSE(cache.map(palettes[PALETTE_MAP_CACHE_ENTRIES], 1, spectra6, SPECTRA6_COLORS, map, nullptr));
+  TEST_ASSERT_TRUE(cache.map(palettes[0], 1, spectra6, SPECTRA6_COLORS, map, nullptr));
+  TEST_ASSERT_FALSE(cache.map(palettes[1], 1, spectra6, SPECTRA6_COLORS, map, nullptr));
+}
+
+void test_cache_ignores_garbage(void)
+{
+  // RTC memory holds random data after power on
+  uint8_t palette[3] = {0xff, 0, 0}, map[1];
+  memset(&rtc, 0x5a, sizeof(rtc));
+  PaletteMapCache cache(rtc);
+  TEST_ASSERT_FALSE(cache.map(palette, 1, spectra6, SPECTRA6_COLORS, map, nullptr));
+  TEST_ASSERT_EQUAL(RED, map[0]);
+  TEST_ASSERT_EQUAL_HEX32(PALETTE_MAP_MAGIC, rtc.magic);
+}
+
+void test_palette_entries(void)
+{
+  const int lengths[] = {6, 256, 2}; // a palette of two ending in black used to look longer
+  for (int entries : lengths)
+  {
+    std::vector<uint8_t> png = make_png(entries, entries != 6);
+    TEST_ASSERT_EQUAL(entries, png_palette_entries(png.data(), png.size()));
+  }
+
+  // grayscale and truecolor images have no PLTE, or it comes too late to matter
+  std::vector<uint8_t> gray = make_png(0, true);
+  TEST_ASSERT_EQUAL(0, png_palette_entries(gray.data(), gray.size()));
+
+  // not a PNG, or cut off before the palette
+  std::vector<uint8_t> png = make_png(16, true);
+  png[1] = 'J';
+  TEST_ASSERT_EQUAL(0, png_palette_entries(png.data(), png.size()));
+  png = make_png(16, true);
+  TEST_ASSERT_EQUAL(0, png_palette_entries(png.data(), 8 + 25 + 100));
+}
+
+void test_palette_scanner_in_pieces(void)
+{
+  // as PngStreamSource feeds it, in whatever pieces the network delivers
+  std::vector<uint8_t> png = make_png(13, true);
+  for (int round = 0; round < 200; round++)
+  {
+    PngPaletteScanner scanner;
+    size_t pos = 0;
+    while (pos < png.size())
+    {
+      size_t n = 1 + rand() % 40;
+      if (n > png.size() - pos)
+        n = png.size() - pos;
+      scanner.feed(png.data() + pos, n);
+      pos += n;
+    }
+    TEST_ASSERT_TRUE(scanner.done());
+    TEST_ASSERT_EQUAL(13, scanner.entries());
+  }
+
+  PngPaletteScanner scanner;
+  scanner.feed(png.data(), 20);
+  TEST_ASSERT_FALSE(scanner.done());
+  TEST_ASSERT_EQUAL(0, scanner.entries());
+  scanner.reset();
+  scanner.feed(png.data(), png.size());
+  TEST_ASSERT_EQUAL(13, scanner.entries());
+}
+
+void setUp(void)
+{
+  srand(1234);
+  memset(&rtc, 0, sizeof(rtc));
+}
+
+void tearDown(void)
+{
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_exact_palette);
+  RUN_TEST(test_near_palette);
+  RUN_TEST(test_out_of_gamut_palette);
+  RUN_TEST(test_full_palette);
+  RUN_TEST(test_cache_hit);
+  RUN_TEST(test_cache_replaces_least_recently_used);
+  RUN_TEST(test_cache_ignores_garbage);
+  RUN_TEST(test_palette_entries);
+  RUN_TEST(test_palette_scanner_in_pieces);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
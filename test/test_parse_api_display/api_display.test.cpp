@@ -1,6 +1,65 @@
 #include <unity.h>
 #include <bmp.h>
 #include <api_response_parsing.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+static uint32_t fake_now = 0;
+static uint32_t fake_now_ms() { return fake_now; }
+static void fake_wait() { fake_now += 10; }
+
+static const HttpBodyReaderOptions test_options = {
+    .total_timeout_ms = 15000,
+    .idle_timeout_ms = 5000,
+    .now_ms = fake_now_ms,
+    .wait = fake_wait,
+};
+
+/** Serves a response body in TCP-segment sized pieces */
+class FakeClient : public ByteSource
+{
+public:
+  FakeClient(const std::string &data, size_t piece) : data(data), piece(piece), pos(0) {}
+
+  int available() override
+  {
+    size_t left = data.size() - pos;
+    return (int)(piece < left ? piece : left);
+  }
+
+  int read(uint8_t *buf, size_t size) override
+  {
+    size_t n = size < (size_t)available() ? size : (size_t)available();
+    memcpy(buf, data.data() + pos, n);
+    pos += n;
+    return (int)n;
+  }
+
+  bool connected() override { return pos < data.size(); }
+
+  size_t consumed() const { return pos; }
+
+private:
+  std::string data;
+  size_t piece;
+  size_t pos;
+};
+
+static std::string chunked(const std::string &body, size_t chunk)
+{
+  std::string out;
+  char size_line[16];
+  for (size_t i = 0; i < body.size(); i += chunk)
+  {
+    std::string part = body.substr(i, chunk);
+    snprintf(size_line, sizeof(size_line), "%x\r\n", (unsigned)part.size());
+    out += size_line + part + "\r\n";
+  }
+  return out + "0\r\n\r\n";
+}
+
+static uint8_t arena_buffer[API_DISPLAY_JSON_ARENA_SIZE];
 
 void assert_response_equal(ApiDisplayResponse expected, ApiDisplayResponse actual)
 {
@@ -67,6 +126,51 @@ void test_parseResponse_apiDisplay_treats_unknown_sf_as_none(void)
   TEST_ASSERT_EQUAL(parsed.special_function, SPECIAL_FUNCTION::SF_NONE);
 }
 
+void test_parseResponse_apiDisplay_stream(void)
+{
+  std::string input = "{\"status\":200,\"image_url\":\"http://example.com/foo.bmp\",\"filename\":\"empty_state\",\"update_firmware\":true,\"firmware_url\":\"https://example.com/firmware.bin\",\"refresh_rate\":123456,\"reset_firmware\":true,\"special_function\":\"identify\",\"action\":\"special_action\",\"unused\":{\"list\":[1,2,3],\"text\":\"skipped\"}}";
+
+  ApiDisplayResponse expected = {
+      .outcome = ApiDisplayOutcome::Ok,
+      .image_url = "http://example.com/foo.bmp",
+      .filename = "empty_state",
+      .update_firmware = true,
+      .firmware_url = "https://example.com/firmware.bin",
+      .refresh_rate = 123456,
+      .reset_firmware = true,
+      .special_function = SPECIAL_FUNCTION::SF_IDENTIFY,
+      .action = "special_action"};
+
+  JsonArena arena(arena_buffer, sizeof(arena_buffer));
+
+  FakeClient plain(input, 100);
+  HttpBodyReader plain_body(plain, input.size(), false, test_options);
+  assert_response_equal(expected, parseResponse_apiDisplay(plain_body, arena));
+  TEST_ASSERT_TRUE(plain_body.finished());
+
+  // the chunk terminator is consumed too, so the connection can be reused
+  std::string framed = chunked(input, 64);
+  FakeClient chunks(framed, 100);
+  HttpBodyReader chunked_body(chunks, -1, true, test_options);
+  assert_response_equal(expected, parseResponse_apiDisplay(chunked_body, arena));
+  TEST_ASSERT_TRUE(chunked_body.finished());
+  TEST_ASSERT_EQUAL(framed.size(), chunks.consumed());
+}
+
+void test_parseResponse_apiDisplay_stream_out_of_memory(void)
+{
+  std::string input = "{\"status\":0,\"image_url\":\"" + std::string(API_DISPLAY_JSON_ARENA_SIZE, 'x') + "\"}";
+
+  JsonArena arena(arena_buffer, sizeof(arena_buffer));
+  FakeClient client(input, 1000);
+  HttpBodyReader body(client, input.size(), false, test_options);
+  ApiDisplayResponse parsed = parseResponse_apiDisplay(body, arena);
+
+  TEST_ASSERT_EQUAL(ApiDisplayOutcome::DeserializationError, parsed.outcome);
+  TEST_ASSERT_EQUAL_STRING("NoMemory", parsed.error_detail.c_str());
+  TEST_ASSERT_TRUE(arena.peak() <= arena.capacity());
+}
+
 void setUp(void) {
   // set stuff up here
 }
@@ -82,6 +186,8 @@ void process()
   RUN_TEST(test_parseResponse_apiDisplay_deserializationError);
   RUN_TEST(test_parseResponse_apiDisplay_treats_unknown_sf_as_none);
   RUN_TEST(test_parseResponse_apiDisplay_missing_fields);
+  RUN_TEST(test_parseResponse_apiDisplay_stream);
+  RUN_TEST(test_parseResponse_apiDisplay_stream_out_of_memory);
   UNITY_END();
 }
 
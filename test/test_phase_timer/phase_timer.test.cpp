@@ -0,0 +1,225 @@
+#include <unity.h>
+#include <phase_timer.h>
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * Times phases on a virtual clock and checks durations, overlaps and the summary logged
+ * before deep sleep. The benchmark compares the end of a wake when the work after the
+ * image waits for the refresh and when it runs while the panel updates.
+ */
+
+static uint32_t now;
+
+static uint32_t clock_ms()
+{
+  return now;
+}
+
+void test_durations(void)
+{
+  PhaseTimer timer(clock_ms);
+  now = 100;
+  int refresh = timer.begin("refresh");
+  now = 350;
+  int logs = timer.begin("logs");
+  now = 700;
+  timer.end(logs);
+  TEST_ASSERT_EQUAL(2, timer.count());
+  TEST_ASSERT_EQUAL(350, timer.durationMs(logs));
+  TEST_ASSERT_EQUAL(600, timer.durationMs(refresh)); // still open: up to now
+  TEST_ASSERT_TRUE(timer.get(refresh)->open);
+  now = 3100;
+  timer.end(refresh);
+  timer.end(refresh); // already ended: kept
+  now = 5000;
+  TEST_ASSERT_EQUAL(3000, timer.durationMs(refresh));
+  TEST_ASSERT_EQUAL(350, timer.durationMs(logs));
+  TEST_ASSERT_EQUAL(refresh, timer.find("refresh"));
+  TEST_ASSERT_EQUAL(-1, timer.find("nvs"));
+  TEST_ASSERT_NULL(timer.get(2));
+  timer.end(-1);
+}
+
+void test_overlap(void)
+{
+  PhaseTimer timer(clock_ms);
+  now = 1000;
+  int before = timer.begin("download");
+  now = 2000;
+  timer.end(before);
+  int refresh = timer.begin("refresh");
+  now = 2500;
+  int inside = timer.begin("logs");
+  now = 2900;
+  timer.end(inside);
+  int across = timer.begin("wifi off");
+  now = 4000;
+  timer.end(refresh);
+  now = 4200;
+  timer.end(across);
+  int after = timer.begin("sleep");
+  now = 4300;
+  TEST_ASSERT_EQUAL(0, timer.overlapMs(refresh, before));
+  TEST_ASSERT_EQUAL(400, timer.overlapMs(refresh, inside));
+  TEST_ASSERT_EQUAL(1100, timer.overlapMs(refresh, across));
+  TEST_ASSERT_EQUAL(0, timer.overlapMs(refresh, after));
+  TEST_ASSERT_EQUAL(timer.overlapMs(across, refresh), timer.overlapMs(refresh, across));
+  TEST_ASSERT_EQUAL(2000, timer.overlapMs(refresh, refresh));
+  TEST_ASSERT_EQUAL(0, timer.overlapMs(refresh, 7));
+}
+
+void test_clock_wrap(void)
+{
+  PhaseTimer timer(clock_ms);
+  now = 0xfffffe00u;
+  int refresh = timer.begin("refresh");
+  now += 0x100;
+  int logs = timer.begin("logs");
+  now += 0x300; // past the wrap
+  timer.end(logs);
+  now += 0x100;
+  timer.end(refresh);
+  TEST_ASSERT_EQUAL(0x500, timer.durationMs(refresh));
+  TEST_ASSERT_EQUAL(0x300, timer.durationMs(logs));
+  TEST_ASSERT_EQUAL(0x300, timer.overlapMs(refresh, logs));
+  TEST_ASSERT_EQUAL(0x300, timer.overlapMs(logs, refresh));
+}
+
+void test_full(void)
+{
+  PhaseTimer timer(clock_ms);
+  for (int i = 0; i < PHASE_TIMER_MAX; i++)
+    TEST_ASSERT_EQUAL(i, timer.begin("phase"));
+  TEST_ASSERT_EQUAL(-1, timer.begin("one too many"));
+  TEST_ASSERT_EQUAL(PHASE_TIMER_MAX - 1, timer.find("phase"));
+  timer.reset();
+  TEST_ASSERT_EQUAL(0, timer.count());
+  TEST_ASSERT_EQUAL(0, timer.begin("again"));
+}
+
+void test_summary(void)
+{
+  PhaseTimer timer(clock_ms);
+  char out[160];
+  now = 0;
+  int refresh = timer.begin("refresh");
+  int logs = timer.begin("logs");
+  now = 420;
+  timer.end(logs);
+  int wifi = timer.begin("wifi off");
+  now = 650;
+  timer.end(wifi);
+  now = 3180;
+  timer.end(refresh);
+  timer.begin("nvs");
+  now = 3200;
+  size_t len = timer.summary("refresh", out, sizeof(out));
+  TEST_ASSERT_EQUAL_STRING("refresh 3180 ms; logs 420 ms (420 overlapped); wifi off 230 ms (230 overlapped); "
+                           "nvs 20 ms (0 overlapped) (open)",
+                           out);
+  TEST_ASSERT_EQUAL(strlen(out), len);
+
+  // nothing to compare with: durations only
+  timer.summary("display", out, sizeof(out));
+  TEST_ASSERT_EQUAL_STRING("refresh 3180 ms; logs 420 ms; wifi off 230 ms; nvs 20 ms (open)", out);
+
+  // cut to fit
+  len = timer.summary("refresh", out, 20);
+  TEST_ASSERT_EQUAL(19, len);
+  TEST_ASSERT_EQUAL_STRING("refresh 3180 ms; lo", out);
+  TEST_ASSERT_EQUAL(0, timer.summary("refresh", out, 0));
+}
+
+/**
+ * @brief Wake time from the start of the refresh to deep sleep, with the work after it
+ *        either waiting for the panel or running while it updates
+ */
+static void time_wake(uint32_t refresh_ms, const uint32_t *work_ms, int work_count, bool overlap,
+                      uint32_t *awake_ms, uint32_t *overlapped_ms)
+{
+  PhaseTimer timer(clock_ms);
+  now = 0;
+  int refresh = timer.begin("refresh");
+  if (!overlap)
+  {
+    now += refresh_ms;
+    timer.end(refresh);
+  }
+  for (int i = 0; i < work_count; i++)
+  {
+    int id = timer.begin("work");
+    now += work_ms[i];
+    timer.end(id);
+  }
+  if (overlap)
+  {
+    // join: wait for what is left of the refresh; a panel done sooner is only seen now
+    uint32_t elapsed = now - timer.get(refresh)->start_ms;
+    if (elapsed < refresh_ms)
+      now += refresh_ms - elapsed;
+    timer.end(refresh);
+  }
+  *overlapped_ms = 0;
+  for (int id = 0; id < timer.count(); id++)
+  {
+    if (id != refresh)
+      *overlapped_ms += timer.overlapMs(refresh, id);
+  }
+  *awake_ms = now;
+}
+
+void test_benchmark(void)
+{
+  // submit logs, drain HTTP and WiFi off, write the image to SPIFFS, NVS
+  const uint32_t work[] = {420, 230, 310, 40};
+  const struct
+  {
+    const char *name;
+    uint32_t refresh_ms;
+  } refreshes[] = {
+      {"partial", 430},
+      {"full B/W", 2950},
+      {"B/W/R", 15300},
+      {"Spectra 6", 21700},
+  };
+  printf("\n%-12s %14s %14s %16s\n", "refresh", "blocking (ms)", "async (ms)", "overlapped (ms)");
+  for (auto &r : refreshes)
+  {
+    uint32_t blocking_ms, async_ms, overlapped_ms, none_ms;
+    time_wake(r.refresh_ms, work, 4, false, &blocking_ms, &none_ms);
+    time_wake(r.refresh_ms, work, 4, true, &async_ms, &overlapped_ms);
+    printf("%-12s %14u %14u %16u\n", r.name, (unsigned)blocking_ms, (unsigned)async_ms, (unsigned)overlapped_ms);
+    TEST_ASSERT_EQUAL(0, none_ms);
+    TEST_ASSERT_EQUAL(r.refresh_ms + 1000, blocking_ms);
+    TEST_ASSERT_EQUAL(r.refresh_ms > 1000 ? r.refresh_ms : 1000, async_ms);
+    TEST_ASSERT_TRUE(async_ms < blocking_ms);
+  }
+}
+
+void setUp(void)
+{
+  now = 0;
+}
+
+void tearDown(void)
+{
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_durations);
+  RUN_TEST(test_overlap);
+  RUN_TEST(test_clock_wrap);
+  RUN_TEST(test_full);
+  RUN_TEST(test_summary);
+  RUN_TEST(test_benchmark);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
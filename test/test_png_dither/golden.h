@@ -0,0 +1,265 @@
+#pragma once
+
+#include <stdint.h>
+
+// Expected output of a 100x24 gradient, from an independent reference implementation
+// of the same fixed-point Floyd-Steinberg and Atkinson rules (see gray_source() and rgb_source())
+
+#define GOLDEN_WIDTH 100
+#define GOLDEN_HEIGHT 24
+
+static const uint8_t golden_gray_fs_1bpp[] = {
+    0x00, 0x00, 0x00, 0x04, 0x49, 0x55, 0x55, 0x5b, 0x6f, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x01, 0x25,
+    0x52, 0x94, 0x92, 0xab, 0x6d, 0xba, 0xaa, 0xdf, 0xff, 0xe0, 0x00, 0x24, 0x08, 0x24, 0x4a, 0x55,
+    0x55, 0xaa, 0xd7, 0xff, 0xfb, 0xbf, 0xc0, 0x01, 0x00, 0x92, 0x89, 0x25, 0x55, 0x5a, 0xb7, 0x7d,
+    0x57, 0x7f, 0xff, 0x00, 0x00, 0x12, 0x00, 0x52, 0xa9, 0x55, 0x6b, 0x5a, 0xd7, 0xfd, 0xef, 0xfe,
+    0x00, 0x08, 0x40, 0x55, 0x08, 0x95, 0x55, 0x55, 0xef, 0x7a, 0xb7, 0xfe, 0xfc, 0x00, 0x01, 0x09,
+    0x02, 0x55, 0x4a, 0xaa, 0xae, 0xb5, 0xdf, 0xff, 0xbf, 0xf8, 0x00, 0x04, 0x00, 0xa8, 0x84, 0xa9,
+    0x55, 0xb5, 0x5b, 0x6b, 0x6e, 0xff, 0xf0, 0x00, 0x20, 0x54, 0x05, 0x52, 0x55, 0x56, 0xab, 0xee,
+    0xff, 0xff, 0xff, 0xe0, 0x00, 0x01, 0x02, 0xa8, 0x2a, 0xaa, 0xaa, 0xdd, 0x5b, 0xad, 0xbb, 0xfb,
+    0x80, 0x00, 0x10, 0x20, 0x12, 0xa5, 0x4a, 0xaa, 0xab, 0x6e, 0xff, 0xff, 0xff, 0x00, 0x20, 0x05,
+    0x0a, 0xa5, 0x29, 0x2a, 0xb6, 0xf6, 0xf7, 0xb6, 0xef, 0xde, 0x00, 0x00, 0x40, 0x51, 0x10, 0x95,
+    0x55, 0x55, 0x5b, 0xba, 0xff, 0xff, 0x7c, 0x00, 0x80, 0x12, 0x04, 0xa6, 0xaa, 0xaa, 0xdb, 0xad,
+    0x6f, 0xdb, 0x7d, 0xf8, 0x02, 0x00, 0x01, 0x52, 0x11, 0x49, 0x55, 0x55, 0x77, 0xdb, 0x7f, 0xf7,
+    0xf0, 0x00, 0x20, 0x48, 0x09, 0x4c, 0xaa, 0xab, 0x6e, 0xda, 0xff, 0xef, 0xff, 0xc0, 0x08, 0x00,
+    0x05, 0x52, 0x52, 0x55, 0x5a, 0xb5, 0xb7, 0x56, 0xfd, 0xdf, 0x80, 0x01, 0x20, 0x20, 0x24, 0x95,
+    0x4a, 0xab, 0x5b, 0x6d, 0xff, 0xbf, 0xff, 0x00, 0x20, 0x00, 0x4a, 0x89, 0x49, 0x55, 0x55, 0xed,
+    0xdf, 0xb6, 0xff, 0xfe, 0x00, 0x84, 0x90, 0x04, 0x52, 0x25, 0x55, 0x6e, 0xae, 0xf5, 0xff, 0xf7,
+    0xfc, 0x00, 0x00, 0x00, 0x51, 0x25, 0x55, 0x55, 0xb5, 0x75, 0xaf, 0x5b, 0xdf, 0x78, 0x02, 0x12,
+    0x40, 0x0a, 0x92, 0x55, 0x56, 0xab, 0xae, 0xfd, 0xff, 0x7f, 0xe0, 0x00, 0x00, 0x20, 0x50, 0x49,
+    0x4a, 0xaa, 0xb5, 0x77, 0x57, 0xef, 0xff, 0xc0, 0x08, 0x92, 0x80, 0x0a, 0xa5, 0x2a, 0xaa, 0xde,
+    0xdb, 0xfe, 0xfd, 0xff, 0x80, 0x00, 0x00, 0x20,
+};
+
+static const uint8_t golden_gray_fs_2bpp[] = {
+    0xff, 0xff, 0xfe, 0xfb, 0xbb, 0xae, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x69, 0x99, 0x96, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x45, 0x11, 0x10, 0x40, 0x00, 0x00, 0xff, 0xfb, 0xbb, 0xbb, 0xba, 0xea, 0xee,
+    0xaa, 0xaa, 0xa9, 0x99, 0x99, 0x99, 0x65, 0x66, 0x55, 0x55, 0x55, 0x11, 0x11, 0x11, 0x04, 0x04,
+    0x40, 0x03, 0xff, 0xbf, 0xef, 0xee, 0xee, 0xba, 0xaa, 0xaa, 0xaa, 0x9a, 0xa6, 0xa6, 0x66, 0x59,
+    0x55, 0x55, 0x55, 0x51, 0x54, 0x54, 0x44, 0x41, 0x00, 0x00, 0x0f, 0xfb, 0xfb, 0xbe, 0xbb, 0xae,
+    0xae, 0xba, 0xaa, 0xaa, 0xa9, 0x9a, 0x59, 0x96, 0x56, 0x59, 0x55, 0x55, 0x55, 0x11, 0x41, 0x10,
+    0x40, 0x41, 0x00, 0xff, 0xff, 0xbe, 0xee, 0xee, 0xeb, 0xaa, 0xaa, 0xaa, 0xa9, 0x9a, 0x66, 0x66,
+    0x65, 0x95, 0x55, 0x55, 0x55, 0x11, 0x44, 0x44, 0x44, 0x10, 0x00, 0x03, 0xff, 0xfb, 0xef, 0xee,
+    0xee, 0xba, 0xeb, 0xaa, 0xaa, 0xaa, 0xa6, 0xa6, 0x66, 0x59, 0x65, 0x95, 0x55, 0x55, 0x54, 0x54,
+    0x44, 0x41, 0x04, 0x10, 0x0f, 0xff, 0xef, 0xfb, 0xbb, 0xba, 0xea, 0xaa, 0xaa, 0xaa, 0x99, 0x99,
+    0x99, 0x99, 0x65, 0x55, 0x55, 0x55, 0x51, 0x11, 0x11, 0x11, 0x04, 0x00, 0x00, 0x3f, 0xfb, 0xfe,
+    0xbb, 0xbb, 0xae, 0xae, 0xaa, 0xaa, 0xaa, 0xaa, 0x69, 0x99, 0x96, 0x56, 0x55, 0x55, 0x55, 0x55,
+    0x45, 0x11, 0x10, 0x40, 0x41, 0x00, 0xff, 0xff, 0xef, 0xee, 0xee, 0xea, 0xea, 0xba, 0xaa, 0xa9,
+    0x99, 0xa6, 0x66, 0x65, 0x65, 0x59, 0x55, 0x55, 0x11, 0x14, 0x44, 0x44, 0x04, 0x00, 0x03, 0xff,
+    0xbe, 0xfb, 0xbb, 0xba, 0xba, 0xaa, 0xaa, 0xaa, 0xaa, 0xa6, 0x66, 0x65, 0x59, 0x55, 0x55, 0x55,
+    0x55, 0x54, 0x44, 0x44, 0x01, 0x00, 0x00, 0x3f, 0xff, 0xef, 0xbb, 0xbb, 0xae, 0xab, 0xae, 0xaa,
+    0xaa, 0x99, 0x9a, 0x66, 0x59, 0x95, 0x96, 0x55, 0x55, 0x51, 0x11, 0x44, 0x41, 0x10, 0x10, 0x40,
+    0xff, 0xfb, 0xfb, 0xee, 0xee, 0xeb, 0xba, 0xaa, 0xaa, 0xa9, 0xa9, 0xa6, 0x66, 0x65, 0x65, 0x55,
+    0x55, 0x55, 0x15, 0x14, 0x44, 0x44, 0x04, 0x00, 0x03, 0xff, 0xfe, 0xfe, 0xee, 0xeb, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0x9a, 0x66, 0x66, 0x59, 0x56, 0x55, 0x55, 0x55, 0x51, 0x44, 0x44, 0x41, 0x00,
+    0x40, 0x0f, 0xfe, 0xef, 0xbb, 0xbb, 0xba, 0xee, 0xea, 0xaa, 0xaa, 0x99, 0xa6, 0x66, 0x65, 0x96,
+    0x65, 0x55, 0x55, 0x51, 0x14, 0x44, 0x44, 0x10, 0x44, 0x00, 0x3f, 0xff, 0xfb, 0xee, 0xee, 0xee,
+    0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0x66, 0x99, 0x99, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x51, 0x11,
+    0x00, 0x00, 0x00, 0xff, 0xef, 0xbe, 0xfb, 0xba, 0xaa, 0xea, 0xaa, 0xaa, 0xa6, 0xa6, 0x99, 0x99,
+    0x56, 0x65, 0x95, 0x55, 0x54, 0x54, 0x51, 0x11, 0x00, 0x44, 0x10, 0x0f, 0xff, 0xfb, 0xef, 0xbb,
+    0xee, 0xee, 0xae, 0xaa, 0xaa, 0xaa, 0x69, 0xa6, 0x66, 0x65, 0x55, 0x55, 0x55, 0x55, 0x45, 0x14,
+    0x44, 0x44, 0x00, 0x00, 0x3f, 0xfe, 0xfe, 0xfb, 0xbb, 0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0x9a, 0x99,
+    0x99, 0x95, 0x96, 0x59, 0x55, 0x55, 0x51, 0x51, 0x11, 0x10, 0x10, 0x41, 0x00, 0xff, 0xff, 0xbf,
+    0xbb, 0xba, 0xee, 0xba, 0xea, 0xaa, 0xaa, 0xa6, 0x69, 0x99, 0x66, 0x55, 0x55, 0x55, 0x55, 0x14,
+    0x45, 0x11, 0x04, 0x40, 0x00, 0x03, 0xff, 0xbb, 0xee, 0xee, 0xee, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9,
+    0x9a, 0x66, 0x66, 0x55, 0x65, 0x95, 0x55, 0x55, 0x51, 0x44, 0x44, 0x40, 0x04, 0x10, 0x0f, 0xff,
+    0xfe, 0xfb, 0xee, 0xeb, 0xbb, 0xae, 0xaa, 0xaa, 0xa6, 0xa6, 0x99, 0x95, 0x99, 0x55, 0x55, 0x55,
+    0x51, 0x14, 0x51, 0x10, 0x11, 0x00, 0x00, 0x3f, 0xfb, 0xef, 0xbe, 0xee, 0xba, 0xaa, 0xaa, 0xaa,
+    0xaa, 0x6a, 0x66, 0x66, 0x66, 0x56, 0x55, 0x55, 0x55, 0x45, 0x45, 0x11, 0x04, 0x40, 0x40, 0x03,
+    0xff, 0xfe, 0xfb, 0xee, 0xee, 0xee, 0xba, 0xaa, 0xaa, 0xaa, 0x99, 0xa6, 0x65, 0x65, 0x65, 0x59,
+    0x55, 0x54, 0x54, 0x51, 0x11, 0x10, 0x10, 0x01, 0x0f, 0xff, 0xbf, 0xbe, 0xee, 0xeb, 0xaa, 0xaa,
+    0xea, 0xaa, 0x99, 0xa9, 0x99, 0x99, 0x96, 0x55, 0x55, 0x55, 0x55, 0x45, 0x11, 0x10, 0x41, 0x00,
+    0x10, 0x3f, 0xff, 0xef, 0xee, 0xee, 0xba, 0xba,
+};
+
+static const uint8_t golden_gray_atkinson_1bpp[] = {
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x49, 0x6d, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00,
+    0x49, 0x69, 0x2d, 0x26, 0xcd, 0xb6, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x12, 0x09, 0x0c, 0xa5,
+    0xb2, 0x76, 0xdf, 0xb7, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x80, 0xa4, 0x92, 0x92, 0xdb, 0xb6, 0xf3,
+    0xff, 0xff, 0xff, 0x00, 0x00, 0x02, 0x24, 0x24, 0xb2, 0x7a, 0x4d, 0xbb, 0xbe, 0xde, 0xff, 0xfe,
+    0x00, 0x00, 0x08, 0x01, 0x12, 0x0d, 0x27, 0x6d, 0xce, 0xef, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00,
+    0x92, 0x49, 0x65, 0x95, 0xb3, 0x77, 0xfb, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x42, 0x08, 0x89, 0x32,
+    0x74, 0x9e, 0xdd, 0x7e, 0xf7, 0xff, 0xf0, 0x00, 0x00, 0x10, 0x49, 0x24, 0x9a, 0xce, 0xed, 0xbb,
+    0xdf, 0xff, 0xff, 0xe0, 0x00, 0x01, 0x04, 0x22, 0x4c, 0xc4, 0x9b, 0x6d, 0xbb, 0xf7, 0xff, 0xff,
+    0x80, 0x00, 0x00, 0x21, 0x84, 0x93, 0x35, 0xb3, 0x5b, 0xef, 0x7f, 0xbf, 0xff, 0x00, 0x00, 0x04,
+    0x88, 0x11, 0x31, 0x26, 0x6c, 0xda, 0x7d, 0xdf, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x02, 0x49, 0x0c,
+    0xdb, 0x4f, 0xb7, 0xdf, 0xfd, 0xff, 0xfc, 0x00, 0x00, 0x08, 0x42, 0x49, 0xa6, 0x49, 0xb3, 0x6d,
+    0xf6, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x02, 0x18, 0x92, 0x63, 0x36, 0xbd, 0xdf, 0x7f, 0xff, 0xff,
+    0xf0, 0x00, 0x00, 0x10, 0x81, 0x26, 0x19, 0xb6, 0xcd, 0xb7, 0xdb, 0xef, 0xff, 0xc0, 0x00, 0x00,
+    0x04, 0x24, 0x49, 0x94, 0xc9, 0x76, 0xfb, 0xff, 0xbf, 0xff, 0x80, 0x00, 0x20, 0x21, 0x24, 0x91,
+    0x66, 0x6d, 0xb6, 0xde, 0xef, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x49, 0x36, 0x4b, 0x36, 0xdb,
+    0xdf, 0xbf, 0xff, 0xfe, 0x00, 0x00, 0x80, 0x02, 0x49, 0x44, 0xb9, 0x9b, 0x6f, 0x77, 0xff, 0xff,
+    0xfc, 0x00, 0x00, 0x00, 0x22, 0x12, 0x53, 0x26, 0xeb, 0x6d, 0xfd, 0xff, 0xff, 0xf8, 0x00, 0x04,
+    0x40, 0x18, 0x92, 0x59, 0xda, 0x6d, 0xbd, 0xbf, 0x7d, 0xff, 0xe0, 0x00, 0x00, 0x10, 0x41, 0x25,
+    0x8c, 0x5b, 0x5d, 0xb7, 0xef, 0xff, 0xff, 0xc0, 0x00, 0x11, 0x00, 0x04, 0x4c, 0x66, 0xcd, 0xd6,
+    0xf6, 0xfb, 0xff, 0xff, 0x80, 0x00, 0x00, 0x40,
+};
+
+static const uint8_t golden_gray_atkinson_2bpp[] = {
+    0xff, 0xff, 0xff, 0xfb, 0xeb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0xa5, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x14, 0x10, 0x00, 0x00, 0x00, 0xff, 0xff, 0xee, 0xba, 0xfa, 0xba, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xa6, 0x59, 0x69, 0x59, 0x55, 0x55, 0x55, 0x55, 0x54, 0x41, 0x05, 0x01, 0x00,
+    0x00, 0x03, 0xff, 0xfb, 0xef, 0xbe, 0xae, 0xba, 0xea, 0xaa, 0xaa, 0xa9, 0xa6, 0x9a, 0x56, 0x59,
+    0x65, 0x55, 0x55, 0x55, 0x14, 0x51, 0x40, 0x41, 0x04, 0x00, 0x0f, 0xff, 0xfe, 0xfb, 0xeb, 0xeb,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x69, 0xa5, 0xa5, 0x95, 0x55, 0x55, 0x55, 0x55, 0x45, 0x14, 0x14,
+    0x10, 0x00, 0x00, 0xff, 0xff, 0xaf, 0xba, 0xeb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x96, 0x99, 0x65,
+    0x95, 0x55, 0x55, 0x55, 0x55, 0x50, 0x51, 0x04, 0x10, 0x00, 0x00, 0x03, 0xff, 0xfb, 0xfb, 0xbe,
+    0xbe, 0xba, 0xea, 0xaa, 0xaa, 0xa9, 0xa9, 0x9a, 0x5a, 0x59, 0x65, 0x55, 0x55, 0x55, 0x15, 0x11,
+    0x41, 0x41, 0x04, 0x00, 0x0f, 0xff, 0xff, 0xbf, 0xaf, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9a,
+    0x96, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x50, 0x50, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xfb,
+    0xeb, 0xeb, 0xaf, 0xae, 0xaa, 0xaa, 0xaa, 0x9a, 0x69, 0x69, 0x65, 0x96, 0x55, 0x55, 0x55, 0x51,
+    0x45, 0x05, 0x04, 0x10, 0x40, 0x00, 0xff, 0xff, 0xfb, 0xee, 0xba, 0xea, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xa6, 0x96, 0x95, 0x65, 0x55, 0x55, 0x55, 0x55, 0x54, 0x50, 0x50, 0x04, 0x00, 0x00, 0x03, 0xff,
+    0xfb, 0xef, 0xbe, 0xbe, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0xa6, 0x9a, 0x5a, 0x56, 0x55, 0x55, 0x55,
+    0x55, 0x14, 0x51, 0x41, 0x40, 0x40, 0x00, 0x3f, 0xff, 0xff, 0xee, 0xbb, 0xea, 0xba, 0xaa, 0xaa,
+    0xaa, 0xa9, 0xa9, 0x69, 0x65, 0x95, 0x55, 0x55, 0x55, 0x55, 0x15, 0x05, 0x04, 0x10, 0x00, 0x00,
+    0xff, 0xff, 0xbe, 0xfb, 0xea, 0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0x9a, 0x5a, 0x65, 0x95, 0x59, 0x55,
+    0x55, 0x55, 0x51, 0x41, 0x44, 0x10, 0x01, 0x00, 0x03, 0xff, 0xff, 0xbe, 0xbb, 0xae, 0xba, 0xaa,
+    0xaa, 0xaa, 0xaa, 0x9a, 0x96, 0x59, 0x59, 0x55, 0x55, 0x55, 0x55, 0x51, 0x50, 0x41, 0x01, 0x00,
+    0x00, 0x0f, 0xff, 0xfb, 0xef, 0xba, 0xfa, 0xea, 0xaa, 0xaa, 0xaa, 0xa9, 0xa5, 0xa6, 0x96, 0x55,
+    0x95, 0x55, 0x55, 0x55, 0x14, 0x14, 0x50, 0x40, 0x10, 0x00, 0x3f, 0xff, 0xfb, 0xef, 0xee, 0xab,
+    0xaa, 0xaa, 0xaa, 0xaa, 0x9a, 0x6a, 0x65, 0x96, 0x55, 0x55, 0x55, 0x55, 0x51, 0x45, 0x44, 0x10,
+    0x40, 0x00, 0x00, 0xff, 0xfe, 0xfe, 0xfa, 0xee, 0xba, 0xaa, 0xaa, 0xaa, 0xaa, 0xa6, 0x96, 0x59,
+    0x65, 0x65, 0x55, 0x55, 0x55, 0x54, 0x50, 0x41, 0x04, 0x04, 0x00, 0x0f, 0xff, 0xff, 0xaf, 0xbb,
+    0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0xa6, 0x9a, 0x59, 0x65, 0x55, 0x55, 0x55, 0x55, 0x14, 0x51,
+    0x41, 0x04, 0x00, 0x00, 0x3f, 0xff, 0xef, 0xfb, 0xba, 0xba, 0xae, 0xaa, 0xaa, 0xaa, 0xa9, 0xa9,
+    0x69, 0xa5, 0x95, 0x55, 0x55, 0x55, 0x55, 0x15, 0x05, 0x14, 0x10, 0x00, 0x00, 0xff, 0xff, 0xee,
+    0xfb, 0xae, 0xae, 0xaa, 0xaa, 0xaa, 0xaa, 0x9a, 0x5a, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x51,
+    0x41, 0x40, 0x00, 0x40, 0x00, 0x03, 0xff, 0xfe, 0xfe, 0xee, 0xee, 0xaa, 0xea, 0xaa, 0xaa, 0xaa,
+    0x9a, 0x96, 0x9a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x50, 0x51, 0x40, 0x00, 0x00, 0x0f, 0xff,
+    0xfe, 0xfb, 0xee, 0xeb, 0xba, 0xaa, 0xaa, 0xaa, 0xa6, 0xa5, 0xa5, 0x95, 0xa5, 0x59, 0x55, 0x55,
+    0x54, 0x54, 0x14, 0x10, 0x14, 0x01, 0x00, 0x3f, 0xff, 0xbf, 0xbb, 0xae, 0xba, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xa9, 0x6a, 0x69, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x45, 0x04, 0x00, 0x00, 0x03,
+    0xff, 0xff, 0xeb, 0xef, 0xba, 0xba, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0x96, 0x59, 0x65, 0x59, 0x55,
+    0x55, 0x55, 0x45, 0x50, 0x41, 0x04, 0x01, 0x00, 0x0f, 0xff, 0xfb, 0xfe, 0xee, 0xbb, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0x66, 0x99, 0x96, 0x56, 0x55, 0x55, 0x55, 0x55, 0x44, 0x51, 0x10, 0x40, 0x40,
+    0x00, 0x3f, 0xff, 0xfb, 0xbe, 0xfa, 0xeb, 0xae,
+};
+
+static const uint8_t golden_rgb_fs_1bpp[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x4a, 0xaa, 0xa0, 0x00, 0x00, 0x44, 0x95, 0x55, 0x50, 0x00, 0x01, 0x25, 0x08, 0x90, 0x12,
+    0x50, 0x89, 0x55, 0x12, 0x48, 0x95, 0x50, 0x00, 0x48, 0x08, 0xa2, 0x25, 0xa9, 0x52, 0x24, 0x09,
+    0x55, 0x54, 0x40, 0x80, 0x04, 0x02, 0xa2, 0x15, 0x4a, 0x55, 0x51, 0x4a, 0xa0, 0x00, 0x22, 0x96,
+    0x50, 0x11, 0x28, 0x08, 0xa2, 0x55, 0x55, 0xa4, 0x00, 0x0a, 0xab, 0x55, 0x55, 0xa0, 0x00, 0x02,
+    0xa5, 0x55, 0x55, 0x4a, 0x50, 0x52, 0xa2, 0x54, 0xa8, 0x48, 0xa0, 0x49, 0x50, 0x52, 0x4a, 0xa9,
+    0x25, 0x25, 0x09, 0x2a, 0x82, 0x4b, 0x2b, 0x50, 0x02, 0x0b, 0x15, 0x55, 0x24, 0xb4, 0xd0, 0xaa,
+    0x08, 0xaa, 0xaa, 0xd5, 0x20, 0x28, 0xa4, 0xaa, 0xa9, 0x55, 0x4b, 0x6d, 0x01, 0x52, 0xaa, 0xa9,
+    0x2a, 0xa0, 0x02, 0x2a, 0xaa, 0xa4, 0x95, 0x75, 0xb0, 0xac, 0xaa, 0xa9, 0x2a, 0xab, 0x70, 0x51,
+    0x49, 0x55, 0x2a, 0xaa, 0xae, 0x45, 0x22, 0xa9, 0x25, 0x55, 0x6c, 0x90, 0x0a, 0x55, 0x54, 0xaa,
+    0xad, 0xd2, 0xb4, 0xad, 0x14, 0xaa, 0xad, 0x55, 0xd0, 0x51, 0x2a, 0xaa, 0x95, 0x76, 0x5b, 0x6a,
+    0xa2, 0xa5, 0x5a, 0xaa, 0xae, 0xa0, 0x0a, 0xaa, 0xa5, 0x55, 0xab, 0x55, 0xb4, 0x99, 0x5b, 0xa5,
+    0x55, 0xf2, 0xf0, 0x55, 0x55, 0xd5, 0x5b, 0x69, 0x6e, 0xf2, 0x4a, 0xa8, 0xab, 0x7d, 0x1b, 0x50,
+    0x49, 0x56, 0x2a, 0xad, 0x56, 0xdb, 0x55, 0x6d, 0x56, 0xb6, 0x85, 0xed, 0x50, 0x25, 0x5b, 0x55,
+    0x76, 0xad, 0xbd, 0xaa, 0xaa, 0xaa, 0xd5, 0x7e, 0xb7, 0xb0, 0xaa, 0xaa, 0xab, 0xba, 0xdb, 0xe6,
+    0xf5, 0x55, 0x57, 0x5b, 0xaa, 0xda, 0xf0, 0x2a, 0xdd, 0x55, 0x65, 0x6e, 0xbb, 0x5a, 0xaa, 0xf4,
+    0xad, 0x5b, 0x6e, 0xa0, 0xaa, 0xaa, 0xbf, 0xdb, 0xbb, 0x5d, 0xf5, 0x57, 0x17, 0x75, 0xb7, 0xd7,
+    0xf0, 0x55, 0xf5, 0x55, 0x56, 0xfd, 0xef, 0xb5, 0x69, 0x6a, 0xd6, 0xfc, 0xbd, 0xa0, 0x56, 0xaa,
+    0xef, 0x5b, 0xab, 0x7e, 0xeb, 0xad, 0xbd, 0x6f, 0xab, 0xf6, 0xf0, 0xaa, 0xdb, 0x5a, 0xee, 0xee,
+    0xeb, 0xbd, 0x56, 0xe7, 0xba, 0xdf, 0xaf, 0xd0,
+};
+
+static const uint8_t golden_rgb_fs_2bpp[] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xbe, 0xee, 0xee, 0xee, 0xeb, 0xae, 0xaa, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xbe, 0xfb, 0xbb, 0xbb, 0xbb, 0xae, 0xba, 0xff, 0xff, 0xef, 0xbb, 0xbb, 0xeb, 0xbb,
+    0xbb, 0xba, 0xaa, 0xaa, 0xaa, 0xba, 0xff, 0xbb, 0xbb, 0xae, 0xab, 0xae, 0xae, 0xba, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xff, 0xbb, 0xbe, 0xfb, 0xba, 0xee, 0xea, 0xea, 0xab, 0xae, 0xaa, 0xaa, 0xaa, 0xba,
+    0xee, 0xea, 0xea, 0xea, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9a, 0xfb, 0xff, 0xee, 0xee, 0xee,
+    0xba, 0xae, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9a, 0xae, 0xaa, 0xae, 0xaa, 0xaa, 0xaa, 0xaa, 0x9a,
+    0x9e, 0xaa, 0xaa, 0xaa, 0xef, 0xba, 0xee, 0xeb, 0xab, 0xaa, 0xea, 0xaa, 0xaa, 0xaa, 0xa9, 0x99,
+    0x65, 0xaa, 0xaa, 0xaa, 0xbe, 0xee, 0xeb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x69, 0xfb, 0xbb, 0xbb,
+    0xba, 0xba, 0xaa, 0xaa, 0xaa, 0xa9, 0x96, 0x56, 0x66, 0x56, 0xff, 0xfe, 0xeb, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xa6, 0x99, 0x95, 0x96, 0xbe, 0xee, 0xea, 0xab, 0xaa, 0xaa, 0xaa, 0x9a, 0x66, 0x65,
+    0x9a, 0xaa, 0xaa, 0xaa, 0xaa, 0xba, 0xaa, 0xaa, 0xaa, 0x9a, 0x65, 0x5a, 0xaa, 0xaa, 0xa9, 0xee,
+    0xee, 0xae, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x96, 0x6a, 0xaa, 0x99, 0x99, 0xba, 0xaa, 0xaa, 0xaa,
+    0xa9, 0x9a, 0xaa, 0xaa, 0xaa, 0xa9, 0x99, 0x59, 0xbb, 0xaa, 0xea, 0xaa, 0xaa, 0xa6, 0x66, 0x65,
+    0xaa, 0xaa, 0x99, 0x99, 0x96, 0xaa, 0xaa, 0xa6, 0xaa, 0xaa, 0xaa, 0xaa, 0xa6, 0x99, 0x56, 0x55,
+    0xaa, 0xea, 0xee, 0xaa, 0xaa, 0xa6, 0x66, 0x65, 0xaa, 0xaa, 0xa6, 0x66, 0x65, 0x65, 0xaa, 0xae,
+    0xaa, 0xaa, 0xaa, 0xaa, 0x65, 0x59, 0x5a, 0xaa, 0xaa, 0x96, 0xbb, 0xaa, 0xaa, 0xaa, 0x69, 0x99,
+    0x9a, 0xaa, 0xa6, 0x66, 0x65, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xa6, 0x55, 0xaa, 0xaa, 0xa9,
+    0x99, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xa9, 0x99, 0x95, 0xaa, 0x99, 0x99, 0x59, 0x55, 0x56, 0x99,
+    0xaa, 0xaa, 0xaa, 0x66, 0x5a, 0xaa, 0x9a, 0x99, 0x56, 0x55, 0x5a, 0xa6, 0xee, 0xaa, 0xaa, 0x66,
+    0x65, 0x6a, 0xa9, 0xa6, 0x59, 0x95, 0x56, 0xa6, 0x65, 0xaa, 0xa9, 0x96, 0xaa, 0xaa, 0xa6, 0x65,
+    0x55, 0x5a, 0xa6, 0x65, 0x55, 0xaa, 0xaa, 0xa6, 0x99, 0x99, 0xaa, 0x9a, 0x59, 0x95, 0x55, 0xa6,
+    0x59, 0x55, 0xa9, 0x96, 0xaa, 0xa9, 0x99, 0x59, 0x56, 0xaa, 0xa5, 0x55, 0x55, 0x56, 0xaa, 0xaa,
+    0x99, 0x99, 0x56, 0xa6, 0x65, 0x95, 0x55, 0x66, 0x59, 0x55, 0x55, 0x9a, 0xaa, 0xa9, 0x99, 0x95,
+    0x9a, 0xa9, 0x95, 0x55, 0x55, 0xa6, 0x55, 0xaa, 0xa9, 0xa6, 0x55, 0x9a, 0x66, 0x65, 0x55, 0x56,
+    0x65, 0x95, 0x55, 0x54, 0xaa, 0xa9, 0x96, 0x55, 0x6a, 0x65, 0x55, 0x55, 0x5a, 0x66, 0x55, 0x55,
+    0xaa, 0xaa, 0x66, 0x65, 0xa6, 0x99, 0x59, 0x55, 0xa5, 0x95, 0x55, 0x55, 0x55, 0xa9, 0x96, 0x59,
+    0xaa, 0x99, 0x96, 0x55, 0xa9, 0x95, 0x55, 0x55, 0x65, 0xaa, 0x96, 0x59, 0x55, 0xa6, 0x65, 0x95,
+    0x56, 0x59, 0x55, 0x55, 0x45, 0x55, 0x99, 0x65, 0x69, 0x99, 0x65, 0x55, 0xa9, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0xaa, 0x69, 0x95, 0x56, 0x66, 0x55, 0x55, 0x65, 0x95, 0x55, 0x51, 0x55, 0x55, 0x65,
+    0x6a, 0x99, 0x95, 0x55, 0x99, 0x55, 0x55, 0x56, 0x55, 0x55, 0x44, 0xa6, 0x99, 0x65, 0x5a, 0x65,
+    0x59, 0x55, 0x59, 0x55, 0x54, 0x55, 0x55, 0x51, 0x5a, 0xa5, 0x95, 0x55, 0x99, 0x55, 0x55, 0x66,
+    0x55, 0x55, 0x51, 0x55, 0xa9, 0x96, 0x55, 0x66, 0x59, 0x55, 0x56, 0x55, 0x55, 0x45, 0x55, 0x55,
+    0x10, 0xa9, 0x65, 0x55, 0xa6, 0x55, 0x55, 0x65, 0x55, 0x55, 0x15, 0x55, 0x54, 0x99, 0x99, 0x55,
+    0x65, 0x95, 0x55, 0x15, 0x55, 0x51, 0x15, 0x55, 0x44, 0x15, 0x96, 0x55, 0x69, 0x95, 0x55, 0x56,
+    0x55, 0x55, 0x15, 0x55, 0x44, 0x45, 0x99, 0x65, 0x55, 0x65, 0x55, 0x54, 0x99, 0x55, 0x45, 0x55,
+    0x51, 0x11, 0x55, 0x55, 0x56, 0x65, 0x55, 0x59, 0x55, 0x55, 0x45, 0x55, 0x50, 0x45, 0x54, 0x99,
+    0x95, 0x55, 0x59, 0x55, 0x45, 0x55, 0x54, 0x45, 0x55, 0x10, 0x15, 0x44, 0x55, 0x99, 0x55, 0x55,
+    0x95, 0x55, 0x45, 0x55, 0x50, 0x05, 0x54, 0x41,
+};
+
+static const uint8_t golden_rgb_atkinson_1bpp[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x20, 0x00, 0x00, 0x00, 0x00, 0x49, 0x20, 0x00, 0x00, 0x00, 0x04, 0x93, 0x64,
+    0x90, 0x00, 0x02, 0x49, 0xb6, 0x4d, 0xb0, 0x00, 0x00, 0x09, 0x21, 0x24, 0x14, 0xd0, 0x49, 0xb2,
+    0x5a, 0x48, 0x10, 0x00, 0x00, 0x01, 0x20, 0x99, 0x2c, 0xd3, 0x45, 0x24, 0x00, 0x00, 0x09, 0x92,
+    0xc0, 0x00, 0x10, 0x06, 0x44, 0xcb, 0x6d, 0x70, 0x00, 0x09, 0x25, 0xb2, 0x6e, 0xf0, 0x00, 0x86,
+    0x51, 0x26, 0x53, 0x20, 0x10, 0x12, 0x64, 0xcc, 0x9c, 0x00, 0x00, 0x04, 0x20, 0x94, 0xb3, 0x70,
+    0x96, 0xc1, 0x49, 0x96, 0x40, 0x41, 0xb7, 0x70, 0x01, 0x09, 0x26, 0x99, 0x0c, 0x93, 0x74, 0x4c,
+    0x00, 0x33, 0x6d, 0xb7, 0x00, 0x10, 0x49, 0x69, 0xc8, 0x8b, 0x6d, 0x73, 0x00, 0x69, 0x9b, 0x34,
+    0x08, 0xe0, 0x06, 0x4a, 0x4d, 0x46, 0x62, 0x6d, 0x90, 0x33, 0x1b, 0x68, 0x86, 0xee, 0xf0, 0x21,
+    0x26, 0x96, 0x33, 0x3d, 0xb6, 0x64, 0x8c, 0xcc, 0x04, 0xdb, 0x74, 0x10, 0x09, 0x31, 0xb0, 0x99,
+    0x9b, 0xa5, 0xb2, 0xcb, 0x21, 0xb7, 0x79, 0x17, 0xd0, 0x48, 0xcd, 0x66, 0xcc, 0xee, 0x59, 0xb2,
+    0x70, 0x36, 0x6c, 0x06, 0xdb, 0x60, 0x26, 0x26, 0x64, 0x67, 0x69, 0x5e, 0xf6, 0x05, 0x96, 0xc9,
+    0xf6, 0xf1, 0x60, 0x23, 0x33, 0x99, 0xb7, 0x67, 0x67, 0xd1, 0xb6, 0xd8, 0x9b, 0x7c, 0x9f, 0xf0,
+    0x19, 0xdd, 0x26, 0x99, 0x99, 0xbd, 0x31, 0x33, 0x27, 0x6f, 0x0b, 0xee, 0x10, 0xc4, 0x4d, 0x6d,
+    0xfe, 0xbe, 0xfd, 0xed, 0xc9, 0x35, 0xf0, 0xee, 0xe3, 0xf0, 0x27, 0x76, 0x59, 0x6a, 0xe7, 0xe6,
+    0xf6, 0x2c, 0xdd, 0x1f, 0xbc, 0xbf, 0xf0, 0x39, 0x9c, 0xd7, 0xe6, 0xdd, 0x9f, 0xb4, 0xb7, 0xd3,
+    0x6d, 0x93, 0xfe, 0x50, 0x8c, 0xe9, 0xb6, 0xdb, 0x7e, 0xfb, 0xf3, 0x96, 0x36, 0xf9, 0x7f, 0xcb,
+    0xf0, 0x67, 0x7b, 0x3b, 0x9b, 0xfb, 0x6f, 0xb6, 0x79, 0xbd, 0xcf, 0xec, 0xff, 0xd0, 0x59, 0x96,
+    0xdf, 0x6e, 0xe7, 0xfe, 0xf5, 0xe6, 0xcd, 0x76, 0xdf, 0xbd, 0xf0, 0x5b, 0xf5, 0xf6, 0xff, 0xdd,
+    0xfb, 0xfd, 0x36, 0xef, 0x7d, 0xb7, 0xef, 0xf0,
+};
+
+static const uint8_t golden_rgb_atkinson_2bpp[] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xeb, 0xae, 0xba, 0xaa, 0xaa, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0xef, 0xae, 0xba, 0xea, 0xaa, 0xff, 0xff, 0xff, 0xfb, 0xeb, 0xae, 0xae,
+    0xaa, 0xba, 0xaa, 0xaa, 0xaa, 0xaa, 0xff, 0xfe, 0xfb, 0xae, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xff, 0xff, 0xbe, 0xbe, 0xbe, 0xba, 0xeb, 0xae, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xea,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xff, 0xbb, 0xeb, 0xeb, 0xae,
+    0xba, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xfb, 0xfa, 0xfa, 0xeb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x99,
+    0x55, 0xaa, 0xaa, 0xaa, 0xff, 0xef, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0xfb, 0xaf, 0xae,
+    0xba, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa6, 0x55, 0x55, 0x95, 0xff, 0xfe, 0xba, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xa6, 0x55, 0x55, 0xbe, 0xfa, 0xae, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x59, 0x56,
+    0x56, 0xaa, 0xaa, 0xae, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x59, 0x5a, 0xaa, 0xaa, 0xaa, 0xee,
+    0xab, 0xea, 0xaa, 0xaa, 0xaa, 0xa9, 0x96, 0x59, 0x6a, 0xaa, 0xaa, 0xa6, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0xa9, 0x65, 0xeb, 0xae, 0xaa, 0xaa, 0xaa, 0xaa, 0x59, 0x65,
+    0xaa, 0xaa, 0xaa, 0x95, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x65, 0x55, 0x55,
+    0xaa, 0xba, 0xea, 0xaa, 0xaa, 0xaa, 0x96, 0x96, 0x6a, 0xaa, 0xa9, 0x65, 0x59, 0x55, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0x59, 0x55, 0x5a, 0xaa, 0xaa, 0x59, 0xba, 0xaa, 0xaa, 0xaa, 0xa5, 0x95,
+    0x6a, 0xaa, 0xa9, 0x65, 0x95, 0x55, 0x55, 0xea, 0xaa, 0xaa, 0xaa, 0xa5, 0x55, 0x6a, 0xaa, 0xaa,
+    0x65, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xa9, 0x69, 0x69, 0xaa, 0xaa, 0x59, 0x65, 0x55, 0x56, 0xa9,
+    0xaa, 0xaa, 0xaa, 0x65, 0x5a, 0xaa, 0xaa, 0x96, 0x55, 0x55, 0x5a, 0xa6, 0xae, 0xaa, 0xaa, 0x9a,
+    0x56, 0x5a, 0xaa, 0x59, 0x65, 0x55, 0x56, 0xa9, 0x55, 0xaa, 0xaa, 0x55, 0xaa, 0xaa, 0xaa, 0x55,
+    0x55, 0x5a, 0xaa, 0x55, 0x55, 0xaa, 0xaa, 0xa9, 0x96, 0x55, 0xaa, 0x96, 0x95, 0x55, 0x55, 0xa9,
+    0x55, 0x55, 0xa9, 0x65, 0xaa, 0xaa, 0xa5, 0x55, 0x56, 0xaa, 0x95, 0x55, 0x55, 0x55, 0xaa, 0xaa,
+    0xa5, 0xa5, 0x66, 0xa9, 0xa5, 0x65, 0x55, 0x6a, 0x55, 0x55, 0x55, 0x96, 0xaa, 0xaa, 0x95, 0x55,
+    0x5a, 0xaa, 0x55, 0x55, 0x55, 0xa9, 0x55, 0xaa, 0xaa, 0x69, 0x55, 0x5a, 0x99, 0x65, 0x55, 0x56,
+    0x95, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0x95, 0x59, 0x6a, 0xa9, 0x55, 0x55, 0x5a, 0x95, 0x55, 0x55,
+    0xaa, 0xa9, 0x59, 0x59, 0xaa, 0x59, 0x55, 0x55, 0xa5, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x95, 0x55,
+    0xaa, 0xa5, 0x55, 0x55, 0xa9, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x9a, 0x95, 0x95, 0xa5, 0xa5, 0x55,
+    0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x6a, 0xa5, 0x55, 0x55, 0xa5, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0xaa, 0x95, 0x95, 0x56, 0x99, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59,
+    0x6a, 0xa9, 0x55, 0x55, 0xa5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0xa5, 0x55, 0x5a, 0x59,
+    0x55, 0x56, 0x55, 0x55, 0x55, 0x15, 0x55, 0x54, 0x5a, 0xa9, 0x55, 0x55, 0xa9, 0x55, 0x55, 0x65,
+    0x55, 0x55, 0x51, 0x55, 0xa9, 0x66, 0x55, 0x65, 0x65, 0x55, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55,
+    0x00, 0xa9, 0x55, 0x55, 0xa9, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x54, 0x9a, 0x55, 0x55,
+    0x65, 0x95, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x40, 0x15, 0x95, 0x95, 0x69, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0xa5, 0x95, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x51, 0x55,
+    0x54, 0x11, 0x55, 0x55, 0x56, 0x95, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x50, 0x05, 0x55, 0xa5,
+    0x95, 0x55, 0x59, 0x55, 0x51, 0x55, 0x55, 0x05, 0x55, 0x40, 0x15, 0x50, 0x55, 0xa5, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x55, 0x00,
+};
@@ -0,0 +1,330 @@
+#include <unity.h>
+#include <png_dither.h>
+#include <PNGdec.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "golden.h"
+
+#define BENCHMARK_ROWS 2000
+#define ROW_WIDTH 800
+
+/**
+ * ReduceBpp() as it was before dithering: threshold each pixel.
+ * 4-bpp grayscale is left out, it mixed the neighboring pixel into odd pixels.
+ */
+static void legacy_reduce_bpp(int iDestBpp, int iPixelType, uint8_t *pPalette, uint8_t *pSrc, uint8_t *pDest, int w, int iSrcBpp)
+{
+  int g = 0, x, iDelta;
+  uint8_t *s, *d, *pPal, u8, count;
+  const uint8_t u8G2ToG8[4] = {0x00, 0x55, 0xaa, 0xff}; // 2-bit to 8-bit gray
+
+  if (iPixelType == PNG_PIXEL_TRUECOLOR) iSrcBpp = 24;
+  else if (iPixelType == PNG_PIXEL_TRUECOLOR_ALPHA) iSrcBpp = 32;
+  iDelta = iSrcBpp / 8; // bytes per pixel
+  count = 8;            // bits in a byte
+  u8 = 0;               // start with all black
+  d = pDest;
+  s = pSrc;
+  for (x = 0; x < w; x++)
+  {
+    u8 <<= iDestBpp;
+    switch (iSrcBpp)
+    {
+    case 24:
+    case 32:
+      g = (s[0] + s[1] * 2 + s[2]) / 4; // convert color to gray value
+      s += iDelta;
+      break;
+    case 8:
+      if (iPixelType == PNG_PIXEL_INDEXED)
+      {
+        pPal = &pPalette[s[0] * 3];
+        g = (pPal[0] + pPal[1] * 2 + pPal[2]) / 4;
+      }
+      else
+      { // must be grayscale
+        g = s[0];
+      }
+      s++;
+      break;
+    case 4:
+      if (x & 1)
+      {
+        pPal = &pPalette[(s[0] & 0xf) * 3];
+        g = (pPal[0] + pPal[1] * 2 + pPal[2]) / 4;
+        s++;
+      }
+      else
+      {
+        pPal = &pPalette[(s[0] >> 4) * 3];
+        g = (pPal[0] + pPal[1] * 2 + pPal[2]) / 4;
+      }
+      break;
+    case 2:
+      g = s[0] >> (6 - ((x & 3) * 2));
+      if (iPixelType == PNG_PIXEL_INDEXED)
+      {
+        pPal = &pPalette[(g & 3) * 3];
+        g = (pPal[0] + pPal[1] * 2 + pPal[2]) / 4;
+      }
+      else
+      {
+        g = u8G2ToG8[g & 3];
+      }
+      if ((x & 3) == 3)
+        s++;
+      break;
+    } // switch on bpp
+    if (iDestBpp == 1)
+      u8 |= (g >> 7); // B/W
+    else
+      u8 |= (3 ^ (g >> 6)); // 4 gray levels (inverted relative to 1-bit)
+    count -= iDestBpp;
+    if (count == 0)
+    { // byte is full, move on
+      *d++ = u8;
+      u8 = 0;
+      count = 8;
+    }
+  } // for x
+  if (count != 8)
+  { // partial byte remaining
+    u8 <<= count;
+    *d++ = u8;
+  }
+}
+
+/** Same formulas as gray_src() and rgb_src() in the script that wrote golden.h */
+static uint8_t gray_source(int x, int y)
+{
+  return (uint8_t)((x * 255 / (GOLDEN_WIDTH - 1) + y * 3) % 256);
+}
+
+static void rgb_source(int x, int y, uint8_t *rgb)
+{
+  rgb[0] = (uint8_t)(x * 5);
+  rgb[1] = (uint8_t)(y * 10);
+  rgb[2] = (uint8_t)(x * y);
+}
+
+static void random_bytes(std::vector<uint8_t> &buf)
+{
+  for (size_t i = 0; i < buf.size(); i++)
+    buf[i] = (uint8_t)(rand() & 0xff);
+}
+
+void test_threshold_matches_legacy(void)
+{
+  struct
+  {
+    int type;
+    int bpp;
+    int bits; // per pixel
+  } formats[] = {
+      {PNG_PIXEL_GRAYSCALE, 8, 8},
+      {PNG_PIXEL_GRAYSCALE, 2, 2},
+      {PNG_PIXEL_TRUECOLOR, 8, 24},
+      {PNG_PIXEL_TRUECOLOR_ALPHA, 8, 32},
+      {PNG_PIXEL_INDEXED, 8, 8},
+      {PNG_PIXEL_INDEXED, 4, 4},
+      {PNG_PIXEL_INDEXED, 2, 2},
+  };
+  std::vector<uint8_t> palette(768);
+  for (int round = 0; round < 200; round++)
+  {
+    int w = 1 + rand() % ROW_WIDTH;
+    random_bytes(palette);
+    for (auto &format : formats)
+    {
+      std::vector<uint8_t> src((w * format.bits + 7) / 8);
+      random_bytes(src);
+      for (int bpp = 1; bpp <= 2; bpp++)
+      {
+        std::vector<uint8_t> expected((w * bpp + 7) / 8), actual(expected.size());
+        legacy_reduce_bpp(bpp, format.type, palette.data(), src.data(), expected.data(), w, format.bpp);
+        png_reduce_row(bpp, format.type, palette.data(), src.data(), actual.data(), w, format.bpp, nullptr);
+        TEST_ASSERT_EQUAL_MEMORY(expected.data(), actual.data(), expected.size());
+      }
+    }
+  }
+}
+
+void test_gray_conversion(void)
+{
+  // 4-bpp gray: each nibble is repeated; gray with alpha: the alpha byte is skipped
+  uint8_t gray4[] = {0x0f, 0xa5};
+  uint8_t gray_alpha[] = {0x10, 0xff, 0x80, 0x00, 0xf0, 0x7f};
+  uint8_t out[4];
+  png_row_to_gray(PNG_PIXEL_GRAYSCALE, nullptr, gray4, out, 4, 4);
+  TEST_ASSERT_EQUAL_HEX8(0x00, out[0]);
+  TEST_ASSERT_EQUAL_HEX8(0xff, out[1]);
+  TEST_ASSERT_EQUAL_HEX8(0xaa, out[2]);
+  TEST_ASSERT_EQUAL_HEX8(0x55, out[3]);
+
+  png_row_to_gray(PNG_PIXEL_GRAY_ALPHA, nullptr, gray_alpha, out, 3, 8);
+  TEST_ASSERT_EQUAL_HEX8(0x10, out[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x80, out[1]);
+  TEST_ASSERT_EQUAL_HEX8(0xf0, out[2]);
+
+  uint8_t bits[] = {0xa0};
+  png_row_to_gray(PNG_PIXEL_GRAYSCALE, nullptr, bits, out, 4, 1);
+  TEST_ASSERT_EQUAL_HEX8(0xff, out[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x00, out[1]);
+  TEST_ASSERT_EQUAL_HEX8(0xff, out[2]);
+  TEST_ASSERT_EQUAL_HEX8(0x00, out[3]);
+}
+
+static void check_golden(bool rgb, dither_mode_e mode, int bpp, const uint8_t *golden)
+{
+  RowDither dither;
+  TEST_ASSERT_TRUE(dither.begin(GOLDEN_WIDTH, mode));
+  int pitch = (GOLDEN_WIDTH * bpp + 7) / 8;
+  std::vector<uint8_t> src(GOLDEN_WIDTH * 3), out(pitch);
+  for (int y = 0; y < GOLDEN_HEIGHT; y++)
+  {
+    for (int x = 0; x < GOLDEN_WIDTH; x++)
+    {
+      if (rgb)
+        rgb_source(x, y, &src[x * 3]);
+      else
+        src[x] = gray_source(x, y);
+    }
+    png_reduce_row(bpp, rgb ? PNG_PIXEL_TRUECOLOR : PNG_PIXEL_GRAYSCALE, nullptr, src.data(), out.data(), GOLDEN_WIDTH, 8, &dither);
+    TEST_ASSERT_EQUAL_MEMORY(golden + y * pitch, out.data(), pitch);
+  }
+}
+
+void test_golden_images(void)
+{
+  check_golden(false, DITHER_FLOYD_STEINBERG, 1, golden_gray_fs_1bpp);
+  check_golden(false, DITHER_FLOYD_STEINBERG, 2, golden_gray_fs_2bpp);
+  check_golden(false, DITHER_ATKINSON, 1, golden_gray_atkinson_1bpp);
+  check_golden(false, DITHER_ATKINSON, 2, golden_gray_atkinson_2bpp);
+  check_golden(true, DITHER_FLOYD_STEINBERG, 1, golden_rgb_fs_1bpp);
+  check_golden(true, DITHER_FLOYD_STEINBERG, 2, golden_rgb_fs_2bpp);
+  check_golden(true, DITHER_ATKINSON, 1, golden_rgb_atkinson_1bpp);
+  check_golden(true, DITHER_ATKINSON, 2, golden_rgb_atkinson_2bpp);
+}
+
+void test_flat_gray_keeps_its_level(void)
+{
+  // a flat gray comes out as a mix of panel levels with the same average, not one level
+  const int w = 200, h = 100;
+  std::vector<uint8_t> src(w), out(w / 4);
+  uint8_t grays[] = {32, 100, 128, 200};
+  for (uint8_t gray : grays)
+  {
+    memset(src.data(), gray, w);
+    RowDither dither;
+    TEST_ASSERT_TRUE(dither.begin(w, DITHER_FLOYD_STEINBERG));
+    long sum = 0;
+    for (int y = 0; y < h; y++)
+    {
+      png_reduce_row(1, PNG_PIXEL_GRAYSCALE, nullptr, src.data(), out.data(), w, 8, &dither);
+      for (int x = 0; x < w; x++)
+        sum += ((out[x / 8] >> (7 - (x & 7))) & 1) * 255;
+    }
+    int average = (int)(sum / (w * h));
+    TEST_ASSERT_INT_WITHIN(3, gray, average);
+
+    TEST_ASSERT_TRUE(dither.begin(w, DITHER_ATKINSON));
+    sum = 0;
+    for (int y = 0; y < h; y++)
+    {
+      png_reduce_row(2, PNG_PIXEL_GRAYSCALE, nullptr, src.data(), out.data(), w, 8, &dither);
+      for (int x = 0; x < w; x++)
+        sum += (3 ^ ((out[x / 4] >> (6 - 2 * (x & 3))) & 3)) * 85;
+    }
+    average = (int)(sum / (w * h));
+    TEST_ASSERT_INT_WITHIN(12, gray, average); // Atkinson drops 1/4 of the error by design
+  }
+}
+
+void test_begin_starts_over(void)
+{
+  RowDither dither;
+  std::vector<uint8_t> src(ROW_WIDTH), first(ROW_WIDTH / 8), again(ROW_WIDTH / 8);
+  random_bytes(src);
+  TEST_ASSERT_TRUE(dither.begin(ROW_WIDTH, DITHER_FLOYD_STEINBERG));
+  png_reduce_row(1, PNG_PIXEL_GRAYSCALE, nullptr, src.data(), first.data(), ROW_WIDTH, 8, &dither);
+  png_reduce_row(1, PNG_PIXEL_GRAYSCALE, nullptr, src.data(), again.data(), ROW_WIDTH, 8, &dither);
+  TEST_ASSERT_TRUE(memcmp(first.data(), again.data(), first.size()) != 0); // carries the error of row 0
+
+  TEST_ASSERT_TRUE(dither.begin(ROW_WIDTH, DITHER_FLOYD_STEINBERG));
+  png_reduce_row(1, PNG_PIXEL_GRAYSCALE, nullptr, src.data(), again.data(), ROW_WIDTH, 8, &dither);
+  TEST_ASSERT_EQUAL_MEMORY(first.data(), again.data(), first.size());
+
+  // DITHER_NONE and rows wider than begin() was told threshold
+  TEST_ASSERT_TRUE(dither.begin(ROW_WIDTH, DITHER_NONE));
+  TEST_ASSERT_EQUAL(DITHER_NONE, dither.mode());
+  png_reduce_row(1, PNG_PIXEL_GRAYSCALE, nullptr, src.data(), first.data(), ROW_WIDTH, 8, nullptr);
+  png_reduce_row(1, PNG_PIXEL_GRAYSCALE, nullptr, src.data(), again.data(), ROW_WIDTH, 8, &dither);
+  TEST_ASSERT_EQUAL_MEMORY(first.data(), again.data(), first.size());
+}
+
+void test_benchmark(void)
+{
+  struct
+  {
+    const char *name;
+    int type;
+    int bytes;
+  } formats[] = {
+      {"8-bit gray", PNG_PIXEL_GRAYSCALE, 1},
+      {"24-bit RGB", PNG_PIXEL_TRUECOLOR, 3},
+      {"32-bit RGBA", PNG_PIXEL_TRUECOLOR_ALPHA, 4},
+  };
+  const char *modes[] = {"threshold", "Floyd-Steinberg", "Atkinson"};
+  std::vector<uint8_t> out(ROW_WIDTH / 4);
+
+  printf("\n%-12s %-16s %12s %12s\n", "source", "mode", "us/row 1bpp", "us/row 2bpp");
+  for (auto &format : formats)
+  {
+    std::vector<uint8_t> src(ROW_WIDTH * format.bytes);
+    random_bytes(src);
+    for (int mode = DITHER_NONE; mode <= DITHER_ATKINSON; mode++)
+    {
+      double us[2];
+      for (int bpp = 1; bpp <= 2; bpp++)
+      {
+        RowDither dither;
+        TEST_ASSERT_TRUE(dither.begin(ROW_WIDTH, (dither_mode_e)mode));
+        auto start = std::chrono::steady_clock::now();
+        for (int y = 0; y < BENCHMARK_ROWS; y++)
+          png_reduce_row(bpp, format.type, nullptr, src.data(), out.data(), ROW_WIDTH, 8, &dither);
+        us[bpp - 1] = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / BENCHMARK_ROWS;
+      }
+      printf("%-12s %-16s %12.2f %12.2f\n", format.name, modes[mode], us[0], us[1]);
+    }
+  }
+}
+
+void setUp(void)
+{
+  srand(1234);
+}
+
+void tearDown(void)
+{
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_threshold_matches_legacy);
+  RUN_TEST(test_gray_conversion);
+  RUN_TEST(test_golden_images);
+  RUN_TEST(test_flat_gray_keeps_its_level);
+  RUN_TEST(test_begin_starts_over);
+  RUN_TEST(test_benchmark);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
@@ -0,0 +1,264 @@
+#include <unity.h>
+#include <png_planes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+/**
+ * Compares the table-driven 2-bpp to 1-bpp conversions with the per-pixel loops
+ * png_draw() used before, and times both over 800x480 frames.
+ */
+
+#define BENCHMARK_FRAMES 20
+#define FRAME_WIDTH 800
+#define FRAME_HEIGHT 480
+
+/**
+ * The loops png_draw() had, taking the plane as an argument.
+ * The last byte of a row whose width isn't a multiple of 8 was never written.
+ */
+static void scalar_two_bit_to_one_bit(const uint8_t *s, uint8_t *d, int width, uint8_t ucInvert, int iPlane)
+{
+  uint8_t uc = 0, ucMask, src;
+  int x;
+
+  src = *s++;
+  src ^= ucInvert;
+  if (iPlane > 1)
+  { // draw 2bpp data as 1-bit to use for partial update
+    ucInvert = ~ucInvert; // the invert rule is backwards for grayscale data
+    src = ~src;
+    for (x = 0; x < width; x++)
+    {
+      uc <<= 1;
+      if (src & 0xc0) // non-white -> black
+        uc |= 1;
+      src <<= 2;
+      if ((x & 3) == 3)
+      { // new input byte
+        src = *s++;
+        src ^= ucInvert;
+      }
+      if ((x & 7) == 7)
+      { // new output byte
+        *d++ = uc;
+      }
+    } // for x
+  }
+  else
+  { // normal 0/1 split plane
+    ucMask = (iPlane == 0) ? 0x40 : 0x80; // lower or upper source bit
+    for (x = 0; x < width; x++)
+    {
+      uc <<= 1;
+      if (src & ucMask)
+        uc |= 1; // high bit of source pair
+      src <<= 2;
+      if ((x & 3) == 3)
+      { // new input byte
+        src = *s++;
+        src ^= ucInvert;
+      }
+      if ((x & 7) == 7)
+      { // new output byte
+        *d++ = uc;
+      }
+    } // for x
+  }
+}
+
+static void scalar_invert_row(const uint8_t *s, uint8_t *d, int width, uint8_t ucInvert)
+{
+  for (int x = 0; x < width; x += 8)
+  {
+    d[0] = s[0] ^ ucInvert;
+    d++;
+    s++;
+  }
+}
+
+/** @brief Calls two_bit_to_one_bit() the way png_draw() does for iPlane */
+static void table_two_bit_to_one_bit(const uint8_t *s, uint8_t *d, int width, uint8_t ucInvert, int iPlane)
+{
+  if (iPlane > 1)
+    two_bit_to_one_bit(s, d, width, (uint8_t)~ucInvert, TWO_BIT_NONZERO);
+  else
+    two_bit_to_one_bit(s, d, width, ucInvert, iPlane == 0 ? TWO_BIT_PLANE_0 : TWO_BIT_PLANE_1);
+}
+
+static void random_bytes(std::vector<uint8_t> &buf)
+{
+  for (size_t i = 0; i < buf.size(); i++)
+    buf[i] = (uint8_t)(rand() & 0xff);
+}
+
+void test_planes_match_scalar(void)
+{
+  const uint8_t inverts[] = {0x00, 0xff};
+  for (int round = 0; round < 500; round++)
+  {
+    int width = 8 * (1 + rand() % 100);
+    std::vector<uint8_t> src((width + 3) / 4 + 1);
+    random_bytes(src);
+    for (uint8_t invert : inverts)
+    {
+      for (int plane = 0; plane <= 2; plane++)
+      {
+        std::vector<uint8_t> expected(width / 8), actual(width / 8);
+        scalar_two_bit_to_one_bit(src.data(), expected.data(), width, invert, plane);
+        table_two_bit_to_one_bit(src.data(), actual.data(), width, invert, plane);
+        TEST_ASSERT_EQUAL_MEMORY(expected.data(), actual.data(), expected.size());
+      }
+    }
+  }
+}
+
+void test_every_byte_value(void)
+{
+  // all 256 source bytes in one row, each plane and invert
+  uint8_t src[257], expected[128], actual[128];
+  for (int i = 0; i < 256; i++)
+    src[i] = (uint8_t)i;
+  src[256] = 0;
+  for (int plane = 0; plane <= 2; plane++)
+  {
+    for (int invert = 0; invert <= 0xff; invert += 0xff)
+    {
+      scalar_two_bit_to_one_bit(src, expected, 1024, (uint8_t)invert, plane);
+      table_two_bit_to_one_bit(src, actual, 1024, (uint8_t)invert, plane);
+      TEST_ASSERT_EQUAL_MEMORY(expected, actual, sizeof(expected));
+    }
+  }
+}
+
+void test_partial_last_byte(void)
+{
+  // widths that aren't a multiple of 8: the full bytes match, the last one holds
+  // the remaining pixels left aligned with 0 padding (the loops left it unwritten)
+  for (int width = 1; width < 64; width++)
+  {
+    if ((width & 7) == 0)
+      continue;
+    uint8_t src[17];
+    for (size_t i = 0; i < sizeof(src); i++)
+      src[i] = (uint8_t)(rand() & 0xff);
+    for (int plane = 0; plane <= 2; plane++)
+    {
+      uint8_t expected[9], actual[9], whole[9];
+      memset(actual, 0xaa, sizeof(actual));
+      scalar_two_bit_to_one_bit(src, expected, width, 0xff, plane);
+      table_two_bit_to_one_bit(src, actual, width, 0xff, plane);
+      TEST_ASSERT_EQUAL_MEMORY(expected, actual, width / 8);
+
+      // the same pixels as part of a wider row
+      table_two_bit_to_one_bit(src, whole, 64, 0xff, plane);
+      uint8_t mask = (uint8_t)(0xff << (8 - (width & 7)));
+      TEST_ASSERT_EQUAL_HEX8(whole[width / 8] & mask, actual[width / 8]);
+      TEST_ASSERT_EQUAL_HEX8(0xaa, actual[width / 8 + 1]);
+    }
+  }
+}
+
+void test_in_place(void)
+{
+  // png_draw() converts rows reduced by ReduceBpp() in its scratch buffer
+  for (int plane = 0; plane <= 2; plane++)
+  {
+    std::vector<uint8_t> src(FRAME_WIDTH / 4 + 1), buf, expected(FRAME_WIDTH / 8); // the scalar loop reads a byte ahead
+    random_bytes(src);
+    buf = src;
+    scalar_two_bit_to_one_bit(src.data(), expected.data(), FRAME_WIDTH, 0xff, plane);
+    table_two_bit_to_one_bit(buf.data(), buf.data(), FRAME_WIDTH, 0xff, plane);
+    TEST_ASSERT_EQUAL_MEMORY(expected.data(), buf.data(), expected.size());
+  }
+
+  std::vector<uint8_t> row(101), expected(101);
+  random_bytes(row);
+  scalar_invert_row(row.data(), expected.data(), 101 * 8, 0xff);
+  invert_row(row.data(), row.data(), 101, 0xff);
+  TEST_ASSERT_EQUAL_MEMORY(expected.data(), row.data(), row.size());
+}
+
+void test_invert_matches_scalar(void)
+{
+  for (int len = 0; len < 40; len++)
+  {
+    for (int offset = 0; offset < 4; offset++) // any alignment
+    {
+      std::vector<uint8_t> src(len + 4), expected(len + 4), actual(len + 4);
+      random_bytes(src);
+      for (int invert = 0; invert <= 0xff; invert += 0xff)
+      {
+        scalar_invert_row(src.data() + offset, expected.data(), len * 8, (uint8_t)invert);
+        invert_row(src.data() + offset, actual.data(), len, (uint8_t)invert);
+        TEST_ASSERT_EQUAL_MEMORY(expected.data(), actual.data(), len);
+      }
+    }
+  }
+}
+
+typedef void (*convert_t)(const uint8_t *, uint8_t *, int, uint8_t, int);
+
+static double time_frames(convert_t convert, const std::vector<uint8_t> &frame, int plane, uint32_t *checksum)
+{
+  const int pitch = FRAME_WIDTH / 4;
+  uint8_t out[FRAME_WIDTH / 8];
+  uint32_t sum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int f = 0; f < BENCHMARK_FRAMES; f++)
+  {
+    for (int y = 0; y < FRAME_HEIGHT; y++)
+    {
+      convert(frame.data() + y * pitch, out, FRAME_WIDTH, 0xff, plane);
+      sum += out[y % sizeof(out)]; // keeps the conversion from being optimized out
+    }
+  }
+  *checksum = sum;
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / BENCHMARK_FRAMES;
+}
+
+void test_benchmark(void)
+{
+  std::vector<uint8_t> frame(FRAME_WIDTH / 4 * FRAME_HEIGHT + 1);
+  random_bytes(frame);
+  const char *names[] = {"plane 0", "plane 1", "non-white"};
+
+  printf("\n%-10s %16s %16s\n", "mode", "scalar ms/frame", "table ms/frame");
+  for (int plane = 0; plane <= 2; plane++)
+  {
+    uint32_t scalar_sum, table_sum;
+    double scalar_ms = time_frames(scalar_two_bit_to_one_bit, frame, plane, &scalar_sum);
+    double table_ms = time_frames(table_two_bit_to_one_bit, frame, plane, &table_sum);
+    printf("%-10s %16.3f %16.3f\n", names[plane], scalar_ms, table_ms);
+    TEST_ASSERT_EQUAL_UINT32(scalar_sum, table_sum);
+  }
+}
+
+void setUp(void)
+{
+  srand(1234);
+}
+
+void tearDown(void)
+{
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_planes_match_scalar);
+  RUN_TEST(test_every_byte_value);
+  RUN_TEST(test_partial_last_byte);
+  RUN_TEST(test_in_place);
+  RUN_TEST(test_invert_matches_scalar);
+  RUN_TEST(test_benchmark);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
@@ -0,0 +1,232 @@
+#include <unity.h>
+#include <png_rotate.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+
+/**
+ * Checks PngRowRotator against a pixel-by-pixel rotation of the same image, and times both.
+ */
+
+/** Stands in for bbep: the column stripes land in the RAM of a landscape panel */
+struct ColumnPanel
+{
+  int width, height, pitch;
+  std::vector<uint8_t> ram;
+  int stripes;
+
+  ColumnPanel(int width, int height)
+      : width(width), height(height), pitch((width + 7) / 8), ram(pitch * height, 0xaa), stripes(0)
+  {
+  }
+};
+
+/** The same calls png_write_column() makes on the device: an 8 pixel wide window, one byte per row */
+static bool column_write(void *ctx, int x, const uint8_t *column, int len)
+{
+  ColumnPanel *panel = (ColumnPanel *)ctx;
+  for (int py = 0; py < len && py < panel->height; py++)
+    panel->ram[py * panel->pitch + x / 8] = column[py];
+  panel->stripes++;
+  return true;
+}
+
+static std::vector<uint8_t> random_image(int width, int height)
+{
+  std::vector<uint8_t> image(((width + 7) / 8) * height);
+  for (size_t i = 0; i < image.size(); i++)
+    image[i] = (uint8_t)(rand() & 0xff);
+  return image;
+}
+
+static int get_pixel(const uint8_t *image, int pitch, int x, int y)
+{
+  return (image[y * pitch + x / 8] >> (7 - (x & 7))) & 1;
+}
+
+/**
+ * @brief Rotates the image 90 degrees counterclockwise one pixel at a time, image (x, y) to panel (y, width - 1 - x)
+ * @param pad value of the panel pixels past the bottom of the image
+ */
+static std::vector<uint8_t> reference_rotate(const std::vector<uint8_t> &image, int width, int height, int pad)
+{
+  int src_pitch = (width + 7) / 8, pitch = (height + 7) / 8;
+  std::vector<uint8_t> panel(pitch * width, 0);
+  for (int py = 0; py < width; py++)
+  {
+    for (int px = 0; px < pitch * 8; px++)
+    {
+      int pixel = (px < height) ? get_pixel(image.data(), src_pitch, width - 1 - py, px) : pad;
+      if (pixel)
+        panel[py * pitch + px / 8] |= 0x80 >> (px & 7);
+    }
+  }
+  return panel;
+}
+
+/** @brief Feeds the image to PngRowRotator row by row, onto a panel of height x width */
+static void rotate(const std::vector<uint8_t> &image, int width, int height, uint8_t pad, ColumnPanel &panel)
+{
+  PngRowRotator rotator;
+  int pitch = (width + 7) / 8;
+  TEST_ASSERT_TRUE(rotator.begin(width, height, column_write, &panel, pad));
+  for (int y = 0; y < height; y++)
+    TEST_ASSERT_TRUE(rotator.addRow(&image[y * pitch]));
+  TEST_ASSERT_TRUE(rotator.flush());
+  rotator.end();
+}
+
+void test_transpose8x8(void)
+{
+  // a single pixel in row r, column c ends up in row c, column r
+  for (int r = 0; r < 8; r++)
+  {
+    for (int c = 0; c < 8; c++)
+    {
+      uint8_t src[8] = {0}, dst[8];
+      src[r] = 0x80 >> c;
+      transpose8x8(src, 1, dst, 1);
+      for (int i = 0; i < 8; i++)
+        TEST_ASSERT_EQUAL_HEX8((i == c) ? (0x80 >> r) : 0x00, dst[i]);
+    }
+  }
+  // strides on both sides
+  uint8_t src[16], dst[24], twice[8];
+  for (int i = 0; i < 16; i++)
+    src[i] = (uint8_t)(rand() & 0xff);
+  transpose8x8(src, 2, dst, 3);
+  for (int i = 0; i < 8; i++)
+    twice[i] = 0;
+  transpose8x8(dst, 3, twice, 1);
+  for (int i = 0; i < 8; i++)
+    TEST_ASSERT_EQUAL_HEX8(src[i * 2], twice[i]);
+}
+
+void test_portrait_frame(void)
+{
+  // the 480x800 portrait image of a 800x480 panel
+  std::vector<uint8_t> image = random_image(480, 800);
+  ColumnPanel panel(800, 480);
+  rotate(image, 480, 800, 0xff, panel);
+  std::vector<uint8_t> expected = reference_rotate(image, 480, 800, 1);
+  TEST_ASSERT_EQUAL(100, panel.stripes);
+  TEST_ASSERT_EQUAL_MEMORY(expected.data(), panel.ram.data(), expected.size());
+}
+
+void test_odd_sizes(void)
+{
+  const int sizes[][2] = {{13, 21}, {8, 8}, {1, 9}, {100, 3}, {57, 64}};
+  for (auto &size : sizes)
+  {
+    int width = size[0], height = size[1];
+    for (int pad = 0; pad < 2; pad++)
+    {
+      std::vector<uint8_t> image = random_image(width, height);
+      ColumnPanel panel(height, width);
+      rotate(image, width, height, pad ? 0xff : 0x00, panel);
+      std::vector<uint8_t> expected = reference_rotate(image, width, height, pad);
+      TEST_ASSERT_EQUAL((height + 7) / 8, panel.stripes);
+      TEST_ASSERT_EQUAL_MEMORY(expected.data(), panel.ram.data(), expected.size());
+    }
+  }
+}
+
+void test_bad_calls(void)
+{
+  ColumnPanel panel(8, 8);
+  PngRowRotator rotator;
+  uint8_t row[1] = {0};
+  TEST_ASSERT_FALSE(rotator.active());
+  TEST_ASSERT_FALSE(rotator.addRow(row)); // before begin()
+  TEST_ASSERT_TRUE(rotator.flush());
+  TEST_ASSERT_TRUE(rotator.begin(8, 2, column_write, &panel));
+  TEST_ASSERT_TRUE(rotator.active());
+  TEST_ASSERT_TRUE(rotator.addRow(row));
+  TEST_ASSERT_TRUE(rotator.addRow(row));
+  TEST_ASSERT_FALSE(rotator.addRow(row)); // past the last row
+  TEST_ASSERT_TRUE(rotator.flush());
+  TEST_ASSERT_TRUE(rotator.flush()); // nothing left
+  TEST_ASSERT_EQUAL(1, panel.stripes);
+  rotator.end();
+  TEST_ASSERT_FALSE(rotator.active());
+}
+
+/** @brief What png_draw() would do without the kernel: read and set one pixel at a time */
+static void per_pixel_write(void *ctx, int x, const uint8_t *rows, int pitch, int width)
+{
+  ColumnPanel *panel = (ColumnPanel *)ctx;
+  for (int r = 0; r < 8; r++)
+  {
+    uint8_t mask = 0x80 >> r;
+    for (int ix = 0; ix < width; ix++)
+    {
+      uint8_t *d = &panel->ram[(width - 1 - ix) * panel->pitch + x / 8];
+      if (get_pixel(rows, pitch, ix, r))
+        *d |= mask;
+      else
+        *d &= ~mask;
+    }
+  }
+}
+
+void test_benchmark(void)
+{
+  const int width = 480, height = 800, loops = 20;
+  int pitch = (width + 7) / 8;
+  std::vector<uint8_t> image = random_image(width, height);
+  ColumnPanel naive(height, width), fast(height, width);
+  PngRowRotator rotator;
+  clock_t t0, t1, t2;
+
+  t0 = clock();
+  for (int i = 0; i < loops; i++)
+  {
+    for (int y = 0; y < height; y += 8)
+      per_pixel_write(&naive, y, &image[y * pitch], pitch, width);
+  }
+  t1 = clock();
+  for (int i = 0; i < loops; i++)
+  {
+    TEST_ASSERT_TRUE(rotator.begin(width, height, column_write, &fast));
+    for (int y = 0; y < height; y++)
+      rotator.addRow(&image[y * pitch]);
+    rotator.flush();
+  }
+  t2 = clock();
+  rotator.end();
+  TEST_ASSERT_EQUAL_MEMORY(naive.ram.data(), fast.ram.data(), naive.ram.size());
+
+  double naive_ms = 1000.0 * (t1 - t0) / CLOCKS_PER_SEC / loops;
+  double fast_ms = 1000.0 * (t2 - t1) / CLOCKS_PER_SEC / loops;
+  printf("\n%-12s %12s\n", "rotation", "ms / frame");
+  printf("%-12s %12.3f\n", "per pixel", naive_ms);
+  printf("%-12s %12.3f\n", "8x8 blocks", fast_ms);
+}
+
+void setUp(void)
+{
+  srand(1234);
+}
+
+void tearDown(void)
+{
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_transpose8x8);
+  RUN_TEST(test_portrait_frame);
+  RUN_TEST(test_odd_sizes);
+  RUN_TEST(test_bad_calls);
+  RUN_TEST(test_benchmark);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
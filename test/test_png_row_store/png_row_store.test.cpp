@@ -0,0 +1,300 @@
+#include <unity.h>
+#include <png_row_store.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "test_images.h"
+
+/**
+ * Checks that drawing from a PngRowStore gives the panel exactly what decoding
+ * the PNG again would, and compares decode passes and time of the old
+ * count-then-draw flow of png_to_epd() with one decode into the store.
+ */
+
+#define BENCHMARK_ROUNDS 20
+
+/** What png_draw() would have sent to the panel, as one byte stream per pass */
+struct PanelCapture
+{
+  std::vector<uint8_t> data;
+  int rows = 0;
+};
+
+static int capture_draw(PNGDRAW *pDraw)
+{
+  PanelCapture *capture = (PanelCapture *)pDraw->pUser;
+  capture->data.insert(capture->data.end(), pDraw->pPixels, pDraw->pPixels + pDraw->iPitch);
+  capture->rows++;
+  return 1;
+}
+
+/** Stand-in for png_draw() splitting a 2-bpp row into one plane, about as much work per row */
+struct PlaneSink
+{
+  int plane;
+  uint32_t checksum;
+};
+
+static int plane_draw(PNGDRAW *pDraw)
+{
+  PlaneSink *sink = (PlaneSink *)pDraw->pUser;
+  uint32_t sum = sink->checksum;
+  if (pDraw->iBpp != 2)
+  {
+    for (int x = 0; x < pDraw->iPitch; x++)
+      sum = sum * 31 + pDraw->pPixels[x];
+  }
+  else
+  {
+    uint8_t mask = sink->plane == 0 ? 0x40 : 0x80;
+    for (int x = 0; x < pDraw->iWidth; x += 4)
+    {
+      uint8_t src = pDraw->pPixels[x / 4] ^ 0xff, uc = 0;
+      for (int i = 0; i < 4; i++, src <<= 2)
+        uc = (uc << 1) | ((src & mask) ? 1 : 0);
+      sum = sum * 31 + uc;
+    }
+  }
+  sink->checksum = sum;
+  return 1;
+}
+
+static int count_draw(PNGDRAW *pDraw)
+{
+  uint8_t *flags = (uint8_t *)pDraw->pUser;
+  if (pDraw->y > PNG_COUNT_COLORS_MAX_Y)
+    return 0;
+  // every image took this pass, but only 2-bpp rows can be scanned as 2-bpp
+  if (pDraw->iBpp == 2)
+    *flags = png_two_bit_color_flags(pDraw->pPixels, pDraw->iWidth, *flags);
+  return 1;
+}
+
+static int decode(PNG &png, const uint8_t *data, size_t size, PNG_DRAW_CALLBACK *draw, void *user)
+{
+  int rc = png.openRAM((uint8_t *)data, (int)size, draw);
+  if (rc != PNG_SUCCESS)
+    return rc;
+  rc = png.decode(user, 0);
+  png.close();
+  return rc;
+}
+
+/** @return number of planes png_to_epd() draws for a 2-bpp image with this many colors */
+static int planes_for(int bpp, int colors)
+{
+  return (bpp == 2 && colors == 3) ? 2 : 1;
+}
+
+void test_color_flags(void)
+{
+  srand(1234);
+  uint8_t row[200];
+  for (int round = 0; round < 1000; round++)
+  {
+    int width = 4 + rand() % 797;
+    int used = 1 + rand() % 15; // which of the 4 values may appear
+    uint8_t expected = 0;
+    memset(row, 0, sizeof(row));
+    for (int x = 0; x < width; x++)
+    {
+      int value;
+      do
+        value = rand() & 3;
+      while (!(used & (1 << value)));
+      row[x / 4] |= value << (6 - 2 * (x & 3));
+      expected |= 1 << value;
+    }
+    if (width & 3)
+      expected |= 1; // the padding of the last byte counts as color 0, as it always did
+
+    TEST_ASSERT_EQUAL_HEX8(expected, png_two_bit_color_flags(row, width, 0));
+    TEST_ASSERT_EQUAL_HEX8(expected | 0x08, png_two_bit_color_flags(row, width, 0x08));
+  }
+  TEST_ASSERT_EQUAL(0, png_two_bit_color_count(0));
+  TEST_ASSERT_EQUAL(2, png_two_bit_color_count(0x09));
+  TEST_ASSERT_EQUAL(4, png_two_bit_color_count(0x0f));
+}
+
+void test_color_count_matches_count_pass(void)
+{
+  struct
+  {
+    const uint8_t *data;
+    size_t size;
+    int colors;
+  } images[] = {
+      {png_2bit_2color, sizeof(png_2bit_2color), 2}, // the icon below PNG_COUNT_COLORS_MAX_Y isn't counted
+      {png_2bit_3color, sizeof(png_2bit_3color), 3},
+  };
+  PNG png;
+  for (auto &image : images)
+  {
+    uint8_t flags = 0;
+    decode(png, image.data, image.size, count_draw, &flags);
+
+    PngRowStore rows;
+    TEST_ASSERT_TRUE(rows.begin(png.getWidth(), png.getHeight(), png.getBpp()));
+    TEST_ASSERT_EQUAL(PNG_SUCCESS, decode(png, image.data, image.size, png_row_store_draw, &rows));
+    TEST_ASSERT_TRUE(rows.complete());
+    TEST_ASSERT_EQUAL(png_two_bit_color_count(flags), rows.colorCount());
+    TEST_ASSERT_EQUAL(image.colors, rows.colorCount());
+  }
+}
+
+void test_replay_matches_decode(void)
+{
+  const uint8_t *images[] = {png_1bit, png_2bit_2color, png_2bit_3color, png_indexed};
+  size_t sizes[] = {sizeof(png_1bit), sizeof(png_2bit_2color), sizeof(png_2bit_3color), sizeof(png_indexed)};
+  PNG png;
+  for (int i = 0; i < 4; i++)
+  {
+    PanelCapture decoded, replayed;
+    TEST_ASSERT_EQUAL(PNG_SUCCESS, decode(png, images[i], sizes[i], capture_draw, &decoded));
+
+    PngRowStore rows;
+    TEST_ASSERT_TRUE(rows.begin(png.getWidth(), png.getHeight(), png.getBpp()));
+    TEST_ASSERT_EQUAL(PNG_SUCCESS, decode(png, images[i], sizes[i], png_row_store_draw, &rows));
+    TEST_ASSERT_EQUAL((size_t)png.getHeight() * ((png.getWidth() * png.getBpp() + 7) / 8), rows.size());
+    TEST_ASSERT_TRUE(rows.replay(capture_draw, &replayed));
+    TEST_ASSERT_TRUE(rows.replay(capture_draw, &replayed)); // as often as there are planes
+
+    TEST_ASSERT_EQUAL(png.getHeight(), decoded.rows);
+    TEST_ASSERT_EQUAL(2 * decoded.rows, replayed.rows);
+    TEST_ASSERT_EQUAL(2 * decoded.data.size(), replayed.data.size());
+    TEST_ASSERT_EQUAL_MEMORY(decoded.data.data(), replayed.data.data(), decoded.data.size());
+    TEST_ASSERT_EQUAL_MEMORY(decoded.data.data(), replayed.data.data() + decoded.data.size(), decoded.data.size());
+  }
+}
+
+void test_rows_that_dont_fit(void)
+{
+  PNG png;
+  PngRowStore rows;
+  PanelCapture capture;
+
+  // sized for another image: nothing is kept, png_to_epd() decodes the old way
+  TEST_ASSERT_TRUE(rows.begin(400, 480, 2));
+  TEST_ASSERT_NOT_EQUAL(PNG_SUCCESS, decode(png, png_2bit_3color, sizeof(png_2bit_3color), png_row_store_draw, &rows));
+  TEST_ASSERT_FALSE(rows.complete());
+  TEST_ASSERT_FALSE(rows.replay(capture_draw, &capture));
+  TEST_ASSERT_EQUAL(0, capture.rows);
+
+  // a decode that stops early leaves the store incomplete
+  TEST_ASSERT_TRUE(rows.begin(800, 480, 2));
+  PNGDRAW row;
+  memset(&row, 0, sizeof(row));
+  uint8_t pixels[200] = {0};
+  row.iWidth = 800;
+  row.iBpp = 2;
+  row.pPixels = pixels;
+  for (row.y = 0; row.y < 100; row.y++)
+    TEST_ASSERT_TRUE(rows.addRow(&row));
+  TEST_ASSERT_FALSE(rows.complete());
+  row.y = 480;
+  TEST_ASSERT_FALSE(rows.addRow(&row));
+
+  rows.end();
+  TEST_ASSERT_EQUAL(0, rows.size());
+  TEST_ASSERT_FALSE(rows.addRow(&row));
+}
+
+void test_benchmark(void)
+{
+  struct
+  {
+    const char *name;
+    const uint8_t *data;
+    size_t size;
+  } images[] = {
+      {"1-bit", png_1bit, sizeof(png_1bit)},
+      {"2-bit, 2 colors", png_2bit_2color, sizeof(png_2bit_2color)},
+      {"2-bit, 3 colors", png_2bit_3color, sizeof(png_2bit_3color)},
+      {"4-bit indexed", png_indexed, sizeof(png_indexed)},
+  };
+  PNG png;
+
+  printf("\n%-16s %14s %10s %14s %10s\n", "image", "passes before", "ms before", "passes after", "ms after");
+  for (auto &image : images)
+  {
+    int passes_before = 0, passes_after = 0;
+    uint32_t checksum_before = 0, checksum_after = 0;
+
+    // before: png_count_colors() decodes once, then every plane is decoded again
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+      uint8_t flags = 0;
+      decode(png, image.data, image.size, count_draw, &flags);
+      int planes = planes_for(png.getBpp(), png_two_bit_color_count(flags));
+      passes_before = 1 + planes;
+      for (int plane = 0; plane < planes; plane++)
+      {
+        PlaneSink sink = {plane, 0};
+        decode(png, image.data, image.size, plane_draw, &sink);
+        checksum_before += sink.checksum;
+      }
+    }
+    double ms_before = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    // after: 2-bpp images are decoded once into the store, other depths straight to the panel
+    start = std::chrono::steady_clock::now();
+    for (int round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+      PngRowStore rows;
+      passes_after = 1;
+      TEST_ASSERT_EQUAL(PNG_SUCCESS, png.openRAM((uint8_t *)image.data, (int)image.size, plane_draw));
+      png.close();
+      if (png.getBpp() != 2)
+      {
+        PlaneSink sink = {0, 0};
+        decode(png, image.data, image.size, plane_draw, &sink);
+        checksum_after += sink.checksum;
+        continue;
+      }
+      TEST_ASSERT_TRUE(rows.begin(png.getWidth(), png.getHeight(), png.getBpp()));
+      decode(png, image.data, image.size, png_row_store_draw, &rows);
+      int planes = planes_for(png.getBpp(), rows.colorCount());
+      for (int plane = 0; plane < planes; plane++)
+      {
+        PlaneSink sink = {plane, 0};
+        rows.replay(plane_draw, &sink);
+        checksum_after += sink.checksum;
+      }
+    }
+    double ms_after = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    printf("%-16s %14d %10.2f %14d %10.2f\n", image.name, passes_before, ms_before / BENCHMARK_ROUNDS,
+           passes_after, ms_after / BENCHMARK_ROUNDS);
+    TEST_ASSERT_EQUAL_UINT32(checksum_before, checksum_after);
+    TEST_ASSERT_EQUAL(1, passes_after);
+    TEST_ASSERT_TRUE(passes_before > passes_after);
+  }
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_color_flags);
+  RUN_TEST(test_color_count_matches_count_pass);
+  RUN_TEST(test_replay_matches_decode);
+  RUN_TEST(test_rows_that_dont_fit);
+  RUN_TEST(test_benchmark);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
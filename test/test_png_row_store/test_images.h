@@ -0,0 +1,1058 @@
+#pragma once
+
+#include <stdint.h>
+
+// Generated with zlib level 9, no filters: rectangles and rows of "words" like a rendered screen
+
+// 800x480 1-bpp grayscale
+static const uint8_t png_1bit[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x01, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x75, 0x7c, 0x34,
+    0x58, 0x00, 0x00, 0x08, 0x5a, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed, 0xda, 0xfd, 0x3b, 0xd4,
+    0xe9, 0x1e, 0x07, 0xf0, 0xcf, 0x3d, 0x5f, 0x63, 0x46, 0xe9, 0x78, 0xac, 0x4c, 0x99, 0x8c, 0x5a,
+    0xa2, 0x74, 0x84, 0x42, 0x68, 0x76, 0x1a, 0x85, 0x1c, 0x59, 0xe4, 0x29, 0x9d, 0x4b, 0xb6, 0x3c,
+    0xed, 0xa6, 0x10, 0x9d, 0xc8, 0x43, 0xd3, 0x36, 0xcb, 0x2a, 0x8b, 0xc4, 0x95, 0x56, 0x85, 0x45,
+    0x3a, 0x1e, 0xf2, 0x54, 0xe7, 0xb4, 0x5d, 0x68, 0x2a, 0x6d, 0x6a, 0xa9, 0x59, 0xaa, 0x1d, 0x1d,
+    0x5b, 0xb3, 0x9c, 0x65, 0x94, 0x0a, 0x23, 0x14, 0x71, 0xec, 0xef, 0xa7, 0xeb, 0xda, 0x39, 0xdf,
+    0xeb, 0xfc, 0xb2, 0xd7, 0xe7, 0xf5, 0x0f, 0xbc, 0xaf, 0xef, 0x7d, 0x7f, 0xe7, 0x9e, 0xcf, 0xfd,
+    0xbd, 0xde, 0x00, 0x08, 0x21, 0x84, 0x10, 0xfa, 0x83, 0xd2, 0x9a, 0xfd, 0xbf, 0x1a, 0xc6, 0x10,
+    0x0c, 0xc1, 0x10, 0x0c, 0xc1, 0x10, 0x0c, 0xc1, 0x10, 0x0c, 0xc1, 0x10, 0x0c, 0xc1, 0x10, 0x0c,
+    0xc1, 0x10, 0x0c, 0xc1, 0x10, 0x0c, 0xc1, 0x10, 0x0c, 0xc1, 0x90, 0xff, 0x25, 0x04, 0x21, 0x84,
+    0x10, 0x42, 0x7f, 0x50, 0x8c, 0xac, 0xed, 0xb1, 0x9d, 0x99, 0x93, 0xa4, 0xdb, 0x6e, 0xbe, 0xcb,
+    0x3f, 0xa0, 0x97, 0x6f, 0x66, 0xce, 0x58, 0x28, 0xbd, 0xe0, 0xe3, 0x45, 0x35, 0x1e, 0x58, 0x14,
+    0xdd, 0x10, 0x55, 0x46, 0xc6, 0xfb, 0xca, 0xca, 0x0d, 0x68, 0x86, 0x50, 0xd5, 0x9e, 0xa9, 0x13,
+    0x35, 0x79, 0xd0, 0x58, 0xb0, 0xe6, 0xa7, 0x61, 0xd0, 0x0c, 0x6b, 0x3f, 0x0c, 0x41, 0x6f, 0x14,
+    0x1e, 0x1e, 0x24, 0x3c, 0x79, 0xa7, 0x55, 0x84, 0x95, 0x82, 0xb2, 0x78, 0xaf, 0x28, 0x0a, 0xa4,
+    0xfb, 0x28, 0xdf, 0xde, 0x09, 0x88, 0x29, 0xd6, 0x26, 0xdb, 0x85, 0xc1, 0xde, 0x05, 0x40, 0xd4,
+    0xf4, 0xd4, 0xe1, 0x7a, 0xcc, 0x92, 0xef, 0x5b, 0x19, 0x15, 0xbe, 0x2d, 0x69, 0x17, 0xc4, 0x06,
+    0x60, 0x7a, 0xe9, 0xd7, 0x0c, 0x01, 0xdd, 0x10, 0xf1, 0x61, 0x0e, 0x2f, 0xcd, 0x80, 0xbc, 0xfd,
+    0x2a, 0x4b, 0x58, 0x06, 0x9d, 0x69, 0xe1, 0xef, 0x08, 0x77, 0x85, 0x22, 0x21, 0x81, 0x1a, 0xe5,
+    0x18, 0xe9, 0x29, 0xf5, 0x14, 0x6a, 0xeb, 0xac, 0x05, 0x23, 0x6c, 0xba, 0x21, 0x29, 0xb2, 0x29,
+    0x41, 0xaa, 0x3d, 0x54, 0x71, 0x85, 0x7c, 0x43, 0x48, 0xcc, 0x2a, 0x61, 0x33, 0xd2, 0x05, 0xc6,
+    0xdd, 0x32, 0xe2, 0xfb, 0x2e, 0x6d, 0x83, 0xbf, 0x3d, 0x4f, 0x2d, 0x76, 0xfc, 0x58, 0xdd, 0x24,
+    0xdd, 0x3d, 0xe9, 0xa8, 0x76, 0x5e, 0xda, 0x91, 0x00, 0x16, 0x5b, 0x47, 0x06, 0xa4, 0xe0, 0x11,
+    0xfc, 0xb2, 0x84, 0xea, 0x5b, 0xf2, 0x65, 0x4d, 0x35, 0x04, 0x3a, 0xcb, 0x73, 0x02, 0x73, 0xc5,
+    0x8c, 0xe1, 0x34, 0x9b, 0x5d, 0x05, 0x74, 0x43, 0x42, 0x6f, 0x6f, 0x79, 0x11, 0xea, 0x46, 0x72,
+    0x1b, 0x6f, 0x34, 0xba, 0x41, 0x99, 0xae, 0xd6, 0x03, 0xea, 0xe8, 0x0b, 0xa7, 0xd6, 0x56, 0xca,
+    0xc4, 0xf5, 0x68, 0x84, 0x49, 0x84, 0x13, 0xe4, 0x9e, 0xf8, 0x31, 0xab, 0x8d, 0xee, 0x72, 0x35,
+    0x17, 0xc5, 0x0d, 0xb7, 0x9c, 0x25, 0xd9, 0x85, 0x8a, 0x5d, 0x21, 0x90, 0x5f, 0xf1, 0x79, 0x2b,
+    0xd5, 0xa5, 0xd4, 0x39, 0x77, 0x96, 0x32, 0x8a, 0xeb, 0xb2, 0x33, 0xb2, 0xd3, 0x66, 0xf2, 0x07,
+    0xfa, 0x36, 0x24, 0xd0, 0x7d, 0x92, 0xcb, 0xd3, 0x0e, 0xd7, 0xaf, 0x48, 0x61, 0x70, 0x3c, 0xe2,
+    0x5f, 0x93, 0x90, 0x1d, 0xbf, 0xe8, 0x32, 0xdc, 0x6f, 0x91, 0x4e, 0x4f, 0x13, 0xa9, 0xfd, 0x83,
+    0x97, 0x5d, 0xaf, 0xa4, 0x54, 0xf1, 0xc1, 0xc4, 0xd9, 0x48, 0xba, 0x21, 0xdd, 0x57, 0x26, 0x76,
+    0x3e, 0xf1, 0x22, 0x2e, 0xf1, 0x64, 0x48, 0x13, 0xda, 0xf3, 0xae, 0x0a, 0x81, 0xda, 0xa1, 0x71,
+    0xe5, 0x32, 0xe3, 0xeb, 0x31, 0x78, 0x9e, 0x39, 0xc8, 0x56, 0x2b, 0x7d, 0xd5, 0x18, 0x5d, 0x47,
+    0x37, 0x24, 0x63, 0x7b, 0x55, 0xdf, 0x09, 0x7d, 0x38, 0x31, 0x7c, 0xe4, 0x76, 0x02, 0xd4, 0xdc,
+    0x3e, 0x6e, 0x0d, 0xb3, 0xf2, 0xbb, 0xde, 0x5e, 0x64, 0xf1, 0xc5, 0xd9, 0x5f, 0x16, 0xcb, 0xdb,
+    0xd4, 0x2d, 0x03, 0x6e, 0x56, 0x68, 0xd3, 0xdd, 0x13, 0x93, 0xfc, 0x00, 0x81, 0x49, 0x32, 0x69,
+    0x7e, 0x55, 0xa9, 0x6b, 0x0a, 0x49, 0xbb, 0xdc, 0xdb, 0x48, 0x80, 0xb3, 0x71, 0x7e, 0x1e, 0x95,
+    0xe8, 0x17, 0xf0, 0x2c, 0xe9, 0x19, 0x8f, 0xf1, 0xee, 0xd2, 0x31, 0x33, 0x37, 0x3c, 0x7e, 0x11,
+    0x42, 0xbf, 0x1b, 0x89, 0x8e, 0x8b, 0xdd, 0x27, 0x65, 0x3c, 0xfd, 0xb7, 0x8c, 0xdc, 0xfe, 0x4e,
+    0x46, 0xa2, 0x8a, 0x35, 0xb6, 0xdd, 0x6d, 0x48, 0xdf, 0x5a, 0xa7, 0xbf, 0x37, 0xd9, 0x37, 0x3e,
+    0x42, 0x62, 0x36, 0x31, 0xef, 0x10, 0x57, 0x4b, 0x44, 0xf7, 0x80, 0xec, 0x4d, 0x3d, 0xd2, 0x3b,
+    0xc6, 0x6a, 0x9d, 0x09, 0x01, 0x0e, 0xbf, 0x81, 0xea, 0x5b, 0x4b, 0x36, 0x4c, 0xb7, 0xff, 0xd0,
+    0x23, 0xe1, 0x1e, 0x21, 0xe7, 0x52, 0xa2, 0x8a, 0x1d, 0x06, 0x9e, 0x56, 0xbc, 0xde, 0x41, 0x77,
+    0x90, 0xa0, 0x6c, 0x02, 0x02, 0x6c, 0x62, 0xd4, 0xc3, 0x6b, 0xd8, 0x40, 0x55, 0xf9, 0x50, 0x6b,
+    0x3d, 0xe6, 0x73, 0x83, 0x74, 0x36, 0xde, 0xd3, 0x66, 0x72, 0x44, 0x26, 0x4c, 0x10, 0xcd, 0x5b,
+    0xbf, 0xe9, 0xca, 0x21, 0x42, 0x7b, 0xb9, 0xdc, 0x97, 0x70, 0xb6, 0xf2, 0x18, 0x79, 0xb6, 0x3c,
+    0x52, 0xbe, 0x60, 0x92, 0x6c, 0x2d, 0x20, 0x8a, 0x28, 0x97, 0xd0, 0x4c, 0x81, 0xda, 0xaa, 0xa0,
+    0xcd, 0x1f, 0xad, 0x95, 0xb0, 0x3f, 0x6d, 0x29, 0xc9, 0x35, 0xa6, 0xbb, 0x5c, 0x60, 0x3f, 0x39,
+    0xe9, 0x28, 0x80, 0xd8, 0xb1, 0x18, 0x18, 0x4d, 0xae, 0x04, 0x07, 0x31, 0x6b, 0x8f, 0xe2, 0x39,
+    0x97, 0x2d, 0xa7, 0x7e, 0x79, 0xb0, 0xa2, 0x6f, 0x44, 0xc2, 0x7a, 0xf0, 0x85, 0xd6, 0xe5, 0x15,
+    0xb4, 0xf7, 0xa4, 0x58, 0xe0, 0x5c, 0x6a, 0xc0, 0x12, 0x1c, 0xe5, 0x41, 0x01, 0xcf, 0x82, 0x2a,
+    0xbd, 0xac, 0x5e, 0xcf, 0xf0, 0xec, 0xd9, 0x2d, 0x58, 0x96, 0xa2, 0x71, 0x3e, 0x75, 0xaf, 0xc4,
+    0xa9, 0xd5, 0x6c, 0xb3, 0xd5, 0x69, 0xba, 0x21, 0x8c, 0x93, 0x5b, 0x5c, 0x4e, 0x2a, 0x98, 0xcb,
+    0x8f, 0xb7, 0x11, 0xb7, 0xd2, 0x5c, 0x46, 0x8e, 0x13, 0xb5, 0x70, 0x61, 0xce, 0x44, 0x79, 0xce,
+    0xd2, 0x75, 0x79, 0x85, 0x8e, 0xcb, 0x05, 0xb6, 0xbe, 0x71, 0x0f, 0x83, 0xc5, 0xb4, 0x43, 0x6e,
+    0xc5, 0x1d, 0xb8, 0x35, 0xcc, 0x4c, 0xeb, 0x8f, 0x24, 0xab, 0xbf, 0xcb, 0x62, 0xdc, 0xb8, 0xa8,
+    0x9e, 0xd2, 0xfe, 0xb8, 0xb6, 0x5d, 0xca, 0x1c, 0xd7, 0x2d, 0xff, 0x75, 0x4c, 0x3e, 0x7f, 0xc2,
+    0xca, 0xee, 0x63, 0x73, 0x09, 0xdd, 0xe5, 0x1a, 0xb6, 0x77, 0x1c, 0x6d, 0x62, 0xc9, 0x0f, 0xc9,
+    0xc8, 0x32, 0x43, 0x05, 0x35, 0x1c, 0x48, 0x0d, 0xbf, 0xae, 0xff, 0x7c, 0xb6, 0x8e, 0x7b, 0xfd,
+    0xe4, 0xfb, 0xe6, 0x4b, 0x22, 0x47, 0xe7, 0x1a, 0xaa, 0xea, 0x67, 0xda, 0xbf, 0x46, 0xce, 0x9b,
+    0xb1, 0xa5, 0x81, 0x60, 0x33, 0x28, 0x25, 0x05, 0x53, 0x2e, 0xb0, 0x44, 0xae, 0xfe, 0x53, 0x57,
+    0xd5, 0xd7, 0x7b, 0x8a, 0x97, 0x49, 0xba, 0xcf, 0x3f, 0xed, 0x14, 0x6d, 0x2c, 0xf2, 0x2a, 0x3a,
+    0x58, 0x4e, 0xfb, 0x7e, 0xa2, 0xac, 0xaa, 0x54, 0xca, 0x99, 0x03, 0x01, 0x12, 0xb2, 0xf3, 0xe1,
+    0x71, 0xc6, 0xa8, 0x19, 0xd3, 0xb3, 0xf6, 0xab, 0xda, 0x6c, 0x91, 0x61, 0x40, 0x7e, 0xd3, 0x5f,
+    0x03, 0x8b, 0xed, 0xaf, 0x65, 0x5e, 0x6b, 0xb1, 0xa2, 0x3d, 0xd5, 0x6f, 0xf3, 0xf3, 0xfd, 0x44,
+    0x00, 0xdf, 0xd4, 0x5e, 0x85, 0xf1, 0xaa, 0x26, 0xd8, 0x66, 0xa6, 0xee, 0xb7, 0x2b, 0xbe, 0x46,
+    0x2b, 0x86, 0x2c, 0x8f, 0xfe, 0xd4, 0x78, 0xb5, 0x9c, 0xe1, 0x77, 0x60, 0x61, 0xfc, 0x62, 0x09,
+    0x1e, 0xbf, 0x08, 0xa1, 0xdf, 0x7f, 0x0a, 0x37, 0xec, 0xdb, 0x1f, 0x55, 0xc6, 0xe4, 0x78, 0x0e,
+    0x84, 0xca, 0x88, 0xf4, 0xed, 0xfe, 0xac, 0x7d, 0x9d, 0xfa, 0x64, 0x9e, 0x4f, 0x8a, 0x0b, 0xc4,
+    0xae, 0xe9, 0x10, 0xb9, 0xc7, 0x7a, 0xff, 0xd8, 0x51, 0x53, 0x44, 0xfb, 0x3f, 0x3e, 0xc2, 0xa6,
+    0xcf, 0x4a, 0xc1, 0xda, 0xf9, 0xf0, 0xdd, 0xfd, 0x10, 0xc6, 0x9b, 0xd3, 0x7d, 0xb5, 0xd6, 0x63,
+    0x81, 0x60, 0x31, 0xf6, 0xc3, 0x63, 0x50, 0x4f, 0x0e, 0x07, 0x8d, 0xb4, 0x83, 0x6f, 0xfa, 0x93,
+    0xad, 0x69, 0xff, 0x69, 0x5d, 0x48, 0xb7, 0x16, 0x1b, 0x10, 0x81, 0x6d, 0xcd, 0x36, 0x36, 0x15,
+    0xa3, 0xb7, 0xf6, 0xdb, 0xf4, 0x98, 0x26, 0x08, 0xd6, 0x64, 0x7b, 0x01, 0xf4, 0x7b, 0x89, 0x02,
+    0x45, 0x79, 0xfa, 0x5e, 0xfd, 0x0c, 0xda, 0xcb, 0xa5, 0xd4, 0xf9, 0x8b, 0x9e, 0x82, 0x68, 0x3d,
+    0xb4, 0xeb, 0xe7, 0x91, 0xe5, 0x1c, 0xb7, 0x74, 0x1d, 0x63, 0x43, 0xc8, 0x7e, 0xa3, 0x29, 0x84,
+    0xcf, 0xcc, 0x77, 0x83, 0xd6, 0x67, 0xda, 0x39, 0xbd, 0xe6, 0xce, 0xb4, 0x97, 0xcb, 0xdf, 0xde,
+    0xc1, 0x9e, 0x07, 0x93, 0x9b, 0x46, 0xab, 0x63, 0x28, 0xa1, 0xbd, 0x7d, 0xaa, 0xa3, 0x50, 0x4c,
+    0x84, 0x3a, 0x86, 0x7c, 0x70, 0x4a, 0x77, 0x05, 0x47, 0xa7, 0xec, 0xec, 0x3b, 0x2c, 0x57, 0xda,
+    0x3b, 0x1f, 0x78, 0xaa, 0x38, 0x57, 0xcc, 0x3a, 0xc7, 0x16, 0xd5, 0xf3, 0x28, 0x4e, 0x52, 0x69,
+    0xfb, 0xa9, 0xa5, 0x72, 0x32, 0x22, 0x6c, 0xee, 0x07, 0xd3, 0x78, 0x5d, 0x58, 0x7f, 0x21, 0xf1,
+    0x6d, 0x6e, 0xbc, 0x25, 0xed, 0xe5, 0x32, 0x09, 0x3f, 0x19, 0xe1, 0xa4, 0x7e, 0xff, 0x70, 0xd6,
+    0xdc, 0xe5, 0x5a, 0xe1, 0x7e, 0x2a, 0x2c, 0xec, 0x85, 0x88, 0xdc, 0x38, 0x6f, 0xd2, 0x00, 0x3e,
+    0x3e, 0x16, 0x22, 0x83, 0xce, 0xa8, 0xa1, 0xea, 0x4e, 0x0d, 0xda, 0x21, 0x46, 0xb6, 0xb7, 0xec,
+    0xb4, 0x49, 0xaa, 0x69, 0x3f, 0x3f, 0x92, 0x1a, 0x3d, 0x2f, 0xb9, 0x6e, 0xa7, 0x94, 0x92, 0xc1,
+    0x0c, 0xcf, 0x60, 0x70, 0x97, 0x85, 0x8b, 0x6c, 0xee, 0x9d, 0x3e, 0xdd, 0x2f, 0xdb, 0x4e, 0xf7,
+    0xed, 0x22, 0x5d, 0xaf, 0x95, 0xaf, 0xa4, 0xac, 0x7d, 0xc5, 0x71, 0x15, 0x32, 0x46, 0x73, 0x97,
+    0xf2, 0x9f, 0xaf, 0x9a, 0xda, 0x21, 0x22, 0x72, 0xf0, 0x09, 0xb8, 0xce, 0xa4, 0x88, 0x8c, 0xee,
+    0x8c, 0x8f, 0xbf, 0x9f, 0x71, 0xa0, 0x3d, 0x48, 0x64, 0x2a, 0x0c, 0x06, 0xd9, 0xac, 0x06, 0xbd,
+    0x97, 0x1c, 0x29, 0x15, 0xe4, 0xb5, 0x54, 0xf6, 0xe2, 0xb7, 0x0f, 0x8e, 0x5f, 0x9a, 0x0f, 0x41,
+    0x38, 0xc5, 0x05, 0xdb, 0xfe, 0xa4, 0x24, 0x2e, 0xe5, 0x4e, 0xfb, 0xed, 0x5a, 0xdc, 0xab, 0x94,
+    0xb7, 0xb1, 0x74, 0x4e, 0xfb, 0x58, 0x4a, 0xa8, 0xbe, 0x45, 0xca, 0x13, 0x7d, 0xf2, 0x69, 0x48,
+    0x0d, 0x3b, 0xd1, 0x0a, 0xfe, 0x4f, 0x93, 0x61, 0x95, 0xff, 0x48, 0x6c, 0x72, 0xf0, 0x6e, 0xda,
+    0xb3, 0x70, 0x52, 0xcf, 0x27, 0xcf, 0x78, 0xe0, 0x29, 0xbc, 0x34, 0x71, 0x95, 0xda, 0x94, 0xec,
+    0xb1, 0xf2, 0xd9, 0x26, 0x5f, 0xa8, 0xca, 0x69, 0xd1, 0x85, 0x8d, 0x19, 0x53, 0x22, 0xeb, 0x66,
+    0xb1, 0x78, 0x2a, 0xa3, 0x56, 0x84, 0xc7, 0x2f, 0x42, 0x48, 0x85, 0x69, 0x65, 0xff, 0x7e, 0x7d,
+    0x35, 0xf3, 0xb1, 0xee, 0xcd, 0x16, 0x96, 0xda, 0xe0, 0xdd, 0xed, 0x02, 0x85, 0xf1, 0xa5, 0xd0,
+    0x3b, 0xd4, 0x03, 0x7f, 0xd3, 0x2f, 0x02, 0xae, 0x89, 0xe9, 0xbd, 0x30, 0x53, 0xda, 0x77, 0xa0,
+    0xb9, 0x69, 0x65, 0x6d, 0x20, 0x34, 0xfe, 0x39, 0x3c, 0xa4, 0xae, 0x2e, 0x84, 0x14, 0x34, 0x3e,
+    0x86, 0xf6, 0xe6, 0x17, 0xa0, 0xb9, 0xa3, 0x08, 0x2c, 0x9a, 0xad, 0x45, 0x96, 0x9b, 0x95, 0xcb,
+    0xc4, 0x4a, 0xda, 0x4f, 0xc2, 0xb8, 0x90, 0x26, 0x6e, 0x22, 0x09, 0x26, 0xec, 0x33, 0x89, 0x09,
+    0x6c, 0x58, 0xe9, 0xe3, 0x05, 0x25, 0x3d, 0x66, 0x40, 0xfe, 0xfe, 0x08, 0x7c, 0x8f, 0x31, 0xc0,
+    0xce, 0x22, 0x72, 0x53, 0x75, 0x24, 0xed, 0x2b, 0x23, 0xa5, 0xd4, 0xd3, 0x31, 0x64, 0x38, 0xd9,
+    0xae, 0xb0, 0x76, 0xe0, 0xe7, 0x40, 0xc7, 0xa4, 0x10, 0x5a, 0xdd, 0x8c, 0xa1, 0x73, 0x3a, 0x0d,
+    0x52, 0x53, 0x9c, 0x41, 0x97, 0x55, 0xcf, 0x4f, 0xaf, 0xa7, 0xff, 0xbd, 0xcb, 0xdf, 0xc1, 0x41,
+    0xcc, 0xd4, 0x8c, 0x3f, 0xb8, 0x60, 0xc1, 0xfc, 0x36, 0x22, 0xac, 0xe4, 0x43, 0x96, 0xd4, 0x08,
+    0x12, 0xfd, 0xf8, 0xb0, 0x4a, 0xec, 0x0a, 0xeb, 0xb8, 0xa5, 0x5f, 0x70, 0x4b, 0xe9, 0x9f, 0xf4,
+    0x81, 0x39, 0xa7, 0xe4, 0xac, 0x9b, 0x23, 0x2b, 0xa3, 0xef, 0xdc, 0x0c, 0x21, 0x4f, 0xd6, 0xf4,
+    0xc3, 0x47, 0xdf, 0x2b, 0xc1, 0x63, 0x91, 0x36, 0xcc, 0xf7, 0xaa, 0x05, 0xab, 0x6f, 0xee, 0x9a,
+    0x05, 0xdd, 0xa5, 0xff, 0x76, 0x99, 0x84, 0x45, 0x88, 0x58, 0x90, 0xdb, 0x76, 0x84, 0xc5, 0xe4,
+    0x81, 0xd1, 0xa9, 0x06, 0xd8, 0x71, 0xb8, 0x1b, 0xca, 0xee, 0x7a, 0x43, 0xe8, 0x40, 0x06, 0x2c,
+    0xcb, 0xf4, 0x8f, 0x6b, 0xf7, 0xa7, 0xbf, 0x27, 0x46, 0x76, 0x76, 0x52, 0x56, 0x39, 0x7f, 0x6f,
+    0x40, 0x45, 0xd9, 0x45, 0x78, 0x94, 0x15, 0x0c, 0x1d, 0xd3, 0x96, 0x90, 0x7f, 0xa7, 0x07, 0xf6,
+    0xf4, 0x6e, 0x17, 0x7d, 0xcc, 0x51, 0xc6, 0x72, 0x94, 0xb4, 0x43, 0xe6, 0xa6, 0x95, 0xa1, 0x76,
+    0x52, 0x58, 0x21, 0xab, 0x3f, 0x73, 0x36, 0x01, 0x2c, 0xe6, 0xa6, 0x94, 0xa9, 0xda, 0x97, 0x90,
+    0x1d, 0xff, 0x27, 0x70, 0x08, 0x72, 0x80, 0xd5, 0x0f, 0x66, 0x5e, 0x6a, 0xcd, 0xd0, 0xfe, 0x9d,
+    0xcc, 0x4d, 0x2b, 0x0a, 0x00, 0xb5, 0x92, 0x47, 0x12, 0x50, 0x0f, 0x21, 0xb1, 0xae, 0x43, 0xe0,
+    0xf0, 0x78, 0x1c, 0xda, 0x4b, 0x53, 0xc0, 0xbb, 0xc4, 0x1d, 0xd6, 0x17, 0x7a, 0xe6, 0x14, 0x7a,
+    0xd2, 0xde, 0x78, 0xb2, 0x78, 0x6e, 0x3c, 0x21, 0x33, 0x96, 0xad, 0xde, 0x6f, 0xdf, 0x47, 0x12,
+    0xfd, 0xb9, 0x29, 0x65, 0x72, 0xb2, 0x17, 0x6a, 0xb6, 0x3c, 0x87, 0xe5, 0x67, 0x76, 0x8b, 0xf8,
+    0x0b, 0xf9, 0x9a, 0xf9, 0x7c, 0xfa, 0x1b, 0x9f, 0xf4, 0xec, 0x67, 0x5f, 0x46, 0xe5, 0xec, 0x35,
+    0x9f, 0xca, 0x2a, 0x19, 0xe4, 0x37, 0xe9, 0xc2, 0x84, 0x54, 0x03, 0x92, 0x9e, 0xfa, 0x41, 0x74,
+    0xa8, 0xa5, 0x68, 0x1d, 0x27, 0x65, 0x94, 0x93, 0x82, 0x9f, 0x56, 0x10, 0x42, 0xaa, 0x1c, 0x90,
+    0xd8, 0x5b, 0x51, 0x09, 0xf6, 0x56, 0x54, 0x0a, 0xc1, 0xde, 0x8a, 0x4a, 0x21, 0xd8, 0x5b, 0x41,
+    0x08, 0xa1, 0x0f, 0xdc, 0xb4, 0xb0, 0xb7, 0xa2, 0xd2, 0x72, 0x61, 0x6f, 0x45, 0xa5, 0x59, 0x18,
+    0x7b, 0x2b, 0x2a, 0xc1, 0xde, 0x0a, 0x42, 0x08, 0x7d, 0xe0, 0x14, 0xc6, 0xde, 0x8a, 0x4a, 0xcb,
+    0x85, 0xbd, 0x15, 0x95, 0x96, 0x0b, 0x7b, 0x2b, 0x2a, 0xbd, 0xc2, 0xd8, 0x5b, 0x41, 0x08, 0xa1,
+    0x0f, 0x4d, 0x2b, 0xd8, 0x5b, 0x51, 0x69, 0x5a, 0xc1, 0xde, 0x8a, 0x4a, 0xd3, 0x0a, 0xf6, 0x56,
+    0x54, 0x9b, 0x56, 0xb0, 0xb7, 0x82, 0x10, 0x42, 0xff, 0xf5, 0x80, 0xc4, 0xde, 0x8a, 0x4a, 0xb0,
+    0xb7, 0xa2, 0x52, 0x08, 0xf6, 0x56, 0x54, 0x0a, 0xc1, 0xde, 0x0a, 0x42, 0x08, 0x21, 0x84, 0x10,
+    0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42,
+    0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08,
+    0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0xe8, 0xf8, 0x0f, 0x4a,
+    0x83, 0x29, 0x77, 0x53, 0xde, 0xfb, 0x26, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae,
+    0x42, 0x60, 0x82,
+};
+
+// 800x480 2-bpp grayscale with 2 colors above the icon in the lower left corner
+static const uint8_t png_2bit_2color[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x01, 0xe0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x32, 0xdc, 0x4e,
+    0x88, 0x00, 0x00, 0x0b, 0x45, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed, 0x9c, 0x41, 0xaa, 0x2c,
+    0x2d, 0x12, 0x85, 0x05, 0xa7, 0x82, 0x5b, 0x11, 0x62, 0x2a, 0xb8, 0x8a, 0xde, 0xaf, 0xe0, 0x54,
+    0x70, 0x2b, 0x01, 0xd2, 0xb3, 0x00, 0xfb, 0x84, 0xf9, 0x8f, 0x7e, 0x1a, 0x1e, 0x74, 0x77, 0xdd,
+    0xac, 0xbe, 0x9c, 0xba, 0xe4, 0xab, 0x4a, 0xd3, 0x7a, 0xf8, 0x95, 0x11, 0x66, 0xc4, 0x49, 0x35,
+    0x9c, 0x5f, 0xf2, 0x0a, 0x04, 0x21, 0x08, 0x41, 0x08, 0x42, 0x10, 0x82, 0x10, 0x84, 0x20, 0x04,
+    0x21, 0x08, 0x41, 0x08, 0x42, 0x10, 0x82, 0xfc, 0x46, 0x90, 0xf0, 0x7f, 0xfd, 0x22, 0x08, 0x41,
+    0x08, 0x42, 0x10, 0x82, 0x10, 0x84, 0x20, 0x04, 0x21, 0x08, 0x41, 0x08, 0x42, 0x10, 0x82, 0x10,
+    0x84, 0x20, 0x04, 0x21, 0x08, 0x41, 0x08, 0x42, 0x10, 0x82, 0x10, 0x84, 0x20, 0x04, 0x21, 0x08,
+    0x41, 0x08, 0x42, 0x10, 0x82, 0x10, 0x84, 0x20, 0x04, 0x21, 0x08, 0x41, 0x08, 0x42, 0x10, 0x82,
+    0x10, 0xe4, 0x3f, 0x05, 0xe1, 0x9c, 0x46, 0x82, 0x10, 0x84, 0x20, 0x04, 0x21, 0x08, 0x41, 0x08,
+    0x42, 0x10, 0x82, 0x10, 0x84, 0x20, 0x04, 0x21, 0x08, 0x41, 0xbe, 0x15, 0x64, 0x8f, 0x68, 0xbd,
+    0xe0, 0xdf, 0x11, 0x5a, 0x93, 0x75, 0x8e, 0x68, 0x5d, 0x75, 0x9d, 0x6d, 0x0b, 0x67, 0x56, 0xea,
+    0x6e, 0x3d, 0xf7, 0x3c, 0x55, 0xc7, 0xb1, 0x5d, 0xf1, 0x61, 0x94, 0x71, 0x4e, 0xdc, 0x1a, 0xfb,
+    0xd2, 0x28, 0x7a, 0x2c, 0xaf, 0x9e, 0x8f, 0xa5, 0x9a, 0xda, 0xc4, 0xbf, 0x47, 0x62, 0xcd, 0xeb,
+    0xe7, 0x41, 0x54, 0xcf, 0xac, 0xa3, 0x2b, 0xde, 0xd5, 0x62, 0x43, 0x13, 0x8b, 0xa9, 0xe9, 0x41,
+    0x29, 0xce, 0x4c, 0xe3, 0x1e, 0x59, 0xb2, 0x84, 0x59, 0x9b, 0x53, 0x5b, 0xad, 0xf5, 0x7e, 0x35,
+    0x8f, 0x59, 0xd2, 0x98, 0xb1, 0x9c, 0x63, 0x2d, 0xcb, 0x39, 0x65, 0x17, 0xad, 0xad, 0xec, 0x9d,
+    0xba, 0x58, 0x7b, 0xa1, 0x47, 0xda, 0x2a, 0x51, 0x46, 0x1b, 0x6d, 0x9d, 0xe5, 0x0d, 0xd8, 0xad,
+    0x58, 0x31, 0x34, 0x2c, 0xe3, 0xcc, 0xa4, 0x8c, 0x7d, 0x1a, 0xfe, 0xd2, 0xda, 0xc7, 0xf0, 0x59,
+    0x97, 0x3a, 0xd2, 0xb1, 0xb3, 0x52, 0x3e, 0x6b, 0xfb, 0x67, 0xaf, 0x61, 0x53, 0xe7, 0xde, 0x7d,
+    0xee, 0x19, 0x4a, 0x43, 0xc9, 0xcf, 0xf7, 0x88, 0x99, 0x85, 0xa0, 0xde, 0x0b, 0x20, 0x72, 0x10,
+    0xb3, 0x68, 0xf1, 0xa0, 0xd4, 0x7b, 0xe4, 0x64, 0x4d, 0x07, 0x7f, 0x61, 0x36, 0x5c, 0xd3, 0x24,
+    0xf3, 0x31, 0xc0, 0xb4, 0xdb, 0x58, 0xad, 0x8d, 0x6d, 0x80, 0x9d, 0x07, 0xa6, 0x15, 0x6a, 0x68,
+    0x39, 0xc1, 0x3e, 0x63, 0x35, 0x79, 0xc1, 0xb4, 0xb6, 0x4a, 0x9b, 0x73, 0x28, 0x5c, 0x23, 0x2e,
+    0xff, 0x21, 0x2d, 0xf4, 0xd1, 0x87, 0xf7, 0x94, 0x9f, 0xf5, 0x1c, 0x93, 0x25, 0xcb, 0xc0, 0xcd,
+    0x30, 0xbb, 0x0c, 0xe4, 0xec, 0x9f, 0x7a, 0x6d, 0x31, 0x9d, 0x16, 0x0d, 0xff, 0x8f, 0x97, 0xc1,
+    0xb7, 0x44, 0xca, 0xda, 0x38, 0x54, 0x4e, 0x78, 0xa1, 0x47, 0x4e, 0xd5, 0x78, 0x66, 0xab, 0xa7,
+    0x9a, 0xa2, 0xf1, 0xde, 0x2c, 0x78, 0x73, 0x39, 0x70, 0x0e, 0x3f, 0xdb, 0x27, 0x8d, 0x92, 0x0b,
+    0x0c, 0x6b, 0xa1, 0x47, 0xd2, 0xa8, 0x6d, 0xd5, 0x84, 0x6f, 0xad, 0x3c, 0x23, 0xdc, 0x24, 0x06,
+    0x78, 0x13, 0x3c, 0x03, 0x20, 0x3b, 0xef, 0x94, 0x64, 0xa7, 0x00, 0x97, 0xa9, 0x2f, 0xf8, 0x88,
+    0x8d, 0xde, 0x74, 0xcf, 0x31, 0xc7, 0xa8, 0xaa, 0x68, 0x50, 0xaa, 0x6e, 0x67, 0x47, 0xdb, 0x3d,
+    0x93, 0x3d, 0xf6, 0x5e, 0x1b, 0x9e, 0x5f, 0xf0, 0x2b, 0x0f, 0x5d, 0xad, 0xa8, 0x23, 0xc9, 0xb2,
+    0x0d, 0xa7, 0xde, 0x18, 0xa5, 0x6c, 0xb5, 0x8d, 0xf1, 0xad, 0x6a, 0xdd, 0xb0, 0x2f, 0x7c, 0x29,
+    0xcc, 0xd5, 0xde, 0x18, 0xb5, 0x7a, 0x52, 0x0b, 0xda, 0x75, 0xcc, 0x6e, 0x6e, 0x6b, 0x01, 0x96,
+    0xd5, 0xe1, 0x0e, 0xa0, 0xc1, 0xf0, 0xdb, 0x72, 0x58, 0xf8, 0x6b, 0xb5, 0x62, 0x64, 0xca, 0x61,
+    0x97, 0xea, 0xa3, 0xef, 0xa9, 0x53, 0x7a, 0xc8, 0xd2, 0x77, 0xc0, 0xa0, 0x5c, 0x16, 0x7c, 0xaa,
+    0x05, 0x18, 0xdb, 0x6c, 0x21, 0xd6, 0x50, 0xb7, 0xbc, 0x00, 0x12, 0x73, 0x4e, 0x49, 0x63, 0x88,
+    0x51, 0xa3, 0x1b, 0x4d, 0x4c, 0x1a, 0x14, 0x57, 0xf3, 0x3d, 0xb3, 0xdc, 0x63, 0x84, 0xff, 0x8e,
+    0x1a, 0xd0, 0xfe, 0x1e, 0x30, 0x30, 0xf4, 0x80, 0xdf, 0xbb, 0x85, 0xbe, 0x04, 0x07, 0x2a, 0x61,
+    0x70, 0xb8, 0xc3, 0x76, 0x8b, 0x6d, 0xe7, 0xd8, 0x46, 0x9f, 0x01, 0x83, 0xc5, 0xcf, 0xfb, 0x08,
+    0x1a, 0xb1, 0x1b, 0x1a, 0x10, 0x0b, 0xba, 0x00, 0x0d, 0x0a, 0x63, 0xa4, 0x71, 0x19, 0xee, 0x99,
+    0xa4, 0xb2, 0x71, 0x53, 0x6c, 0xab, 0xfb, 0x58, 0x55, 0x6a, 0xc3, 0x3b, 0x4c, 0x2e, 0xe7, 0xba,
+    0xe0, 0x31, 0x0b, 0x78, 0xb8, 0xb5, 0x60, 0x10, 0x36, 0x54, 0xe8, 0xdd, 0x16, 0xce, 0x25, 0xbd,
+    0xe1, 0x23, 0x70, 0xf5, 0x90, 0xac, 0xa3, 0x3b, 0x60, 0x21, 0xd9, 0x7f, 0xd9, 0x3d, 0xd7, 0x74,
+    0xa7, 0xcf, 0x38, 0xb3, 0xb4, 0x04, 0xbe, 0xdc, 0x64, 0x4c, 0xff, 0x82, 0xd4, 0x59, 0x82, 0x75,
+    0xf7, 0x91, 0x94, 0x27, 0x86, 0xdb, 0x19, 0x71, 0x77, 0x99, 0xb8, 0x8e, 0x3e, 0x12, 0xdc, 0x80,
+    0x56, 0x83, 0xc5, 0x05, 0x9b, 0x6f, 0x98, 0x56, 0x4a, 0xb3, 0xf7, 0x92, 0x42, 0x4a, 0xf1, 0x19,
+    0x35, 0x2b, 0x1c, 0x7f, 0xa2, 0x79, 0xdd, 0xcf, 0x04, 0x77, 0xf5, 0x12, 0x4b, 0xa8, 0xb0, 0x1f,
+    0xf4, 0x03, 0xac, 0x29, 0xe2, 0x5e, 0x0f, 0x23, 0x2b, 0x33, 0xa4, 0x03, 0xba, 0xea, 0x7d, 0x58,
+    0xe0, 0x23, 0x25, 0x95, 0x0c, 0x4e, 0x54, 0xc7, 0xf0, 0x3b, 0x18, 0x34, 0x12, 0x84, 0x20, 0x04,
+    0x21, 0x08, 0x41, 0x08, 0x42, 0x90, 0xff, 0x2a, 0x43, 0x9c, 0xc8, 0x39, 0xa6, 0x17, 0x94, 0x6e,
+    0x23, 0xda, 0x1c, 0x9e, 0x85, 0x20, 0x61, 0xdc, 0x08, 0x3e, 0xb4, 0x89, 0x21, 0x84, 0x0f, 0x1e,
+    0x4b, 0xed, 0x56, 0x11, 0x17, 0xa6, 0x2c, 0x48, 0xa5, 0x52, 0xde, 0x2d, 0xee, 0x8a, 0x70, 0xf2,
+    0xaa, 0x28, 0x33, 0xcf, 0xd5, 0x4b, 0x3d, 0x48, 0xf0, 0xe7, 0x7b, 0x3d, 0xb2, 0x90, 0xe4, 0x2d,
+    0xe4, 0xdc, 0x75, 0xf4, 0x80, 0x5c, 0xb1, 0x78, 0x04, 0x1e, 0x11, 0x5e, 0x75, 0x0f, 0xfc, 0x5c,
+    0x62, 0xa9, 0xb3, 0x76, 0xf5, 0x78, 0xd7, 0xb4, 0xa4, 0x1a, 0x5c, 0x37, 0xa9, 0x88, 0x28, 0x51,
+    0x90, 0xbb, 0x3c, 0x2a, 0x8a, 0xd5, 0xd4, 0x11, 0x75, 0x22, 0x3b, 0xfc, 0xc9, 0xb8, 0xf7, 0x6f,
+    0x3d, 0x92, 0xd7, 0x8a, 0xae, 0x43, 0x99, 0x4e, 0xb4, 0xb7, 0x78, 0xee, 0x8a, 0x5f, 0x1f, 0x81,
+    0xf9, 0x0d, 0xfc, 0x56, 0xc9, 0xe6, 0x8a, 0x09, 0x48, 0xb5, 0x58, 0xca, 0x69, 0xba, 0x6e, 0x92,
+    0xa6, 0xa1, 0x27, 0xc4, 0xce, 0xf8, 0x4b, 0x45, 0xd9, 0xd3, 0x44, 0x66, 0xa8, 0x6d, 0x8f, 0xd7,
+    0x7a, 0xa4, 0x57, 0xe4, 0x18, 0xc8, 0x49, 0xd0, 0xae, 0xba, 0x2a, 0xe2, 0xf6, 0xab, 0xa4, 0x20,
+    0x6b, 0x45, 0x8f, 0x28, 0x0a, 0xa2, 0x5f, 0xc0, 0x0f, 0x3d, 0x86, 0xc5, 0xbf, 0x74, 0x93, 0xd3,
+    0x06, 0x92, 0x16, 0xfc, 0x04, 0x41, 0x1e, 0x15, 0x45, 0xd6, 0xd2, 0x93, 0x5b, 0x94, 0x85, 0x9e,
+    0x7a, 0x09, 0xc4, 0x92, 0xb4, 0x99, 0x00, 0xa2, 0x70, 0x05, 0x95, 0xb6, 0xb4, 0xb9, 0x92, 0x62,
+    0xc1, 0xd3, 0x2a, 0x8b, 0xa3, 0xb9, 0xc0, 0x82, 0xe2, 0x23, 0xd6, 0x91, 0x6f, 0xe9, 0xd5, 0x4d,
+    0x34, 0xe2, 0xac, 0xb6, 0x78, 0xda, 0x55, 0x51, 0x76, 0x70, 0xdd, 0x31, 0xad, 0x6d, 0x69, 0xed,
+    0xd7, 0x40, 0x24, 0x94, 0x29, 0xb0, 0x9c, 0x0e, 0x06, 0xd1, 0xa8, 0xee, 0x1a, 0xc8, 0x75, 0x55,
+    0x3c, 0x65, 0x57, 0x34, 0xbc, 0xd7, 0x5e, 0xca, 0x42, 0x0a, 0x3c, 0x4a, 0x1e, 0x76, 0xdc, 0xf6,
+    0x0c, 0x67, 0x2b, 0xef, 0x25, 0xf6, 0xa8, 0x28, 0xb5, 0x46, 0xf4, 0x54, 0xb0, 0x84, 0x9f, 0xe5,
+    0x35, 0xd3, 0xca, 0x4b, 0xb3, 0xfb, 0xc8, 0xaa, 0x6b, 0x54, 0x6d, 0x3e, 0x58, 0x9d, 0x54, 0x53,
+    0xcd, 0xa8, 0xb1, 0x51, 0x70, 0x56, 0x5b, 0xcd, 0x05, 0x95, 0xa0, 0xd6, 0xe5, 0xaa, 0xbb, 0x67,
+    0x82, 0x47, 0xd6, 0x44, 0x9d, 0xab, 0xa2, 0xc0, 0x24, 0xcb, 0x16, 0xcd, 0x48, 0x10, 0x7f, 0x32,
+    0x5b, 0xff, 0x5b, 0x8f, 0xd4, 0x24, 0xb5, 0x66, 0xb4, 0x39, 0xf4, 0x9d, 0x15, 0x96, 0x7f, 0x95,
+    0x94, 0x1d, 0x1c, 0x6e, 0xcf, 0x9e, 0x76, 0x8d, 0xa8, 0x02, 0x1f, 0x11, 0x0c, 0x6b, 0x19, 0x03,
+    0x6f, 0xf0, 0xe1, 0x77, 0x20, 0xeb, 0xc5, 0xc9, 0x7a, 0x54, 0x94, 0x0d, 0x47, 0x2f, 0xa8, 0x37,
+    0x4e, 0x5a, 0xaf, 0xf5, 0x48, 0xc8, 0xb3, 0x05, 0x57, 0xd3, 0x8f, 0x96, 0x70, 0xf2, 0x9d, 0x60,
+    0x17, 0x53, 0x4c, 0xc5, 0x41, 0xd4, 0x25, 0x16, 0x5c, 0x9a, 0x48, 0xdf, 0x87, 0x06, 0x09, 0x27,
+    0x3e, 0x52, 0x8b, 0x8d, 0x16, 0x02, 0x2c, 0xee, 0xaa, 0x28, 0xf0, 0xa8, 0x24, 0x96, 0x01, 0xda,
+    0xf6, 0x7b, 0xce, 0x5e, 0x70, 0x17, 0x44, 0xa3, 0x31, 0x80, 0x86, 0x2b, 0x62, 0xdb, 0x55, 0x52,
+    0xc2, 0x70, 0xb7, 0x55, 0xf5, 0x5e, 0xc1, 0x1f, 0x0c, 0xa6, 0xb4, 0x91, 0xd2, 0xe8, 0xe9, 0xca,
+    0x42, 0xa9, 0xb4, 0x9c, 0x55, 0xd0, 0x21, 0x57, 0x45, 0x81, 0x8f, 0x64, 0x1f, 0xe5, 0x4e, 0xea,
+    0xaf, 0xdd, 0x10, 0x6d, 0xee, 0x5d, 0xa7, 0x8b, 0xd9, 0x5d, 0xf0, 0x83, 0x87, 0x78, 0x7b, 0x64,
+    0xc7, 0xad, 0x00, 0xd9, 0x65, 0x85, 0x60, 0xb8, 0xe3, 0xe3, 0x76, 0xd1, 0x64, 0xe2, 0x26, 0x1f,
+    0x25, 0xa2, 0x3c, 0x4a, 0x13, 0x49, 0x18, 0xe5, 0xf6, 0xa3, 0xa2, 0xcc, 0x92, 0x67, 0x5a, 0x3d,
+    0xf4, 0x6a, 0xeb, 0x3d, 0x1f, 0x99, 0xbb, 0xd6, 0x85, 0x51, 0x2b, 0xcd, 0xb5, 0xfc, 0x70, 0xe3,
+    0xa8, 0xa7, 0xe6, 0x3b, 0xfc, 0xa6, 0x09, 0x37, 0x81, 0xa3, 0xc0, 0xe7, 0x65, 0x4c, 0xd8, 0xd8,
+    0x74, 0xdd, 0x64, 0xce, 0x25, 0xbd, 0x84, 0x8e, 0x3a, 0xf5, 0xe9, 0x3f, 0xdb, 0x82, 0xd7, 0x1e,
+    0xf5, 0x3d, 0x1f, 0x61, 0xf4, 0x4b, 0x10, 0x82, 0x10, 0x84, 0x20, 0x04, 0x21, 0xc8, 0x6f, 0x02,
+    0x09, 0xd2, 0x92, 0x07, 0xb4, 0xd3, 0xf2, 0x72, 0x0d, 0xa4, 0x27, 0xe4, 0x8b, 0x1e, 0x0f, 0x0a,
+    0x32, 0x74, 0x7f, 0x2c, 0x97, 0x92, 0x1f, 0x5a, 0xb4, 0xb8, 0xda, 0xd2, 0x4d, 0x65, 0xa3, 0xfc,
+    0xcc, 0x33, 0x11, 0x75, 0x75, 0x04, 0x97, 0x59, 0xfa, 0x78, 0x1f, 0xc4, 0x6a, 0x97, 0x18, 0xfc,
+    0xf1, 0x72, 0xbb, 0xa9, 0xf9, 0xc9, 0x52, 0xf6, 0x99, 0xb1, 0x95, 0x9e, 0x07, 0xda, 0xa7, 0xb8,
+    0xea, 0x35, 0xfc, 0x01, 0xf6, 0x8d, 0xc3, 0xfc, 0xe1, 0x7a, 0xf6, 0xef, 0xb5, 0xe0, 0x81, 0x7e,
+    0x6e, 0xe5, 0x54, 0xc9, 0xed, 0xfd, 0x1e, 0xb1, 0x23, 0xea, 0xc1, 0xf7, 0x1e, 0x67, 0xef, 0xe7,
+    0xc9, 0xf3, 0x3e, 0x3e, 0x65, 0x28, 0x8e, 0xe9, 0x79, 0xbb, 0x5f, 0xc5, 0xb1, 0x05, 0x99, 0xd5,
+    0x9d, 0xf5, 0x13, 0xa3, 0x03, 0x7a, 0x7d, 0xf0, 0xcc, 0x55, 0x7b, 0x6a, 0x69, 0xbd, 0x0f, 0xb2,
+    0xad, 0x35, 0xb7, 0x91, 0x93, 0xd3, 0xd5, 0x40, 0xec, 0x20, 0x3c, 0x3f, 0x7b, 0x6d, 0x95, 0x3a,
+    0xbc, 0xdc, 0xaf, 0xe2, 0xb8, 0xcf, 0xac, 0x3b, 0x12, 0xc5, 0x8a, 0x6b, 0xf5, 0xd6, 0xf7, 0x1e,
+    0xe9, 0xd1, 0x55, 0x8b, 0x1e, 0xdf, 0x37, 0x2d, 0xb4, 0xa3, 0x7b, 0x8b, 0x0c, 0x49, 0x92, 0xfa,
+    0x0c, 0x20, 0xcb, 0x22, 0x67, 0x34, 0xf4, 0x46, 0x5f, 0xde, 0x53, 0x7e, 0x15, 0x87, 0x4d, 0xbc,
+    0xdc, 0x7b, 0x72, 0x6c, 0xa7, 0xdf, 0xfa, 0x77, 0x7a, 0x81, 0xa4, 0x53, 0x90, 0xea, 0xbe, 0xdf,
+    0x23, 0xd6, 0x4b, 0x0e, 0x3e, 0xa1, 0xc9, 0x53, 0x77, 0xd7, 0x40, 0x4a, 0x46, 0xba, 0x3a, 0xb4,
+    0xe7, 0xbe, 0xcc, 0x93, 0x44, 0x5c, 0xbd, 0x35, 0x66, 0x9b, 0xf0, 0x05, 0x58, 0x14, 0xae, 0x39,
+    0x38, 0x72, 0x61, 0xef, 0x30, 0xb8, 0x92, 0x4e, 0xf8, 0xc9, 0xfb, 0x3e, 0xb2, 0x0a, 0xdc, 0xf7,
+    0x6a, 0x59, 0x8f, 0x06, 0xb2, 0x67, 0xdd, 0x47, 0x91, 0xb3, 0x22, 0x75, 0x84, 0x0f, 0xab, 0x4f,
+    0x2e, 0xf3, 0x63, 0xf7, 0xbd, 0xe0, 0x23, 0x30, 0xb2, 0x34, 0x9f, 0x59, 0x44, 0x15, 0xb5, 0xc7,
+    0x0a, 0x48, 0x8e, 0xe3, 0x37, 0xf8, 0x48, 0xcd, 0xe5, 0x0a, 0x0e, 0x68, 0x9e, 0x24, 0x8c, 0x5e,
+    0x9e, 0xcf, 0xc2, 0xf4, 0xbb, 0xcc, 0x36, 0x06, 0xda, 0xe7, 0x57, 0x8b, 0xcf, 0xe8, 0x0a, 0x96,
+    0x6a, 0x46, 0xa2, 0x18, 0xe2, 0x6c, 0xb7, 0xbe, 0xcf, 0xe0, 0x72, 0x45, 0x42, 0x35, 0xea, 0x17,
+    0x98, 0x16, 0xee, 0x10, 0xe3, 0x4e, 0x53, 0x4a, 0x16, 0x5d, 0x03, 0xf1, 0x39, 0x25, 0x67, 0xf6,
+    0x5a, 0x43, 0xec, 0xee, 0x13, 0xb8, 0x1a, 0x70, 0x5c, 0x31, 0x05, 0xe3, 0xee, 0x42, 0xe6, 0x1b,
+    0xdc, 0xb7, 0x77, 0x72, 0x4c, 0x75, 0x3d, 0x35, 0x14, 0xf9, 0x02, 0x67, 0x9f, 0x9a, 0x8a, 0xab,
+    0x3d, 0x1d, 0x2d, 0x72, 0x27, 0xde, 0x75, 0x8d, 0x33, 0xdc, 0xe8, 0x15, 0x4d, 0x3f, 0x7e, 0xb5,
+    0xe0, 0x10, 0xf0, 0xb9, 0x44, 0x34, 0x86, 0x4f, 0xe6, 0x72, 0xdf, 0x3a, 0x3e, 0x9f, 0x6b, 0x9a,
+    0x5b, 0x5f, 0xb2, 0xf7, 0x7b, 0x44, 0xad, 0x37, 0x7f, 0x94, 0x60, 0x18, 0x96, 0x8a, 0xc1, 0xb4,
+    0x9a, 0x34, 0x39, 0x3d, 0x5b, 0x48, 0xb1, 0x67, 0x7f, 0x44, 0x52, 0xa2, 0x1f, 0xb8, 0x8e, 0x1a,
+    0x68, 0xf9, 0x08, 0x79, 0xde, 0xfa, 0x6b, 0xf8, 0x0d, 0x71, 0xd7, 0x20, 0xb2, 0xf7, 0x37, 0x8c,
+    0x5a, 0x79, 0xfb, 0x28, 0x74, 0x7c, 0xa6, 0x8f, 0x6b, 0x20, 0x30, 0x24, 0x8c, 0x5a, 0x0d, 0x23,
+    0x6a, 0xf5, 0x69, 0x96, 0xc7, 0xaf, 0xe2, 0xd0, 0x5e, 0xba, 0xab, 0x2d, 0x9a, 0x60, 0x79, 0x1e,
+    0x01, 0xd4, 0xe9, 0x77, 0x93, 0x11, 0x36, 0x22, 0x81, 0x18, 0xbe, 0x60, 0xd4, 0x62, 0xf4, 0x4b,
+    0x10, 0x82, 0x10, 0x84, 0x20, 0x04, 0x21, 0xc8, 0x2f, 0x02, 0xd1, 0x26, 0x57, 0x23, 0xf1, 0x1c,
+    0x69, 0x4c, 0x3d, 0x32, 0x8f, 0xaf, 0xcf, 0x59, 0xa3, 0xe7, 0x58, 0x8b, 0x07, 0x90, 0xf8, 0xec,
+    0xb1, 0xd5, 0x88, 0xe3, 0x29, 0x4f, 0x38, 0xf7, 0x05, 0x19, 0x12, 0x5b, 0xcf, 0xae, 0xa5, 0xc4,
+    0x27, 0x57, 0x7e, 0xbb, 0x47, 0x54, 0xaf, 0x46, 0x82, 0x70, 0x31, 0x9c, 0xb0, 0x76, 0xaa, 0xbe,
+    0x3e, 0xc7, 0xd2, 0xc8, 0xa5, 0x17, 0x0d, 0x09, 0x91, 0x30, 0x92, 0x27, 0x84, 0xb8, 0xd1, 0x1f,
+    0x28, 0xde, 0xf2, 0xd4, 0x7d, 0x9e, 0x8a, 0xaf, 0xdc, 0xc9, 0xa5, 0xb6, 0x30, 0xbb, 0x84, 0xf5,
+    0x0d, 0xa6, 0xb5, 0xae, 0x46, 0x72, 0x05, 0xa1, 0xe3, 0x53, 0xab, 0xc7, 0xb9, 0xaa, 0xd5, 0x41,
+    0x7f, 0x88, 0xb8, 0xd2, 0x55, 0x23, 0x52, 0x72, 0x7d, 0x16, 0x65, 0x4c, 0x57, 0x23, 0xcc, 0x83,
+    0xc9, 0xbb, 0x72, 0xc7, 0xe7, 0x9e, 0x24, 0xbc, 0xe7, 0x2f, 0x30, 0xad, 0xd5, 0xae, 0x46, 0x82,
+    0x8f, 0x32, 0x91, 0xed, 0xc6, 0x9c, 0xbc, 0x59, 0x3e, 0xb7, 0xa4, 0xda, 0xc9, 0xc8, 0xcb, 0x55,
+    0x97, 0xf7, 0xc5, 0xf2, 0xf5, 0x4a, 0xb7, 0xfc, 0x51, 0x51, 0x7c, 0xe5, 0xce, 0xc9, 0xae, 0xa5,
+    0x54, 0xfb, 0x86, 0x1e, 0xb1, 0xb8, 0xae, 0x46, 0xe2, 0x7a, 0x42, 0x46, 0x92, 0x81, 0x56, 0xfb,
+    0xfa, 0x1c, 0x0d, 0x3e, 0x1b, 0xa3, 0x67, 0x5f, 0x25, 0x73, 0xee, 0xf2, 0x30, 0x15, 0xcf, 0x67,
+    0x51, 0x9e, 0xd5, 0x9f, 0x44, 0xa3, 0xa6, 0x98, 0xcf, 0x3d, 0x31, 0x83, 0x25, 0x7e, 0x81, 0xb3,
+    0x9b, 0xea, 0xa3, 0x91, 0xc0, 0xfe, 0xd1, 0x38, 0x6f, 0x3f, 0xf2, 0x11, 0x8b, 0x48, 0x6e, 0x5b,
+    0xde, 0x78, 0x3f, 0x7d, 0xdc, 0xe5, 0x55, 0xe2, 0x0f, 0x70, 0x6f, 0x79, 0xec, 0xcd, 0xd7, 0x54,
+    0x59, 0x83, 0xbb, 0x20, 0x69, 0xd4, 0xf6, 0xc2, 0x54, 0x9a, 0x7f, 0x27, 0x3e, 0x5c, 0x9d, 0xc4,
+    0xd7, 0xe4, 0x2c, 0x64, 0xdf, 0xce, 0xe0, 0x9f, 0xcb, 0xde, 0x2b, 0xc0, 0x7b, 0x7c, 0x1d, 0x4f,
+    0x17, 0x90, 0xec, 0x6a, 0xe3, 0x29, 0x9f, 0x65, 0xbb, 0xc4, 0x9a, 0x7d, 0x68, 0x58, 0xae, 0xa5,
+    0x84, 0x59, 0xbf, 0x41, 0xa0, 0x9b, 0xeb, 0x6a, 0x24, 0x20, 0x18, 0xd6, 0x2a, 0x12, 0xf3, 0xb9,
+    0xa2, 0xbb, 0xf2, 0x0a, 0xa1, 0x96, 0x86, 0xac, 0x56, 0xa7, 0x0f, 0xbf, 0x3b, 0xc3, 0x57, 0x6e,
+    0x79, 0x9c, 0x01, 0xa3, 0x98, 0xf9, 0xca, 0x9d, 0xe5, 0x6b, 0x78, 0xf0, 0xde, 0xda, 0x17, 0x80,
+    0xe8, 0xa3, 0x91, 0x5c, 0xa1, 0x6a, 0xb4, 0x31, 0x7c, 0x55, 0x8e, 0xcb, 0x75, 0xb1, 0xce, 0x68,
+    0xe9, 0x4a, 0x76, 0xae, 0x2c, 0x6a, 0xd0, 0x98, 0x9f, 0xf2, 0x54, 0x3c, 0x69, 0x1f, 0x7d, 0xc6,
+    0xd8, 0x76, 0x1a, 0x75, 0x86, 0xf1, 0x05, 0x20, 0xaa, 0x7a, 0x35, 0x12, 0x1f, 0x40, 0x73, 0xf3,
+    0x19, 0x10, 0xe6, 0xeb, 0x73, 0x62, 0xda, 0x55, 0x72, 0x28, 0x68, 0xfc, 0x84, 0xc7, 0xbb, 0x80,
+    0xe7, 0x32, 0xd1, 0x2d, 0x8f, 0x49, 0xbc, 0xb6, 0x09, 0x3e, 0x77, 0x8c, 0xc6, 0xe2, 0xdf, 0x7b,
+    0xbf, 0x47, 0x4a, 0xbf, 0x1a, 0x89, 0x23, 0xb4, 0x81, 0x11, 0xcc, 0x66, 0x13, 0x9f, 0x39, 0xda,
+    0x0a, 0x1c, 0x7f, 0xe6, 0x75, 0xd6, 0xec, 0xd3, 0x67, 0x3e, 0xa9, 0xdf, 0xdf, 0xbd, 0x3c, 0xdf,
+    0xd5, 0x3d, 0xbe, 0x72, 0xc7, 0xd7, 0xf0, 0xf8, 0x5a, 0x9f, 0xf1, 0x15, 0xc3, 0x6f, 0xbe, 0x1a,
+    0xc9, 0xd5, 0x4b, 0xea, 0x11, 0xa9, 0xeb, 0xaa, 0x43, 0xbb, 0x60, 0x90, 0x15, 0x31, 0x9f, 0x78,
+    0x79, 0x35, 0xea, 0x15, 0x52, 0xbe, 0xe5, 0xd1, 0xee, 0x2c, 0x3b, 0x5f, 0xb9, 0x53, 0x60, 0x7f,
+    0xd5, 0xe7, 0x3c, 0x32, 0x68, 0x24, 0x08, 0x41, 0x08, 0x42, 0x10, 0x82, 0x10, 0x84, 0x20, 0xff,
+    0xdb, 0x58, 0x8b, 0xfb, 0xa2, 0x70, 0x5f, 0x94, 0x0f, 0xf5, 0x08, 0xf7, 0x45, 0xe1, 0xbe, 0x28,
+    0x1f, 0x4a, 0xac, 0xb8, 0x2f, 0x0a, 0xf7, 0x45, 0xf9, 0x90, 0x8f, 0x70, 0x5f, 0x14, 0xee, 0x8b,
+    0xc2, 0xa0, 0x91, 0x20, 0x04, 0x21, 0x08, 0x41, 0x08, 0x42, 0x10, 0x82, 0xfc, 0x31, 0x43, 0xe4,
+    0xbe, 0x28, 0xdc, 0x17, 0xe5, 0x43, 0x3d, 0xc2, 0x7d, 0x51, 0xb8, 0x2f, 0xca, 0x87, 0x4c, 0x8b,
+    0xfb, 0xa2, 0x70, 0x5f, 0x94, 0x0f, 0xf5, 0x08, 0xf7, 0x45, 0xe1, 0xbe, 0x28, 0x0c, 0x1a, 0x09,
+    0x42, 0x10, 0x82, 0x10, 0x84, 0x20, 0x04, 0x21, 0xc8, 0x9f, 0xa3, 0x5f, 0xee, 0x8b, 0xc2, 0x7d,
+    0x51, 0x3e, 0x23, 0x07, 0x71, 0x5f, 0x14, 0xee, 0x8b, 0xf2, 0x29, 0xc9, 0x94, 0xfb, 0xa2, 0x70,
+    0x5f, 0x94, 0xcf, 0xf4, 0x08, 0xf7, 0x45, 0xe1, 0xbe, 0x28, 0x0c, 0x1a, 0x09, 0x42, 0x10, 0x82,
+    0x10, 0x84, 0x20, 0x04, 0x21, 0xc8, 0x1f, 0x63, 0x2d, 0xee, 0x8b, 0xc2, 0x7d, 0x51, 0x3e, 0x64,
+    0x5a, 0xdc, 0x17, 0x85, 0xfb, 0xa2, 0x7c, 0x4a, 0x7c, 0xe0, 0xbe, 0x28, 0xdc, 0x17, 0xe5, 0x33,
+    0xa3, 0x16, 0xf7, 0x45, 0xe1, 0xbe, 0x28, 0x0c, 0x1a, 0x09, 0x42, 0x10, 0x82, 0x10, 0x84, 0x20,
+    0x04, 0x21, 0xc8, 0x1f, 0x63, 0x2d, 0xee, 0x8b, 0xc2, 0x7d, 0x51, 0x3e, 0xd4, 0x23, 0xdc, 0x17,
+    0x85, 0xfb, 0xa2, 0x7c, 0x28, 0xb1, 0xe2, 0xbe, 0x28, 0xdc, 0x17, 0xe5, 0x43, 0x3e, 0xc2, 0x7d,
+    0x51, 0xb8, 0x2f, 0x0a, 0x83, 0x46, 0x82, 0x10, 0x84, 0x20, 0x04, 0x21, 0x08, 0x41, 0x08, 0x42,
+    0x10, 0x82, 0x10, 0x84, 0x20, 0x04, 0x21, 0x08, 0x41, 0x08, 0x42, 0x10, 0x82, 0x10, 0x84, 0x20,
+    0x04, 0x21, 0x08, 0x41, 0x08, 0x42, 0x10, 0x82, 0x10, 0x84, 0x20, 0x04, 0x21, 0x08, 0x41, 0x08,
+    0x42, 0x10, 0x82, 0x10, 0x84, 0x20, 0x04, 0x21, 0x08, 0x41, 0x08, 0x42, 0x10, 0x82, 0x10, 0x84,
+    0x20, 0x04, 0x21, 0x08, 0x41, 0x08, 0x42, 0x10, 0x82, 0x10, 0x84, 0x20, 0x04, 0x21, 0x08, 0x41,
+    0x08, 0x42, 0x10, 0x82, 0x10, 0x84, 0x20, 0x04, 0x21, 0x08, 0x41, 0x08, 0x42, 0x10, 0x82, 0x10,
+    0x84, 0x20, 0x04, 0x21, 0x08, 0x41, 0x08, 0x42, 0x10, 0x82, 0x10, 0x84, 0x20, 0x04, 0x21, 0x08,
+    0x41, 0x08, 0x42, 0x10, 0x82, 0x10, 0x84, 0x20, 0x04, 0x21, 0x08, 0x41, 0x08, 0x42, 0x10, 0x82,
+    0x10, 0x84, 0x20, 0x04, 0x21, 0x08, 0x41, 0x08, 0x42, 0x10, 0x82, 0x10, 0x84, 0x20, 0x04, 0x21,
+    0x08, 0x41, 0x08, 0x42, 0x10, 0x82, 0x10, 0x84, 0x20, 0x04, 0x21, 0x08, 0x41, 0x08, 0x42, 0x10,
+    0x82, 0x10, 0x84, 0x20, 0x04, 0x21, 0x08, 0x41, 0x08, 0x42, 0x10, 0x82, 0x10, 0x84, 0x20, 0x04,
+    0x21, 0xc8, 0x97, 0x80, 0xfc, 0xf3, 0x1f, 0xcf, 0x8b, 0x20, 0x04, 0x21, 0x08, 0x41, 0x08, 0x42,
+    0x10, 0x82, 0x10, 0x84, 0x20, 0x04, 0x21, 0x08, 0x41, 0x08, 0x42, 0x10, 0x82, 0x10, 0x84, 0x20,
+    0x04, 0x21, 0x08, 0x41, 0x08, 0x42, 0x10, 0x82, 0x7c, 0x0a, 0xe4, 0x77, 0xbc, 0x08, 0x42, 0x10,
+    0x82, 0x10, 0x84, 0x20, 0x04, 0x21, 0x08, 0x5e, 0xff, 0x02, 0x9c, 0x7c, 0x3f, 0x51, 0x15, 0xe8,
+    0xf4, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+// 800x480 2-bpp grayscale with 3 colors (black/white/red on 3-color panels)
+static const uint8_t png_2bit_3color[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x01, 0xe0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x32, 0xdc, 0x4e,
+    0x88, 0x00, 0x00, 0x12, 0xc9, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed, 0x9c, 0x41, 0xca, 0xac,
+    0x3c, 0x16, 0x86, 0x03, 0x4e, 0x85, 0x6c, 0x25, 0xe0, 0x34, 0x90, 0x55, 0x88, 0x23, 0x71, 0x15,
+    0xe2, 0x48, 0xdc, 0x4f, 0xaf, 0x22, 0x90, 0x69, 0x20, 0x23, 0x71, 0x24, 0x6e, 0x21, 0x10, 0x44,
+    0x68, 0x22, 0xe9, 0xf7, 0x58, 0xf7, 0x8e, 0xba, 0xe1, 0x87, 0xa6, 0xab, 0xbd, 0xfd, 0xf5, 0x29,
+    0x29, 0x2b, 0x96, 0x29, 0xc9, 0x53, 0x39, 0x27, 0xc9, 0x79, 0x8d, 0x11, 0xe5, 0x87, 0xbc, 0x04,
+    0x83, 0x30, 0x08, 0x83, 0x30, 0x08, 0x83, 0x30, 0x08, 0x83, 0x30, 0x08, 0x83, 0x30, 0x08, 0x83,
+    0x30, 0x08, 0x83, 0x30, 0xc8, 0x4f, 0x04, 0x11, 0xff, 0xd3, 0x2f, 0x06, 0x61, 0x10, 0x06, 0x61,
+    0x10, 0x06, 0x61, 0x10, 0x06, 0x61, 0x10, 0x06, 0x61, 0x10, 0x06, 0x61, 0x10, 0x06, 0x61, 0x10,
+    0x06, 0x61, 0x10, 0x06, 0x61, 0x10, 0x06, 0x61, 0x10, 0x06, 0x61, 0x10, 0x06, 0x61, 0x10, 0x06,
+    0x61, 0x10, 0x06, 0x61, 0x10, 0x06, 0x61, 0x10, 0x06, 0x61, 0x10, 0x06, 0x61, 0x10, 0x06, 0x61,
+    0x10, 0x06, 0x61, 0x90, 0x7f, 0x17, 0x84, 0xe7, 0x34, 0x32, 0x08, 0x83, 0x30, 0x08, 0x83, 0x30,
+    0x08, 0x83, 0x30, 0x08, 0x83, 0x30, 0x08, 0x83, 0x30, 0x08, 0x83, 0x30, 0x08, 0x83, 0xfc, 0xa9,
+    0x20, 0x51, 0xe5, 0x3a, 0x99, 0xba, 0x4e, 0x4e, 0x0a, 0x53, 0x92, 0x4f, 0xbe, 0x14, 0x57, 0xf9,
+    0x6c, 0x4a, 0x0e, 0x56, 0xfa, 0xd2, 0x94, 0x12, 0x9a, 0x50, 0xeb, 0xd0, 0xd4, 0x22, 0x07, 0x1c,
+    0x55, 0x3a, 0xda, 0xda, 0xe0, 0x33, 0x69, 0x55, 0x49, 0xad, 0xbc, 0xaa, 0x12, 0x5d, 0x26, 0x65,
+    0xab, 0x22, 0xb6, 0xb7, 0x40, 0xb2, 0x73, 0xc2, 0x36, 0x95, 0xb0, 0x31, 0xeb, 0x80, 0x42, 0xcb,
+    0x20, 0x4b, 0x10, 0xc2, 0x03, 0xa4, 0x76, 0xd9, 0x24, 0x89, 0x3c, 0xba, 0x72, 0xb1, 0xb6, 0xb2,
+    0xb8, 0xa2, 0x0d, 0x8a, 0xab, 0x8d, 0x42, 0xd1, 0x8b, 0x94, 0xd2, 0x6b, 0x49, 0xf8, 0x92, 0x2e,
+    0x13, 0xbc, 0x76, 0x1e, 0x5b, 0x78, 0x09, 0x24, 0x35, 0xd6, 0x96, 0x26, 0xda, 0x64, 0x42, 0xc6,
+    0x91, 0x74, 0x32, 0x14, 0xd7, 0x10, 0x53, 0x41, 0xdd, 0x24, 0x5f, 0xe1, 0xd3, 0xd4, 0xc5, 0x44,
+    0xe7, 0x4a, 0xa9, 0x8d, 0xc9, 0x4a, 0x87, 0xe8, 0x09, 0x24, 0x37, 0xb9, 0xd1, 0x4d, 0x96, 0xb2,
+    0xd0, 0x0f, 0x9b, 0xa0, 0xaa, 0xc6, 0x61, 0x7b, 0x0b, 0x24, 0x8a, 0x9c, 0x8a, 0xf1, 0x29, 0xe6,
+    0x04, 0x73, 0x2a, 0xd6, 0x58, 0x53, 0x42, 0xcc, 0x05, 0xe9, 0x10, 0x9b, 0x60, 0x2a, 0xca, 0xeb,
+    0x92, 0xad, 0x93, 0x76, 0x9a, 0x7e, 0xa5, 0xb3, 0xd1, 0xa8, 0x85, 0x52, 0x27, 0x19, 0x84, 0x94,
+    0xc1, 0xa7, 0x3a, 0x3d, 0x97, 0xc9, 0x42, 0x44, 0x6c, 0xaf, 0x99, 0x96, 0xb7, 0xa1, 0x58, 0x11,
+    0x52, 0x6c, 0x22, 0x99, 0x93, 0x86, 0xfd, 0x67, 0x51, 0xa8, 0xa8, 0xb1, 0x12, 0x31, 0x3c, 0xf6,
+    0x1f, 0x6c, 0x41, 0xa6, 0x28, 0x95, 0xa2, 0x7a, 0xc8, 0xb2, 0x81, 0xaf, 0x58, 0x6d, 0x2a, 0xef,
+    0x01, 0x5a, 0x59, 0x4d, 0x97, 0x71, 0xc6, 0x3f, 0xaf, 0xb7, 0x6a, 0xa4, 0x78, 0x95, 0x95, 0x14,
+    0xf8, 0x9b, 0x33, 0xea, 0x22, 0x37, 0x75, 0x03, 0x8b, 0x37, 0x28, 0x65, 0xc9, 0x95, 0xd3, 0x9a,
+    0xb2, 0x45, 0xaf, 0xd1, 0x04, 0x80, 0xd5, 0x45, 0x6f, 0xb2, 0x91, 0xe1, 0xf1, 0x9c, 0x20, 0x53,
+    0xc8, 0x2e, 0x85, 0xca, 0x04, 0xf9, 0x5c, 0xa6, 0x82, 0x0d, 0xd2, 0xf6, 0x96, 0x69, 0xc1, 0x0d,
+    0x94, 0xf3, 0x95, 0x76, 0x21, 0xa0, 0x0c, 0xf0, 0xf5, 0x50, 0x92, 0xa9, 0x24, 0x40, 0x54, 0x0c,
+    0x9a, 0xca, 0x98, 0x4d, 0x23, 0x2b, 0xd8, 0x96, 0x87, 0xf1, 0x19, 0x00, 0xa9, 0xa8, 0x51, 0x4f,
+    0x0d, 0xbc, 0x5b, 0x6a, 0xaf, 0x9b, 0x40, 0x6e, 0x11, 0x93, 0x35, 0x78, 0x63, 0x7b, 0xcd, 0x47,
+    0x60, 0xda, 0x45, 0xc1, 0xbc, 0xa3, 0x43, 0xa9, 0xb3, 0xae, 0xb1, 0x77, 0x15, 0xd5, 0x4e, 0xf1,
+    0x22, 0xa9, 0x8a, 0x4c, 0x2c, 0x56, 0xae, 0x4a, 0xde, 0x84, 0x46, 0x45, 0x93, 0x85, 0xd6, 0x8a,
+    0x3c, 0x47, 0x7b, 0x59, 0x4b, 0x2b, 0x6b, 0x85, 0xd4, 0x73, 0x99, 0x1a, 0x6f, 0x6c, 0xf2, 0x2d,
+    0x1f, 0xa9, 0x93, 0x12, 0xca, 0x29, 0x51, 0xd5, 0x35, 0x7d, 0x2d, 0x05, 0x4a, 0x62, 0xad, 0x23,
+    0x7f, 0x51, 0xb0, 0x2e, 0xb4, 0x55, 0x40, 0xad, 0xeb, 0xc6, 0x56, 0xc1, 0xc2, 0xcb, 0xb3, 0x17,
+    0xc2, 0x11, 0x9e, 0x11, 0x42, 0xd9, 0x20, 0x94, 0x90, 0x46, 0xd0, 0x65, 0x8a, 0xac, 0xeb, 0x8c,
+    0xed, 0x2d, 0x67, 0x4f, 0x46, 0x78, 0x55, 0x2b, 0x78, 0x6d, 0x83, 0x3f, 0x36, 0xa3, 0x7f, 0x0b,
+    0xe4, 0xe5, 0xe8, 0xd7, 0x72, 0x55, 0xeb, 0xc7, 0xe0, 0x51, 0x57, 0x75, 0xca, 0xf8, 0x70, 0xd1,
+    0x99, 0xdc, 0x48, 0xeb, 0x83, 0xa3, 0x6e, 0x24, 0x36, 0x4d, 0x8c, 0x4d, 0x71, 0x68, 0x80, 0x71,
+    0x19, 0x49, 0x16, 0x89, 0xed, 0xb5, 0x1a, 0xc9, 0xb6, 0x8a, 0x46, 0x55, 0xb1, 0x8a, 0x39, 0xa0,
+    0xf1, 0xc9, 0xc0, 0xb1, 0xde, 0xa2, 0x6b, 0xc8, 0xd2, 0x7b, 0xd4, 0xc3, 0xd3, 0xd5, 0xc8, 0xac,
+    0x7d, 0xe5, 0x1d, 0x5a, 0x2b, 0x32, 0x9f, 0x62, 0xd0, 0x6a, 0xa1, 0xa7, 0x37, 0xc1, 0x0b, 0xa3,
+    0x64, 0x53, 0xd3, 0x65, 0x82, 0xa8, 0xe9, 0xd7, 0xf9, 0x35, 0x1f, 0xb1, 0xa8, 0x82, 0x64, 0x43,
+    0xac, 0xa9, 0xef, 0x46, 0x79, 0xd1, 0x17, 0xa6, 0xc6, 0x90, 0xe3, 0xe7, 0x24, 0xa8, 0xe8, 0x70,
+    0x64, 0xa1, 0xaa, 0x50, 0x34, 0x2a, 0x2e, 0xa1, 0x46, 0x32, 0xea, 0x8b, 0xcc, 0x4f, 0x09, 0x5b,
+    0x63, 0x44, 0x90, 0x71, 0x05, 0xba, 0x8c, 0xf6, 0xd6, 0x2a, 0x6c, 0x6f, 0xb5, 0x5a, 0x3c, 0xfa,
+    0x65, 0x10, 0x06, 0x61, 0x10, 0x06, 0x61, 0x10, 0x06, 0xf9, 0x51, 0x2a, 0x8a, 0x8d, 0x08, 0x32,
+    0x30, 0xce, 0x40, 0x14, 0xf8, 0x8c, 0xa4, 0x42, 0x48, 0x32, 0xe9, 0x40, 0x3a, 0x8a, 0x95, 0x88,
+    0x54, 0x48, 0x7c, 0x08, 0xb1, 0xb2, 0xa1, 0x4a, 0x55, 0x6a, 0x62, 0x79, 0x46, 0x5b, 0x39, 0xc8,
+    0xe6, 0x77, 0x2a, 0x8b, 0xd0, 0x60, 0xec, 0xf8, 0x36, 0x48, 0xb2, 0x92, 0x0a, 0xa7, 0x75, 0xed,
+    0x10, 0xf7, 0xc5, 0x54, 0xb9, 0xa2, 0x8a, 0x72, 0xce, 0x22, 0xd4, 0x93, 0x4a, 0x64, 0x1a, 0x00,
+    0xe7, 0xe8, 0x30, 0x42, 0x2e, 0xb2, 0xc8, 0x8a, 0x86, 0x55, 0x49, 0x25, 0x1c, 0xe1, 0x04, 0xa5,
+    0x2a, 0x17, 0x93, 0xd1, 0x75, 0x65, 0x5e, 0xaf, 0x11, 0x04, 0xd9, 0x18, 0xf5, 0x06, 0x04, 0xb3,
+    0xa4, 0x98, 0xa4, 0xa2, 0xb5, 0xd5, 0xd6, 0xe8, 0x47, 0x47, 0xd1, 0xda, 0x24, 0x8c, 0xd8, 0x55,
+    0x2e, 0xa1, 0x26, 0xb1, 0x24, 0x27, 0x2a, 0x6f, 0xc2, 0x86, 0xa0, 0xd7, 0x7c, 0x52, 0xc8, 0x82,
+    0x18, 0xa0, 0x7a, 0xbf, 0x46, 0xb2, 0xc2, 0x48, 0x17, 0x31, 0x6c, 0x40, 0x38, 0x51, 0x42, 0x8c,
+    0x91, 0x64, 0x08, 0x45, 0x3a, 0x4a, 0x2e, 0xb2, 0x09, 0x14, 0x6c, 0xe4, 0xca, 0xb8, 0x60, 0xea,
+    0x54, 0x27, 0x84, 0x25, 0xc8, 0x13, 0xa2, 0xad, 0xe9, 0x02, 0x94, 0x8a, 0x78, 0x17, 0xf1, 0x5f,
+    0x0f, 0x70, 0xff, 0x85, 0xb3, 0x0b, 0x8d, 0x21, 0x7a, 0xce, 0x32, 0x8a, 0x90, 0x4a, 0xb0, 0xbe,
+    0xd4, 0xcf, 0x66, 0x10, 0x0c, 0x66, 0x99, 0x6b, 0x92, 0x51, 0x10, 0x2f, 0x56, 0x75, 0x41, 0x45,
+    0xe9, 0x4c, 0xc5, 0x27, 0x77, 0x0a, 0x24, 0x29, 0x52, 0xca, 0x17, 0x69, 0xa3, 0x72, 0xe6, 0x7d,
+    0x90, 0x90, 0x23, 0xed, 0x75, 0x65, 0xf1, 0x55, 0x12, 0xd6, 0x09, 0x44, 0xe2, 0xd8, 0xc3, 0x07,
+    0x14, 0x05, 0xaf, 0x70, 0x63, 0xa7, 0x7c, 0x25, 0x1d, 0x89, 0x90, 0x22, 0x52, 0x9e, 0x24, 0x7c,
+    0x41, 0x4c, 0xf9, 0xa4, 0xac, 0x6b, 0x44, 0xf4, 0x55, 0x7c, 0x1d, 0x24, 0x07, 0xa7, 0xf1, 0x41,
+    0xb2, 0xed, 0xa3, 0x8e, 0x16, 0xf0, 0x58, 0x54, 0x02, 0xe9, 0x28, 0xc9, 0x07, 0x93, 0x2b, 0x52,
+    0x16, 0x72, 0xb2, 0x4d, 0xf3, 0x68, 0xc0, 0x4f, 0x1e, 0xed, 0xac, 0x26, 0x1f, 0xd1, 0x94, 0xdf,
+    0xe8, 0x6c, 0x54, 0xfd, 0x07, 0x34, 0xbf, 0x28, 0x2e, 0x5a, 0xad, 0xc6, 0x0b, 0xb4, 0x3c, 0x3e,
+    0x2a, 0x6f, 0x1b, 0xdb, 0x44, 0x9f, 0xad, 0x41, 0xf4, 0xea, 0x4a, 0x0d, 0xeb, 0x77, 0xf8, 0x4a,
+    0x90, 0xf4, 0xe3, 0x13, 0x7e, 0xe6, 0x63, 0x1d, 0xab, 0x14, 0xa3, 0x79, 0x52, 0xca, 0xe3, 0x37,
+    0x51, 0xbc, 0xef, 0xec, 0x05, 0xae, 0x8d, 0x06, 0x09, 0x61, 0x6b, 0xe3, 0x1c, 0x0e, 0xd0, 0x44,
+    0x69, 0x34, 0x56, 0x8a, 0x74, 0x94, 0x4a, 0x8b, 0x47, 0x8b, 0x8b, 0xc2, 0x86, 0x46, 0xc0, 0x6b,
+    0x04, 0x5c, 0x85, 0x7e, 0xd0, 0xf8, 0x26, 0x0b, 0xf3, 0xa4, 0x50, 0x97, 0x48, 0xd7, 0xf6, 0xf5,
+    0xe6, 0x17, 0x08, 0x64, 0xdf, 0x16, 0x5e, 0x40, 0xae, 0xd2, 0xf8, 0x47, 0x05, 0xf1, 0x12, 0x81,
+    0x38, 0x35, 0xb6, 0x35, 0xcc, 0xac, 0xb8, 0x5a, 0x87, 0xda, 0x49, 0xbc, 0x50, 0x45, 0x74, 0x97,
+    0xa1, 0x49, 0xe8, 0x5a, 0xcc, 0x93, 0xf2, 0x12, 0xdd, 0xa1, 0xab, 0xd4, 0xfb, 0xa6, 0xd5, 0x34,
+    0x2a, 0x50, 0x1f, 0x2d, 0x83, 0xad, 0x0a, 0x3a, 0x45, 0x9f, 0x85, 0x16, 0x92, 0x74, 0x14, 0x98,
+    0x3e, 0xda, 0x29, 0x98, 0x96, 0x0f, 0xd2, 0x0b, 0xd3, 0xd4, 0x4d, 0x4d, 0xb7, 0x42, 0x1c, 0x7a,
+    0x78, 0xad, 0x53, 0xf3, 0x49, 0x49, 0xef, 0x52, 0xd3, 0x58, 0xf9, 0xbe, 0xb3, 0x7b, 0xaa, 0x8b,
+    0x5c, 0x55, 0x19, 0xe5, 0x41, 0x3b, 0xd4, 0x78, 0x7c, 0x36, 0x8d, 0x2f, 0xe8, 0x5d, 0x54, 0x95,
+    0x1c, 0x75, 0x8c, 0xce, 0x7b, 0x81, 0xe6, 0x57, 0xa1, 0x96, 0x34, 0xb5, 0x5a, 0x8d, 0xa8, 0x02,
+    0xfa, 0xf3, 0x27, 0x85, 0xfc, 0x02, 0xfd, 0xfb, 0x1f, 0xd0, 0xfc, 0xf2, 0xe8, 0x97, 0x41, 0x18,
+    0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0xe4, 0x27, 0x81, 0x88, 0x86, 0x86, 0x53, 0x42, 0xd9, 0x64,
+    0x64, 0x93, 0x30, 0xc4, 0x35, 0x74, 0x97, 0x16, 0x03, 0x79, 0x95, 0x0c, 0x02, 0xf5, 0x27, 0x65,
+    0xbc, 0x57, 0x4d, 0xa4, 0x23, 0x5b, 0x2b, 0x4d, 0x93, 0x04, 0x4a, 0xaa, 0x45, 0xa6, 0x93, 0x9a,
+    0x24, 0x14, 0x64, 0x79, 0x7f, 0xac, 0xa5, 0x03, 0xcd, 0x3b, 0x41, 0xa8, 0x84, 0x81, 0x53, 0x8c,
+    0x8d, 0x8c, 0x99, 0x06, 0x4e, 0x95, 0x12, 0x46, 0x4a, 0xba, 0xcd, 0x4e, 0xa9, 0xec, 0x84, 0xa9,
+    0x14, 0x1d, 0x49, 0x15, 0xab, 0x6c, 0x44, 0x28, 0xcf, 0xd4, 0x14, 0x9c, 0xcc, 0xb1, 0x52, 0x94,
+    0xe5, 0xfd, 0x1a, 0xc9, 0x85, 0x6e, 0xa4, 0xe5, 0xe8, 0x43, 0x53, 0x1e, 0xb5, 0x2a, 0xd0, 0x54,
+    0x0e, 0x54, 0x8f, 0xcc, 0xb1, 0xf6, 0x9f, 0x54, 0x12, 0x78, 0x9b, 0xfa, 0xd1, 0xb8, 0x68, 0x68,
+    0x59, 0x40, 0x01, 0x0c, 0x0c, 0x1b, 0x8d, 0xc2, 0x60, 0x9f, 0xb2, 0xfc, 0x01, 0x2a, 0x8a, 0xce,
+    0x12, 0xfb, 0x26, 0x1b, 0xe3, 0x11, 0xbf, 0xda, 0xf0, 0xdc, 0x5b, 0x4f, 0xd9, 0x27, 0xe7, 0x8c,
+    0xfb, 0xa4, 0x82, 0xf5, 0x29, 0x65, 0x1c, 0x65, 0x12, 0x26, 0x10, 0x4c, 0x86, 0xf2, 0x4c, 0x4d,
+    0xc1, 0xc9, 0x5c, 0xa5, 0x4c, 0x59, 0xde, 0x07, 0x89, 0x8d, 0x41, 0xb1, 0x22, 0x9c, 0xc3, 0x56,
+    0x26, 0xd8, 0xba, 0x0a, 0xcf, 0xd4, 0x1f, 0x51, 0xaa, 0x06, 0x66, 0xf3, 0x3b, 0x55, 0xaa, 0x2c,
+    0x70, 0x94, 0xb3, 0xb4, 0x52, 0x90, 0x28, 0x44, 0x53, 0x53, 0x68, 0xd6, 0x8a, 0x75, 0xcf, 0x7d,
+    0xde, 0xf7, 0x43, 0xdd, 0x6c, 0x15, 0x95, 0xd6, 0x9a, 0x10, 0x25, 0x3c, 0x5e, 0xd6, 0x08, 0x34,
+    0xc8, 0xf9, 0x63, 0x65, 0xaa, 0x9a, 0x0a, 0x4c, 0x29, 0x78, 0x88, 0x11, 0x91, 0x8e, 0x94, 0x24,
+    0x09, 0x0f, 0xac, 0x36, 0x90, 0x74, 0x27, 0xa2, 0x53, 0x34, 0x27, 0xe8, 0x4f, 0x88, 0x47, 0x82,
+    0x32, 0x8f, 0x1c, 0x14, 0xac, 0x0b, 0x51, 0x38, 0xa7, 0x23, 0xc9, 0x29, 0xb5, 0x46, 0xdb, 0x25,
+    0x7c, 0xfe, 0xa4, 0xaa, 0x42, 0x02, 0x0a, 0x1d, 0x25, 0x34, 0x52, 0x41, 0xeb, 0xaa, 0xf8, 0x44,
+    0xe6, 0x54, 0xeb, 0x48, 0x13, 0x8a, 0x74, 0xf3, 0xbe, 0x40, 0x97, 0x34, 0x82, 0x3f, 0xda, 0xdb,
+    0xa2, 0xea, 0xc6, 0xa8, 0xea, 0x99, 0x2c, 0x80, 0xe0, 0x4f, 0x15, 0xd7, 0x50, 0x83, 0x4b, 0x29,
+    0x11, 0x14, 0x3e, 0x49, 0x35, 0x0d, 0x42, 0xe9, 0xa4, 0x8c, 0x29, 0x34, 0x35, 0x85, 0x62, 0x44,
+    0x67, 0x49, 0xdd, 0x52, 0xef, 0xf7, 0x23, 0x34, 0x89, 0x44, 0xd2, 0x3e, 0x2a, 0x15, 0xbc, 0x52,
+    0x2e, 0x92, 0x52, 0x52, 0xaa, 0x5a, 0xc8, 0xec, 0xc8, 0xf4, 0x29, 0x15, 0xa3, 0x90, 0xf8, 0x9a,
+    0x8e, 0x4c, 0xae, 0xb3, 0x70, 0xa6, 0xd0, 0xd4, 0x14, 0x83, 0x93, 0x51, 0x54, 0x35, 0x65, 0x79,
+    0xbf, 0x46, 0xfc, 0x67, 0xff, 0x08, 0x42, 0x55, 0xac, 0xd5, 0x67, 0xf6, 0x9c, 0x70, 0xc5, 0x29,
+    0x63, 0xeb, 0x4f, 0x8a, 0x94, 0x14, 0xfc, 0xf7, 0x35, 0x09, 0x2b, 0xa8, 0x12, 0x43, 0x5e, 0xf4,
+    0xcc, 0x0d, 0x84, 0x29, 0xd6, 0xc2, 0xfd, 0xca, 0xf2, 0xb2, 0x8a, 0x02, 0x6b, 0x91, 0xd8, 0xdb,
+    0x46, 0x99, 0x06, 0x46, 0xd3, 0xa8, 0x20, 0xa9, 0x43, 0x4c, 0x4a, 0x9a, 0xa6, 0x6a, 0x3e, 0xa9,
+    0x28, 0x94, 0xac, 0x12, 0x8e, 0x48, 0x53, 0xf4, 0xbe, 0x71, 0xa1, 0xd0, 0xd4, 0x14, 0xd4, 0x48,
+    0xf2, 0xcf, 0x7d, 0x13, 0xf5, 0x07, 0xa8, 0x28, 0xb6, 0x26, 0xa5, 0x91, 0xf6, 0x70, 0x5f, 0x93,
+    0x7c, 0x25, 0x9e, 0x3e, 0x41, 0xe7, 0x18, 0x1a, 0xef, 0x3f, 0x29, 0xef, 0x73, 0x2c, 0x9a, 0x8e,
+    0x54, 0xd5, 0x34, 0xc2, 0x3e, 0xc2, 0xa9, 0xa2, 0x49, 0xb3, 0xda, 0x79, 0x12, 0x4e, 0xf3, 0xfb,
+    0xda, 0x2f, 0x8f, 0x7e, 0x19, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x7e, 0x12, 0x48,
+    0xca, 0xce, 0x21, 0xa2, 0x52, 0xd1, 0x26, 0x47, 0xd3, 0xfb, 0xbd, 0x56, 0x16, 0xa3, 0xe0, 0xa4,
+    0xf5, 0x33, 0x09, 0x36, 0xaa, 0xe4, 0x2a, 0x27, 0x30, 0x6e, 0x8f, 0x2a, 0x3b, 0xf1, 0x48, 0x2d,
+    0xcf, 0xf8, 0x44, 0x87, 0x4a, 0x26, 0xed, 0x95, 0x56, 0x14, 0x46, 0x36, 0x56, 0xbd, 0x5e, 0x23,
+    0x1e, 0xe3, 0x5d, 0xed, 0x9d, 0xb3, 0x74, 0x0f, 0xbd, 0x64, 0x27, 0xa5, 0xaa, 0x11, 0xf6, 0x36,
+    0xcf, 0xfc, 0x6a, 0x5b, 0x3b, 0x1b, 0x63, 0x2c, 0x34, 0x5d, 0xc5, 0xd9, 0x2a, 0x3d, 0x52, 0x4b,
+    0xa1, 0x69, 0xd8, 0x18, 0x80, 0x69, 0xdb, 0x90, 0xd4, 0x82, 0xd1, 0x56, 0xa6, 0x67, 0x04, 0xde,
+    0x06, 0x51, 0x88, 0xd4, 0x73, 0x6a, 0x2c, 0x06, 0xb3, 0xe1, 0xb9, 0xaf, 0x96, 0x6b, 0x09, 0x08,
+    0x87, 0x38, 0xbd, 0x44, 0xef, 0x1a, 0x67, 0xe8, 0x04, 0xcd, 0x6a, 0x06, 0xd2, 0x47, 0x6a, 0x41,
+    0x0d, 0x64, 0x95, 0x1b, 0x4d, 0xb3, 0xc9, 0x91, 0x2d, 0xd0, 0xd3, 0x3d, 0xcd, 0xdb, 0x20, 0x39,
+    0x8b, 0x9c, 0xb2, 0x12, 0x78, 0x53, 0x64, 0x18, 0xac, 0x0c, 0xc1, 0x78, 0xf0, 0xc8, 0xf0, 0x4c,
+    0x54, 0x41, 0xa8, 0x8e, 0x2d, 0x18, 0x7a, 0x66, 0x27, 0xfc, 0x92, 0x5a, 0xe8, 0xe9, 0x8c, 0x5c,
+    0x09, 0x49, 0x37, 0x10, 0x65, 0x30, 0xae, 0xc4, 0x4a, 0x89, 0xd7, 0x7d, 0xc4, 0xb8, 0xd8, 0x44,
+    0xed, 0x83, 0xa0, 0x27, 0x7a, 0xf0, 0x57, 0xd3, 0xb4, 0x13, 0xc4, 0x82, 0xe6, 0xf3, 0x50, 0x12,
+    0x8c, 0x8e, 0x4e, 0xd3, 0x74, 0x15, 0x1f, 0x7e, 0x4b, 0x2d, 0x70, 0xa5, 0xca, 0x3a, 0x8c, 0xea,
+    0x11, 0x90, 0xd0, 0xc4, 0xfe, 0x47, 0x33, 0x7a, 0xbb, 0x46, 0xe0, 0xaa, 0xf4, 0x2c, 0x0f, 0x42,
+    0x70, 0xba, 0x63, 0x5b, 0x84, 0x49, 0x41, 0xba, 0xca, 0x34, 0xf9, 0x99, 0xf0, 0x83, 0x00, 0xca,
+    0xfc, 0x0e, 0x37, 0xbc, 0x82, 0x59, 0x91, 0xd4, 0x42, 0x55, 0x15, 0x1c, 0x7c, 0xbf, 0xc9, 0x15,
+    0xb2, 0xfb, 0x0a, 0xff, 0x46, 0xf8, 0xaf, 0x3f, 0xc9, 0xf3, 0x4f, 0x20, 0x26, 0xbb, 0x10, 0x14,
+    0x22, 0xbd, 0xe7, 0xc9, 0xbb, 0xaa, 0x90, 0x0f, 0x37, 0x41, 0x0a, 0x4f, 0x4f, 0x4e, 0x05, 0x9b,
+    0xe8, 0x91, 0x3c, 0xd2, 0xe2, 0x62, 0x72, 0x3a, 0x3f, 0x52, 0x0b, 0x7c, 0xc4, 0xeb, 0x98, 0xa5,
+    0x86, 0x6d, 0x05, 0xaf, 0x73, 0x2a, 0x88, 0xe9, 0xd3, 0xeb, 0x35, 0x52, 0xd3, 0xb3, 0x3c, 0x82,
+    0x26, 0x40, 0x44, 0xd2, 0xb3, 0x82, 0xac, 0x85, 0x54, 0xf4, 0x88, 0x52, 0xfd, 0x34, 0xbf, 0x59,
+    0x60, 0xe7, 0x60, 0x38, 0x31, 0x57, 0x32, 0x7e, 0xa4, 0x16, 0xf8, 0x08, 0x5a, 0x33, 0x09, 0x77,
+    0x42, 0xc6, 0xba, 0xb1, 0x85, 0xfc, 0x48, 0xbe, 0xdd, 0x6a, 0x49, 0x7a, 0x96, 0xe7, 0x51, 0x51,
+    0x68, 0x12, 0x07, 0xfe, 0x5b, 0xd5, 0x08, 0xa0, 0x84, 0x47, 0xe2, 0x89, 0xba, 0x8e, 0x95, 0xa8,
+    0x2a, 0x9a, 0xae, 0x52, 0x47, 0xf1, 0x91, 0x5a, 0x48, 0x9b, 0x50, 0x34, 0x3f, 0x05, 0x99, 0x48,
+    0xd4, 0x43, 0x8b, 0xf6, 0xc2, 0x93, 0x3c, 0xff, 0xa2, 0x67, 0xaf, 0xd0, 0xf8, 0x98, 0x5a, 0x84,
+    0x8f, 0x5c, 0x18, 0x9b, 0xda, 0x15, 0x47, 0x8f, 0xf3, 0x91, 0x5c, 0xea, 0x8c, 0x84, 0x37, 0xab,
+    0xf8, 0x88, 0xd9, 0x59, 0x3f, 0x52, 0xcb, 0x93, 0xc9, 0xd5, 0x0d, 0x3d, 0xdb, 0x87, 0xa6, 0x40,
+    0xa3, 0x21, 0x28, 0x8d, 0x79, 0xbd, 0x46, 0x84, 0xa8, 0x62, 0xf6, 0xa4, 0xa2, 0x3c, 0x25, 0x14,
+    0x34, 0x0b, 0x48, 0xc9, 0x98, 0x9e, 0x27, 0x11, 0x1b, 0x4d, 0x0f, 0xfc, 0x54, 0x89, 0xa6, 0xab,
+    0xa0, 0x63, 0x8f, 0x8f, 0xd4, 0x42, 0x35, 0x62, 0x7c, 0x08, 0x3e, 0x26, 0x25, 0xd1, 0x25, 0x7a,
+    0x54, 0xab, 0xce, 0xaf, 0xf7, 0x23, 0xde, 0xd6, 0xb5, 0x15, 0xf4, 0x40, 0x0e, 0xe9, 0x8a, 0xde,
+    0x0b, 0x92, 0xaf, 0xa2, 0x34, 0xc2, 0x3e, 0x27, 0x2d, 0xfa, 0xf9, 0xba, 0x86, 0xd5, 0x45, 0x6b,
+    0xc2, 0x2f, 0xa9, 0x05, 0xbf, 0x46, 0xeb, 0x8b, 0x2f, 0x4d, 0x86, 0x85, 0x79, 0x58, 0x5c, 0x8a,
+    0xd6, 0xbc, 0x6f, 0x5a, 0x3c, 0xfa, 0x65, 0x10, 0x06, 0x61, 0x10, 0x06, 0x61, 0x10, 0x06, 0xf9,
+    0x31, 0x20, 0xbc, 0x2e, 0x0a, 0xaf, 0x8b, 0xf2, 0x2d, 0xd3, 0xe2, 0x75, 0x51, 0x78, 0x5d, 0x94,
+    0x2f, 0x99, 0x16, 0xaf, 0x8b, 0xc2, 0xeb, 0xa2, 0x7c, 0x4b, 0x32, 0xe5, 0x75, 0x51, 0x78, 0x5d,
+    0x14, 0x1e, 0x34, 0x32, 0x08, 0x83, 0x30, 0x08, 0x83, 0x30, 0x08, 0x83, 0x30, 0xc8, 0x5f, 0x0e,
+    0x51, 0x78, 0x5d, 0x14, 0x5e, 0x17, 0xe5, 0x3b, 0x35, 0xc2, 0xeb, 0xa2, 0xf0, 0xba, 0x28, 0x5f,
+    0x8a, 0x10, 0x79, 0x5d, 0x14, 0x5e, 0x17, 0xe5, 0x4b, 0xa6, 0xc5, 0xeb, 0xa2, 0xf0, 0xba, 0x28,
+    0x3c, 0x68, 0x64, 0x10, 0x06, 0x61, 0x10, 0x06, 0x61, 0x10, 0x06, 0x61, 0x90, 0xbf, 0x8e, 0x10,
+    0x79, 0x5d, 0x14, 0x5e, 0x17, 0xe5, 0x4b, 0x2a, 0x0a, 0xaf, 0x8b, 0xc2, 0xeb, 0xa2, 0x7c, 0x49,
+    0x0e, 0xe2, 0x75, 0x51, 0x78, 0x5d, 0x94, 0xef, 0xd4, 0x08, 0xaf, 0x8b, 0xc2, 0xeb, 0xa2, 0xf0,
+    0xa0, 0x91, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0xfe, 0x3a, 0xd4, 0xe5,
+    0x75, 0x51, 0x78, 0x5d, 0x94, 0xef, 0x8c, 0x7e, 0x79, 0x5d, 0x14, 0x5e, 0x17, 0xe5, 0x4b, 0x20,
+    0xbc, 0x2e, 0x0a, 0xaf, 0x8b, 0xf2, 0xb5, 0x9e, 0x9d, 0xd7, 0x45, 0xe1, 0x75, 0x51, 0x78, 0xd0,
+    0xc8, 0x20, 0x0c, 0xc2, 0x20, 0x0c, 0xc2, 0x20, 0x0c, 0xc2, 0x20, 0x7f, 0x31, 0x8c, 0xe7, 0x75,
+    0x51, 0x78, 0x5d, 0x94, 0x2f, 0x99, 0x16, 0xaf, 0x8b, 0xc2, 0xeb, 0xa2, 0x7c, 0xc9, 0xb4, 0x78,
+    0x5d, 0x14, 0x5e, 0x17, 0xe5, 0x5b, 0x92, 0x29, 0xaf, 0x8b, 0xc2, 0xeb, 0xa2, 0xf0, 0xa0, 0x91,
+    0x41, 0xfe, 0x23, 0xaf, 0xf6, 0x6b, 0x2f, 0x06, 0x61, 0x10, 0x06, 0x61, 0x10, 0x06, 0x61, 0x10,
+    0x06, 0x61, 0x10, 0x06, 0x61, 0x10, 0x06, 0x61, 0x10, 0x06, 0x61, 0x10, 0x06, 0x61, 0xf1, 0x81,
+    0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41,
+    0x18, 0x84, 0x41, 0x18, 0xe4, 0xe7, 0x81, 0x9c, 0xdd, 0xb2, 0xd3, 0xbe, 0x1f, 0xa6, 0xf3, 0x5a,
+    0xa6, 0xb3, 0xbb, 0xae, 0xb9, 0x94, 0x6b, 0xe9, 0x37, 0x7c, 0xb1, 0x7e, 0x52, 0xdd, 0xbd, 0x6f,
+    0xdd, 0xd2, 0xe2, 0xe8, 0x6e, 0xb7, 0x6e, 0xbd, 0xef, 0x63, 0x29, 0xe3, 0x3a, 0x1c, 0x38, 0xd9,
+    0xed, 0x78, 0x53, 0xe6, 0x72, 0xdd, 0xeb, 0x7a, 0x8e, 0xef, 0x81, 0x6c, 0xfb, 0xbd, 0xd1, 0x7e,
+    0x6e, 0xbb, 0x71, 0x18, 0xba, 0xb1, 0x0c, 0xeb, 0x04, 0xb0, 0xa9, 0xed, 0xce, 0xf3, 0x5a, 0x87,
+    0x27, 0x55, 0xf6, 0xb1, 0x3b, 0xa7, 0x8e, 0x8e, 0xae, 0xa1, 0x5d, 0xb6, 0xb3, 0x07, 0x51, 0xb9,
+    0x17, 0x9c, 0x1c, 0x8e, 0x76, 0x6a, 0x29, 0x4b, 0x29, 0xfb, 0xb4, 0xf6, 0xdb, 0xf1, 0x9e, 0x69,
+    0x1d, 0x17, 0x09, 0x37, 0x47, 0x8f, 0xbf, 0xf6, 0x46, 0x9d, 0x94, 0xbb, 0x00, 0xac, 0x4c, 0xe7,
+    0x59, 0x8e, 0x76, 0x3f, 0x3e, 0xa9, 0xb1, 0x3d, 0xf1, 0x49, 0x47, 0xd7, 0x36, 0x2d, 0x65, 0x39,
+    0xcb, 0x3d, 0x2f, 0xe5, 0xc2, 0xc9, 0x6b, 0x38, 0xa6, 0x27, 0x4b, 0x41, 0xa6, 0x7d, 0x9b, 0xde,
+    0x03, 0x59, 0xb6, 0x63, 0xa5, 0xfd, 0xb2, 0x5d, 0xf7, 0x86, 0x77, 0x7f, 0xb5, 0x13, 0x7d, 0xbd,
+    0x1f, 0xf3, 0x3c, 0xe1, 0x4f, 0x7f, 0x52, 0x77, 0x7f, 0x2c, 0xcb, 0x86, 0xa3, 0xe3, 0x3c, 0xce,
+    0x6d, 0x5e, 0x7b, 0x20, 0xec, 0x54, 0xe8, 0xe5, 0x58, 0x97, 0xe5, 0x40, 0x16, 0xfc, 0x01, 0x77,
+    0x77, 0x8f, 0xed, 0x7b, 0xa6, 0xb5, 0x74, 0xd3, 0x4d, 0xfb, 0xb3, 0xbb, 0xdb, 0xe9, 0xbe, 0xdb,
+    0x75, 0x2e, 0x28, 0x7d, 0x59, 0x87, 0x73, 0x5a, 0x8e, 0x76, 0xf9, 0x9d, 0x3a, 0x97, 0x15, 0x46,
+    0x55, 0x8e, 0xf5, 0x6e, 0xcf, 0x61, 0x01, 0xc2, 0x3d, 0xb4, 0xa8, 0x91, 0xb5, 0xef, 0x71, 0x02,
+    0x59, 0x50, 0x3f, 0xc8, 0x3e, 0xef, 0xef, 0xd5, 0xc8, 0xde, 0x51, 0x69, 0xf7, 0xee, 0x2e, 0x2d,
+    0x3c, 0xbe, 0x3d, 0x8f, 0x81, 0xc0, 0xce, 0xa1, 0x9d, 0xce, 0xf1, 0x38, 0x7e, 0xa5, 0xe0, 0x21,
+    0xe7, 0x30, 0x90, 0x65, 0xb5, 0x65, 0xb9, 0xb6, 0xbd, 0x2c, 0x77, 0x5f, 0x60, 0x5c, 0xe7, 0xd0,
+    0x4f, 0xed, 0x80, 0x8d, 0xdc, 0xaa, 0x2b, 0x47, 0xd9, 0x97, 0xd7, 0x40, 0xee, 0xab, 0x7b, 0xf6,
+    0xfb, 0xdd, 0xcf, 0xa5, 0xed, 0xe7, 0xe9, 0x18, 0x60, 0x1f, 0xe7, 0xb6, 0xcd, 0xe5, 0xec, 0x41,
+    0x42, 0xa9, 0x73, 0xb9, 0xe6, 0x73, 0xdb, 0x89, 0x6b, 0x46, 0x2b, 0x76, 0x6d, 0xeb, 0x72, 0x1f,
+    0x33, 0xcc, 0xe9, 0xdc, 0x8e, 0x61, 0xdd, 0x56, 0xca, 0x5c, 0x4e, 0x7c, 0xb7, 0x5e, 0xef, 0xd5,
+    0xc8, 0xb4, 0xb6, 0xe4, 0xd1, 0x6b, 0x3f, 0x5c, 0xed, 0x36, 0x5d, 0xb0, 0x0e, 0xfa, 0xe7, 0xcb,
+    0xd8, 0x0d, 0xf7, 0x34, 0xae, 0x9f, 0xd4, 0xd9, 0x5f, 0x03, 0x7c, 0x19, 0x47, 0xfb, 0xd9, 0x75,
+    0xc7, 0xd4, 0x5d, 0xe5, 0xde, 0xee, 0x0b, 0xd5, 0x30, 0xf6, 0xf3, 0x30, 0x0e, 0xc8, 0x02, 0x90,
+    0xfe, 0x5c, 0xcf, 0x7b, 0x78, 0x0d, 0x64, 0x3d, 0xa8, 0xc9, 0x59, 0x8f, 0xd2, 0x75, 0xfd, 0xbd,
+    0x75, 0xfd, 0xd2, 0x8e, 0x64, 0x50, 0xe3, 0xda, 0xc2, 0x4e, 0x60, 0xfa, 0x4f, 0x6a, 0x68, 0x5b,
+    0x18, 0x1a, 0x1d, 0x4d, 0xc8, 0xba, 0xf6, 0x13, 0x9a, 0xdf, 0xf9, 0xee, 0x70, 0xf2, 0x68, 0xdb,
+    0x71, 0xa5, 0x2c, 0xa5, 0x0c, 0xc3, 0x39, 0xf7, 0xef, 0x39, 0xfb, 0x7c, 0x7c, 0xf6, 0x6b, 0xdf,
+    0x6e, 0xe3, 0xd2, 0x6e, 0x70, 0x85, 0x8b, 0xfe, 0xde, 0xe5, 0x9e, 0xe0, 0xfe, 0xc7, 0x93, 0x82,
+    0xe1, 0xdf, 0xf8, 0xef, 0x71, 0x74, 0xc0, 0x5f, 0x3a, 0xb4, 0x6d, 0xf8, 0x49, 0x4f, 0x3e, 0xd2,
+    0xcf, 0xe3, 0xda, 0x8f, 0x9f, 0x2c, 0xd4, 0x5b, 0x2e, 0xef, 0xd5, 0xc8, 0xb0, 0x9f, 0x2d, 0xed,
+    0x3b, 0x18, 0xcc, 0x82, 0xf7, 0xd4, 0x9f, 0x04, 0xb2, 0x4c, 0xed, 0x75, 0x8d, 0xe8, 0x33, 0x28,
+    0x55, 0xda, 0xae, 0x3d, 0x17, 0x3a, 0xda, 0xae, 0x76, 0xdf, 0xb7, 0x79, 0x2e, 0xf7, 0x3a, 0xef,
+    0x13, 0x4e, 0xce, 0x3b, 0x4e, 0x50, 0x16, 0xba, 0x41, 0x31, 0xcd, 0xf7, 0x8b, 0xad, 0x16, 0x4a,
+    0xf6, 0x6b, 0x3f, 0xa3, 0x6f, 0x9b, 0xd7, 0x71, 0xa0, 0x7f, 0xf7, 0x3a, 0x8e, 0xfe, 0x7a, 0x5a,
+    0x53, 0x4a, 0xc1, 0xcf, 0x87, 0x6b, 0xc7, 0x11, 0x3a, 0x99, 0x69, 0xec, 0xbb, 0xa7, 0x67, 0x6c,
+    0xd1, 0x71, 0x5e, 0xfb, 0x7c, 0x5c, 0xd8, 0x8e, 0xa1, 0xdc, 0xfb, 0xbe, 0xaf, 0xeb, 0x7b, 0xad,
+    0x16, 0x8f, 0x7e, 0x19, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x7e, 0x12, 0xc8, 0xb2,
+    0xcf, 0x23, 0x06, 0x82, 0x43, 0x3f, 0xcc, 0x23, 0x86, 0x1c, 0x08, 0x77, 0x7b, 0x8c, 0x82, 0x87,
+    0x69, 0xdb, 0x30, 0xfe, 0xeb, 0x87, 0x0e, 0x5f, 0xcf, 0x23, 0xc6, 0xed, 0xa5, 0x1b, 0xf6, 0xf1,
+    0x23, 0xb5, 0xd0, 0xf8, 0xa4, 0xdb, 0xcf, 0x11, 0xe1, 0xee, 0xd6, 0x6d, 0x14, 0x38, 0x5e, 0x33,
+    0x0d, 0xe4, 0xf7, 0xb2, 0x5f, 0xef, 0x81, 0xa0, 0xd0, 0xc3, 0xb6, 0xef, 0xf3, 0xdc, 0x0e, 0x34,
+    0x72, 0xdd, 0xc7, 0xf3, 0x6a, 0xd7, 0xee, 0xee, 0x46, 0xd2, 0x13, 0xe6, 0x76, 0x9f, 0x07, 0xbc,
+    0x0a, 0x15, 0x73, 0x6e, 0x97, 0x8f, 0xd4, 0x82, 0x31, 0xe5, 0x59, 0x8e, 0x7e, 0xdb, 0xbb, 0xb1,
+    0x3b, 0xcf, 0x1b, 0xe3, 0xe7, 0x75, 0xda, 0x67, 0xd2, 0x23, 0xda, 0xe3, 0x3d, 0x10, 0x0c, 0x03,
+    0x6f, 0x8c, 0xce, 0xe7, 0x7e, 0xa7, 0x10, 0x17, 0x61, 0xd4, 0xb2, 0xae, 0x28, 0xe7, 0x3d, 0x51,
+    0x60, 0x8e, 0x2f, 0xe7, 0xe9, 0xc6, 0x09, 0x9c, 0x9a, 0x80, 0xf4, 0x91, 0x5a, 0x48, 0xec, 0xda,
+    0x86, 0x6d, 0x3a, 0x6e, 0x50, 0x2f, 0x07, 0xfd, 0x6c, 0x9b, 0x48, 0x0c, 0xdb, 0xca, 0xf0, 0x1e,
+    0xc8, 0xb1, 0x0e, 0xc7, 0xb2, 0xb5, 0x03, 0x8a, 0x46, 0x92, 0xc2, 0xdd, 0xde, 0xf7, 0x75, 0x1f,
+    0x63, 0x37, 0xde, 0x8f, 0xc4, 0x82, 0x7a, 0x3a, 0x06, 0x0c, 0x84, 0x31, 0x4a, 0x1f, 0x40, 0xf1,
+    0x48, 0x2d, 0xa8, 0x91, 0xbb, 0xac, 0x23, 0x62, 0xfc, 0xf9, 0x18, 0x91, 0x7b, 0x29, 0x2d, 0x22,
+    0x77, 0xc4, 0x02, 0xfd, 0x9b, 0x35, 0x32, 0xdd, 0x4b, 0xb7, 0x74, 0x3b, 0x62, 0xd8, 0xa5, 0x7b,
+    0xfe, 0x6a, 0x44, 0x7d, 0x88, 0x33, 0xae, 0x0b, 0xf1, 0x60, 0x39, 0x71, 0x82, 0x4e, 0xaf, 0xf8,
+    0xbf, 0x31, 0xce, 0xff, 0x25, 0xb5, 0x20, 0x1b, 0x62, 0x41, 0x8c, 0xf1, 0x2f, 0x44, 0x8c, 0xd8,
+    0x1e, 0xcd, 0x68, 0x2f, 0xf7, 0xf1, 0x04, 0x5c, 0x6f, 0x81, 0xb4, 0xcb, 0x75, 0xec, 0x1d, 0x42,
+    0xf0, 0x42, 0xc2, 0xc1, 0xd9, 0x95, 0xf9, 0xbc, 0xc7, 0x09, 0x16, 0x33, 0x93, 0x03, 0xc1, 0x85,
+    0x7e, 0x85, 0x1b, 0x48, 0x75, 0xcb, 0x47, 0x6a, 0x21, 0xe7, 0xb9, 0xa7, 0x61, 0x9f, 0x96, 0x15,
+    0x01, 0xcc, 0x8d, 0x18, 0x64, 0xba, 0xef, 0xad, 0xdc, 0xfd, 0x78, 0xbc, 0xe8, 0xec, 0x1d, 0xbc,
+    0xf8, 0xbe, 0x86, 0x79, 0xbf, 0xf7, 0x8f, 0x14, 0x02, 0x1f, 0x9e, 0xe6, 0xf3, 0x7c, 0xd4, 0xcf,
+    0xfd, 0xc6, 0x09, 0x6c, 0xa4, 0xc5, 0x0d, 0xd8, 0x7f, 0xa4, 0x16, 0x82, 0x3a, 0x86, 0xf5, 0x5a,
+    0x61, 0x5b, 0x48, 0x1d, 0x0b, 0x62, 0xfa, 0x61, 0xa6, 0x50, 0x77, 0xee, 0x5e, 0xac, 0x91, 0x63,
+    0xe8, 0xa7, 0x75, 0x58, 0x7b, 0xb8, 0xf2, 0x23, 0x85, 0x9c, 0x6b, 0x7b, 0x0d, 0xe7, 0x7d, 0x9e,
+    0xe4, 0xec, 0xc3, 0xb0, 0xa2, 0x61, 0x86, 0x19, 0x01, 0x64, 0x1d, 0xcb, 0x47, 0x6a, 0xa1, 0x56,
+    0x0b, 0x6d, 0x18, 0xdc, 0x09, 0x19, 0xcf, 0x6d, 0x46, 0xa3, 0x06, 0x2e, 0x6a, 0x1a, 0x96, 0xe5,
+    0x3d, 0x90, 0xf3, 0x6c, 0xc7, 0xf5, 0x20, 0x15, 0xa5, 0x25, 0x29, 0x7d, 0x68, 0xbb, 0x6e, 0x6c,
+    0xdb, 0xab, 0x3f, 0xa9, 0x67, 0x28, 0xdd, 0x7a, 0xb4, 0x63, 0x3b, 0x2e, 0x2d, 0x09, 0x2d, 0x70,
+    0xe8, 0x47, 0x6a, 0x21, 0x0b, 0x1c, 0xda, 0xbe, 0x47, 0x26, 0xb2, 0x34, 0xf0, 0x8f, 0x74, 0x81,
+    0x72, 0xf5, 0xdb, 0x8b, 0x20, 0xa4, 0xbc, 0x23, 0x58, 0x3f, 0xd7, 0xfe, 0x9c, 0x3e, 0xb6, 0x36,
+    0xee, 0xcb, 0x3d, 0x17, 0xf8, 0x38, 0x29, 0xa2, 0xd3, 0x49, 0xfe, 0x4c, 0x7d, 0xc7, 0x74, 0x96,
+    0xed, 0x23, 0xb5, 0x50, 0xa6, 0x79, 0xdc, 0x96, 0xbe, 0x2c, 0x68, 0x29, 0xa6, 0x9d, 0x84, 0x70,
+    0x9c, 0xbd, 0xd7, 0xb2, 0xbc, 0xd8, 0x6a, 0x9d, 0x6d, 0xbb, 0x0c, 0x3b, 0xfc, 0x7d, 0x22, 0xe9,
+    0xb4, 0xb4, 0x2d, 0x9a, 0xa6, 0xab, 0x2d, 0xc3, 0x48, 0xe6, 0xde, 0xc1, 0x2d, 0xda, 0xa5, 0x5d,
+    0x26, 0xfc, 0xeb, 0xc7, 0x3e, 0x0e, 0x1f, 0xa9, 0x85, 0x6a, 0xe4, 0xde, 0xef, 0xfb, 0x18, 0x26,
+    0xd4, 0xc8, 0x79, 0xa3, 0x95, 0x43, 0x83, 0x81, 0xa6, 0xfb, 0xd8, 0x5e, 0x04, 0xd9, 0xf7, 0x76,
+    0xdd, 0xdb, 0xbe, 0xa3, 0x4f, 0xf8, 0xeb, 0xbe, 0x52, 0x67, 0x70, 0xb4, 0xd7, 0xd9, 0x53, 0x6f,
+    0xbe, 0xf7, 0x5d, 0xbb, 0xb6, 0x2b, 0xdc, 0xa3, 0xf4, 0xdd, 0x7d, 0xfe, 0x92, 0x5a, 0xe0, 0x4a,
+    0xfd, 0x8c, 0x2f, 0x2f, 0x64, 0xec, 0xfb, 0x15, 0x3e, 0xb2, 0xf4, 0xe0, 0x9e, 0xa9, 0xb9, 0xe0,
+    0x41, 0x23, 0x83, 0x30, 0x08, 0x83, 0x30, 0x08, 0x83, 0x30, 0x08, 0x83, 0xfc, 0x27, 0xe2, 0x91,
+    0x61, 0xa5, 0x21, 0xe3, 0x41, 0x5a, 0x0a, 0xdd, 0x82, 0x9b, 0x8f, 0x72, 0x8f, 0xf3, 0xb1, 0x51,
+    0x30, 0xd2, 0x22, 0xe8, 0x5b, 0xca, 0xfd, 0xdc, 0xd2, 0xbd, 0xc6, 0x95, 0x62, 0x5d, 0x0c, 0x31,
+    0x8f, 0x9e, 0x6e, 0xf1, 0x9c, 0xcb, 0xb4, 0xb5, 0xe3, 0xb5, 0xf5, 0x5b, 0x4b, 0x83, 0xf7, 0x6e,
+    0x58, 0xf6, 0x6e, 0xa0, 0xed, 0xb5, 0xb1, 0xd6, 0x3c, 0xf6, 0xdd, 0x38, 0xf6, 0xa4, 0xa5, 0x60,
+    0xac, 0x85, 0x40, 0x04, 0xbb, 0xb6, 0x47, 0x51, 0xd7, 0x7d, 0xd9, 0x0a, 0x0d, 0xed, 0xaf, 0x75,
+    0x5e, 0xda, 0x9d, 0x26, 0x9f, 0x5c, 0x5b, 0xd9, 0xe9, 0x1e, 0x22, 0xdd, 0xd4, 0x3a, 0xcf, 0xf3,
+    0xde, 0xd6, 0x13, 0xf8, 0xe7, 0x73, 0x19, 0x44, 0x64, 0x4f, 0x10, 0xf6, 0x5a, 0xcc, 0x3e, 0x23,
+    0x5a, 0x5a, 0x7a, 0x9a, 0x26, 0x80, 0xa1, 0xeb, 0x78, 0x8f, 0x08, 0x6f, 0x27, 0x1a, 0x9a, 0x17,
+    0xba, 0x1f, 0x38, 0x23, 0x8e, 0xbd, 0xb7, 0x13, 0x21, 0xec, 0x73, 0xef, 0x73, 0xbb, 0xca, 0xd6,
+    0xed, 0xa5, 0x3f, 0x68, 0xa0, 0xbc, 0x2d, 0xdb, 0xb4, 0x2d, 0x2b, 0x30, 0x0e, 0xba, 0xcc, 0xd5,
+    0x4e, 0x33, 0x6d, 0xaf, 0x45, 0x88, 0xc3, 0xb1, 0x5c, 0xf7, 0xb1, 0x90, 0x96, 0x82, 0xc2, 0x77,
+    0x77, 0x87, 0x48, 0xfd, 0xb9, 0xb3, 0x7b, 0x23, 0xea, 0xf8, 0x48, 0x10, 0xfd, 0x32, 0xb7, 0x07,
+    0x4d, 0x3e, 0x39, 0x07, 0x44, 0xf6, 0xdb, 0xb5, 0xc2, 0x08, 0xcf, 0x63, 0x44, 0xcd, 0x9d, 0x18,
+    0xbb, 0x8f, 0x84, 0x85, 0xcb, 0xac, 0xcf, 0x1c, 0x88, 0xf7, 0x4c, 0x6b, 0xa7, 0x39, 0x4b, 0x3d,
+    0x05, 0x52, 0x28, 0x1e, 0x4d, 0x63, 0x78, 0xa6, 0x9f, 0x50, 0x34, 0xd2, 0x8e, 0x88, 0x7e, 0xc9,
+    0xfe, 0xfb, 0x7b, 0xb8, 0x9f, 0xc9, 0x27, 0xf0, 0x80, 0x6d, 0x39, 0xd6, 0x6b, 0x42, 0x3d, 0x75,
+    0xdb, 0x39, 0xef, 0xdb, 0xb9, 0x9c, 0x33, 0xdd, 0x1b, 0xdd, 0xf7, 0x89, 0xee, 0x86, 0xee, 0x74,
+    0x67, 0xf5, 0x35, 0xa5, 0x71, 0x6b, 0xcf, 0x61, 0x23, 0x2d, 0x05, 0xe6, 0x32, 0x6e, 0x8f, 0x70,
+    0xda, 0x11, 0xce, 0x3c, 0x6d, 0x2b, 0xfd, 0xc1, 0xfd, 0x86, 0x26, 0xe0, 0xa4, 0xc9, 0x27, 0x70,
+    0x9d, 0xed, 0xbc, 0x2f, 0xf2, 0x1c, 0xf8, 0xd2, 0x5c, 0xf6, 0x65, 0x3e, 0x27, 0x52, 0xec, 0x70,
+    0x99, 0x76, 0xb9, 0x37, 0xda, 0xde, 0x02, 0x19, 0xe6, 0x75, 0x42, 0x94, 0x34, 0x91, 0x96, 0x42,
+    0xca, 0xdb, 0x49, 0xa2, 0xe2, 0x89, 0x98, 0xa9, 0x6c, 0x43, 0x7f, 0xd1, 0x1c, 0x8e, 0xb2, 0x5d,
+    0xe3, 0x09, 0xdb, 0x9a, 0x61, 0x7c, 0x57, 0xa1, 0xe9, 0x1c, 0xdd, 0x41, 0x72, 0x2f, 0x5c, 0xfd,
+    0xda, 0xb7, 0x6d, 0xa6, 0x19, 0x77, 0xb8, 0x4c, 0x87, 0x37, 0x6d, 0xaf, 0x81, 0xc0, 0xb4, 0xaf,
+    0xb6, 0x1d, 0x48, 0x4b, 0x41, 0x99, 0x61, 0x5b, 0x68, 0x7e, 0x17, 0xaa, 0x9d, 0x7b, 0x45, 0x28,
+    0x3b, 0x3d, 0x82, 0xc4, 0x3c, 0x2e, 0x33, 0x4d, 0x3e, 0x19, 0xba, 0xb2, 0x76, 0xdb, 0xd6, 0xd1,
+    0xac, 0xa6, 0x7d, 0x3d, 0x69, 0xce, 0xd3, 0x36, 0x5c, 0x74, 0x37, 0x1e, 0x97, 0x39, 0x06, 0x9a,
+    0xf0, 0xb4, 0xbe, 0x05, 0x82, 0x5e, 0xa4, 0xed, 0xfa, 0x89, 0xa6, 0x94, 0x90, 0x40, 0xd7, 0xd2,
+    0x3c, 0x88, 0xbb, 0xef, 0x27, 0xf2, 0x97, 0x61, 0x9d, 0x67, 0x92, 0x20, 0xda, 0x76, 0xdd, 0x66,
+    0x9a, 0x7c, 0x02, 0x2f, 0xdf, 0xd7, 0xb6, 0x1f, 0x27, 0x12, 0x1b, 0xf1, 0xb3, 0xfe, 0xec, 0x5a,
+    0x44, 0xc5, 0xc3, 0x67, 0x4a, 0x0b, 0x89, 0x31, 0xeb, 0xf1, 0x5a, 0xf3, 0x7b, 0xa2, 0x4b, 0x43,
+    0xb7, 0x46, 0x5a, 0x0a, 0x6a, 0xa4, 0xdf, 0x7a, 0xf2, 0x72, 0xea, 0xd7, 0xd6, 0x71, 0xfb, 0x18,
+    0x3c, 0xea, 0xea, 0x58, 0x0e, 0x6a, 0x80, 0xc1, 0xb7, 0x8d, 0x77, 0xbf, 0xd3, 0x74, 0xc6, 0xb3,
+    0x74, 0xd3, 0x32, 0x74, 0xcb, 0xfd, 0xe8, 0xf6, 0xd3, 0x49, 0x6f, 0xda, 0xde, 0x02, 0x21, 0x99,
+    0xa4, 0xbb, 0x48, 0x2a, 0x19, 0x68, 0x2a, 0xc7, 0x01, 0x3b, 0x41, 0x49, 0x49, 0xd0, 0x5e, 0xef,
+    0x1d, 0xf5, 0xb0, 0x50, 0x1f, 0xd1, 0x96, 0x6d, 0xa7, 0xc9, 0x27, 0x68, 0xad, 0xc8, 0x7c, 0x2e,
+    0xf4, 0xf0, 0xe8, 0xe9, 0xbb, 0xfb, 0x5e, 0xf1, 0xd3, 0x8b, 0xa6, 0x13, 0x1d, 0xfb, 0xd9, 0x1e,
+    0xf4, 0xeb, 0xd7, 0x5a, 0xad, 0x9e, 0xb4, 0xdc, 0xb9, 0x2f, 0xa4, 0xa5, 0xd0, 0x6c, 0x53, 0xea,
+    0xdf, 0xa7, 0x89, 0x1c, 0xbf, 0x1c, 0x63, 0x4f, 0x45, 0x27, 0x69, 0xa8, 0x9d, 0x9f, 0xc9, 0x27,
+    0x03, 0x6a, 0x64, 0x59, 0x71, 0x48, 0x3d, 0x4e, 0xdb, 0xb7, 0x2b, 0x46, 0x04, 0x47, 0x4f, 0xd5,
+    0x47, 0x32, 0x0c, 0x2e, 0xd5, 0xf5, 0x1d, 0x0f, 0x1a, 0x19, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18,
+    0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84,
+    0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41,
+    0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18,
+    0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84,
+    0x41, 0xfe, 0xcf, 0x40, 0xfe, 0xfe, 0xb7, 0xcf, 0x8b, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41,
+    0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18,
+    0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0x18, 0x84, 0x41, 0xbe, 0x05, 0xf2, 0x33, 0x5e,
+    0x0c, 0xc2, 0x20, 0x0c, 0xc2, 0x20, 0x0c, 0xc2, 0x20, 0x0c, 0x82, 0xd7, 0x3f, 0x00, 0x75, 0xce,
+    0x6f, 0x97, 0xe8, 0x2a, 0xbe, 0x85, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42,
+    0x60, 0x82,
+};
+
+// 800x480 4-bpp indexed with a 6 color palette
+static const uint8_t png_indexed[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x01, 0xe0, 0x04, 0x03, 0x00, 0x00, 0x00, 0xaf, 0x29, 0x14,
+    0xc6, 0x00, 0x00, 0x00, 0x12, 0x50, 0x4c, 0x54, 0x45, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x87, 0x77, 0x78, 0x77, 0x00,
+    0x00, 0x19, 0x43, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed, 0x5d, 0xdb, 0x95, 0x24, 0xcb, 0x8d,
+    0x23, 0x3d, 0x20, 0x5d, 0x58, 0x17, 0xe4, 0x82, 0x5c, 0x90, 0xff, 0xae, 0xa8, 0x92, 0x00, 0x18,
+    0x31, 0xfa, 0xd0, 0xce, 0xf4, 0x7e, 0xec, 0x9c, 0x4a, 0xf0, 0xde, 0xab, 0xee, 0xaa, 0x8e, 0xcc,
+    0x3a, 0x4a, 0x54, 0xbc, 0x48, 0x04, 0x10, 0xe1, 0x70, 0x38, 0x1c, 0x0e, 0x87, 0xc3, 0xe1, 0x70,
+    0x38, 0x1c, 0x0e, 0x87, 0xc3, 0xe1, 0x70, 0x38, 0x1c, 0x0e, 0x87, 0xc3, 0xe1, 0x70, 0x38, 0x1c,
+    0x0e, 0x87, 0xe3, 0x7f, 0x89, 0x76, 0xfc, 0xbf, 0x85, 0x01, 0x31, 0x20, 0x0e, 0x03, 0x62, 0x40,
+    0x1c, 0x06, 0xc4, 0x80, 0x38, 0x0c, 0x88, 0x01, 0x71, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88,
+    0xc3, 0x80, 0x18, 0x10, 0x87, 0x01, 0x31, 0x20, 0x0e, 0x03, 0x62, 0x40, 0x1c, 0x06, 0xc4, 0x80,
+    0x18, 0x10, 0x03, 0xe2, 0x30, 0x20, 0x06, 0xc4, 0x61, 0x40, 0x0c, 0x88, 0xc3, 0x80, 0x18, 0x10,
+    0x87, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x38, 0x0c, 0x88, 0x01, 0x71, 0x18, 0x10, 0x03, 0xe2,
+    0x30, 0x20, 0x06, 0xc4, 0x61, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x0e, 0x03, 0x62, 0x40, 0x1c,
+    0x06, 0xc4, 0x80, 0x38, 0x0c, 0x88, 0x01, 0x71, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0xc3,
+    0x80, 0x18, 0x10, 0xc7, 0xff, 0x0d, 0x10, 0x87, 0xc3, 0xe1, 0x70, 0x38, 0x1c, 0x0e, 0x87, 0xc3,
+    0xe1, 0x70, 0x38, 0x1c, 0x0e, 0x87, 0xc3, 0xe1, 0x70, 0x38, 0x1c, 0x0e, 0x87, 0xc3, 0xe1, 0x70,
+    0x38, 0x1c, 0xff, 0x25, 0xb2, 0x33, 0x32, 0xab, 0xab, 0xa2, 0xa3, 0xfb, 0xf3, 0x0b, 0x0a, 0xf0,
+    0x99, 0x9f, 0x57, 0x59, 0xcf, 0x4f, 0xbe, 0xfe, 0xfc, 0xe1, 0xd3, 0xe8, 0xf9, 0x35, 0x3e, 0x7f,
+    0x48, 0x16, 0xea, 0x9f, 0x4b, 0x3f, 0x6d, 0xf2, 0xf3, 0xaa, 0xe6, 0x2e, 0x73, 0xe1, 0xe7, 0x7f,
+    0x9f, 0x8b, 0x9f, 0xa8, 0xfe, 0xfc, 0xed, 0xf3, 0xa2, 0xe6, 0x8d, 0xa7, 0xe9, 0xd3, 0xfe, 0xf9,
+    0x2f, 0xe6, 0x27, 0xee, 0xf3, 0x5c, 0xf7, 0x7c, 0xc4, 0x7c, 0x3c, 0x3e, 0xe6, 0xa5, 0xf1, 0x79,
+    0x06, 0x9f, 0x67, 0xf2, 0x41, 0x63, 0x9e, 0xd8, 0x3c, 0x95, 0x81, 0xe0, 0xf3, 0xf6, 0xe7, 0x6f,
+    0x9f, 0xb7, 0xf9, 0x5c, 0xa7, 0x4d, 0x34, 0x30, 0xc8, 0xe7, 0xf7, 0x45, 0xe7, 0x13, 0x9f, 0xab,
+    0x9e, 0x27, 0x9f, 0xcf, 0x5d, 0xfa, 0x79, 0xd4, 0xcf, 0xcb, 0xa8, 0x01, 0xbc, 0xe7, 0x02, 0x3e,
+    0xf8, 0xec, 0x79, 0xec, 0x89, 0x7b, 0x7c, 0x9a, 0xee, 0x7d, 0x06, 0x8d, 0xe7, 0x47, 0xf2, 0x63,
+    0x5e, 0x1a, 0xf3, 0xfd, 0x0d, 0x7d, 0x2d, 0x3f, 0x20, 0x54, 0xa5, 0xfe, 0xf2, 0x7c, 0x83, 0x83,
+    0x88, 0x4c, 0x9b, 0x9c, 0x47, 0xf5, 0x7c, 0xb9, 0x6b, 0xfe, 0x1d, 0x74, 0x9e, 0x2b, 0xe6, 0xeb,
+    0x3e, 0xfd, 0x6b, 0x9a, 0xe2, 0x6a, 0x00, 0x52, 0xd3, 0x23, 0x16, 0x59, 0xf4, 0xb8, 0xe7, 0xf3,
+    0x9e, 0xd7, 0x1d, 0xba, 0x4f, 0x3d, 0xdc, 0x98, 0xc6, 0xc7, 0xe7, 0x9b, 0x11, 0xc9, 0x19, 0x2d,
+    0x9e, 0x07, 0xff, 0x7c, 0xad, 0xb3, 0x5a, 0xdf, 0xe4, 0xce, 0xbc, 0x7a, 0x05, 0x86, 0x17, 0x3c,
+    0xd4, 0xe7, 0xeb, 0x9f, 0xa1, 0xf7, 0x9f, 0x5f, 0x72, 0xf0, 0xec, 0x79, 0x98, 0xf3, 0xf5, 0x2f,
+    0x5c, 0x3c, 0x4f, 0xba, 0xa6, 0xfb, 0x04, 0x81, 0xce, 0xe1, 0x83, 0x3d, 0x8f, 0xbc, 0xa7, 0x29,
+    0xef, 0x93, 0xd3, 0x77, 0x00, 0x4b, 0xaa, 0x57, 0xbe, 0xb4, 0x87, 0xcc, 0xff, 0x56, 0x70, 0xe0,
+    0x7a, 0x06, 0x2d, 0x3d, 0xe9, 0x7a, 0x86, 0x31, 0x7d, 0x85, 0x9f, 0xe7, 0x5d, 0xcf, 0xbb, 0x78,
+    0x78, 0x33, 0x6b, 0x10, 0x3a, 0x3e, 0xe3, 0xa7, 0x85, 0x1e, 0xf9, 0x73, 0x2d, 0xa7, 0x02, 0x35,
+    0xe6, 0x05, 0x33, 0x30, 0xb1, 0x97, 0x65, 0xe8, 0x3e, 0xb8, 0x35, 0x3e, 0x9e, 0x1f, 0xf3, 0x56,
+    0x40, 0x82, 0x33, 0xfa, 0xf3, 0x95, 0x4d, 0x8c, 0xe2, 0x3b, 0x2c, 0x3d, 0x13, 0x72, 0xe2, 0xb9,
+    0x4e, 0x9b, 0xea, 0x54, 0xaf, 0xaa, 0x65, 0xdf, 0x3d, 0x58, 0x3e, 0x53, 0xc4, 0x73, 0xa7, 0x19,
+    0xa9, 0x9e, 0xce, 0xf0, 0x0c, 0x69, 0x9a, 0x34, 0xe6, 0x82, 0xe4, 0xa5, 0x8d, 0xdf, 0x9e, 0x05,
+    0xc3, 0x80, 0xcd, 0xfb, 0x70, 0x1a, 0xc3, 0x5c, 0xc2, 0x8f, 0x79, 0xeb, 0x2a, 0x6b, 0x26, 0x81,
+    0x59, 0x38, 0xc5, 0xcc, 0xe3, 0x33, 0xb4, 0xcc, 0x2c, 0x5c, 0x89, 0xa7, 0xcd, 0x91, 0x67, 0x9e,
+    0x1b, 0xc6, 0xfb, 0xc0, 0xa8, 0xc5, 0xef, 0xf6, 0xb3, 0x34, 0x9a, 0xbf, 0x60, 0xb6, 0x9e, 0xf5,
+    0x40, 0x16, 0xe7, 0x10, 0xa0, 0xf7, 0xf4, 0x44, 0x0c, 0x77, 0xb3, 0x50, 0x60, 0x8f, 0x7c, 0x7e,
+    0x96, 0xba, 0xe8, 0x7c, 0x04, 0x3e, 0xfe, 0xcd, 0x54, 0xcb, 0xe7, 0x9b, 0x3d, 0xdf, 0xe5, 0x67,
+    0x91, 0x33, 0x6b, 0xa1, 0x19, 0x43, 0x12, 0xb3, 0xf9, 0xf3, 0x65, 0x4d, 0x4e, 0xba, 0x98, 0xc0,
+    0x39, 0x4f, 0x3f, 0xb3, 0x40, 0x69, 0xd9, 0x3b, 0x13, 0x3a, 0xae, 0x2e, 0x4c, 0x30, 0xcf, 0x0a,
+    0x18, 0x0d, 0x72, 0x66, 0xa6, 0x2c, 0xad, 0x82, 0x31, 0xb9, 0x4c, 0x57, 0x9a, 0xa6, 0xbc, 0x0f,
+    0x17, 0x75, 0x4f, 0x87, 0xed, 0xac, 0x37, 0xaf, 0x7b, 0x9f, 0x31, 0x63, 0x16, 0x38, 0xb3, 0x6a,
+    0xc5, 0xf4, 0x80, 0xe7, 0xc8, 0x31, 0xa4, 0x7a, 0x81, 0xd3, 0x70, 0x36, 0xe3, 0xcd, 0x3e, 0xb4,
+    0xc4, 0xb8, 0xf6, 0x74, 0x8d, 0x9c, 0x3f, 0xcd, 0xd4, 0xae, 0x06, 0xe8, 0x08, 0x3d, 0x88, 0xa1,
+    0x71, 0x61, 0x14, 0xac, 0x3e, 0x9f, 0x81, 0x55, 0xdc, 0x8c, 0x7a, 0x33, 0xc2, 0xbd, 0x7b, 0x52,
+    0x9f, 0xfd, 0x5a, 0xe1, 0x49, 0xe6, 0x8c, 0x40, 0xbb, 0x53, 0x9b, 0x87, 0xbd, 0x83, 0x5b, 0x55,
+    0xef, 0x34, 0x9d, 0xbb, 0x7b, 0x7b, 0x16, 0xbb, 0xdc, 0x4d, 0x3e, 0x2d, 0x02, 0x7b, 0x89, 0xd9,
+    0x2c, 0xd6, 0x4e, 0x53, 0x83, 0x72, 0x63, 0x84, 0x44, 0x93, 0xd9, 0x49, 0xc6, 0x75, 0x1f, 0xad,
+    0xa1, 0xa3, 0xf5, 0x31, 0x6f, 0x1d, 0xb2, 0x30, 0x41, 0xcf, 0x0f, 0x80, 0x90, 0xdc, 0xfd, 0x05,
+    0xdf, 0xd2, 0x3e, 0x61, 0xd6, 0xae, 0xbb, 0xd7, 0xd3, 0x86, 0xae, 0xe7, 0xe1, 0xce, 0x7a, 0x17,
+    0xbd, 0x88, 0x2b, 0x25, 0x35, 0xc6, 0x8c, 0x3f, 0x3f, 0xa7, 0x79, 0x70, 0xaf, 0xce, 0x3d, 0xbb,
+    0xee, 0xd3, 0x03, 0xec, 0xac, 0xbf, 0xea, 0x0f, 0xb7, 0xea, 0xff, 0xf3, 0x9b, 0x31, 0x8d, 0xff,
+    0xf1, 0x9b, 0x31, 0x8d, 0xff, 0xf9, 0x9b, 0x31, 0x8d, 0xff, 0xf5, 0x9b, 0xf1, 0x3b, 0xcb, 0xde,
+    0xc4, 0x4e, 0x6d, 0xa6, 0x02, 0x3e, 0xb8, 0x67, 0xdc, 0x19, 0x10, 0x36, 0x77, 0x32, 0xf3, 0x72,
+    0xf1, 0x5b, 0x5e, 0x75, 0xf6, 0x19, 0xb3, 0x4c, 0x7d, 0x7e, 0x4c, 0xe6, 0x04, 0x93, 0x72, 0xf6,
+    0x2e, 0xc3, 0x8a, 0x3b, 0x46, 0xed, 0x0c, 0x9f, 0x49, 0x1d, 0x9f, 0x36, 0x3f, 0x39, 0x94, 0xcd,
+    0x57, 0x01, 0x17, 0xe6, 0xab, 0x01, 0xf9, 0x82, 0x30, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03,
+    0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0xbe,
+    0x09, 0x90, 0xa9, 0x42, 0x80, 0x2e, 0x02, 0xfa, 0x08, 0x52, 0x25, 0x93, 0x04, 0x44, 0xb5, 0x69,
+    0xde, 0x13, 0x2b, 0x85, 0x79, 0xc7, 0xcd, 0x0b, 0x4e, 0x31, 0x4a, 0xf9, 0xae, 0x0a, 0x25, 0x8c,
+    0xa7, 0xe4, 0x55, 0xa8, 0x4b, 0x29, 0x5f, 0x39, 0xcd, 0x26, 0xf3, 0x1b, 0xca, 0x98, 0x81, 0xb4,
+    0xc2, 0xda, 0xe4, 0x54, 0x75, 0x33, 0x98, 0xf9, 0xfa, 0xfd, 0xaa, 0xe1, 0x77, 0x01, 0xf2, 0x14,
+    0xa8, 0x98, 0xec, 0xab, 0xc9, 0x33, 0xf5, 0xe6, 0xdf, 0x91, 0x5c, 0x7a, 0x6a, 0x46, 0x93, 0x62,
+    0x02, 0x2b, 0x25, 0x54, 0xe3, 0x98, 0x52, 0xd3, 0x5c, 0xae, 0x74, 0xb9, 0x9a, 0xaa, 0x79, 0x5c,
+    0x97, 0x32, 0x5f, 0x49, 0xb6, 0x4a, 0xaa, 0x3c, 0x3f, 0x9f, 0x80, 0xca, 0xa4, 0xc8, 0x29, 0x28,
+    0xa0, 0x44, 0xfc, 0x7e, 0x0a, 0xfe, 0xdb, 0x86, 0xac, 0xf9, 0x7f, 0x8f, 0x2c, 0x5f, 0x9f, 0x7c,
+    0xfb, 0x53, 0x46, 0xac, 0xf9, 0x2a, 0x4f, 0xc6, 0x6f, 0x59, 0x29, 0x9b, 0xf9, 0x9d, 0xd4, 0x6c,
+    0x93, 0xf1, 0x23, 0xc2, 0x43, 0xf3, 0x7b, 0x1e, 0x27, 0x17, 0x7c, 0xf3, 0xac, 0x50, 0xda, 0x45,
+    0x76, 0x5f, 0x84, 0x89, 0x22, 0x23, 0x02, 0x68, 0x2b, 0x97, 0x59, 0xb1, 0xb5, 0xfc, 0xb7, 0x65,
+    0x7b, 0xc1, 0x5d, 0x98, 0xa2, 0x52, 0x20, 0xd5, 0x7a, 0x15, 0xa4, 0xe6, 0x39, 0xe1, 0x3d, 0xb2,
+    0x52, 0xe2, 0x90, 0x1c, 0xa6, 0x10, 0x48, 0xaa, 0x89, 0x7a, 0xc0, 0x14, 0x7d, 0xd9, 0x7c, 0x2a,
+    0xb9, 0xfc, 0x5d, 0x45, 0xa8, 0x27, 0x15, 0x9c, 0xa8, 0xd5, 0x92, 0x6d, 0xf2, 0xf4, 0x99, 0x21,
+    0x50, 0x80, 0x9c, 0x02, 0xae, 0xc4, 0x10, 0x57, 0xde, 0xda, 0x43, 0x8a, 0x0f, 0x04, 0x6c, 0xc3,
+    0x5e, 0xa6, 0x62, 0x26, 0xab, 0xa9, 0x98, 0x56, 0xc8, 0x4a, 0xe1, 0x54, 0xa1, 0xff, 0x02, 0x45,
+    0x92, 0xbc, 0xa6, 0x90, 0x50, 0x73, 0x11, 0x1a, 0x42, 0x24, 0x39, 0x50, 0x86, 0x1a, 0x84, 0x0a,
+    0xf6, 0x00, 0x72, 0x81, 0x6a, 0xc9, 0x29, 0xa8, 0x8b, 0xa0, 0xfc, 0xf2, 0x46, 0x40, 0x0a, 0xe5,
+    0x3b, 0xd0, 0x06, 0x87, 0x03, 0xb2, 0xc5, 0xef, 0x9a, 0xd7, 0x33, 0xdb, 0x4e, 0x69, 0xa4, 0x59,
+    0x64, 0x1a, 0x64, 0x1a, 0x05, 0xf7, 0x22, 0x7f, 0x88, 0xeb, 0x00, 0x34, 0x55, 0xf3, 0xe9, 0x06,
+    0xf8, 0x9d, 0xe3, 0x57, 0x15, 0x6a, 0x2c, 0xb5, 0x6c, 0x96, 0x81, 0xa2, 0x2f, 0x72, 0x4a, 0x4d,
+    0x39, 0x38, 0xea, 0xad, 0x73, 0xc8, 0x7c, 0x5f, 0x1f, 0x82, 0x01, 0x38, 0x87, 0xc3, 0x06, 0xc5,
+    0xfb, 0x33, 0xae, 0xa8, 0xda, 0x54, 0x62, 0xa5, 0x04, 0x18, 0x22, 0xad, 0x32, 0x5f, 0x74, 0x9f,
+    0x8a, 0x2b, 0x9a, 0xaa, 0x39, 0x8b, 0xeb, 0xb8, 0x54, 0x2b, 0x88, 0xa9, 0x4c, 0x3d, 0xb7, 0x59,
+    0x36, 0x4b, 0xa0, 0x5a, 0x4f, 0x72, 0x0a, 0x09, 0x2a, 0x99, 0xf1, 0x5a, 0x40, 0x9e, 0x75, 0xe9,
+    0x94, 0x0a, 0xc1, 0xfd, 0xe1, 0x04, 0x0d, 0xfa, 0x87, 0xbe, 0xd4, 0xbd, 0xac, 0x14, 0x32, 0x44,
+    0xd0, 0xbc, 0x66, 0xda, 0xe7, 0xba, 0x2c, 0xd4, 0x74, 0x9b, 0xa3, 0x04, 0x19, 0x3b, 0xe9, 0xf7,
+    0xd4, 0x05, 0xc1, 0xa2, 0x6b, 0x55, 0x8a, 0x87, 0x0c, 0x54, 0x22, 0xa7, 0xcc, 0x04, 0x1f, 0x53,
+    0x9b, 0xaf, 0x97, 0x0e, 0x59, 0x62, 0x9a, 0x34, 0x88, 0x1f, 0x62, 0xae, 0x91, 0xce, 0xd6, 0xc3,
+    0x3f, 0xa9, 0xa9, 0x78, 0xe7, 0xee, 0x51, 0xf8, 0x4f, 0x26, 0xa8, 0x8d, 0x87, 0x6e, 0x3a, 0x4d,
+    0xd5, 0x7c, 0x06, 0x36, 0xfe, 0xae, 0x0f, 0x13, 0xdf, 0xb4, 0xc4, 0x66, 0x99, 0xb5, 0xc4, 0x7c,
+    0x11, 0x48, 0x4e, 0x99, 0x21, 0x6f, 0x06, 0xb1, 0x77, 0x02, 0x02, 0xa2, 0xe1, 0xee, 0xd2, 0xb0,
+    0x0f, 0xe0, 0x50, 0x32, 0x8c, 0x9d, 0x1e, 0x0e, 0xd5, 0xb2, 0x52, 0x7e, 0xc1, 0x92, 0xb3, 0xfa,
+    0xf5, 0x7a, 0x9a, 0xb2, 0xf9, 0xa0, 0xc6, 0xdf, 0x81, 0x17, 0xbb, 0xe3, 0x2c, 0x71, 0xfb, 0xac,
+    0xf2, 0x2e, 0x72, 0x4a, 0x36, 0x46, 0xbb, 0x7c, 0xed, 0x1c, 0x32, 0x9b, 0x37, 0x1c, 0xea, 0x68,
+    0x0c, 0x28, 0x9c, 0xd3, 0xb1, 0xce, 0x9a, 0x45, 0x14, 0xd7, 0x57, 0x4b, 0x41, 0xd9, 0xa9, 0x63,
+    0xf6, 0xe0, 0x15, 0xad, 0x33, 0x1e, 0x6c, 0xca, 0xe6, 0xb3, 0xfb, 0xe6, 0xef, 0x7b, 0x4b, 0x1c,
+    0x5b, 0xd8, 0x5b, 0x0d, 0xa3, 0x88, 0xdc, 0x0a, 0xb2, 0xf4, 0x70, 0x50, 0x24, 0xf3, 0xa5, 0x43,
+    0x16, 0x58, 0x52, 0x03, 0xc6, 0xe4, 0x4e, 0x7a, 0x0f, 0x23, 0x60, 0xaf, 0x36, 0x2c, 0x44, 0xac,
+    0x6a, 0x67, 0x4a, 0xd0, 0x8a, 0x38, 0xf9, 0x27, 0x1e, 0xb5, 0xc1, 0x03, 0xe7, 0x08, 0xa6, 0xe6,
+    0xbb, 0xed, 0xe7, 0xa4, 0x5e, 0xe0, 0xb7, 0xff, 0xd2, 0xdb, 0x8a, 0xb1, 0xe4, 0x94, 0xdc, 0xdd,
+    0x7e, 0xbd, 0x74, 0x1f, 0xe2, 0xe4, 0xa2, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03,
+    0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0xf2, 0x17, 0xa5,
+    0x4e, 0x26, 0xe9, 0x04, 0xee, 0xc1, 0x9c, 0x4c, 0x63, 0x36, 0x4a, 0x54, 0x12, 0x70, 0x18, 0x0e,
+    0x83, 0x84, 0xa7, 0xde, 0xc4, 0x24, 0x99, 0x24, 0xfb, 0xe4, 0x24, 0x95, 0x2a, 0x8c, 0x49, 0x83,
+    0x40, 0x18, 0x25, 0xa9, 0x84, 0x82, 0x0f, 0x9a, 0x64, 0xfe, 0xea, 0xa2, 0x28, 0x51, 0xa9, 0x33,
+    0x6e, 0xbc, 0x36, 0xdd, 0x43, 0x26, 0x25, 0xde, 0x4c, 0xa7, 0xcf, 0xbf, 0xcb, 0x42, 0x51, 0x52,
+    0xbe, 0x42, 0x0c, 0x12, 0xd0, 0x44, 0x90, 0x63, 0x47, 0x19, 0x3d, 0x79, 0x28, 0x2e, 0xf5, 0x32,
+    0xae, 0x7f, 0xba, 0x8e, 0x1e, 0x47, 0x4f, 0xf9, 0x64, 0x75, 0x51, 0xea, 0xaa, 0x4c, 0xea, 0x58,
+    0x62, 0xf6, 0x4f, 0xce, 0xdf, 0x7e, 0xdd, 0x90, 0x05, 0x82, 0x55, 0x82, 0x69, 0x10, 0x14, 0x6b,
+    0x50, 0x55, 0x89, 0x4c, 0x20, 0x31, 0x48, 0xaa, 0x43, 0x7c, 0x2c, 0x5d, 0x8c, 0x2c, 0x7b, 0x6f,
+    0x36, 0x7f, 0x6e, 0x14, 0x17, 0x87, 0x08, 0x77, 0x9c, 0xbe, 0xb2, 0x32, 0x40, 0xe7, 0x88, 0xdb,
+    0x7c, 0xe8, 0x7c, 0x58, 0xc6, 0x9f, 0x90, 0x7f, 0xbe, 0x76, 0xc8, 0xa2, 0xce, 0x09, 0x28, 0x24,
+    0x33, 0x7a, 0x1c, 0x16, 0xca, 0x6a, 0xc7, 0xd4, 0x32, 0x48, 0xe6, 0x51, 0x42, 0x21, 0x05, 0x05,
+    0x71, 0x88, 0x2d, 0x89, 0xdc, 0x83, 0x4a, 0x06, 0x4f, 0x76, 0xa2, 0x10, 0xab, 0x5a, 0x6d, 0xa2,
+    0xfa, 0x9e, 0x47, 0x6b, 0x60, 0xe9, 0x2d, 0x28, 0x59, 0x81, 0xc3, 0xf2, 0x76, 0x40, 0x86, 0xf9,
+    0x93, 0x9c, 0x34, 0xa6, 0x5e, 0x01, 0x11, 0x0d, 0x52, 0x49, 0x56, 0x83, 0x84, 0x0c, 0x92, 0x91,
+    0xc1, 0x42, 0xe1, 0x02, 0x4a, 0x3e, 0x28, 0xb0, 0xb7, 0xd8, 0x54, 0x24, 0x15, 0xed, 0x0d, 0xe6,
+    0x32, 0x12, 0xb0, 0x78, 0x40, 0x94, 0xba, 0x28, 0x4b, 0x3b, 0xa1, 0xba, 0x09, 0x6e, 0x55, 0xaf,
+    0x9f, 0xd4, 0x13, 0x34, 0x07, 0xd4, 0x59, 0x51, 0x11, 0x29, 0xb1, 0x50, 0xc4, 0x24, 0x99, 0x67,
+    0x0b, 0x06, 0x49, 0x9e, 0xb2, 0xb9, 0x66, 0x06, 0x4c, 0xf0, 0x59, 0xfb, 0x12, 0xbd, 0x69, 0xaf,
+    0xd4, 0x6c, 0x33, 0x27, 0x7d, 0x7b, 0x75, 0x51, 0x96, 0x76, 0xb2, 0x4a, 0x59, 0xfb, 0x2d, 0x78,
+    0x35, 0x20, 0xab, 0x73, 0x02, 0x91, 0x8d, 0xe4, 0x68, 0x74, 0x0e, 0xef, 0x83, 0x0a, 0x27, 0x06,
+    0xc9, 0x45, 0x7e, 0xd8, 0xa2, 0x94, 0xfe, 0x84, 0x97, 0x52, 0x3c, 0xd1, 0x95, 0x41, 0x96, 0x2e,
+    0xdf, 0x5d, 0x5d, 0x14, 0x0d, 0x65, 0x3d, 0xdc, 0x1f, 0x5c, 0xdb, 0x3f, 0x52, 0x39, 0xf9, 0x32,
+    0x40, 0x32, 0x59, 0xa3, 0x1b, 0x0a, 0x09, 0x59, 0x3c, 0x60, 0xa1, 0x88, 0xea, 0x79, 0x0e, 0xb1,
+    0x0f, 0x1f, 0x61, 0xa9, 0xa4, 0x03, 0x27, 0xd7, 0xca, 0x14, 0x59, 0x22, 0x4d, 0x65, 0x6a, 0xe9,
+    0xb8, 0x32, 0x41, 0x55, 0xa1, 0x0e, 0xca, 0x74, 0xbf, 0x19, 0x20, 0x25, 0xa2, 0xd2, 0xa8, 0xe0,
+    0x06, 0x85, 0x56, 0x5e, 0x3f, 0x64, 0x55, 0xf4, 0x19, 0xae, 0x7a, 0x59, 0xa2, 0x4b, 0x25, 0x49,
+    0xcd, 0xf5, 0x24, 0xa4, 0x34, 0x9a, 0x73, 0xda, 0xc8, 0x61, 0x04, 0xb5, 0x54, 0x96, 0xa4, 0x54,
+    0x02, 0x9a, 0x30, 0xd5, 0xd0, 0x5a, 0x75, 0xdf, 0x19, 0xdd, 0xa4, 0x8b, 0xb2, 0xb4, 0x13, 0x7d,
+    0xd8, 0xec, 0x72, 0xda, 0x80, 0x60, 0xbb, 0x00, 0x1d, 0x93, 0xc2, 0x37, 0x38, 0x2e, 0x76, 0x49,
+    0xf5, 0x8a, 0x2a, 0x05, 0x94, 0x12, 0x49, 0xd5, 0xc1, 0x54, 0x8d, 0x96, 0xe0, 0x24, 0x6c, 0xd1,
+    0xbc, 0x20, 0x76, 0xd6, 0x97, 0x72, 0x10, 0x74, 0x50, 0xc0, 0x67, 0x20, 0x15, 0x5e, 0x0b, 0xe5,
+    0x15, 0x57, 0x19, 0x29, 0x87, 0x28, 0xcf, 0x21, 0x23, 0xa6, 0x51, 0xd8, 0x25, 0x0f, 0x53, 0x27,
+    0xc5, 0x42, 0x21, 0x93, 0xa4, 0xd0, 0x05, 0xb0, 0x68, 0x85, 0x9e, 0x52, 0x91, 0x49, 0xc2, 0x7e,
+    0x20, 0xae, 0x4a, 0x53, 0xa9, 0x04, 0x0a, 0x4c, 0xb8, 0x52, 0x0c, 0x88, 0x61, 0xcc, 0x91, 0x34,
+    0x8f, 0xd1, 0x2f, 0x97, 0xde, 0x42, 0x25, 0xa0, 0x91, 0xcb, 0xf2, 0xb2, 0x97, 0x53, 0x04, 0xa1,
+    0x49, 0xaa, 0x2d, 0x92, 0x4a, 0x92, 0x58, 0xf8, 0xb6, 0x18, 0x24, 0x3a, 0x34, 0x40, 0x26, 0x49,
+    0x62, 0xdc, 0x5f, 0xee, 0x22, 0xc4, 0xcb, 0xe6, 0x50, 0xc8, 0x5e, 0xa9, 0x5e, 0x84, 0x8d, 0x06,
+    0xd7, 0x01, 0xb5, 0xb9, 0x13, 0x7c, 0x68, 0x72, 0x8e, 0xf2, 0xb2, 0xd7, 0xc9, 0x45, 0x03, 0x62,
+    0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88,
+    0x01, 0x31, 0x20, 0x06, 0xe4, 0xef, 0x62, 0x9d, 0x1c, 0xa9, 0x85, 0x84, 0x8b, 0x04, 0x99, 0x21,
+    0x43, 0x19, 0x89, 0x65, 0x8c, 0x24, 0xf2, 0x83, 0x1d, 0x97, 0x1c, 0x35, 0x5f, 0xa3, 0x5c, 0xc2,
+    0xe3, 0x8a, 0x7d, 0x17, 0xe5, 0x73, 0x75, 0x4c, 0x78, 0x2f, 0x19, 0xfa, 0x50, 0x35, 0x22, 0x44,
+    0x6e, 0x99, 0xdb, 0xf7, 0xcf, 0x24, 0xc6, 0xbf, 0x2c, 0x97, 0x75, 0x59, 0xda, 0xd0, 0xf9, 0x06,
+    0x84, 0x90, 0xac, 0x3d, 0xdf, 0xc6, 0xb3, 0x50, 0xc9, 0x7c, 0x63, 0x36, 0xeb, 0x51, 0x2c, 0xe3,
+    0xf2, 0x54, 0xb9, 0x0e, 0x28, 0xae, 0xd5, 0x11, 0x28, 0x0b, 0xd4, 0x31, 0x91, 0x70, 0x4d, 0x2b,
+    0x49, 0x39, 0x35, 0x7c, 0x91, 0x5b, 0x70, 0xbc, 0xf0, 0x67, 0xa4, 0x93, 0xaf, 0xcb, 0xf6, 0xde,
+    0x96, 0x36, 0x54, 0x55, 0x00, 0x21, 0xa4, 0x65, 0x01, 0x42, 0xc1, 0x7d, 0xf2, 0x16, 0x8e, 0x18,
+    0xf8, 0xbe, 0x86, 0xac, 0x7e, 0xdf, 0x42, 0x25, 0x14, 0x19, 0x58, 0x1d, 0x13, 0xde, 0x4b, 0x86,
+    0x3e, 0x35, 0x95, 0x91, 0xeb, 0xc8, 0x34, 0xbb, 0x88, 0x7b, 0xc8, 0x65, 0x69, 0x93, 0xe4, 0x4c,
+    0x61, 0xdc, 0xaa, 0x75, 0xbf, 0x41, 0x66, 0x37, 0x09, 0x5e, 0x74, 0x5f, 0x56, 0x15, 0xf4, 0x96,
+    0x40, 0x09, 0xab, 0x28, 0x54, 0xa2, 0xc2, 0xd7, 0x0c, 0x66, 0xd4, 0x31, 0x59, 0x27, 0x1d, 0x08,
+    0x3b, 0x81, 0x6b, 0x52, 0x6b, 0xe8, 0xc2, 0xd3, 0xc0, 0x9e, 0x43, 0xe2, 0x17, 0x4b, 0x9b, 0x94,
+    0xf5, 0x10, 0xaa, 0xb4, 0xc7, 0x89, 0x4d, 0x8a, 0x1a, 0xd9, 0x12, 0xd4, 0x50, 0xf2, 0x1e, 0x45,
+    0xf2, 0x62, 0xd7, 0xa2, 0x50, 0x09, 0x0d, 0x61, 0x56, 0xd3, 0x24, 0xc5, 0x52, 0x59, 0x43, 0x1f,
+    0x28, 0xa9, 0x44, 0x1c, 0x5a, 0x43, 0xf7, 0x0f, 0xa7, 0x90, 0x6f, 0x5b, 0x65, 0x1d, 0x4b, 0x1b,
+    0x56, 0x3a, 0x58, 0x17, 0xcf, 0x43, 0xca, 0x99, 0x51, 0x09, 0x07, 0xfb, 0x83, 0x8a, 0x27, 0x97,
+    0xb8, 0x00, 0x0e, 0x31, 0x83, 0x49, 0x42, 0xa1, 0x12, 0xd5, 0xa3, 0xb2, 0x56, 0xc7, 0x44, 0x22,
+    0x43, 0x9a, 0xbb, 0x53, 0x9a, 0x28, 0xb5, 0x6c, 0x24, 0xdd, 0xf6, 0xed, 0x25, 0xdc, 0xb5, 0xb4,
+    0x49, 0xa8, 0x94, 0x40, 0x0e, 0x06, 0x27, 0xd4, 0x57, 0xab, 0x09, 0x7a, 0x65, 0x09, 0x91, 0xa6,
+    0x23, 0x72, 0xc6, 0xd7, 0x49, 0xc1, 0x92, 0xcb, 0x49, 0xa7, 0x65, 0x53, 0x28, 0x1d, 0x93, 0xe2,
+    0xfb, 0x34, 0xf4, 0xc1, 0xa4, 0xb3, 0xb3, 0xc6, 0x90, 0x81, 0xfb, 0x67, 0x56, 0x47, 0x5f, 0xa7,
+    0x75, 0xd2, 0xeb, 0x9c, 0x03, 0x23, 0xb6, 0x6a, 0x9e, 0x41, 0x3f, 0x7e, 0x21, 0x74, 0xd1, 0x81,
+    0xd3, 0x5d, 0xf7, 0xae, 0xbe, 0xf0, 0xba, 0x28, 0xca, 0x11, 0x14, 0x2a, 0x29, 0x0a, 0xd5, 0xa1,
+    0x98, 0x4b, 0x1d, 0x93, 0x23, 0x57, 0x23, 0x27, 0x1d, 0x10, 0xbc, 0x56, 0x0e, 0xaa, 0x6f, 0x19,
+    0x9b, 0x37, 0x97, 0x70, 0xd7, 0xd2, 0x66, 0x54, 0xc3, 0xe6, 0xa9, 0x63, 0x47, 0x51, 0x3b, 0xe1,
+    0xc2, 0xc7, 0x62, 0x64, 0x4b, 0x40, 0xda, 0x91, 0x19, 0xc8, 0x7a, 0x49, 0x35, 0x86, 0x27, 0x08,
+    0x95, 0x90, 0xdd, 0xc0, 0x31, 0x8c, 0xe6, 0x3a, 0x72, 0x63, 0xeb, 0x75, 0xd2, 0x21, 0xc5, 0x7b,
+    0xa5, 0x9b, 0x74, 0xdb, 0xb7, 0x2f, 0x7b, 0x8f, 0xa5, 0x4d, 0x71, 0x4e, 0x4f, 0x2e, 0xbc, 0x34,
+    0xcd, 0x26, 0xb7, 0x76, 0x20, 0xa9, 0xcc, 0x24, 0xd0, 0x87, 0xb4, 0x02, 0x57, 0x55, 0x19, 0x8b,
+    0x5c, 0x22, 0x25, 0xd7, 0xaf, 0xad, 0x7b, 0xc9, 0xd0, 0x67, 0x28, 0xa5, 0x97, 0xb5, 0x11, 0x2e,
+    0x2d, 0xcf, 0x21, 0xbf, 0x58, 0xda, 0xe0, 0x70, 0x81, 0x64, 0x4e, 0xaa, 0xc5, 0x65, 0x3b, 0x22,
+    0x24, 0x38, 0x4d, 0xb2, 0xab, 0x2f, 0xbe, 0x0e, 0xe8, 0xce, 0x81, 0x39, 0x92, 0x02, 0x87, 0x0e,
+    0x93, 0xd2, 0x31, 0x91, 0x4c, 0xca, 0x32, 0x4f, 0x20, 0x7c, 0xb6, 0x46, 0x96, 0x91, 0xf9, 0x43,
+    0x73, 0xb6, 0x6f, 0x63, 0xbf, 0xaf, 0xa5, 0x4d, 0xae, 0x9b, 0x17, 0x9d, 0x89, 0xcf, 0xc6, 0x90,
+    0x54, 0x4f, 0x9e, 0xc4, 0xe9, 0x5b, 0xd5, 0x72, 0xd5, 0xad, 0xe8, 0xb4, 0x23, 0xc6, 0xd6, 0x90,
+    0x80, 0x52, 0x3a, 0x26, 0xb5, 0x1b, 0xc3, 0x90, 0x58, 0x66, 0x61, 0xb0, 0xbc, 0x1c, 0x7c, 0xbc,
+    0xec, 0x75, 0x72, 0xd1, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06,
+    0xc4, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0xf9, 0x0b, 0xb3, 0xbd, 0x99, 0x3c,
+    0xdb, 0x3c, 0x42, 0xad, 0x5b, 0xe3, 0x9e, 0x24, 0xc8, 0x66, 0x36, 0x28, 0x5f, 0x82, 0x24, 0x47,
+    0x5e, 0xd5, 0xc4, 0x3e, 0xfa, 0x25, 0x94, 0x48, 0x81, 0x45, 0x4e, 0x5e, 0xcc, 0x14, 0x66, 0x20,
+    0x43, 0x1e, 0xd1, 0x12, 0x74, 0xd8, 0xaa, 0x64, 0x51, 0xae, 0xf7, 0x26, 0xc1, 0xbc, 0x34, 0xdb,
+    0xdb, 0x52, 0x3b, 0x86, 0x83, 0x4e, 0xf2, 0xbc, 0xf3, 0x94, 0xa8, 0x9e, 0x5a, 0x47, 0xaa, 0x46,
+    0x55, 0x9b, 0x2a, 0x5f, 0xa7, 0x1c, 0xe6, 0xa5, 0x56, 0xbf, 0x64, 0x4a, 0x4e, 0x38, 0x68, 0x15,
+    0xd5, 0x71, 0xbc, 0xbe, 0x17, 0xc0, 0xa4, 0xd4, 0x35, 0xb3, 0xc9, 0x79, 0xee, 0xa3, 0xd3, 0xea,
+    0x87, 0x04, 0xf3, 0xda, 0xe4, 0x22, 0x1e, 0xb4, 0x12, 0x88, 0x4b, 0x35, 0x68, 0x0a, 0x5b, 0x1f,
+    0x3f, 0xa3, 0xd5, 0x91, 0x89, 0xd8, 0xfa, 0x6e, 0xea, 0x74, 0x5a, 0x52, 0x08, 0x99, 0x6c, 0x86,
+    0xa6, 0xbf, 0x01, 0x15, 0x36, 0x16, 0x59, 0x26, 0x7d, 0xe9, 0xb6, 0xd3, 0x5b, 0xdb, 0x85, 0x1e,
+    0xc1, 0x7f, 0x90, 0x60, 0xde, 0x99, 0x7e, 0x2f, 0xd6, 0x58, 0xe1, 0xa0, 0xb3, 0xe9, 0xf0, 0x46,
+    0x7e, 0xfc, 0x08, 0xed, 0x87, 0x04, 0xd9, 0xa7, 0xb2, 0x28, 0x46, 0x8a, 0x94, 0x01, 0x40, 0x9f,
+    0x4b, 0x52, 0x57, 0x28, 0x12, 0x44, 0x66, 0x4a, 0xe2, 0x08, 0x68, 0xaa, 0x3d, 0x7a, 0x46, 0xd3,
+    0xcb, 0x85, 0x6c, 0x94, 0x49, 0xd0, 0xd7, 0x45, 0x82, 0x79, 0x6d, 0x0f, 0x01, 0x0d, 0x44, 0x0e,
+    0x3a, 0x9b, 0x0f, 0x17, 0xe7, 0x70, 0xa9, 0x0e, 0xab, 0x7c, 0x91, 0xeb, 0x86, 0xa3, 0x62, 0x89,
+    0xf4, 0x4b, 0xe4, 0x53, 0xd5, 0xcc, 0xc7, 0x9f, 0x59, 0xaa, 0x55, 0x32, 0x04, 0x79, 0x85, 0xbd,
+    0x2c, 0x97, 0x06, 0xb4, 0xca, 0x28, 0x37, 0x09, 0xe6, 0xad, 0x35, 0x75, 0xcc, 0xe8, 0x72, 0xd0,
+    0x51, 0x39, 0x17, 0x87, 0x98, 0x57, 0x92, 0x04, 0x92, 0x34, 0x2d, 0x3d, 0x8d, 0x25, 0xb8, 0x81,
+    0xe5, 0x43, 0xfd, 0x12, 0xea, 0x33, 0x90, 0xb2, 0x72, 0x98, 0x29, 0xa0, 0xb2, 0x2c, 0xbb, 0x04,
+    0x2e, 0x31, 0x00, 0x9b, 0xf7, 0xe1, 0x34, 0x76, 0x93, 0x60, 0x5e, 0xbb, 0xca, 0x22, 0x0d, 0x84,
+    0x0e, 0x3a, 0x64, 0xc1, 0x25, 0xea, 0xe4, 0x97, 0xba, 0xd2, 0xbc, 0xcd, 0x25, 0x51, 0x47, 0x5d,
+    0x64, 0xb9, 0xa3, 0x5f, 0x82, 0xd9, 0x7a, 0xd6, 0x03, 0xb4, 0x12, 0x3b, 0xd6, 0x39, 0x9a, 0x52,
+    0x1a, 0xda, 0x42, 0xac, 0xc5, 0xeb, 0x3e, 0x5d, 0x94, 0x5d, 0x39, 0x24, 0x98, 0x17, 0x33, 0x17,
+    0xe7, 0xbb, 0x4c, 0x07, 0x9d, 0x96, 0x4e, 0x16, 0xc8, 0x3d, 0x72, 0xc2, 0x21, 0x55, 0xb7, 0x2e,
+    0x75, 0x86, 0xbe, 0x69, 0xa6, 0xcd, 0xab, 0x41, 0xf4, 0x9d, 0x15, 0x30, 0x1a, 0xc8, 0x3a, 0xa7,
+    0x57, 0x40, 0x0e, 0xaa, 0x02, 0x0d, 0xeb, 0x8a, 0xe4, 0x7d, 0xb8, 0xa8, 0xbb, 0x49, 0x30, 0xaf,
+    0x25, 0x39, 0x80, 0x06, 0x22, 0x07, 0x9d, 0x5c, 0x5f, 0x49, 0x8e, 0x21, 0x75, 0x74, 0xc6, 0x34,
+    0x9c, 0x75, 0xdf, 0x4c, 0xf5, 0x6c, 0xe9, 0x97, 0x40, 0x71, 0xa0, 0xb6, 0x12, 0x2c, 0x0a, 0x11,
+    0xac, 0x73, 0x48, 0x54, 0x49, 0x52, 0x22, 0x68, 0x11, 0xa2, 0xfb, 0x74, 0x2c, 0x1b, 0x25, 0xf2,
+    0xdd, 0x93, 0x3a, 0x68, 0x20, 0xf2, 0xf4, 0x58, 0xe9, 0x91, 0xd1, 0xc4, 0x58, 0x9f, 0x49, 0x72,
+    0x4f, 0x76, 0x9a, 0xce, 0xdd, 0xbd, 0x0d, 0x7b, 0x54, 0x56, 0x9e, 0x14, 0xb4, 0xa4, 0x77, 0xe8,
+    0x6d, 0x9d, 0xc3, 0xe5, 0x70, 0x4a, 0xf3, 0x72, 0x76, 0x92, 0x71, 0xdd, 0x47, 0x6b, 0xe8, 0x43,
+    0x82, 0x79, 0xeb, 0x90, 0x85, 0x09, 0x5a, 0x0e, 0x3a, 0x72, 0xa9, 0xc5, 0x1c, 0xb0, 0x4e, 0x38,
+    0x34, 0x16, 0xac, 0xb3, 0xd7, 0x3b, 0x5e, 0x9e, 0xb0, 0x32, 0x4a, 0xf4, 0xb4, 0xe0, 0xee, 0xb2,
+    0xd4, 0x58, 0xd6, 0x39, 0xa2, 0x72, 0x05, 0xf7, 0xea, 0xdc, 0xb3, 0xeb, 0x3e, 0x0d, 0x5a, 0xf0,
+    0x4d, 0x82, 0x79, 0xf1, 0xb2, 0x37, 0xe3, 0x48, 0x62, 0x2d, 0xcf, 0x0d, 0xd2, 0x24, 0x75, 0xb1,
+    0x42, 0xc4, 0x4e, 0x99, 0xf1, 0xe8, 0xec, 0x33, 0xc0, 0x36, 0x29, 0x66, 0x4e, 0x4a, 0x4e, 0x7b,
+    0xbd, 0xd4, 0x79, 0xec, 0x18, 0x8f, 0xfb, 0x2d, 0xa4, 0x52, 0x90, 0x13, 0xe0, 0x7d, 0x66, 0xb5,
+    0x4d, 0x36, 0x4a, 0xbe, 0x1a, 0x10, 0x27, 0x17, 0x0d, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80,
+    0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x90, 0xbf,
+    0x0a, 0x90, 0x82, 0x84, 0x06, 0x72, 0x82, 0x9b, 0xed, 0x85, 0xf1, 0x4d, 0xf2, 0x24, 0x79, 0x33,
+    0xe9, 0x48, 0x79, 0x0c, 0xe4, 0xd4, 0xe5, 0x23, 0x72, 0xa8, 0x29, 0x6c, 0xaa, 0xe6, 0xeb, 0xca,
+    0x53, 0xa7, 0x0c, 0x3c, 0xa9, 0xe2, 0x8e, 0x8c, 0xe3, 0x18, 0x5e, 0xab, 0x87, 0x02, 0x79, 0x6b,
+    0x66, 0xbe, 0x7e, 0xbf, 0x6a, 0xf8, 0x7d, 0x05, 0xaa, 0x75, 0xd4, 0x19, 0xad, 0xfc, 0xcd, 0xbf,
+    0x5f, 0x9e, 0x2c, 0x23, 0x43, 0x22, 0x09, 0x5e, 0xe2, 0x31, 0x6a, 0xd7, 0x49, 0x28, 0xc5, 0x83,
+    0x90, 0xd3, 0x33, 0x8e, 0x21, 0x9e, 0x4b, 0x7f, 0x65, 0xab, 0x1c, 0xbf, 0x74, 0x3a, 0x1d, 0xf5,
+    0x21, 0xa7, 0x48, 0x2e, 0xe5, 0xb5, 0x7e, 0xea, 0xf8, 0x7f, 0x8f, 0x2c, 0x5f, 0x9f, 0x7c, 0xfb,
+    0x48, 0x07, 0x74, 0x28, 0xe3, 0xb7, 0xac, 0x94, 0xcd, 0xfc, 0x42, 0x51, 0x86, 0x8c, 0x1f, 0x11,
+    0x1e, 0x9a, 0xdf, 0xf3, 0x38, 0xb9, 0xe0, 0x9b, 0x67, 0x75, 0xd4, 0x08, 0x94, 0x6b, 0x24, 0x69,
+    0x05, 0xa7, 0x78, 0x33, 0xe2, 0x96, 0x4b, 0x79, 0xa9, 0x9f, 0x3a, 0x2d, 0x58, 0xa0, 0xc8, 0xd4,
+    0xf2, 0xca, 0x61, 0x41, 0x0a, 0xba, 0x31, 0x09, 0xd6, 0x8f, 0x94, 0x7e, 0x56, 0xb1, 0xbf, 0xe0,
+    0x89, 0x23, 0xa2, 0x82, 0x9a, 0xaa, 0xf9, 0xba, 0xf2, 0x88, 0xb4, 0x00, 0xa5, 0x0d, 0x94, 0xb0,
+    0xc4, 0xf1, 0x82, 0xa3, 0x3b, 0xf4, 0x50, 0xe0, 0xdd, 0x03, 0x31, 0xa8, 0x3f, 0x10, 0x3e, 0xf9,
+    0xb6, 0x1e, 0x52, 0x6b, 0x8c, 0x93, 0x64, 0x1e, 0x04, 0xf3, 0xe1, 0xac, 0xa6, 0x26, 0x8d, 0x10,
+    0x54, 0x95, 0x2d, 0xd9, 0x22, 0xc1, 0xbf, 0x68, 0xf5, 0x4a, 0xd4, 0x54, 0xcd, 0x45, 0x68, 0x90,
+    0xce, 0x09, 0x38, 0x3f, 0x09, 0x03, 0x99, 0x35, 0xd8, 0x69, 0xca, 0xa4, 0x88, 0x9c, 0x42, 0xb9,
+    0x94, 0x3f, 0x90, 0x1d, 0xff, 0xba, 0x73, 0xea, 0x29, 0x47, 0x9d, 0x84, 0x7a, 0xfe, 0x71, 0x4f,
+    0x9b, 0xaa, 0xc7, 0x4c, 0xc2, 0xb5, 0xac, 0x94, 0x35, 0xd6, 0x93, 0x0c, 0xcd, 0x32, 0xb0, 0xb6,
+    0xa9, 0x9a, 0xd3, 0x95, 0xe7, 0x72, 0x15, 0xa3, 0xb2, 0x3f, 0x1c, 0x61, 0xf6, 0x70, 0xfc, 0x96,
+    0x6e, 0xc7, 0xdb, 0x05, 0x72, 0x29, 0xf5, 0xd6, 0x39, 0x64, 0xbe, 0xaf, 0x72, 0xd4, 0x41, 0x61,
+    0x6f, 0x8d, 0x6f, 0x40, 0x81, 0x3b, 0x33, 0x3a, 0x06, 0x23, 0xda, 0x4e, 0x69, 0x5c, 0xbb, 0x05,
+    0x31, 0xd0, 0x54, 0xcd, 0x65, 0xbd, 0x23, 0x37, 0x1e, 0x3a, 0x8a, 0x81, 0x10, 0x79, 0xd8, 0x2c,
+    0x90, 0x49, 0x11, 0x39, 0x85, 0x04, 0x95, 0xcc, 0x78, 0x2d, 0x20, 0x34, 0xb7, 0xe9, 0x04, 0xf7,
+    0x87, 0x13, 0xf4, 0xb1, 0x36, 0x82, 0xeb, 0x94, 0x58, 0x29, 0x64, 0x88, 0xa0, 0xf9, 0x98, 0xf2,
+    0x1c, 0x6f, 0x84, 0x3a, 0x06, 0x55, 0xd3, 0x9c, 0x8e, 0x07, 0x3b, 0xe9, 0xc3, 0x72, 0x01, 0x2c,
+    0xba, 0x56, 0xa5, 0xb8, 0x61, 0xe9, 0x43, 0x72, 0x4a, 0x51, 0x2e, 0x85, 0x92, 0x29, 0x6f, 0x1c,
+    0xb2, 0x6e, 0x47, 0x9d, 0xa6, 0x8d, 0x8e, 0x08, 0x6e, 0xd0, 0x66, 0xc0, 0x73, 0x26, 0x2b, 0x45,
+    0xeb, 0x5b, 0x1a, 0x51, 0xd6, 0x65, 0xc6, 0xa3, 0xa6, 0x6a, 0x2e, 0x57, 0x9e, 0x43, 0x7c, 0x9b,
+    0x2e, 0x80, 0x7e, 0x23, 0x36, 0x4b, 0x40, 0xc7, 0xa3, 0x97, 0x9c, 0x02, 0xb9, 0x14, 0x49, 0xa6,
+    0xbc, 0x91, 0xdb, 0x7b, 0x6c, 0x50, 0x53, 0xb2, 0x89, 0x1c, 0x4a, 0x86, 0xb1, 0xd3, 0x15, 0x64,
+    0xac, 0xd7, 0xe5, 0xbc, 0x83, 0xc7, 0x5b, 0xbf, 0x78, 0xe2, 0x6c, 0x53, 0x36, 0x97, 0x2b, 0x0f,
+    0xb5, 0x1d, 0xb8, 0xdb, 0x83, 0xe1, 0xd1, 0x1a, 0xec, 0x1c, 0xd9, 0xb2, 0x86, 0xf0, 0x22, 0x46,
+    0xbb, 0x7c, 0xed, 0x1c, 0x42, 0x2f, 0xce, 0x39, 0x55, 0x90, 0xb9, 0xba, 0x97, 0x12, 0x3c, 0x09,
+    0x19, 0xe6, 0xf4, 0x45, 0x41, 0xd9, 0xa9, 0x03, 0x26, 0xba, 0x6b, 0x09, 0xa6, 0xa6, 0x6c, 0x2e,
+    0x57, 0x1e, 0xba, 0xf1, 0xe0, 0x96, 0x38, 0xb6, 0xb0, 0xb7, 0x4a, 0xfa, 0x20, 0xb5, 0xc8, 0x29,
+    0x94, 0x4b, 0xe9, 0xcc, 0x97, 0x0e, 0x59, 0x60, 0x49, 0xc1, 0x51, 0x67, 0xbe, 0xb8, 0x7b, 0x18,
+    0x01, 0x7b, 0x35, 0x38, 0xef, 0x60, 0x57, 0x47, 0x79, 0x98, 0x54, 0x84, 0x78, 0x58, 0xb9, 0x16,
+    0x7a, 0xbb, 0xec, 0x0d, 0xba, 0x21, 0xf2, 0x77, 0xee, 0x0b, 0x13, 0xfb, 0xcf, 0xab, 0xb7, 0x15,
+    0x63, 0xc9, 0x29, 0xb9, 0xbb, 0xfd, 0x7a, 0xe9, 0x3e, 0xc4, 0xc9, 0x45, 0x03, 0x62, 0x40, 0x0c,
+    0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31,
+    0x20, 0x06, 0xe4, 0x6f, 0x72, 0xd8, 0x99, 0x44, 0x77, 0xeb, 0x34, 0xad, 0xca, 0x4f, 0xa2, 0x92,
+    0x80, 0xc3, 0x70, 0x18, 0x24, 0x3c, 0xf5, 0x26, 0x26, 0xc9, 0x24, 0xd9, 0x27, 0x27, 0xa9, 0x54,
+    0x61, 0x94, 0xd4, 0x64, 0x71, 0xe5, 0x9a, 0x10, 0xc3, 0x4b, 0x7d, 0x75, 0x51, 0x94, 0xa8, 0xd4,
+    0x19, 0x37, 0x5e, 0x9b, 0xee, 0x21, 0x93, 0x12, 0x6f, 0xa6, 0xd3, 0xe7, 0xdf, 0x65, 0xa1, 0x28,
+    0x29, 0x5f, 0x21, 0x06, 0x09, 0x68, 0x22, 0xc8, 0xb1, 0x87, 0xa4, 0x97, 0x57, 0x9e, 0x1f, 0x59,
+    0xdc, 0xeb, 0x9f, 0xd1, 0x18, 0xa7, 0x1e, 0xc7, 0x78, 0xac, 0xc7, 0xea, 0xa2, 0xd4, 0x55, 0x99,
+    0xd4, 0xb1, 0xc4, 0x9f, 0x59, 0xec, 0x7c, 0xdd, 0x90, 0x05, 0x82, 0x55, 0x82, 0x69, 0x10, 0xb7,
+    0x85, 0x14, 0x99, 0x24, 0x5b, 0x81, 0x45, 0x66, 0x98, 0x7c, 0x2c, 0x5d, 0x8c, 0x2c, 0x7b, 0x6f,
+    0x36, 0x1f, 0x8a, 0xc8, 0x17, 0x87, 0x08, 0x77, 0x9c, 0xbe, 0xb2, 0x32, 0x40, 0xe7, 0x88, 0xdb,
+    0x7c, 0x28, 0x7d, 0xbd, 0xff, 0x84, 0xfc, 0xf3, 0xb5, 0x43, 0x16, 0x75, 0x4e, 0x40, 0x21, 0x99,
+    0xd1, 0xe3, 0xb0, 0x50, 0x56, 0x3b, 0xa6, 0x96, 0x41, 0x32, 0x8f, 0x92, 0xe6, 0x38, 0xa0, 0xa2,
+    0xa4, 0xfe, 0xc4, 0x97, 0xa2, 0x0f, 0xf1, 0xca, 0xad, 0xd5, 0x26, 0xc5, 0xfb, 0x8f, 0xd6, 0xc0,
+    0xd2, 0x5b, 0x28, 0xfd, 0x5f, 0xed, 0x1e, 0x02, 0xe6, 0x4f, 0x72, 0xd2, 0x48, 0x38, 0x4c, 0xd5,
+    0xd1, 0x35, 0x59, 0x0d, 0x12, 0x32, 0x48, 0x46, 0x06, 0x0b, 0x85, 0x0b, 0x28, 0xf9, 0xa0, 0xc0,
+    0xde, 0x62, 0x53, 0x91, 0x54, 0xb4, 0x37, 0x98, 0xcb, 0x48, 0xc0, 0xe2, 0x01, 0x51, 0xea, 0xa2,
+    0x2c, 0xed, 0x84, 0xea, 0x26, 0xb8, 0x95, 0xdd, 0x11, 0x12, 0x34, 0x07, 0xd4, 0x59, 0x51, 0x11,
+    0x29, 0xb1, 0x50, 0xc4, 0x24, 0x99, 0x67, 0x0b, 0x06, 0x49, 0x9e, 0xb2, 0xb9, 0x66, 0x06, 0x4c,
+    0xf0, 0x59, 0xfb, 0x12, 0xbd, 0x69, 0xaf, 0xd4, 0x6c, 0x33, 0x27, 0x7d, 0x7b, 0x75, 0x51, 0x96,
+    0x76, 0xb2, 0x4a, 0x59, 0xfb, 0x2d, 0x78, 0x35, 0x20, 0xab, 0x73, 0x02, 0x91, 0x8d, 0xe4, 0x68,
+    0x74, 0x0e, 0xef, 0xd3, 0xdb, 0x8b, 0x0c, 0x92, 0x8b, 0xfc, 0xb0, 0x45, 0x29, 0xfd, 0x09, 0x2f,
+    0xa5, 0x78, 0xa2, 0x2b, 0x83, 0x2c, 0x5d, 0xbe, 0xbb, 0xba, 0x28, 0x1a, 0xca, 0xc6, 0xeb, 0x8a,
+    0x5a, 0x5d, 0x1d, 0x3f, 0x31, 0x48, 0xf8, 0x32, 0x40, 0x32, 0x59, 0xa3, 0x2b, 0x98, 0xb1, 0x80,
+    0x04, 0xd2, 0xa2, 0xf8, 0xce, 0xf9, 0xf3, 0x3d, 0xc4, 0x0e, 0x9f, 0x16, 0x31, 0xd9, 0x06, 0x4e,
+    0xae, 0x95, 0x29, 0xb2, 0x44, 0x9a, 0xca, 0xd4, 0xd2, 0x71, 0x65, 0x82, 0xaa, 0x42, 0x1d, 0x94,
+    0xe9, 0x7e, 0x33, 0x40, 0x4a, 0x44, 0x05, 0x5e, 0x3b, 0xa4, 0xbe, 0xfc, 0xa4, 0x83, 0x7c, 0x1b,
+    0x20, 0xd1, 0x67, 0xb8, 0xea, 0x65, 0x89, 0x2e, 0x95, 0x24, 0x35, 0xd7, 0x93, 0x90, 0xd2, 0x68,
+    0x2e, 0x1f, 0xb1, 0x61, 0x04, 0xb5, 0x54, 0x96, 0xa4, 0x54, 0x02, 0x9a, 0x30, 0xd5, 0xd0, 0x5a,
+    0x75, 0x5f, 0x38, 0x61, 0x50, 0x17, 0x65, 0x69, 0x27, 0xfa, 0xb0, 0xd9, 0xe5, 0xb4, 0x01, 0xc1,
+    0x76, 0x01, 0x3a, 0x26, 0x85, 0x6f, 0x70, 0x5c, 0xec, 0x92, 0xea, 0x15, 0x55, 0x0a, 0x28, 0x25,
+    0x92, 0xaa, 0x43, 0x97, 0x90, 0xe4, 0x92, 0x36, 0xf7, 0x65, 0x61, 0x9a, 0x2f, 0x5d, 0x49, 0x76,
+    0x2a, 0xac, 0xad, 0xa6, 0xa3, 0xb4, 0x28, 0x28, 0xa2, 0x4e, 0xb6, 0x0a, 0xee, 0xf9, 0xa3, 0x59,
+    0xfd, 0xeb, 0xd4, 0x80, 0x92, 0xdb, 0xeb, 0xd9, 0xa0, 0xf1, 0x6c, 0x46, 0xf2, 0x8b, 0x0d, 0xf2,
+    0x48, 0x87, 0x18, 0x24, 0x09, 0x3d, 0xa5, 0x22, 0x93, 0x84, 0xfd, 0x40, 0x5c, 0x95, 0xa6, 0x52,
+    0x09, 0x14, 0x98, 0x70, 0xa5, 0x18, 0x10, 0xc3, 0x98, 0x93, 0xbb, 0x4e, 0xf7, 0x8a, 0xa8, 0x24,
+    0x3f, 0x0c, 0x1f, 0x6a, 0x40, 0x30, 0x07, 0x14, 0xd9, 0x25, 0x18, 0xe2, 0xc5, 0x42, 0xd1, 0xa6,
+    0x31, 0xa3, 0xc5, 0x20, 0xd1, 0xa1, 0x01, 0x32, 0x49, 0x52, 0x3e, 0xb7, 0x7c, 0xb8, 0x10, 0x2f,
+    0x9b, 0x43, 0x21, 0x7b, 0xa5, 0x7a, 0x11, 0x36, 0x1a, 0x5c, 0x07, 0xd4, 0xe6, 0x4e, 0xf0, 0xa1,
+    0xc9, 0x39, 0xca, 0xcb, 0x5e, 0x27, 0x17, 0x0d, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18,
+    0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x90, 0xbf, 0x8b,
+    0x75, 0x72, 0xa4, 0x16, 0x12, 0x2e, 0x12, 0x64, 0x86, 0x64, 0x6e, 0x51, 0x04, 0x7e, 0xc5, 0x70,
+    0xf1, 0x8e, 0x4b, 0x8e, 0x9a, 0xaf, 0x51, 0x2e, 0xe1, 0x71, 0xc5, 0xbe, 0x8b, 0xf2, 0xb9, 0x3a,
+    0x26, 0xbc, 0x97, 0x0c, 0x7d, 0xa8, 0x1a, 0x11, 0x22, 0xb7, 0xcc, 0xed, 0x7f, 0xe8, 0x4e, 0xfc,
+    0x65, 0xb9, 0xac, 0xcb, 0xd2, 0x86, 0xce, 0x37, 0x20, 0x84, 0x64, 0xed, 0xf9, 0x36, 0x9e, 0x85,
+    0x4a, 0xe6, 0x1b, 0xb3, 0x59, 0x8f, 0x62, 0x19, 0x97, 0xa7, 0xca, 0x75, 0x40, 0x71, 0xad, 0x8e,
+    0x40, 0x59, 0xa0, 0x8e, 0x89, 0x84, 0x6b, 0x5a, 0x49, 0xca, 0xa9, 0xe1, 0x8b, 0xdc, 0x82, 0xe3,
+    0x85, 0x3f, 0x23, 0x9d, 0x7c, 0x5d, 0xb6, 0xf7, 0xb6, 0xb4, 0xa1, 0xaa, 0x02, 0x08, 0x21, 0x7d,
+    0xec, 0xbb, 0xe7, 0x11, 0x92, 0xb7, 0x70, 0xc4, 0xc0, 0xf7, 0x35, 0x64, 0xf5, 0xfb, 0x16, 0x2a,
+    0xa1, 0xc8, 0xc0, 0xea, 0x98, 0xac, 0x7d, 0x37, 0x08, 0x42, 0xe3, 0xca, 0x9e, 0xd7, 0x91, 0x69,
+    0x76, 0x11, 0xf7, 0x90, 0xcb, 0xd2, 0x26, 0xc9, 0x99, 0xc2, 0xb8, 0x55, 0xeb, 0x7e, 0x83, 0xcc,
+    0x6e, 0x12, 0xbc, 0xe8, 0xbe, 0xac, 0x2a, 0xe8, 0x2d, 0x81, 0x12, 0x56, 0x51, 0xa8, 0x44, 0x85,
+    0xaf, 0x19, 0xcc, 0xa8, 0x63, 0xb2, 0x4e, 0x3a, 0x10, 0x76, 0x02, 0xd7, 0xa4, 0xd6, 0xd0, 0x85,
+    0xa7, 0x81, 0x3d, 0x87, 0xc4, 0x2f, 0x96, 0x36, 0x29, 0xeb, 0x21, 0x54, 0x69, 0x8f, 0x13, 0x9b,
+    0x14, 0x35, 0xb2, 0x25, 0xa8, 0xa1, 0xe4, 0x3d, 0x8a, 0xe4, 0xc5, 0xae, 0x45, 0xa1, 0x12, 0x1a,
+    0xc2, 0xac, 0xa6, 0x49, 0x8a, 0xa5, 0xb2, 0x86, 0x3e, 0x50, 0x52, 0x89, 0x38, 0xb4, 0x86, 0x6e,
+    0x1b, 0xdc, 0x2f, 0xe9, 0x83, 0x45, 0x3d, 0x54, 0x39, 0x58, 0x17, 0xcf, 0x43, 0xca, 0x99, 0x51,
+    0x09, 0x07, 0xfb, 0x83, 0x8a, 0x27, 0x97, 0xb8, 0x00, 0x0e, 0x31, 0x83, 0x49, 0x42, 0xa1, 0x12,
+    0xd5, 0xa3, 0xb2, 0x56, 0xc7, 0x44, 0x22, 0x43, 0x9a, 0xbb, 0x53, 0x9a, 0x28, 0xb5, 0x6c, 0x24,
+    0xdd, 0xf6, 0xed, 0x25, 0xdc, 0xb5, 0xb4, 0x49, 0xa8, 0x94, 0x40, 0x0e, 0x06, 0x27, 0xd4, 0x57,
+    0xab, 0x09, 0x7a, 0x65, 0x09, 0x91, 0xa6, 0x23, 0x72, 0xc6, 0xd7, 0x49, 0xc1, 0x92, 0xcb, 0x49,
+    0xa7, 0x65, 0x53, 0x28, 0x1d, 0x93, 0xe2, 0xfb, 0x34, 0xf4, 0xc1, 0xa4, 0xb3, 0xb3, 0xc6, 0x90,
+    0x81, 0xfb, 0x47, 0x25, 0xf5, 0xef, 0xd3, 0x3a, 0xe9, 0x75, 0xce, 0x81, 0x11, 0x5b, 0x35, 0xcf,
+    0xa0, 0x1f, 0xbf, 0x10, 0xba, 0xe8, 0xc0, 0xe9, 0xae, 0x7b, 0x57, 0x5f, 0x78, 0x5d, 0x14, 0xe5,
+    0x08, 0x0a, 0x95, 0x14, 0x85, 0xea, 0x50, 0xcc, 0xa5, 0x8e, 0xc9, 0x91, 0xab, 0x91, 0x93, 0x0e,
+    0x08, 0x5e, 0x2b, 0x07, 0xd5, 0xb7, 0x8c, 0xcd, 0x9b, 0x4b, 0xb8, 0x6b, 0x69, 0x33, 0xaa, 0x61,
+    0xf3, 0xd4, 0xb1, 0xa3, 0xa8, 0x9d, 0x70, 0xe1, 0x63, 0x31, 0xb2, 0x25, 0x20, 0xed, 0xc8, 0x0c,
+    0x64, 0xbd, 0xa4, 0x1a, 0xc3, 0x13, 0x84, 0x4a, 0xc8, 0x6e, 0xe0, 0x18, 0x46, 0x73, 0x1d, 0xb9,
+    0xb1, 0xf5, 0x3a, 0xe9, 0x90, 0xe2, 0xbd, 0xd2, 0x4d, 0xba, 0xed, 0xdb, 0x97, 0xbd, 0xc7, 0xd2,
+    0xa6, 0x38, 0xa7, 0x27, 0x17, 0x5e, 0x9a, 0x66, 0x93, 0x5b, 0x3b, 0x90, 0x54, 0x66, 0x12, 0xe8,
+    0x43, 0x5a, 0x81, 0xab, 0xaa, 0x8c, 0x45, 0x2e, 0x91, 0x92, 0xeb, 0xd7, 0xd6, 0xbd, 0x64, 0xe8,
+    0x33, 0x94, 0xd2, 0xcb, 0xda, 0x08, 0x97, 0x96, 0xe7, 0x90, 0x5f, 0x2c, 0x6d, 0x70, 0xb8, 0x40,
+    0x32, 0x27, 0xd5, 0xe2, 0xb2, 0x1d, 0x11, 0x12, 0x9c, 0x26, 0xd9, 0xd5, 0x17, 0x5f, 0x07, 0x74,
+    0xe7, 0xc0, 0x1c, 0x49, 0x81, 0x43, 0x87, 0x49, 0xe9, 0x98, 0x48, 0x26, 0x65, 0x99, 0x27, 0x10,
+    0x3e, 0x5b, 0x23, 0xcb, 0xc8, 0xec, 0xf6, 0x2a, 0x2b, 0x2e, 0x4b, 0x9b, 0x5c, 0x37, 0x2f, 0x3a,
+    0x13, 0x9f, 0x8d, 0x21, 0xa9, 0x9e, 0x3c, 0x89, 0xd3, 0xb7, 0xaa, 0xe5, 0xaa, 0x5b, 0xd1, 0x69,
+    0x47, 0x8c, 0xad, 0x21, 0x01, 0xa5, 0x74, 0x4c, 0x6a, 0x37, 0x86, 0x21, 0xb1, 0xcc, 0xc2, 0x60,
+    0x79, 0x39, 0xf8, 0x78, 0xd9, 0xeb, 0xe4, 0xa2, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10,
+    0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0xf2, 0x17,
+    0x66, 0x7b, 0x33, 0x79, 0xb6, 0x79, 0x84, 0x5a, 0xb7, 0xc6, 0x3d, 0x49, 0x90, 0xcd, 0x6c, 0x50,
+    0xbe, 0x04, 0x49, 0x8e, 0xbc, 0xaa, 0x89, 0x7d, 0xf4, 0x4b, 0x28, 0x91, 0x02, 0x8b, 0x9c, 0xbc,
+    0x98, 0x29, 0xcc, 0x40, 0x86, 0x3c, 0xa2, 0x25, 0xe8, 0xb0, 0x55, 0xc9, 0xa2, 0x5c, 0xef, 0x4d,
+    0x82, 0x79, 0x69, 0xb6, 0xb7, 0xa5, 0x76, 0x0c, 0x07, 0x9d, 0xe4, 0x79, 0xe7, 0x29, 0x51, 0x3d,
+    0xb5, 0x8e, 0x54, 0x8d, 0xaa, 0x36, 0x55, 0xbe, 0x4e, 0x39, 0xcc, 0x4b, 0xad, 0x7e, 0xc9, 0x94,
+    0x9c, 0x70, 0xd0, 0x2a, 0xaa, 0xe3, 0x78, 0x7d, 0x2f, 0x80, 0x49, 0xa9, 0x6b, 0x66, 0x93, 0xf3,
+    0xdc, 0x47, 0xa7, 0xd5, 0x0f, 0x09, 0xe6, 0xb5, 0xc9, 0x45, 0x3c, 0x68, 0x25, 0x10, 0x97, 0x6a,
+    0xd0, 0x14, 0xb6, 0x3e, 0x7e, 0x46, 0xab, 0x23, 0x13, 0xb1, 0xf5, 0xdd, 0xd4, 0xe9, 0xb4, 0xa4,
+    0x10, 0x32, 0xd9, 0x0c, 0x4d, 0x7f, 0x03, 0x2a, 0x6c, 0x2c, 0xb2, 0x4c, 0xfa, 0xd2, 0x6d, 0xa7,
+    0xb7, 0xb6, 0x0b, 0x3d, 0x82, 0xff, 0x20, 0xc1, 0xbc, 0x33, 0xfd, 0x5e, 0xac, 0xb1, 0xc2, 0x41,
+    0x67, 0xd3, 0xe1, 0x8d, 0xfc, 0xf8, 0x11, 0xda, 0x0f, 0x09, 0xb2, 0x4f, 0x65, 0x51, 0x8c, 0x14,
+    0x29, 0x03, 0x80, 0x3e, 0x97, 0xa4, 0xae, 0x50, 0x24, 0x88, 0xcc, 0x94, 0xc4, 0x11, 0xd0, 0x54,
+    0x7b, 0xf4, 0x8c, 0xa6, 0x97, 0x0b, 0xd9, 0x28, 0x93, 0xa0, 0xaf, 0x8b, 0x04, 0xf3, 0xda, 0x1e,
+    0x02, 0x1a, 0x88, 0x1c, 0x74, 0x36, 0x1f, 0x2e, 0xce, 0xe1, 0x52, 0x1d, 0x56, 0xf9, 0x22, 0xd7,
+    0x0d, 0x47, 0xc5, 0x12, 0xe9, 0x97, 0xc8, 0xa7, 0xaa, 0x99, 0x8f, 0x3f, 0xb3, 0x54, 0xab, 0x64,
+    0x08, 0xf2, 0x0a, 0x7b, 0x59, 0x2e, 0x0d, 0x68, 0x95, 0x51, 0x6e, 0x12, 0xcc, 0x5b, 0x6b, 0xea,
+    0x98, 0xd1, 0xe5, 0xa0, 0xa3, 0x72, 0x2e, 0x0e, 0x31, 0xaf, 0x24, 0x09, 0x24, 0x69, 0x5a, 0x7a,
+    0x1a, 0x4b, 0x70, 0x03, 0xcb, 0x87, 0xfa, 0x25, 0xd4, 0x67, 0x20, 0x65, 0xe5, 0x30, 0x53, 0x40,
+    0x65, 0x59, 0x76, 0x09, 0x5c, 0x62, 0x00, 0x36, 0xef, 0xc3, 0x69, 0xec, 0x26, 0xc1, 0xbc, 0x76,
+    0x95, 0x45, 0x1a, 0x08, 0x1d, 0x74, 0xc8, 0x82, 0x4b, 0xd4, 0xc9, 0x2f, 0x75, 0xa5, 0x79, 0x9b,
+    0x4b, 0xa2, 0x8e, 0xba, 0xc8, 0x72, 0x47, 0xbf, 0x04, 0xb3, 0xf5, 0xac, 0x07, 0x68, 0x25, 0x76,
+    0xac, 0x73, 0x34, 0xa5, 0x34, 0xb4, 0x85, 0x58, 0x8b, 0xd7, 0x7d, 0xba, 0x28, 0xbb, 0x72, 0x48,
+    0x30, 0x2f, 0x66, 0x2e, 0xce, 0x77, 0x99, 0x0e, 0x3a, 0x2d, 0x9d, 0x2c, 0x90, 0x7b, 0xe4, 0x84,
+    0x43, 0xaa, 0x6e, 0x5d, 0xea, 0x0c, 0x7d, 0xd3, 0x4c, 0x9b, 0x57, 0x83, 0xe8, 0x3b, 0x2b, 0x60,
+    0x34, 0x90, 0x75, 0x4e, 0xaf, 0x80, 0x1c, 0x54, 0x05, 0x1a, 0xd6, 0x15, 0xc9, 0xfb, 0x70, 0x51,
+    0x77, 0x93, 0x60, 0x5e, 0x4b, 0x72, 0x00, 0x0d, 0x44, 0x0e, 0x3a, 0xb9, 0xbe, 0x92, 0x1c, 0x43,
+    0xea, 0xe8, 0x8c, 0x69, 0x38, 0xeb, 0xbe, 0x99, 0xea, 0xd9, 0xd2, 0x2f, 0x81, 0xe2, 0x40, 0x6d,
+    0x25, 0x58, 0x14, 0x22, 0x58, 0xe7, 0x90, 0xa8, 0x92, 0xa4, 0x44, 0xd0, 0x22, 0x44, 0xf7, 0xe9,
+    0x58, 0x36, 0x4a, 0xe4, 0xbb, 0x27, 0x75, 0xd0, 0x40, 0xe4, 0xe9, 0xb1, 0xd2, 0x23, 0xa3, 0x89,
+    0xb1, 0x3e, 0x93, 0xe4, 0x9e, 0xec, 0x34, 0x9d, 0xbb, 0x7b, 0x1b, 0xf6, 0xa8, 0xac, 0x3c, 0x29,
+    0x68, 0x49, 0xef, 0xd0, 0xdb, 0x3a, 0x87, 0xcb, 0xe1, 0x94, 0xe6, 0xe5, 0xec, 0x24, 0xe3, 0xba,
+    0x8f, 0xd6, 0xd0, 0x87, 0x04, 0xf3, 0xd6, 0x21, 0x0b, 0x13, 0xb4, 0x1c, 0x74, 0xe4, 0x52, 0x8b,
+    0x39, 0x60, 0x9d, 0x70, 0x68, 0x2c, 0x58, 0x67, 0xaf, 0x77, 0xbc, 0x3c, 0x61, 0x65, 0x94, 0xe8,
+    0x69, 0xc1, 0xdd, 0x65, 0xa9, 0xb1, 0xac, 0x73, 0x44, 0xe5, 0x0a, 0xee, 0xd5, 0xb9, 0x67, 0xd7,
+    0x7d, 0x1a, 0xb4, 0xe0, 0x9b, 0x04, 0xf3, 0xe2, 0x65, 0x6f, 0xc6, 0x91, 0xc4, 0x5a, 0x9e, 0x1b,
+    0xa4, 0x49, 0xea, 0x62, 0x85, 0x88, 0x9d, 0x32, 0xe3, 0xd1, 0xd9, 0x67, 0x80, 0x6d, 0x52, 0xcc,
+    0x9c, 0x94, 0x9c, 0xf6, 0x7a, 0xa9, 0xf3, 0xd8, 0x31, 0x1e, 0xf7, 0x5b, 0x48, 0xa5, 0x20, 0x27,
+    0xc0, 0xfb, 0xcc, 0x6a, 0x9b, 0x6c, 0x94, 0x7c, 0x35, 0x20, 0x4e, 0x2e, 0x1a, 0x10, 0x03, 0x62,
+    0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88,
+    0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20,
+    0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80,
+    0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03,
+    0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c,
+    0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31,
+    0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4,
+    0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10,
+    0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40,
+    0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0x01,
+    0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06,
+    0xc4, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18,
+    0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0x62,
+    0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88,
+    0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20,
+    0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80,
+    0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03,
+    0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c,
+    0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31,
+    0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4,
+    0x80, 0x18, 0x10, 0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10,
+    0x03, 0x62, 0x40, 0x0c, 0x88, 0x01, 0x31, 0x20, 0x06, 0xc4, 0x80, 0x18, 0x10, 0x03, 0x62, 0x40,
+    0x0c, 0x88, 0xc3, 0xe1, 0x70, 0x38, 0x1c, 0x0e, 0x87, 0xc3, 0xe1, 0x70, 0x38, 0x1c, 0x0e, 0x87,
+    0xc3, 0xe1, 0x70, 0x38, 0x1c, 0x0e, 0x87, 0xc3, 0xe1, 0x70, 0x38, 0x1c, 0x0e, 0x87, 0xc3, 0xe1,
+    0x70, 0x38, 0x1c, 0x0e, 0x87, 0xc3, 0xe1, 0x70, 0x38, 0x1c, 0x0e, 0x87, 0xc3, 0xe1, 0x70, 0x38,
+    0x1c, 0x0e, 0x87, 0xc3, 0xe1, 0x70, 0x38, 0x1c, 0x0e, 0x87, 0xc3, 0xe1, 0x70, 0x38, 0x1c, 0x0e,
+    0x87, 0xc3, 0xe1, 0x70, 0x38, 0x1c, 0x0e, 0x87, 0xc3, 0xe1, 0x70, 0x38, 0x1c, 0x0e, 0x87, 0xc3,
+    0xe1, 0x70, 0xbc, 0x25, 0xfe, 0x0d, 0xd4, 0x20, 0x2f, 0xeb, 0x44, 0x40, 0x87, 0x84, 0x00, 0x00,
+    0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
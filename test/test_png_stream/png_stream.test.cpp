@@ -0,0 +1,291 @@
+#include <unity.h>
+#include <png_stream.h>
+#include <string.h>
+#include <vector>
+#include "test_images.h"
+
+static uint32_t fake_now = 0;
+
+static uint32_t fake_now_ms() { return fake_now; }
+static void fake_wait() { fake_now += 1; }
+
+static const HttpBodyReaderOptions test_options = {
+    .total_timeout_ms = 30000,
+    .idle_timeout_ms = 5000,
+    .now_ms = fake_now_ms,
+    .wait = fake_wait,
+};
+
+/**
+ * Delivers a buffer in random-sized pieces, sometimes with nothing available,
+ * like a TLS socket being fed over WiFi.
+ */
+class RandomChunkClient : public ByteSource
+{
+public:
+  RandomChunkClient(const uint8_t *data, size_t size, uint32_t seed)
+      : data(data), size(size), pos(0), seed(seed), ready(0) {}
+
+  int available() override
+  {
+    if (pos >= size)
+      return 0;
+    if (ready == 0)
+    {
+      uint32_t r = next() % 10;
+      if (r < 2)
+        return 0; // nothing arrived yet
+      ready = 1 + next() % 1500;
+    }
+    size_t left = size - pos;
+    return (int)(ready < left ? ready : left);
+  }
+
+  int read(uint8_t *buf, size_t len) override
+  {
+    int avail = available();
+    if (avail <= 0)
+      return 0;
+    size_t n = len < (size_t)avail ? len : (size_t)avail;
+    memcpy(buf, data + pos, n);
+    pos += n;
+    ready -= n;
+    return (int)n;
+  }
+
+  bool connected() override { return pos < size; }
+
+private:
+  uint32_t next()
+  {
+    seed = seed * 1103515245 + 12345;
+    return seed >> 8;
+  }
+
+  const uint8_t *data;
+  size_t size;
+  size_t pos;
+  uint32_t seed;
+  size_t ready;
+};
+
+/** Virtual panel: keeps every row handed to the draw callback */
+struct VirtualPanel
+{
+  int width;
+  int height;
+  int pitch;
+  int rows_drawn;
+  std::vector<uint8_t> pixels;
+};
+
+static VirtualPanel *panel = nullptr;
+
+static int panel_draw(PNGDRAW *pDraw)
+{
+  if (panel->pitch == 0)
+  {
+    panel->width = pDraw->iWidth;
+    panel->pitch = (pDraw->iWidth * pDraw->iBpp + 7) / 8;
+    panel->pixels.assign(panel->pitch * 1024, 0xaa);
+  }
+  memcpy(&panel->pixels[pDraw->y * panel->pitch], pDraw->pPixels, panel->pitch);
+  panel->rows_drawn++;
+  return 1;
+}
+
+static void decode_ram(const uint8_t *image, size_t size, VirtualPanel &out)
+{
+  PNG *png = new PNG();
+  out = VirtualPanel();
+  panel = &out;
+  TEST_ASSERT_EQUAL(PNG_SUCCESS, png->openRAM((uint8_t *)image, size, panel_draw));
+  out.height = png->getHeight();
+  TEST_ASSERT_EQUAL(PNG_SUCCESS, png->decode(NULL, 0));
+  png->close();
+  delete png;
+}
+
+static void decode_stream(const uint8_t *image, size_t size, bool chunked, uint32_t seed, VirtualPanel &out)
+{
+  // chunked bodies have no Content-Length; the chunk framing is stripped by the reader
+  std::vector<uint8_t> body;
+  if (chunked)
+  {
+    char header[16];
+    for (size_t i = 0; i < size; i += 900)
+    {
+      size_t n = size - i < 900 ? size - i : 900;
+      snprintf(header, sizeof(header), "%zx\r\n", n);
+      body.insert(body.end(), header, header + strlen(header));
+      body.insert(body.end(), image + i, image + i + n);
+      body.push_back('\r');
+      body.push_back('\n');
+    }
+    const char *last = "0\r\n\r\n";
+    body.insert(body.end(), last, last + 5);
+  }
+  else
+  {
+    body.assign(image, image + size);
+  }
+
+  RandomChunkClient client(body.data(), body.size(), seed);
+  HttpBodyReader reader(client, chunked ? -1 : (int32_t)size, chunked, test_options);
+  PngStreamSource source(reader, 90000);
+
+  PNG *png = new PNG();
+  out = VirtualPanel();
+  panel = &out;
+  TEST_ASSERT_EQUAL(PNG_SUCCESS, png->open((const char *)&source, png_stream_open, png_stream_close, png_stream_read, png_stream_seek, panel_draw));
+  out.height = png->getHeight();
+  TEST_ASSERT_EQUAL(PNG_SUCCESS, png->decode(NULL, 0));
+  png->close();
+  delete png;
+
+  source.finish();
+  TEST_ASSERT_FALSE(source.failed());
+  TEST_ASSERT_EQUAL(size, source.bytesReceived());
+}
+
+static void assert_same_panel(const VirtualPanel &expected, const VirtualPanel &actual)
+{
+  TEST_ASSERT_EQUAL(expected.height, actual.rows_drawn);
+  TEST_ASSERT_EQUAL(expected.rows_drawn, actual.rows_drawn);
+  TEST_ASSERT_EQUAL(expected.pitch, actual.pitch);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected.pixels.data(), actual.pixels.data(), expected.pitch * expected.height);
+}
+
+static void check_image(const uint8_t *image, size_t size)
+{
+  VirtualPanel expected, actual;
+  decode_ram(image, size, expected);
+  for (uint32_t seed = 1; seed <= 8; seed++)
+  {
+    decode_stream(image, size, (seed & 1) != 0, seed, actual);
+    assert_same_panel(expected, actual);
+  }
+}
+
+void test_stream_decode_1bit(void)
+{
+  check_image(png_1bit, sizeof(png_1bit));
+}
+
+void test_stream_decode_2bit(void)
+{
+  check_image(png_2bit, sizeof(png_2bit));
+}
+
+void test_stream_decode_indexed(void)
+{
+  check_image(png_indexed, sizeof(png_indexed));
+}
+
+void test_tee_sees_every_byte_once(void)
+{
+  RandomChunkClient client(png_indexed, sizeof(png_indexed), 42);
+  HttpBodyReader reader(client, sizeof(png_indexed), false, test_options);
+  PngStreamSource source(reader, 90000);
+  std::vector<uint8_t> copy;
+  source.setTee([](void *ctx, const uint8_t *data, size_t len)
+                { ((std::vector<uint8_t> *)ctx)->insert(((std::vector<uint8_t> *)ctx)->end(), data, data + len); },
+                &copy);
+
+  VirtualPanel out = VirtualPanel();
+  panel = &out;
+  PNG *png = new PNG();
+  TEST_ASSERT_EQUAL(PNG_SUCCESS, png->open((const char *)&source, png_stream_open, png_stream_close, png_stream_read, png_stream_seek, panel_draw));
+  TEST_ASSERT_EQUAL(PNG_SUCCESS, png->decode(NULL, 0));
+  png->close();
+  delete png;
+  source.finish();
+
+  TEST_ASSERT_EQUAL(sizeof(png_indexed), copy.size());
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(png_indexed, copy.data(), sizeof(png_indexed));
+}
+
+void test_seek_within_rewind_window(void)
+{
+  RandomChunkClient client(png_1bit, sizeof(png_1bit), 3);
+  HttpBodyReader reader(client, sizeof(png_1bit), false, test_options);
+  PngStreamSource source(reader, 90000);
+  uint8_t buf[600];
+
+  TEST_ASSERT_EQUAL(32, source.read(buf, 32));
+  TEST_ASSERT_EQUAL(8, source.seek(8));
+  TEST_ASSERT_EQUAL(100, source.read(buf, 100));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(&png_1bit[8], buf, 100);
+
+  // forward seek skips bytes without handing them out
+  TEST_ASSERT_EQUAL(2000, source.seek(2000));
+  TEST_ASSERT_EQUAL(600, source.read(buf, 600));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(&png_1bit[2000], buf, 600);
+
+  // a few bytes back is fine, the start of the file is gone
+  TEST_ASSERT_EQUAL(2592, source.seek(2592));
+  TEST_ASSERT_EQUAL(8, source.read(buf, 8));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(&png_1bit[2592], buf, 8);
+  TEST_ASSERT_FALSE(source.failed());
+  TEST_ASSERT_EQUAL(-1, source.seek(0));
+  TEST_ASSERT_TRUE(source.failed());
+}
+
+void test_buffer_all_after_header(void)
+{
+  RandomChunkClient client(png_2bit, sizeof(png_2bit), 9);
+  HttpBodyReader reader(client, -1, false, test_options);
+  PngStreamSource source(reader, 90000);
+
+  // what PNG::open() does: look at the header only
+  uint8_t header[32];
+  TEST_ASSERT_EQUAL(32, source.read(header, 32));
+
+  std::vector<uint8_t> buf(8000);
+  size_t received = 0;
+  TEST_ASSERT_EQUAL(BODY_READ_OK, source.bufferAll(buf.data(), buf.size(), &received));
+  TEST_ASSERT_EQUAL(sizeof(png_2bit), received);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(png_2bit, buf.data(), sizeof(png_2bit));
+}
+
+void test_buffer_all_too_big(void)
+{
+  RandomChunkClient client(png_2bit, sizeof(png_2bit), 11);
+  HttpBodyReader reader(client, sizeof(png_2bit), false, test_options);
+  PngStreamSource source(reader, 90000);
+  uint8_t header[32];
+  source.read(header, 32);
+
+  std::vector<uint8_t> buf(1000);
+  size_t received = 0;
+  TEST_ASSERT_EQUAL(BODY_READ_TOO_BIG, source.bufferAll(buf.data(), buf.size(), &received));
+}
+
+void setUp(void)
+{
+  fake_now = 0;
+}
+
+void tearDown(void)
+{
+  panel = nullptr;
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_stream_decode_1bit);
+  RUN_TEST(test_stream_decode_2bit);
+  RUN_TEST(test_stream_decode_indexed);
+  RUN_TEST(test_tee_sees_every_byte_once);
+  RUN_TEST(test_seek_within_rewind_window);
+  RUN_TEST(test_buffer_all_after_header);
+  RUN_TEST(test_buffer_all_too_big);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
@@ -0,0 +1,724 @@
+#pragma once
+
+#include <stdint.h>
+
+// 200x120 1-bpp grayscale, with a 1.5KB tEXt chunk ahead of the image data
+static const uint8_t png_1bit[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x78, 0x01, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xe9, 0x80,
+    0x46, 0x00, 0x00, 0x05, 0xe4, 0x74, 0x45, 0x58, 0x74, 0x43, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74,
+    0x00, 0x75, 0x22, 0x33, 0x70, 0x62, 0x60, 0x31, 0x2a, 0x24, 0x3b, 0x30, 0x39, 0x44, 0x77, 0x4d,
+    0x28, 0x71, 0x78, 0x23, 0x24, 0x21, 0x31, 0x53, 0x2d, 0x71, 0x4c, 0x5c, 0x59, 0x49, 0x21, 0x34,
+    0x21, 0x78, 0x65, 0x51, 0x62, 0x29, 0x25, 0x74, 0x72, 0x71, 0x6f, 0x55, 0x30, 0x43, 0x5c, 0x3d,
+    0x67, 0x71, 0x6f, 0x5a, 0x4d, 0x71, 0x21, 0x79, 0x3b, 0x42, 0x37, 0x63, 0x2b, 0x7b, 0x26, 0x21,
+    0x29, 0x79, 0x2e, 0x61, 0x3a, 0x31, 0x7b, 0x50, 0x67, 0x64, 0x3e, 0x46, 0x63, 0x3c, 0x63, 0x41,
+    0x21, 0x7d, 0x55, 0x73, 0x6c, 0x4c, 0x2b, 0x5c, 0x6a, 0x6b, 0x56, 0x66, 0x68, 0x22, 0x5d, 0x59,
+    0x23, 0x38, 0x49, 0x3f, 0x5d, 0x6a, 0x21, 0x74, 0x58, 0x43, 0x2e, 0x46, 0x42, 0x6c, 0x40, 0x60,
+    0x2e, 0x3c, 0x6b, 0x5e, 0x7e, 0x26, 0x4a, 0x46, 0x64, 0x33, 0x56, 0x68, 0x45, 0x28, 0x6e, 0x56,
+    0x6e, 0x38, 0x59, 0x68, 0x56, 0x29, 0x6e, 0x62, 0x55, 0x5a, 0x2f, 0x7a, 0x78, 0x4f, 0x36, 0x67,
+    0x7d, 0x7a, 0x6a, 0x6d, 0x51, 0x4c, 0x30, 0x73, 0x26, 0x59, 0x6c, 0x58, 0x50, 0x43, 0x45, 0x70,
+    0x3b, 0x38, 0x2f, 0x73, 0x4f, 0x64, 0x4f, 0x71, 0x7b, 0x74, 0x62, 0x53, 0x77, 0x21, 0x74, 0x4e,
+    0x70, 0x62, 0x2e, 0x70, 0x39, 0x74, 0x3c, 0x73, 0x4c, 0x24, 0x62, 0x30, 0x60, 0x40, 0x5e, 0x21,
+    0x5a, 0x5f, 0x78, 0x41, 0x65, 0x61, 0x2f, 0x28, 0x54, 0x6c, 0x4b, 0x3c, 0x3d, 0x3d, 0x5e, 0x63,
+    0x33, 0x45, 0x5e, 0x4e, 0x3c, 0x4e, 0x40, 0x7e, 0x31, 0x57, 0x35, 0x7e, 0x4e, 0x39, 0x2d, 0x61,
+    0x21, 0x44, 0x2c, 0x4f, 0x7b, 0x66, 0x37, 0x42, 0x58, 0x57, 0x5b, 0x21, 0x69, 0x7d, 0x3e, 0x65,
+    0x3c, 0x3e, 0x4a, 0x31, 0x6e, 0x7b, 0x7e, 0x7a, 0x69, 0x33, 0x4e, 0x48, 0x41, 0x75, 0x3e, 0x77,
+    0x2d, 0x23, 0x46, 0x25, 0x48, 0x7b, 0x20, 0x3e, 0x60, 0x60, 0x34, 0x49, 0x78, 0x75, 0x3a, 0x5d,
+    0x27, 0x35, 0x39, 0x47, 0x71, 0x2c, 0x34, 0x33, 0x3a, 0x68, 0x30, 0x7b, 0x48, 0x66, 0x4f, 0x7a,
+    0x52, 0x63, 0x2f, 0x29, 0x5c, 0x2b, 0x2e, 0x7d, 0x49, 0x5a, 0x36, 0x61, 0x37, 0x59, 0x70, 0x53,
+    0x5e, 0x7b, 0x56, 0x5b, 0x70, 0x3a, 0x6b, 0x48, 0x47, 0x4b, 0x40, 0x76, 0x21, 0x2b, 0x39, 0x51,
+    0x42, 0x7e, 0x2c, 0x24, 0x6a, 0x6e, 0x73, 0x76, 0x38, 0x3a, 0x49, 0x37, 0x34, 0x21, 0x5a, 0x26,
+    0x39, 0x29, 0x32, 0x6c, 0x74, 0x2c, 0x3e, 0x76, 0x44, 0x76, 0x32, 0x4a, 0x61, 0x24, 0x67, 0x7a,
+    0x49, 0x2f, 0x50, 0x2b, 0x35, 0x70, 0x2a, 0x3d, 0x64, 0x46, 0x33, 0x4e, 0x7c, 0x4b, 0x61, 0x64,
+    0x72, 0x4a, 0x64, 0x5c, 0x29, 0x66, 0x55, 0x58, 0x40, 0x7e, 0x7e, 0x47, 0x55, 0x29, 0x4e, 0x3c,
+    0x5f, 0x70, 0x2b, 0x7d, 0x67, 0x50, 0x46, 0x61, 0x27, 0x5f, 0x5d, 0x2e, 0x4a, 0x56, 0x64, 0x67,
+    0x7d, 0x6f, 0x62, 0x48, 0x58, 0x47, 0x63, 0x69, 0x24, 0x26, 0x33, 0x66, 0x49, 0x3b, 0x30, 0x6a,
+    0x7d, 0x36, 0x20, 0x33, 0x3c, 0x38, 0x78, 0x66, 0x48, 0x5e, 0x24, 0x4a, 0x34, 0x2f, 0x42, 0x27,
+    0x41, 0x5f, 0x7a, 0x5f, 0x27, 0x56, 0x5f, 0x6a, 0x4b, 0x57, 0x28, 0x22, 0x74, 0x25, 0x74, 0x60,
+    0x39, 0x78, 0x7c, 0x71, 0x33, 0x3a, 0x3f, 0x5b, 0x26, 0x56, 0x70, 0x36, 0x69, 0x52, 0x4c, 0x28,
+    0x66, 0x7a, 0x48, 0x49, 0x65, 0x53, 0x61, 0x36, 0x32, 0x7e, 0x78, 0x75, 0x2d, 0x50, 0x39, 0x2f,
+    0x79, 0x4c, 0x21, 0x47, 0x54, 0x28, 0x57, 0x38, 0x76, 0x63, 0x60, 0x7b, 0x57, 0x33, 0x7b, 0x26,
+    0x57, 0x35, 0x53, 0x5b, 0x60, 0x22, 0x36, 0x79, 0x25, 0x65, 0x2a, 0x30, 0x5c, 0x55, 0x3f, 0x70,
+    0x75, 0x2d, 0x7e, 0x78, 0x66, 0x45, 0x33, 0x26, 0x5d, 0x35, 0x30, 0x34, 0x56, 0x5b, 0x32, 0x21,
+    0x5f, 0x26, 0x4f, 0x74, 0x64, 0x6c, 0x7e, 0x3d, 0x5f, 0x68, 0x42, 0x5b, 0x40, 0x26, 0x53, 0x7c,
+    0x7d, 0x5c, 0x7b, 0x3b, 0x4b, 0x5e, 0x67, 0x4a, 0x48, 0x36, 0x2f, 0x7c, 0x35, 0x2d, 0x3b, 0x7b,
+    0x2c, 0x65, 0x28, 0x2b, 0x2c, 0x4d, 0x3c, 0x4b, 0x7b, 0x4d, 0x78, 0x50, 0x4f, 0x3f, 0x33, 0x5d,
+    0x3d, 0x36, 0x58, 0x41, 0x6d, 0x7e, 0x32, 0x61, 0x66, 0x49, 0x7b, 0x6a, 0x4d, 0x48, 0x55, 0x66,
+    0x63, 0x35, 0x33, 0x49, 0x2b, 0x3d, 0x52, 0x6f, 0x61, 0x21, 0x56, 0x7c, 0x3d, 0x4f, 0x5c, 0x33,
+    0x46, 0x5e, 0x50, 0x3a, 0x49, 0x32, 0x7b, 0x4f, 0x6b, 0x4f, 0x22, 0x61, 0x40, 0x46, 0x72, 0x64,
+    0x5b, 0x71, 0x2e, 0x24, 0x67, 0x56, 0x65, 0x39, 0x5b, 0x45, 0x5e, 0x75, 0x42, 0x73, 0x52, 0x22,
+    0x6e, 0x3d, 0x4a, 0x60, 0x40, 0x57, 0x72, 0x22, 0x70, 0x3b, 0x7b, 0x2e, 0x29, 0x4b, 0x27, 0x3a,
+    0x66, 0x72, 0x7e, 0x7a, 0x68, 0x36, 0x63, 0x33, 0x64, 0x48, 0x5c, 0x4d, 0x57, 0x42, 0x39, 0x2a,
+    0x64, 0x6a, 0x56, 0x73, 0x3f, 0x26, 0x6f, 0x2a, 0x37, 0x64, 0x45, 0x30, 0x64, 0x40, 0x7b, 0x76,
+    0x42, 0x5b, 0x38, 0x34, 0x53, 0x6d, 0x6a, 0x5e, 0x42, 0x26, 0x4c, 0x76, 0x5e, 0x53, 0x24, 0x52,
+    0x6a, 0x50, 0x6f, 0x43, 0x7b, 0x31, 0x24, 0x73, 0x47, 0x62, 0x41, 0x57, 0x22, 0x71, 0x60, 0x46,
+    0x34, 0x42, 0x2f, 0x67, 0x71, 0x75, 0x71, 0x5a, 0x47, 0x4d, 0x5c, 0x50, 0x6a, 0x40, 0x6b, 0x30,
+    0x65, 0x70, 0x3a, 0x5d, 0x73, 0x29, 0x2d, 0x6b, 0x59, 0x3f, 0x2d, 0x45, 0x42, 0x56, 0x5d, 0x6b,
+    0x66, 0x24, 0x22, 0x2e, 0x29, 0x39, 0x3d, 0x6e, 0x2b, 0x4e, 0x34, 0x58, 0x74, 0x35, 0x3f, 0x70,
+    0x6b, 0x5e, 0x2a, 0x7e, 0x7d, 0x2c, 0x62, 0x7b, 0x25, 0x7a, 0x6c, 0x45, 0x5b, 0x63, 0x49, 0x67,
+    0x48, 0x68, 0x27, 0x28, 0x3d, 0x62, 0x66, 0x2c, 0x60, 0x52, 0x38, 0x57, 0x4c, 0x7c, 0x60, 0x4e,
+    0x34, 0x7d, 0x44, 0x24, 0x70, 0x3c, 0x37, 0x7a, 0x6e, 0x38, 0x3f, 0x29, 0x3f, 0x74, 0x2e, 0x26,
+    0x31, 0x63, 0x76, 0x77, 0x28, 0x7d, 0x2d, 0x32, 0x72, 0x27, 0x70, 0x22, 0x6c, 0x22, 0x6a, 0x7d,
+    0x74, 0x20, 0x21, 0x5f, 0x33, 0x2a, 0x26, 0x54, 0x26, 0x49, 0x38, 0x36, 0x6d, 0x2d, 0x25, 0x70,
+    0x4e, 0x32, 0x7a, 0x73, 0x27, 0x30, 0x39, 0x7b, 0x65, 0x42, 0x59, 0x32, 0x74, 0x22, 0x66, 0x77,
+    0x2e, 0x75, 0x7e, 0x77, 0x57, 0x6a, 0x51, 0x53, 0x28, 0x46, 0x65, 0x65, 0x4a, 0x7e, 0x7a, 0x3e,
+    0x22, 0x51, 0x6a, 0x6c, 0x5f, 0x50, 0x35, 0x28, 0x79, 0x5a, 0x5a, 0x5c, 0x31, 0x33, 0x7a, 0x21,
+    0x77, 0x27, 0x31, 0x36, 0x68, 0x28, 0x44, 0x6b, 0x7d, 0x44, 0x2d, 0x76, 0x27, 0x3a, 0x61, 0x3d,
+    0x37, 0x54, 0x60, 0x6c, 0x39, 0x69, 0x6b, 0x42, 0x7c, 0x3e, 0x33, 0x6a, 0x2d, 0x56, 0x21, 0x2d,
+    0x69, 0x53, 0x6a, 0x5b, 0x66, 0x38, 0x3a, 0x23, 0x6a, 0x79, 0x53, 0x5f, 0x69, 0x60, 0x5b, 0x4f,
+    0x27, 0x3b, 0x5e, 0x26, 0x39, 0x39, 0x5f, 0x38, 0x71, 0x51, 0x58, 0x34, 0x37, 0x46, 0x6e, 0x46,
+    0x29, 0x4f, 0x71, 0x48, 0x65, 0x2d, 0x5c, 0x6f, 0x3a, 0x72, 0x56, 0x25, 0x59, 0x74, 0x31, 0x6a,
+    0x3c, 0x55, 0x72, 0x27, 0x46, 0x37, 0x3b, 0x70, 0x6f, 0x77, 0x78, 0x5b, 0x4a, 0x73, 0x55, 0x27,
+    0x6b, 0x34, 0x24, 0x7d, 0x54, 0x4a, 0x50, 0x69, 0x57, 0x4b, 0x5b, 0x6f, 0x3f, 0x5b, 0x5d, 0x55,
+    0x7b, 0x41, 0x36, 0x3c, 0x75, 0x35, 0x46, 0x7c, 0x4d, 0x4e, 0x63, 0x53, 0x5e, 0x4e, 0x30, 0x30,
+    0x53, 0x3e, 0x24, 0x5b, 0x59, 0x5e, 0x41, 0x5b, 0x76, 0x51, 0x39, 0x47, 0x28, 0x31, 0x69, 0x56,
+    0x63, 0x4e, 0x7d, 0x26, 0x22, 0x75, 0x2d, 0x56, 0x73, 0x26, 0x5c, 0x5c, 0x56, 0x42, 0x72, 0x64,
+    0x38, 0x6c, 0x3c, 0x77, 0x61, 0x56, 0x2e, 0x75, 0x3e, 0x60, 0x78, 0x24, 0x42, 0x34, 0x5e, 0x47,
+    0x78, 0x5c, 0x30, 0x3b, 0x4f, 0x45, 0x6f, 0x38, 0x2b, 0x42, 0x5f, 0x38, 0x73, 0x67, 0x45, 0x6d,
+    0x66, 0x34, 0x6c, 0x4b, 0x51, 0x47, 0x3e, 0x75, 0x25, 0x77, 0x6c, 0x74, 0x40, 0x42, 0x69, 0x7c,
+    0x7c, 0x73, 0x20, 0x6e, 0x61, 0x62, 0x39, 0x52, 0x23, 0x40, 0x5a, 0x6e, 0x65, 0x6c, 0x20, 0x5a,
+    0x4e, 0x38, 0x7a, 0x53, 0x39, 0x6e, 0x5a, 0x46, 0x26, 0x33, 0x5e, 0x2d, 0x25, 0x5d, 0x46, 0x35,
+    0x61, 0x32, 0x39, 0x35, 0x6a, 0x4d, 0x59, 0x6c, 0x32, 0x2f, 0x55, 0x34, 0x24, 0x65, 0x20, 0x42,
+    0x34, 0x72, 0x3d, 0x2e, 0x5f, 0x61, 0x37, 0x22, 0x38, 0x2c, 0x29, 0x49, 0x23, 0x75, 0x3e, 0x46,
+    0x36, 0x5e, 0x7d, 0x38, 0x6c, 0x4e, 0x28, 0x26, 0x77, 0x37, 0x48, 0x53, 0x3c, 0x46, 0x79, 0x26,
+    0x40, 0x71, 0x7b, 0x39, 0x2a, 0x7e, 0x75, 0x56, 0x7b, 0x50, 0x7c, 0x7c, 0x67, 0x21, 0x42, 0x78,
+    0x31, 0x58, 0x6c, 0x59, 0x7a, 0x23, 0x6a, 0x6e, 0x21, 0x3c, 0x72, 0x40, 0x5d, 0x7a, 0x52, 0x70,
+    0x26, 0x71, 0x32, 0x21, 0x40, 0x27, 0x6a, 0x38, 0x66, 0x55, 0x45, 0x78, 0x4f, 0x4a, 0x72, 0x48,
+    0x70, 0x35, 0x53, 0x54, 0x6a, 0x65, 0x2e, 0x38, 0x21, 0x58, 0x7d, 0x4c, 0x68, 0x37, 0x44, 0x27,
+    0x23, 0x56, 0x78, 0x4a, 0x50, 0x56, 0x75, 0x6d, 0x58, 0x74, 0x58, 0x77, 0x5d, 0x4a, 0x38, 0x64,
+    0x73, 0x68, 0x5a, 0x26, 0x69, 0x34, 0x3c, 0x57, 0x7c, 0x2b, 0x63, 0x7c, 0x52, 0x4e, 0x45, 0x29,
+    0x7e, 0x66, 0x28, 0x6c, 0x3b, 0x6d, 0x35, 0x3d, 0x75, 0x3c, 0x49, 0x69, 0x3e, 0x3d, 0x34, 0x51,
+    0x40, 0x3e, 0x60, 0x52, 0x25, 0x49, 0x49, 0x71, 0x42, 0x74, 0x20, 0x70, 0x31, 0x40, 0x5c, 0x46,
+    0x4f, 0x38, 0x56, 0x29, 0x5c, 0x27, 0x53, 0x3e, 0x31, 0x26, 0x2e, 0x5a, 0x31, 0x35, 0x48, 0x26,
+    0x45, 0x50, 0x3e, 0x70, 0x61, 0x22, 0x74, 0x21, 0x6c, 0x7d, 0x7a, 0x65, 0x4e, 0x23, 0x5e, 0x32,
+    0x2e, 0x2c, 0x37, 0x72, 0x69, 0x5b, 0x71, 0x3b, 0x45, 0x23, 0x48, 0x7a, 0x7b, 0x72, 0x37, 0x24,
+    0x5b, 0x69, 0x7b, 0x47, 0x27, 0x4c, 0x3d, 0x53, 0x68, 0x78, 0x2f, 0x6f, 0x79, 0x7c, 0x64, 0x68,
+    0x28, 0x35, 0x5c, 0x73, 0x34, 0x27, 0x49, 0x46, 0x27, 0x46, 0x57, 0x7e, 0x61, 0x6c, 0x2e, 0x78,
+    0x23, 0x26, 0x53, 0x40, 0x3e, 0x6a, 0x27, 0x23, 0x55, 0x4a, 0x74, 0x61, 0x7d, 0x50, 0x79, 0x35,
+    0x2b, 0x71, 0x2a, 0x24, 0x55, 0x49, 0x66, 0x64, 0x78, 0x3b, 0x39, 0x22, 0x2f, 0x6d, 0x5e, 0x5c,
+    0x77, 0x75, 0x36, 0x46, 0x54, 0x42, 0x49, 0x4f, 0x7e, 0x2b, 0x6c, 0x6e, 0x43, 0x62, 0x73, 0x6d,
+    0x7e, 0x6e, 0x4c, 0x38, 0x2e, 0x5d, 0x76, 0x6d, 0x53, 0x76, 0x62, 0x79, 0x36, 0x72, 0x4f, 0x54,
+    0x63, 0x60, 0x34, 0x7a, 0x39, 0x77, 0x72, 0x5c, 0x25, 0x30, 0x22, 0x5a, 0x58, 0x6c, 0x64, 0x48,
+    0x4d, 0x7c, 0x62, 0x2b, 0x52, 0x20, 0x2a, 0x5a, 0x3d, 0x37, 0x7e, 0x38, 0x63, 0x44, 0x67, 0x5e,
+    0x79, 0x2d, 0x72, 0x2a, 0x47, 0x4b, 0x5a, 0x21, 0x56, 0x42, 0x50, 0x47, 0x45, 0xda, 0x2a, 0xa9,
+    0xd0, 0x00, 0x00, 0x02, 0xbc, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0x2d, 0x96, 0x7f, 0x6c, 0x95,
+    0xe5, 0x15, 0xc7, 0x9f, 0x7b, 0x7b, 0x6f, 0xb9, 0xfd, 0xe9, 0x6d, 0xb9, 0x92, 0x5b, 0xc0, 0x7a,
+    0x7b, 0x5b, 0xb1, 0x05, 0x9c, 0xa5, 0x76, 0x8c, 0x09, 0x89, 0x6f, 0x7f, 0x97, 0x5a, 0x09, 0xad,
+    0x60, 0x9c, 0x51, 0x72, 0x5b, 0xc1, 0x15, 0x47, 0xb2, 0x62, 0xf6, 0x4b, 0xb7, 0x3f, 0x6e, 0xdb,
+    0x5b, 0x47, 0xa1, 0xba, 0x16, 0x30, 0x16, 0xb3, 0xe8, 0x15, 0x18, 0x1b, 0x86, 0x2d, 0x75, 0xeb,
+    0x22, 0x9a, 0x2d, 0x2b, 0x75, 0x75, 0x88, 0xce, 0xb4, 0x9b, 0x33, 0xd3, 0xb8, 0x0d, 0x1d, 0x12,
+    0x63, 0x96, 0x85, 0xb1, 0x2d, 0x59, 0xf6, 0xcf, 0x77, 0x9f, 0xf3, 0xbe, 0xfb, 0xe3, 0xed, 0x7b,
+    0xfb, 0x9e, 0xe7, 0x39, 0xcf, 0xf7, 0x7c, 0xcf, 0xf7, 0x9c, 0xf3, 0xb8, 0xfe, 0x9f, 0x49, 0xd1,
+    0x8b, 0xd2, 0x70, 0xb7, 0xd4, 0x9f, 0x95, 0xc2, 0x95, 0xd2, 0xdf, 0x46, 0xa5, 0x6a, 0x97, 0x89,
+    0x4b, 0xb7, 0x3f, 0x21, 0xed, 0xfd, 0xbc, 0x74, 0xbc, 0x5e, 0xf2, 0x9e, 0x97, 0x0a, 0xe6, 0xa5,
+    0x51, 0x17, 0x62, 0x7d, 0x63, 0xb5, 0x94, 0x8f, 0xf2, 0x6c, 0x94, 0x5c, 0x48, 0x5a, 0x33, 0x21,
+    0xa5, 0xdc, 0x44, 0x5a, 0xda, 0x9a, 0x94, 0x2e, 0xe6, 0xa5, 0xbf, 0xdc, 0x28, 0xbd, 0xe9, 0xd8,
+    0x73, 0x5e, 0xfa, 0xcc, 0xa5, 0x3f, 0x27, 0x2d, 0x45, 0x6c, 0xb7, 0xf4, 0x29, 0x9e, 0x1f, 0xe2,
+    0x7d, 0xf0, 0xd7, 0x9c, 0xe9, 0x56, 0x4f, 0x49, 0x33, 0xec, 0x8e, 0xdf, 0x19, 0xac, 0x68, 0xe6,
+    0xff, 0x2b, 0xdf, 0xc4, 0xab, 0x5b, 0xbe, 0x20, 0xe5, 0xd6, 0x82, 0x69, 0x52, 0x5a, 0x2c, 0x90,
+    0x2a, 0x36, 0xf1, 0x9c, 0x91, 0x36, 0xb8, 0x2c, 0x6b, 0x3e, 0x89, 0x49, 0xd3, 0xcb, 0xd2, 0x3a,
+    0xce, 0x6b, 0x07, 0xc1, 0xf9, 0x2d, 0xd2, 0x88, 0xeb, 0x1a, 0xc1, 0xd3, 0x35, 0xa9, 0xee, 0x55,
+    0x50, 0xbf, 0x01, 0xea, 0x55, 0x52, 0x61, 0xad, 0x54, 0xeb, 0xe2, 0x7d, 0xd2, 0xe4, 0x71, 0xfc,
+    0x4e, 0x4b, 0xfb, 0xdb, 0xa5, 0x56, 0x22, 0xdd, 0xf5, 0x8e, 0x54, 0xef, 0x62, 0x2d, 0xd2, 0xce,
+    0x61, 0xe9, 0x83, 0xa3, 0xd2, 0x47, 0x70, 0x70, 0x66, 0x46, 0xea, 0x1e, 0x93, 0x2e, 0xb8, 0xa2,
+    0x61, 0x8b, 0x4a, 0xfa, 0x09, 0xef, 0xd1, 0x6d, 0xd2, 0x4d, 0x9c, 0x11, 0x23, 0xae, 0x8b, 0xee,
+    0x08, 0x8c, 0x44, 0x17, 0xc0, 0x46, 0xc4, 0x0f, 0xe3, 0x35, 0x3f, 0x87, 0x25, 0x62, 0xa8, 0x73,
+    0xe0, 0xaa, 0xc7, 0x4b, 0x7a, 0x48, 0x1a, 0xcc, 0x80, 0xa9, 0x43, 0x3a, 0x10, 0x06, 0xa7, 0x7b,
+    0x3c, 0x85, 0xb7, 0xaf, 0x07, 0xeb, 0xb2, 0x9e, 0x54, 0x03, 0x0f, 0x69, 0xe3, 0xcf, 0x75, 0x81,
+    0x3f, 0x8c, 0xb7, 0xe8, 0x67, 0xd2, 0x7b, 0x7c, 0x3d, 0x51, 0xc7, 0xca, 0x42, 0xb3, 0x48, 0x21,
+    0xbe, 0xc7, 0xb7, 0x4b, 0x49, 0x62, 0xde, 0xd2, 0x24, 0x75, 0x62, 0xbf, 0x2b, 0x22, 0x2c, 0xf9,
+    0x1d, 0x58, 0xe0, 0xf0, 0x95, 0x07, 0x38, 0x71, 0x05, 0xbc, 0x80, 0xe5, 0xd9, 0x32, 0xb3, 0xdc,
+    0x7b, 0x8b, 0xf4, 0xfd, 0xd7, 0xb1, 0x76, 0x12, 0x09, 0x58, 0x46, 0xbe, 0x2d, 0x0d, 0xdc, 0x61,
+    0x96, 0xed, 0x3c, 0x29, 0xd6, 0xad, 0xe4, 0xc4, 0x3e, 0x18, 0xb8, 0x95, 0xec, 0xa4, 0x06, 0xcd,
+    0xd2, 0x73, 0xd1, 0xe2, 0x92, 0x12, 0x3c, 0xf1, 0x62, 0xa9, 0xa5, 0x91, 0xf3, 0x63, 0x66, 0x71,
+    0x35, 0x64, 0xb1, 0x31, 0x60, 0xac, 0x0c, 0xaf, 0xe5, 0x44, 0xd8, 0x18, 0x36, 0x4b, 0xdb, 0x2e,
+    0xe9, 0xcb, 0x6f, 0xc1, 0x3f, 0xe7, 0x75, 0xa0, 0xa0, 0xe4, 0x53, 0xa0, 0xba, 0x6c, 0x96, 0x4e,
+    0xd8, 0x9a, 0x5e, 0x29, 0xdd, 0xd9, 0xc6, 0xfe, 0x71, 0x62, 0x85, 0xa3, 0x85, 0x51, 0xb3, 0x94,
+    0x5d, 0x91, 0x1e, 0x63, 0xfd, 0x0a, 0x58, 0xce, 0x95, 0xe2, 0xf9, 0x5e, 0xd8, 0xcf, 0x9a, 0xe5,
+    0x61, 0x9e, 0xee, 0x5e, 0xb8, 0xc1, 0x63, 0xcf, 0x4e, 0xb0, 0x92, 0xbb, 0x59, 0x1f, 0x41, 0x0d,
+    0xf1, 0x3f, 0x7d, 0x1a, 0x6c, 0x03, 0x52, 0x31, 0x9c, 0x1e, 0x83, 0x5b, 0xcf, 0x33, 0x4b, 0xb8,
+    0x4c, 0x1a, 0xe3, 0x3d, 0xff, 0x02, 0xf1, 0x54, 0xe0, 0x11, 0xe4, 0x89, 0x2e, 0xb3, 0x78, 0xf0,
+    0xb4, 0x12, 0x85, 0x5e, 0xf9, 0x2d, 0x08, 0x4e, 0x82, 0xfa, 0x92, 0x74, 0x34, 0x65, 0x96, 0x1c,
+    0x2c, 0x2f, 0xed, 0x23, 0x3b, 0x67, 0xc9, 0xc5, 0x7f, 0x58, 0xc9, 0xb7, 0xfe, 0x83, 0xbe, 0x37,
+    0x22, 0x73, 0x68, 0xf7, 0x02, 0x2a, 0xaa, 0x66, 0x7f, 0xc5, 0x1a, 0x34, 0x92, 0xf3, 0xbd, 0xa1,
+    0x91, 0x30, 0xef, 0xc8, 0x56, 0x72, 0x46, 0xfe, 0xe6, 0xe0, 0x64, 0xbe, 0x5b, 0xae, 0xbe, 0x08,
+    0xf4, 0x54, 0xc8, 0xc2, 0x57, 0x58, 0x0d, 0x3f, 0xe3, 0x78, 0x68, 0x23, 0xd6, 0x4a, 0x37, 0xb7,
+    0x1e, 0x3e, 0x9a, 0xa5, 0x93, 0x1f, 0x4b, 0x25, 0xcf, 0x48, 0x55, 0x30, 0x5e, 0x35, 0x6c, 0x5e,
+    0xea, 0xc8, 0x7d, 0xe4, 0x6e, 0x7c, 0xe2, 0xa7, 0x84, 0x67, 0xf8, 0x1c, 0x31, 0xdf, 0xe7, 0x2b,
+    0xd1, 0xb2, 0x93, 0x80, 0x39, 0x35, 0xcd, 0x96, 0x0e, 0x00, 0x00, 0x02, 0xbc, 0x49, 0x44, 0x41,
+    0x54, 0x56, 0x94, 0xc2, 0xd1, 0x20, 0x6c, 0x64, 0x38, 0xf9, 0x46, 0x67, 0x9c, 0x3b, 0xf4, 0x93,
+    0x27, 0x77, 0x8e, 0x7a, 0xb8, 0xc6, 0xfe, 0x23, 0xc4, 0xda, 0xe0, 0xc2, 0xc4, 0x18, 0x3d, 0xc2,
+    0x57, 0xce, 0x99, 0x44, 0x9f, 0xa5, 0x97, 0x89, 0xb5, 0xdd, 0x58, 0xd9, 0x98, 0x08, 0x54, 0x78,
+    0xc7, 0x8b, 0xd2, 0xef, 0x60, 0xa0, 0x80, 0x6c, 0xed, 0xc2, 0xd2, 0xe5, 0x1c, 0xa7, 0xa6, 0xf1,
+    0xb6, 0xc6, 0x59, 0xcd, 0x50, 0xf1, 0xa8, 0x7d, 0xf6, 0x26, 0x3c, 0xba, 0x08, 0x55, 0xb2, 0x4c,
+    0x8e, 0x4f, 0x3e, 0x07, 0xae, 0x7b, 0xa4, 0xcd, 0xfc, 0x8e, 0x7c, 0x68, 0xba, 0x69, 0xe2, 0xe4,
+    0xc2, 0x6f, 0xc0, 0x3f, 0xe7, 0xa5, 0x5e, 0xa2, 0xce, 0xa9, 0xcc, 0xc8, 0x2f, 0xf0, 0xea, 0x0a,
+    0xef, 0xa7, 0x3a, 0x88, 0xbd, 0xfd, 0x2e, 0x2c, 0x9c, 0x11, 0x06, 0xf1, 0xf3, 0x57, 0x51, 0x90,
+    0xbb, 0x8e, 0x02, 0x2a, 0x41, 0xfb, 0x1e, 0x2a, 0xbf, 0x95, 0x73, 0xe6, 0xc8, 0xdd, 0x3e, 0xde,
+    0xbd, 0x6e, 0xe6, 0xc7, 0xd2, 0xd5, 0xcd, 0x78, 0xd8, 0x4f, 0x56, 0x5a, 0xd9, 0x43, 0x15, 0xa7,
+    0xc0, 0x16, 0x71, 0xa9, 0xdb, 0xa4, 0xaf, 0x99, 0x06, 0xe1, 0xff, 0xc5, 0xa2, 0xa0, 0xc2, 0xe2,
+    0xa8, 0x2f, 0xee, 0xde, 0x80, 0xcd, 0x51, 0x18, 0x19, 0xfb, 0x1e, 0x6b, 0x1f, 0xc4, 0x02, 0x4b,
+    0xad, 0xce, 0x54, 0xeb, 0x58, 0x7b, 0x37, 0x58, 0x8a, 0x78, 0xff, 0x13, 0xbd, 0xff, 0x86, 0xfa,
+    0x71, 0x4d, 0x41, 0xed, 0x86, 0x78, 0x7e, 0x40, 0xac, 0x0f, 0xa2, 0x21, 0xcf, 0x54, 0x4f, 0x5e,
+    0xbc, 0xf7, 0x2d, 0xa7, 0x09, 0xaa, 0x32, 0x0e, 0xba, 0x1c, 0xd6, 0x6b, 0xfc, 0x7f, 0x1b, 0xfe,
+    0x06, 0xca, 0xfd, 0xca, 0x82, 0xdd, 0xd0, 0x0d, 0xec, 0xff, 0x03, 0xd6, 0x72, 0x4e, 0xa4, 0xba,
+    0x1a, 0x2a, 0xcc, 0x72, 0x00, 0x7e, 0x26, 0xd0, 0x59, 0x2b, 0xfa, 0x5c, 0xc7, 0x29, 0xf3, 0xf8,
+    0x28, 0x4c, 0x98, 0x25, 0x1d, 0x0b, 0xf2, 0x9d, 0xc0, 0x5b, 0x39, 0xfc, 0x3e, 0x09, 0x0b, 0x27,
+    0xe2, 0x66, 0x59, 0x40, 0xb9, 0x87, 0xa9, 0xe6, 0xdb, 0xd9, 0x17, 0x03, 0x95, 0x23, 0xde, 0xd2,
+    0x2a, 0xb3, 0xf4, 0xb1, 0xd6, 0x23, 0x4b, 0xfd, 0xac, 0x7f, 0x05, 0xcd, 0x25, 0xb1, 0x1c, 0xf3,
+    0x15, 0xdf, 0x82, 0xb7, 0x05, 0xf2, 0xe6, 0x3d, 0x22, 0x0d, 0xc1, 0x5e, 0x3b, 0x67, 0xbd, 0xd0,
+    0x62, 0x96, 0x65, 0xba, 0x73, 0x98, 0x53, 0xdb, 0xe1, 0xa5, 0x86, 0xf5, 0xa7, 0x39, 0xa7, 0xe0,
+    0x98, 0x59, 0x8a, 0xc8, 0xcc, 0x86, 0x7f, 0x49, 0xef, 0xd2, 0x27, 0xef, 0xa3, 0xba, 0xe2, 0x74,
+    0x8c, 0xb9, 0x53, 0x7e, 0x05, 0xa7, 0x2c, 0x1b, 0xe4, 0x81, 0x4a, 0xbc, 0xe5, 0xaf, 0xe4, 0x10,
+    0xe5, 0x64, 0x83, 0xda, 0x3e, 0x46, 0xa4, 0x68, 0x24, 0xc6, 0xde, 0x79, 0x72, 0x97, 0x26, 0x8f,
+    0x75, 0x21, 0xdf, 0x82, 0xfe, 0xea, 0xc1, 0x55, 0x8b, 0xd2, 0x07, 0xe1, 0x6e, 0x8a, 0x6f, 0xfb,
+    0x6b, 0xcd, 0x52, 0x85, 0x5e, 0xeb, 0xc9, 0x92, 0x87, 0x02, 0xb2, 0xa0, 0x0e, 0x99, 0x9a, 0x76,
+    0x9a, 0x25, 0x09, 0xea, 0x16, 0x3a, 0x52, 0xe3, 0x3a, 0x3a, 0x11, 0xff, 0xb7, 0x52, 0x4b, 0x79,
+    0x9f, 0x9d, 0x1a, 0x34, 0x52, 0x01, 0xe2, 0xd7, 0xc8, 0xf1, 0xd1, 0x87, 0x02, 0xde, 0x7a, 0x40,
+    0xf0, 0x4b, 0xf2, 0x19, 0xe2, 0x04, 0x8f, 0xac, 0xe5, 0xb1, 0x7d, 0x01, 0xec, 0xeb, 0xd3, 0xa6,
+    0x90, 0x42, 0x18, 0x8e, 0x7d, 0x17, 0x1c, 0x78, 0x0f, 0xa1, 0xcf, 0x3a, 0xfa, 0x60, 0x4d, 0xde,
+    0x94, 0x38, 0x6a, 0x53, 0x62, 0x83, 0xb4, 0x0d, 0xbf, 0x4f, 0xd2, 0x41, 0x76, 0xa0, 0xfa, 0x6a,
+    0xb8, 0xed, 0x73, 0xaf, 0xc3, 0xf4, 0x22, 0x33, 0xea, 0x2c, 0x3d, 0xbe, 0x19, 0x2d, 0x94, 0xc7,
+    0x03, 0x85, 0x84, 0x5d, 0x73, 0x09, 0x1d, 0xa7, 0x3b, 0x50, 0x44, 0x0d, 0xb3, 0xe4, 0x38, 0xef,
+    0xa1, 0xef, 0x98, 0xaa, 0xf6, 0x56, 0x49, 0x87, 0x4c, 0x63, 0x4b, 0xe4, 0x98, 0x98, 0x1b, 0xd9,
+    0x53, 0xcc, 0xca, 0x3f, 0xba, 0x45, 0xf4, 0x19, 0x1b, 0x64, 0x0f, 0xec, 0x75, 0xa3, 0xc4, 0x02,
+    0xbc, 0x97, 0x54, 0x59, 0x57, 0x6e, 0x64, 0x52, 0xd4, 0x1f, 0xa4, 0xf2, 0xa3, 0x41, 0xbf, 0x2c,
+    0x60, 0xd5, 0xba, 0x66, 0xd3, 0xda, 0xd6, 0xaf, 0xb2, 0xe7, 0x4d, 0xbf, 0xa7, 0x2a, 0x4f, 0xd5,
+    0x5f, 0xf8, 0x96, 0xf4, 0x76, 0xde, 0xf6, 0x54, 0x12, 0x61, 0x0b, 0x1d, 0xad, 0x74, 0xcc, 0xe7,
+    0x5e, 0x13, 0x64, 0x36, 0x47, 0xf7, 0x9a, 0x70, 0x59, 0x7a, 0xb0, 0x07, 0xc3, 0xb1, 0x77, 0xa5,
+    0x3d, 0xf0, 0x7f, 0x03, 0xd6, 0x2d, 0x1f, 0x18, 0xb6, 0x0f, 0xc1, 0x12, 0x87, 0xe1, 0xe9, 0xd5,
+    0x58, 0xf1, 0x14, 0xc3, 0xd3, 0x02, 0x0a, 0x8a, 0xb9, 0x99, 0xdd, 0xfc, 0x85, 0xa1, 0x22, 0xea,
+    0xb4, 0x1d, 0x05, 0x85, 0x0f, 0x07, 0xf9, 0x6e, 0x73, 0x51, 0x34, 0x31, 0x05, 0x43, 0x03, 0xdd,
+    0x41, 0xe7, 0xcd, 0x83, 0xfc, 0xf0, 0xac, 0xb4, 0xd1, 0x79, 0xf0, 0x7b, 0x33, 0xee, 0x1e, 0xe5,
+    0xf7, 0x00, 0x00, 0x02, 0xa2, 0x49, 0x44, 0x41, 0x54, 0x73, 0xdb, 0xcb, 0x49, 0x6b, 0xd1, 0x63,
+    0x94, 0x3d, 0x87, 0xde, 0x32, 0x4e, 0x3a, 0xc1, 0x31, 0x8c, 0xf5, 0xa5, 0x78, 0xc0, 0xd0, 0xa3,
+    0x70, 0x18, 0xa1, 0x22, 0x73, 0xc6, 0x1d, 0x5a, 0x79, 0x9c, 0xee, 0x31, 0xc5, 0xb9, 0xa3, 0xfc,
+    0x2e, 0x61, 0xda, 0x44, 0x36, 0x5a, 0x4e, 0x2b, 0xf0, 0x1c, 0xa2, 0x0e, 0x1b, 0xc0, 0x1c, 0xe5,
+    0xff, 0x42, 0x72, 0xfa, 0x80, 0xdf, 0x61, 0x9f, 0xc0, 0x57, 0xc5, 0xcf, 0x39, 0x9f, 0x98, 0x73,
+    0x4c, 0xca, 0x6a, 0x2a, 0xeb, 0xfd, 0x57, 0xcd, 0xb2, 0xea, 0x39, 0xbf, 0xdb, 0xeb, 0x65, 0x7e,
+    0x6f, 0x8a, 0x04, 0xba, 0x3b, 0xeb, 0xab, 0xaa, 0x93, 0x68, 0xfe, 0xfe, 0x25, 0xf8, 0x79, 0x4c,
+    0x3a, 0x05, 0xe3, 0x91, 0x94, 0x5f, 0x99, 0x58, 0x6a, 0x41, 0x75, 0x9a, 0x68, 0x2e, 0xa3, 0xb9,
+    0x13, 0x6b, 0x83, 0xda, 0x08, 0x7f, 0x62, 0x96, 0x10, 0x18, 0xa7, 0x98, 0x34, 0xe1, 0x54, 0x50,
+    0x13, 0x97, 0x98, 0x61, 0xde, 0x0a, 0xbf, 0x93, 0xe3, 0x69, 0x92, 0xe8, 0xdf, 0xa1, 0x7a, 0x43,
+    0x9c, 0x5e, 0x5c, 0x60, 0x0c, 0x98, 0x65, 0x16, 0xd4, 0xc9, 0x2f, 0x72, 0xaf, 0x09, 0x07, 0xf8,
+    0x0a, 0x50, 0x5f, 0x6d, 0xbd, 0x59, 0x52, 0x20, 0xb8, 0x07, 0xc5, 0xed, 0xe0, 0xeb, 0x64, 0x5f,
+    0x60, 0x75, 0x45, 0x66, 0x89, 0x7b, 0xc1, 0x2c, 0x9e, 0x42, 0x65, 0xce, 0xb3, 0x9e, 0xc7, 0xdb,
+    0x9f, 0x0b, 0x8d, 0xe4, 0x3a, 0x02, 0x9e, 0x38, 0xb7, 0xa3, 0x01, 0x62, 0xbb, 0xdf, 0x50, 0x35,
+    0x98, 0xa5, 0x97, 0xe8, 0x4e, 0xc2, 0x6b, 0x91, 0xdd, 0xaa, 0xa8, 0xde, 0xe2, 0x7f, 0xc0, 0xcb,
+    0x61, 0xdf, 0x1b, 0x9d, 0x25, 0xcc, 0xa4, 0x4c, 0xb1, 0xe2, 0x53, 0x90, 0x67, 0xa9, 0xd5, 0xac,
+    0x3f, 0xb7, 0xdd, 0xaa, 0x20, 0x77, 0xbb, 0x89, 0x76, 0x02, 0xa5, 0xed, 0xa3, 0x5f, 0x9d, 0xf3,
+    0x39, 0x98, 0xe6, 0x8c, 0x14, 0xf9, 0x75, 0x7b, 0xe0, 0x1a, 0x15, 0x44, 0x40, 0x51, 0xc6, 0x44,
+    0x9f, 0x46, 0xb9, 0x1d, 0xfc, 0x9e, 0xc7, 0xcf, 0xd3, 0xe8, 0x20, 0xd3, 0x03, 0x47, 0x07, 0x2d,
+    0x8b, 0xa3, 0x96, 0xff, 0x44, 0x80, 0xd7, 0xd9, 0x9d, 0x84, 0xca, 0x5a, 0xbe, 0x19, 0x4c, 0xce,
+    0x91, 0x9d, 0x71, 0x8b, 0x84, 0xdb, 0xc1, 0x29, 0xac, 0x19, 0xf6, 0x8e, 0x33, 0x0b, 0x93, 0x2e,
+    0xd1, 0x61, 0xda, 0xa2, 0x67, 0xaf, 0x0e, 0xe2, 0x2d, 0xea, 0x67, 0x5a, 0xc0, 0xd3, 0x4e, 0x37,
+    0x02, 0x7f, 0x43, 0x3f, 0xc5, 0xef, 0x47, 0x78, 0x62, 0x0a, 0x3f, 0xcb, 0x9e, 0xe5, 0x2a, 0xf3,
+    0xf6, 0x36, 0xbf, 0x96, 0xac, 0x8f, 0xe1, 0xed, 0xa8, 0x4d, 0x8b, 0x1f, 0x51, 0x95, 0x03, 0x36,
+    0x55, 0xbb, 0xf1, 0x92, 0x44, 0xbd, 0xd7, 0x1f, 0x65, 0x1f, 0x75, 0x5a, 0x67, 0x95, 0x32, 0x6c,
+    0x55, 0x72, 0x9d, 0xac, 0x6f, 0xc6, 0x72, 0x95, 0x3b, 0x5f, 0xc6, 0xe2, 0x26, 0x8a, 0x1d, 0xac,
+    0xd8, 0xe4, 0xc6, 0x50, 0x59, 0x06, 0x4f, 0x3d, 0xf6, 0x15, 0x4e, 0x43, 0xf4, 0xe7, 0x74, 0xc6,
+    0xbc, 0xd5, 0x80, 0x3a, 0x6f, 0x53, 0x70, 0x30, 0xa8, 0xe9, 0x45, 0xd6, 0x67, 0x9b, 0x6c, 0x7e,
+    0x4d, 0xc1, 0x52, 0x86, 0x09, 0xb1, 0x1d, 0x4d, 0x9f, 0x43, 0x2b, 0xb3, 0xc4, 0x94, 0x6d, 0x90,
+    0x9a, 0x5c, 0x86, 0xd9, 0x7f, 0x9d, 0x7e, 0x9f, 0x87, 0xff, 0x36, 0x98, 0x89, 0xf3, 0xcc, 0x9f,
+    0x32, 0xb5, 0xf6, 0x52, 0xc1, 0xed, 0x8b, 0xfc, 0x07, 0xda, 0x11, 0x22, 0xac, 0xa4, 0x26, 0x5e,
+    0xc3, 0x73, 0x87, 0xfb, 0x53, 0x28, 0x50, 0x68, 0x92, 0x7d, 0x71, 0xce, 0xe8, 0x62, 0xcf, 0x8c,
+    0xf5, 0x32, 0x97, 0x66, 0xdd, 0xfa, 0x67, 0x82, 0x5e, 0xbc, 0x87, 0xde, 0xbc, 0x96, 0xaa, 0xa8,
+    0x23, 0x8f, 0x4b, 0xce, 0xc3, 0xe7, 0x38, 0x27, 0x36, 0x32, 0x27, 0x4e, 0xff, 0x8a, 0xbd, 0x30,
+    0x73, 0xc6, 0x0b, 0x6e, 0x16, 0xdb, 0x40, 0x14, 0xa6, 0x26, 0xe3, 0x07, 0xb8, 0x3f, 0x72, 0x77,
+    0xfc, 0x3d, 0x3e, 0x2b, 0x4a, 0x2c, 0xa7, 0xa6, 0xf0, 0x18, 0x7a, 0xae, 0xe3, 0x4b, 0xbb, 0x4d,
+    0x28, 0xaa, 0xee, 0x91, 0x5e, 0xb3, 0xfc, 0xf7, 0xcf, 0x44, 0xf0, 0x6f, 0xd8, 0xa2, 0xb3, 0x0d,
+    0xe1, 0xb3, 0x24, 0xeb, 0xc7, 0x6c, 0x9c, 0xfc, 0x90, 0xdd, 0xdc, 0xa9, 0xaa, 0x51, 0xca, 0x00,
+    0x3c, 0x1d, 0x02, 0xed, 0x5e, 0x7f, 0x66, 0x8d, 0xa0, 0xeb, 0x8f, 0xe9, 0x29, 0x2f, 0xdb, 0xcd,
+    0xa9, 0xd9, 0xbf, 0x39, 0xe9, 0xbc, 0x5f, 0x0b, 0x85, 0xfc, 0xda, 0x4d, 0xf6, 0x1b, 0x6c, 0xde,
+    0x51, 0x95, 0x89, 0x52, 0xff, 0xee, 0xf1, 0xff, 0xfc, 0x6e, 0xc6, 0x32, 0x41, 0x27, 0x88, 0xa2,
+    0xd5, 0x24, 0xf7, 0xf0, 0xc8, 0x98, 0xaf, 0x51, 0xb4, 0x96, 0x6e, 0x0e, 0x26, 0x66, 0x7f, 0x22,
+    0xb8, 0xeb, 0x8e, 0x5c, 0xd2, 0xff, 0x00, 0xbb, 0x34, 0x8d, 0x8a, 0xf9, 0x76, 0x4c, 0x89, 0x00,
+    0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+// 160x96 2-bpp grayscale, split into small IDAT chunks
+static const uint8_t png_2bit[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xfc, 0x3e,
+    0xe4, 0x00, 0x00, 0x01, 0x4d, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0x1d, 0x57, 0x5d, 0x6c, 0x22,
+    0xe7, 0x7a, 0x7e, 0x98, 0x99, 0x5d, 0x4f, 0x12, 0xba, 0x3b, 0x7b, 0x72, 0xaa, 0x46, 0xd5, 0x4a,
+    0x9d, 0x64, 0x53, 0xc9, 0xaa, 0xd2, 0x6a, 0xb2, 0x59, 0xa9, 0xb9, 0x48, 0xdb, 0xd9, 0xcd, 0x9e,
+    0x36, 0x17, 0x7b, 0x71, 0x7a, 0x01, 0x16, 0xa6, 0x36, 0xbd, 0xc1, 0x08, 0x5c, 0xdb, 0xe9, 0x39,
+    0x05, 0x04, 0xc8, 0x66, 0x92, 0xcd, 0x45, 0xa4, 0xf6, 0x62, 0x6f, 0xc0, 0xc2, 0xc8, 0x10, 0xa9,
+    0xc2, 0x2e, 0x20, 0xf0, 0x9e, 0x0b, 0x40, 0x18, 0x61, 0x26, 0x3f, 0x3a, 0x8d, 0xce, 0xc9, 0x45,
+    0x2e, 0x0a, 0x16, 0x20, 0xf0, 0xaa, 0x2a, 0x20, 0xec, 0x03, 0xac, 0xd4, 0x03, 0x16, 0x50, 0xa0,
+    0xef, 0xec, 0xd5, 0xfc, 0x7d, 0xf3, 0x7e, 0xef, 0xcf, 0xf3, 0x3c, 0xef, 0xfb, 0x01, 0xf8, 0x1e,
+    0x1b, 0x87, 0x47, 0x35, 0x0e, 0x0a, 0x92, 0xb6, 0x98, 0xe5, 0x53, 0x01, 0x18, 0xe4, 0xc3, 0x7b,
+    0x0f, 0x05, 0xf1, 0x51, 0xdc, 0x3b, 0x8c, 0x2b, 0x2c, 0x98, 0x5a, 0xfd, 0x3c, 0x08, 0xb0, 0x2a,
+    0xea, 0xfb, 0x4e, 0xd7, 0x2d, 0x1d, 0xcb, 0xb7, 0xca, 0xdb, 0xbe, 0x5f, 0x82, 0x43, 0x27, 0xb3,
+    0x17, 0x66, 0x71, 0x53, 0xcd, 0x78, 0x43, 0x63, 0xa8, 0x78, 0xe8, 0xb8, 0x3e, 0x38, 0x03, 0x64,
+    0x70, 0xa3, 0x40, 0x27, 0xcf, 0xeb, 0x25, 0xec, 0xef, 0xd6, 0xec, 0x2a, 0x80, 0xd5, 0xa3, 0x89,
+    0x11, 0x3f, 0xe0, 0x3f, 0xc6, 0x99, 0xf5, 0x0d, 0x56, 0x84, 0x1a, 0x5d, 0x5b, 0x37, 0xd2, 0xeb,
+    0x0f, 0xff, 0x32, 0x59, 0x6d, 0x78, 0x21, 0x73, 0x62, 0xdb, 0x7c, 0x59, 0x02, 0x7b, 0x5f, 0xb5,
+    0x54, 0xd6, 0xec, 0x80, 0x22, 0xa6, 0x9d, 0x65, 0x2b, 0x44, 0x11, 0x1b, 0xb5, 0x49, 0x9b, 0x16,
+    0xbe, 0x8d, 0x45, 0x76, 0x1c, 0x82, 0x2a, 0xaa, 0x87, 0xb3, 0x9d, 0x63, 0xe9, 0xd1, 0x4f, 0xdf,
+    0x58, 0x9f, 0xe6, 0x4a, 0xbc, 0x02, 0x8c, 0x5d, 0x2b, 0x31, 0x70, 0x02, 0x37, 0x70, 0x5c, 0x92,
+    0x8f, 0x37, 0x20, 0xf6, 0xfc, 0x39, 0x3b, 0xc5, 0xc4, 0x07, 0xd3, 0x46, 0xf3, 0x33, 0xb2, 0xe0,
+    0x5a, 0x3d, 0x98, 0x93, 0x05, 0x21, 0xe4, 0xcc, 0xb6, 0x45, 0x08, 0x3f, 0x39, 0x71, 0x7b, 0x3d,
+    0x80, 0x1e, 0x62, 0x3f, 0xd7, 0xe8, 0xe8, 0x44, 0xa0, 0x7b, 0x6c, 0xd9, 0xa7, 0x2d, 0x31, 0xb9,
+    0xcc, 0xfb, 0xa1, 0x57, 0x79, 0xff, 0x3a, 0xd5, 0x65, 0x30, 0x00, 0x00, 0x01, 0x4d, 0x49, 0x44,
+    0x41, 0x54, 0x79, 0x23, 0xa4, 0x50, 0x16, 0x7a, 0x99, 0xbd, 0x0e, 0x74, 0xf4, 0x6b, 0xe6, 0xd4,
+    0xb1, 0xae, 0x03, 0x7f, 0x2f, 0x17, 0x0c, 0x04, 0x71, 0x5f, 0x62, 0xf2, 0x1e, 0x63, 0x08, 0xb8,
+    0x8b, 0xe0, 0x7c, 0xc7, 0xa1, 0xbc, 0x09, 0xd9, 0xe0, 0x2c, 0x79, 0x40, 0x3f, 0x60, 0x36, 0x4d,
+    0x95, 0xf1, 0x6b, 0x08, 0x3d, 0x87, 0xb5, 0xc5, 0xde, 0x05, 0xb2, 0x9e, 0xaa, 0x47, 0x62, 0xc0,
+    0x74, 0x63, 0x69, 0x1f, 0x79, 0x80, 0xe3, 0x69, 0x2f, 0x0e, 0x59, 0x2f, 0xa9, 0x83, 0x8e, 0xf1,
+    0x9c, 0x01, 0x54, 0x57, 0x28, 0x3d, 0x7f, 0x43, 0x79, 0x1d, 0xce, 0xbe, 0xed, 0xfc, 0x29, 0xcb,
+    0x21, 0xdd, 0xdd, 0xc8, 0x92, 0x2b, 0x92, 0xc9, 0x55, 0xdd, 0x01, 0x74, 0xec, 0xad, 0x58, 0x39,
+    0xb0, 0xfb, 0x1a, 0x20, 0x66, 0x4e, 0xb7, 0xae, 0x71, 0x47, 0xc0, 0xc1, 0xa9, 0xa5, 0xad, 0xf0,
+    0x4f, 0xb0, 0x65, 0x2c, 0xc4, 0x74, 0x94, 0xe8, 0xa3, 0x61, 0xd6, 0x4f, 0x86, 0x79, 0xb8, 0x4b,
+    0xd3, 0x94, 0x44, 0x3e, 0xf4, 0x8d, 0x9b, 0x79, 0xaa, 0x04, 0x76, 0x4b, 0xd3, 0x34, 0xe8, 0x7d,
+    0xc2, 0x3b, 0x59, 0x08, 0xaa, 0xfc, 0x46, 0xc7, 0xbb, 0x15, 0x21, 0x0f, 0xa1, 0x5b, 0x2f, 0xfb,
+    0xba, 0x74, 0xe5, 0x73, 0xbd, 0xa2, 0x53, 0x8b, 0xce, 0x16, 0xdf, 0x9b, 0x7d, 0x0a, 0x70, 0x13,
+    0x4b, 0x3a, 0xcd, 0x8a, 0x92, 0x34, 0x6b, 0xef, 0x50, 0x1e, 0x99, 0x67, 0xb7, 0x4d, 0xa6, 0x50,
+    0x42, 0x92, 0x24, 0xb6, 0x39, 0x77, 0xb7, 0x58, 0x95, 0xd7, 0x4f, 0x8d, 0xf1, 0x90, 0xb4, 0xc4,
+    0x63, 0xef, 0xb2, 0x1e, 0xfb, 0x17, 0x40, 0xf2, 0x1c, 0x0d, 0x1b, 0x78, 0x29, 0x33, 0xfc, 0xa0,
+    0xbe, 0x48, 0xa8, 0xb7, 0x97, 0xe4, 0xf0, 0xd8, 0x61, 0x93, 0xc0, 0xfe, 0x30, 0x98, 0x77, 0xad,
+    0x60, 0x1e, 0x22, 0x60, 0x29, 0x0e, 0x18, 0x72, 0x61, 0x6b, 0x9c, 0x89, 0x82, 0x93, 0x99, 0x37,
+    0x23, 0x95, 0xf1, 0x10, 0xf2, 0xdd, 0x37, 0x2b, 0xc5, 0x6e, 0xef, 0x33, 0xda, 0xdb, 0x78, 0x36,
+    0x2a, 0xbe, 0x2b, 0x70, 0x48, 0x59, 0x37, 0xb7, 0x25, 0x8a, 0xd6, 0xe4, 0x49, 0x8e, 0x70, 0xd1,
+    0x9d, 0xcf, 0x71, 0xfb, 0x0b, 0x9c, 0x59, 0xa7, 0xeb, 0x5a, 0x60, 0xa3, 0xc8, 0xc1, 0x82, 0xfc,
+    0x7d, 0x10, 0x98, 0xe5, 0x4b, 0xc0, 0x12, 0x5b, 0x5f, 0x89, 0x8f, 0x7e, 0xa1, 0x45, 0x32, 0xc5,
+    0x0d, 0x7d, 0x19, 0x00, 0x00, 0x01, 0x4d, 0x49, 0x44, 0x41, 0x54, 0xdf, 0xd9, 0xdc, 0xa2, 0x38,
+    0x1e, 0xb5, 0x63, 0xab, 0x6b, 0xac, 0x20, 0x23, 0x5a, 0xda, 0xcd, 0x2a, 0x3c, 0x84, 0xa0, 0xdd,
+    0x3b, 0xfc, 0x5c, 0xe6, 0x91, 0x1f, 0xac, 0x1d, 0xe9, 0x09, 0x31, 0x98, 0x9e, 0x57, 0x42, 0x4b,
+    0xff, 0xc6, 0x28, 0x45, 0x73, 0xa7, 0xa2, 0x7f, 0xfc, 0x00, 0xc1, 0x13, 0x9f, 0xff, 0x31, 0x45,
+    0x9e, 0x6b, 0xae, 0x38, 0x08, 0x07, 0x3a, 0x5b, 0xd0, 0xd2, 0x67, 0xf5, 0x64, 0x31, 0xd8, 0x36,
+    0x6c, 0x43, 0xe1, 0x70, 0xea, 0xd8, 0x2e, 0xbd, 0x43, 0xa6, 0xf3, 0xd7, 0x21, 0x42, 0xcc, 0x12,
+    0x0e, 0xbb, 0xb5, 0x20, 0x15, 0x81, 0xb5, 0x94, 0x0c, 0x3e, 0x86, 0x00, 0x83, 0x71, 0xb6, 0x39,
+    0xa5, 0x0b, 0x6b, 0x4b, 0xb8, 0x8b, 0xf8, 0x92, 0x45, 0xa2, 0x99, 0xda, 0xa4, 0xd4, 0x0a, 0x9e,
+    0xd8, 0x5e, 0x8e, 0x97, 0x80, 0x61, 0x21, 0xe4, 0xd0, 0x10, 0x85, 0x48, 0xa6, 0xe9, 0xd3, 0x11,
+    0xd4, 0x0a, 0xe6, 0x40, 0x01, 0x2c, 0xf8, 0x72, 0xea, 0x22, 0x41, 0x86, 0x95, 0x9a, 0xdd, 0x5c,
+    0x20, 0x40, 0x28, 0xb3, 0xa1, 0x27, 0xf5, 0x08, 0x3c, 0x8f, 0xf8, 0xe9, 0x8a, 0x8b, 0x40, 0xb9,
+    0xbc, 0xd3, 0xe8, 0x1e, 0x71, 0xe0, 0xc5, 0x93, 0xf5, 0xc3, 0x01, 0x5e, 0x00, 0x86, 0x9d, 0x40,
+    0x8e, 0x79, 0x9b, 0x0c, 0xcd, 0x3d, 0x14, 0x2c, 0x15, 0xdc, 0x14, 0xed, 0x04, 0x14, 0x30, 0x7a,
+    0xc3, 0x68, 0x2f, 0xa6, 0x7b, 0x0c, 0x5d, 0xd3, 0x68, 0x98, 0x8b, 0x32, 0x30, 0xc9, 0x54, 0x0e,
+    0xb4, 0xac, 0x9c, 0x87, 0x87, 0x63, 0x59, 0xb3, 0xb8, 0x93, 0xcc, 0xaf, 0x80, 0x9c, 0x35, 0xda,
+    0x2e, 0x5a, 0xaa, 0xfe, 0x33, 0x5d, 0xbe, 0x5f, 0x29, 0x2d, 0xff, 0xa9, 0x7a, 0x7b, 0xbd, 0x95,
+    0xb3, 0xc9, 0xf4, 0x61, 0x2f, 0x74, 0x11, 0x07, 0xc7, 0x2d, 0xa1, 0x9f, 0x2d, 0x56, 0xa8, 0xfe,
+    0x30, 0xf6, 0x2d, 0x0b, 0x88, 0x1f, 0x21, 0x65, 0xbf, 0x2a, 0xe0, 0x23, 0xe0, 0xd8, 0xe9, 0xb7,
+    0x6b, 0x00, 0x49, 0xf5, 0x9b, 0x31, 0xa8, 0x6f, 0xde, 0xc6, 0xd1, 0x69, 0x50, 0x43, 0x0e, 0xd3,
+    0xf5, 0x15, 0x57, 0x14, 0x89, 0x55, 0xdd, 0xa5, 0xa6, 0x19, 0xef, 0xde, 0x43, 0x32, 0x14, 0x4e,
+    0x28, 0x60, 0x95, 0xd9, 0x8a, 0x3b, 0x0a, 0x89, 0x32, 0xda, 0xa9, 0xe6, 0x66, 0xb4, 0xb3, 0x62,
+    0x5a, 0x0d, 0x34, 0x29, 0xbf, 0xf0, 0x26, 0x66, 0x98, 0xb0, 0x9e, 0x72, 0x00, 0x00, 0x01, 0x4d,
+    0x49, 0x44, 0x41, 0x54, 0xa7, 0x77, 0x39, 0x4e, 0x4c, 0x3a, 0x56, 0xf2, 0x9a, 0xaf, 0x2b, 0xce,
+    0xa8, 0xe9, 0x33, 0xfe, 0x1e, 0x39, 0x7d, 0x1a, 0xef, 0x91, 0xbc, 0x20, 0x54, 0x9f, 0x7a, 0xff,
+    0x9d, 0x7e, 0x2d, 0xb5, 0x7a, 0x6d, 0x15, 0xb2, 0x34, 0xf5, 0x59, 0x2a, 0x82, 0xf4, 0xfc, 0x5b,
+    0x77, 0x65, 0x18, 0x7f, 0x0f, 0x77, 0x80, 0xf2, 0x76, 0xb4, 0xf0, 0xe4, 0x5b, 0xf5, 0xf5, 0xed,
+    0x59, 0x76, 0x87, 0xa5, 0xbc, 0x36, 0x4a, 0xd1, 0x2d, 0xe6, 0x07, 0xe8, 0x8d, 0xde, 0x8d, 0xac,
+    0x48, 0x89, 0x9d, 0x0f, 0x0e, 0x33, 0x90, 0x3f, 0x06, 0x4a, 0x97, 0x17, 0x29, 0x1e, 0x2f, 0xa5,
+    0xd2, 0xc8, 0x45, 0x44, 0xfa, 0x0c, 0xfe, 0x41, 0x6b, 0x4c, 0xdf, 0x95, 0xd5, 0xae, 0xb3, 0xcd,
+    0x12, 0x51, 0xba, 0x5d, 0x8b, 0x9d, 0x93, 0xc8, 0xa4, 0xa5, 0x32, 0x19, 0xb1, 0x14, 0xcd, 0xf0,
+    0x70, 0x71, 0x45, 0xe9, 0xc4, 0x95, 0xb9, 0xe2, 0xa4, 0xc7, 0xdb, 0xc6, 0x9a, 0xaf, 0x82, 0xe7,
+    0x3a, 0xe9, 0x72, 0xed, 0x34, 0x46, 0x74, 0x52, 0xf1, 0x14, 0xf8, 0xc6, 0x13, 0x0d, 0x78, 0xe8,
+    0x96, 0xc9, 0xdb, 0xac, 0x0e, 0xfc, 0x85, 0x82, 0xc4, 0x61, 0x76, 0x9b, 0xc5, 0x1f, 0x22, 0xd7,
+    0x35, 0x6d, 0x82, 0xbf, 0x29, 0xce, 0xe2, 0x3b, 0x97, 0x5a, 0xf2, 0xf9, 0xfd, 0x8e, 0x25, 0x4d,
+    0x29, 0xe3, 0x9a, 0x45, 0xaf, 0x49, 0x5e, 0x86, 0x3e, 0x73, 0x62, 0x0f, 0x43, 0xd1, 0x23, 0x1b,
+    0x49, 0xd7, 0x94, 0x0f, 0xf4, 0x38, 0xab, 0x07, 0x4e, 0xa8, 0x88, 0xa4, 0x0c, 0x0b, 0x6b, 0xfd,
+    0xa1, 0x0e, 0x1f, 0xd5, 0x3b, 0xdb, 0x36, 0x2c, 0x7d, 0xff, 0x63, 0x3f, 0xb3, 0x7b, 0x40, 0x7e,
+    0xea, 0x17, 0x8b, 0xcd, 0x6d, 0x15, 0xaa, 0x34, 0x9a, 0xef, 0x34, 0x35, 0x8b, 0x5c, 0xaf, 0x31,
+    0xf5, 0x40, 0x54, 0x99, 0xb5, 0xe6, 0xe1, 0x88, 0x10, 0x25, 0x38, 0x93, 0xfe, 0xaa, 0xc2, 0xcb,
+    0x58, 0xcd, 0xcf, 0xcd, 0xf8, 0x1a, 0xca, 0x78, 0x68, 0x6b, 0xbf, 0x82, 0xda, 0xe5, 0x5e, 0x63,
+    0x88, 0xbf, 0x87, 0x3c, 0xf3, 0x67, 0x4d, 0x58, 0x06, 0x7c, 0x8e, 0x50, 0x4e, 0x51, 0x71, 0x67,
+    0x67, 0x91, 0x0a, 0xe1, 0xa9, 0xc0, 0x1e, 0x8f, 0x66, 0x9b, 0xda, 0x3a, 0x58, 0x03, 0xae, 0x10,
+    0xd5, 0x5f, 0x0a, 0x45, 0xca, 0xc7, 0x1c, 0xdd, 0x5c, 0x57, 0xc2, 0xb5, 0x65, 0x4e, 0xc6, 0x56,
+    0xdb, 0x36, 0x61, 0x3d, 0x4c, 0x00, 0x00, 0x01, 0x4d, 0x49, 0x44, 0x41, 0x54, 0x44, 0x19, 0xf8,
+    0x0d, 0x2e, 0xfc, 0xe7, 0x2d, 0x2a, 0xe2, 0xc7, 0x52, 0xca, 0x76, 0x31, 0x7f, 0x45, 0xb4, 0x5d,
+    0xaf, 0xf1, 0x3b, 0x4e, 0xfd, 0x2a, 0x95, 0xcb, 0xb4, 0x21, 0x0a, 0x6c, 0x33, 0x6d, 0x21, 0x15,
+    0x83, 0x3e, 0x76, 0x16, 0xf6, 0x40, 0xa7, 0xe7, 0x71, 0x12, 0x72, 0x1f, 0xbc, 0xf5, 0x8e, 0x04,
+    0x4f, 0xf8, 0x6a, 0x41, 0xd0, 0xd3, 0x1b, 0xd6, 0x09, 0x5a, 0xd0, 0xbf, 0xb5, 0xb1, 0x79, 0xe0,
+    0xb8, 0xa9, 0xfb, 0x10, 0xbe, 0xd4, 0xe9, 0x2e, 0x3d, 0x2f, 0x61, 0xe7, 0xfa, 0xda, 0xbd, 0xf4,
+    0xc7, 0x90, 0x5a, 0x89, 0x64, 0x07, 0xdc, 0x32, 0x72, 0xe7, 0x95, 0xe1, 0xb7, 0xac, 0xf8, 0xcd,
+    0xea, 0xc4, 0x60, 0xc2, 0xff, 0x41, 0xbc, 0x6e, 0xc4, 0x34, 0x10, 0xf3, 0xec, 0xc1, 0xca, 0xb4,
+    0x70, 0xf7, 0x77, 0xf8, 0x34, 0x51, 0xdd, 0x5e, 0x7b, 0x1f, 0x5f, 0x61, 0xad, 0xb9, 0x11, 0x26,
+    0x15, 0x44, 0xc5, 0xe0, 0xa9, 0x02, 0x3f, 0x62, 0xdf, 0x9a, 0x3c, 0xd6, 0x5c, 0x53, 0x67, 0x89,
+    0xad, 0xd6, 0x97, 0x0c, 0x23, 0x06, 0xc2, 0xee, 0x3d, 0x46, 0xb8, 0xc5, 0xec, 0xf4, 0x7c, 0x53,
+    0x41, 0xe5, 0x60, 0x38, 0xc8, 0xe6, 0x1e, 0x93, 0x48, 0xf5, 0x02, 0x53, 0x1b, 0xad, 0x7b, 0x4b,
+    0xef, 0x77, 0xa6, 0x7a, 0x78, 0xf0, 0x52, 0x30, 0x0e, 0x76, 0x89, 0x48, 0x32, 0x57, 0xde, 0xab,
+    0x64, 0x80, 0x9f, 0x31, 0x9b, 0xb3, 0xe4, 0xab, 0xd2, 0xed, 0xdb, 0x9b, 0x57, 0x58, 0xfa, 0xf0,
+    0xe7, 0xaa, 0x27, 0xba, 0x39, 0xc5, 0x4b, 0xa0, 0x7a, 0x9d, 0x23, 0x8e, 0x7f, 0x21, 0x1b, 0xb6,
+    0x87, 0x13, 0x82, 0x28, 0xb2, 0x1b, 0x89, 0x34, 0xff, 0xb1, 0x28, 0x9e, 0xa4, 0x4c, 0xab, 0x24,
+    0x4b, 0x58, 0xb2, 0xe7, 0xf7, 0xac, 0x92, 0xc8, 0x2b, 0x8b, 0x94, 0xfd, 0x1a, 0x2f, 0x24, 0xec,
+    0xb8, 0xec, 0x35, 0xe9, 0x9f, 0x9f, 0xc9, 0x9d, 0x8b, 0xe2, 0xec, 0x26, 0x14, 0xc5, 0x15, 0x8d,
+    0x0c, 0x80, 0xff, 0x51, 0x91, 0x1a, 0x1c, 0x1e, 0x0a, 0x24, 0x65, 0x95, 0x52, 0xa0, 0x2d, 0xe8,
+    0x54, 0x71, 0xe1, 0xf4, 0xc6, 0x3f, 0xd2, 0xc9, 0x08, 0x9d, 0xd4, 0xd7, 0x3e, 0x7e, 0x04, 0x38,
+    0xce, 0x6c, 0x46, 0x08, 0xaa, 0xa8, 0x4c, 0x5d, 0xd5, 0xe9, 0x67, 0xd4, 0x1d, 0xc7, 0x0d, 0x53,
+    0x5f, 0xd3, 0xee, 0x4c, 0xb2, 0x1c, 0x67, 0x09, 0x4e, 0xab, 0x0e, 0x56, 0x94, 0x75, 0x00, 0x00,
+    0x01, 0x4d, 0x49, 0x44, 0x41, 0x54, 0xdd, 0x74, 0xef, 0x19, 0x87, 0x87, 0x97, 0x9d, 0x8b, 0x19,
+    0xd6, 0xea, 0x27, 0xb9, 0x97, 0x22, 0xf4, 0x57, 0x6b, 0xd6, 0x94, 0x0e, 0x3f, 0xca, 0x17, 0xc6,
+    0xbd, 0xde, 0x6b, 0x2a, 0xbe, 0x4b, 0xd5, 0x3b, 0x96, 0xfb, 0x04, 0x98, 0xd5, 0x35, 0x77, 0x97,
+    0x27, 0xb9, 0x45, 0xcc, 0xd2, 0xdc, 0x20, 0xf0, 0xa2, 0x39, 0x0e, 0x6d, 0x7d, 0x01, 0x3c, 0x49,
+    0xba, 0x32, 0x2d, 0x9d, 0xf0, 0x03, 0x92, 0xde, 0x8e, 0x53, 0x43, 0x4c, 0x2f, 0x31, 0x6f, 0x8a,
+    0xf8, 0x33, 0x62, 0x61, 0xdd, 0xb6, 0x0f, 0xf6, 0x6d, 0xcc, 0x46, 0x87, 0xf5, 0x5b, 0xb4, 0x5d,
+    0x6f, 0xe1, 0x23, 0x21, 0xf8, 0x5b, 0xdd, 0x71, 0x79, 0x7f, 0x44, 0xe4, 0x62, 0xab, 0x6b, 0x4e,
+    0x0b, 0xb4, 0xec, 0x6f, 0x16, 0x16, 0xd6, 0xfb, 0xc4, 0xe7, 0xf1, 0xe1, 0x76, 0x84, 0x54, 0x0e,
+    0xbb, 0x27, 0xee, 0xac, 0x40, 0x5d, 0xdd, 0x7c, 0xe1, 0xc9, 0x51, 0xae, 0x71, 0x9d, 0x6d, 0x5b,
+    0x38, 0x12, 0x08, 0xb4, 0xae, 0xaf, 0x62, 0x37, 0x34, 0x31, 0x9a, 0x85, 0xc2, 0x0c, 0xf1, 0xf5,
+    0x22, 0x59, 0x1c, 0xa8, 0x78, 0x0f, 0x8b, 0x56, 0xd2, 0xac, 0xd2, 0x0e, 0xe5, 0x4e, 0xe8, 0x44,
+    0x4b, 0x3a, 0x56, 0xdc, 0xde, 0x2e, 0x61, 0xf2, 0xd6, 0x75, 0x6d, 0x3b, 0x4a, 0x57, 0xa5, 0x1a,
+    0xf3, 0x9b, 0x38, 0x86, 0x51, 0xac, 0xce, 0xf3, 0x08, 0x5e, 0x88, 0x6a, 0xa4, 0x92, 0x6c, 0x41,
+    0xfd, 0x86, 0xba, 0xd4, 0x9a, 0xdb, 0xcd, 0xd1, 0x9f, 0xe3, 0xde, 0x55, 0x95, 0xc0, 0xc9, 0xae,
+    0x6f, 0xd9, 0x76, 0x89, 0x9e, 0xc2, 0x30, 0x6b, 0x3a, 0xd6, 0xeb, 0x65, 0xde, 0xb6, 0xee, 0xf3,
+    0xff, 0x40, 0x04, 0x42, 0x27, 0x54, 0xe8, 0xd2, 0x07, 0xc6, 0x38, 0x28, 0xa7, 0xb5, 0xae, 0xbf,
+    0x51, 0xb1, 0xaf, 0x90, 0x6f, 0xba, 0xc4, 0x69, 0xfb, 0x48, 0xff, 0x26, 0x9e, 0x5b, 0x83, 0xf5,
+    0xb6, 0xf0, 0x14, 0xcf, 0x71, 0x9c, 0x74, 0xc7, 0xc8, 0xd2, 0xcf, 0xdb, 0x57, 0x4d, 0xb7, 0xe6,
+    0x8a, 0xc7, 0xb3, 0xbb, 0xae, 0x51, 0x73, 0xdf, 0x3b, 0x19, 0x91, 0x8f, 0xfa, 0xd2, 0xa8, 0x9a,
+    0x21, 0x22, 0x02, 0xfe, 0xe3, 0x45, 0xf4, 0x43, 0x5a, 0x50, 0x34, 0x7b, 0xb2, 0xb8, 0x09, 0x1c,
+    0x05, 0xad, 0x67, 0x7a, 0x8a, 0xf6, 0x30, 0xe8, 0x4e, 0x52, 0xbe, 0x85, 0xe9, 0xbc, 0x1b, 0x67,
+    0xb5, 0xf0, 0x47, 0x9b, 0x99, 0x6e, 0xd0, 0x00, 0x00, 0x01, 0x4d, 0x49, 0x44, 0x41, 0x54, 0x0d,
+    0xfb, 0xf5, 0x0d, 0x51, 0x66, 0xbb, 0x5b, 0x89, 0x28, 0xf3, 0x47, 0x60, 0x0e, 0x6c, 0xd5, 0x29,
+    0x7d, 0x50, 0xd7, 0x0f, 0x26, 0x6d, 0xd2, 0xd3, 0xd7, 0xf7, 0xa3, 0x83, 0x30, 0x04, 0x56, 0xc0,
+    0xe8, 0xc2, 0xe2, 0x20, 0x2d, 0x7a, 0x6e, 0x2f, 0xb6, 0xc7, 0xd4, 0x35, 0xe0, 0x09, 0x35, 0x77,
+    0xa8, 0x65, 0xb3, 0xbe, 0x6a, 0x27, 0x2c, 0x0a, 0xd0, 0xb9, 0x9a, 0x89, 0xbe, 0x96, 0x5f, 0x54,
+    0x92, 0x39, 0xca, 0xd3, 0x92, 0x34, 0x49, 0x9d, 0xcd, 0xb4, 0xe7, 0xb6, 0x37, 0x6e, 0x63, 0x05,
+    0x1e, 0xa7, 0x47, 0xb1, 0xc0, 0x73, 0x19, 0x5f, 0x3b, 0xa6, 0xad, 0x33, 0x41, 0x03, 0x67, 0x7d,
+    0x14, 0x0e, 0xff, 0x82, 0xa8, 0x77, 0x6d, 0xda, 0x35, 0x2d, 0x93, 0x52, 0xa5, 0xc6, 0x47, 0x1d,
+    0x8a, 0x45, 0x0c, 0x85, 0xbc, 0x53, 0x88, 0x9c, 0xe0, 0xb2, 0xf8, 0x0a, 0x04, 0x2c, 0x19, 0xfe,
+    0xbd, 0x52, 0x93, 0x2a, 0xc6, 0xd8, 0x6c, 0x67, 0x0d, 0xbc, 0x0f, 0xf6, 0x6a, 0x2b, 0x71, 0xa1,
+    0x59, 0xee, 0x5d, 0xce, 0x77, 0xc5, 0x07, 0xf8, 0xa6, 0xdc, 0xb6, 0x98, 0xf4, 0xb8, 0x2b, 0xa2,
+    0x1b, 0x29, 0xcc, 0x69, 0xe6, 0xf9, 0xe2, 0xb0, 0x62, 0xe8, 0xd0, 0x7f, 0x62, 0xa1, 0x65, 0xee,
+    0x51, 0x8f, 0x94, 0x9d, 0x86, 0x66, 0x19, 0x8c, 0x20, 0x0f, 0x57, 0x1d, 0xb9, 0x57, 0x25, 0xa4,
+    0x82, 0x8b, 0x8b, 0xc9, 0xdc, 0x70, 0x87, 0x00, 0xeb, 0x39, 0xf7, 0x9b, 0x35, 0xc7, 0x47, 0x79,
+    0x73, 0xf9, 0x75, 0xc8, 0xf2, 0xc8, 0x93, 0x3c, 0xe7, 0x1f, 0xe3, 0x73, 0xeb, 0x5a, 0x27, 0x49,
+    0x88, 0x93, 0x51, 0xf7, 0x96, 0xec, 0x82, 0x08, 0xb1, 0xe1, 0x39, 0x9b, 0x80, 0xf6, 0xdf, 0xaf,
+    0x35, 0x6d, 0xff, 0x4a, 0x8e, 0x3a, 0x1d, 0x95, 0x1a, 0x0b, 0x59, 0x98, 0x76, 0x8e, 0xfd, 0xaf,
+    0xac, 0x86, 0x36, 0x6c, 0x61, 0x99, 0x63, 0xf4, 0x81, 0xf2, 0x70, 0xfc, 0xf8, 0x2b, 0x3c, 0xea,
+    0xed, 0xc7, 0x0c, 0x5a, 0x39, 0x6b, 0x8b, 0xb4, 0x17, 0xcf, 0xf0, 0xf4, 0x7a, 0xb8, 0x45, 0xbc,
+    0xfe, 0x29, 0x61, 0xae, 0xbb, 0x51, 0x7d, 0x40, 0x5b, 0x1b, 0x7d, 0xe3, 0x03, 0x4e, 0xab, 0x52,
+    0x78, 0x65, 0xf2, 0x1d, 0x0d, 0x98, 0x83, 0xa8, 0xff, 0x55, 0x59, 0xc7, 0x7b, 0x89, 0x30, 0x55,
+    0x4d, 0xaf, 0x2f, 0xf9, 0xf6, 0x02, 0xef, 0x01, 0xf7, 0x1d, 0xe7, 0x05, 0x16, 0x5e, 0x57, 0x04,
+    0x00, 0x00, 0x01, 0x4d, 0x49, 0x44, 0x41, 0x54, 0x17, 0x2d, 0xfc, 0x64, 0x36, 0xaf, 0x87, 0x34,
+    0x8b, 0x6b, 0x91, 0x68, 0x5d, 0x73, 0xed, 0x7a, 0x5a, 0xac, 0x69, 0xcf, 0x70, 0xb5, 0xca, 0x7b,
+    0xdc, 0x3d, 0x01, 0x75, 0xeb, 0xe5, 0x26, 0x43, 0x2b, 0xa3, 0x97, 0xd1, 0x9c, 0xa0, 0x53, 0x78,
+    0xe3, 0xca, 0xc0, 0x26, 0xbf, 0x0d, 0x71, 0x2b, 0x32, 0x28, 0xbd, 0x12, 0xd2, 0xda, 0x6e, 0x36,
+    0x46, 0x0b, 0xee, 0xa6, 0xec, 0xc3, 0x16, 0x29, 0x0c, 0xf2, 0xc9, 0x60, 0x52, 0x7c, 0x21, 0xdc,
+    0x0a, 0x46, 0x73, 0xaf, 0x5a, 0xf1, 0x7e, 0x29, 0x70, 0x84, 0x9b, 0x34, 0x99, 0x64, 0xc2, 0x8e,
+    0x2b, 0x49, 0xd1, 0x0b, 0x8e, 0xa1, 0xa3, 0x81, 0x4f, 0x54, 0xf4, 0x1c, 0x11, 0x6a, 0x1f, 0xbf,
+    0xf9, 0x95, 0xb5, 0x35, 0x9a, 0xd1, 0x06, 0xd2, 0xe5, 0x30, 0x9d, 0xc2, 0xc7, 0x1f, 0xb0, 0xf7,
+    0x76, 0xfd, 0x87, 0xeb, 0x9a, 0x0f, 0xbe, 0xfe, 0x46, 0x90, 0x65, 0xc5, 0x67, 0xd1, 0x48, 0x75,
+    0xa2, 0x31, 0xef, 0xbc, 0x97, 0xd7, 0xba, 0x83, 0xd8, 0xb3, 0xf6, 0xed, 0xc4, 0x43, 0x86, 0xaf,
+    0x16, 0x5c, 0xeb, 0x82, 0x2a, 0x3c, 0x29, 0xc6, 0x8f, 0x9c, 0xdf, 0xca, 0x2a, 0x0e, 0x22, 0xd7,
+    0x55, 0x62, 0x87, 0x5c, 0x73, 0xaf, 0xec, 0xb2, 0x92, 0xfa, 0xdb, 0xac, 0x75, 0x5d, 0x0b, 0xee,
+    0x8e, 0xec, 0x5c, 0x38, 0xdc, 0xf8, 0x40, 0xc5, 0xca, 0xec, 0xbc, 0x08, 0xfc, 0xa7, 0x9c, 0x0a,
+    0xd4, 0xa8, 0x35, 0x8b, 0x9c, 0xd7, 0xbe, 0xde, 0x93, 0xff, 0x17, 0xf7, 0xf2, 0xfd, 0xf5, 0x06,
+    0x7e, 0x49, 0x5b, 0x06, 0xb7, 0x26, 0xe9, 0xf7, 0xf0, 0x01, 0x7c, 0xc5, 0x46, 0x96, 0x83, 0x20,
+    0x77, 0x0f, 0xf6, 0xf7, 0xc0, 0xca, 0x74, 0x14, 0x48, 0xb4, 0xfe, 0x0a, 0x5f, 0xeb, 0x06, 0xcd,
+    0xd5, 0x19, 0x78, 0x49, 0xf8, 0xbb, 0x7e, 0xf3, 0x90, 0x9c, 0x16, 0x70, 0xbe, 0x38, 0x32, 0x32,
+    0x1c, 0xf7, 0xce, 0xe6, 0x76, 0xdd, 0xbf, 0x0c, 0x99, 0x2f, 0x54, 0x56, 0xab, 0x3f, 0xd3, 0x43,
+    0x76, 0x17, 0x56, 0x8f, 0xf0, 0x16, 0xde, 0xc5, 0x28, 0x70, 0xbe, 0x21, 0x2b, 0xc2, 0xd3, 0xa0,
+    0x2f, 0xda, 0xe2, 0x49, 0x47, 0xd2, 0xfe, 0xbe, 0x56, 0x42, 0x5d, 0xd0, 0x7b, 0x75, 0xaa, 0xf0,
+    0x1c, 0xcc, 0xfd, 0xc1, 0x1c, 0xef, 0x10, 0xee, 0xa3, 0xbe, 0xd1, 0x81, 0xa4, 0x03, 0x37, 0x9d,
+    0x96, 0x17, 0x9f, 0xca, 0x9c, 0xfc, 0xd7, 0x4c, 0x9e, 0x00, 0x00, 0x01, 0x4d, 0x49, 0x44, 0x41,
+    0x54, 0x54, 0xb0, 0x74, 0xaf, 0x14, 0xfc, 0x39, 0x5a, 0xae, 0xe6, 0xb5, 0xfa, 0xa5, 0x48, 0xd2,
+    0x5c, 0xa6, 0x23, 0x81, 0x2c, 0xeb, 0x26, 0xc3, 0x83, 0x35, 0xb2, 0xf0, 0xfb, 0xe0, 0xbc, 0x72,
+    0x29, 0x29, 0x3a, 0xf6, 0x2c, 0x14, 0x2d, 0x10, 0xd8, 0x95, 0x90, 0x65, 0x93, 0xc4, 0x41, 0x0f,
+    0x43, 0xbc, 0x96, 0xc6, 0x66, 0xc6, 0xb3, 0x23, 0x50, 0xd7, 0xbe, 0x68, 0x9e, 0x11, 0x92, 0x21,
+    0x65, 0xfa, 0x83, 0x98, 0xa2, 0x3e, 0x85, 0xdb, 0xe0, 0x6e, 0x69, 0x00, 0x09, 0xef, 0xd8, 0xaa,
+    0x50, 0x05, 0x09, 0x8b, 0xd2, 0x71, 0x53, 0x7a, 0xa1, 0x7f, 0x3b, 0x19, 0x0e, 0x3a, 0xa9, 0x48,
+    0x6a, 0xaf, 0x9a, 0x2a, 0x7f, 0x2d, 0x0b, 0xca, 0x86, 0x23, 0xdc, 0x10, 0xc1, 0xe9, 0x8c, 0xfe,
+    0xcc, 0xf5, 0x6f, 0xe9, 0x20, 0x01, 0x9f, 0xcf, 0x66, 0x80, 0x4a, 0xdc, 0x69, 0xd6, 0x03, 0xd4,
+    0x8b, 0x7e, 0x52, 0xd8, 0xda, 0x99, 0x0b, 0xe4, 0xb7, 0xcd, 0xb9, 0x96, 0xd7, 0xf1, 0x58, 0xde,
+    0x59, 0xe9, 0xfb, 0x49, 0x71, 0x05, 0xec, 0x5e, 0xaf, 0x6d, 0xa8, 0x4f, 0x6e, 0xa0, 0x7f, 0x3a,
+    0x3b, 0xa2, 0x6a, 0x48, 0x57, 0x61, 0x6b, 0xff, 0xbe, 0x24, 0x29, 0x86, 0x52, 0x60, 0x8f, 0xe8,
+    0x7d, 0xa3, 0x79, 0x62, 0x3f, 0xa6, 0x79, 0x88, 0x45, 0x78, 0x9c, 0xb6, 0xfe, 0x8e, 0xe4, 0x2e,
+    0xb8, 0xee, 0x28, 0xaa, 0xba, 0xef, 0x85, 0x4a, 0xf1, 0xd2, 0xfb, 0x1a, 0xf1, 0x38, 0xba, 0x38,
+    0xdf, 0x7b, 0x07, 0xac, 0xd4, 0x1d, 0x5b, 0xda, 0xf2, 0x32, 0x9d, 0x1c, 0xea, 0x36, 0x8f, 0x36,
+    0xb5, 0x2f, 0x95, 0xa3, 0x67, 0x47, 0x82, 0xfe, 0xbf, 0x30, 0x30, 0x47, 0x8e, 0x48, 0x51, 0xc4,
+    0x55, 0x57, 0x7b, 0xf6, 0xd7, 0x1f, 0xe1, 0xcb, 0xc0, 0xf9, 0xe5, 0x02, 0x7a, 0x02, 0x63, 0x7a,
+    0xb5, 0x53, 0xd2, 0xcb, 0xf2, 0xdf, 0x6c, 0x59, 0x2e, 0xb5, 0x39, 0x91, 0x09, 0x27, 0x73, 0x83,
+    0xf7, 0xe9, 0xc6, 0xb1, 0x59, 0x1f, 0x81, 0xfb, 0x87, 0xa5, 0x4a, 0xce, 0x6e, 0xf8, 0x6f, 0xd0,
+    0xd9, 0xe4, 0x2a, 0x63, 0xae, 0xd1, 0x54, 0x8c, 0xda, 0x49, 0x34, 0xa5, 0xa1, 0xbd, 0x31, 0x71,
+    0x96, 0xc9, 0xa2, 0xe2, 0x35, 0x9f, 0x9b, 0x55, 0xee, 0xa5, 0x30, 0xb3, 0x2f, 0x0e, 0xb5, 0xa3,
+    0x0c, 0xdc, 0x67, 0xd5, 0xe2, 0xe7, 0xb4, 0xa2, 0x69, 0x28, 0x9c, 0x6b, 0x67, 0xbf, 0x8d, 0x8b,
+    0x00, 0xa6, 0x00, 0x00, 0x01, 0x06, 0x49, 0x44, 0x41, 0x54, 0x71, 0x3a, 0x97, 0xa3, 0x33, 0x0f,
+    0x9a, 0x2b, 0xa1, 0xa2, 0x36, 0x1e, 0x96, 0x37, 0xb3, 0x53, 0xa2, 0x15, 0x70, 0x6a, 0x0d, 0x52,
+    0x27, 0x7d, 0x88, 0x62, 0x3c, 0x15, 0xc3, 0x1f, 0x88, 0x30, 0xc5, 0x7b, 0x19, 0x7c, 0x75, 0x07,
+    0x91, 0xfd, 0x23, 0x3a, 0xf4, 0xd0, 0x70, 0x3c, 0x08, 0x0f, 0x98, 0x7f, 0xd4, 0xa8, 0x18, 0x8f,
+    0xd3, 0x24, 0xff, 0x4f, 0xba, 0x46, 0xcc, 0x3d, 0xfb, 0x3d, 0xcf, 0x70, 0x67, 0x47, 0x89, 0x36,
+    0x05, 0xcd, 0x45, 0xdc, 0x9b, 0x0e, 0x1d, 0xcf, 0x0a, 0x9d, 0xf6, 0xae, 0x83, 0xba, 0x0b, 0x71,
+    0xd9, 0x56, 0xaf, 0xd2, 0x64, 0x22, 0xd9, 0xbd, 0xdb, 0xc3, 0x07, 0xe2, 0x2d, 0xde, 0xdc, 0x8e,
+    0x34, 0x69, 0x94, 0xe1, 0x82, 0x19, 0x7f, 0x42, 0x5a, 0x12, 0xd1, 0x68, 0x05, 0x36, 0xc5, 0x1f,
+    0x49, 0xbc, 0xe3, 0xe3, 0x7c, 0xfa, 0x0b, 0x32, 0x71, 0x35, 0xdf, 0xcc, 0xca, 0x0a, 0x74, 0x9e,
+    0x8d, 0xe2, 0xa1, 0x76, 0x10, 0x3b, 0x4c, 0x6e, 0xed, 0xe3, 0xd7, 0x8a, 0x78, 0xe2, 0x9d, 0x98,
+    0x69, 0x9c, 0x04, 0x2c, 0x2e, 0x13, 0x1d, 0x37, 0x19, 0xce, 0xdd, 0xbb, 0xc8, 0x08, 0x7a, 0x30,
+    0xee, 0xcc, 0x68, 0x55, 0xf7, 0x44, 0xf7, 0xd5, 0x24, 0xbc, 0xd1, 0xe7, 0xd4, 0xb7, 0xf8, 0x82,
+    0xd1, 0x73, 0x85, 0x0f, 0x3e, 0xf9, 0x39, 0x3a, 0xbd, 0xad, 0x0e, 0xd4, 0x65, 0xac, 0xfb, 0x1d,
+    0x51, 0x30, 0xcc, 0xcd, 0xfc, 0x91, 0x3b, 0xf0, 0xbd, 0xac, 0xa8, 0x91, 0xbc, 0x2b, 0x21, 0x2a,
+    0x3a, 0xc1, 0x69, 0x28, 0x66, 0xb8, 0xef, 0x70, 0x1b, 0xa7, 0xf6, 0xda, 0xe5, 0x0d, 0x70, 0x2f,
+    0x9c, 0xa3, 0xad, 0x4b, 0xf9, 0x73, 0x06, 0xbe, 0xb4, 0xc7, 0xa2, 0xfb, 0x13, 0x3d, 0x16, 0xe1,
+    0xee, 0xb6, 0x46, 0x30, 0x77, 0xc3, 0x32, 0xa1, 0x9e, 0x2a, 0xfc, 0x3f, 0x04, 0x5e, 0x00, 0x86,
+    0xc9, 0x8c, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+// 150x80 4-bpp indexed with a 6 color palette
+static const uint8_t png_indexed[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x50, 0x04, 0x03, 0x00, 0x00, 0x00, 0x09, 0x9e, 0x91,
+    0x78, 0x00, 0x00, 0x00, 0x12, 0x50, 0x4c, 0x54, 0x45, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x1d, 0xf5, 0x2c, 0x32, 0x00,
+    0x00, 0x03, 0xe8, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0x15, 0x98, 0xb9, 0x96, 0x85, 0x20, 0x10,
+    0x44, 0x59, 0x73, 0x59, 0xcc, 0xe1, 0x09, 0xb9, 0x08, 0xe4, 0x2a, 0x92, 0xb3, 0xe8, 0xff, 0xff,
+    0xca, 0xf4, 0x64, 0x73, 0xde, 0x6c, 0x42, 0x57, 0x57, 0xdd, 0x12, 0x71, 0x74, 0xf3, 0xe5, 0x59,
+    0xce, 0xa9, 0x02, 0xbf, 0x4f, 0x9a, 0x12, 0x6e, 0xd7, 0xb2, 0x96, 0x58, 0xf7, 0x7d, 0x59, 0xd7,
+    0xa5, 0xec, 0x8f, 0xb9, 0xd5, 0xd7, 0x12, 0x7b, 0xce, 0x4b, 0x2f, 0xe4, 0x37, 0x69, 0xda, 0x91,
+    0x57, 0x87, 0xa4, 0xd7, 0xd3, 0xd6, 0x07, 0x51, 0x5b, 0x77, 0x96, 0xb5, 0xd6, 0xc1, 0xa3, 0x27,
+    0xac, 0x5a, 0x8c, 0x7c, 0x76, 0x35, 0xb9, 0xbd, 0x72, 0xc1, 0xfe, 0x97, 0xd5, 0x7b, 0x89, 0xe5,
+    0xf7, 0xed, 0xeb, 0x55, 0xf7, 0xf8, 0x99, 0x9d, 0x06, 0x94, 0xdb, 0x2e, 0xf3, 0xcd, 0x8c, 0x62,
+    0xf7, 0x90, 0x7a, 0xf8, 0x86, 0x7a, 0xc2, 0xa4, 0xc6, 0x21, 0xdc, 0x29, 0x1c, 0xd9, 0x72, 0xdb,
+    0x7e, 0x08, 0x8d, 0x2a, 0xa7, 0xd3, 0x39, 0x06, 0xd2, 0xd2, 0x71, 0xe8, 0xd3, 0xec, 0x0f, 0xb5,
+    0x93, 0x4d, 0xe5, 0xe2, 0xf8, 0x59, 0x4b, 0x09, 0x52, 0x6e, 0xad, 0x89, 0x8f, 0xed, 0x24, 0x81,
+    0x1c, 0xe5, 0xd2, 0x8f, 0x3c, 0xf3, 0x98, 0x8f, 0xc9, 0xb4, 0x51, 0x2b, 0x71, 0x20, 0xbf, 0x9d,
+    0x93, 0x4d, 0x4a, 0x74, 0x84, 0xd9, 0xb0, 0x2f, 0x48, 0xfa, 0x5f, 0x98, 0x96, 0x6d, 0x86, 0x71,
+    0x95, 0x3b, 0x79, 0x82, 0xa8, 0x9c, 0x2a, 0x7e, 0x95, 0xe5, 0xf7, 0x7a, 0xb6, 0x1c, 0xe7, 0xb3,
+    0xb9, 0xc5, 0x56, 0x24, 0xcf, 0xc5, 0x5f, 0xa6, 0x1d, 0x64, 0x8f, 0xed, 0x40, 0x7b, 0xa3, 0xd7,
+    0x7a, 0x9d, 0xcc, 0x7e, 0xfb, 0x62, 0x91, 0x34, 0xbf, 0x16, 0xcb, 0x42, 0x6b, 0xfb, 0xe2, 0xba,
+    0x91, 0x25, 0xea, 0x82, 0xfc, 0x23, 0x76, 0x6d, 0x5f, 0x27, 0x17, 0xd6, 0x77, 0xaa, 0x3a, 0xa7,
+    0xa3, 0xf0, 0x23, 0x3e, 0x1f, 0x7d, 0xe9, 0x6a, 0x7e, 0xa6, 0x6b, 0x71, 0xec, 0xfa, 0xb9, 0xef,
+    0xf9, 0xed, 0xe7, 0x19, 0x51, 0x4a, 0x94, 0x99, 0x07, 0xa3, 0xb1, 0x3d, 0xc7, 0x6b, 0x83, 0x4b,
+    0xd7, 0x91, 0xa4, 0x37, 0x69, 0x4b, 0x89, 0x8c, 0xd5, 0xc5, 0x73, 0x04, 0xda, 0xc2, 0x4f, 0xff,
+    0xae, 0xf7, 0x3d, 0xda, 0xd3, 0x5c, 0x59, 0xac, 0x93, 0x83, 0x61, 0xf3, 0xab, 0x7e, 0x1d, 0x07,
+    0x39, 0xf2, 0xa5, 0xf2, 0xb8, 0xc5, 0x22, 0xc6, 0xca, 0x4c, 0xa5, 0x5e, 0x20, 0xf8, 0x18, 0x9d,
+    0x6c, 0x8f, 0xeb, 0x21, 0x85, 0x48, 0x96, 0x21, 0x44, 0xd7, 0xd4, 0x49, 0xe5, 0x9b, 0xa2, 0x31,
+    0xa4, 0xf4, 0x6c, 0x29, 0x3c, 0x1b, 0x23, 0x2c, 0x94, 0x65, 0xcc, 0xe5, 0xd7, 0xfc, 0xfd, 0xb9,
+    0xbc, 0x21, 0xbb, 0xe9, 0xf3, 0xd4, 0xe7, 0x47, 0xee, 0x55, 0x7e, 0x8d, 0x6f, 0xc7, 0xf5, 0xc0,
+    0x19, 0x9f, 0x13, 0xa3, 0x4e, 0xdc, 0x37, 0xb5, 0x10, 0xf5, 0x16, 0x64, 0xe3, 0xdd, 0x1f, 0xd5,
+    0xbc, 0xbf, 0xd2, 0x9b, 0xb5, 0x2b, 0x96, 0x3f, 0xcc, 0xc8, 0x7e, 0xbd, 0x7b, 0x7d, 0xc2, 0x7c,
+    0xbc, 0xc7, 0x30, 0x04, 0x2f, 0xf2, 0x39, 0xe0, 0xb1, 0x45, 0xbb, 0x58, 0x3f, 0x96, 0x2f, 0x7f,
+    0xcb, 0xb7, 0xa1, 0x2d, 0xc9, 0x6b, 0x43, 0x37, 0xdd, 0x10, 0x5a, 0xc6, 0x77, 0xbf, 0x86, 0x19,
+    0x83, 0xab, 0x2a, 0x3a, 0x49, 0x7b, 0xf0, 0xa0, 0xcf, 0x46, 0x6f, 0x35, 0xae, 0xea, 0xce, 0xb7,
+    0xe6, 0x3b, 0x26, 0x86, 0x7e, 0x4d, 0x6b, 0x3a, 0xbc, 0x79, 0x63, 0xee, 0xba, 0xd1, 0xcc, 0xf2,
+    0x85, 0xc3, 0x5d, 0xbe, 0x84, 0x2a, 0xfb, 0x69, 0x61, 0xdc, 0xd5, 0xce, 0x21, 0x25, 0xa7, 0xdb,
+    0x12, 0xda, 0x75, 0x1c, 0xef, 0xcd, 0x4e, 0xda, 0x61, 0xf2, 0x66, 0x79, 0xf5, 0xe6, 0xb6, 0xe2,
+    0xec, 0xf5, 0x12, 0x62, 0xf0, 0xe3, 0xd5, 0x18, 0xf4, 0x4a, 0x31, 0xd3, 0x22, 0xce, 0xba, 0x3e,
+    0xf7, 0x1a, 0x2b, 0xab, 0x07, 0xb7, 0x61, 0x41, 0x81, 0xe1, 0x56, 0x1f, 0x6d, 0x9a, 0x0a, 0x19,
+    0x63, 0x79, 0x73, 0xb3, 0xe1, 0x83, 0x76, 0xb9, 0x1d, 0xdb, 0x75, 0x97, 0xf3, 0xf9, 0x66, 0x3a,
+    0x66, 0x1c, 0x6f, 0x28, 0xaf, 0x55, 0xc7, 0xdb, 0x97, 0x95, 0x0c, 0xe6, 0xaf, 0x31, 0x1e, 0xa1,
+    0xf6, 0x8f, 0x2f, 0x3d, 0xb0, 0x74, 0x9c, 0xe9, 0xed, 0x1d, 0x4e, 0xb7, 0x7e, 0xaa, 0xcc, 0xd9,
+    0x7c, 0xbc, 0x19, 0xdb, 0xe2, 0x84, 0xbd, 0xb1, 0x3b, 0x26, 0xd4, 0x0a, 0x8f, 0x57, 0xb5, 0x6a,
+    0xd6, 0xe0, 0xfa, 0x71, 0xcd, 0xd7, 0xb2, 0xb9, 0x14, 0xd4, 0xf8, 0xd4, 0xfe, 0x84, 0xe3, 0xad,
+    0x88, 0x89, 0x28, 0x7a, 0x0f, 0xf3, 0x38, 0xc8, 0x82, 0x33, 0x5e, 0xd2, 0x40, 0xbf, 0xf4, 0x12,
+    0x64, 0xd4, 0x3e, 0xc8, 0x89, 0xcf, 0x71, 0x56, 0xf6, 0xba, 0xd1, 0x97, 0xe7, 0xa2, 0xed, 0x77,
+    0x88, 0x8a, 0x37, 0xf7, 0x86, 0xb7, 0x94, 0xbe, 0xe4, 0xe9, 0xc5, 0x93, 0x4e, 0x95, 0x79, 0x67,
+    0xe2, 0x9e, 0xfe, 0x27, 0xc7, 0xf2, 0x7d, 0x65, 0x48, 0xcb, 0xa3, 0x6c, 0xe1, 0x2b, 0x14, 0x21,
+    0x99, 0xfb, 0x4a, 0xb9, 0xef, 0xa8, 0xd3, 0x1b, 0xd9, 0x72, 0xae, 0xd6, 0x30, 0x76, 0x18, 0x41,
+    0x9c, 0xdb, 0x84, 0xe0, 0x66, 0x2f, 0x2a, 0x9b, 0x2a, 0xee, 0x93, 0x3b, 0x4a, 0xbe, 0x53, 0x87,
+    0xef, 0xe0, 0x84, 0xe1, 0xf5, 0x6a, 0x36, 0x16, 0xf8, 0x3f, 0xed, 0x96, 0x88, 0x28, 0x69, 0x1a,
+    0x4a, 0x88, 0x94, 0x22, 0x2c, 0xf7, 0xaf, 0x11, 0x37, 0xe5, 0xf6, 0x94, 0xe4, 0x49, 0xfa, 0x47,
+    0x1c, 0xce, 0xbe, 0x96, 0x1b, 0xc5, 0xa1, 0xcd, 0xdc, 0xfd, 0x21, 0x53, 0x72, 0x1a, 0x8f, 0xf3,
+    0x64, 0xfc, 0x3b, 0x51, 0x62, 0x16, 0x2f, 0x46, 0xa1, 0x74, 0xfd, 0x46, 0x15, 0x24, 0x79, 0x74,
+    0x5b, 0x74, 0x24, 0xb4, 0xfa, 0xf5, 0xea, 0xdf, 0xa6, 0xbe, 0x9f, 0x11, 0xee, 0x09, 0xcb, 0x7c,
+    0x68, 0x22, 0xaf, 0xad, 0xcf, 0xba, 0x49, 0xdf, 0xf8, 0xd1, 0xcc, 0x11, 0x07, 0xcb, 0xbd, 0x88,
+    0xec, 0xdc, 0x0b, 0x7a, 0xfb, 0x30, 0xf7, 0x84, 0x67, 0x2c, 0xca, 0xda, 0x2d, 0xfd, 0xb5, 0x75,
+    0x79, 0x63, 0x04, 0x15, 0xee, 0x1c, 0x49, 0x27, 0x63, 0x2e, 0xcb, 0xd1, 0xd3, 0x58, 0xf0, 0x6b,
+    0xcc, 0xce, 0x1f, 0x39, 0x0e, 0xd8, 0xa1, 0x7c, 0xe0, 0xc8, 0xfc, 0x50, 0xa5, 0xaf, 0x9b, 0x49,
+    0xfb, 0x69, 0x49, 0x22, 0xc6, 0x6e, 0x3f, 0x6f, 0x97, 0xdd, 0x71, 0x0e, 0x17, 0x48, 0x38, 0xa3,
+    0xcf, 0x27, 0x83, 0x3d, 0x82, 0xf9, 0x5d, 0x57, 0x46, 0xfb, 0xbc, 0x90, 0xf7, 0x05, 0xa3, 0x26,
+    0x7e, 0xb9, 0xba, 0x37, 0xbe, 0x20, 0xfd, 0x1b, 0xa9, 0xe7, 0x51, 0x82, 0x91, 0xe5, 0x89, 0x68,
+    0xad, 0x71, 0xbf, 0xec, 0xd7, 0x43, 0x71, 0x3f, 0x1f, 0xd0, 0xec, 0x4f, 0x92, 0x5b, 0xbc, 0x66,
+    0x00, 0x3d, 0xf8, 0x8d, 0x37, 0xef, 0x35, 0x2f, 0x9e, 0x8f, 0x1d, 0xcd, 0x0d, 0x7f, 0xf8, 0x3e,
+    0xe7, 0xb5, 0x89, 0xfb, 0xe7, 0x19, 0x1e, 0xe9, 0x4c, 0xc5, 0x0a, 0x35, 0xfc, 0xcf, 0x13, 0x27,
+    0xd4, 0xf6, 0xac, 0xe4, 0xfb, 0x75, 0xb1, 0x9a, 0xcd, 0xa9, 0x1b, 0xa5, 0x27, 0x1b, 0x05, 0x12,
+    0x15, 0x74, 0xfd, 0x2a, 0x43, 0x55, 0x5c, 0xbf, 0xfb, 0x17, 0xdc, 0x46, 0x3e, 0x35, 0xc1, 0x78,
+    0xa6, 0x49, 0xcf, 0x00, 0x00, 0x03, 0xe8, 0x49, 0x44, 0x41, 0x54, 0xbf, 0x76, 0xb3, 0x6d, 0xdc,
+    0x1e, 0xca, 0x16, 0xeb, 0x5a, 0x38, 0x36, 0x89, 0x5d, 0xc8, 0xe6, 0xfb, 0x5a, 0x31, 0xf5, 0xfe,
+    0x90, 0xf2, 0x85, 0xe5, 0x9d, 0x5f, 0x3f, 0xbb, 0x0f, 0x8e, 0xd7, 0x23, 0x0a, 0xcb, 0xf2, 0xe0,
+    0x1d, 0x45, 0xc1, 0xfa, 0xd9, 0x6a, 0x25, 0x1a, 0x8b, 0x30, 0x52, 0xd8, 0xd1, 0x71, 0xb2, 0xe1,
+    0xc3, 0x89, 0x36, 0xf7, 0x13, 0x23, 0xe1, 0x32, 0xcc, 0x23, 0xba, 0x71, 0xaf, 0xcf, 0x5f, 0x1b,
+    0x91, 0x9d, 0x57, 0x14, 0xb5, 0xde, 0xad, 0xbc, 0xab, 0xa4, 0xf8, 0xea, 0x24, 0xd0, 0xf1, 0xb1,
+    0x7a, 0x95, 0x74, 0x7f, 0xef, 0x13, 0x4a, 0xb6, 0xae, 0x80, 0x15, 0x33, 0x44, 0x9d, 0x42, 0x9f,
+    0xbe, 0x73, 0x56, 0xeb, 0x42, 0x91, 0x0c, 0x64, 0x2c, 0xb7, 0x71, 0xf2, 0xd2, 0x2e, 0x91, 0xa3,
+    0xee, 0x33, 0x9c, 0xe0, 0x8b, 0xb6, 0x1e, 0x11, 0x6e, 0x7c, 0xc3, 0x73, 0x97, 0xb3, 0x1a, 0x82,
+    0x98, 0xca, 0x14, 0x0b, 0x0f, 0x43, 0xe6, 0xb0, 0xdf, 0x8f, 0x63, 0x35, 0xa0, 0xf5, 0x5d, 0x8e,
+    0x0f, 0x1d, 0xad, 0xae, 0x5b, 0x87, 0x0d, 0x3e, 0xbf, 0x90, 0x6d, 0x30, 0xf8, 0x53, 0x77, 0x59,
+    0xaf, 0x8f, 0x0d, 0x3d, 0x88, 0x63, 0x47, 0xe5, 0x9f, 0xf3, 0x2d, 0xa8, 0x34, 0xee, 0xef, 0x5c,
+    0xfb, 0xc1, 0xd0, 0x39, 0x1f, 0x4c, 0x49, 0xa5, 0xea, 0xf2, 0xb0, 0x55, 0x1e, 0x6b, 0xfc, 0xd3,
+    0x8e, 0x44, 0xd0, 0xbd, 0x3b, 0xd4, 0xc6, 0x60, 0x42, 0xd6, 0x18, 0x78, 0x9a, 0xd7, 0x79, 0xcf,
+    0xb8, 0x59, 0xf2, 0xa7, 0x7e, 0x36, 0x1b, 0x1c, 0x8f, 0x1e, 0xdc, 0x37, 0x42, 0x0e, 0x8f, 0xcb,
+    0x44, 0x47, 0x71, 0x75, 0x3d, 0xac, 0xd9, 0x09, 0xb3, 0xd3, 0xbd, 0x98, 0x75, 0xed, 0x2d, 0x33,
+    0x6b, 0xeb, 0x31, 0xe3, 0x1f, 0xfa, 0x1c, 0xad, 0x30, 0xae, 0xdf, 0x66, 0x26, 0xeb, 0x46, 0x1d,
+    0xbe, 0x9f, 0xfb, 0xf3, 0x7d, 0x39, 0xb8, 0x76, 0x6f, 0x91, 0xc5, 0x79, 0x97, 0xf1, 0x91, 0xc5,
+    0xd2, 0x0b, 0xfe, 0x42, 0xda, 0x8f, 0x9f, 0x46, 0xad, 0xa5, 0xcc, 0x21, 0x6b, 0x3e, 0xb7, 0x63,
+    0xab, 0xf1, 0xb2, 0x3d, 0x21, 0x37, 0x73, 0x22, 0xd4, 0xd2, 0x4b, 0xbf, 0x43, 0xe6, 0x19, 0x09,
+    0xd1, 0xfd, 0x18, 0xb7, 0xb5, 0x48, 0x6f, 0x0d, 0xd4, 0x52, 0xc4, 0xba, 0x1d, 0xf7, 0x2c, 0xc9,
+    0xaf, 0x2a, 0xf2, 0xff, 0xad, 0x28, 0xca, 0x4e, 0x1f, 0x96, 0x5b, 0xb0, 0xe7, 0xb9, 0xb4, 0x9a,
+    0xe9, 0xdc, 0x87, 0x4c, 0xb8, 0xff, 0x82, 0x65, 0x2b, 0xde, 0xd1, 0x07, 0x49, 0xda, 0x61, 0x3d,
+    0x8c, 0x60, 0xef, 0x52, 0xea, 0xb7, 0x8d, 0x9b, 0x6f, 0x25, 0x1a, 0x0d, 0x09, 0x53, 0x61, 0x92,
+    0xee, 0x4d, 0x3d, 0xb3, 0xc4, 0x8e, 0x65, 0xe2, 0x47, 0xb9, 0xf3, 0xf3, 0xdb, 0xef, 0x27, 0x56,
+    0x8b, 0x7e, 0xdb, 0x95, 0xc3, 0xb7, 0xe5, 0x7a, 0xd4, 0x2b, 0x69, 0x3d, 0x7b, 0x43, 0x34, 0x57,
+    0xde, 0x96, 0x38, 0x31, 0x8e, 0x95, 0x96, 0xa1, 0xc5, 0x37, 0x2f, 0x1d, 0x50, 0x8b, 0x07, 0xee,
+    0x54, 0xa5, 0xeb, 0x0c, 0x8f, 0x7d, 0x4d, 0x7a, 0xda, 0x4e, 0x99, 0x2d, 0xf1, 0x4a, 0xf8, 0x14,
+    0x0f, 0x6c, 0x2d, 0xc9, 0x28, 0xb6, 0x9b, 0xe2, 0xbb, 0xae, 0x4e, 0x4a, 0x9d, 0x56, 0xfd, 0xc1,
+    0x54, 0xe2, 0xb9, 0x12, 0xb1, 0xe0, 0x6f, 0xac, 0x10, 0x98, 0xdc, 0xfd, 0x24, 0x16, 0xe7, 0x6b,
+    0xca, 0x2c, 0xc4, 0x81, 0x85, 0x66, 0xe4, 0x26, 0x33, 0x4b, 0xc7, 0x7c, 0xed, 0xf8, 0xa2, 0x6b,
+    0xd7, 0x1b, 0xdb, 0x75, 0x10, 0xaa, 0xce, 0x26, 0xfb, 0x01, 0x4b, 0x09, 0x79, 0xf4, 0x94, 0x9f,
+    0x2e, 0x12, 0xcd, 0xd2, 0x7e, 0x24, 0x3d, 0x98, 0x15, 0x08, 0xcb, 0xa9, 0xe8, 0x96, 0x5a, 0xa5,
+    0xf6, 0x9d, 0x08, 0x5f, 0x98, 0x52, 0x98, 0x17, 0x53, 0xef, 0x82, 0x48, 0x23, 0x9b, 0xe6, 0x91,
+    0xe3, 0x41, 0x8f, 0xe0, 0x7e, 0xeb, 0x5c, 0x16, 0x1d, 0x7f, 0x0d, 0xb5, 0x27, 0x8b, 0x8b, 0xb5,
+    0xe3, 0x46, 0x7d, 0x56, 0x14, 0x6b, 0x5b, 0xf6, 0x6f, 0x15, 0x53, 0x16, 0x63, 0x14, 0x18, 0x6c,
+    0x8a, 0xd1, 0x0a, 0x1a, 0x87, 0x4b, 0xdb, 0xfa, 0x7d, 0x57, 0x90, 0xad, 0x2e, 0x67, 0x96, 0xfc,
+    0x5d, 0x09, 0x6d, 0xdb, 0x36, 0x4f, 0x57, 0x87, 0xc0, 0x68, 0xe1, 0x6f, 0x4e, 0x66, 0x7f, 0xb9,
+    0x8f, 0xc8, 0xbf, 0x70, 0x49, 0x12, 0xa1, 0xeb, 0x4e, 0xb7, 0x5d, 0x2b, 0x17, 0xf6, 0xfc, 0xfa,
+    0xb7, 0xea, 0xdf, 0x4f, 0xbe, 0x10, 0x6d, 0x54, 0x9d, 0x2b, 0x83, 0x8d, 0x0c, 0x26, 0x5e, 0xfd,
+    0xbc, 0x4c, 0x5a, 0x84, 0x39, 0x7f, 0xdb, 0xb7, 0x94, 0x8b, 0xfc, 0x6e, 0x73, 0xdd, 0x37, 0xa6,
+    0xb7, 0xce, 0x78, 0x67, 0xfd, 0xd7, 0xde, 0xbc, 0xb5, 0x46, 0x19, 0xc2, 0x52, 0x5d, 0x2f, 0xf0,
+    0x09, 0x19, 0x6d, 0x9d, 0x9e, 0x56, 0x91, 0x9e, 0x87, 0xf8, 0x83, 0x3c, 0xfb, 0x49, 0x77, 0xb0,
+    0x83, 0x8b, 0xcc, 0xec, 0x4b, 0x64, 0x07, 0x8c, 0x90, 0x91, 0x0e, 0xdf, 0x18, 0x13, 0x81, 0x93,
+    0x13, 0x06, 0xd6, 0x2c, 0x9e, 0x10, 0x7a, 0x69, 0xfd, 0xbb, 0x16, 0xe1, 0x1d, 0x02, 0x2f, 0x75,
+    0x6a, 0x07, 0xb0, 0x61, 0xcb, 0x4f, 0x6e, 0x0a, 0x92, 0x6d, 0x71, 0x7c, 0x25, 0x0b, 0x04, 0xcd,
+    0xc8, 0x4b, 0xd8, 0x9f, 0x33, 0xf2, 0xce, 0xf1, 0xc9, 0x39, 0x05, 0x6d, 0xab, 0x5f, 0xc2, 0x73,
+    0x1a, 0xed, 0x9b, 0x91, 0x57, 0xc6, 0xc4, 0x5b, 0xb5, 0x88, 0xbe, 0xfa, 0x08, 0x3b, 0x76, 0x20,
+    0x72, 0xc1, 0xcf, 0xba, 0x9d, 0xc0, 0x4a, 0xa2, 0x3a, 0x41, 0xdd, 0x97, 0x67, 0x67, 0xf7, 0x17,
+    0xb3, 0xdb, 0x3b, 0x38, 0xfd, 0x80, 0x04, 0x73, 0x45, 0x0b, 0x00, 0x60, 0x7c, 0x46, 0x57, 0x70,
+    0xc8, 0x29, 0x1c, 0xe5, 0x07, 0xfa, 0x0c, 0x40, 0xc4, 0x79, 0x35, 0x20, 0x3c, 0x4e, 0xd0, 0x7c,
+    0xd2, 0x83, 0x84, 0x74, 0x64, 0xea, 0x7d, 0x25, 0x0c, 0x44, 0x4a, 0x93, 0x2e, 0x49, 0x3f, 0x44,
+    0xe6, 0x1f, 0x5f, 0x78, 0xff, 0x57, 0x13, 0x59, 0x13, 0x50, 0x5d, 0x4f, 0xcb, 0x3d, 0xcf, 0x70,
+    0xce, 0xe4, 0x6b, 0xc7, 0x8e, 0x1a, 0x7b, 0x5e, 0x4a, 0x27, 0x73, 0xb9, 0x77, 0x80, 0x01, 0xec,
+    0xf8, 0x39, 0x04, 0xf8, 0xf3, 0x27, 0xaf, 0x64, 0xea, 0x18, 0xfd, 0x51, 0x8b, 0x15, 0x39, 0xbc,
+    0x71, 0xc6, 0xe7, 0x2d, 0x28, 0xe1, 0x6d, 0x68, 0xdb, 0xeb, 0xde, 0xea, 0x75, 0xa5, 0xa0, 0x39,
+    0x2b, 0xba, 0xb0, 0x30, 0xbb, 0x54, 0x37, 0xcf, 0x45, 0x3a, 0x06, 0xa4, 0xba, 0xed, 0x8e, 0x6d,
+    0x3c, 0xfe, 0xe4, 0x91, 0x17, 0x8c, 0x42, 0xf4, 0xad, 0x94, 0x7b, 0xb7, 0x2a, 0xa3, 0x9f, 0x7d,
+    0xd3, 0x00, 0x76, 0x21, 0xf8, 0x0b, 0x3f, 0x7f, 0x6e, 0x77, 0x7b, 0x46, 0xbe, 0xb7, 0x5b, 0x4d,
+    0x7f, 0x62, 0x70, 0x15, 0xd9, 0xf4, 0xbb, 0xc1, 0x36, 0x9c, 0x35, 0x2d, 0x04, 0x6c, 0xe5, 0x68,
+    0x2f, 0x80, 0xab, 0xc6, 0xf6, 0x8b, 0xc9, 0x31, 0x8f, 0x8e, 0xdb, 0x3e, 0x93, 0x9f, 0x6d, 0x09,
+    0xb0, 0x63, 0xf4, 0xb1, 0x3b, 0x5d, 0x46, 0x58, 0x95, 0xb6, 0xd1, 0x5f, 0x59, 0xba, 0x20, 0x08,
+    0xfa, 0x01, 0x1f, 0x68, 0xb2, 0x34, 0xfd, 0x49, 0x43, 0x8a, 0x77, 0x05, 0x84, 0x50, 0xd6, 0xba,
+    0x75, 0x5c, 0x3f, 0x2c, 0xb2, 0x89, 0x45, 0x00, 0x00, 0x03, 0xe8, 0x49, 0x44, 0x41, 0x54, 0xba,
+    0xd1, 0x58, 0x57, 0xf4, 0x98, 0xf1, 0x2c, 0x88, 0xbf, 0xd7, 0x6f, 0xbf, 0xc6, 0xf9, 0xe8, 0xf3,
+    0xbe, 0x18, 0x70, 0x2e, 0xdb, 0x6a, 0x38, 0xba, 0xa2, 0x34, 0xeb, 0xa6, 0x6e, 0x07, 0x19, 0xfd,
+    0x7e, 0x9f, 0x91, 0xfb, 0xbd, 0x6d, 0xfb, 0xb5, 0x10, 0x74, 0x3a, 0x8c, 0xf9, 0x57, 0xbb, 0x68,
+    0x3f, 0x67, 0xac, 0x5f, 0xbf, 0xbe, 0x86, 0x87, 0xbc, 0x52, 0xec, 0x88, 0xaf, 0xbf, 0x89, 0x7f,
+    0xaa, 0x6c, 0x47, 0xfb, 0x8f, 0x3c, 0xf7, 0x82, 0x28, 0x85, 0x38, 0xdc, 0xfe, 0xfd, 0x06, 0xa8,
+    0x32, 0xd2, 0xa8, 0xed, 0xd2, 0xcf, 0x02, 0xc7, 0x9c, 0x58, 0x27, 0x07, 0xbe, 0x7e, 0xaf, 0xc4,
+    0xcd, 0x9e, 0xa6, 0x6f, 0x0e, 0xc6, 0x93, 0x73, 0x81, 0x91, 0xff, 0x5a, 0x07, 0xd9, 0x9d, 0x3d,
+    0x45, 0x9e, 0x0e, 0xd0, 0x8c, 0xc5, 0xa9, 0x69, 0x26, 0xba, 0xdd, 0x10, 0x39, 0x35, 0xfc, 0x21,
+    0x9f, 0x7f, 0xa5, 0xc1, 0x39, 0x4a, 0xde, 0xd4, 0x16, 0xe4, 0xef, 0xf1, 0x35, 0x2f, 0x84, 0xfd,
+    0x8e, 0x29, 0xde, 0xd7, 0x8b, 0xa3, 0x7a, 0xbf, 0x7f, 0xb3, 0xf6, 0xa3, 0x09, 0xe1, 0x7b, 0x45,
+    0x5d, 0x84, 0x65, 0x2b, 0xe0, 0x1d, 0xfe, 0xe2, 0x31, 0xc8, 0xad, 0x71, 0xf9, 0x7c, 0xc4, 0x88,
+    0xbc, 0xeb, 0xb5, 0xf6, 0x72, 0xc5, 0x9a, 0xc6, 0xea, 0xb1, 0xf5, 0x5e, 0x61, 0x3b, 0x6a, 0x63,
+    0x56, 0x7c, 0xc3, 0x80, 0x6b, 0x94, 0x6d, 0xd2, 0x5d, 0x1e, 0x0f, 0xcd, 0x54, 0x15, 0xd3, 0x03,
+    0xba, 0x50, 0x79, 0x42, 0xfb, 0x6c, 0x7f, 0x0a, 0x09, 0xd7, 0x0a, 0xc6, 0x84, 0xf6, 0x95, 0x73,
+    0xdb, 0xba, 0xee, 0x6a, 0x8d, 0xf3, 0xe7, 0x18, 0x83, 0x72, 0xb3, 0x55, 0xa0, 0x54, 0xc8, 0x23,
+    0xaf, 0xc8, 0x75, 0x70, 0x57, 0xd5, 0xb3, 0xab, 0x27, 0xbe, 0x0e, 0x0e, 0x7f, 0xca, 0x53, 0x36,
+    0x70, 0x75, 0x26, 0x2f, 0x24, 0x85, 0x99, 0x26, 0x80, 0x6a, 0x97, 0x4b, 0xac, 0xb8, 0x7c, 0x7c,
+    0xee, 0x5f, 0xdb, 0xfd, 0x43, 0x7a, 0xb2, 0xd8, 0x60, 0x35, 0x0b, 0x0d, 0xd8, 0xc8, 0x7a, 0xd0,
+    0x4b, 0x94, 0xb3, 0xa2, 0x30, 0x86, 0xdb, 0xa8, 0x27, 0xb0, 0x2d, 0xd3, 0x29, 0x02, 0x40, 0x41,
+    0x44, 0x7f, 0x30, 0xf0, 0x31, 0xe8, 0xeb, 0xc2, 0x80, 0x49, 0xad, 0x8d, 0x60, 0xc4, 0x14, 0xfc,
+    0xb7, 0xa1, 0x47, 0x3c, 0x22, 0xb8, 0x33, 0xea, 0x0b, 0xef, 0x14, 0xb9, 0x84, 0xf1, 0xae, 0x20,
+    0x3e, 0xfb, 0x94, 0x60, 0x95, 0x50, 0x6d, 0xc0, 0xb4, 0x7e, 0xbd, 0x28, 0xc0, 0x82, 0xe0, 0x97,
+    0x65, 0x46, 0xfc, 0x7f, 0x2e, 0x2e, 0xf6, 0x02, 0x54, 0x2c, 0x24, 0xac, 0x7b, 0x45, 0x10, 0xd4,
+    0xe4, 0x7f, 0x07, 0x82, 0x3a, 0xc2, 0xe7, 0xfa, 0x97, 0xb3, 0xb1, 0xeb, 0xb9, 0x98, 0x96, 0xe6,
+    0xa3, 0xbf, 0xeb, 0x38, 0xdb, 0x97, 0x37, 0x92, 0x26, 0xfd, 0xbd, 0x78, 0xdb, 0x1e, 0xa8, 0x5d,
+    0xba, 0x8c, 0xfb, 0xf5, 0xf2, 0xa7, 0xe9, 0x9b, 0x11, 0xbb, 0x57, 0xb4, 0x6c, 0x58, 0x41, 0x30,
+    0x01, 0xf0, 0xaf, 0xb7, 0xa9, 0x3a, 0x61, 0xa4, 0xa4, 0x0a, 0x3f, 0x38, 0xce, 0xf1, 0x8b, 0x42,
+    0xff, 0xc2, 0xef, 0x1b, 0x5b, 0x22, 0xeb, 0xc9, 0x7f, 0xef, 0x87, 0x5d, 0x69, 0x6e, 0x4f, 0x55,
+    0x30, 0x07, 0x79, 0x8d, 0x5e, 0x65, 0x19, 0xcc, 0xbb, 0x3c, 0x60, 0x71, 0xdb, 0x95, 0x90, 0x35,
+    0x95, 0x69, 0x6b, 0xdf, 0x82, 0x49, 0xe9, 0x2f, 0xfc, 0xfe, 0xc2, 0xbd, 0xfc, 0x5c, 0x50, 0xca,
+    0x4d, 0xfb, 0xd0, 0x0e, 0x24, 0x59, 0x76, 0xb9, 0x69, 0xaf, 0x67, 0x55, 0x36, 0x3e, 0xcf, 0x8b,
+    0x7f, 0x41, 0x4e, 0x8d, 0xfb, 0xa7, 0xda, 0xcc, 0x96, 0xba, 0xce, 0xcc, 0x75, 0x76, 0x41, 0x1e,
+    0xa4, 0x61, 0x49, 0xd7, 0xde, 0xb6, 0xd7, 0x1f, 0x5c, 0x00, 0xd6, 0x63, 0x33, 0x4a, 0x9c, 0xf9,
+    0x80, 0x1b, 0xfe, 0xe6, 0x97, 0x7a, 0x68, 0x6f, 0xb5, 0x95, 0xdc, 0xd2, 0x3f, 0x54, 0x5f, 0x47,
+    0xcd, 0x9a, 0x7c, 0xce, 0x98, 0xfb, 0x66, 0xc4, 0xc8, 0x63, 0x3a, 0xb1, 0x9f, 0x1f, 0x77, 0xfd,
+    0xae, 0x35, 0xa2, 0x71, 0x2d, 0x6e, 0x5c, 0x68, 0x58, 0x6d, 0x44, 0x5a, 0x8e, 0x95, 0xe3, 0x09,
+    0x2d, 0x61, 0x7f, 0xdf, 0x3b, 0xf5, 0xd3, 0x2f, 0x73, 0x69, 0x53, 0x7c, 0x9d, 0xd9, 0x3d, 0x9c,
+    0xc2, 0xca, 0xdc, 0x44, 0xdc, 0x98, 0x96, 0x15, 0xfa, 0xe8, 0x75, 0x13, 0x0b, 0x6d, 0x95, 0x3b,
+    0x97, 0xb9, 0xa1, 0x8e, 0xae, 0xc8, 0x85, 0x08, 0x49, 0x6d, 0x7e, 0x24, 0x7f, 0x5d, 0xa8, 0xb0,
+    0x16, 0x2e, 0x8e, 0xdf, 0x6f, 0x9e, 0x8f, 0x9a, 0xbf, 0xad, 0xf8, 0x68, 0xaf, 0xf5, 0x80, 0x8a,
+    0xe4, 0x9f, 0x57, 0x96, 0xb2, 0x55, 0xbc, 0x4c, 0xbf, 0x54, 0x9f, 0xf8, 0xda, 0x10, 0x7e, 0xf7,
+    0x1b, 0xb2, 0xb3, 0x37, 0xbe, 0x48, 0x9c, 0x8c, 0x06, 0x2f, 0x54, 0xa3, 0x45, 0x07, 0xb9, 0x7f,
+    0xa0, 0x8e, 0x60, 0x44, 0x3f, 0x12, 0xb2, 0x12, 0xa7, 0xa9, 0x19, 0xa8, 0x26, 0xaf, 0x22, 0xd8,
+    0x95, 0xfe, 0x08, 0xdc, 0xa6, 0x78, 0x25, 0x13, 0x2a, 0xf5, 0xce, 0x9f, 0x34, 0x43, 0xaf, 0xa1,
+    0x30, 0x19, 0xf1, 0x35, 0xbc, 0x3d, 0x6b, 0xf1, 0x8b, 0xba, 0xc0, 0x7d, 0x25, 0xd4, 0x5f, 0xbf,
+    0x93, 0xc7, 0x74, 0x76, 0x42, 0x15, 0x7c, 0x55, 0x81, 0x62, 0x05, 0xd2, 0xa8, 0x03, 0x41, 0xcb,
+    0x55, 0x73, 0x08, 0x45, 0xcf, 0x63, 0xb0, 0x4a, 0x03, 0xdc, 0xc7, 0x17, 0x09, 0xa2, 0x08, 0x6a,
+    0x8b, 0x17, 0xb3, 0xad, 0xd0, 0x22, 0x7f, 0x22, 0xd1, 0x92, 0x4e, 0x9b, 0x6e, 0x94, 0x2d, 0x34,
+    0xfa, 0xa0, 0x93, 0xca, 0x11, 0x76, 0x78, 0xf5, 0x08, 0x6e, 0xef, 0x49, 0xe9, 0x05, 0x50, 0x43,
+    0xdf, 0x94, 0x44, 0x10, 0x38, 0x6c, 0xf6, 0x14, 0xdc, 0x6e, 0x33, 0xab, 0xca, 0xfa, 0xda, 0xfc,
+    0x31, 0xfb, 0x0f, 0x78, 0x0d, 0xfc, 0xe8, 0x36, 0xef, 0xc7, 0x0f, 0xe9, 0xb7, 0xb2, 0xc6, 0x00,
+    0x38, 0x0a, 0x3d, 0x18, 0xbe, 0xc6, 0x6b, 0x3d, 0x7f, 0xc1, 0xec, 0x90, 0x13, 0x04, 0x8e, 0x69,
+    0xc1, 0xc0, 0xdf, 0x98, 0x9e, 0xe8, 0x52, 0xed, 0x2f, 0x78, 0x7f, 0xf9, 0x3e, 0xe8, 0x4e, 0x04,
+    0xba, 0x00, 0xd2, 0xa6, 0xe2, 0xd2, 0xeb, 0xaa, 0x96, 0xdf, 0x42, 0xf2, 0xba, 0x28, 0x30, 0x33,
+    0xca, 0xbf, 0x0b, 0xe5, 0x22, 0xc0, 0x0e, 0x61, 0x0f, 0x97, 0x2d, 0x70, 0xe4, 0x76, 0xbd, 0x13,
+    0x70, 0x0e, 0x64, 0x06, 0x28, 0x4f, 0x2d, 0x2d, 0x50, 0x0c, 0x10, 0x87, 0x97, 0x65, 0xec, 0xbd,
+    0x63, 0xb5, 0x11, 0x71, 0xed, 0xe7, 0x55, 0x70, 0x47, 0x67, 0xef, 0xd3, 0x20, 0xb8, 0xa5, 0x34,
+    0xdd, 0x27, 0x8a, 0xb9, 0xff, 0xdf, 0x03, 0xec, 0x34, 0xb9, 0x7c, 0x17, 0xa8, 0x7b, 0x6c, 0xb5,
+    0x72, 0xfc, 0xe8, 0x07, 0xca, 0x76, 0xf1, 0x27, 0x38, 0x44, 0xce, 0xcd, 0xf1, 0xcb, 0x4d, 0xb0,
+    0xb3, 0x43, 0xb1, 0xee, 0xbf, 0xbe, 0x17, 0xf3, 0xd6, 0x03, 0x32, 0xe5, 0x61, 0x4c, 0xb2, 0x4b,
+    0x83, 0x35, 0xfa, 0x33, 0x43, 0xe5, 0xd3, 0x4f, 0x07, 0xc6, 0x3c, 0xf7, 0x69, 0x17, 0xbf, 0xbb,
+    0xe2, 0xf2, 0xdc, 0xe9, 0x1c, 0x31, 0xdb, 0x9c, 0xa3, 0xad, 0x8b, 0x23, 0xfb, 0xc3, 0x9b, 0xb8,
+    0xe2, 0xa7, 0xeb, 0xbc, 0x35, 0x6d, 0xe2, 0xb0, 0x64, 0x11, 0xd8, 0x00, 0x00, 0x03, 0xe8, 0x49,
+    0x44, 0x41, 0x54, 0xd9, 0xa0, 0xd3, 0x17, 0x60, 0x64, 0x48, 0x9d, 0xbb, 0x4a, 0x3a, 0xef, 0xf6,
+    0xc3, 0x7d, 0xb0, 0x26, 0x7f, 0xdb, 0x49, 0xff, 0xb5, 0x70, 0x30, 0x6f, 0x6f, 0x0c, 0x2c, 0x58,
+    0xb2, 0x79, 0xdf, 0x27, 0x6b, 0xf1, 0xa3, 0x77, 0xbf, 0xe2, 0x75, 0x4b, 0x07, 0x76, 0x37, 0xf4,
+    0xf5, 0xe3, 0x9c, 0x7f, 0x90, 0x69, 0xbb, 0x82, 0x48, 0x5a, 0xc8, 0x43, 0x23, 0x5b, 0x1e, 0x7d,
+    0xef, 0xed, 0xc8, 0x52, 0xff, 0xbf, 0x0c, 0x38, 0x91, 0x8e, 0x0a, 0xf1, 0xd8, 0x7f, 0x7c, 0xf2,
+    0x77, 0x3f, 0x09, 0xc1, 0x07, 0x6c, 0x71, 0x89, 0xbf, 0x1f, 0xde, 0x75, 0xb2, 0xf4, 0x70, 0x3c,
+    0xec, 0xeb, 0x2e, 0xa5, 0xb1, 0xc6, 0xb5, 0x85, 0xb8, 0xee, 0xec, 0xdd, 0xbd, 0xf9, 0xf1, 0xdb,
+    0xf5, 0x65, 0xcf, 0x4d, 0xbd, 0xbf, 0xb3, 0x8f, 0x6a, 0x5a, 0x86, 0x84, 0xa3, 0x19, 0xe5, 0xa9,
+    0x8d, 0x15, 0x27, 0x0c, 0xae, 0xad, 0xc7, 0x82, 0x3e, 0x45, 0x00, 0x04, 0x88, 0x78, 0x87, 0xbf,
+    0xf5, 0x00, 0xf8, 0xc7, 0x51, 0xcb, 0xf9, 0xf3, 0xd7, 0x0f, 0xe2, 0xa7, 0x91, 0xca, 0xfa, 0x12,
+    0x4b, 0x7f, 0xb6, 0x95, 0x54, 0xfc, 0x42, 0x45, 0xd4, 0x64, 0xaa, 0x63, 0x26, 0x05, 0x88, 0x6c,
+    0xd1, 0x9a, 0x56, 0x07, 0x3c, 0x77, 0x5f, 0x9a, 0xf0, 0xeb, 0xa9, 0x23, 0x89, 0x5f, 0xd1, 0x77,
+    0x3c, 0xe6, 0x31, 0xc8, 0x7d, 0x87, 0x47, 0x71, 0x5f, 0x90, 0xd6, 0x27, 0xaa, 0x69, 0xdf, 0xce,
+    0x76, 0xff, 0x1a, 0xb0, 0x3a, 0xdf, 0x36, 0xd6, 0x8f, 0x04, 0xa4, 0xae, 0x9b, 0xae, 0x3a, 0xc7,
+    0xf8, 0x19, 0xea, 0x11, 0xed, 0x7e, 0x65, 0x50, 0x6d, 0xd6, 0xe4, 0x3a, 0xa0, 0x7a, 0x98, 0x33,
+    0xec, 0x5c, 0x9d, 0x38, 0x9b, 0xd0, 0x58, 0x59, 0xac, 0x39, 0xf3, 0x5c, 0x95, 0xbd, 0xf3, 0x0e,
+    0x02, 0x5f, 0x21, 0x90, 0xa0, 0xfe, 0x4b, 0xd5, 0x69, 0xd3, 0xd1, 0xf7, 0x72, 0x6f, 0xa1, 0x95,
+    0x85, 0xb1, 0x2f, 0x7a, 0xcf, 0x11, 0xb7, 0x36, 0x99, 0x10, 0xac, 0xff, 0xb2, 0x82, 0x50, 0xc8,
+    0x6e, 0xde, 0xaf, 0x82, 0xa1, 0xd9, 0x48, 0xfb, 0x40, 0xeb, 0xd8, 0x04, 0x97, 0x47, 0x65, 0xd7,
+    0x0b, 0xb6, 0xe2, 0x16, 0x50, 0xef, 0x22, 0x8b, 0x7c, 0x17, 0x36, 0x00, 0x08, 0x05, 0xbf, 0x39,
+    0x57, 0xd5, 0xd1, 0x5f, 0xb9, 0x0e, 0x7c, 0xa0, 0x9d, 0xaa, 0xba, 0x1f, 0x69, 0xb3, 0xe6, 0xa5,
+    0x71, 0xdf, 0x86, 0x4d, 0x6c, 0x7d, 0x6e, 0xfe, 0xf2, 0xed, 0x47, 0x03, 0xdc, 0x7f, 0xe9, 0xe9,
+    0xa9, 0xe2, 0xd9, 0x89, 0xdf, 0x31, 0xe8, 0xef, 0x57, 0x3a, 0x21, 0x81, 0x3f, 0xe2, 0xba, 0x37,
+    0x68, 0x97, 0xe9, 0x01, 0x7d, 0xdd, 0x25, 0x68, 0xcf, 0xe0, 0xbe, 0xce, 0x1b, 0x1d, 0x3c, 0x42,
+    0x08, 0x5c, 0x93, 0x66, 0x21, 0x49, 0x8c, 0x26, 0x85, 0x19, 0x13, 0x7e, 0x05, 0x63, 0xcf, 0xc1,
+    0xb2, 0x9d, 0xe7, 0x7b, 0x41, 0x25, 0x39, 0x2b, 0x7e, 0x06, 0xdd, 0x46, 0x84, 0x26, 0xc7, 0xe6,
+    0x0d, 0xa8, 0x62, 0x40, 0xf1, 0xd7, 0xd0, 0xff, 0x2f, 0x78, 0xd4, 0xd6, 0xaf, 0x15, 0x41, 0x85,
+    0x35, 0x1b, 0x8c, 0xff, 0xc5, 0xcf, 0x69, 0xae, 0xeb, 0x2a, 0xd4, 0x8a, 0x1b, 0x88, 0xd6, 0xa1,
+    0x9f, 0x59, 0xe7, 0x9b, 0xe1, 0x79, 0xdf, 0xf6, 0x08, 0x24, 0xf3, 0x15, 0x94, 0x24, 0x46, 0x4d,
+    0xbb, 0xa9, 0xec, 0x47, 0xfd, 0x52, 0x68, 0x61, 0x8b, 0xf3, 0xbd, 0x3c, 0xb9, 0xb7, 0xb3, 0x64,
+    0x8d, 0x56, 0xf9, 0x4a, 0x78, 0xc4, 0xf5, 0xcd, 0x0e, 0xf9, 0x29, 0xe9, 0x57, 0x7e, 0xc7, 0x26,
+    0x18, 0x3d, 0x6e, 0xf0, 0xe5, 0x57, 0x3e, 0x7b, 0x4c, 0xf2, 0xb9, 0x4e, 0x0a, 0xc9, 0x37, 0xe3,
+    0x3b, 0xcd, 0x19, 0x29, 0xd9, 0x15, 0xa8, 0xb0, 0x13, 0x95, 0x13, 0x6f, 0x27, 0x40, 0x7f, 0xf5,
+    0xf1, 0x91, 0xfa, 0x87, 0xda, 0xfa, 0x8b, 0x6e, 0xab, 0x32, 0x5c, 0x60, 0x67, 0xfd, 0x9b, 0xa2,
+    0x3d, 0x3b, 0x6a, 0x1a, 0x91, 0x85, 0x60, 0xb1, 0x24, 0x79, 0xbc, 0x75, 0x89, 0xe6, 0x37, 0x6f,
+    0xfe, 0x0b, 0xf3, 0x41, 0xf7, 0xce, 0x7f, 0xe2, 0xf4, 0xe5, 0x1d, 0xd1, 0xc3, 0x61, 0x66, 0x6d,
+    0xe9, 0x3e, 0xea, 0xe8, 0x7b, 0xb3, 0x18, 0x6d, 0xe1, 0x3c, 0xaa, 0x38, 0xa4, 0xf9, 0xdd, 0x6b,
+    0xa1, 0xef, 0x77, 0x70, 0xe5, 0xd7, 0x56, 0x1c, 0x30, 0x46, 0xa9, 0xc9, 0x40, 0x3a, 0x83, 0x98,
+    0x8e, 0x03, 0xba, 0x25, 0x94, 0x59, 0x8b, 0xc2, 0xb1, 0x03, 0x0d, 0x32, 0xac, 0xfa, 0x7b, 0x03,
+    0xf2, 0x01, 0xa0, 0xa7, 0x13, 0xdc, 0x66, 0xb8, 0x6f, 0x5d, 0xe0, 0xb6, 0x6e, 0x6c, 0x2e, 0xf1,
+    0x7e, 0xc5, 0x2a, 0x65, 0x3e, 0xc9, 0xfc, 0xb1, 0xd0, 0x57, 0x00, 0xf7, 0x2d, 0xb0, 0x6f, 0x22,
+    0xa7, 0xd0, 0x4d, 0x75, 0x88, 0x9d, 0x04, 0x49, 0xdd, 0x6f, 0x98, 0x51, 0x95, 0xcb, 0xfc, 0xc6,
+    0x2e, 0x8e, 0xf1, 0x68, 0x4a, 0x5c, 0x03, 0xda, 0x9b, 0x57, 0xb0, 0x31, 0xa2, 0xa9, 0x1f, 0x04,
+    0xa8, 0xb8, 0xb6, 0xd8, 0xdc, 0xb9, 0x96, 0x42, 0x3c, 0x14, 0xe1, 0x01, 0xb8, 0x58, 0x22, 0xf5,
+    0x7d, 0x90, 0x95, 0xfc, 0x5b, 0x54, 0xd6, 0xe1, 0xb3, 0x3a, 0x42, 0xe5, 0x1a, 0x66, 0xf4, 0x3c,
+    0xa9, 0x33, 0x5f, 0x46, 0xe6, 0xa2, 0xb0, 0xef, 0xe5, 0xb9, 0x51, 0xd1, 0x47, 0xcf, 0x48, 0x22,
+    0xa2, 0x43, 0x33, 0xe3, 0x98, 0xec, 0x84, 0x75, 0xa0, 0xef, 0x69, 0xb8, 0x21, 0x5c, 0x24, 0x77,
+    0x00, 0x86, 0x90, 0x97, 0xf1, 0xc6, 0x50, 0x83, 0xd2, 0xc1, 0x33, 0x8e, 0xd0, 0x1c, 0x8d, 0xa8,
+    0x4f, 0x6e, 0xdf, 0x90, 0xaf, 0x03, 0xb8, 0x00, 0x54, 0xc3, 0x1e, 0xe1, 0x28, 0xca, 0x0a, 0x75,
+    0x0a, 0x92, 0x2a, 0x4d, 0x99, 0x58, 0xb7, 0x6d, 0xe5, 0xf9, 0x78, 0x75, 0xf9, 0x5e, 0xcf, 0xd6,
+    0x9d, 0xae, 0x6d, 0x4e, 0xd8, 0xce, 0x78, 0xcb, 0x89, 0x2b, 0x19, 0x07, 0xfd, 0x21, 0x09, 0x74,
+    0x62, 0x18, 0x79, 0x05, 0xce, 0x02, 0x8b, 0x3b, 0x1c, 0x24, 0xf7, 0xd5, 0xc6, 0xb9, 0xd7, 0x95,
+    0xc3, 0xfe, 0xa3, 0x2e, 0x1f, 0xbc, 0xec, 0x80, 0x22, 0xbf, 0xe5, 0x29, 0xef, 0xea, 0x70, 0x75,
+    0xdf, 0x8e, 0xf3, 0xc7, 0x79, 0x88, 0x72, 0x8c, 0x92, 0x12, 0xd5, 0x0e, 0x2e, 0x39, 0xb4, 0x84,
+    0xc5, 0xaf, 0xed, 0xd8, 0xdb, 0xb4, 0xfb, 0x34, 0x5e, 0xfb, 0xae, 0x7d, 0x2b, 0x9c, 0x96, 0x22,
+    0x40, 0x6d, 0xaa, 0xed, 0x0d, 0x45, 0x68, 0x9f, 0xca, 0xbf, 0x9c, 0x86, 0x22, 0x2d, 0xd4, 0xda,
+    0x76, 0x2f, 0x19, 0x30, 0x1d, 0x78, 0x6f, 0x04, 0x28, 0x6b, 0x78, 0x2f, 0x5b, 0x91, 0xa7, 0x6f,
+    0xeb, 0xb7, 0x2c, 0x22, 0x50, 0x5b, 0x14, 0xec, 0x37, 0x61, 0x45, 0xc5, 0xa5, 0x33, 0x38, 0x0f,
+    0x92, 0xf4, 0x8e, 0xf9, 0x9b, 0xcc, 0x1b, 0x74, 0xfc, 0x83, 0xe4, 0x7d, 0xcd, 0xa1, 0xeb, 0xfd,
+    0xce, 0xed, 0x24, 0x98, 0x51, 0x91, 0xa0, 0x0e, 0x37, 0x3c, 0x01, 0x8d, 0xa2, 0x67, 0xb7, 0x2e,
+    0xed, 0x58, 0x93, 0xf6, 0x35, 0x49, 0x17, 0xc9, 0xdd, 0xe5, 0x84, 0xfa, 0x8e, 0xb7, 0x69, 0xf7,
+    0x2f, 0x03, 0x9e, 0x8d, 0xc9, 0x6f, 0x6b, 0x18, 0x2c, 0xe3, 0x26, 0xaa, 0x23, 0xf1, 0x3b, 0x17,
+    0xb9, 0x01, 0x87, 0xa1, 0xc3, 0xef, 0x3d, 0xe9, 0x13, 0xa2, 0x56, 0x00, 0xcb, 0x7c, 0xc9, 0x00,
+    0x00, 0x00, 0x5a, 0x49, 0x44, 0x41, 0x54, 0xd6, 0x4c, 0x4b, 0x10, 0x38, 0xa9, 0xcb, 0xbc, 0xf9,
+    0xe5, 0xf2, 0x02, 0xb4, 0x7c, 0xc8, 0xb7, 0x68, 0xbc, 0x95, 0xf7, 0x06, 0x57, 0x3d, 0x5e, 0xf1,
+    0xff, 0x0e, 0xf1, 0x9b, 0x28, 0x6d, 0xcb, 0xd7, 0x38, 0xba, 0x0c, 0x7c, 0xdc, 0x22, 0x87, 0x3c,
+    0x07, 0x9a, 0x4c, 0x9a, 0x4e, 0x91, 0xbe, 0xf5, 0xfa, 0x01, 0x34, 0x07, 0xf5, 0x62, 0xe8, 0xa8,
+    0x43, 0xdd, 0xaf, 0xbd, 0x48, 0xa2, 0x89, 0xd5, 0x2d, 0xea, 0xec, 0x28, 0x31, 0x6b, 0xb3, 0xbf,
+    0x30, 0x96, 0xfd, 0x79, 0x56, 0x48, 0x5a, 0x27, 0x8f, 0x3b, 0xd8, 0xf6, 0x07, 0x26, 0x81, 0xe0,
+    0xdb, 0xff, 0xd1, 0x87, 0x61, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60,
+    0x82,
+};
@@ -0,0 +1,343 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+// included by path: the rest of bb_epaper doesn't build on the host
+#include "../../lib/bb_epaper/src/Group5.cpp"
+#include "../../lib/bb_epaper/src/bb_ep_prev.inl"
+
+/**
+ * Packs frames the way the last shown image is kept across deep sleep and unpacks them
+ * through a recorder of the SPI traffic into a virtual controller with an 'old' and a
+ * 'new' RAM plane. A partial refresh on that controller only drives the pixels which
+ * differ between the planes, so the glass ends up right only if the old plane really
+ * held what was shown.
+ */
+
+#define PANEL_WIDTH 800
+#define PANEL_HEIGHT 480
+#define CMD_OLD 0x10 // UC8179 DTM1
+#define CMD_NEW 0x13 // UC8179 DTM2
+
+/** A 1-bpp controller (1 = white) taking a command and then the rows of a whole plane */
+struct VirtualController
+{
+  int width, height, pitch;
+  std::vector<uint8_t> old_ram, new_ram, glass; // glass: what the panel shows
+  std::vector<uint8_t> commands;
+  uint8_t *plane;
+  size_t pos;
+  size_t bytes; // data bytes received
+
+  VirtualController(int width, int height)
+      : width(width), height(height), pitch((width + 7) / 8), old_ram(pitch * height), new_ram(pitch * height),
+        glass(pitch * height, 0xff), plane(NULL), pos(0), bytes(0)
+  {
+  }
+
+  /** Deep sleep or a reset: the RAM holds whatever it powers up with, the glass keeps its picture */
+  void reset()
+  {
+    for (size_t i = 0; i < old_ram.size(); i++)
+    {
+      old_ram[i] = (uint8_t)(rand() & 0xff);
+      new_ram[i] = (uint8_t)(rand() & 0xff);
+    }
+    plane = NULL;
+    commands.clear();
+    bytes = 0;
+  }
+
+  void command(uint8_t cmd)
+  {
+    commands.push_back(cmd);
+    plane = (cmd == CMD_OLD) ? old_ram.data() : (cmd == CMD_NEW) ? new_ram.data() : NULL;
+    pos = 0;
+  }
+
+  /** @return false if there was no plane to write or it overflowed */
+  bool data(const uint8_t *p, int len)
+  {
+    bytes += len;
+    if (!plane || pos + len > old_ram.size())
+      return false;
+    memcpy(plane + pos, p, len);
+    pos += len;
+    return true;
+  }
+
+  /** Partial refresh: pixels equal in both planes aren't driven; new is copied to old afterwards */
+  int refresh_partial()
+  {
+    int driven = 0;
+    for (size_t i = 0; i < glass.size(); i++)
+    {
+      uint8_t change = old_ram[i] ^ new_ram[i];
+      glass[i] = (glass[i] & ~change) | (new_ram[i] & change);
+      driven += __builtin_popcount(change);
+      old_ram[i] = new_ram[i];
+    }
+    return driven;
+  }
+};
+
+static bool rows_fit;
+
+static void record_row(void *user, uint8_t *row, int len)
+{
+  rows_fit &= ((VirtualController *)user)->data(row, len);
+}
+
+/** What a partial refresh after a wake sends: the kept frame to the old plane, then the new one */
+static int send_frames(VirtualController &ctl, const uint8_t *packed, int size, const std::vector<uint8_t> &next)
+{
+  static uint8_t row[PANEL_WIDTH / 8 + 1];
+  int rc = BBEP_SUCCESS;
+  rows_fit = true;
+  if (packed)
+  {
+    ctl.command(CMD_OLD);
+    rc = bbepUnpackFrame(packed, size, ctl.width, ctl.height, row, record_row, &ctl);
+  }
+  ctl.command(CMD_NEW);
+  for (int y = 0; y < ctl.height; y++)
+    record_row(&ctl, (uint8_t *)&next[y * ctl.pitch], ctl.pitch);
+  return rows_fit ? rc : BBEP_ERROR_OUT_OF_BOUNDS;
+}
+
+static void fill_rect(std::vector<uint8_t> &frame, int width, int x0, int y0, int w, int h, int white)
+{
+  int pitch = (width + 7) / 8;
+  for (int y = y0; y < y0 + h; y++)
+    for (int x = x0; x < x0 + w && x < width; x++)
+    {
+      uint8_t mask = 0x80 >> (x & 7);
+      frame[y * pitch + x / 8] = white ? (frame[y * pitch + x / 8] | mask) : (frame[y * pitch + x / 8] & ~mask);
+    }
+}
+
+/** Something like a dashboard: a frame, a few boxes and lines of glyph-sized blobs */
+static std::vector<uint8_t> dashboard(int width, int height, int seed)
+{
+  std::vector<uint8_t> frame(((width + 7) / 8) * height, 0xff);
+  srand(seed);
+  fill_rect(frame, width, 0, height - 40, width, 40, 0); // title bar
+  fill_rect(frame, width, 20, 20, width - 40, 2, 0);
+  for (int line = 0; line < (height - 100) / 24; line++)
+  {
+    for (int x = 30; x < width - 40; x += 9 + rand() % 4)
+    {
+      if (rand() % 7 == 0)
+        continue; // a space
+      fill_rect(frame, width, x, 40 + line * 24, 2 + rand() % 5, 8 + rand() % 8, 0);
+    }
+  }
+  return frame;
+}
+
+static std::vector<uint8_t> noise(int width, int height)
+{
+  std::vector<uint8_t> frame(((width + 7) / 8) * height);
+  for (size_t i = 0; i < frame.size(); i++)
+    frame[i] = (uint8_t)(rand() & 0xff);
+  return frame;
+}
+
+/** @brief Packs and unpacks a frame; size gets the packed size, 0 if it didn't fit */
+static void round_trip(const std::vector<uint8_t> &frame, int width, int height, int &size)
+{
+  int pitch = (width + 7) / 8;
+  std::vector<uint8_t> packed(frame.size() + 4, 0);
+  VirtualController ctl(width, height);
+  size = bbepPackFrame(frame.data(), width, height, pitch, packed.data(), (int)frame.size());
+  if (size == 0)
+    return;
+  ctl.command(CMD_OLD);
+  uint8_t row[PANEL_WIDTH / 8 + 1];
+  rows_fit = true;
+  TEST_ASSERT_EQUAL(BBEP_SUCCESS, bbepUnpackFrame(packed.data(), size, width, height, row, record_row, &ctl));
+  TEST_ASSERT_TRUE(rows_fit);
+  TEST_ASSERT_EQUAL(frame.size(), ctl.bytes);
+  // the padding bits of the last byte of a row come back white
+  for (int y = 0; y < height; y++)
+    for (int x = 0; x < width; x++)
+    {
+      int before = (frame[y * pitch + x / 8] >> (7 - (x & 7))) & 1;
+      int after = (ctl.old_ram[y * pitch + x / 8] >> (7 - (x & 7))) & 1;
+      if (before != after)
+      {
+        TEST_FAIL_MESSAGE("pixel differs after the round trip");
+        return;
+      }
+    }
+}
+
+void test_round_trip(void)
+{
+  int size;
+  std::vector<uint8_t> white(PANEL_WIDTH / 8 * PANEL_HEIGHT, 0xff);
+  round_trip(white, PANEL_WIDTH, PANEL_HEIGHT, size);
+  TEST_ASSERT_TRUE(size > 0 && size < 200);
+
+  std::vector<uint8_t> frame = dashboard(PANEL_WIDTH, PANEL_HEIGHT, 1);
+  round_trip(frame, PANEL_WIDTH, PANEL_HEIGHT, size);
+  TEST_ASSERT_TRUE(size > 0 && size < (int)frame.size() / 2);
+
+  // odd width: rows end in padding bits
+  frame = dashboard(122, 250, 2);
+  round_trip(frame, 122, 250, size);
+  TEST_ASSERT_TRUE(size > 0 && size < (int)frame.size());
+}
+
+void test_noise_kept_as_is(void)
+{
+  int size;
+  std::vector<uint8_t> frame = noise(PANEL_WIDTH, PANEL_HEIGHT);
+  round_trip(frame, PANEL_WIDTH, PANEL_HEIGHT, size);
+  TEST_ASSERT_EQUAL(frame.size(), size); // G5 can't do better; the frame is copied
+}
+
+void test_pitch_and_limits(void)
+{
+  // rows wider than the image, like a framebuffer with a longer pitch
+  int width = 100, height = 30, pitch = 16, bytes = (width + 7) / 8;
+  std::vector<uint8_t> frame(pitch * height, 0x00), tight(bytes * height);
+  fill_rect(frame, pitch * 8, 10, 5, 50, 10, 1);
+  for (int y = 0; y < height; y++)
+    memcpy(&tight[y * bytes], &frame[y * pitch], bytes);
+  std::vector<uint8_t> wide_out(tight.size() + 4, 0), tight_out(tight.size() + 4, 0);
+  int size = bbepPackFrame(frame.data(), width, height, pitch, wide_out.data(), (int)tight.size());
+  TEST_ASSERT_TRUE(size > 0);
+  TEST_ASSERT_EQUAL(size, bbepPackFrame(tight.data(), width, height, bytes, tight_out.data(), (int)tight.size()));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(tight_out.data(), wide_out.data(), size);
+
+  // no room: for G5 nor for the frame as is
+  std::vector<uint8_t> busy = noise(width, height);
+  TEST_ASSERT_EQUAL(0, bbepPackFrame(busy.data(), width, height, bytes, wide_out.data(), (int)busy.size() - 1));
+  TEST_ASSERT_EQUAL(0, bbepPackFrame(tight.data(), width, height, bytes, wide_out.data(), 8));
+  TEST_ASSERT_EQUAL(0, bbepPackFrame(tight.data(), width, height, bytes - 1, wide_out.data(), (int)tight.size()));
+  TEST_ASSERT_EQUAL(0, bbepPackFrame(NULL, width, height, bytes, wide_out.data(), (int)tight.size()));
+}
+
+void test_bad_data(void)
+{
+  std::vector<uint8_t> frame = dashboard(PANEL_WIDTH, PANEL_HEIGHT, 3);
+  std::vector<uint8_t> packed(frame.size() + 4, 0);
+  int size = bbepPackFrame(frame.data(), PANEL_WIDTH, PANEL_HEIGHT, PANEL_WIDTH / 8, packed.data(), (int)frame.size());
+  TEST_ASSERT_TRUE(size > 0);
+  VirtualController ctl(PANEL_WIDTH, PANEL_HEIGHT);
+  uint8_t row[PANEL_WIDTH / 8];
+  ctl.command(CMD_OLD);
+  // cut short: found out before the last row
+  TEST_ASSERT_EQUAL(BBEP_ERROR_BAD_DATA, bbepUnpackFrame(packed.data(), size / 2, PANEL_WIDTH, PANEL_HEIGHT, row, record_row, &ctl));
+  TEST_ASSERT_TRUE(ctl.bytes < frame.size());
+  // longer than the frame itself can't be a packed frame
+  TEST_ASSERT_EQUAL(BBEP_ERROR_BAD_PARAMETER, bbepUnpackFrame(packed.data(), (int)frame.size() + 1, PANEL_WIDTH, PANEL_HEIGHT, row, record_row, &ctl));
+  TEST_ASSERT_EQUAL(BBEP_ERROR_BAD_PARAMETER, bbepUnpackFrame(packed.data(), 0, PANEL_WIDTH, PANEL_HEIGHT, row, record_row, &ctl));
+}
+
+void test_partial_refresh_after_wake(void)
+{
+  std::vector<uint8_t> shown = dashboard(PANEL_WIDTH, PANEL_HEIGHT, 4);
+  std::vector<uint8_t> next = shown;
+  fill_rect(next, PANEL_WIDTH, PANEL_WIDTH - 200, 60, 150, 40, 0); // the clock changed
+  fill_rect(next, PANEL_WIDTH, 30, 100, 300, 16, 1);
+  std::vector<uint8_t> packed(shown.size() + 4, 0);
+  int size = bbepPackFrame(shown.data(), PANEL_WIDTH, PANEL_HEIGHT, PANEL_WIDTH / 8, packed.data(), (int)shown.size());
+  TEST_ASSERT_TRUE(size > 0);
+
+  VirtualController ctl(PANEL_WIDTH, PANEL_HEIGHT);
+  ctl.glass = shown;
+  ctl.reset();
+  TEST_ASSERT_EQUAL(BBEP_SUCCESS, send_frames(ctl, packed.data(), size, next));
+  TEST_ASSERT_EQUAL(2, ctl.commands.size());
+  TEST_ASSERT_EQUAL_HEX8(CMD_OLD, ctl.commands[0]);
+  TEST_ASSERT_EQUAL_HEX8(CMD_NEW, ctl.commands[1]);
+  TEST_ASSERT_EQUAL(2 * shown.size(), ctl.bytes);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(shown.data(), ctl.old_ram.data(), shown.size());
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(next.data(), ctl.new_ram.data(), next.size());
+  int changed = 0;
+  for (size_t i = 0; i < shown.size(); i++)
+    changed += __builtin_popcount(shown[i] ^ next[i]);
+  TEST_ASSERT_EQUAL(changed, ctl.refresh_partial()); // only what changed moves
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(next.data(), ctl.glass.data(), next.size());
+
+  // without the kept frame the old plane is noise: the glass is wrong afterwards
+  VirtualController lost(PANEL_WIDTH, PANEL_HEIGHT);
+  lost.glass = shown;
+  lost.reset();
+  TEST_ASSERT_EQUAL(BBEP_SUCCESS, send_frames(lost, NULL, 0, next));
+  lost.refresh_partial();
+  TEST_ASSERT_TRUE(memcmp(next.data(), lost.glass.data(), next.size()) != 0);
+}
+
+void test_benchmark(void)
+{
+  const int runs = 5;
+  std::vector<uint8_t> frame = dashboard(PANEL_WIDTH, PANEL_HEIGHT, 5), next = frame;
+  fill_rect(next, PANEL_WIDTH, PANEL_WIDTH - 200, 60, 150, 40, 0);
+  std::vector<uint8_t> packed(frame.size() + 4, 0);
+  int size = 0;
+  clock_t start = clock();
+  for (int i = 0; i < runs; i++)
+    size = bbepPackFrame(frame.data(), PANEL_WIDTH, PANEL_HEIGHT, PANEL_WIDTH / 8, packed.data(), (int)frame.size());
+  double pack_ms = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC / runs;
+  VirtualController ctl(PANEL_WIDTH, PANEL_HEIGHT);
+  ctl.glass = frame;
+  start = clock();
+  for (int i = 0; i < runs; i++)
+  {
+    ctl.reset();
+    send_frames(ctl, packed.data(), size, next);
+  }
+  double send_ms = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC / runs;
+  int changed = 0;
+  for (size_t i = 0; i < frame.size(); i++)
+    changed += __builtin_popcount(frame[i] ^ next[i]);
+  int driven = ctl.refresh_partial();
+
+  VirtualController lost(PANEL_WIDTH, PANEL_HEIGHT);
+  lost.glass = frame;
+  lost.reset();
+  send_frames(lost, NULL, 0, next);
+  int driven_lost = lost.refresh_partial(), wrong = 0;
+  for (size_t i = 0; i < next.size(); i++)
+    wrong += __builtin_popcount(next[i] ^ lost.glass[i]);
+
+  printf("\n%-26s %10s %10s %10s %10s\n", "800x480 dashboard", "kept (B)", "SPI (B)", "driven px", "wrong px");
+  printf("%-26s %10d %10d %10d %10d\n", "old plane restored", size, (int)ctl.bytes, driven, 0);
+  printf("%-26s %10d %10d %10d %10d\n", "old plane lost", 0, (int)lost.bytes, driven_lost, wrong);
+  printf("pack %.2f ms, unpack + send %.2f ms (host)\n", pack_ms, send_ms);
+  TEST_ASSERT_EQUAL(changed, driven);
+  TEST_ASSERT_TRUE(size < (int)frame.size() / 4);
+  TEST_ASSERT_TRUE(wrong > 0);
+}
+
+void setUp(void)
+{
+  srand(42);
+}
+
+void tearDown(void)
+{
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_round_trip);
+  RUN_TEST(test_noise_kept_as_is);
+  RUN_TEST(test_pitch_and_limits);
+  RUN_TEST(test_bad_data);
+  RUN_TEST(test_partial_refresh_after_wake);
+  RUN_TEST(test_benchmark);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
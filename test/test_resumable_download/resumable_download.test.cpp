@@ -0,0 +1,319 @@
+#include <unity.h>
+#include <resumable_download.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#define IMAGE_URL "https://trmnl.app/plugin-123.png"
+
+class MemoryPartialStore : public PartialDownloadStore
+{
+public:
+  bool has_meta = false;
+  PartialDownloadMeta meta;
+  std::vector<uint8_t> body;
+
+  bool readMeta(PartialDownloadMeta &out) override
+  {
+    if (!has_meta)
+      return false;
+    out = meta;
+    return true;
+  }
+
+  bool writeMeta(const PartialDownloadMeta &in) override
+  {
+    meta = in;
+    has_meta = true;
+    return true;
+  }
+
+  size_t bodySize() override { return body.size(); }
+
+  bool readBody(uint8_t *buf, size_t len) override
+  {
+    if (len > body.size())
+      return false;
+    memcpy(buf, body.data(), len);
+    return true;
+  }
+
+  bool writeBody(const uint8_t *data, size_t len) override
+  {
+    body.assign(data, data + len);
+    return true;
+  }
+
+  void remove() override
+  {
+    has_meta = false;
+    body.clear();
+  }
+};
+
+struct StandInResponse
+{
+  int code;
+  std::string content_range;
+  std::string etag;
+  size_t content_length;
+  std::vector<uint8_t> body; // what arrives before the connection drops
+};
+
+/**
+ * Stand-in for the image server: honors Range / If-Range like an HTTP origin,
+ * and cuts the connection at a random offset of the body while `flaky` is set.
+ */
+class StandInServer
+{
+public:
+  std::vector<uint8_t> image;
+  std::string etag;
+  bool flaky = true;
+  bool ignore_range = false;
+  size_t bytes_sent = 0;
+  int requests = 0;
+
+  void publish(size_t size, const char *new_etag)
+  {
+    image.resize(size);
+    for (size_t i = 0; i < size; i++)
+      image[i] = (uint8_t)(rand() & 0xff);
+    etag = new_etag;
+  }
+
+  StandInResponse get(size_t range_from, const String &if_range)
+  {
+    requests++;
+    StandInResponse response;
+    response.etag = etag;
+    size_t from = 0;
+    if (range_from > 0 && !ignore_range && if_range == etag.c_str())
+    {
+      if (range_from >= image.size())
+      {
+        response.code = 416;
+        response.content_range = "bytes */" + std::to_string(image.size());
+        response.content_length = 0;
+        return response;
+      }
+      from = range_from;
+      response.code = 206;
+      response.content_range = "bytes " + std::to_string(from) + "-" + std::to_string(image.size() - 1) + "/" + std::to_string(image.size());
+    }
+    else
+    {
+      response.code = 200;
+    }
+    response.content_length = image.size() - from;
+
+    size_t length = response.content_length;
+    if (flaky)
+      length = rand() % length; // truncated somewhere in the body
+    response.body.assign(image.begin() + from, image.begin() + from + length);
+    bytes_sent += length;
+    return response;
+  }
+};
+
+static MemoryPartialStore *store;
+static StandInServer *server;
+
+/**
+ * One wake of the device: the same steps downloadAndShow() takes around the image request.
+ * @return true if the complete image ended up in `image`
+ */
+static bool download(ResumableDownload &download, std::vector<uint8_t> &image)
+{
+  String if_range;
+  size_t offset = download.prepare(IMAGE_URL, if_range);
+  StandInResponse response = server->get(offset, if_range);
+
+  resume_decision_e decision = download.onResponse(response.code, response.content_range.c_str());
+  if (decision == RESUME_MISMATCH)
+    return false;
+  if (response.code != 200 && response.code != 206)
+    return false;
+
+  size_t start = decision == RESUME_CONTINUE ? offset : 0;
+  size_t total = decision == RESUME_CONTINUE ? download.total() : response.content_length;
+  std::vector<uint8_t> buffer(total);
+  if (start > 0 && !download.restore(buffer.data(), buffer.size()))
+    return false;
+  memcpy(buffer.data() + start, response.body.data(), response.body.size());
+  size_t received = start + response.body.size();
+
+  if (received < total)
+  {
+    download.keep(IMAGE_URL, String(response.etag.c_str()), total, buffer.data(), received);
+    return false;
+  }
+  download.discard();
+  image = buffer;
+  return true;
+}
+
+void test_parse_content_range(void)
+{
+  uint32_t first, last, total;
+  TEST_ASSERT_TRUE(parse_content_range("bytes 100-999/1000", &first, &last, &total));
+  TEST_ASSERT_EQUAL(100, first);
+  TEST_ASSERT_EQUAL(999, last);
+  TEST_ASSERT_EQUAL(1000, total);
+
+  TEST_ASSERT_FALSE(parse_content_range("bytes */1000", &first, &last, &total));
+  TEST_ASSERT_FALSE(parse_content_range("bytes 100-999/*", &first, &last, &total));
+  TEST_ASSERT_FALSE(parse_content_range("bytes 100-1000/1000", &first, &last, &total));
+  TEST_ASSERT_FALSE(parse_content_range("bytes 200-100/1000", &first, &last, &total));
+  TEST_ASSERT_FALSE(parse_content_range("items 0-1/2", &first, &last, &total));
+  TEST_ASSERT_FALSE(parse_content_range("", &first, &last, &total));
+}
+
+void test_truncated_downloads_resume(void)
+{
+  for (int round = 0; round < 50; round++)
+  {
+    store->remove();
+    server->publish(20000 + rand() % 30000, "\"v1\"");
+    server->bytes_sent = 0;
+    server->requests = 0;
+    ResumableDownload resumable(*store);
+    std::vector<uint8_t> image;
+
+    int wakes = 0;
+    while (!download(resumable, image))
+    {
+      wakes++;
+      if (wakes == 20)
+        server->flaky = false; // the signal gets better eventually
+      TEST_ASSERT_TRUE(wakes < 30);
+    }
+    server->flaky = true;
+
+    TEST_ASSERT_EQUAL(server->image.size(), image.size());
+    TEST_ASSERT_EQUAL_MEMORY(server->image.data(), image.data(), image.size());
+    // no byte is sent twice
+    TEST_ASSERT_EQUAL(server->image.size(), server->bytes_sent);
+    TEST_ASSERT_EQUAL(0, store->bodySize());
+  }
+}
+
+void test_changed_image_starts_over(void)
+{
+  server->publish(30000, "\"v1\"");
+  ResumableDownload resumable(*store);
+  std::vector<uint8_t> image;
+  while (store->bodySize() == 0)
+    download(resumable, image);
+  size_t kept = store->bodySize();
+
+  // a new render under the same URL: If-Range doesn't match, the full new image comes back
+  server->publish(25000, "\"v2\"");
+  server->flaky = false;
+  server->bytes_sent = 0;
+  TEST_ASSERT_TRUE(download(resumable, image));
+  TEST_ASSERT_EQUAL(25000, image.size());
+  TEST_ASSERT_EQUAL_MEMORY(server->image.data(), image.data(), image.size());
+  TEST_ASSERT_EQUAL(25000, server->bytes_sent);
+  TEST_ASSERT_TRUE(kept > 0);
+}
+
+void test_other_url_drops_stored_bytes(void)
+{
+  server->publish(30000, "\"v1\"");
+  ResumableDownload resumable(*store);
+  std::vector<uint8_t> image;
+  while (store->bodySize() == 0)
+    download(resumable, image);
+
+  String if_range;
+  TEST_ASSERT_EQUAL(0, resumable.prepare("https://trmnl.app/plugin-456.png", if_range));
+  TEST_ASSERT_EQUAL(0, store->bodySize());
+  TEST_ASSERT_FALSE(store->has_meta);
+}
+
+void test_weak_etag_not_kept(void)
+{
+  server->publish(30000, "W/\"v1\"");
+  ResumableDownload resumable(*store);
+  std::vector<uint8_t> image;
+  for (int i = 0; i < 5; i++)
+  {
+    download(resumable, image);
+    TEST_ASSERT_EQUAL(0, store->bodySize());
+  }
+  TEST_ASSERT_FALSE(resumable.keep(IMAGE_URL, "", 100, server->image.data(), 50));
+  TEST_ASSERT_FALSE(store->has_meta);
+}
+
+void test_range_not_honored(void)
+{
+  server->publish(30000, "\"v1\"");
+  ResumableDownload resumable(*store);
+  std::vector<uint8_t> image;
+  while (store->bodySize() == 0)
+    download(resumable, image);
+
+  // a server (or proxy) that ignores Range sends the whole body with 200: start over
+  server->ignore_range = true;
+  server->flaky = false;
+  TEST_ASSERT_TRUE(download(resumable, image));
+  TEST_ASSERT_EQUAL_MEMORY(server->image.data(), image.data(), image.size());
+}
+
+void test_unexpected_range_dropped(void)
+{
+  server->publish(30000, "\"v1\"");
+  ResumableDownload resumable(*store);
+  uint8_t head[100];
+  TEST_ASSERT_TRUE(resumable.keep(IMAGE_URL, "\"v1\"", 30000, head, sizeof(head)));
+
+  String if_range;
+  TEST_ASSERT_EQUAL(100, resumable.prepare(IMAGE_URL, if_range));
+  TEST_ASSERT_EQUAL_STRING("\"v1\"", if_range.c_str());
+  TEST_ASSERT_EQUAL(RESUME_MISMATCH, resumable.onResponse(206, "bytes 0-29999/30000"));
+  TEST_ASSERT_FALSE(store->has_meta);
+
+  TEST_ASSERT_TRUE(resumable.keep(IMAGE_URL, "\"v1\"", 30000, head, sizeof(head)));
+  resumable.prepare(IMAGE_URL, if_range);
+  TEST_ASSERT_EQUAL(RESUME_MISMATCH, resumable.onResponse(416, "bytes */30000"));
+
+  // a plain server error keeps the bytes for the next attempt
+  TEST_ASSERT_TRUE(resumable.keep(IMAGE_URL, "\"v1\"", 30000, head, sizeof(head)));
+  resumable.prepare(IMAGE_URL, if_range);
+  TEST_ASSERT_EQUAL(RESUME_NONE, resumable.onResponse(503, ""));
+  TEST_ASSERT_EQUAL(100, store->bodySize());
+}
+
+void setUp(void)
+{
+  srand(1234);
+  store = new MemoryPartialStore();
+  server = new StandInServer();
+}
+
+void tearDown(void)
+{
+  delete store;
+  delete server;
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_parse_content_range);
+  RUN_TEST(test_truncated_downloads_resume);
+  RUN_TEST(test_changed_image_starts_over);
+  RUN_TEST(test_other_url_drops_stored_bytes);
+  RUN_TEST(test_weak_etag_not_kept);
+  RUN_TEST(test_range_not_honored);
+  RUN_TEST(test_unexpected_range_dropped);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
@@ -0,0 +1,243 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+// included by path: the rest of bb_epaper doesn't build on the host
+#include "../../lib/bb_epaper/src/bb_ep_queue.inl"
+
+/**
+ * Runs the data queue of bbepWriteData() on a transport that records each transfer instead of
+ * sending it, and checks the order of the bytes on the wire, the number of transfers, and that
+ * a buffer isn't touched while it's being sent. A virtual clock compares the time to send a
+ * frame with and without the queue.
+ */
+
+#define COMMAND 0x100 // marks a command byte on the recorded wire
+
+/** A transport that keeps what went out, in order, and checks the rules of the queue */
+struct Recorder
+{
+  std::vector<int> wire; // data bytes, and commands | COMMAND
+  std::vector<int> transfers; // length of each one
+  int waits;
+  uint8_t *flight; // buffer being sent
+  std::vector<uint8_t> flight_copy;
+  // virtual clock, in us
+  double now, done, us_per_byte, us_per_transfer;
+
+  Recorder() : waits(0), flight(NULL), now(0), done(0), us_per_byte(1), us_per_transfer(0) {}
+};
+
+static void record_start(void *user, uint8_t *data, int len)
+{
+  Recorder *rec = (Recorder *)user;
+  TEST_ASSERT_NULL(rec->flight); // one transfer at a time
+  TEST_ASSERT_TRUE(len > 0);
+  rec->flight = data;
+  rec->flight_copy.assign(data, data + len);
+  rec->transfers.push_back(len);
+  // the bytes go out after the previous transfer, while the caller carries on
+  rec->done = ((rec->now > rec->done) ? rec->now : rec->done) + rec->us_per_transfer + len * rec->us_per_byte;
+}
+
+static void record_wait(void *user)
+{
+  Recorder *rec = (Recorder *)user;
+  TEST_ASSERT_NOT_NULL(rec->flight); // a wait needs a transfer
+  // the buffer wasn't touched while it was being sent
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(rec->flight_copy.data(), rec->flight, rec->flight_copy.size());
+  for (uint8_t b : rec->flight_copy)
+    rec->wire.push_back(b);
+  rec->flight = NULL;
+  rec->waits++;
+  if (rec->done > rec->now)
+    rec->now = rec->done;
+}
+
+/** What bbepWriteCmd() does with the queue: flush it, then send the command on its own */
+static void write_cmd(BBEP_SPI_QUEUE *queue, Recorder &rec, uint8_t cmd)
+{
+  bbepQueueFlush(queue);
+  rec.wire.push_back(COMMAND | cmd);
+}
+
+static void init_queue(BBEP_SPI_QUEUE *queue, Recorder &rec, std::vector<uint8_t> &buffers, int size)
+{
+  buffers.assign(2 * size, 0);
+  bbepQueueInit(queue, &buffers[0], &buffers[size], size, record_start, record_wait, &rec);
+}
+
+void test_rows_fill_buffers(void)
+{
+  BBEP_SPI_QUEUE queue;
+  Recorder rec;
+  std::vector<uint8_t> buffers, expected;
+  uint8_t row[20];
+  init_queue(&queue, rec, buffers, 64);
+  for (int y = 0; y < 10; y++)
+  {
+    for (int i = 0; i < (int)sizeof(row); i++) // the same row buffer each time, like u8Cache
+      row[i] = (uint8_t)rand();
+    expected.insert(expected.end(), row, row + sizeof(row));
+    bbepQueueWrite(&queue, row, sizeof(row));
+  }
+  // 3 full buffers are out or on their way, the last 8 bytes wait for the flush
+  TEST_ASSERT_EQUAL(3, rec.transfers.size());
+  bbepQueueFlush(&queue);
+  const int lengths[] = {64, 64, 64, 8};
+  TEST_ASSERT_EQUAL(4, rec.transfers.size());
+  TEST_ASSERT_EQUAL_INT_ARRAY(lengths, rec.transfers.data(), 4);
+  TEST_ASSERT_EQUAL(4, rec.waits);
+  TEST_ASSERT_EQUAL(expected.size(), rec.wire.size());
+  for (size_t i = 0; i < expected.size(); i++)
+    TEST_ASSERT_EQUAL(expected[i], rec.wire[i]);
+}
+
+void test_overlap(void)
+{
+  // a full buffer is started without waiting for it; the wait comes when its buffer is needed again
+  BBEP_SPI_QUEUE queue;
+  Recorder rec;
+  std::vector<uint8_t> buffers, data(64 * 3, 0x5a);
+  init_queue(&queue, rec, buffers, 64);
+  bbepQueueWrite(&queue, data.data(), 64);
+  TEST_ASSERT_EQUAL(1, rec.transfers.size());
+  TEST_ASSERT_EQUAL(0, rec.waits);
+  bbepQueueWrite(&queue, data.data(), 63);
+  TEST_ASSERT_EQUAL(1, rec.transfers.size());
+  TEST_ASSERT_EQUAL(0, rec.waits);
+  bbepQueueWrite(&queue, data.data(), 1 + 64);
+  TEST_ASSERT_EQUAL(3, rec.transfers.size());
+  TEST_ASSERT_EQUAL(2, rec.waits);
+  bbepQueueFlush(&queue);
+  TEST_ASSERT_EQUAL(3, rec.transfers.size());
+  TEST_ASSERT_EQUAL(3, rec.waits);
+  TEST_ASSERT_NULL(rec.flight);
+}
+
+void test_large_write_splits(void)
+{
+  BBEP_SPI_QUEUE queue;
+  Recorder rec;
+  std::vector<uint8_t> buffers, data(300);
+  for (size_t i = 0; i < data.size(); i++)
+    data[i] = (uint8_t)i;
+  init_queue(&queue, rec, buffers, 64);
+  bbepQueueWrite(&queue, data.data(), (int)data.size());
+  bbepQueueFlush(&queue);
+  const int lengths[] = {64, 64, 64, 64, 44};
+  TEST_ASSERT_EQUAL(5, rec.transfers.size());
+  TEST_ASSERT_EQUAL_INT_ARRAY(lengths, rec.transfers.data(), 5);
+  for (size_t i = 0; i < data.size(); i++)
+    TEST_ASSERT_EQUAL(data[i], rec.wire[i]);
+}
+
+void test_commands_after_data(void)
+{
+  // set window, write RAM, rows of data, then refresh: no command may pass queued data
+  BBEP_SPI_QUEUE queue;
+  Recorder rec;
+  std::vector<uint8_t> buffers;
+  uint8_t window[4] = {0, 0, 99, 0}, row[3] = {0xa1, 0xa2, 0xa3};
+  init_queue(&queue, rec, buffers, 8);
+  write_cmd(&queue, rec, 0x44);
+  bbepQueueWrite(&queue, window, sizeof(window));
+  write_cmd(&queue, rec, 0x24);
+  for (int y = 0; y < 3; y++)
+    bbepQueueWrite(&queue, row, sizeof(row));
+  write_cmd(&queue, rec, 0x20);
+  write_cmd(&queue, rec, 0x10); // nothing queued: no transfer
+  const int expected[] = {COMMAND | 0x44, 0, 0, 99, 0, COMMAND | 0x24, 0xa1, 0xa2, 0xa3, 0xa1, 0xa2, 0xa3,
+                          0xa1, 0xa2, 0xa3, COMMAND | 0x20, COMMAND | 0x10};
+  TEST_ASSERT_EQUAL(sizeof(expected) / sizeof(expected[0]), rec.wire.size());
+  TEST_ASSERT_EQUAL_INT_ARRAY(expected, rec.wire.data(), rec.wire.size());
+  TEST_ASSERT_EQUAL(3, rec.transfers.size()); // window, 8 bytes of rows, the last 1
+  TEST_ASSERT_EQUAL(rec.transfers.size(), rec.waits);
+}
+
+void test_no_buffers(void)
+{
+  // without DMA buffers the queue is off and bbepWriteData() sends directly
+  BBEP_SPI_QUEUE queue;
+  Recorder rec;
+  uint8_t buf[8];
+  bbepQueueInit(&queue, buf, NULL, sizeof(buf), record_start, record_wait, &rec);
+  TEST_ASSERT_EQUAL(0, queue.iSize);
+  bbepQueueFlush(&queue);
+  TEST_ASSERT_EQUAL(0, rec.transfers.size());
+}
+
+/**
+ * @brief Virtual time to compute and send a frame of rows, one transfer per row straight from
+ *        the caller's buffer, then through the queue
+ */
+static void time_frame(int rows, int row_bytes, double us_per_row, double *direct_us, double *queued_us)
+{
+  const double us_per_byte = 1.0, us_per_transfer = 15.0; // 8 MHz SPI, spi_master setup
+  Recorder rec;
+  BBEP_SPI_QUEUE queue;
+  std::vector<uint8_t> buffers, row(row_bytes, 0xff);
+
+  *direct_us = rows * (us_per_row + us_per_transfer + row_bytes * us_per_byte);
+
+  rec.us_per_byte = us_per_byte;
+  rec.us_per_transfer = us_per_transfer;
+  init_queue(&queue, rec, buffers, 2048);
+  for (int y = 0; y < rows; y++)
+  {
+    rec.now += us_per_row; // compute the row while the last buffer goes out
+    bbepQueueWrite(&queue, row.data(), row_bytes);
+  }
+  bbepQueueFlush(&queue);
+  *queued_us = rec.now;
+}
+
+void test_benchmark(void)
+{
+  const struct
+  {
+    const char *name;
+    int rows, row_bytes;
+    double us_per_row;
+  } cases[] = {
+      {"1-bpp 800x480, G5 rows", 480, 100, 40},
+      {"1-bpp 800x480, PNG rows", 480, 100, 150},
+      {"2 planes 800x480, JPEG rows", 960, 100, 120},
+  };
+  printf("\n%-30s %12s %12s\n", "frame (virtual time)", "direct (ms)", "queued (ms)");
+  for (auto &c : cases)
+  {
+    double direct_us, queued_us;
+    time_frame(c.rows, c.row_bytes, c.us_per_row, &direct_us, &queued_us);
+    printf("%-30s %12.1f %12.1f\n", c.name, direct_us / 1000, queued_us / 1000);
+    TEST_ASSERT_TRUE(queued_us < direct_us);
+  }
+}
+
+void setUp(void)
+{
+  srand(1234);
+}
+
+void tearDown(void)
+{
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_rows_fill_buffers);
+  RUN_TEST(test_overlap);
+  RUN_TEST(test_large_write_splits);
+  RUN_TEST(test_commands_after_data);
+  RUN_TEST(test_no_buffers);
+  RUN_TEST(test_benchmark);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
@@ -0,0 +1,197 @@
+#include <unity.h>
+#include <tls_session_cache.h>
+#include <stdio.h>
+#include <string.h>
+
+static uint32_t fake_now = 0;
+
+static uint32_t fake_now_s() { return fake_now; }
+
+static TlsSessionCacheRtc rtc;
+
+static void fill(uint8_t *buf, size_t size, uint8_t seed)
+{
+  for (size_t i = 0; i < size; i++)
+    buf[i] = (uint8_t)(seed + i * 13);
+}
+
+void test_empty_cache(void)
+{
+  TlsSessionCache cache(rtc, fake_now_s);
+  TEST_ASSERT_NULL(cache.find("trmnl.app"));
+}
+
+void test_store_and_find(void)
+{
+  TlsSessionCache cache(rtc, fake_now_s);
+  uint8_t session[200];
+  fill(session, sizeof(session), 1);
+
+  TEST_ASSERT_TRUE(cache.store("trmnl.app", session, sizeof(session), 3600));
+  const TlsSessionEntry *entry = cache.find("trmnl.app");
+  TEST_ASSERT_NOT_NULL(entry);
+  TEST_ASSERT_EQUAL(sizeof(session), entry->size);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(session, entry->data, sizeof(session));
+  TEST_ASSERT_NULL(cache.find("cdn.trmnl.app"));
+}
+
+void test_survives_deep_sleep(void)
+{
+  uint8_t session[100];
+  fill(session, sizeof(session), 7);
+  {
+    TlsSessionCache cache(rtc, fake_now_s);
+    cache.store("trmnl.app", session, sizeof(session), 3600);
+  }
+
+  // next wake: new cache object over the same RTC memory
+  fake_now += 900;
+  TlsSessionCache cache(rtc, fake_now_s);
+  const TlsSessionEntry *entry = cache.find("trmnl.app");
+  TEST_ASSERT_NOT_NULL(entry);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(session, entry->data, sizeof(session));
+}
+
+void test_expiry(void)
+{
+  TlsSessionCache cache(rtc, fake_now_s);
+  uint8_t session[64] = {0};
+
+  cache.store("trmnl.app", session, sizeof(session), 600);
+  fake_now += 599;
+  TEST_ASSERT_NOT_NULL(cache.find("trmnl.app"));
+  fake_now += 1;
+  TEST_ASSERT_NULL(cache.find("trmnl.app"));
+}
+
+void test_lifetime_capped(void)
+{
+  TlsSessionCache cache(rtc, fake_now_s);
+  uint8_t session[64] = {0};
+
+  // no lifetime hint, or a week-long ticket: both capped
+  cache.store("a.example", session, sizeof(session), 0);
+  cache.store("b.example", session, sizeof(session), 7 * 24 * 3600);
+  fake_now += TLS_SESSION_MAX_AGE_S;
+  TEST_ASSERT_NULL(cache.find("a.example"));
+  TEST_ASSERT_NULL(cache.find("b.example"));
+}
+
+void test_clock_going_backwards_expires(void)
+{
+  TlsSessionCache cache(rtc, fake_now_s);
+  uint8_t session[64] = {0};
+
+  cache.store("trmnl.app", session, sizeof(session), 3600);
+  fake_now -= 10; // e.g. NTP correction
+  TEST_ASSERT_NULL(cache.find("trmnl.app"));
+}
+
+void test_replaces_same_host(void)
+{
+  TlsSessionCache cache(rtc, fake_now_s);
+  uint8_t first[64], second[80];
+  fill(first, sizeof(first), 1);
+  fill(second, sizeof(second), 2);
+
+  cache.store("trmnl.app", first, sizeof(first), 3600);
+  cache.store("trmnl.app", second, sizeof(second), 3600);
+  const TlsSessionEntry *entry = cache.find("trmnl.app");
+  TEST_ASSERT_EQUAL(sizeof(second), entry->size);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(second, entry->data, sizeof(second));
+
+  int used = 0;
+  for (int i = 0; i < TLS_SESSION_CACHE_ENTRIES; i++)
+    used += rtc.entries[i].host_hash != 0;
+  TEST_ASSERT_EQUAL(1, used);
+}
+
+void test_evicts_oldest(void)
+{
+  TlsSessionCache cache(rtc, fake_now_s);
+  uint8_t session[64] = {0};
+  char host[16];
+
+  for (int i = 0; i < TLS_SESSION_CACHE_ENTRIES; i++)
+  {
+    snprintf(host, sizeof(host), "host%d", i);
+    cache.store(host, session, sizeof(session), 3600);
+    fake_now += 10;
+  }
+  cache.store("newcomer", session, sizeof(session), 3600);
+
+  TEST_ASSERT_NULL(cache.find("host0"));
+  TEST_ASSERT_NOT_NULL(cache.find("host1"));
+  TEST_ASSERT_NOT_NULL(cache.find("newcomer"));
+}
+
+void test_too_big_session_not_cached(void)
+{
+  TlsSessionCache cache(rtc, fake_now_s);
+  uint8_t small[64] = {0};
+  uint8_t big[TLS_SESSION_MAX_SIZE + 1] = {0};
+
+  cache.store("trmnl.app", small, sizeof(small), 3600);
+  TEST_ASSERT_FALSE(cache.store("trmnl.app", big, sizeof(big), 3600));
+  // the old session is of no use once the server handed out a new one
+  TEST_ASSERT_NULL(cache.find("trmnl.app"));
+}
+
+void test_forget(void)
+{
+  TlsSessionCache cache(rtc, fake_now_s);
+  uint8_t session[64] = {0};
+
+  cache.store("trmnl.app", session, sizeof(session), 3600);
+  cache.store("cdn.trmnl.app", session, sizeof(session), 3600);
+  cache.forget("trmnl.app");
+  TEST_ASSERT_NULL(cache.find("trmnl.app"));
+  TEST_ASSERT_NOT_NULL(cache.find("cdn.trmnl.app"));
+}
+
+void test_handshake_stats(void)
+{
+  TlsSessionCache cache(rtc, fake_now_s);
+  cache.recordHandshake(false, 900);
+  cache.recordHandshake(true, 150);
+  cache.recordHandshake(true, 170);
+
+  TEST_ASSERT_EQUAL(1, cache.fullStats().count);
+  TEST_ASSERT_EQUAL(900, cache.fullStats().total_ms);
+  TEST_ASSERT_EQUAL(2, cache.resumedStats().count);
+  TEST_ASSERT_EQUAL(320, cache.resumedStats().total_ms);
+}
+
+void setUp(void)
+{
+  memset(&rtc, 0, sizeof(rtc));
+  fake_now = 1700000000;
+}
+
+void tearDown(void)
+{
+  // clean stuff up here
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_empty_cache);
+  RUN_TEST(test_store_and_find);
+  RUN_TEST(test_survives_deep_sleep);
+  RUN_TEST(test_expiry);
+  RUN_TEST(test_lifetime_capped);
+  RUN_TEST(test_clock_going_backwards_expires);
+  RUN_TEST(test_replaces_same_host);
+  RUN_TEST(test_evicts_oldest);
+  RUN_TEST(test_too_big_session_not_cached);
+  RUN_TEST(test_forget);
+  RUN_TEST(test_handshake_stats);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}
@@ -0,0 +1,240 @@
+#include <unity.h>
+#include <wall_clock.h>
+#include <string.h>
+
+// Simulated device: the local clock runs at (1 - slow_ppm) of real time
+static int64_t real_ms;
+static int64_t local_base_ms;  // local clock when it was last set
+static int64_t real_base_ms;   // real time when it was last set
+static int64_t slow_ppm;
+
+static int64_t fake_local_ms()
+{
+  return local_base_ms + (real_ms - real_base_ms) * (1000000 - slow_ppm) / 1000000;
+}
+
+static const WallClockOptions test_options = {
+    .local_ms = fake_local_ms,
+    .sync_every_wakes = 24,
+    .max_error_ms = 1000,
+    .min_sample_ms = 600000,
+    .initial_uncertainty_ppm = 1000,
+    .min_uncertainty_ppm = 20,
+};
+
+static WallClockRtc rtc;
+
+static const int64_t MINUTE_MS = 60000;
+
+/** What the device does when SNTP answers: note the local time, then set the clock */
+static void sync(WallClock &clock)
+{
+  int64_t before = fake_local_ms();
+  local_base_ms = real_ms;
+  real_base_ms = real_ms;
+  clock.onSync(before, real_ms);
+}
+
+/** One wake: deep sleep for sleep_ms, then boot (which builds a new WallClock over the same RTC memory) */
+static void sleep_and_wake(int64_t sleep_ms)
+{
+  real_ms += sleep_ms;
+}
+
+void test_unknown_until_first_sync(void)
+{
+  WallClock clock(rtc, test_options);
+  clock.wake();
+  TEST_ASSERT_TRUE(clock.syncNeeded());
+  TEST_ASSERT_TRUE(clock.nowMs() == 0);
+  TEST_ASSERT_EQUAL(-1, (int)clock.estimatedErrorMs());
+
+  sync(clock);
+  TEST_ASSERT_TRUE(clock.nowMs() == real_ms);
+  TEST_ASSERT_FALSE(clock.syncNeeded());
+}
+
+void test_time_kept_across_deep_sleep(void)
+{
+  slow_ppm = 0;
+  {
+    WallClock clock(rtc, test_options);
+    clock.wake();
+    sync(clock);
+  }
+  sleep_and_wake(5 * MINUTE_MS);
+  WallClock clock(rtc, test_options);
+  clock.wake();
+  TEST_ASSERT_FALSE(clock.syncNeeded());
+  TEST_ASSERT_TRUE(clock.nowMs() == real_ms);
+}
+
+void test_sync_every_n_wakes(void)
+{
+  WallClockOptions options = test_options;
+  options.max_error_ms = 0xffffffff; // only the wake count matters here
+  WallClock clock(rtc, options);
+  clock.wake();
+  sync(clock);
+
+  for (int i = 1; i < options.sync_every_wakes; i++)
+  {
+    sleep_and_wake(MINUTE_MS);
+    clock.wake();
+    TEST_ASSERT_FALSE(clock.syncNeeded());
+  }
+  sleep_and_wake(MINUTE_MS);
+  clock.wake();
+  TEST_ASSERT_TRUE(clock.syncNeeded());
+
+  // a sync that doesn't arrive keeps it due on the next wake
+  sleep_and_wake(MINUTE_MS);
+  clock.wake();
+  TEST_ASSERT_TRUE(clock.syncNeeded());
+}
+
+void test_drift_measured_and_corrected(void)
+{
+  slow_ppm = 800;
+  WallClock clock(rtc, test_options);
+  clock.wake();
+  sync(clock);
+
+  sleep_and_wake(60 * MINUTE_MS);
+  clock.wake();
+  // uncorrected, the clock is 2.88 s behind
+  TEST_ASSERT_EQUAL(-2880, (int)(fake_local_ms() - real_ms));
+  sync(clock);
+  TEST_ASSERT_EQUAL(-2880, clock.lastErrorMs());
+  TEST_ASSERT_INT_WITHIN(2, 800, clock.driftPpm());
+
+  sleep_and_wake(60 * MINUTE_MS);
+  TEST_ASSERT_INT_WITHIN(10, 0, (int)(clock.nowMs() - real_ms));
+}
+
+void test_unstable_clock_resyncs_sooner(void)
+{
+  slow_ppm = 0;
+  WallClock clock(rtc, test_options);
+  clock.wake();
+  sync(clock);
+
+  // with no measurement yet (1000 ppm assumed), 1 s of error is reached after ~17 min
+  sleep_and_wake(15 * MINUTE_MS);
+  clock.wake();
+  TEST_ASSERT_FALSE(clock.syncNeeded());
+  sleep_and_wake(5 * MINUTE_MS);
+  TEST_ASSERT_TRUE(clock.syncNeeded());
+  TEST_ASSERT_EQUAL(1200, (int)clock.estimatedErrorMs());
+}
+
+void test_stable_clock_syncs_less_often(void)
+{
+  slow_ppm = 300;
+  WallClock clock(rtc, test_options);
+  clock.wake();
+  sync(clock);
+
+  int syncs = 0;
+  int last_interval = 0;
+  int wakes = 0;
+  for (int wake = 0; wake < 500; wake++)
+  {
+    sleep_and_wake(15 * MINUTE_MS);
+    clock.wake();
+    wakes++;
+    // whenever the clock isn't due, its corrected time is within the promised bound
+    if (!clock.syncNeeded())
+    {
+      TEST_ASSERT_TRUE(clock.nowMs() - real_ms <= test_options.max_error_ms);
+      TEST_ASSERT_TRUE(real_ms - clock.nowMs() <= test_options.max_error_ms);
+      continue;
+    }
+    sync(clock);
+    syncs++;
+    last_interval = wakes;
+    wakes = 0;
+  }
+  TEST_ASSERT_EQUAL(test_options.sync_every_wakes, last_interval);
+  TEST_ASSERT_TRUE(syncs < 500 / 10);
+}
+
+void test_close_syncs_dont_update_drift(void)
+{
+  slow_ppm = 800;
+  WallClock clock(rtc, test_options);
+  clock.wake();
+  sync(clock);
+  sleep_and_wake(MINUTE_MS);
+  sync(clock);
+  TEST_ASSERT_EQUAL(0, clock.driftPpm());
+  TEST_ASSERT_EQUAL(-48, clock.lastErrorMs());
+}
+
+void test_clock_reset_makes_time_unknown(void)
+{
+  WallClock clock(rtc, test_options);
+  clock.wake();
+  real_ms = 1700000000000LL;
+  sync(clock);
+
+  // power loss: the local clock starts over from 0
+  local_base_ms = 0;
+  real_base_ms = real_ms;
+  sleep_and_wake(MINUTE_MS);
+  TEST_ASSERT_TRUE(clock.nowMs() == 0);
+  TEST_ASSERT_TRUE(clock.syncNeeded());
+
+  // and the next sync isn't taken as a drift measurement
+  sync(clock);
+  TEST_ASSERT_EQUAL(0, clock.driftPpm());
+  TEST_ASSERT_TRUE(clock.nowMs() == real_ms);
+}
+
+void test_glitch_ignored(void)
+{
+  WallClock clock(rtc, test_options);
+  clock.wake();
+  sync(clock);
+  sleep_and_wake(60 * MINUTE_MS);
+
+  // someone moved the server time by an hour
+  real_ms += 60 * MINUTE_MS;
+  real_base_ms += 60 * MINUTE_MS;
+  sync(clock);
+  TEST_ASSERT_EQUAL(0, clock.driftPpm());
+}
+
+void setUp(void)
+{
+  memset(&rtc, 0, sizeof(rtc));
+  real_ms = 1700000000000LL;
+  local_base_ms = 0; // cold boot: the local clock starts at the epoch
+  real_base_ms = real_ms;
+  slow_ppm = 0;
+}
+
+void tearDown(void)
+{
+}
+
+void process()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_unknown_until_first_sync);
+  RUN_TEST(test_time_kept_across_deep_sleep);
+  RUN_TEST(test_sync_every_n_wakes);
+  RUN_TEST(test_drift_measured_and_corrected);
+  RUN_TEST(test_unstable_clock_resyncs_sooner);
+  RUN_TEST(test_stable_clock_syncs_less_often);
+  RUN_TEST(test_close_syncs_dont_update_drift);
+  RUN_TEST(test_clock_reset_makes_time_unknown);
+  RUN_TEST(test_glitch_ignored);
+  UNITY_END();
+}
+
+int main(int argc, char **argv)
+{
+  process();
+  return 0;
+}